@@ -0,0 +1,324 @@
+#include <stdint.h>
+
+const uint8_t picture[] = {
+ 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xc6,0x79,0xa5,0x94,0x84,0xd1,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0xd6,0xba,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xd6,0xdb,0x8c,0xf1,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x7c,0xb0,0x8c,0xf1,0xa5,0x94,0xd6,0xda,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfa,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x6f,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xf7,0x9e,0xbe,0x37,0xa5,0x74,0x95,0x12,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xef,0x7d,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xbe,0x37,0x6c,0x2e,0xa5,0xb5,0xdf,0x1b,0xf7,0xbe,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xad,0xd5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xdf,0x1b,0x8d,0x11,0x74,0x2e,0x95,0x33,0xce,0x99,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xdf,0x6c,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0x95,0x53,0x74,0x4e,0x63,0xec,0x63,0xcc,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x32,0xa7,0x32,0xa7,0x3a,0xe8,0x3b,0x08,0x3a,0xe8,0x32,0xa7,0x32,0xa7,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xe7,0x3c,0xad,0xb5,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x4b,0x6a,0x53,0x8a,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x2a,0x66,0x22,0x26,0x22,0x25,0x2a,0x46,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x2a,0x66,0x22,0x26,0x22,0x26,0x2a,0x46,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xc7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x2a,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x2a,0x67,0x43,0x09,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0x9d,0x53,0xb6,0x17,0x95,0x33,0x9d,0x33,0x3a,0xc8,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x86,0x32,0xa7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x43,0x08,0x22,0x46,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0x87,0x3b,0x08,0x43,0x29,0x43,0x28,0x3b,0x08,0x43,0x28,0x3b,0x08,0x43,0x29,0x43,0x29,0x43,0x28,0x3b,0x08,0x32,0xc7,0x32,0x87,0x32,0x87,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x2a,0x87,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x47,0x4b,0x29,0x32,0x67,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x53,0x8a,0x53,0x8a,0x3b,0x08,0x4b,0x49,0x43,0x08,0x43,0x29,0x53,0xab,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xc6,0x78,0x8d,0x12,0x84,0xd1,0x8d,0x12,0x84,0xd1,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x53,0x8a,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x95,0x32,0xc6,0x79,0xe7,0x5c,0xef,0x7d,0xe7,0x1c,0xb5,0xf6,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x19,0xc5,0x3a,0xa7,0x4b,0x08,0x22,0x05,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x43,0x08,0x4b,0x08,0x2a,0x46,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x8f,0xb6,0x17,0xb5,0xf6,0x84,0xd0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0x6c,0x4e,0x64,0x0d,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x66,0x22,0x05,0x19,0xe5,0x19,0xe5,0x22,0x26,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x26,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x1a,0x05,0x19,0xe5,0x42,0xc9,0x74,0x0f,0x7c,0x50,0x53,0x2b,0x19,0xe5,0x19,0xe5,0x42,0xea,0x94,0xf2,0x84,0x70,0x73,0xef,0x9c,0xf3,0x53,0x2b,0x84,0x91,0x84,0x70,0x42,0xc9,0x19,0xe5,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0xd6,0xba,0x7c,0x50,0x9d,0x54,0xde,0xfb,0x32,0x67,0x42,0xa9,0x74,0x0e,0x6b,0xee,0x4b,0x0b,0x19,0xe5,0x19,0xc5,0x3a,0xa9,0x74,0x0f,0x63,0xad,0x63,0x6c,0x94,0xb2,0x53,0x2b,0x6b,0xcd,0x7c,0x50,0x42,0xc9,0x19,0xe5,0x3a,0xc7,0xb5,0xf6,0xa5,0xb5,0x5b,0xcc,0x9d,0x74,0x4b,0x6a,0x9d,0x53,0xc6,0x78,0x5b,0xcc,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x63,0x8d,0x7c,0x50,0x74,0x0f,0x2a,0x47,0x19,0xe5,0x19,0xc5,0x5b,0x8c,0xad,0x95,0x9d,0x33,0x63,0x6c,0x84,0x50,0x63,0x4c,0x9d,0x34,0xad,0xb6,0x63,0xad,0x19,0xe5,0x3a,0xe7,0xce,0x99,0xbe,0x37,0x7c,0x90,0xce,0x79,0x53,0x8a,0x9d,0x53,0xb5,0xf7,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xad,0xb5,0xd6,0xba,0x8c,0xf1,0xd6,0xba,0x7c,0x6f,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x43,0x29,0x74,0x4e,0xb5,0xf6,0xdf,0x1c,0xef,0x9d,0xe7,0x5c,0xbe,0x37,0x7c,0x6f,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9e,0x95,0x12,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x9d,0x4e,0xef,0x74,0xff,0xf6,0xce,0x92,0x53,0x69,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x32,0xc7,0x5b,0xca,0xbe,0x11,0xff,0xf6,0xff,0xf6,0xd6,0xf3,0x74,0x6c,0x32,0xc7,0x32,0xa7,0x3b,0x08,0x7c,0x6f,0xce,0x99,0xad,0xd5,0x9d,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xc6,0x78,0xad,0xb5,0xb5,0xf6,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x53,0x69,0x5b,0x89,0x5b,0x89,0x2a,0x46,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x53,0x69,0x5b,0x89,0x5b,0x89,0x43,0x08,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x32,0xa7,0x8c,0xf2,0xe7,0x3c,0xe7,0x3c,0xad,0xb5,0x32,0xc7,0x32,0xc7,0x95,0x33,0xef,0x5d,0xd6,0x9a,0x31,0xa7,0x29,0x65,0x29,0x66,0xe7,0x1b,0xef,0x5d,0xa5,0x54,0x19,0xe5,0x32,0xc7,0x63,0xec,0x6c,0x2d,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0x53,0x4b,0x74,0x2f,0x2a,0x66,0x84,0x90,0x3a,0xe8,0x8c,0xd1,0xe7,0x3c,0xe7,0x3c,0xb5,0xd6,0x2a,0x87,0x2a,0x66,0x8c,0xd1,0xef,0x5d,0xde,0xfb,0x42,0x08,0x29,0x65,0x29,0x65,0xde,0xda,0xef,0x5d,0xad,0xb6,0x19,0xe5,0x32,0xc7,0xce,0x99,0xb6,0x17,0x84,0xd1,0xce,0x79,0x5b,0xab,0x53,0x8a,0xd6,0xda,0x53,0x4b,0x19,0xe5,0x22,0x46,0x32,0xc7,0x32,0xc7,0x3a,0xc8,0xde,0xfb,0xe7,0x3c,0xe7,0x3c,0x63,0xed,0x32,0xc7,0x32,0xc7,0x95,0x33,0xe7,0x3c,0xde,0xdb,0x39,0xe7,0x29,0x65,0x31,0x86,0xde,0xdb,0xef,0x5d,0xa5,0x54,0x19,0xe5,0x32,0xc7,0xd6,0xfa,0xc6,0x78,0x74,0x4e,0xbe,0x38,0x53,0x8a,0xd6,0xda,0xbe,0x17,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xad,0xb5,0x9d,0x73,0x84,0xb0,0x95,0x33,0x84,0xb0,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x43,0x29,0xa5,0x95,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x8d,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0xa5,0x8f,0xff,0xf6,0xde,0xd5,0xce,0x55,0xef,0x75,0xf7,0xb5,0x3a,0xc7,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x1a,0x05,0xc6,0x51,0xff,0xd6,0xd6,0x95,0xc6,0x35,0xf7,0x95,0xdf,0x13,0x32,0x66,0x22,0x25,0x3b,0x08,0x7c,0x6f,0x84,0xd1,0xa5,0x74,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0x9d,0x53,0xc6,0x38,0x8d,0x12,0x3b,0x08,0x2a,0x46,0x19,0xe5,0xad,0xaf,0xff,0xd5,0xff,0xf6,0xff,0xf6,0xde,0xf3,0x3a,0xc7,0x19,0xe5,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x4b,0x28,0xce,0x92,0xff,0xf6,0xff,0xf6,0xff,0xf6,0xe7,0x34,0x63,0xea,0x22,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xe8,0x95,0x12,0xef,0x7d,0xef,0x7d,0xb5,0xf6,0x32,0xa7,0x32,0x87,0x95,0x13,0xef,0x5d,0xd6,0x9a,0x31,0xa7,0x29,0x65,0x29,0x66,0xe7,0x1b,0xef,0x5d,0xa5,0x75,0x19,0xe5,0x5b,0x8b,0xe7,0x5c,0x9d,0x33,0xb5,0xf6,0x4b,0x6a,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x86,0x3a,0xe8,0x32,0xa7,0x32,0xa7,0x8c,0xd1,0xf7,0x9e,0xf7,0x9e,0xbe,0x17,0x3a,0xe7,0x3a,0xe7,0x95,0x12,0xef,0x5d,0xde,0xfb,0x42,0x08,0x29,0x65,0x29,0x65,0xde,0xda,0xef,0x5d,0xad,0xb6,0x19,0xe5,0x32,0xc7,0xc6,0x58,0xbe,0x37,0x5b,0xab,0xad,0xd5,0x6c,0x0d,0x6c,0x2d,0x9d,0x53,0x6b,0xce,0x22,0x46,0x3a,0xe8,0x32,0xa7,0x32,0x87,0x32,0xa7,0xde,0xfb,0xef,0x7d,0xef,0x5d,0x63,0xcc,0x32,0x87,0x32,0x87,0x95,0x33,0xe7,0x3c,0xde,0xdb,0x39,0xe7,0x29,0x65,0x31,0x86,0xde,0xdb,0xef,0x5d,0xa5,0x54,0x19,0xe5,0x32,0xc7,0xc6,0x38,0xad,0xd5,0x63,0xec,0xc6,0x78,0x74,0x6e,0xc6,0x58,0xad,0xd5,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xef,0x7d,0xb5,0xf6,0xd6,0xba,0xd6,0xda,0xe7,0x3c,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x43,0x29,0xa5,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xb6,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xc5,0xff,0xf6,0xf7,0x98,0x94,0xb2,0x7b,0xce,0xce,0x78,0xff,0xf6,0x84,0xad,0x22,0x26,0x7c,0x90,0x8c,0xf1,0x8c,0xf1,0x8c,0xf1,0x8d,0x11,0x4b,0x2a,0x4b,0x28,0xff,0xd5,0xef,0x79,0x84,0x0f,0x7b,0xef,0xde,0xb8,0xff,0xf6,0x4b,0x08,0x19,0xe5,0x3b,0x08,0xb5,0xd6,0xa5,0xb5,0xd6,0xda,0x84,0xd1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0x53,0x6a,0x84,0xb0,0x4b,0x6a,0x3a,0xe7,0x19,0xe5,0x5b,0x8a,0xff,0xd6,0xd6,0xb5,0xad,0x74,0xb5,0x93,0xff,0xf7,0xa5,0x8f,0x19,0xc5,0x53,0x4b,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x63,0xed,0x19,0xe5,0x6c,0x0b,0xff,0xf6,0xde,0xd5,0xad,0x74,0xbd,0xf4,0xff,0xf6,0xa5,0x8f,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x05,0x1a,0x05,0x32,0xc7,0x3a,0xe8,0x22,0x26,0x53,0x2b,0x42,0x08,0x42,0x08,0x5b,0x0b,0x22,0x26,0x19,0xe5,0x84,0x91,0xc6,0x38,0xa5,0x54,0x42,0x68,0x73,0xae,0x52,0xeb,0xbd,0xf7,0xc6,0x38,0x4b,0x2a,0x19,0xe5,0x6c,0x0e,0xe7,0x5c,0x8d,0x11,0xbe,0x37,0x53,0x8a,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x5b,0x6c,0x42,0x28,0x42,0x28,0x52,0xeb,0x2a,0x26,0x19,0xe5,0x6b,0xee,0xce,0x59,0xbd,0xd7,0x5a,0xeb,0x6b,0x8d,0x5a,0xeb,0xb5,0xb6,0xce,0x99,0x7c,0x70,0x19,0xe5,0x32,0xc7,0x84,0xb0,0x63,0xec,0x74,0x4f,0x9d,0x73,0x84,0xb0,0x7c,0x90,0x8c,0xb1,0x2a,0x67,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x2a,0x26,0x4a,0x69,0x42,0x08,0x42,0x28,0x3a,0xa9,0x19,0xe5,0x19,0xe5,0x4b,0x2b,0x94,0xf2,0x8c,0xb1,0x73,0xce,0x9c,0xf3,0x63,0x6d,0x8c,0xd1,0x9d,0x74,0x63,0xcd,0x19,0xe5,0x3a,0xe7,0x4b,0x6a,0x4b,0x49,0x4b,0x6a,0x6c,0x2e,0x5b,0xcc,0x4b,0x6a,0x6c,0x0d,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xce,0x99,0x7c,0xb0,0xad,0xd5,0xe7,0x1c,0xff,0xff,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x7c,0x6f,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x32,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xc5,0xff,0xf6,0xff,0xfc,0xf7,0x9d,0xef,0x7d,0xff,0xde,0xff,0xf9,0xb5,0xd3,0x74,0x0f,0x84,0xb0,0x84,0xd0,0x84,0xd0,0x84,0xd0,0x84,0xd0,0x74,0x4f,0x95,0x11,0xff,0xf9,0xf7,0x9c,0xf7,0x7d,0xf7,0x7d,0xff,0xdd,0xff,0xf6,0x7c,0x6c,0x19,0xe5,0x3a,0xe8,0xa5,0x74,0xce,0x79,0x95,0x33,0x7c,0x6f,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xd5,0xb5,0xf6,0xb5,0xf6,0x8d,0x12,0x32,0xc7,0x19,0xe5,0xc6,0x72,0xff,0xf6,0xce,0x78,0x9c,0xd2,0xad,0x54,0xf7,0x99,0xff,0xd6,0x32,0xa7,0x42,0xe9,0x7c,0x6f,0x7c,0x6f,0x7c,0x6f,0x7c,0x6f,0x6c,0x0e,0x19,0xe5,0x9d,0x6f,0xff,0xf7,0xce,0x78,0x9c,0xd2,0xb5,0x95,0xf7,0xb9,0xe7,0x34,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x94,0xb2,0x29,0x66,0x29,0x66,0x7c,0x10,0x3a,0xa8,0x19,0xc5,0x19,0xe5,0x22,0x06,0x19,0xe5,0x2a,0x26,0x53,0x6b,0x32,0x68,0x22,0x05,0x32,0xa7,0x22,0x26,0x1a,0x05,0x53,0x8b,0x74,0x4e,0x6c,0x2e,0x5b,0xcc,0x3b,0x08,0x32,0x87,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x2a,0x66,0xa5,0x34,0x29,0x65,0x29,0x65,0x5b,0x2c,0x3a,0xc9,0x19,0xc5,0x19,0xe5,0x22,0x06,0x22,0x05,0x32,0x67,0x63,0xcd,0x42,0xc9,0x22,0x06,0x43,0x29,0x22,0x26,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x22,0x05,0x32,0xa7,0x74,0x0e,0x5b,0x0c,0x29,0x65,0x29,0x65,0x7c,0x70,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x22,0x06,0x22,0x05,0x3b,0x08,0x22,0x05,0x22,0x25,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xad,0xd5,0x9d,0x73,0x8c,0xf1,0x74,0x6f,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xb9,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0xc6,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x43,0x08,0x19,0xc5,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x22,0x26,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x32,0xa7,0x2a,0x46,0x2a,0x86,0x32,0x87,0x32,0xa7,0x74,0x4f,0x8c,0xf1,0x53,0x8b,0x32,0x87,0x4b,0x0a,0x2a,0x47,0x22,0x05,0x22,0x05,0x22,0x25,0x19,0xe5,0x95,0x0e,0xff,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdd,0xff,0xfc,0xc6,0x37,0xbd,0xf7,0xbe,0x37,0xbe,0x37,0xbe,0x37,0xbe,0x37,0xbe,0x17,0xbd,0xf7,0xe7,0x1a,0xff,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xe7,0x34,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x19,0xe5,0x84,0x30,0x29,0x65,0x29,0x66,0x63,0x4c,0x32,0x67,0x19,0xe5,0x42,0xe9,0x7c,0x50,0x4a,0xea,0x19,0xe5,0x3a,0xe8,0x22,0x26,0x2a,0x47,0x6c,0x0e,0x42,0xe9,0x53,0x4b,0x74,0x2e,0xbe,0x57,0xa5,0x94,0xce,0x99,0x4b,0x6a,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x32,0x87,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x2a,0x66,0x7c,0x0f,0x29,0x65,0x29,0x65,0x52,0xeb,0x32,0x88,0x19,0xe5,0x2a,0x26,0x53,0x4b,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x22,0x26,0x22,0x06,0x6c,0x0d,0x42,0xe9,0x42,0xea,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3a,0xe7,0x5b,0x6c,0x52,0x8a,0x29,0x65,0x29,0x65,0x6b,0xee,0x19,0xe5,0x19,0xe5,0x22,0x26,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x19,0xe5,0x32,0x88,0x4b,0x49,0x2a,0x46,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xef,0x7d,0x95,0x12,0x7c,0x8f,0x7c,0x90,0xad,0xd5,0xff,0xff,0xf7,0x9e,0x6c,0x2e,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x53,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x4b,0x6a,0x32,0xc7,0x19,0xe5,0x94,0xf0,0xff,0xff,0xf7,0xbe,0xbd,0xd7,0xb5,0xb6,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0x79,0xad,0x54,0xef,0x5d,0xff,0xff,0xc6,0x78,0x2a,0x87,0x19,0xe5,0x19,0xe5,0x73,0xee,0x95,0x13,0x9d,0x34,0x53,0x4b,0x1a,0x05,0x1a,0x05,0x2a,0x66,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x22,0x26,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x42,0xea,0xa5,0x75,0x53,0x4b,0xad,0x95,0x3a,0x88,0x32,0x67,0x63,0x8d,0x63,0xad,0x2a,0x26,0x19,0xc5,0x19,0xc5,0x53,0x69,0xff,0xdd,0xff,0xff,0xff,0xff,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xa5,0x90,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x19,0xc5,0x63,0xad,0xa5,0x34,0xa5,0x34,0x8c,0x91,0x2a,0x66,0x22,0x05,0x84,0xb1,0xef,0x5d,0x94,0xf2,0x19,0xe5,0x3a,0xe7,0x22,0x05,0x4b,0x0a,0xef,0x5d,0xc6,0x38,0x8c,0xb1,0x63,0xcd,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x2a,0x46,0x5b,0xac,0x9c,0xf3,0x9c,0xf3,0x7c,0x50,0x22,0x46,0x22,0x05,0xa5,0x54,0xe7,0x3c,0x74,0x2f,0x19,0xe5,0x3a,0xe8,0x19,0xe5,0x5b,0x8c,0xe7,0x3c,0xb5,0xf6,0x8c,0xb2,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x32,0xa7,0x2a,0x66,0x9d,0x14,0xa5,0x34,0xa5,0x34,0x3a,0xc9,0x22,0x25,0x2a,0x26,0xc6,0x58,0xe7,0x1c,0x4b,0x0a,0x22,0x26,0x32,0xc7,0x19,0xe5,0x8c,0xd2,0xe7,0x3c,0x84,0x91,0x94,0xd2,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xd6,0xda,0xc6,0x58,0xf7,0x9e,0xff,0xff,0xff,0xdf,0xff,0xff,0xf7,0x9e,0x7c,0x6f,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1b,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0xbe,0x37,0x3b,0x08,0x5b,0xcc,0x84,0x91,0xff,0xff,0xc5,0xf7,0x62,0xeb,0x62,0xeb,0xad,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x6b,0x2c,0x62,0xeb,0x83,0xef,0xff,0xff,0xbe,0x58,0x74,0x4e,0x32,0x87,0x19,0xe5,0xad,0x95,0xef,0x5d,0xef,0x5d,0xa5,0x94,0x3a,0xe8,0x3a,0xe8,0x5b,0xab,0xc6,0x78,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x22,0x26,0x5b,0xab,0x43,0x09,0x32,0xa7,0x53,0x6b,0x8c,0xd1,0x3a,0xe8,0x94,0xf2,0x43,0x09,0x8c,0xd1,0xe7,0x3c,0xe7,0x3c,0xad,0xb6,0x19,0xc5,0x19,0xe5,0x19,0xe5,0xde,0xfb,0xff,0xff,0xb5,0x95,0x84,0x0f,0xb5,0x96,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0x84,0x30,0x9c,0xb2,0xf7,0x9e,0xff,0xdf,0x74,0x2e,0x32,0xa7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x19,0xc5,0x84,0xb1,0xef,0x7d,0xef,0x7d,0xb5,0xf6,0x43,0x08,0x3a,0xe7,0x95,0x12,0xef,0x7d,0xa5,0x74,0x32,0xa7,0x3b,0x08,0x22,0x05,0x4b,0x0a,0xef,0x7d,0xc6,0x58,0x8c,0xb1,0x4b,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x8c,0xf2,0xef,0x7d,0xef,0x7d,0xbe,0x37,0x3b,0x08,0x32,0xc7,0xad,0x95,0xf7,0x9d,0x94,0xf2,0x32,0x87,0x3b,0x08,0x19,0xe5,0x6b,0xee,0xf7,0x9d,0xb5,0xf7,0x8c,0xb2,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x43,0x28,0xdf,0x1b,0xef,0x7d,0xef,0x7d,0x74,0x2e,0x3b,0x08,0x43,0x08,0xd6,0xba,0xef,0x7d,0x53,0x8b,0x32,0x87,0x32,0xc7,0x19,0xe5,0x8c,0xf2,0xf7,0x9e,0x94,0xf2,0x94,0xd2,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0x95,0xff,0xff,0xf7,0x9e,0x6c,0x2e,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x5b,0xec,0x3b,0x08,0x84,0xb0,0xa5,0x54,0xff,0xff,0xbd,0xb6,0x62,0xeb,0x62,0xeb,0xa5,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xef,0x7d,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xdb,0x6b,0x2c,0x62,0xeb,0x84,0x10,0xff,0xff,0xbe,0x58,0x95,0x12,0x32,0xc7,0x19,0xe5,0x94,0xf2,0xde,0xfb,0xde,0xfb,0x95,0x33,0x32,0xa7,0x32,0xa7,0x3a,0xe8,0x64,0x0d,0x22,0x26,0x19,0xe5,0x19,0xc5,0x32,0xa7,0xe7,0x3c,0x7c,0x8f,0x3a,0xe7,0x5b,0xac,0x84,0xb0,0x84,0x90,0x84,0xf1,0x3b,0x08,0x8c,0xd1,0xf7,0x9e,0xf7,0xbe,0xad,0xb6,0x19,0xe5,0x19,0xe5,0x63,0xad,0xde,0xfb,0xf7,0xbe,0x63,0x0c,0x62,0xeb,0x73,0x6d,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x8c,0x50,0x62,0xeb,0x62,0xeb,0xce,0x79,0xff,0xdf,0x9d,0x33,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x19,0xc5,0x63,0xcd,0xce,0x79,0xce,0x79,0x84,0xb1,0x2a,0x66,0x53,0x6a,0x8c,0xd1,0xd6,0x99,0x94,0xf2,0x3a,0xe8,0x3a,0xe8,0x2a,0x06,0x4a,0xc9,0xd6,0x99,0xb5,0xb5,0x8c,0x91,0x4b,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3a,0xe8,0x2a,0x66,0x63,0xed,0xce,0x79,0xd6,0x9a,0x95,0x13,0x32,0x87,0x3a,0xe8,0x9d,0x53,0xd6,0xba,0x94,0xf2,0x3b,0x08,0x3b,0x08,0x21,0xe5,0x6b,0xce,0xde,0xda,0xad,0x95,0x8c,0xd2,0x4b,0x4a,0x43,0x29,0x5b,0xcb,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x32,0xa7,0x2a,0x46,0x8c,0xd2,0xce,0x79,0xc6,0x58,0x53,0x4b,0x22,0x05,0x2a,0x46,0xc6,0x38,0xd6,0x99,0x63,0xec,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x8c,0xd1,0xd6,0x99,0x8c,0xb1,0x94,0xd2,0x43,0x08,0x3b,0x08,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xce,0x99,0x95,0x33,0x95,0x33,0x95,0x33,0x74,0x2e,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xf7,0x9e,0xa5,0x14,0xa4,0xf3,0xef,0x5d,0xff,0xff,0xe7,0x3c,0x94,0xb2,0x73,0x6d,0x73,0x6d,0x73,0x6d,0x83,0xef,0xce,0x79,0xff,0xff,0xff,0xdf,0xbd,0xb6,0x9c,0xf3,0xde,0xfb,0xff,0xff,0xbe,0x58,0x95,0x32,0x3a,0xe7,0x22,0x05,0x4a,0xea,0x42,0x08,0x42,0x08,0x73,0xce,0x22,0x06,0x19,0xe5,0x19,0xe5,0x22,0x05,0x19,0xe5,0x22,0x05,0x19,0xe5,0x22,0x25,0x4b,0x4a,0x32,0xa7,0x1a,0x05,0x5b,0x6c,0xbe,0x17,0x95,0x13,0x9d,0x54,0x3a,0xa8,0x4a,0xea,0x52,0xaa,0x52,0x8a,0x4a,0xca,0x22,0x06,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xdf,0x7b,0xcf,0x62,0xeb,0x83,0xef,0xf7,0x9e,0xff,0xff,0xff,0xff,0xe7,0x1c,0xc6,0x17,0xbd,0xd7,0xd6,0x9a,0xf7,0xbe,0xff,0xff,0xff,0xff,0xa5,0x14,0x62,0xeb,0x6b,0x4c,0xde,0xfb,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x43,0x09,0x43,0x29,0x22,0x05,0x19,0xe5,0xa5,0x34,0x63,0x0b,0x73,0x8d,0x63,0x0b,0x5a,0xca,0x5a,0xca,0x5a,0xaa,0x5a,0xaa,0x73,0x8d,0x6b,0x4c,0x94,0x91,0x4b,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x22,0x46,0x19,0xe5,0x42,0xe9,0x4b,0x4a,0x2a,0x26,0x19,0xe5,0x84,0x70,0x63,0x0b,0x73,0x8d,0x63,0x0b,0x52,0xa9,0x52,0xa9,0x52,0x89,0x5a,0xca,0x73,0x8d,0x6b,0x2c,0x9c,0xd3,0x4b,0x4a,0xa5,0x94,0xbe,0x17,0xad,0xd5,0x74,0x6f,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3a,0xe7,0x1a,0x05,0x22,0x06,0x4b,0x4a,0x3a,0xc8,0x19,0xe5,0x32,0x67,0x6b,0xad,0x7b,0xae,0x8c,0x51,0x52,0xca,0x4a,0x89,0x4a,0x89,0x4a,0x68,0x63,0x0c,0x94,0x92,0x63,0x2c,0x9c,0xf3,0x43,0x08,0xbe,0x17,0xb5,0xf6,0xad,0xd6,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xef,0x9d,0xdf,0x1b,0xdf,0x1b,0xdf,0x1b,0x84,0x90,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x95,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x79,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0x9a,0x6b,0x4c,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x63,0x0b,0xa5,0x14,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x58,0x95,0x32,0x3b,0x08,0x32,0xa7,0x7c,0x10,0x29,0x65,0x29,0x65,0x94,0xd3,0x2a,0x47,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x2a,0x86,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x32,0x88,0x42,0xc9,0x19,0xc5,0x19,0xe5,0x2a,0x27,0x8c,0x71,0x29,0x65,0x29,0x65,0x73,0xcf,0x4b,0x0a,0x19,0xc5,0x7c,0x70,0xde,0xfb,0xff,0xff,0xef,0x7d,0xce,0x79,0xef,0x5d,0xff,0xff,0xe7,0x3c,0x94,0x71,0x6b,0x2c,0x62,0xeb,0x62,0xcb,0x63,0x0b,0x73,0x8e,0xce,0x59,0xff,0xff,0xf7,0xbe,0xd6,0x79,0xe7,0x1c,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x22,0x26,0x43,0x09,0x4b,0x4a,0x4b,0x4a,0x32,0xa7,0x32,0xc7,0xad,0x75,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x94,0x92,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x4b,0x4a,0x7c,0x6f,0x7c,0xb0,0x6b,0xed,0x32,0xa7,0x9d,0x13,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x9c,0xf3,0x53,0x6b,0xde,0xfb,0xa5,0xb5,0x9d,0x53,0x8c,0xf1,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3a,0xe8,0x63,0xed,0x7c,0x8f,0x74,0x4f,0x43,0x08,0x4b,0x0a,0x8c,0x71,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x5a,0xca,0x9c,0xf3,0x53,0x8b,0xef,0x7d,0x84,0xb0,0x9d,0x74,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x4b,0x6a,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0x53,0x6a,0x8d,0x12,0x64,0x0d,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x63,0x0c,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xc6,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x58,0x95,0x32,0x3a,0xe8,0x22,0x26,0x73,0xae,0x29,0x65,0x29,0x65,0x52,0xea,0x22,0x05,0x3a,0xa8,0x74,0x0f,0x6b,0xee,0x3a,0xa9,0x19,0xe5,0x3a,0xe8,0x3a,0xe7,0x32,0x87,0x2a,0x86,0x19,0xe5,0x22,0x26,0x4a,0xea,0x42,0xea,0x19,0xe5,0x22,0x06,0x7c,0x30,0x29,0x65,0x29,0x65,0x73,0x8e,0x42,0xc9,0x22,0x05,0x84,0xd1,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x1c,0x73,0x8d,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xc6,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xa5,0xb5,0xde,0xfb,0xbe,0x57,0x64,0x0d,0x3b,0x08,0xad,0x75,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x94,0x92,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x53,0xab,0xb5,0xd6,0xc6,0x58,0xbe,0x17,0x4b,0x6a,0xa5,0x34,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x9c,0xf3,0x53,0x8a,0xb5,0xd6,0x7c,0xb0,0x7c,0x6f,0x53,0x8b,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xd6,0xfa,0xb5,0xf6,0x63,0xec,0x53,0x6a,0x8c,0x71,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x5a,0xca,0x9d,0x13,0x4b,0x6a,0xad,0xb5,0x95,0x12,0x84,0xd1,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xde,0xfb,0xb5,0xf6,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x63,0xec,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xe7,0x3c,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0xb6,0x17,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xf6,0x8c,0xd1,0xad,0xb5,0xa5,0x94,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9c,0xd3,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x6b,0x4d,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x58,0x95,0x32,0x32,0xc7,0x19,0xe5,0xa5,0x54,0xd6,0x99,0xd6,0x99,0x84,0x70,0x19,0xc5,0xa5,0x34,0xef,0x5d,0xef,0x5d,0xad,0xb5,0x32,0xa7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x84,0x71,0xe7,0x3c,0xe7,0x3c,0xb5,0xd6,0x22,0x46,0x4b,0x0a,0x8c,0x71,0x8c,0x71,0x53,0x2b,0x22,0x05,0x3a,0xc7,0x84,0xd1,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x8c,0x51,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x63,0x0c,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x53,0x8b,0x9d,0x73,0xb5,0xd6,0xbe,0x57,0x3a,0xa8,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xbe,0x17,0xc6,0x78,0xbe,0x17,0x5b,0xcc,0x3b,0x08,0xad,0x75,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x94,0xb2,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x43,0x49,0x9d,0x74,0xad,0xd6,0xa5,0x94,0x43,0x29,0xa5,0x34,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x9d,0x13,0x53,0x8a,0xce,0x99,0x9d,0x53,0x74,0x4e,0x95,0x12,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x43,0x28,0xb5,0xd6,0xa5,0x95,0xce,0x99,0x53,0xab,0x53,0x8a,0x8c,0x71,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x5a,0xca,0xa5,0x33,0x4b,0x6a,0xbe,0x17,0x63,0xec,0x9d,0x74,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xce,0xb9,0x84,0xb0,0x95,0x32,0xd6,0xda,0xff,0xdf,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xce,0x99,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xd6,0xfb,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x6f,0x8d,0x12,0x9d,0x53,0x84,0xd0,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xad,0xd6,0x6c,0x0d,0x8c,0xd1,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x73,0x6d,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x5a,0xcb,0xd6,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x58,0x95,0x32,0x32,0xa7,0x19,0xe5,0xad,0x75,0xef,0x5d,0xef,0x5d,0x94,0xf2,0x19,0xc5,0x9d,0x13,0xf7,0xbe,0xf7,0xbe,0xb5,0xd6,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x94,0xf2,0xf7,0xbe,0xf7,0xbe,0xc6,0x58,0x3a,0xe8,0x95,0x12,0xef,0x7d,0xef,0x7d,0xc6,0x58,0x3b,0x08,0x3a,0xc7,0x7c,0x70,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0x9a,0x63,0x0b,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xad,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x4b,0x49,0xb5,0xf6,0xad,0xd5,0x84,0xd1,0x53,0x4b,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x8c,0xd1,0x84,0xb0,0xa5,0x94,0x4b,0x49,0x3b,0x08,0x84,0xb0,0x42,0xa8,0x42,0x88,0x3a,0x27,0x5a,0xeb,0xa5,0x14,0x84,0x30,0x3a,0x27,0x42,0x88,0x4a,0xa8,0x73,0xee,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0x7c,0x6f,0x7c,0x6f,0x74,0x4e,0x43,0x08,0x84,0x90,0x4a,0x89,0x4a,0x89,0x42,0x48,0x6b,0x4c,0x94,0xb2,0x6b,0x8d,0x42,0x48,0x4a,0x88,0x4a,0x89,0x7c,0x4f,0x4b,0x6a,0xa5,0x94,0x8c,0xf1,0xb6,0x17,0x74,0x6f,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x43,0x28,0x84,0xd0,0x5b,0xec,0x8c,0xf1,0x43,0x28,0x53,0x6a,0x84,0x30,0x52,0x89,0x52,0x89,0x4a,0x69,0x6b,0x4c,0x7b,0xae,0x5a,0xaa,0x4a,0x69,0x52,0x89,0x4a,0x89,0x94,0xd2,0x43,0x28,0xb6,0x16,0xbe,0x17,0xce,0x99,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0xa5,0x94,0x84,0xd0,0xd6,0xba,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0x84,0xd0,0x9d,0x53,0x8c,0xf1,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4f,0xbe,0x37,0xbe,0x37,0x7c,0x8f,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x63,0x0c,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xc6,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x58,0x95,0x32,0x32,0xc7,0x19,0xe5,0x6c,0x0e,0xb5,0xf7,0xb5,0xf7,0x6b,0xce,0x19,0xe5,0x53,0x0a,0xc5,0x53,0xc5,0x53,0x7c,0x0e,0x22,0x06,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x73,0xee,0xcd,0xd5,0xd5,0xd5,0x9c,0xf2,0x22,0x05,0x5b,0x8c,0xd6,0xba,0xd6,0xda,0x7c,0x70,0x22,0x46,0x22,0x05,0x74,0x4f,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0x96,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x73,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x43,0x28,0x63,0xec,0x84,0xb0,0x95,0x12,0x22,0x05,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xbe,0x37,0xa5,0x74,0xce,0x79,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x5b,0x8c,0xde,0xfb,0xb5,0xb5,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xc6,0x58,0xad,0xd5,0xa5,0x74,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x84,0x70,0xde,0xda,0x84,0xb1,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x43,0x29,0xde,0xfb,0xad,0xd6,0xbe,0x17,0x53,0x8a,0x3b,0x08,0x43,0x29,0x3b,0x08,0x32,0xa7,0x21,0xe5,0xad,0xb6,0xde,0xfb,0x6b,0xce,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0x43,0x29,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xef,0x5d,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0xef,0x5d,0xad,0xd6,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x63,0x0b,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xc6,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x8c,0xf2,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x22,0x46,0x19,0xe5,0x19,0xc5,0x8c,0x4f,0xbc,0xd0,0xbc,0xb0,0xa4,0xf2,0x3a,0xa8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x7c,0x0e,0xb4,0x90,0xbc,0xb0,0x94,0x70,0x2a,0x47,0x19,0xe5,0x43,0x09,0x53,0x6a,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x14,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x73,0x8d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x53,0x6a,0xc6,0x78,0xef,0x7d,0x84,0xb0,0x22,0x06,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xa5,0x74,0xa5,0x74,0x5b,0xcc,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x5b,0x8c,0xf7,0x9e,0xb5,0xd7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0x6c,0x0d,0x43,0x28,0x5b,0xab,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x84,0x91,0xf7,0xbe,0x8c,0xf2,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x43,0x08,0x74,0x6f,0x53,0xab,0x5b,0xcc,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0xbe,0x17,0xf7,0xbe,0x6b,0xee,0x19,0xe5,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xc6,0x58,0x8d,0x12,0xf7,0xbe,0xe7,0x1c,0x95,0x53,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0x8c,0xf1,0xa5,0xb5,0x84,0xd1,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xcf,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf7,0x7c,0x70,0x19,0xe5,0x19,0xe5,0x22,0x06,0x63,0xed,0x63,0xcd,0x32,0x67,0x19,0xe5,0x7b,0xee,0xbc,0xd0,0xbc,0xb0,0x73,0xcd,0x2a,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x8c,0x50,0xb4,0x90,0xbc,0xb0,0x8c,0x2f,0x2a,0x47,0x19,0xe5,0x43,0x09,0x53,0x6a,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0x96,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x7b,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x4b,0x4a,0xad,0xd5,0xde,0xfb,0x9d,0x53,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x19,0xe5,0x53,0x4b,0xd6,0xba,0x84,0x71,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xce,0x99,0x53,0x8b,0xad,0xb5,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x6b,0xee,0xe7,0x1c,0x84,0x91,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x43,0x28,0xb5,0xf6,0x8c,0xf1,0xce,0xb9,0x5b,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0xb5,0xd7,0xe7,0x3c,0x63,0xcd,0x19,0xe5,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xbe,0x17,0x95,0x33,0xad,0xd5,0xff,0xdf,0x7c,0x8f,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xd5,0x7c,0x90,0x5b,0xcc,0x9d,0x53,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0xf7,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x84,0x30,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x8c,0xd1,0x2a,0x87,0x32,0x87,0xa5,0x54,0xe7,0x3c,0xe7,0x3c,0x95,0x13,0x22,0x46,0x84,0x70,0xe6,0x99,0xde,0x99,0x94,0xf2,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x46,0x7c,0x0f,0xd5,0xf6,0xd5,0xf6,0x9c,0xd2,0x19,0xe5,0x74,0x0f,0xde,0xdb,0xde,0xfb,0x94,0xf2,0x19,0xe5,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,0x6b,0x0c,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xa5,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x43,0x49,0x63,0xec,0x63,0xed,0x74,0x6f,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x46,0x1a,0x05,0x19,0xe5,0x32,0x87,0x42,0xe8,0x22,0x05,0x19,0xe5,0x1a,0x05,0x22,0x26,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x7c,0x6f,0x8d,0x12,0xbe,0x17,0xad,0xd6,0x43,0x49,0x3b,0x08,0x2a,0x87,0x22,0x26,0x19,0xe5,0x2a,0x46,0x4b,0x6a,0x2a,0x67,0x19,0xe5,0x22,0x26,0x2a,0x46,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x43,0x28,0xce,0x99,0xc6,0x58,0x8c,0xf1,0x53,0x8b,0x3b,0x08,0x32,0xa7,0x2a,0x66,0x22,0x26,0x19,0xe5,0x42,0xe9,0x5b,0xac,0x22,0x06,0x19,0xe5,0x2a,0x46,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xbe,0x17,0xde,0xfb,0x9d,0x53,0x8d,0x12,0x7c,0x6f,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xd6,0xa5,0x74,0xb5,0xf6,0xad,0xb5,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x94,0x71,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x73,0x8e,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x57,0x8d,0x12,0x3a,0xc7,0x3a,0xe7,0xad,0xd5,0xf7,0xbe,0xf7,0xbe,0xad,0xb5,0x3b,0x08,0xa5,0x95,0xf7,0x9e,0xf7,0x9e,0xa5,0x74,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x53,0xf7,0xbe,0xf7,0xbe,0xbe,0x17,0x19,0xe5,0x84,0x91,0xef,0x7d,0xef,0x7d,0xbe,0x17,0x19,0xe5,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0x50,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x73,0x6d,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x5b,0xcc,0xd6,0xba,0xbe,0x37,0xdf,0x1b,0x42,0xea,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x53,0x8b,0x4b,0x49,0x43,0x29,0x5b,0x8b,0x4b,0x6a,0x22,0x26,0x19,0xe5,0x42,0xc9,0x4b,0x0a,0x53,0x8b,0x84,0x90,0x4b,0x2b,0x32,0x47,0x4b,0x0a,0x32,0x67,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x43,0x08,0x43,0x28,0x43,0x29,0x43,0x28,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x22,0x06,0x4b,0x4a,0x8c,0xf1,0x74,0x0e,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x43,0x29,0x43,0x49,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x6b,0xed,0x74,0x6f,0x2a,0x47,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xff,0xef,0x5d,0xf7,0xbe,0xff,0xff,0xdf,0x1b,0xef,0x9d,0xff,0xff,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0x84,0xb0,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4f,0x8d,0x12,0x4b,0x6a,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x63,0xec,0x43,0x49,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xff,0xff,0xef,0x7d,0xf7,0x9e,0xff,0xff,0xf7,0xbe,0xa5,0x13,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x63,0x0b,0x7b,0xae,0xe7,0x1c,0xff,0xff,0xf7,0xbe,0xef,0x7d,0xff,0xdf,0xff,0xff,0xb5,0xf7,0x7c,0x70,0x19,0xc5,0x19,0xe5,0x4a,0xea,0x63,0x2c,0x63,0x2c,0x5b,0x4c,0x19,0xe5,0x74,0x2f,0xd6,0xba,0xd6,0xba,0x84,0x91,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x66,0x74,0x4f,0xdf,0x1c,0xe7,0x1c,0x8c,0xd2,0x19,0xe5,0x42,0xa9,0x84,0x10,0x84,0x10,0x53,0x0b,0x19,0xe5,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x83,0xef,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x73,0x6d,0xce,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x4b,0x6a,0x84,0xb0,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xc6,0x58,0xbe,0x37,0x84,0xd0,0xbe,0x37,0xad,0xd6,0x19,0xe5,0x5b,0x8c,0xe7,0x3c,0xef,0x5d,0x4a,0x6a,0x29,0x65,0x29,0x66,0xb5,0x95,0xef,0x5d,0xb5,0xd6,0x22,0x05,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x19,0xe5,0x4b,0x0b,0xe7,0x3c,0xef,0x5c,0x53,0x0b,0x42,0x48,0x42,0x49,0x94,0xd2,0xe7,0x3c,0xbd,0xf7,0x22,0x06,0x42,0xe9,0xce,0x79,0xc6,0x78,0x6c,0x0d,0xad,0xf6,0x3b,0x08,0x95,0x32,0x42,0xc9,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x22,0x06,0xd6,0xba,0xe7,0x1c,0x94,0xb2,0x5b,0x0b,0x63,0x2c,0x6b,0x6d,0xef,0x5d,0xde,0xdb,0x42,0xc9,0x22,0x26,0xbe,0x17,0xc6,0x79,0x74,0x4e,0x95,0x32,0x53,0x8a,0x94,0xf2,0xce,0x99,0xa5,0x74,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xce,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xf7,0xbe,0xff,0xff,0xff,0xff,0xc6,0x58,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x9d,0x74,0xa5,0x95,0x84,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xde,0xdb,0x6b,0x4c,0x6b,0x4c,0xd6,0x9a,0xff,0xff,0xff,0xff,0xde,0xdb,0xb5,0x75,0xa5,0x34,0xad,0x55,0xd6,0x9a,0xff,0xdf,0xff,0xff,0xef,0x7d,0x83,0xef,0x62,0xeb,0xad,0x55,0xff,0xff,0xbe,0x37,0x84,0xd1,0x2a,0x66,0x2a,0x67,0x7c,0x10,0x29,0x65,0x29,0x66,0x8c,0x92,0x2a,0x47,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x2a,0x26,0x53,0x8b,0x5b,0xac,0x19,0xe5,0x2a,0x27,0x84,0x51,0x29,0x65,0x29,0x65,0x73,0xcf,0x4b,0x0a,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xff,0xe7,0x3c,0xbd,0xd7,0xe6,0xfb,0xff,0xff,0xf7,0x9e,0xa5,0x34,0x6b,0x4c,0x63,0x0c,0x63,0x0b,0x6b,0x2c,0x8c,0x30,0xde,0xfb,0xff,0xff,0xf7,0x9e,0xc6,0x17,0xd6,0xba,0xff,0xff,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xce,0x99,0xc6,0x58,0x6c,0x0d,0x63,0xed,0xb5,0xf6,0x22,0x06,0x74,0x2f,0xe7,0x3c,0xef,0x5d,0x4a,0x6a,0x29,0x66,0x29,0x66,0xb5,0x96,0xef,0x7d,0xb5,0xf7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x19,0xe5,0x6b,0xce,0xe7,0x3c,0xef,0x7d,0x52,0xaa,0x29,0x66,0x29,0x66,0x9c,0xd3,0xef,0x7d,0xc6,0x58,0x2a,0x26,0x42,0xe9,0xc6,0x78,0xc6,0x78,0x74,0x4e,0xad,0xd5,0x3b,0x08,0xb5,0xf6,0xbe,0x17,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x22,0x06,0xde,0xfb,0xef,0x7d,0x94,0xb2,0x29,0x65,0x29,0x65,0x6b,0x4d,0xf7,0xbe,0xe7,0x1c,0x43,0x0a,0x22,0x26,0xbe,0x38,0xb5,0xf6,0x95,0x12,0xbe,0x38,0x63,0xec,0x3b,0x08,0x9d,0x74,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xb6,0x16,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xb9,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xbe,0x17,0xc6,0x78,0xad,0xb5,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xa5,0x74,0xff,0xff,0xb5,0x96,0x62,0xeb,0x62,0xeb,0x9c,0xd3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0x62,0xeb,0x62,0xeb,0x73,0x8d,0xff,0xdf,0xbe,0x58,0x95,0x12,0x3b,0x08,0x2a,0x67,0x6b,0x8d,0x29,0x65,0x29,0x66,0x84,0x50,0x2a,0x47,0x2a,0x86,0x43,0x09,0x53,0x6b,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x2a,0x46,0x32,0xc7,0x3b,0x08,0x22,0x26,0x2a,0x26,0x84,0x50,0x29,0x65,0x29,0x65,0x73,0xae,0x4b,0x0a,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xdf,0x73,0x6d,0x62,0xeb,0x7b,0xae,0xef,0x7d,0xff,0xff,0xff,0xff,0xef,0x7d,0xd6,0xba,0xd6,0x79,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xa4,0xf3,0x62,0xeb,0x6b,0x2c,0xde,0xdb,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xb5,0xf7,0x9d,0x73,0x84,0xd1,0x9d,0x53,0xb6,0x17,0x22,0x26,0x6b,0xee,0xde,0xfb,0xde,0xfb,0x4a,0x89,0x4a,0x49,0x42,0x29,0xa5,0x54,0xe7,0x1c,0xad,0xb6,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x1a,0x05,0x5b,0x6c,0xe7,0x3c,0xef,0x7d,0x5a,0xcb,0x39,0xc7,0x39,0xc7,0x9c,0xd3,0xef,0x5d,0xbd,0xf7,0x19,0xe5,0x3a,0xc8,0xad,0xd5,0xad,0xd5,0x5b,0xcb,0xad,0xf5,0x53,0xab,0x8c,0xd1,0xce,0x79,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x22,0x06,0xde,0xfb,0xef,0x7d,0x94,0xb2,0x29,0x65,0x29,0x65,0x6b,0x4d,0xf7,0xbe,0xe7,0x1c,0x4b,0x0a,0x22,0x26,0xb5,0xf6,0xbe,0x37,0x5b,0xcc,0xa5,0x94,0x74,0x6f,0x4b,0x49,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x7c,0x8f,0xe7,0x5c,0xff,0xff,0xf7,0x9e,0x9d,0x53,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xbe,0x37,0xce,0x99,0xbe,0x37,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4f,0x94,0xd2,0xff,0xff,0xde,0xfb,0x7b,0xce,0x73,0x8d,0xd6,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x8c,0x50,0x6b,0x4c,0xad,0x75,0xff,0xff,0xbe,0x58,0x7c,0x8f,0x32,0xc7,0x19,0xe5,0x73,0xce,0x94,0x91,0x94,0x92,0x63,0x8d,0x19,0xe5,0x5b,0xab,0xbe,0x17,0x8d,0x12,0xad,0xb5,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x42,0xa9,0x5b,0x0c,0x63,0x0c,0x4a,0xca,0x22,0x06,0x19,0xe5,0x74,0x4f,0xde,0xfb,0xff,0xdf,0x6b,0x0c,0x62,0xeb,0x6b,0x4c,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x94,0x71,0x62,0xeb,0x62,0xeb,0xce,0x79,0xff,0xdf,0xa5,0x54,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x53,0x8b,0x43,0x29,0x53,0x8a,0x64,0x0d,0x53,0x8a,0x2a,0x46,0x19,0xe5,0x42,0xea,0x3a,0xc9,0x32,0x68,0x84,0x70,0x6b,0xee,0x32,0x88,0x5b,0xab,0x3a,0xa8,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x2a,0x26,0x4b,0x2a,0x4b,0x2b,0x42,0xea,0x84,0x70,0x7c,0x2f,0x42,0xc9,0x64,0x0d,0x42,0xe9,0x19,0xe5,0x32,0xa7,0x53,0x8a,0x53,0xab,0x63,0xec,0x6c,0x4e,0x63,0xed,0x3a,0xc7,0x42,0xc9,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x4b,0x0a,0x5b,0x8c,0x4b,0x0a,0x84,0x71,0x94,0xf3,0x42,0xc9,0x74,0x4f,0x6b,0xee,0x32,0x67,0x2a,0x66,0x63,0xec,0x53,0x8a,0x63,0xed,0x8c,0xf1,0x7c,0xb0,0x43,0x28,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x84,0xb0,0x84,0xb0,0x84,0xb0,0x9d,0x33,0xde,0xfb,0xad,0xb5,0x84,0xb1,0x84,0xb0,0x84,0xb0,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xff,0xff,0xef,0x9d,0xde,0xfb,0xdf,0x1b,0xff,0xff,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x5b,0xcc,0x5b,0xcb,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x2a,0x26,0x7c,0x2f,0xff,0xff,0xff,0xff,0xf7,0x9d,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xef,0x5d,0xff,0xdf,0xff,0xff,0xce,0x98,0x3a,0xc7,0x22,0x05,0x19,0xe5,0xad,0x96,0xef,0x7d,0xef,0x7d,0x95,0x13,0x19,0xe5,0x5b,0xac,0x95,0x32,0x43,0x28,0xad,0xb5,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x19,0xe5,0x84,0x70,0xf7,0x9e,0xf7,0x9e,0xb5,0xd6,0x19,0xe5,0x22,0x06,0x5b,0x8c,0xde,0xfb,0xff,0xff,0xce,0x38,0x8c,0x51,0xbd,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xdb,0x94,0x71,0xad,0x55,0xf7,0xbe,0xff,0xdf,0x84,0xb1,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x42,0xea,0x94,0xf3,0x94,0xf3,0x94,0xf3,0x94,0xf3,0x95,0x13,0x9d,0x53,0x94,0xf3,0x84,0x90,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x26,0x84,0x91,0x94,0xf3,0x94,0xf3,0x94,0xf3,0x95,0x13,0x9d,0x53,0x94,0xf3,0x94,0xf3,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x87,0x22,0x46,0x19,0xe5,0x19,0xc5,0x63,0xad,0x84,0x91,0x84,0x91,0x84,0x91,0x84,0x91,0x95,0x12,0x94,0xf2,0x9d,0x33,0x63,0xcd,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0xa5,0x74,0x7b,0xae,0x7b,0xae,0x7b,0xae,0x7b,0xae,0x7b,0xae,0x7b,0xae,0x7b,0xae,0x84,0x70,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xf7,0x9e,0x9d,0x53,0xbe,0x17,0xa5,0x94,0xbe,0x37,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xe5,0xbe,0x32,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xef,0x9d,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xff,0xdd,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xd9,0x43,0x08,0x19,0xc5,0x19,0xe5,0x8c,0xd2,0xe7,0x1c,0xe7,0x3c,0x8c,0xd2,0x19,0xc5,0x63,0xed,0x95,0x32,0x43,0x28,0x7c,0x90,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x19,0xe5,0x6b,0xee,0xe7,0x3c,0xe7,0x3c,0x9d,0x54,0x19,0xe5,0x19,0xe5,0x32,0x66,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x6e,0x22,0x26,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x84,0xb0,0x95,0x33,0x4b,0x49,0x84,0xb0,0x53,0x8b,0x19,0xe5,0x63,0x8d,0xa5,0x54,0xb5,0xb5,0x84,0xb1,0x84,0x91,0x8c,0xd2,0xad,0x75,0xb5,0xb5,0x42,0xc9,0x84,0x91,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x25,0x2a,0x47,0x6c,0x0e,0x94,0xf2,0x74,0x2f,0x74,0x0f,0x74,0x0f,0x8c,0xd2,0x95,0x32,0x6c,0x0e,0x94,0xf3,0x8c,0xd1,0xbe,0x17,0x74,0x4e,0xa5,0x94,0xb5,0xf6,0x53,0xab,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0xb5,0xd6,0xce,0x99,0xbe,0x37,0xad,0xb6,0xad,0xb6,0xb5,0xd6,0xd6,0xd9,0xc6,0x58,0x74,0x2f,0x74,0x0e,0xbe,0x37,0xad,0xb5,0x7c,0x6f,0xbe,0x37,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0xa4,0xf3,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x43,0x08,0x3b,0x08,0x7c,0x8f,0xe7,0x5c,0xb5,0xf6,0xbe,0x17,0xde,0xfb,0xad,0xd5,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x5b,0xab,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x3a,0x67,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xc5,0xff,0xf6,0xf7,0xba,0xd6,0x99,0xce,0x58,0xe7,0x1b,0xff,0xf7,0x8c,0xcd,0x22,0x26,0x3b,0x08,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x2a,0x46,0x5b,0x8a,0xff,0xf6,0xf7,0x9a,0xce,0x58,0xce,0x58,0xef,0x7b,0xff,0xf6,0x7c,0x6c,0x19,0xc5,0x19,0xc5,0x32,0xa7,0x3a,0xe8,0x22,0x26,0x22,0x05,0x22,0x05,0x7c,0x6f,0xd6,0xda,0x8c,0xf1,0xb5,0xf6,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x25,0x19,0xe5,0x63,0xac,0x6c,0x2e,0x1a,0x05,0x19,0xe5,0x19,0xc5,0x63,0xca,0xff,0xf8,0xff,0xde,0xff,0xff,0xff,0xff,0xff,0xfc,0xdf,0x18,0x95,0x13,0x9d,0x53,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0x9d,0x74,0x95,0x13,0xd6,0xb7,0xff,0xdb,0xff,0xde,0xff,0xff,0xff,0xff,0xff,0xfa,0xad,0xb0,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xad,0xb5,0x7c,0x8f,0x95,0x12,0xc6,0x78,0x53,0x8b,0x19,0xe5,0x8c,0xd2,0xef,0x5c,0xf7,0x79,0xf7,0x9e,0xff,0xff,0xff,0xff,0xe7,0x38,0xef,0x5c,0xa5,0x54,0x7c,0x70,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x19,0xe5,0x5b,0x8c,0xe7,0x3c,0xf7,0x7a,0xef,0x7c,0xff,0xdf,0xff,0xdf,0xef,0x3a,0xef,0x7b,0xc6,0x58,0x9d,0x13,0x8c,0xf2,0x6c,0x0d,0xc6,0x58,0x4b,0x49,0xa5,0x74,0x5b,0xec,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x2a,0x67,0x3a,0xc8,0x3a,0xe8,0x43,0x08,0xdf,0x1b,0xef,0x7b,0xef,0x3a,0xff,0xff,0xff,0xff,0xef,0x3b,0xf7,0xba,0xe7,0x1c,0x84,0x91,0x6b,0xcd,0xad,0xd6,0x95,0x53,0x63,0xec,0xb5,0xf6,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x2a,0x9c,0xf3,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0xaf,0xe7,0x5c,0x43,0x28,0x7c,0x8f,0xf7,0xde,0xad,0xd5,0xad,0xf6,0xd6,0xda,0xef,0x7d,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x3a,0x47,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0xff,0xf6,0xf7,0xb9,0xad,0x75,0x9c,0xd2,0xde,0xda,0xff,0xf6,0x84,0xad,0x22,0x26,0x7c,0x90,0x8c,0xf1,0x8c,0xf1,0x8c,0xf1,0x8c,0xd1,0x42,0xc9,0x4b,0x49,0xff,0xd6,0xf7,0x9a,0x9c,0xf3,0x9c,0xd2,0xde,0xf9,0xff,0xf6,0x74,0x4c,0x19,0xc5,0x19,0xe5,0x3a,0xc8,0x43,0x29,0x2a,0x47,0x2a,0x67,0x3a,0xe8,0x53,0x8b,0x74,0x4e,0x8d,0x11,0x8c,0xf1,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x3a,0xc8,0x43,0x08,0x22,0x26,0x19,0xe5,0x19,0xc5,0xce,0x92,0xff,0xf6,0xd6,0x99,0xa5,0x13,0xb5,0x95,0xf7,0x99,0xff,0xf6,0x3a,0xa7,0x2a,0x46,0x43,0x28,0x43,0x28,0x43,0x28,0x43,0x28,0x32,0xa7,0x19,0xe5,0x9d,0x6f,0xff,0xf8,0xce,0x79,0xa5,0x13,0xbd,0xd6,0xff,0xfa,0xe7,0x34,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0xad,0xb5,0x74,0x4e,0x8c,0xf1,0x84,0xb0,0x5b,0xac,0x19,0xe5,0x8c,0xd2,0xef,0x5c,0xf7,0x79,0xf7,0x9e,0xff,0xff,0xff,0xff,0xe7,0x38,0xef,0x5c,0x9d,0x54,0x7c,0x70,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x6b,0xee,0xe7,0x3c,0xf7,0x79,0xf7,0x7c,0xff,0xff,0xff,0xff,0xef,0x5a,0xef,0x7b,0xc6,0x58,0x9d,0x13,0x8c,0xf2,0x8c,0xd1,0xb5,0xf6,0x9d,0x74,0x95,0x32,0x43,0x28,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xc5,0x6c,0x2d,0xef,0x7c,0x43,0x29,0x32,0x87,0xdf,0x1b,0xef,0x7b,0xe7,0x3a,0xff,0xdf,0xff,0xdf,0xe7,0x3b,0xf7,0xba,0xe7,0x1c,0x84,0x91,0x6b,0xcd,0xbe,0x17,0xb5,0xf6,0x63,0xec,0x63,0xec,0xa5,0xb5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x3a,0x88,0x9c,0xf3,0x62,0xeb,0x62,0xeb,0x8b,0xcc,0xbd,0x50,0x9c,0x6d,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0x3b,0x08,0x7c,0x8f,0xf7,0x9e,0x9d,0x74,0x8c,0xf1,0x63,0xec,0xb6,0x16,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0xa6,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x24,0x39,0xc7,0x32,0x07,0x3b,0x08,0x4b,0x49,0x9d,0x53,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb5,0xa5,0xb4,0x7c,0xb0,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0xbe,0x11,0xff,0xf7,0xff,0xdc,0xff,0xfd,0xf7,0x98,0xff,0xf6,0x42,0xe8,0x22,0x06,0x5b,0xab,0x5b,0xcc,0x5b,0xcc,0x5b,0xcc,0x5b,0xac,0x32,0x87,0x19,0xe5,0xc6,0x71,0xff,0xf7,0xff,0xdc,0xff,0xdd,0xff,0xf8,0xf7,0xb5,0x42,0xe8,0x19,0xe5,0x19,0xe5,0x7c,0x4f,0xd6,0xba,0xc6,0x38,0x95,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x32,0x68,0xa5,0x75,0xce,0x99,0xbd,0xf7,0x4b,0x2b,0x19,0xe5,0x8c,0xed,0xff,0xf6,0xde,0xfa,0xc6,0x17,0xce,0x58,0xff,0xf8,0xd6,0xb2,0x22,0x26,0x63,0xcd,0x9d,0x74,0x9d,0x74,0x9d,0x74,0x9d,0x74,0x84,0xb1,0x19,0xe5,0x9d,0x6f,0xff,0xf7,0xde,0xda,0xc6,0x17,0xd6,0x99,0xff,0xd7,0xd6,0xd2,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x95,0x12,0xb5,0xd6,0x5b,0xab,0xad,0xb5,0xad,0x95,0x22,0x06,0x5b,0x8c,0xb5,0xb5,0xb5,0xf6,0x84,0x91,0x7c,0x4f,0x7c,0x50,0x9d,0x13,0xad,0x95,0x3a,0xa9,0x84,0x91,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x2a,0x46,0x4b,0x6a,0xc6,0x38,0xc6,0x58,0xad,0x95,0xa5,0x75,0xa5,0x75,0xb5,0xf6,0xc6,0x37,0x74,0x2f,0x8c,0xb2,0x6c,0x0e,0x84,0xf1,0x5b,0xab,0x84,0xd0,0x8d,0x11,0x53,0x8a,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe8,0x74,0x4e,0x2a,0x67,0x19,0xe5,0x63,0xad,0x8c,0xb1,0x7c,0x50,0x74,0x0f,0x74,0x0f,0x74,0x2f,0x84,0xb1,0x7c,0x70,0x74,0x2f,0x6b,0xed,0x95,0x32,0x7c,0x8f,0x63,0xec,0x95,0x33,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x3a,0x88,0x9c,0xf3,0x62,0xeb,0x62,0xeb,0x94,0x4d,0xf7,0x57,0xb5,0x0f,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xff,0xdf,0xbe,0x58,0xa5,0x94,0xce,0x79,0xff,0xdf,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x52,0x42,0xad,0x03,0xad,0x03,0xa4,0xc3,0x21,0x22,0x39,0xc7,0x32,0x07,0x3b,0x08,0x95,0x33,0xff,0xdf,0xff,0xdf,0xd6,0xda,0xc6,0x78,0xe7,0x5c,0xef,0x7d,0xe7,0x5c,0xef,0x9d,0xd6,0xba,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x42,0xe8,0xce,0xb2,0xff,0xf6,0xff,0xf6,0xef,0x74,0x95,0x2e,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x2a,0x86,0x53,0x89,0xde,0xf3,0xff,0xf6,0xff,0xf6,0xf7,0xb5,0x95,0x0e,0x32,0xc7,0x22,0x05,0x19,0xe5,0x7c,0x4f,0xbe,0x37,0xb5,0xf7,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x47,0x9d,0x33,0xce,0x79,0xa5,0x75,0x4b,0x2a,0x19,0xe5,0x32,0x66,0xe7,0x54,0xff,0xf7,0xf7,0xb9,0xff,0xf8,0xff,0xf6,0x9d,0x2e,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x5b,0xaa,0xf7,0xb5,0xff,0xf8,0xef,0x59,0xff,0xd8,0xff,0xf6,0x74,0x4b,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x19,0xe5,0x53,0x6a,0x95,0x33,0x8c,0xd2,0x8c,0xd2,0x94,0xd2,0x8c,0xd2,0x8c,0xd2,0x94,0xd2,0x8d,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe8,0x3a,0xe8,0x32,0x67,0x84,0xb1,0x84,0xb1,0x8c,0xd1,0x8c,0xb1,0x84,0xb1,0x84,0xb1,0x84,0xb1,0x9d,0x34,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x05,0x22,0x05,0x74,0x0f,0x94,0xf2,0x95,0x13,0x9d,0x13,0x94,0xf2,0x94,0xf2,0x94,0xf2,0x95,0x13,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x4b,0x4a,0xa4,0xf3,0x62,0xeb,0x62,0xeb,0x7b,0x6c,0x9c,0x6d,0x8b,0xcc,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xf7,0x9e,0x95,0x12,0xa5,0x74,0xa5,0x74,0xd6,0xba,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x3a,0x47,0x63,0xec,0xef,0x7d,0xff,0xff,0xb5,0xf6,0xbe,0x58,0x84,0xf1,0xb5,0xf6,0x8c,0xf1,0xb5,0xf6,0xb5,0xf6,0xa5,0x95,0xad,0xd5,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x53,0x69,0x53,0x69,0x3a,0xc7,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x32,0xa7,0x53,0x69,0x53,0x69,0x4b,0x28,0x32,0xa7,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x3a,0xe8,0x3a,0xe8,0x5b,0x8c,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x3a,0xa8,0x95,0x12,0x53,0x6a,0x74,0x2f,0x3a,0xc8,0x32,0x87,0x19,0xe5,0x4b,0x08,0xbe,0x11,0xff,0xf6,0xd6,0xf3,0x9d,0x6f,0x22,0x26,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x3b,0x08,0x84,0xcd,0xd6,0xb2,0xff,0xf6,0xe7,0x34,0xa5,0x6f,0x43,0x28,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x3a,0xe8,0x32,0xc7,0x19,0xe5,0x32,0x67,0x43,0x09,0x6c,0x2e,0x5b,0xac,0x42,0xe9,0x42,0xe9,0x43,0x09,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x2a,0x66,0x2a,0x46,0x2a,0x87,0x3a,0xe8,0x3a,0xe8,0x3a,0xe7,0x3a,0xe8,0x53,0x8a,0x4b,0x49,0x3a,0xe8,0x3a,0xe7,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x32,0xa7,0x2a,0x87,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x53,0x6a,0xa4,0xf3,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xef,0x9d,0x95,0x32,0x9d,0x53,0x95,0x53,0xb6,0x17,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x5b,0xcc,0x4a,0x69,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x3a,0x67,0xa5,0xb4,0xff,0xff,0xff,0xff,0x9d,0x53,0xf7,0xbe,0x9d,0x73,0xb5,0xf6,0x9d,0x53,0x8d,0x11,0xbe,0x17,0x95,0x53,0xd6,0xba,0xb6,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x32,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x22,0x46,0x1a,0x05,0x19,0xe5,0x22,0x25,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x22,0x26,0x22,0x05,0x19,0xe5,0x22,0x26,0x32,0x87,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x84,0xb1,0x9d,0x74,0x6c,0x0e,0x9d,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x42,0xea,0xd6,0xba,0x74,0x4f,0x84,0xb1,0x63,0xed,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x42,0xe8,0x2a,0x46,0x19,0xe5,0x22,0x26,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x25,0x22,0x26,0x42,0xe8,0x32,0x87,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x5b,0xcc,0xa5,0x75,0x4b,0x2b,0x22,0x25,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x26,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3a,0xe7,0x2a,0x87,0x19,0xc5,0x3a,0xc7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x22,0x46,0xa5,0x93,0x5b,0xcc,0x1a,0x05,0x2a,0x46,0x9d,0x53,0xef,0x9e,0xe7,0x3c,0x7c,0x90,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x8c,0xf1,0xe7,0x3c,0xd6,0xba,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x19,0xe5,0x22,0x05,0x32,0xc7,0x3b,0x08,0x53,0x6a,0x9c,0xf3,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xe7,0x5c,0xb5,0xf6,0xf7,0xbe,0xe7,0x3c,0xad,0xd5,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x39,0xe7,0x31,0x86,0x6b,0x02,0xde,0x43,0xde,0x43,0xd5,0xe3,0x29,0x42,0x39,0xc7,0x32,0x07,0x5b,0xcc,0xf7,0x9e,0xff,0xff,0xb6,0x17,0xa5,0xb5,0x8c,0xf1,0xb5,0xf6,0xce,0x99,0x7c,0x90,0xc6,0x58,0xb5,0xf6,0xa5,0x94,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x7c,0xb0,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x53,0x8b,0x94,0xf3,0x8c,0xf2,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x32,0x88,0x8c,0xd1,0x9d,0x53,0xbd,0xf7,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x46,0x22,0x46,0x2a,0x46,0x32,0x87,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x66,0x22,0x46,0x2a,0x46,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x84,0x91,0xef,0x5d,0xff,0xff,0xf7,0x9e,0x94,0xf2,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x46,0x2a,0x46,0x19,0xe5,0x22,0x05,0x22,0x05,0x19,0xe5,0x3a,0xe7,0x2a,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x1a,0x05,0x22,0x46,0x9d,0x53,0x7c,0x8f,0x53,0x4b,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xb5,0xf6,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xc6,0x58,0xff,0xdf,0xff,0xff,0xff,0xff,0xf7,0xbe,0x95,0x32,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x9d,0x34,0xbe,0x18,0xc6,0x38,0x5b,0xab,0x32,0xa7,0x43,0x29,0xb5,0xb6,0x73,0x6d,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x6b,0x2c,0xad,0x54,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xff,0xdf,0xa5,0x95,0x9d,0x53,0x95,0x32,0xe7,0x5c,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xc7,0x39,0xe7,0x31,0xa6,0x21,0x03,0x21,0x23,0x21,0x23,0x21,0x23,0x21,0x04,0x39,0xc7,0x32,0x07,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xff,0xe7,0x5c,0xde,0xfb,0xef,0x7d,0xf7,0xbe,0xe7,0x5d,0xf7,0x9e,0xde,0xfb,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xc6,0x58,0xff,0xff,0xef,0x7d,0x84,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x2a,0x87,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x05,0x2a,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x84,0xd1,0xd6,0xda,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xba,0x5b,0xcb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x72,0xbe,0x36,0x22,0x46,0x19,0xc5,0x19,0xe5,0x32,0x87,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x22,0x26,0x95,0x13,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xb9,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0x8c,0xf1,0x53,0x6b,0x19,0xe5,0xd6,0x9a,0xef,0x7d,0xef,0x7d,0x74,0x2f,0x2a,0x87,0x3a,0xc7,0x4a,0xa9,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x5b,0x0b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x6f,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xc6,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe8,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x32,0x27,0x3b,0x08,0x43,0x49,0x8c,0xf1,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x52,0x95,0x32,0x7c,0x8f,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x8c,0xf1,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x2a,0x87,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3a,0xe7,0x19,0xe5,0x2a,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xdf,0xad,0xb5,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x8c,0xd1,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x95,0x32,0x3a,0xe8,0x32,0xa7,0x74,0x4e,0x5b,0xec,0x22,0x05,0x19,0xe5,0x32,0x87,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x32,0x87,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xa5,0x74,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x8d,0x12,0x43,0x08,0x4b,0x49,0xc6,0x58,0x74,0x6f,0xbe,0x38,0x42,0xc9,0xce,0x58,0xef,0x1b,0xef,0x1b,0x63,0xad,0x2a,0x87,0x3a,0xc7,0x4a,0x89,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x5a,0xca,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0xb5,0xd6,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xde,0xdb,0x6c,0x0d,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x64,0x0d,0x4a,0x89,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0xad,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x7c,0xb0,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0x53,0x8a,0x5b,0xab,0x22,0x05,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3a,0xe7,0x19,0xe5,0x2a,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x84,0xd0,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1b,0x6c,0x2d,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x4e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x50,0x19,0xc5,0x19,0xe5,0x22,0x05,0x19,0xe5,0x32,0x87,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x43,0x49,0x9d,0x53,0x3b,0x08,0x95,0x33,0x4b,0x0a,0x94,0x2f,0xbc,0xb0,0xac,0x6f,0x42,0x88,0x2a,0x87,0x3a,0xc7,0x4a,0x89,0x62,0xeb,0x62,0xeb,0x73,0x4b,0x7b,0x8c,0x73,0x4b,0x62,0xeb,0x62,0xeb,0x5a,0xca,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x29,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x4a,0xe9,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x8c,0x71,0x53,0x6a,0x3b,0x08,0x4b,0x6a,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xcc,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x9d,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x1a,0x05,0x19,0xe5,0x9d,0x73,0xc6,0x78,0x22,0x26,0x19,0xe5,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x32,0x87,0x3a,0xe7,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0xbe,0x37,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xa5,0x94,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x12,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x32,0x87,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xef,0x7d,0xdf,0x3c,0xdf,0x3c,0xdf,0x3c,0xdf,0x3c,0xdf,0x3c,0xdf,0x3c,0xf7,0xbe,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xf7,0xbe,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xf7,0xde,0xff,0xff,0xce,0x99,0x43,0x28,0x53,0x6a,0x9d,0x53,0x4b,0x49,0x8c,0xd1,0x63,0xcd,0xb5,0x33,0xbc,0xb0,0xb4,0x90,0x94,0xb2,0x2a,0x87,0x3a,0xc7,0x4a,0x89,0x62,0xeb,0x62,0xeb,0x94,0x2d,0xee,0xf5,0xb5,0x0f,0x62,0xeb,0x62,0xeb,0x63,0x0b,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x8c,0xb1,0x43,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x29,0x42,0x4a,0x23,0x4a,0x23,0x4a,0x23,0x20,0xe3,0x39,0xc7,0x8c,0x71,0x53,0x6a,0x5b,0xab,0xd6,0xda,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xde,0xfb,0x95,0x32,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x3a,0xe8,0x4b,0x29,0x19,0xe5,0x22,0x25,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x74,0x2d,0x9d,0x52,0x22,0x46,0x19,0xe5,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x6c,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xad,0xb5,0xa5,0x74,0xa5,0x74,0xa5,0x74,0xa5,0x74,0xa5,0x74,0xa5,0x94,0xef,0x9d,0xff,0xff,0x95,0x12,0x22,0x25,0x19,0xe5,0x32,0x87,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x84,0xd1,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0xbe,0x37,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x95,0x32,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0xbe,0x37,0xff,0xff,0xce,0x99,0x43,0x28,0x53,0x8b,0xb6,0x16,0xad,0xd5,0xde,0xfb,0x42,0xea,0x94,0x70,0xc5,0x12,0xbc,0xf1,0x53,0x0a,0x2a,0x87,0x3a,0xc7,0x4a,0x89,0x62,0xeb,0x62,0xeb,0x94,0x0d,0xde,0x53,0xac,0xae,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x29,0x65,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x24,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x43,0xf7,0x04,0xf7,0x04,0xee,0xc4,0x31,0x62,0x39,0xc7,0x8c,0x71,0x53,0x8a,0xb5,0xf6,0xff,0xff,0xff,0xff,0xbe,0x17,0xc6,0x58,0xff,0xdf,0xad,0xd6,0xa5,0x94,0xe7,0x3c,0xff,0xff,0xa5,0x74,0xef,0x7d,0xce,0x99,0x9d,0x53,0xc6,0x78,0xff,0xff,0xff,0xff,0xff,0xdf,0x8c,0xd1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0xf7,0x9e,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x19,0xc5,0x19,0xe5,0x1a,0x05,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x25,0x6c,0x2e,0x8d,0x11,0x22,0x26,0x19,0xe5,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x53,0x8b,0x6c,0x0d,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x7c,0x8f,0xe7,0x5c,0xff,0xff,0x8c,0xd2,0x19,0xe5,0x2a,0x87,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0x95,0x32,0xd6,0xfa,0xd6,0xfa,0xd6,0xfa,0xd6,0xfa,0xd6,0xfa,0xef,0x9e,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x84,0xd0,0x8d,0x12,0xc6,0x79,0xc6,0x79,0xc6,0x79,0xc6,0x79,0xc6,0x79,0xe7,0x5c,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x7c,0x8f,0x7c,0x90,0x6c,0x2d,0x43,0x29,0xd6,0xba,0xf7,0x9d,0xf7,0x9d,0x74,0x0f,0x2a,0x87,0x3a,0xc7,0x4a,0x89,0x62,0xeb,0x62,0xeb,0x6b,0x0b,0x73,0x4b,0x6b,0x2b,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x21,0x24,0x83,0xa3,0xc5,0xa3,0xc5,0xa3,0xa4,0xc3,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x95,0x12,0xff,0xdf,0xff,0xff,0xff,0xff,0x95,0x12,0x9d,0x53,0xf7,0x9e,0x9d,0x53,0xef,0x9d,0xff,0xdf,0xff,0xff,0xef,0x7d,0xff,0xff,0xa5,0x74,0xdf,0x1b,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x57,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x6c,0x0d,0xd6,0xda,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x32,0xa7,0x32,0xa7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x22,0x46,0x19,0xc5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x8c,0xf1,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x5b,0xcc,0xde,0xfb,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0x8c,0xb2,0x2a,0x87,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0xad,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x84,0xd0,0xb5,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xc7,0xd6,0xba,0xef,0x5d,0xef,0x5d,0x6b,0xee,0x2a,0x87,0x3a,0xc7,0x4a,0x89,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x7b,0xce,0x95,0x33,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x8c,0xf2,0xff,0xdf,0xff,0xff,0xef,0x7d,0xa5,0xb5,0xa5,0xb5,0xef,0x9d,0xb6,0x16,0x9d,0x53,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfb,0x74,0x4f,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0xd6,0xba,0xce,0x79,0xce,0x79,0xce,0x79,0xce,0x79,0xbe,0x38,0x5b,0xab,0xce,0xba,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x4b,0x49,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xfe,0xe7,0x5c,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x33,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x9d,0x74,0x6e,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0xad,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x84,0xd0,0xb5,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x63,0xad,0x84,0x91,0x84,0x90,0x32,0x88,0x2a,0x87,0x3a,0xc7,0x3a,0x47,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x63,0x0b,0x63,0x0b,0x63,0x0b,0x73,0xad,0xbe,0x17,0xef,0x9d,0x8c,0xd1,0x43,0x28,0x74,0x6f,0xe7,0x3c,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x39,0xa2,0x63,0x03,0x63,0x03,0x62,0xe3,0x21,0x02,0x39,0xc7,0x8c,0x71,0x53,0x8b,0xbe,0x17,0xff,0xff,0xce,0xb9,0xdf,0x1b,0xd6,0xba,0xce,0xb9,0x95,0x12,0xa5,0x74,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x8c,0xf2,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xdf,0x84,0xd0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0x74,0x6f,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x43,0x28,0xce,0xba,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xef,0x7d,0x7c,0x8f,0x74,0x6f,0x74,0x6f,0x74,0x6f,0x74,0x6f,0x6c,0x2e,0x43,0x49,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x95,0x11,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x33,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0x53,0x8a,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x9d,0x53,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x8d,0x11,0xb6,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0x87,0x32,0xc7,0x19,0xe5,0x32,0x67,0x42,0xc8,0x42,0xc8,0x63,0xcd,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x95,0x33,0x9d,0x73,0xff,0xff,0xff,0xff,0xde,0xfb,0xff,0xff,0xff,0xff,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x21,0x24,0x83,0xc3,0xcd,0xc3,0xcd,0xc3,0xb5,0x23,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x39,0xc7,0x8c,0x71,0x53,0x6a,0x53,0x8b,0xde,0xfb,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xef,0x9d,0xe7,0x3c,0x8d,0x12,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xef,0x9d,0x63,0xec,0xce,0xba,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xef,0x9d,0x9d,0x53,0x95,0x53,0x95,0x53,0x95,0x53,0x95,0x53,0x84,0xb0,0x43,0x49,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xb5,0xf6,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0xd2,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x66,0x19,0xc5,0x2a,0x46,0x63,0xcc,0x43,0x49,0x5b,0xcc,0x3b,0x08,0x6c,0x0d,0x53,0x8a,0x3b,0x08,0x84,0xd1,0xf7,0x9e,0xbe,0x37,0xb5,0xf6,0xbe,0x17,0xe7,0x3c,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x29,0x65,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x24,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x8c,0x71,0x53,0x6a,0x3b,0x08,0x4b,0x6a,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x7c,0x8f,0xde,0xfb,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x4b,0x49,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xff,0xdf,0xff,0xff,0x8c,0xb2,0x22,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xb6,0x16,0x95,0x12,0x95,0x12,0x95,0x12,0x95,0x12,0x95,0x12,0x95,0x12,0xd6,0xda,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xc6,0x58,0xa5,0x74,0xad,0xb5,0xad,0xd5,0xad,0xd5,0xad,0xd5,0xad,0xd5,0xdf,0x1b,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x19,0xe5,0x22,0x26,0xad,0x95,0x84,0xb1,0xb5,0xf6,0x53,0x6a,0xb6,0x17,0xbe,0x17,0x3b,0x08,0x84,0xd1,0xff,0xdf,0xdf,0x1b,0x84,0xd1,0xdf,0x1b,0xf7,0x9e,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x8c,0x71,0x53,0x6a,0x3b,0x08,0x4b,0x49,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x4a,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0x5b,0xcc,0x5b,0xcc,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x6c,0x2d,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x5b,0xcc,0x5b,0xcc,0x5b,0xcc,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0xad,0xd5,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x5b,0xab,0x5b,0xab,0x53,0x8b,0x42,0xe9,0x3a,0xa9,0x4b,0x4a,0x63,0xcc,0xe7,0x3c,0xff,0xff,0x94,0xf2,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0x5b,0xcc,0x74,0x4e,0x53,0xab,0x53,0xab,0x74,0x4e,0x4b,0x6a,0xb6,0x16,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x6c,0x0e,0x3a,0xa8,0x53,0x6b,0x53,0x8a,0x53,0x8a,0x6c,0x0d,0x4b,0x6a,0xb5,0xf6,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x9d,0x34,0xb5,0xf7,0xbe,0x17,0x5b,0xac,0x22,0x25,0x94,0xf2,0xb5,0xf7,0xbd,0xf7,0xbe,0x17,0x4b,0x0a,0xa5,0x94,0x64,0x0d,0x95,0x32,0xad,0xd6,0x3b,0x08,0x84,0xd1,0xf7,0x9e,0xb5,0xf6,0x7c,0x6f,0xad,0xd5,0xdf,0x1b,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0xa6,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x8c,0x71,0x53,0x6a,0x53,0x6a,0xce,0xb9,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x3c,0xd6,0xda,0x84,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0xbe,0x58,0xad,0xd5,0xad,0xd5,0xad,0xd5,0xad,0xd5,0xad,0xd5,0xad,0xd5,0xef,0x7d,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x3c,0xf7,0x9e,0xf7,0x9e,0xef,0x7d,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xd6,0xda,0xff,0xdf,0xf7,0xbe,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x7d,0xf7,0x9e,0xf7,0x9e,0xd6,0xfa,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x43,0x29,0xb5,0xf6,0xc6,0x58,0x3a,0xc9,0x9d,0x33,0xc6,0x78,0x4b,0x2a,0xdf,0x1b,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0xb5,0xf6,0xff,0xff,0x9d,0x53,0x95,0x52,0xff,0xdf,0x7c,0x8f,0xb6,0x16,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x7c,0xb0,0xad,0xb5,0xf7,0xbe,0x95,0x33,0x8d,0x12,0xf7,0xbe,0x7c,0xb0,0xb5,0xf6,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xc5,0xce,0x99,0xef,0x5d,0xef,0x5d,0x84,0xb0,0x3a,0xe8,0xc6,0x78,0xef,0x5d,0xef,0x7d,0xa5,0x75,0x7c,0x50,0xce,0xba,0x7c,0x6f,0xbe,0x37,0xad,0xd5,0x3b,0x08,0x84,0xd1,0xff,0xdf,0xd6,0xba,0xbe,0x17,0xc6,0x78,0xf7,0xbe,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xc7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x52,0x62,0xbd,0x63,0xbd,0x63,0xb5,0x23,0x29,0x22,0x39,0xc7,0x8c,0x71,0x53,0x8b,0xad,0xd5,0xff,0xff,0xd6,0xda,0xef,0x7d,0xe7,0x3c,0xd6,0xba,0xad,0xd6,0xad,0x95,0xd6,0xda,0xa5,0x74,0xad,0xd6,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xdf,0x6c,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0x5b,0xcc,0x6c,0x2d,0x4b,0x49,0x63,0xcc,0x6c,0x0d,0x4b,0x49,0xce,0xba,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x94,0xc6,0x58,0xef,0x7d,0xef,0x5d,0xe7,0x5c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0xad,0xd5,0xf7,0xbe,0xa5,0x94,0xc6,0x99,0xf7,0xbe,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0xa5,0xb4,0xf7,0xbe,0xce,0x99,0xef,0x7d,0xb5,0xf6,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x5d,0x5b,0xab,0x53,0x8a,0x53,0x8a,0x53,0x8a,0x53,0x8a,0x53,0x8a,0x5b,0xcb,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x4b,0x49,0xe7,0x5c,0xff,0xdf,0x5b,0xac,0xce,0xb9,0xff,0xff,0x4a,0xea,0xdf,0x1b,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0xb6,0x16,0xff,0xff,0x9d,0x53,0x95,0x53,0xff,0xff,0x7c,0xb0,0xb6,0x16,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xe7,0x5c,0xef,0x5c,0xff,0xff,0x94,0xf2,0x8c,0xf1,0xff,0xff,0x84,0xb0,0xb5,0xf6,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xc5,0xad,0x95,0xbd,0xf7,0xbd,0xf7,0x4b,0x2a,0x22,0x26,0xa5,0x34,0xc6,0x17,0xbd,0xf7,0x53,0x2b,0x2a,0x47,0x4b,0x4a,0x43,0x49,0x4b,0x49,0x43,0x29,0x3b,0x08,0x84,0xd1,0xe7,0x3c,0x9d,0x74,0xce,0x79,0xa5,0x94,0xbe,0x58,0xb5,0xf6,0x3a,0xc7,0x3a,0xc7,0x84,0xd1,0x39,0xe7,0x29,0x45,0x31,0x82,0x52,0x63,0x52,0x63,0x4a,0x22,0x18,0xe3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x84,0xb0,0xf7,0xbe,0xff,0xff,0xef,0x7d,0x7c,0x6f,0x84,0xb0,0xc6,0x58,0xad,0xd5,0xd6,0xda,0xc6,0x58,0x95,0x12,0xef,0x5d,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0xce,0x99,0xff,0xdf,0x7c,0x8f,0xbe,0x37,0xf7,0xbe,0x6c,0x0d,0xce,0xba,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xff,0xff,0xde,0xfb,0x43,0x49,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xe7,0x3c,0x53,0x6a,0x7c,0xb0,0xff,0xff,0x7c,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x43,0x49,0xc6,0x78,0xad,0xd5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x3c,0x43,0x49,0x9d,0x73,0x95,0x32,0x53,0x8b,0x95,0x32,0x8d,0x12,0x43,0x49,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x4b,0x49,0xe7,0x5c,0xff,0xdf,0x64,0x0d,0xd6,0xba,0xff,0xff,0x53,0x2a,0xdf,0x1b,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x84,0xd0,0xb6,0x16,0xff,0xff,0xd6,0xfb,0xd6,0xfa,0xff,0xff,0x9d,0x53,0xc6,0x78,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x95,0x12,0xce,0x79,0xff,0xff,0xc6,0x38,0xbe,0x17,0xff,0xff,0x84,0xd0,0xb6,0x16,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x4b,0x0a,0x5b,0x0c,0x29,0x66,0x29,0x86,0x4b,0x0b,0x3a,0xa9,0x63,0x4c,0x29,0x66,0x29,0x86,0x4b,0x0b,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xdf,0x1b,0xb5,0xf6,0xff,0xff,0xce,0x99,0xbe,0x37,0xad,0xb6,0x19,0xe5,0x19,0xe5,0x7c,0x4f,0x39,0xe7,0x21,0x24,0xa4,0x83,0xff,0x24,0xff,0x24,0xde,0x24,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x8d,0x12,0xff,0xdf,0xff,0xff,0xff,0xff,0x95,0x12,0xad,0x95,0xd6,0xfb,0xad,0xd5,0xd6,0xda,0xce,0x99,0xde,0xfb,0x95,0x32,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0xce,0xb9,0xff,0xff,0x7c,0x8f,0xbe,0x38,0xf7,0xbe,0x6c,0x0d,0xce,0xba,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x53,0x6a,0x9d,0x53,0xbe,0x37,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x73,0xff,0xff,0xc6,0x58,0xef,0x5d,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xad,0xd6,0x84,0xd1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x3c,0x4b,0x49,0xff,0xff,0xef,0x7d,0x6c,0x0d,0xef,0x5d,0xe7,0x3c,0x4b,0x69,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x95,0x12,0xef,0x9d,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xb5,0xd6,0xef,0x9d,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xf7,0xbe,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x32,0xc7,0x53,0x8b,0xf7,0x9e,0xff,0xff,0xef,0x5d,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xce,0x79,0x2a,0x66,0x2a,0x66,0x3a,0xe7,0x3b,0x08,0x3a,0xe8,0x63,0xcd,0x6b,0x8e,0x29,0x66,0x29,0x65,0x84,0x70,0x4b,0x2a,0x7b,0xcf,0x29,0x66,0x29,0x65,0x84,0x70,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xff,0xdf,0xd6,0xda,0xf7,0x9e,0xd6,0x9a,0xf7,0x9e,0xb5,0xd6,0x2a,0x66,0x2a,0x66,0x84,0x90,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x62,0xc2,0xd6,0x04,0xd6,0x04,0xcd,0xe3,0x29,0x42,0x39,0xc7,0x8c,0x71,0x5b,0x8b,0xc6,0x58,0xff,0xff,0xff,0xff,0xa5,0x94,0xad,0xd5,0xf7,0xbe,0x9d,0x74,0x8d,0x12,0xce,0xb9,0x8c,0xd1,0x9d,0x53,0xbe,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0x74,0x4e,0xce,0xba,0xff,0xff,0xbe,0x17,0xde,0xfb,0xff,0xdf,0x7c,0x8f,0xd6,0xfa,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x3c,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xde,0xfb,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x43,0x49,0xa5,0x94,0xc6,0x58,0xce,0x99,0x84,0xd1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x9d,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xad,0xd5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x3c,0x4b,0x49,0xff,0xff,0xef,0x7d,0x74,0x4e,0xef,0x7d,0xe7,0x3c,0x4b,0x69,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xef,0x5d,0xef,0x5d,0xe7,0x5c,0xef,0x5d,0xef,0x5d,0xe7,0x5c,0xef,0x5d,0xff,0xdf,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xad,0xb5,0x84,0xd0,0x84,0xd0,0x84,0xd0,0x84,0xd0,0x84,0xd0,0x84,0xd0,0xce,0xb9,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x42,0xc9,0xf7,0x9e,0xff,0xff,0xb5,0xf7,0x94,0xf2,0x94,0xf3,0x9d,0x53,0x9d,0x74,0x95,0x13,0x94,0xf2,0xd6,0xba,0xff,0xff,0xc6,0x59,0x22,0x26,0x19,0xe5,0x19,0xe5,0x22,0x05,0x22,0x05,0x2a,0x47,0x4a,0x89,0x42,0x08,0x42,0x28,0x4b,0x0b,0x2a,0x47,0x52,0xca,0x42,0x08,0x42,0x28,0x4b,0x0a,0x22,0x25,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xef,0x9d,0xad,0x95,0x7c,0x2f,0x8c,0x91,0xb5,0xf7,0xb6,0x16,0x3a,0xe7,0x3a,0xe7,0x84,0xd1,0x39,0xe7,0x21,0x24,0x9c,0x83,0xff,0x24,0xff,0x24,0xde,0x24,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0xa6,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x39,0xc7,0x8c,0x71,0x3a,0xc8,0x5b,0xab,0xe7,0x5c,0xf7,0xbe,0xf7,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xef,0x7d,0xf7,0xbe,0xf7,0xbe,0xef,0x7d,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xdf,0x1b,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x17,0xe7,0x3c,0xe7,0x3c,0xe7,0x5c,0xe7,0x5c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xc6,0x78,0xc6,0x78,0xc6,0x58,0x95,0x32,0x43,0x28,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x5b,0xcc,0xbe,0x37,0x8d,0x12,0x5b,0xcc,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xef,0x5d,0x6c,0x4e,0xff,0xff,0xff,0xdf,0xe7,0x3c,0xff,0xdf,0xef,0x7d,0xa5,0x94,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x4b,0x6a,0x43,0x09,0x32,0x67,0x43,0x09,0x43,0x09,0x32,0x67,0x4b,0x4a,0xe7,0x3c,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0x8f,0x6c,0x0d,0x84,0xb0,0x84,0xb0,0x84,0xb0,0x7c,0x90,0x4b,0x6a,0xad,0xd6,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x2a,0x87,0x4b,0x0a,0xf7,0x9e,0xff,0xff,0x63,0xcd,0x3a,0xa8,0x4b,0x2a,0x53,0x6b,0x64,0x0d,0x5b,0xcc,0x2a,0x47,0x9d,0x54,0xff,0xff,0xce,0x99,0x6c,0x2d,0x3a,0xe8,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0xc6,0x38,0xe7,0x3c,0xe7,0x3c,0x74,0x0f,0x19,0xc5,0xbe,0x17,0xe7,0x3c,0xe7,0x3c,0x84,0x90,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xff,0xdf,0xc6,0x79,0x73,0xee,0xbe,0x17,0xbe,0x57,0xad,0xb6,0x19,0xe5,0x19,0xc5,0x74,0x4f,0x39,0xc7,0x29,0x45,0x39,0xa2,0x52,0x63,0x52,0x63,0x4a,0x22,0x18,0xe3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x8c,0x71,0x32,0x68,0x22,0x26,0x53,0xab,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x63,0xec,0x5b,0xab,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0xb6,0x17,0xb5,0xf6,0xb5,0xf6,0xc6,0x78,0xf7,0x9e,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xce,0x99,0xff,0xff,0xff,0xdf,0xf7,0x9e,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x9d,0x73,0xf7,0x9e,0xff,0xdf,0xef,0x5d,0xff,0xdf,0x95,0x12,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xc6,0x58,0x84,0xd0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xf7,0xde,0x43,0x49,0xbe,0x17,0xc6,0x58,0xc6,0x79,0xc6,0x79,0xbe,0x38,0x53,0x6b,0xe7,0x1c,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0x8f,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xaf,0xb6,0x16,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3a,0xc7,0x19,0xc5,0x2a,0x86,0xad,0xd5,0x74,0x6f,0xf7,0x9e,0xff,0xff,0x63,0xad,0xad,0x95,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0x6b,0xee,0xa5,0x75,0xff,0xff,0xce,0x99,0xd6,0xda,0x74,0x4e,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x3a,0xe8,0xd6,0xba,0xef,0x5d,0xef,0x5d,0x6b,0xee,0x22,0x06,0xc6,0x38,0xef,0x5d,0xef,0x5d,0x84,0xd1,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xef,0x7d,0xb5,0xd6,0xde,0xfb,0xbe,0x37,0xf7,0xbe,0xad,0xb6,0x19,0xc5,0x19,0xc5,0x74,0x4f,0x39,0xc7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x8c,0x71,0x3a,0xc8,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xad,0xb5,0x53,0x6a,0x63,0xcc,0x6c,0x2d,0x64,0x0d,0x4b,0x49,0x6c,0x4e,0xf7,0x9e,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xba,0x9d,0x53,0xad,0xd5,0xce,0x99,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x53,0xe7,0x3c,0xef,0x7d,0xe7,0x3c,0xff,0xff,0xbe,0x58,0x9d,0x74,0x3b,0x08,0x43,0x29,0xa5,0x94,0xdf,0x1c,0xdf,0x1b,0xce,0xba,0x95,0x32,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xce,0xb9,0x84,0xb0,0x5b,0xcc,0x5b,0xcc,0x5b,0xec,0x8d,0x12,0xef,0x5d,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x4b,0x49,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x43,0x09,0xe7,0x3c,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x84,0xd0,0x95,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x63,0xec,0xd6,0xda,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x22,0x05,0x53,0x8b,0x63,0xcc,0xf7,0x9e,0xff,0xff,0x74,0x2f,0x8c,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x42,0xea,0xbe,0x17,0xff,0xff,0xc6,0x59,0x43,0x09,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x7c,0x4f,0x8c,0xb1,0x8c,0xd2,0x3a,0xa8,0x19,0xe5,0x74,0x0f,0x9d,0x53,0x95,0x33,0x42,0xe9,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x84,0x70,0xef,0x7d,0x9d,0x33,0xd6,0xda,0x7c,0x70,0xce,0x99,0xad,0xb6,0x19,0xe5,0x19,0xe5,0x74,0x4f,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x8c,0x71,0x4b,0x6a,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xbe,0x6c,0x0d,0xb5,0xf6,0xf7,0xbe,0xff,0xdf,0xf7,0xbe,0xdf,0x1b,0x5b,0xab,0xce,0xb9,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x90,0xdf,0x1b,0xf7,0x9e,0xd6,0xfa,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0x94,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xb6,0x16,0x4b,0x6a,0x63,0xec,0x3b,0x08,0x7c,0x6f,0xff,0xdf,0xe7,0x5c,0xe7,0x3c,0xe7,0x3c,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xf7,0xbe,0x4b,0x6a,0x74,0x4e,0xad,0xb5,0xb6,0x17,0x95,0x53,0x64,0x0d,0x6c,0x4e,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x63,0xec,0x84,0xd1,0xe7,0x5c,0xf7,0xbe,0xef,0x7d,0x94,0xd2,0x4b,0x4a,0xff,0xdf,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xbe,0x58,0x43,0x28,0x74,0x4e,0x95,0x12,0x8d,0x12,0x63,0xec,0x64,0x0d,0xf7,0x9e,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xc5,0x19,0xe5,0x4b,0x2a,0xf7,0x9e,0xff,0xff,0xb5,0xd6,0x2a,0x47,0x7c,0x50,0x94,0xf2,0x9d,0x53,0x6c,0x0d,0x42,0xc9,0xef,0x9d,0xff,0xff,0xc6,0x58,0x22,0x05,0x19,0xe5,0x2a,0x46,0x2a,0x87,0x2a,0x87,0x22,0x46,0x4b,0x0a,0x6b,0xce,0x6b,0xce,0x5b,0x6c,0x2a,0x67,0x5b,0x6c,0x7c,0x8f,0x74,0x6f,0x3a,0xa8,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x7c,0x2f,0xde,0xfb,0xce,0x99,0x94,0xf2,0xd6,0xba,0xa5,0x95,0xad,0xb6,0x19,0xe5,0x19,0xc5,0x74,0x4f,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x10,0xa2,0x18,0xc2,0x18,0xc2,0x18,0xc2,0x18,0xa2,0x39,0xc7,0x8c,0x71,0x43,0x09,0x4b,0x6a,0xce,0x99,0xef,0x7d,0xef,0x9d,0xef,0x9d,0xf7,0x9e,0xef,0x9d,0xef,0x9d,0xf7,0x9e,0xef,0x9d,0xef,0x9d,0xf7,0x9e,0xf7,0x9e,0xdf,0x1b,0x7c,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xbe,0x64,0x0d,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x6c,0x4e,0xc6,0x78,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x3c,0xf7,0xbe,0xbe,0x37,0xf7,0xbe,0xce,0x99,0x43,0x29,0x3b,0x08,0x3b,0x08,0x43,0x29,0x43,0x49,0x43,0x49,0x7c,0x6f,0xe7,0x5c,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xff,0xff,0xe7,0x3c,0xd6,0xda,0xd6,0xda,0x9d,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xde,0xfb,0x5b,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x4b,0x49,0xf7,0xbe,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x29,0x22,0x26,0x3a,0xe8,0x3a,0xe8,0x32,0x68,0xce,0x79,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xc6,0x78,0x8c,0xf1,0x84,0xb0,0x84,0xb0,0xa5,0x94,0xef,0x7d,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x22,0x05,0x42,0xc9,0xf7,0x9e,0xff,0xff,0xff,0xdf,0xa5,0x75,0x63,0xcd,0x53,0x4c,0x63,0xac,0x84,0xd1,0xde,0xdb,0xff,0xff,0xff,0xff,0xce,0x79,0x3a,0xc8,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x4a,0xbe,0x37,0xb5,0xf6,0xb5,0xf6,0x3b,0x08,0x74,0x2e,0xe7,0x3c,0x9d,0x53,0x7c,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0x7c,0x50,0xf7,0xbe,0x9d,0x33,0xad,0xd6,0xbe,0x17,0xe7,0x1c,0xad,0xb6,0x19,0xc5,0x19,0xc5,0x74,0x4f,0x39,0xe7,0x29,0x65,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x3a,0x88,0x9d,0x33,0xff,0xff,0xd6,0xda,0x9c,0xf3,0x7c,0x50,0xdf,0x1b,0xa5,0x74,0x95,0x32,0xef,0x7d,0x95,0x33,0x9d,0x53,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xdf,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0x6c,0x2e,0x84,0xd0,0xf7,0xbe,0xff,0xff,0xff,0xff,0xad,0xd5,0x53,0x8b,0xd6,0xfb,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0xff,0xdf,0xad,0xd6,0x3b,0x08,0xc6,0x78,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0xa5,0x94,0xe7,0x3c,0xe7,0x3c,0xef,0x5d,0xff,0xff,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x43,0x29,0xb6,0x16,0xdf,0x3b,0xdf,0x3b,0xdf,0x3b,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xde,0xfb,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x4b,0x6a,0xf7,0xbe,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0xd6,0xba,0xce,0x99,0xd6,0xda,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x4b,0x2a,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xa5,0x74,0xbe,0x37,0xa5,0x94,0x3b,0x08,0xa5,0x94,0xa5,0x74,0xc6,0x78,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x84,0xd1,0xff,0xff,0xff,0xff,0xe7,0x1c,0xff,0xff,0xff,0xff,0xad,0xb6,0x19,0xe5,0x19,0xe5,0x74,0x4f,0x39,0xe7,0x21,0x24,0x7b,0xa3,0xbd,0x63,0xbd,0x63,0x94,0x43,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x74,0x0f,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0xd2,0xe7,0x3c,0xef,0x9d,0xb6,0x16,0xce,0x79,0x84,0xd1,0xe7,0x3c,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xd5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xce,0x99,0x74,0x4f,0xef,0x7d,0xff,0xff,0xff,0xff,0x9d,0x74,0xa5,0xb5,0xff,0xdf,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x3c,0xef,0x7d,0xb5,0xf6,0xf7,0x9e,0xce,0x99,0x43,0x29,0x3b,0x08,0x3b,0x08,0x95,0x33,0xd6,0xda,0xd6,0xda,0xdf,0x1b,0xff,0xdf,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xa5,0xb5,0xad,0xd5,0xad,0xd5,0x9d,0x53,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xf7,0x9e,0x53,0x8a,0x84,0xb0,0xff,0xff,0xff,0xff,0xf7,0x9e,0x63,0xec,0x84,0xb0,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xb5,0xf6,0xb5,0xf6,0x84,0xf1,0x3b,0x08,0x6c,0x2e,0x95,0x33,0xad,0xb5,0x5b,0xcc,0x3b,0x08,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x84,0x90,0xff,0xff,0xff,0xff,0xa5,0x34,0xff,0xff,0xff,0xff,0xad,0xb6,0x1a,0x05,0x1a,0x05,0x7c,0x50,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x6b,0xce,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0xd2,0xe7,0x3c,0xf7,0x9e,0xb6,0x16,0xd6,0xba,0xce,0x99,0xa5,0x95,0xc6,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xb6,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xdf,0x3c,0xf7,0x9e,0xd6,0xfb,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x53,0x6a,0x7c,0x90,0xd6,0xda,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x5d,0xef,0x7d,0xef,0x7d,0xff,0xff,0x9d,0x74,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xdf,0x1b,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xdf,0xce,0x99,0xf7,0x9e,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x32,0x8c,0xf1,0xde,0xfb,0xad,0xd6,0x3b,0x08,0xb5,0xf6,0xdf,0x1b,0x95,0x32,0x7c,0x8f,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x7c,0x2f,0xff,0xff,0xff,0xff,0xce,0x59,0xff,0xff,0xff,0xff,0xb6,0x16,0x3a,0xe8,0x3a,0xe8,0x84,0xd1,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x39,0xc2,0x73,0x42,0x73,0x42,0x6b,0x22,0x21,0x02,0x39,0xc7,0x8c,0x71,0x3a,0x88,0x9d,0x54,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x95,0xde,0xfb,0x9d,0x53,0x9d,0x53,0xef,0x7d,0x9d,0x53,0x9d,0x73,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0x8c,0xf1,0x6c,0x2d,0x6c,0x2d,0x6c,0x2d,0x6c,0x2d,0x6c,0x2d,0x6c,0x2d,0xdf,0x1b,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xb5,0xf6,0xe7,0x5c,0xad,0xd5,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xd6,0xda,0xe7,0x3c,0xe7,0x3c,0xc6,0x78,0x43,0x49,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xce,0x79,0xce,0x99,0xce,0xba,0xf7,0xbe,0xb6,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xdf,0xd6,0xfa,0xd6,0xda,0xd6,0xda,0xd6,0xda,0xd6,0xda,0xd6,0xda,0xd6,0xfa,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x84,0xb0,0x7c,0x90,0x64,0x0d,0x3b,0x08,0x4b,0x6a,0x8c,0xd1,0x84,0xb1,0x32,0x87,0x22,0x05,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x7c,0x2f,0xff,0xdf,0xc6,0x58,0xb5,0xf7,0xad,0xd6,0xf7,0x9e,0xb5,0xd6,0x2a,0x46,0x2a,0x46,0x7c,0x70,0x39,0xe7,0x21,0x24,0x7b,0x63,0xbd,0x43,0xbd,0x43,0xa4,0xa3,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x39,0xc7,0x8c,0x71,0x32,0x68,0x32,0x67,0xd6,0xba,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xbe,0xef,0x9d,0xf7,0x9e,0xf7,0xbe,0xef,0x9d,0xef,0x7d,0xf7,0xbe,0xf7,0xbe,0xe7,0x5c,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0x95,0x12,0xad,0xb5,0xad,0xb5,0xad,0xb5,0xad,0xb5,0xad,0xb5,0xef,0x5d,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xba,0xff,0xdf,0xe7,0x5c,0xff,0xdf,0xb5,0xf6,0x43,0x28,0x3b,0x08,0x3b,0x08,0xad,0xd5,0xf7,0xbe,0xf7,0x9e,0xef,0x9d,0xff,0xdf,0x6c,0x4e,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x7d,0xef,0x9d,0xef,0x9d,0xe7,0x3c,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x5c,0x4b,0x6a,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x4b,0x6a,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x22,0x05,0x3a,0xa9,0x3a,0xc8,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x7c,0x2f,0xde,0xfb,0xa5,0x74,0x95,0x33,0xbe,0x17,0xad,0xd6,0xad,0xb6,0x19,0xe5,0x19,0xe5,0x7c,0x50,0x39,0xc7,0x29,0x65,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x24,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x8c,0x71,0x32,0x68,0x19,0xe5,0x2a,0x46,0x3a,0xe9,0x4b,0x4a,0x2a,0x67,0x42,0xe9,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x69,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0xff,0xdf,0xc6,0x78,0x95,0x32,0xce,0x99,0xef,0x5d,0x4b,0x49,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xd6,0xda,0xc6,0x58,0xc6,0x58,0xef,0x5d,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x90,0x9d,0x53,0x9d,0x53,0x8d,0x11,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x3c,0x4b,0x49,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xa5,0x94,0xce,0x99,0xc6,0x58,0x3a,0xa8,0xa5,0x74,0xde,0xfb,0xde,0xfb,0x5b,0xac,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x7c,0x4f,0xef,0x5d,0x9d,0x33,0x74,0x0f,0x5b,0x8c,0xc6,0x79,0xb6,0x16,0x3a,0xe8,0x3a,0xe8,0x84,0xd1,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x63,0xec,0x4a,0xc9,0x3a,0x27,0x31,0xe7,0x31,0xe7,0x3a,0x27,0x3a,0x27,0x31,0xe7,0x31,0xe6,0x53,0x0b,0x2a,0x26,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x3c,0xff,0xdf,0xe7,0x3c,0x9d,0x33,0xa5,0x95,0x43,0x29,0x3b,0x08,0x3b,0x08,0x74,0x6f,0x95,0x32,0x95,0x32,0x95,0x32,0x95,0x32,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x3c,0x4b,0x49,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xad,0xb5,0xc6,0x79,0xbe,0x37,0x32,0x68,0xce,0x79,0xef,0x7d,0xef,0x7d,0x7c,0x2f,0x19,0xe5,0x19,0xe5,0x22,0x46,0x84,0xb1,0xff,0xff,0xe7,0x3c,0xdf,0x1c,0xf7,0xbe,0xff,0xff,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x95,0x12,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x84,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0x74,0x4e,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xa5,0xb4,0x84,0xb0,0x53,0x8a,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xf6,0xff,0xdf,0xf7,0xbe,0xff,0xdf,0xff,0xff,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xdf,0xce,0x79,0xef,0x7d,0xef,0x7d,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xe7,0x3c,0x4b,0x49,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xad,0xb5,0x84,0xb0,0xd6,0xfa,0xff,0xff,0xff,0xff,0xad,0xb5,0x8c,0xf1,0xf7,0x9e,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xbe,0x58,0xa5,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb5,0xce,0x99,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0x7c,0x70,0x32,0x88,0x53,0x4b,0x22,0x06,0x5b,0x4c,0x7b,0xf0,0x84,0x10,0x32,0x67,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x84,0xb1,0xff,0xff,0x95,0x33,0x95,0x12,0xad,0xb5,0xef,0x9e,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x4b,0x4a,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x42,0xc9,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xde,0xfb,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5d,0x4b,0x49,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xde,0xfb,0x74,0x4e,0x95,0x12,0xff,0xdf,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x5b,0xab,0x9d,0x53,0x84,0xb0,0x95,0x12,0x95,0x12,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xef,0x7d,0x7c,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb6,0x53,0x6c,0xf7,0xbe,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0x53,0xab,0x5b,0xcc,0xef,0x7d,0xff,0xff,0xce,0x99,0x5b,0xab,0xb6,0x16,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x7c,0xb0,0xad,0xd5,0xff,0xff,0xd6,0xba,0x9d,0x54,0xf7,0xbe,0x74,0x2f,0xa5,0x95,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xd6,0x9a,0x6b,0xce,0x95,0x12,0x74,0x0e,0x6b,0x6d,0x29,0x66,0x29,0x86,0x8c,0xb2,0x3a,0xc7,0x3a,0xe8,0x32,0xa7,0x7c,0x4f,0xef,0x7d,0x74,0x4e,0xad,0xb5,0xe7,0x5c,0xdf,0x1b,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x39,0xc7,0x21,0x24,0x29,0x22,0x31,0xa2,0x31,0xa2,0x31,0x62,0x18,0xe3,0x39,0xe7,0x32,0x67,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x22,0x05,0x22,0x05,0x2a,0x66,0x3a,0xe8,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x84,0xd0,0x7c,0x90,0xb5,0xf6,0xe7,0x3c,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xd6,0xe7,0x5c,0xef,0x7d,0xe7,0x3c,0xe7,0x5c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x95,0x53,0xff,0xdf,0xa5,0x74,0xc6,0x58,0xf7,0xbe,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x5d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xad,0xb5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xf7,0xbe,0xce,0x99,0xef,0x5d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x4b,0x2a,0x8c,0xf2,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0xad,0xb5,0x74,0x4e,0x84,0xd0,0xf7,0xde,0xff,0xff,0x84,0xd1,0xa5,0xb5,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x74,0x4f,0xbe,0x57,0xff,0xff,0xad,0xb6,0x32,0x87,0x8c,0xf1,0x6c,0x0e,0xa5,0x95,0xff,0xff,0xce,0x99,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x3a,0xc9,0x74,0x0f,0x9d,0x33,0xa5,0x74,0x5b,0x8c,0x6b,0x6d,0x29,0x65,0x29,0x66,0x9c,0xf3,0x32,0xc7,0x32,0x87,0x19,0xe5,0x7c,0x2f,0xff,0xff,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xb6,0x16,0x43,0x29,0x3b,0x08,0x32,0xa7,0x39,0xc7,0x21,0x24,0x9c,0x83,0xff,0x24,0xff,0x24,0xd6,0x23,0x18,0xc3,0x39,0xc7,0x32,0x67,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x22,0x05,0x22,0x25,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xce,0xba,0x8c,0xf1,0x4b,0x49,0x53,0x6a,0x6c,0x2d,0xad,0xd5,0xd6,0xda,0xf7,0xde,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1c,0xff,0xff,0xff,0xdf,0xff,0xdf,0xce,0xb9,0x43,0x29,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xd6,0xba,0xff,0xff,0xff,0xdf,0xad,0xb5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xce,0x99,0xef,0x7d,0xe7,0x3c,0xf7,0x9e,0xb6,0x16,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xef,0x7d,0x64,0x0d,0x53,0x8b,0x7c,0x8f,0xb5,0xf6,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x95,0x12,0x8c,0xf2,0x84,0x91,0x8c,0xf2,0x8c,0xf2,0x5b,0x8c,0x43,0x08,0xef,0x5d,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0xb6,0x16,0xe7,0x5c,0x5b,0xcc,0x84,0xf1,0xd6,0xda,0x6c,0x0d,0xad,0xf6,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0x8c,0xf1,0x84,0xb0,0xce,0x99,0x74,0x2f,0x6b,0xee,0x6c,0x0d,0x2a,0x47,0xa5,0x95,0xff,0xff,0xf7,0xbe,0xc6,0x78,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0x67,0xa5,0x74,0xbe,0x37,0x94,0xf2,0x22,0x06,0x52,0xeb,0x63,0x2c,0x63,0x2c,0x3a,0x88,0x19,0xe5,0x19,0xe5,0x22,0x05,0x84,0xb0,0xff,0xff,0xff,0xdf,0xbe,0x37,0xef,0x9d,0xff,0xff,0xb6,0x16,0xbe,0x37,0x84,0xd0,0x32,0xa7,0x39,0xc7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x32,0x67,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x22,0x46,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x05,0x22,0x05,0x64,0x0d,0x95,0x31,0x22,0x26,0x22,0x05,0x3a,0xe8,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x6c,0x0d,0xd6,0xfa,0xbe,0x37,0x6c,0x0d,0x43,0x49,0xd6,0xda,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xc6,0x58,0x84,0x90,0x9d,0x53,0xb5,0xf6,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0x84,0xf1,0xa5,0x94,0x9d,0x53,0x7c,0xb0,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xe7,0x5c,0xff,0xff,0xf7,0xbe,0xf7,0xbe,0xa5,0xb5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xf7,0x9e,0x9d,0x53,0x5b,0xcb,0x6c,0x2e,0x53,0xab,0x64,0x0d,0x9d,0x73,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0x84,0xd0,0x7c,0x90,0x6c,0x0e,0x7c,0x90,0x7c,0x90,0x6c,0x0e,0x84,0xd1,0xef,0x7d,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0x7c,0xb0,0xb6,0x16,0xff,0xff,0xd6,0xfa,0x5b,0xec,0x4b,0x49,0x63,0xcc,0xdf,0x1b,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xde,0xfb,0x5b,0xac,0x22,0x06,0x3a,0xa8,0xb5,0xf7,0xe7,0x3c,0x5b,0x8c,0xbe,0x17,0xff,0xff,0xd6,0xda,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x53,0x8b,0xb5,0xf6,0xbe,0x17,0x9d,0x34,0x3a,0xa8,0xc6,0x58,0xf7,0x9e,0xf7,0x9d,0x6c,0x0e,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x84,0xd1,0xdf,0x1b,0x74,0x6f,0x3b,0x08,0x5b,0xcc,0xce,0x99,0xb6,0x16,0x74,0x4e,0x6c,0x0c,0x32,0xa7,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x74,0x0f,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x05,0x22,0x46,0x7c,0x8f,0x8d,0x11,0x22,0x26,0x1a,0x05,0x3a,0xe8,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x63,0xcc,0xb6,0x16,0x7c,0x90,0x4b,0x49,0x53,0x8a,0xdf,0x1b,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x5d,0xf7,0x9e,0xf7,0x9e,0xef,0x7d,0x9d,0x53,0x43,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xc6,0x58,0x8c,0xf1,0xc6,0x78,0xc6,0x58,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x95,0x12,0xf7,0xbe,0xc6,0x78,0x5b,0xcc,0x43,0x49,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xef,0x7d,0xf7,0x9e,0xff,0xff,0xff,0xff,0xf7,0xbe,0xef,0x7d,0xf7,0xbe,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xf7,0xbe,0xe7,0x5d,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x32,0xc7,0x2a,0x66,0x2a,0x87,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x3a,0xe8,0x5b,0x8c,0x53,0x2b,0x2a,0x46,0x21,0xe5,0xb5,0xb6,0xe7,0x3c,0xe7,0x3c,0x5b,0x8c,0x19,0xe5,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x63,0xec,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x39,0xe7,0x21,0x24,0x41,0xe2,0x62,0xc2,0x62,0xc2,0x5a,0xa2,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0xad,0xd5,0x63,0xec,0x43,0x28,0x63,0xec,0xa5,0xb5,0xd6,0xda,0xf7,0xbe,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x94,0xef,0x5d,0xd6,0xfa,0xdf,0x1b,0xef,0x7d,0x4b,0x69,0x3b,0x08,0x3b,0x08,0x74,0x4f,0xce,0x79,0xef,0x5d,0xc6,0x58,0xff,0xdf,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x3b,0x08,0x43,0x08,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xef,0x9d,0xa5,0x74,0x53,0x8a,0x53,0x8a,0x4b,0x6a,0x7c,0x6f,0xb5,0xf6,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe7,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x32,0x87,0x32,0xc7,0x19,0xe5,0x2a,0x46,0x6c,0x0e,0x53,0x4b,0x19,0xe5,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x39,0xe7,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0x9d,0x53,0xa5,0x94,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x5c,0xf7,0x9e,0xf7,0x9e,0xff,0xff,0xe7,0x3c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0xad,0xf6,0xff,0xdf,0xf7,0xbe,0xff,0xff,0xef,0x7d,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xef,0x5d,0x4b,0x6a,0x5b,0xcc,0x8c,0xf1,0xbe,0x37,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x19,0xe5,0x22,0x26,0x53,0x8a,0x43,0x08,0x22,0x26,0x22,0x26,0x3a,0xc7,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x3a,0xc7,0x2a,0x66,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x37,0xc6,0x58,0xc6,0x58,0xbe,0x17,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x8d,0x12,0x74,0x6f,0xad,0xd5,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xf7,0x9e,0xd6,0xda,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0xb5,0x19,0xe5,0x32,0xa7,0xe7,0x5c,0x84,0xaf,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x32,0xa7,0x32,0xc7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x32,0xc7,0x3b,0x08,0x3a,0xc7,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x31,0xe6,0x31,0xe6,0x3a,0x07,0x3a,0x47,0x73,0xae,0x73,0xce,0x73,0xcf,0x7b,0xcf,0x9d,0x13,0x43,0x28,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xdf,0x1b,0xdf,0x1b,0xd6,0xfa,0x9d,0x53,0x43,0x28,0x3b,0x08,0x3b,0x08,0xb5,0xf6,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xde,0xfb,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0xb0,0x19,0xe5,0x22,0x26,0x5b,0x8b,0x32,0xa7,0x22,0x05,0x22,0x05,0x22,0x05,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x2a,0x66,0x3a,0xc7,0x22,0x06,0x4b,0x2a,0x4b,0x2a,0x22,0x26,0x43,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3a,0xe8,0x3a,0xa8,0x32,0x67,0x4b,0x49,0x4b,0x6a,0x4b,0x49,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xde,0xfb,0xe7,0x5c,0xe7,0x5c,0xf7,0xbe,0xef,0x5d,0x4b,0x69,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0xdf,0x1b,0xef,0x7d,0xd6,0xba,0xff,0xff,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xac,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xb9,0x4b,0x49,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x05,0x22,0x26,0x22,0x26,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x32,0x67,0xb5,0xd6,0xc6,0x58,0x63,0x4c,0x7b,0xef,0x73,0xcf,0x73,0xee,0xc6,0x58,0xad,0x95,0x2a,0x46,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x53,0x6a,0x4b,0x2a,0x5b,0x8c,0x5b,0xac,0x43,0x08,0x63,0xec,0x53,0xab,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x3c,0xf7,0x9e,0xf7,0x9e,0xff,0xdf,0xc6,0x78,0x43,0x28,0x3b,0x08,0x3b,0x08,0xad,0xf6,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xf7,0xbe,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xe7,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x84,0xb0,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x6c,0x0e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1b,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x87,0x32,0xa7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x3a,0xa8,0xe7,0x3c,0xf7,0x9e,0x6b,0x6d,0x29,0x66,0x29,0x66,0x8c,0x71,0xf7,0x9e,0xde,0xfb,0x4b,0x6a,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3a,0xe8,0x8c,0xd1,0x53,0x6c,0x84,0x90,0xc6,0x58,0x3b,0x08,0xbe,0x57,0xad,0xf5,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xce,0x79,0xd6,0xda,0xd6,0xda,0xf7,0x9e,0xe7,0x5c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x74,0x6e,0x95,0x33,0x95,0x33,0x95,0x33,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x8c,0xd1,0xc6,0x38,0xe7,0x1c,0xd6,0xba,0x94,0xf2,0x53,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x84,0xd0,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x6c,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x6c,0x0d,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xad,0x95,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x3a,0xa9,0xe7,0x3c,0xf7,0x9e,0x6b,0x6d,0x29,0x65,0x29,0x66,0x8c,0x71,0xf7,0x9e,0xe7,0x1c,0x4b,0x49,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x2a,0x66,0x84,0x91,0x4b,0x2a,0x84,0xd1,0x7c,0x8f,0x3b,0x08,0x4b,0x49,0x4b,0x49,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xef,0x9d,0xff,0xdf,0xff,0xdf,0xff,0xff,0xd6,0xfa,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x74,0x6f,0x8c,0xf1,0x8d,0x11,0x74,0x4e,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x42,0xc9,0x63,0xcd,0x6b,0xed,0x4b,0x4a,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x19,0xe5,0x2a,0x46,0x8c,0xd1,0x8d,0x12,0x63,0x8c,0x9c,0xf3,0x84,0x50,0x53,0x4b,0x95,0x12,0x7c,0x70,0x22,0x06,0x2a,0x66,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3b,0x08,0x2a,0x66,0x42,0xea,0xad,0xb5,0x43,0x49,0xb6,0x17,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0x95,0x32,0x95,0x32,0x8d,0x11,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x3a,0xc7,0x84,0xb0,0x84,0xb1,0x3a,0xa9,0x7c,0x90,0x63,0xad,0x5b,0xac,0x8d,0x12,0x3a,0xe8,0x22,0x26,0x3a,0xe7,0x32,0xa7,0x19,0xe5,0x22,0x25,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xdf,0x95,0x32,0x74,0x6f,0xe7,0x3c,0xff,0xff,0xff,0xff,0x95,0x32,0x95,0x32,0xf7,0xbe,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xf7,0xbe,0xff,0xff,0xff,0xff,0xf7,0xde,0xa5,0x94,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x43,0x29,0xb5,0xd6,0xa5,0x54,0x84,0x90,0x7c,0x8f,0xc6,0x58,0xad,0xd6,0xb5,0xd6,0x4b,0x49,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x25,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xc5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0x63,0xcc,0x74,0x6f,0xf7,0xbe,0xff,0xff,0xc6,0x58,0x4b,0x6a,0xd6,0xda,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x17,0xef,0x9d,0xdf,0x1b,0xef,0x7d,0xef,0x5d,0x4b,0x69,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x53,0x84,0xd0,0xff,0xdf,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x32,0x87,0xbe,0x17,0xce,0xba,0x5b,0xab,0x9d,0x53,0x84,0xd0,0x8c,0xd1,0x95,0x53,0x7c,0x90,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0xbe,0x58,0x64,0x0d,0x84,0xf1,0xff,0xff,0xff,0xdf,0x6c,0x4e,0xc6,0x78,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xef,0x5d,0xff,0xdf,0xf7,0xbe,0xff,0xdf,0xd6,0xda,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x53,0x8a,0xbe,0x37,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x25,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x7c,0x70,0x7c,0x90,0x9d,0x33,0xce,0xb9,0x9d,0x53,0x8c,0xf1,0xbe,0x17,0x53,0x8b,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x43,0x29,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0xce,0xb9,0xde,0xfb,0x53,0x8b,0x95,0x32,0xc6,0x58,0x53,0xab,0xce,0xb9,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x74,0xa5,0x94,0xa5,0x94,0x95,0x33,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xef,0x7d,0x8c,0xd1,0x84,0xb0,0x84,0xb0,0x84,0xb0,0x84,0xb0,0x5b,0xab,0x4b,0x6a,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x43,0x08,0x4b,0x49,0x4b,0x4a,0x4b,0x49,0x43,0x08,0x3a,0xe8,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x7c,0x90,0x7c,0x0f,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x52,0xca,0x3a,0x27,0x3a,0x27,0x3a,0x27,0x3a,0xa8,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xf7,0xde,0x6c,0x2d,0xce,0xb9,0xff,0xff,0xde,0xfb,0x53,0xab,0x43,0x29,0x7c,0x8f,0xf7,0xbe,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xd6,0xda,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xf7,0x9e,0x95,0x53,0x95,0x32,0x95,0x32,0x95,0x32,0x95,0x32,0x95,0x32,0x95,0x53,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x19,0xe5,0x32,0x87,0x3b,0x08,0x22,0x46,0x19,0xe5,0x22,0x46,0x43,0x29,0xa5,0x74,0xdf,0x1b,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5c,0xe7,0x5c,0xe7,0x3c,0xe7,0x3c,0x9d,0x73,0x43,0x08,0x84,0xd1,0x5a,0xeb,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x3a,0x47,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xf7,0x9e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x5c,0xef,0x5d,0xef,0x9d,0xef,0x9d,0xe7,0x5c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x9d,0x53,0xe7,0x3c,0xef,0x7d,0xbe,0x17,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x63,0xcc,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xad,0xb5,0xe7,0x3c,0xe7,0x5c,0xb5,0xf6,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xc6,0x78,0xe7,0x3c,0xc6,0x58,0x64,0x0d,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3a,0xc8,0x3b,0x08,0x22,0x46,0x19,0xe5,0x22,0x46,0x43,0x08,0xb5,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0xad,0x95,0xbe,0x38,0x9d,0x54,0xe7,0x3c,0xbe,0x17,0xad,0xd6,0x94,0xd2,0xb5,0xf7,0xff,0xff,0xf7,0xbe,0x64,0x0d,0x84,0xd1,0x5a,0xeb,0x39,0xc7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x39,0xc7,0x32,0x27,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x74,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xef,0x7d,0xff,0xdf,0xf7,0xbe,0xd6,0xda,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xb5,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x5b,0xcc,0x3b,0x08,0x43,0x28,0x9d,0x53,0xf7,0xbe,0xff,0xff,0xff,0xdf,0xad,0xd5,0x4b,0x6a,0x3b,0x08,0x43,0x49,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x84,0xb0,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x6c,0x2e,0x3a,0xc7,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xa5,0xb4,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xc5,0x95,0x52,0xde,0xfa,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3b,0x08,0x4b,0x49,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x12,0xef,0x9d,0xd6,0xba,0x84,0xb0,0xa5,0x94,0x9d,0x13,0x8c,0xd2,0xf7,0x9e,0xa5,0x94,0xef,0x7d,0xff,0xff,0xd6,0xfb,0x8c,0xf1,0x5a,0xeb,0x29,0x65,0x41,0xe2,0x6b,0x23,0x6b,0x23,0x62,0xe2,0x10,0xa2,0x39,0xc7,0x32,0x47,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe7,0x19,0xe5,0x22,0x46,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xec,0x95,0x53,0x43,0x28,0x84,0xd0,0xde,0xfb,0xa5,0x94,0xb5,0xf6,0x7c,0x90,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xd6,0x3b,0x08,0x8c,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xd5,0x43,0x08,0x7c,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0xd0,0x43,0x49,0xd6,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x3b,0x08,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x63,0xec,0xd6,0xd9,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xc5,0x53,0x8a,0x6c,0x0d,0x22,0x05,0x19,0xe5,0x3a,0xe8,0x3b,0x08,0x4b,0x69,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x2f,0xc6,0x58,0x8c,0xd1,0x9d,0x73,0xad,0x95,0x84,0x71,0x95,0x12,0xf7,0x9e,0x9d,0x74,0xef,0x7d,0xff,0xff,0xe7,0x3c,0x8c,0xf1,0x5a,0xcb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x3a,0x87,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x3a,0xe7,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x2a,0x87,0x4b,0x49,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xad,0xb4,0x43,0x29,0x95,0x33,0xe7,0x3c,0xe7,0x5c,0xe7,0x5c,0xd6,0xba,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x78,0x43,0x28,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x4b,0x6a,0x9d,0x73,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb5,0x5b,0xcc,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x43,0x28,0xb6,0x16,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x13,0xad,0xd5,0xa5,0x74,0xad,0xb5,0xe7,0x1c,0x7c,0x4f,0xad,0xd5,0xad,0xb5,0x9d,0x74,0xff,0xdf,0xf7,0xde,0x7c,0x8f,0x43,0x29,0x39,0xe7,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x3a,0x67,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x32,0x87,0x6c,0x2d,0x84,0xb0,0x22,0x05,0x22,0x05,0x3a,0xe8,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xe7,0x3c,0xb6,0x16,0xb6,0x16,0xa5,0xb5,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xff,0xdf,0xdf,0x1b,0xd6,0xda,0xef,0x7d,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xff,0xdf,0xe7,0x3c,0xe7,0x1c,0xf7,0xbe,0xff,0xff,0xad,0xd6,0x63,0xec,0xf7,0xbe,0xff,0xff,0xf7,0x9e,0xe7,0x3c,0xef,0x9d,0xff,0xff,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x46,0x2a,0x46,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xbe,0x17,0xef,0x9d,0xf7,0xbe,0xf7,0xbe,0xef,0x7d,0xf7,0x9e,0xf7,0x9e,0xf7,0xbe,0xef,0x7d,0xf7,0x9e,0xef,0x7d,0xf7,0xbe,0xf7,0xbe,0xb5,0xf6,0x43,0x28,0x3a,0xc7,0x39,0xc7,0x29,0x65,0x83,0xc3,0xf7,0x04,0xf7,0x04,0xe6,0x84,0x10,0xa2,0x39,0xc7,0x32,0x27,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x63,0xec,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x19,0xe5,0x2a,0x46,0x95,0x52,0x8c,0xf1,0x2a,0x86,0x19,0xe5,0x22,0x05,0x74,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xba,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0xc6,0x78,0xbe,0x17,0xb5,0xf6,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5d,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x32,0xa7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xc6,0x58,0xad,0xd6,0xc6,0x38,0x7c,0xb0,0xf7,0xde,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xce,0x99,0xad,0xd5,0xbe,0x37,0xf7,0xbe,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xad,0xd5,0xb5,0xf6,0xbe,0x37,0xa5,0x74,0xff,0xff,0xad,0xd6,0x63,0xec,0xf7,0xbe,0xe7,0x3c,0x9d,0x53,0xbe,0x17,0x95,0x12,0xdf,0x1b,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x22,0x26,0x3a,0xc8,0x53,0x8b,0x53,0xab,0x4b,0x2a,0x3a,0xa8,0x43,0x09,0x53,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x5b,0xab,0x4b,0x49,0x3b,0x08,0x3a,0xc7,0x39,0xe7,0x29,0x65,0x21,0x02,0x31,0x82,0x31,0x82,0x31,0x82,0x18,0xc3,0x39,0xc7,0x32,0x47,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x9d,0x52,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0xb5,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xdf,0x1b,0xff,0xdf,0xff,0xff,0xff,0xff,0xd6,0xda,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1b,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xbe,0x37,0xce,0x99,0xce,0x79,0x95,0x32,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xf7,0xbe,0x9d,0x53,0xd6,0xda,0xc6,0x58,0xbe,0x38,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0x9d,0x73,0xbe,0x38,0xd6,0xba,0x9d,0x53,0xff,0xff,0xad,0xd6,0x63,0xec,0xf7,0xbe,0xce,0x79,0xd6,0xba,0xc6,0x38,0xce,0xb9,0xce,0x99,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x22,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0x42,0x28,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x53,0x0a,0x43,0x28,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x43,0x28,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x8c,0xd1,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xc6,0x58,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xf7,0x9e,0xce,0x79,0xef,0x5d,0xdf,0x1b,0xe7,0x5c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x95,0x53,0xce,0x79,0xde,0xfb,0xc6,0x58,0x8c,0xf1,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xdf,0x1b,0x9d,0x94,0xde,0xfb,0xc6,0x79,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xf7,0x9e,0x8c,0xf1,0x8d,0x12,0xce,0xb9,0xbe,0x37,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xc6,0x99,0x9d,0x94,0xde,0xfb,0xd6,0xba,0xff,0xff,0xad,0xd6,0x63,0xec,0xf7,0xbe,0xf7,0x9e,0x9d,0x74,0xbe,0x17,0xc6,0x99,0xf7,0xbe,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x06,0x3a,0xe8,0x43,0x29,0x32,0xc7,0x22,0x06,0x2a,0x46,0x43,0x28,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x28,0x3b,0x08,0x84,0xd0,0x5a,0xeb,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x94,0xd2,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x25,0x43,0x08,0x6c,0x2e,0x84,0xd0,0x7c,0xb0,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0x64,0x0d,0x63,0xed,0x6c,0x2e,0x74,0x4e,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3a,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xd6,0xda,0x95,0x33,0x9d,0x33,0x8c,0xf2,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xc6,0x79,0xce,0x99,0xe7,0x3c,0xf7,0xbe,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xbe,0x17,0x7c,0x90,0x94,0xf2,0x94,0xf2,0xff,0xff,0xad,0xd6,0x63,0xec,0xf7,0xbe,0xe7,0x3c,0x8c,0xf1,0x84,0xb0,0x84,0xd0,0xd6,0xfa,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x9d,0x53,0xe7,0x3c,0xf7,0x9e,0xef,0x9d,0xef,0x7d,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xef,0x7d,0xef,0x9d,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xce,0xb9,0x4b,0x49,0x84,0xd1,0x5a,0xeb,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xc5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x3a,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xff,0xff,0xde,0xfb,0xc6,0x78,0x9d,0x53,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xf7,0xde,0xa5,0x94,0x7c,0x6f,0x95,0x33,0xbe,0x17,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xff,0xff,0xbe,0x57,0xc6,0x99,0xa5,0x74,0xff,0xff,0xad,0xd6,0x63,0xec,0xf7,0xbe,0xff,0xff,0xff,0xff,0x9d,0x53,0xc6,0x78,0xce,0x99,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x8c,0xf1,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x9d,0x53,0xa5,0xb5,0xd6,0xba,0xdf,0x1b,0xd6,0xda,0xde,0xfb,0xff,0xff,0x95,0x33,0x7c,0x70,0x5a,0xeb,0x31,0x86,0x29,0x43,0x29,0x63,0x29,0x63,0x21,0x23,0x21,0x04,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x1a,0x05,0x3a,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x32,0xc7,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xff,0xff,0xff,0xdf,0xb5,0xd6,0xbe,0x17,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xff,0xff,0x9d,0x53,0xb5,0xf6,0xc6,0x78,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xff,0xff,0xef,0x7d,0xad,0xb5,0xbe,0x37,0xff,0xff,0xad,0xb5,0x53,0x8b,0xf7,0xbe,0xff,0xff,0xff,0xff,0xad,0xb5,0x9d,0x53,0xef,0x9d,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x66,0x22,0x46,0x22,0x25,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x84,0xd1,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x33,0xb5,0xf6,0xef,0x5d,0xa5,0xb5,0xa5,0x94,0xef,0x7d,0xff,0xff,0xf7,0xbe,0x9d,0x34,0x5a,0xeb,0x29,0x65,0x7b,0x83,0xd6,0x03,0xd6,0x03,0xb5,0x43,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x7c,0x90,0x5b,0xab,0x95,0x32,0x4b,0x49,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x22,0x26,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x32,0xc7,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xe7,0x1c,0xf7,0xbe,0xff,0xff,0xd6,0xda,0xff,0xdf,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xff,0xff,0xdf,0x3c,0xc6,0x78,0xf7,0xbe,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xd6,0xfa,0xff,0xdf,0xff,0xff,0xe7,0x1c,0xff,0xff,0xa5,0x75,0x42,0xea,0xf7,0xbe,0xef,0x7d,0xef,0x9d,0xff,0xff,0xef,0x7d,0xef,0x7d,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x25,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xde,0xce,0x99,0xa5,0x74,0xff,0xdf,0xef,0x7d,0xff,0xff,0xff,0xff,0xe7,0x3c,0x94,0xf2,0xff,0xdf,0x9d,0x33,0xa5,0x94,0xff,0xff,0xff,0xff,0xff,0xdf,0xb5,0xf6,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xb5,0xf6,0xa5,0x94,0xbe,0x37,0x53,0x8a,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x22,0x46,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x22,0x05,0x3a,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x3a,0xc7,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xad,0xd5,0x84,0xd0,0x8c,0xf1,0x64,0x0d,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xf7,0xbe,0xbe,0x37,0xef,0x7d,0xdf,0x1b,0xd6,0xba,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0x8d,0x12,0xa5,0x74,0xa5,0x74,0x84,0xb0,0xff,0xff,0xad,0xb5,0x5b,0xcc,0xf7,0xbe,0xd6,0x9a,0x94,0xd2,0xad,0xb5,0x95,0x12,0xc6,0x98,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xc5,0x3a,0xc8,0x74,0x6f,0x32,0x87,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xff,0xb6,0x16,0xa5,0x95,0xd6,0xba,0xef,0x7d,0xa5,0x74,0xff,0xff,0xde,0xfb,0xb5,0xd6,0xad,0xd5,0xff,0xff,0xad,0xb5,0xbe,0x58,0xff,0xff,0xff,0xff,0xb5,0xf6,0x84,0xd1,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xb5,0xf6,0xad,0xb5,0x8d,0x12,0x8c,0xf1,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x42,0xe8,0x95,0x32,0x43,0x09,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0x3a,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xdf,0x1b,0xef,0x7d,0xff,0xdf,0xde,0xfb,0xff,0xdf,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xf7,0x9e,0x74,0x4e,0x9d,0x73,0x95,0x12,0xbe,0x37,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xce,0x99,0xf7,0xbe,0xff,0xdf,0xd6,0xba,0xff,0xff,0xc6,0x58,0xe7,0x3c,0xff,0xff,0xe7,0x3c,0xe7,0x1c,0xf7,0xde,0xdf,0x3c,0xdf,0x3c,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x63,0xec,0xf7,0xbd,0x43,0x09,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xa5,0xb5,0xf7,0x9e,0xff,0xdf,0xf7,0xbe,0xf7,0xbe,0xff,0xdf,0xff,0xdf,0xf7,0xbe,0xff,0xdf,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xff,0xdf,0xf7,0xbe,0xf7,0xbe,0xff,0xdf,0xdf,0x1b,0x4b,0x6a,0x7c,0x90,0x5a,0xeb,0x29,0x65,0x52,0x82,0x94,0x43,0x94,0x43,0x8c,0x03,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0x94,0x7c,0x6f,0x84,0xb0,0xbe,0x17,0x64,0x0d,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x25,0x19,0xe5,0x43,0x09,0x95,0x32,0x43,0x29,0x19,0xe5,0x2a,0x46,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x26,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xe7,0x5c,0x9d,0x53,0x8d,0x12,0xb5,0xf6,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xef,0x7d,0xff,0xdf,0xf7,0xde,0xf7,0xbe,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xd6,0xfa,0x95,0x53,0x95,0x32,0xce,0x99,0xff,0xff,0xad,0xd6,0x84,0xb0,0xf7,0xbe,0xff,0xdf,0xb5,0xf6,0x9d,0x53,0xb6,0x16,0xff,0xdf,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x2a,0x66,0x43,0x28,0x22,0x26,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x32,0xc7,0x43,0x08,0x22,0x26,0x2a,0x66,0x43,0x28,0x32,0xc7,0x2a,0x87,0x32,0xa7,0x43,0x08,0x43,0x28,0x3a,0xc8,0x1a,0x05,0x32,0xa7,0x43,0x08,0x2a,0x46,0x74,0x2f,0x5a,0xeb,0x31,0xa6,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3a,0x27,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x39,0xe7,0x29,0xe6,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xbe,0x37,0xe7,0x3c,0xff,0xff,0x9d,0x73,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xdf,0x9d,0x53,0xa5,0x74,0x95,0x12,0xdf,0x1b,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0x9d,0x53,0xef,0x7d,0xf7,0xbe,0x95,0x12,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xce,0x79,0xc6,0x58,0xf7,0x9e,0xbe,0x37,0xc6,0x78,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x22,0x26,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x22,0x46,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x1a,0x05,0x2a,0x46,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x74,0x2f,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x53,0x8b,0x42,0x48,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x31,0xe6,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x22,0x05,0x19,0xe5,0x22,0x05,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x5b,0xcc,0x8c,0xf1,0x7c,0x8f,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x74,0x4e,0x95,0x12,0x64,0x0d,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x4b,0x6a,0x53,0x8a,0x43,0x28,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xce,0x99,0x9d,0x53,0xad,0xd6,0x8c,0xf1,0xff,0xdf,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xef,0x7d,0xa5,0x94,0xff,0xdf,0xdf,0x1b,0xbe,0x37,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xb5,0xf6,0xad,0xb5,0xb5,0xf6,0x9d,0x53,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xdf,0x1c,0x9d,0x53,0xc6,0x58,0x9d,0x53,0xd6,0xfa,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x05,0x22,0x26,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x32,0xc7,0x32,0x87,0x19,0xe5,0x32,0xc7,0x43,0x49,0x53,0x8a,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x53,0x6a,0x3a,0xc9,0x3a,0xa8,0x3a,0xa8,0x42,0xe9,0x53,0xab,0x4b,0x2a,0x3a,0xa8,0x4b,0x4a,0x4b,0x6a,0x3a,0xa8,0x4b,0x6a,0x3a,0xc8,0x19,0xe5,0x74,0x2f,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x65,0x39,0xc7,0x31,0xe6,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x90,0xef,0x7d,0xff,0xff,0xff,0xff,0xdf,0x1b,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0xb5,0xd6,0xff,0xdf,0xff,0xff,0xff,0xdf,0xbe,0x17,0x43,0x29,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x46,0x22,0x05,0x22,0x05,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x22,0x06,0x95,0x13,0xdf,0x1b,0xef,0x5d,0xbe,0x37,0x53,0x8b,0x3b,0x08,0x84,0xd0,0xff,0xff,0xef,0x9d,0xad,0xd6,0xa5,0x94,0xd6,0xba,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xdf,0x95,0x33,0x95,0x32,0x95,0x32,0xdf,0x1b,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xde,0xfb,0xde,0xfb,0xdf,0x1b,0xdf,0x1b,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xf7,0xbe,0xde,0xfb,0xdf,0x1b,0xdf,0x1b,0xef,0x9e,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x32,0xc7,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x05,0x22,0x26,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x32,0xc7,0x32,0x87,0x19,0xe5,0x74,0x4f,0xd6,0xda,0xef,0x5d,0xce,0xb9,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x32,0x67,0xad,0xd6,0xef,0x5d,0xf7,0x9e,0xef,0x9d,0xef,0x7d,0xef,0x7d,0xf7,0x9d,0xf7,0x9d,0xf7,0x9e,0xf7,0x9e,0xef,0x7d,0xf7,0x9e,0xf7,0x9e,0xa5,0x95,0x19,0xe5,0x74,0x2f,0x5a,0xeb,0x39,0xc7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x4a,0x02,0x94,0x43,0x94,0x43,0x8c,0x03,0x21,0x02,0x39,0xc7,0x31,0xe6,0x3a,0xe7,0x32,0x87,0x84,0x91,0xce,0x99,0xce,0xb9,0xc6,0x79,0xce,0x99,0xce,0xb9,0xce,0xb9,0xce,0xb9,0xce,0xb9,0xce,0xb9,0xce,0xb9,0xce,0xb9,0xbe,0x37,0x74,0x4e,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb6,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0x22,0x26,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x74,0x2f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x78,0x43,0x28,0x84,0xd0,0xff,0xff,0xbe,0x17,0x95,0x12,0xad,0xd5,0x95,0x32,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xff,0xff,0xf7,0xbe,0xce,0x99,0xff,0xdf,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0x8d,0x12,0x9d,0x53,0xf7,0x9e,0x9d,0x53,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xd6,0xba,0xd6,0xda,0xb6,0x16,0xad,0xd5,0xc6,0x98,0xef,0x7d,0x4b,0x49,0x19,0xe5,0x2a,0x66,0x3a,0xc7,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x22,0x05,0x22,0x26,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x32,0xc7,0x32,0x87,0x4b,0x0a,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0xb5,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0x94,0xf2,0x8c,0xd2,0xbd,0xf7,0x95,0x32,0x95,0x33,0xc6,0x38,0xff,0xff,0x95,0x12,0xde,0xfb,0xff,0xff,0xff,0xdf,0x63,0xad,0x74,0x2f,0x5a,0xeb,0x29,0x65,0x31,0xa2,0x5a,0x82,0x5a,0x82,0x52,0x62,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x31,0xe6,0x3a,0xe7,0x63,0xcd,0xf7,0x9e,0xff,0xff,0xc6,0x58,0x9d,0x54,0xce,0x79,0xbe,0x58,0xf7,0xbe,0xce,0x99,0xbe,0x37,0xa5,0x94,0xde,0xfb,0xff,0xff,0xff,0xff,0xf7,0xde,0x84,0xb0,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x4b,0x6a,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfa,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x32,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x4b,0x0a,0xb5,0xd5,0x7c,0x6e,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x63,0xed,0x5b,0xab,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0xc6,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x53,0x6a,0x84,0xd0,0xff,0xff,0xc6,0x78,0x9d,0x53,0x7c,0x6f,0x8c,0xd1,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xdf,0xce,0x99,0xce,0x79,0x95,0x32,0xc6,0x78,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0x9d,0x94,0xd6,0xba,0x9d,0x53,0x95,0x13,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xdf,0x1b,0x8d,0x12,0x84,0xb0,0x9d,0x53,0xce,0xba,0xef,0x7d,0x4b,0x4a,0x19,0xe5,0x22,0x46,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x22,0x05,0x22,0x26,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x2a,0x47,0x42,0xea,0x2a,0x26,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x32,0x87,0x8c,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0xb2,0xb5,0xd6,0xef,0x5d,0x95,0x33,0xef,0x7d,0x94,0xf2,0xef,0x7d,0x8c,0xf2,0xad,0x95,0xff,0xff,0xff,0xff,0xe7,0x3c,0x84,0x91,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xa4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x31,0xe6,0x43,0x29,0xd6,0xda,0xff,0xff,0xef,0x7d,0x95,0x32,0xce,0x79,0x94,0xf2,0x84,0xb1,0xce,0x99,0x9d,0x53,0x9d,0x33,0xe7,0x3c,0x8d,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0x19,0xe5,0x2a,0x66,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xc7,0xa5,0x94,0xef,0x9d,0xf7,0xbe,0xd6,0xda,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0xf7,0xbe,0xe7,0x3c,0xff,0xff,0xff,0xff,0xef,0x7d,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x95,0x12,0xc6,0x58,0xa5,0x94,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x53,0xff,0xdf,0xef,0x7d,0xff,0xff,0xff,0xdf,0xf7,0xbe,0x8d,0x32,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x4a,0xc6,0x38,0xf7,0xbe,0xff,0xff,0xce,0x99,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x6c,0x0d,0xdf,0x1b,0xf7,0xbe,0xf7,0xbe,0xad,0xd6,0x2a,0x26,0x32,0xa7,0x32,0xa7,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0xcc,0x84,0xd0,0xff,0xdf,0xf7,0xbe,0xe7,0x5c,0xe7,0x3c,0xf7,0xbe,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xdf,0xd6,0xda,0xd6,0xda,0xd6,0xda,0xef,0x7d,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xef,0x9d,0xff,0xff,0xf7,0x9e,0xf7,0xbe,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0x9e,0xff,0xff,0xef,0x7d,0xf7,0xbe,0xff,0xdf,0xff,0xff,0xef,0x7d,0x4b,0x6a,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x22,0x05,0x22,0x26,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x53,0x4b,0xde,0xfb,0xf7,0xbe,0xef,0x7d,0x8c,0xd2,0x19,0xe5,0x32,0xc7,0x32,0x87,0x95,0x13,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0xce,0x79,0x9d,0x13,0x95,0x53,0xf7,0xbe,0x8c,0xb1,0xb5,0xf6,0x8c,0xd2,0x73,0xee,0xff,0xff,0xff,0xff,0xe7,0x3c,0x7c,0x50,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x5b,0xcc,0x4a,0x69,0x31,0x86,0x6b,0x23,0xee,0xc4,0xee,0xc4,0xe6,0xa4,0x31,0x62,0x39,0xc7,0x31,0xe6,0x53,0x8b,0xf7,0xbe,0xff,0xff,0xe7,0x3c,0xa5,0x94,0xd6,0xdb,0x94,0xf2,0xad,0xb6,0x9d,0x73,0x95,0x32,0xb5,0xf6,0xce,0xb9,0x95,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x2a,0x66,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x8d,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0xef,0x7d,0x9d,0x73,0xe7,0x5c,0xad,0xd5,0xb5,0xf6,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x95,0x53,0xd6,0xfa,0xbe,0x58,0xbe,0x37,0xbe,0x37,0xd6,0xda,0x8d,0x32,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0xb5,0x22,0x26,0x19,0xe5,0x3a,0xc8,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0xb1,0x32,0xa7,0x32,0xa7,0xd6,0xba,0xbe,0x17,0xef,0x9d,0xe7,0x5c,0xce,0x99,0xf7,0xbe,0x5b,0xcc,0x84,0xd0,0xef,0x9d,0x95,0x33,0xb5,0xf6,0xef,0x5d,0xff,0xff,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xe7,0x3c,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x53,0x8a,0x9d,0x73,0xe7,0x3c,0x9d,0x53,0xc6,0x58,0xf7,0xbe,0xff,0xff,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0x9e,0xad,0xb6,0xad,0xd6,0xef,0x7d,0xff,0xff,0xff,0xff,0xef,0x7d,0x4b,0x6a,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x1a,0x05,0x19,0xe5,0x22,0x46,0x43,0x28,0x22,0x05,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x2a,0x47,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x63,0xcd,0x32,0xc7,0x32,0x87,0x95,0x13,0xd6,0xda,0xdf,0x1b,0xe7,0x5c,0xe7,0x1c,0xdf,0x1b,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0xbd,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0x75,0xa5,0x54,0xbd,0xf7,0x9d,0x74,0x9d,0x34,0xc6,0x38,0xad,0xd5,0xff,0xdf,0xad,0xb5,0xef,0x7d,0xff,0xdf,0x5b,0x6c,0x74,0x2f,0x5a,0xeb,0x29,0x65,0x8b,0xe3,0xff,0x24,0xff,0x24,0xe6,0xa4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x39,0xe7,0x31,0x86,0x10,0xa2,0x10,0xa2,0x10,0xa2,0x10,0xa2,0x18,0xc3,0x39,0xc7,0x31,0xe6,0x3a,0xe7,0xa5,0x74,0xff,0xff,0xff,0xdf,0x84,0xb0,0x9d,0x33,0x9d,0x33,0xbe,0x17,0xc6,0x78,0x95,0x32,0xa5,0x94,0xb5,0xf6,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0xef,0x9d,0x95,0x32,0x9d,0x53,0xa5,0x94,0x9d,0x53,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xd5,0x3b,0x08,0x3b,0x08,0x95,0x53,0xe7,0x5c,0x95,0x12,0x95,0x12,0x8c,0xf1,0xd6,0xda,0x8d,0x32,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x3a,0xe8,0x22,0x26,0x43,0x0a,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x38,0x32,0xa7,0x32,0xa7,0xd6,0xba,0xa5,0x94,0xd6,0xba,0x8c,0xf1,0x84,0xb0,0xf7,0x9e,0x5b,0xcc,0x84,0xd0,0xff,0xff,0xff,0xff,0xef,0x7d,0xad,0xd5,0x9d,0x73,0xe7,0x3c,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xce,0xb9,0xad,0xb5,0xb5,0xf6,0xe7,0x5c,0xff,0xdf,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xff,0xff,0xd6,0xda,0xa5,0x94,0xa5,0x94,0xf7,0x9e,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xff,0xff,0xef,0x5d,0xa5,0x94,0xa5,0x94,0xde,0xfb,0xef,0x5d,0x4b,0x6a,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x53,0x8b,0xd6,0xd9,0x43,0x08,0x19,0xe5,0x32,0xc7,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x63,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb6,0x32,0xc7,0x32,0x87,0x95,0x13,0xc6,0x78,0xc6,0x58,0x95,0x12,0x84,0x90,0xd6,0xda,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x26,0xb5,0xf6,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x9d,0xef,0x7d,0xef,0x7d,0xef,0x9d,0xef,0x9d,0xef,0x7d,0xef,0x9d,0xa5,0x95,0x21,0xe5,0x74,0x2f,0x5a,0xeb,0x29,0x65,0x31,0x82,0x52,0x63,0x52,0x63,0x4a,0x43,0x18,0xc3,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xe6,0x3a,0xe7,0x3a,0xc8,0xce,0x9a,0xff,0xff,0xff,0xdf,0xe7,0x5d,0xf7,0x9e,0xf7,0xbe,0xff,0xdf,0xf7,0x9e,0xf7,0xbe,0xe7,0x5c,0xff,0xdf,0xff,0xff,0xff,0xdf,0xd6,0xda,0x53,0x6a,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xff,0xff,0xf7,0xbe,0xf7,0x9e,0xff,0xdf,0xff,0xff,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x5b,0xcb,0xf7,0xbe,0xff,0xdf,0xef,0x9d,0xff,0xff,0xff,0xdf,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x95,0x53,0xff,0xff,0xf7,0x9e,0xf7,0xbe,0xff,0xff,0xff,0xdf,0x8d,0x32,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xdf,0xff,0xdf,0xf7,0x9e,0x32,0xa7,0x3a,0xe8,0x53,0x8b,0xff,0xdf,0xf7,0x9e,0xff,0xff,0xf7,0xbe,0xff,0xff,0xc6,0x58,0x32,0xa7,0x32,0xa7,0xd6,0xba,0xe7,0x5c,0xa5,0xb5,0xd6,0xfa,0xce,0x99,0xff,0xdf,0x5b,0xcc,0x84,0xd0,0xff,0xff,0xff,0xff,0xf7,0xbe,0xef,0x9d,0xf7,0xbe,0xef,0x7d,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xff,0xff,0xe7,0x3c,0xb6,0x17,0xad,0xd6,0xff,0xdf,0x53,0x8a,0x9d,0x73,0xff,0xff,0xff,0xff,0xf7,0xbe,0xf7,0xbe,0xef,0x7d,0xe7,0x3c,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xff,0xff,0xff,0xdf,0xf7,0xbe,0xf7,0xbe,0xd6,0xfa,0xef,0x5d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x4b,0x4a,0xad,0xd5,0x3a,0xc8,0x22,0x46,0x84,0xf1,0x95,0x32,0x22,0x26,0x19,0xe5,0x6b,0xee,0xff,0xff,0xff,0xdf,0xf7,0x9e,0xf7,0xbe,0xff,0xff,0xbd,0xf7,0x3a,0xc7,0x32,0x87,0x95,0x13,0xf7,0xbe,0xad,0xd5,0xc6,0x99,0xd6,0xda,0xef,0x7d,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xc5,0x32,0xa7,0x4b,0x49,0x3a,0x88,0x32,0x68,0x32,0x68,0x3a,0x88,0x4b,0x4a,0x3a,0xc8,0x32,0x88,0x4b,0x6a,0x4b,0x29,0x32,0x68,0x43,0x09,0x32,0xa7,0x19,0xc5,0x74,0x2f,0x5a,0xeb,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x31,0xe6,0x3a,0xe7,0x2a,0x66,0x3a,0xc9,0x63,0xed,0x6c,0x2e,0x5b,0x6c,0x63,0xed,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x6c,0x4e,0x5b,0xac,0x5b,0x8c,0x63,0xed,0x4b,0x49,0x22,0x05,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xce,0x99,0x9d,0x74,0x9d,0x74,0x9d,0x74,0xff,0xdf,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x5b,0xab,0xf7,0x9e,0xad,0xb5,0xf7,0xbe,0xff,0xff,0xff,0xff,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xce,0x99,0xbe,0x17,0xb5,0xf6,0xef,0x7d,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x95,0x53,0xe7,0x5c,0xad,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x32,0x3b,0x08,0x3a,0xe7,0x19,0xe5,0x22,0x26,0x3b,0x08,0x22,0x26,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0xff,0xdf,0xa5,0x94,0xde,0xfb,0x9d,0x53,0xa5,0x94,0xef,0x9d,0x19,0xe5,0x32,0xa7,0x64,0x0d,0xf7,0xbe,0x8c,0xb1,0xdf,0x1b,0x8c,0xd2,0xb5,0xf6,0xc6,0x58,0x32,0xa7,0x32,0xa7,0xd6,0xba,0xe7,0x5c,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0xcc,0x84,0xd0,0xff,0xff,0xd6,0xba,0x95,0x32,0x9d,0x53,0x9d,0x53,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xff,0xef,0x7d,0xce,0xda,0xdf,0x1b,0xf7,0xbe,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xc6,0x58,0x9d,0x53,0x95,0x53,0xad,0xd5,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xef,0x9d,0x8d,0x12,0x95,0x53,0x95,0x53,0xef,0x5d,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x1a,0x05,0x22,0x26,0x19,0xe5,0x22,0x05,0x5b,0xcc,0x63,0xec,0x22,0x05,0x19,0xe5,0x6b,0xee,0xf7,0xbe,0x94,0xf2,0xa5,0x34,0x84,0x70,0xd6,0xba,0xbd,0xf7,0x3a,0xc7,0x32,0x87,0x95,0x13,0xf7,0x9e,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xc5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xc5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x74,0x2f,0x5a,0xeb,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x64,0x0d,0x4a,0x89,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x73,0xce,0x4b,0x49,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x2a,0x66,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xa5,0xb4,0xde,0xfb,0xde,0xfb,0xad,0xb5,0xf7,0xbe,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3b,0x08,0x22,0x46,0x19,0xe5,0x43,0x0a,0xf7,0x9e,0xd6,0xda,0xff,0xdf,0xff,0xff,0xff,0xff,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x7d,0xad,0xb5,0xce,0x99,0xce,0x99,0xbe,0x37,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x95,0x53,0xf7,0xbe,0xd6,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x32,0x3b,0x08,0x32,0x87,0x19,0xe5,0x43,0x08,0xc6,0x78,0x5b,0x8b,0x19,0xc5,0x2a,0x87,0x3b,0x08,0x3b,0x08,0xf7,0xbe,0xad,0x95,0xce,0xb9,0xc6,0x79,0xa5,0x74,0xef,0x7d,0x22,0x05,0x19,0xe5,0x5b,0xac,0xef,0x7d,0xad,0xb5,0x9d,0x54,0xd6,0xdb,0xa5,0x75,0xc6,0x58,0x32,0xa7,0x32,0xa7,0xd6,0xba,0xb6,0x16,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0xcc,0x84,0xd0,0xff,0xff,0xbe,0x17,0xe7,0x3c,0xff,0xff,0x9d,0x53,0xf7,0x9e,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xf7,0xbe,0x95,0x32,0xb6,0x17,0xa5,0x74,0xc6,0x58,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0x9d,0x53,0xf7,0xbe,0xff,0xff,0x9d,0x13,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xce,0x99,0xce,0x99,0xff,0xff,0xc6,0x79,0xc6,0x78,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x22,0x05,0x19,0xe5,0x19,0xe5,0x6b,0xee,0xe7,0x5d,0x95,0x33,0xc6,0x38,0xde,0xdb,0xbd,0xf7,0xbd,0xf7,0x3a,0xc7,0x32,0x87,0x95,0x13,0xd6,0xfa,0xad,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x43,0x09,0x8c,0xf1,0x9d,0x13,0x95,0x13,0x95,0x13,0x9d,0x13,0xa5,0x74,0x9d,0x33,0x95,0x13,0xa5,0x74,0x9d,0x54,0x95,0x13,0x9d,0x54,0x84,0xb1,0x22,0x05,0x74,0x2f,0x5a,0xeb,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x2a,0x47,0x63,0xcd,0x6c,0x2e,0x5b,0x6c,0x63,0xcd,0x6c,0x2e,0x6c,0x2e,0x6c,0x2e,0x6c,0x2e,0x63,0xac,0x5b,0x8c,0x6c,0x2e,0x63,0xac,0x5b,0x6c,0x63,0xcd,0x6c,0x0d,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xc6,0x58,0x95,0x12,0xce,0x99,0xb6,0x16,0xff,0xdf,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3a,0xe8,0x22,0x46,0x3a,0xc9,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x9d,0x7c,0xb0,0x7c,0xb0,0xce,0x99,0xc6,0x58,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x95,0x53,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x32,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x3a,0xe8,0xad,0xf5,0x53,0x8a,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0xff,0xdf,0xb5,0xf6,0x9d,0x73,0xde,0xfb,0xc6,0x78,0xf7,0x9e,0x3a,0xc7,0x1a,0x05,0x4b,0x2b,0xff,0xdf,0xb5,0xf6,0xd6,0xb9,0xde,0xfb,0xd6,0xba,0xc6,0x58,0x32,0xa7,0x32,0xa7,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0xcc,0x84,0xd0,0xff,0xff,0xd6,0xfa,0xd6,0xda,0xff,0xff,0xad,0xd5,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xf7,0x9e,0x9d,0x53,0xff,0xff,0xd6,0xba,0xbe,0x37,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xc6,0x58,0xe7,0x3c,0xf7,0x9e,0xbe,0x37,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xef,0x7d,0xbe,0x37,0xff,0xff,0xb6,0x16,0xe7,0x3c,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x6b,0xee,0xf7,0xbe,0x8c,0xb1,0x8c,0xd2,0xce,0x79,0xdf,0x1b,0xbd,0xf7,0x3a,0xc7,0x32,0x87,0x95,0x13,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x47,0xc6,0x58,0xff,0xff,0xff,0xff,0xf7,0xbe,0xce,0x79,0xde,0xdb,0xff,0xff,0xd6,0xda,0xce,0x79,0xff,0xdf,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xdf,0x63,0xcd,0x74,0x2f,0x5a,0xeb,0x31,0x86,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x6b,0x23,0xee,0xc4,0xee,0xc4,0xe6,0x84,0x29,0x62,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x32,0xa7,0xbe,0x38,0xff,0xdf,0xf7,0xbe,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xf7,0xbe,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xf7,0xbe,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xdf,0x3c,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xce,0x99,0xa5,0x74,0xa5,0x74,0x8c,0xd1,0xf7,0xbe,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x3a,0xe8,0x4b,0x2a,0xef,0x7d,0x95,0x13,0xef,0x9d,0xe7,0x5c,0xc6,0x58,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0x9e,0xad,0xb5,0xad,0xb5,0xb5,0xf6,0xde,0xfb,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x95,0x53,0xdf,0x3c,0xc6,0x58,0xe7,0x3c,0xe7,0x3c,0xdf,0x1b,0x8d,0x32,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0xff,0xdf,0xc6,0x78,0x8d,0x11,0x8c,0xf1,0xd6,0xda,0xf7,0x9e,0x3b,0x08,0x32,0xc7,0x53,0x4b,0xef,0x7d,0x9d,0x13,0xce,0x79,0x94,0xf2,0xad,0x95,0xc6,0x78,0x43,0x09,0x4b,0x49,0xd6,0xba,0xde,0xfb,0xf7,0xbe,0xff,0xff,0xe7,0x3c,0xff,0xdf,0x5b,0xcc,0x84,0xd0,0xff,0xff,0xd6,0xba,0xa5,0x54,0x8c,0xd1,0xad,0x95,0xff,0xdf,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xdf,0xd6,0xba,0xff,0xdf,0xdf,0x1b,0xf7,0x9e,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xbe,0x17,0x8c,0xf2,0x8c,0xf1,0xad,0x95,0xff,0xff,0xad,0xd5,0x63,0xec,0xf7,0xbe,0xe7,0x3c,0x9d,0x33,0x8c,0xf1,0x95,0x13,0xe7,0x3c,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x25,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x22,0x05,0x22,0x25,0x3a,0xa7,0x32,0xc7,0x19,0xe5,0x6b,0xee,0xf7,0xbe,0x9d,0x14,0x9d,0x14,0x8c,0x91,0xc6,0x59,0xbe,0x17,0x6c,0x2d,0x5b,0xcc,0x9d,0x54,0xe7,0x3c,0xe7,0x3c,0xff,0xff,0xef,0x7d,0xef,0x7d,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x74,0x2f,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xb5,0xb6,0xc6,0x38,0xd6,0xdb,0xa5,0x54,0xb5,0xf6,0xe7,0x1c,0x9d,0x54,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x8c,0xb1,0x5a,0xeb,0x29,0x65,0x73,0x43,0xd6,0x24,0xd6,0x24,0xc5,0x83,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x84,0xb0,0xff,0xdf,0xff,0xff,0xf7,0x9d,0x53,0x6b,0xff,0xdf,0xc6,0x78,0x95,0x33,0xb5,0xf6,0xff,0xff,0xb5,0xd6,0xa5,0x74,0xe7,0x3c,0x74,0x2f,0x9d,0x33,0xf7,0xbe,0xff,0xff,0xff,0xff,0xe7,0x3c,0x4b,0x6a,0x3b,0x08,0xd6,0xda,0xf7,0xbe,0xce,0x99,0xa5,0x95,0xd6,0xba,0xff,0xff,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x5b,0xcb,0xef,0x7d,0x8c,0xd2,0xc6,0x38,0x84,0x90,0xa5,0x74,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0xbe,0xd6,0xda,0xb5,0xb6,0x6b,0xee,0xce,0x99,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x95,0x53,0xdf,0x1b,0xad,0xd5,0x9d,0x54,0x84,0xb0,0xd6,0xba,0x8d,0x32,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x22,0x05,0x19,0xe5,0x22,0x25,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xf7,0xde,0xad,0x95,0xf7,0xbe,0xf7,0xde,0xa5,0x74,0xef,0x9d,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xef,0x7d,0x9d,0x33,0xff,0xdf,0xe7,0x5d,0xad,0x95,0xce,0x99,0xc6,0x77,0xad,0xd5,0xd6,0xda,0x8c,0xf2,0xef,0x7d,0x8c,0xf1,0xa5,0x74,0xf7,0x9e,0x5b,0xcc,0x84,0xd0,0xff,0xff,0xff,0xff,0xf7,0xbe,0x9d,0x73,0xff,0xdf,0xff,0xff,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xdf,0x9d,0x53,0x7c,0x6f,0x95,0x12,0xd6,0xda,0xff,0xff,0x53,0x8a,0x9d,0x73,0xff,0xff,0xff,0xdf,0xe7,0x1c,0xc6,0x58,0xff,0xdf,0xff,0xff,0xc6,0x58,0x7c,0x8f,0xf7,0xbe,0xff,0xff,0xff,0xdf,0xa5,0x94,0xff,0xdf,0xff,0xff,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x25,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x53,0xc6,0x78,0x32,0x87,0x6b,0xee,0xff,0xff,0xdf,0x1b,0xad,0x95,0xbd,0xf7,0xef,0x9d,0xbe,0x38,0xad,0xd5,0x7c,0x8f,0x9d,0x54,0xbe,0x37,0xd6,0xda,0x9d,0x73,0xad,0xb5,0xd6,0xda,0x95,0x12,0x43,0x49,0x84,0xd0,0x43,0x28,0x32,0xc7,0x9d,0x54,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x95,0x13,0x9d,0x34,0xc6,0x78,0xbe,0x17,0xff,0xff,0xff,0xdf,0x9d,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x63,0xcc,0xe7,0x3c,0xff,0xff,0xff,0xff,0xa5,0x94,0xad,0x95,0xd6,0xba,0xb5,0xf6,0xbe,0x58,0xf7,0xbe,0xff,0xff,0xff,0xdf,0xff,0xff,0xd6,0xda,0xa5,0x75,0xe7,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x5b,0xcb,0x3b,0x08,0xd6,0xda,0xb6,0x16,0x74,0x4e,0x95,0x53,0xa5,0x94,0xff,0xdf,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x26,0x53,0xab,0xf7,0xbe,0xc6,0x58,0xa5,0x95,0xef,0x5d,0xde,0xfb,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0x9e,0x6b,0xee,0x8c,0xb1,0xce,0x99,0xe7,0x5c,0xb6,0x17,0x3a,0xe8,0x3b,0x08,0x95,0x33,0xff,0xdf,0xbe,0x37,0xbe,0x37,0xe7,0x5c,0xef,0x7d,0x8d,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xff,0xdf,0xa5,0x94,0xef,0x7d,0xdf,0x1b,0xa5,0x94,0xf7,0x9e,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xff,0xdf,0x94,0xf2,0x7c,0x70,0x84,0x71,0xe7,0x1c,0xc6,0x78,0x5b,0x8a,0x3a,0xe8,0xd6,0xba,0xce,0x79,0x84,0xd0,0xad,0xb5,0x9d,0x33,0xf7,0x9e,0x5b,0xcc,0x84,0xb0,0xff,0xff,0xd6,0xda,0xad,0x95,0x95,0x12,0xad,0xb5,0xf7,0xbe,0xce,0x99,0x4b,0x4a,0xe7,0x5c,0xff,0xdf,0xe7,0x3c,0xa5,0x94,0xd6,0xda,0xf7,0xbe,0xff,0xff,0x4b,0x6a,0x9d,0x73,0xff,0xff,0xbe,0x17,0x95,0x12,0x8c,0xd1,0xa5,0x34,0xff,0xff,0xe7,0x3c,0xe7,0x3c,0xf7,0xbe,0xe7,0x1c,0x8c,0xf1,0x6c,0x2e,0x8c,0xf1,0xdf,0x1b,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x22,0x05,0x19,0xc5,0x22,0x05,0x22,0x25,0x22,0x26,0x3a,0xe8,0x43,0x29,0x19,0xe5,0x6b,0xee,0xef,0x7d,0x3a,0xa9,0x7c,0x70,0x84,0xb1,0xd6,0xba,0xbd,0xf7,0x2a,0x46,0x22,0x26,0x95,0x13,0xe7,0x3c,0x84,0xd1,0x9d,0x33,0xa5,0x94,0xde,0xfb,0x95,0x12,0x4b,0x6a,0xd6,0xfa,0x4b,0x49,0x32,0xc7,0x84,0x91,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0x9a,0xbe,0x38,0x94,0xf2,0xbe,0x38,0x95,0x13,0xad,0xd6,0xdf,0x1b,0x8c,0xb1,0xce,0x9a,0xef,0x5d,0xff,0xff,0xe7,0x3c,0x8c,0xb1,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x4a,0x22,0x8c,0x03,0x8c,0x03,0x83,0xe3,0x21,0x02,0x39,0xc7,0x8c,0x71,0x53,0x8b,0xc6,0x78,0xff,0xff,0xff,0xff,0x84,0x91,0xe7,0x3c,0x9d,0x54,0xe7,0x3c,0x7c,0x8f,0xe7,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x8c,0xb2,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x53,0xab,0x3b,0x08,0xd6,0xda,0xce,0x99,0xb5,0xf6,0xb5,0xf7,0xb5,0xf6,0xff,0xdf,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x42,0xe9,0xf7,0x9e,0xf7,0x9e,0xd6,0xfb,0x9d,0x34,0xb5,0xf6,0xd6,0xda,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x63,0xcd,0xf7,0x9e,0x9d,0x33,0x9d,0x33,0x9d,0x74,0xd6,0xba,0xad,0xd6,0x22,0x05,0x22,0x26,0x8c,0xd2,0xff,0xdf,0xe7,0x3c,0xc6,0x38,0x8c,0xd2,0xe7,0x1c,0x84,0xb0,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0xff,0xdf,0xce,0x99,0xbe,0x17,0xbe,0x17,0xd6,0xba,0xf7,0x9e,0x22,0x26,0x22,0x26,0x53,0x6b,0xf7,0x9e,0xad,0x95,0xc6,0x79,0xef,0x5d,0xff,0xdf,0xc6,0x58,0x19,0xe5,0x19,0xe5,0xd6,0xba,0xff,0xff,0xff,0xdf,0xe7,0x5c,0xce,0x99,0xff,0xdf,0x4b,0x2a,0x7c,0x4f,0xff,0xff,0xe7,0x3c,0x9d,0x33,0x95,0x13,0xbe,0x38,0xff,0xff,0xc6,0x79,0x3a,0x88,0xe7,0x3c,0xf7,0xbe,0xa5,0x94,0xa5,0x74,0xa5,0x74,0xde,0xfb,0xff,0xff,0x3a,0xa8,0x95,0x12,0xff,0xff,0xbe,0x18,0xde,0xfb,0xf7,0xbe,0xc6,0x58,0xff,0xff,0xad,0xb5,0x5b,0xac,0xf7,0xbe,0xef,0x5d,0xe7,0x1c,0xf7,0xdf,0xef,0x7d,0xe7,0x5c,0xef,0x5d,0x3a,0xa8,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x6b,0xee,0xf7,0xbe,0xa5,0x75,0xb5,0xb6,0xb5,0xb6,0xde,0xdb,0xbd,0xf7,0x19,0xe5,0x19,0xc5,0x95,0x13,0xff,0xff,0xff,0xff,0xf7,0x9e,0xd6,0xda,0xef,0x9d,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x22,0x26,0xbe,0x37,0xff,0xff,0xff,0xff,0xf7,0xbe,0xad,0xd6,0xc6,0x58,0xf7,0xbe,0xce,0xba,0xbe,0x17,0xff,0xdf,0xbe,0x58,0xad,0xd6,0xdf,0x1c,0xff,0xdf,0x63,0xcd,0x7c,0x70,0x5a,0xeb,0x29,0x65,0x62,0xe2,0xbd,0x63,0xbd,0x63,0xb5,0x03,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x65,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x5b,0x8b,0xef,0x7d,0xff,0xdf,0xbd,0xf7,0xff,0xdf,0xc6,0x58,0xd6,0xda,0xad,0x95,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0xa5,0x54,0xb5,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x43,0x28,0x3b,0x08,0xd6,0xda,0xa5,0x94,0xde,0xfb,0xe7,0x5c,0xa5,0x94,0xf7,0xbe,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x3a,0xc9,0xef,0x9d,0x8c,0xf2,0x9d,0x33,0xd6,0xda,0xff,0xdf,0xd6,0xda,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x5b,0xac,0xef,0x5d,0x8c,0xb2,0xad,0x75,0xa5,0x74,0xbe,0x37,0xad,0xd6,0x22,0x05,0x22,0x05,0x8c,0xd1,0xdf,0x1c,0x5b,0x8c,0xa5,0x95,0xe7,0x5c,0xff,0xff,0x7c,0x90,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0xf7,0xbe,0x95,0x13,0xb6,0x17,0xb6,0x17,0xce,0xba,0xf7,0x9e,0x22,0x05,0x22,0x05,0x53,0x4b,0xff,0xdf,0xde,0xdb,0x8c,0xb1,0x8c,0xb2,0xad,0xd6,0xc6,0x58,0x22,0x05,0x22,0x05,0xd6,0xba,0xce,0xba,0x8c,0xd2,0xa5,0x75,0xbe,0x17,0xff,0xdf,0x4b,0x0a,0x74,0x2f,0xff,0xff,0xbd,0xf7,0xa5,0x54,0xbd,0xf7,0x94,0xf2,0xf7,0xbe,0xc6,0x79,0x32,0x67,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xdf,0xad,0xb5,0xf7,0xbe,0xff,0xff,0x32,0xa8,0x8c,0xf2,0xff,0xff,0x84,0xb1,0x8c,0xb1,0xe7,0x3c,0x8c,0xb2,0xff,0xff,0xa5,0x75,0x4b,0x0a,0xf7,0xbe,0xce,0x59,0xde,0xdb,0xa5,0x74,0x9d,0x33,0xbe,0x38,0xef,0x5d,0x32,0x88,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x6c,0x0e,0xef,0x5d,0x8c,0xf2,0xe7,0x3c,0xce,0x79,0xbe,0x18,0xbe,0x17,0x22,0x05,0x22,0x05,0x9d,0x33,0xe7,0x3c,0x9d,0x13,0xad,0xb5,0xb6,0x16,0xf7,0xbe,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xc5,0x3a,0xe8,0x8c,0xf1,0x9d,0x34,0x9d,0x34,0x9d,0x34,0x9d,0x54,0xa5,0x94,0xa5,0x54,0x9d,0x34,0xa5,0x95,0xa5,0x74,0x9d,0x34,0xa5,0x74,0x84,0xb1,0x22,0x05,0x7c,0x70,0x5a,0xeb,0x31,0xa6,0x21,0x24,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x24,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x7c,0x50,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xce,0x9a,0xce,0x99,0xd6,0xba,0xce,0x99,0xce,0x9a,0xd6,0xba,0xc6,0x99,0x9d,0x53,0x43,0x49,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xce,0x99,0x95,0x12,0xa5,0x74,0x9d,0x53,0xff,0xdf,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0xf7,0x9e,0xef,0x5d,0xbe,0x58,0x95,0x33,0xc6,0x58,0xd6,0xfb,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x74,0x4e,0xf7,0x9e,0x9d,0x33,0xe7,0x5c,0xc6,0x58,0xc6,0x58,0xbe,0x37,0x3a,0xe8,0x3a,0xe8,0x95,0x32,0xff,0xdf,0xd6,0xda,0xad,0xd5,0x95,0x53,0xef,0x7d,0x8d,0x12,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0xf7,0xde,0xb5,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x3b,0x08,0x3a,0xe8,0x64,0x0d,0xf7,0xbe,0xad,0xb5,0x9d,0x33,0xbe,0x17,0xe7,0x5c,0xce,0x99,0x3a,0xe8,0x3a,0xe8,0xd6,0xda,0xce,0x99,0x8c,0xf1,0xb5,0xf6,0xce,0x99,0xff,0xdf,0x5b,0xac,0x84,0xb0,0xff,0xff,0xce,0x79,0xa5,0x74,0x84,0xb1,0x8d,0x12,0xff,0xdf,0xce,0x99,0x4b,0x49,0xe7,0x5c,0xff,0xdf,0xb5,0xf6,0xb5,0xf6,0x8c,0xd1,0xbe,0x58,0xff,0xff,0x4b,0x6a,0x9d,0x73,0xff,0xff,0xad,0xf6,0xe7,0x3c,0x9d,0x74,0x9d,0x54,0xff,0xff,0xad,0xd5,0x5b,0xcc,0xf7,0xbe,0xe7,0x5c,0x8d,0x12,0x95,0x32,0xb5,0xf6,0xd6,0xfa,0xef,0x7d,0x4b,0x6a,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x7c,0x90,0xf7,0xde,0x8c,0xd1,0xa5,0x74,0x95,0x32,0xde,0xfb,0xbe,0x38,0x3a,0xe8,0x3a,0xe8,0xa5,0x94,0xe7,0x3c,0x7c,0x70,0xad,0x95,0xbe,0x37,0xf7,0xbe,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x7c,0x4f,0x5a,0xcb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x94,0x92,0x4b,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x19,0xe5,0x43,0x08,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x43,0x29,0x32,0x67,0x2a,0x46,0x43,0x08,0x2a,0x26,0x32,0x87,0x43,0x29,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xff,0xff,0xe7,0x5c,0xe7,0x5c,0xf7,0xbe,0xff,0xff,0x74,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xdf,0xd6,0xda,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x6c,0x0d,0xff,0xdf,0xd6,0xba,0xb5,0xd6,0xbe,0x37,0xf7,0xbe,0xb6,0x16,0x32,0x87,0x32,0x87,0x95,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0x84,0xd1,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0xff,0xdf,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x32,0xa7,0x32,0x87,0x5b,0xac,0xff,0xdf,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x79,0x32,0x87,0x32,0x87,0xd6,0xda,0xff,0xff,0xff,0xff,0xef,0x9d,0xd6,0xda,0xff,0xdf,0x53,0x6b,0x7c,0x90,0xff,0xff,0xff,0xff,0xf7,0xbe,0xf7,0x9e,0xff,0xdf,0xff,0xff,0xce,0x99,0x42,0xe9,0xe7,0x3c,0xff,0xff,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xf7,0xbe,0xff,0xff,0x43,0x09,0x95,0x33,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xad,0xb5,0x53,0x8b,0xf7,0xbe,0xff,0xff,0xf7,0xde,0xff,0xdf,0xff,0xff,0xff,0xff,0xef,0x5d,0x43,0x09,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x32,0x87,0x74,0x4f,0xff,0xff,0xf7,0xbe,0xe7,0x3c,0xef,0x7d,0xff,0xff,0xbe,0x37,0x32,0x87,0x32,0x87,0x9d,0x74,0xff,0xff,0xff,0xff,0xf7,0xbe,0xd6,0xda,0xef,0x9d,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xc5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x3a,0xe8,0x3a,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0xc9,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x22,0x05,0x3a,0xc7,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0xa5,0x74,0xff,0xdf,0xff,0xff,0xff,0xff,0xf7,0xbe,0x84,0x91,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x53,0x4b,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x95,0x19,0xe5,0x19,0xe5,0x42,0xea,0xce,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1b,0x43,0x0a,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0xad,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x75,0x19,0xe5,0x19,0xe5,0x32,0x88,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x8c,0xd2,0x19,0xc5,0x19,0xc5,0xc6,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x3a,0x88,0x2a,0x47,0xbe,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x63,0xad,0x19,0xe5,0x8c,0xd2,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf7,0x22,0x26,0x42,0xc9,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x42,0xe9,0x19,0xe5,0x84,0x91,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x74,0x2f,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x3a,0xa9,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x63,0xcd,0x19,0xe5,0x19,0xc5,0x8c,0xb2,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xde,0x7c,0x90,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x3a,0xe8,0x43,0x09,0x6b,0xed,0x7c,0x6f,0x84,0xd1,0x53,0x6a,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x41,0xe2,0x7b,0xa3,0x7b,0xa3,0x7b,0x83,0x21,0x02,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x8c,0xd2,0xce,0x79,0xce,0x79,0xce,0x79,0xce,0x79,0xce,0x79,0xce,0x79,0xce,0x79,0xce,0x79,0xc6,0x58,0xc6,0x58,0xce,0x79,0xb5,0xd6,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xcc,0xd6,0xda,0xf7,0x9e,0x8d,0x12,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x25,0x5b,0x8c,0xe7,0x3c,0xce,0x9a,0x42,0xe9,0x2a,0x87,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xc7,0x74,0x4e,0xe7,0x3c,0xff,0xff,0xf7,0xbe,0x9d,0x74,0x43,0x08,0x32,0xa7,0x32,0xa7,0x32,0x87,0x22,0x26,0x95,0x12,0xf7,0x9e,0xa5,0x75,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x6b,0xee,0xe7,0x3c,0xe7,0x1c,0x5b,0x8c,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x22,0x26,0x94,0xf2,0xf7,0xbe,0xde,0xfb,0x5b,0x8c,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x9d,0x34,0xf7,0xbe,0xff,0xdf,0xc6,0x58,0x42,0xc9,0x19,0xe5,0x19,0xc5,0x1a,0x05,0x84,0xb0,0xef,0x9d,0xff,0xdf,0xbe,0x17,0x43,0x09,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x63,0xed,0xdf,0x1b,0xff,0xff,0xef,0x7d,0x7c,0x6f,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x67,0x84,0xb1,0xf7,0xbe,0xf7,0xbe,0xa5,0x94,0x32,0xc7,0x32,0xa7,0x32,0xa7,0x32,0xc7,0x53,0x8b,0xd6,0xda,0xff,0xdf,0xc6,0x78,0x4b,0x6a,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x3a,0xe8,0xad,0xb5,0xf7,0xbe,0xce,0x99,0x5b,0xac,0x32,0xa7,0x32,0xa7,0x32,0x87,0x19,0xe5,0x74,0x0f,0xe7,0x5d,0xff,0xff,0xde,0xfb,0x63,0xcd,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0x6c,0x2e,0x22,0x05,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xc5,0x19,0xc5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x4b,0x4a,0xa5,0x94,0xc6,0x58,0xb5,0xd6,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x6b,0xed,0xf7,0x9e,0xf7,0xbe,0xde,0xfb,0xf7,0xde,0xd6,0xda,0xdf,0x1b,0xb6,0x17,0xc6,0x78,0xd6,0xda,0xb5,0xd6,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0xd0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0x84,0xb0,0x84,0x90,0x84,0x90,0x8c,0xd1,0x9d,0x33,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x7c,0x90,0x74,0x0f,0x74,0x0f,0x8c,0xf2,0x7c,0x4f,0x74,0x0e,0x7c,0x70,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x94,0xf2,0xde,0xdb,0xad,0xb5,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x7c,0x90,0x6b,0xee,0x7c,0x4f,0x94,0xf2,0x74,0x0f,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x8c,0xb2,0x7c,0x70,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0xa5,0x34,0x84,0x71,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x74,0x0e,0xa5,0x95,0xc6,0x58,0x7c,0x2f,0x6b,0xee,0x6b,0xee,0x6b,0xee,0x74,0x4f,0x84,0x90,0x95,0x33,0xbd,0xf7,0x84,0x90,0x84,0x90,0x84,0x90,0x7c,0x90,0x84,0x90,0x84,0x90,0x8c,0xf1,0xce,0x99,0x95,0x12,0x84,0x90,0x84,0x90,0x84,0x90,0x7c,0x90,0x7c,0x90,0x74,0x0f,0x9d,0x14,0xa5,0x54,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0xbd,0xf7,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0x84,0x90,0xa5,0x54,0x8c,0xd1,0x84,0x90,0x84,0x90,0x7c,0x90,0x4b,0x6a,0x2a,0x46,0x19,0xe5,0x43,0x09,0xbe,0x37,0x84,0x91,0x74,0x0f,0x84,0x90,0x7c,0x90,0x43,0x49,0x4b,0x6a,0xb5,0xf6,0xad,0x95,0x95,0x33,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x53,0x8a,0x53,0x8a,0x53,0x8a,0xa5,0x94,0x7c,0x90,0xa5,0x94,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x5b,0xac,0xce,0xb9,0xff,0xff,0xff,0xdf,0x7c,0x90,0x8d,0x11,0xad,0xd5,0x95,0x12,0xdf,0x1b,0x95,0x32,0x95,0x12,0xdf,0x1b,0xbe,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0x8c,0xb1,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0xad,0x6b,0x6d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x8d,0x6b,0x8d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0xcd,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x8d,0x6b,0x6d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x6d,0x6b,0xcd,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0xad,0x6b,0x6d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x8d,0x6b,0xad,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x63,0x4c,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x63,0x4c,0x63,0x4c,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x63,0x4c,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x63,0x4c,0x63,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x63,0x8d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x63,0x4c,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x63,0x4c,0x63,0x4c,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x6d,0x6b,0xad,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0xad,0x6b,0x8d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x6d,0x6b,0xad,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0xad,0x6b,0x6d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0x73,0xae,0x6b,0xae,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x5b,0x0b,0x6b,0x4d,0x6b,0x4d,0x6b,0x4d,0xad,0x55,0x53,0x8a,0x5b,0xab,0x63,0xed,0x4a,0xea,0x63,0xcc,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x95,0x32,0xd6,0xd9,0x9d,0x73,0x84,0xd0,0x8c,0xf1,0xad,0xd5,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x6b,0x23,0xee,0xc4,0xee,0xc4,0xe6,0x84,0x29,0x62,0x39,0xc7,0x8c,0x71,0x74,0x2e,0xf7,0xbe,0xff,0xff,0xff,0xff,0x95,0x32,0xb5,0xd6,0xd6,0xda,0xa5,0x94,0xf7,0xbe,0x95,0x53,0xd6,0xda,0x9d,0x33,0xad,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4a,0xc9,0x4a,0x49,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x42,0xe8,0x74,0x4e,0xc6,0x58,0xa5,0x74,0xad,0xd6,0x4b,0x49,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x4b,0x6a,0x5b,0xcc,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x29,0x23,0x39,0xc3,0x39,0xc3,0x39,0xc3,0x18,0xe3,0x39,0xc7,0x8c,0x71,0x53,0x6a,0xa5,0xb5,0xff,0xff,0xff,0xff,0xbe,0x58,0x84,0xb1,0xff,0xdf,0xa5,0x94,0xad,0xb5,0x8d,0x12,0xb5,0xd6,0xa5,0x95,0x84,0x91,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x78,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xe7,0x39,0xe7,0x3a,0xa8,0x53,0x8b,0x5b,0xcc,0x19,0xc5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x42,0xe9,0xde,0xfb,0xff,0xff,0xff,0xdf,0xef,0x9d,0xff,0xff,0xff,0xdf,0xe7,0x5c,0xef,0x9d,0xf7,0xbe,0xe7,0x3c,0xf7,0x9e,0xff,0xff,0xff,0xff,0xe7,0x3c,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x31,0x82,0x6b,0x23,0x6b,0x23,0x6b,0x23,0x18,0xc2,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x5a,0xc3,0x6b,0x23,0x6b,0x23,0x4a,0x22,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x39,0xc2,0x6b,0x23,0x6b,0x23,0x62,0xe3,0x21,0x03,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x43,0x6b,0x03,0x6b,0x23,0x6b,0x23,0x31,0x82,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x52,0x62,0x6b,0x23,0x6b,0x23,0x52,0x63,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x22,0x6b,0x23,0x6b,0x23,0x6b,0x23,0x29,0x62,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0x62,0xc3,0x6b,0x23,0x6b,0x23,0x4a,0x42,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x39,0xc2,0x6b,0x23,0x6b,0x23,0x6b,0x23,0x18,0xc2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x23,0x6b,0x03,0x6b,0x23,0x6b,0x23,0x41,0xe2,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x42,0x02,0x6b,0x23,0x6b,0x23,0x62,0xc3,0x21,0x03,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x43,0x6b,0x23,0x6b,0x23,0x6b,0x23,0x31,0x62,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0x5a,0xa3,0x6b,0x23,0x6b,0x23,0x4a,0x42,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x42,0x6b,0x23,0x6b,0x23,0x6b,0x23,0x29,0x42,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x63,0x03,0x6b,0x23,0x6b,0x23,0x4a,0x22,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x42,0x02,0x6b,0x23,0x6b,0x23,0x6b,0x03,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x43,0x6b,0x23,0x6b,0x23,0x6b,0x23,0x29,0x62,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0x4a,0x22,0x6b,0x23,0x6b,0x23,0x5a,0xa3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x62,0x6b,0x23,0x6b,0x23,0x6b,0x23,0x29,0x42,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0x62,0xc3,0x6b,0x23,0x6b,0x23,0x4a,0x02,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x39,0xc2,0x6b,0x23,0x6b,0x23,0x6b,0x03,0x21,0x03,0x39,0xc7,0x39,0xe7,0x3a,0xa8,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x4b,0x4a,0x64,0x0d,0x64,0x0d,0x64,0x0d,0x64,0x0d,0x53,0x6a,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x42,0xc9,0x84,0xd1,0x8c,0xf1,0x8c,0xf1,0x8c,0xf1,0x8c,0xf1,0x8c,0xf1,0x8c,0xf1,0x8c,0xf1,0x7c,0x70,0x7c,0x50,0x84,0xd1,0x6b,0xee,0x3a,0xc8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x6b,0x23,0xff,0x64,0xff,0x44,0xff,0x44,0x21,0x02,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xd6,0x24,0xff,0x64,0xff,0x64,0xa4,0xa3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x83,0xc3,0xff,0x44,0xff,0x64,0xee,0xa4,0x31,0x63,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x41,0xe3,0xee,0xe4,0xff,0x44,0xff,0x44,0x6b,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x44,0xff,0x64,0xbd,0x43,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x42,0x02,0xff,0x44,0xff,0x64,0xff,0x44,0x52,0x83,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xde,0x44,0xff,0x64,0xff,0x64,0xad,0x03,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x44,0xff,0x64,0xff,0x24,0x18,0xe2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xee,0xe4,0xff,0x64,0xff,0x64,0x83,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x94,0x43,0xff,0x64,0xff,0x64,0xde,0x64,0x29,0x43,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x43,0xf7,0x04,0xff,0x64,0xff,0x44,0x5a,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xcd,0xc3,0xff,0x44,0xff,0x64,0xac,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x52,0x63,0xff,0x44,0xff,0x64,0xff,0x24,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xee,0xc4,0xff,0x44,0xff,0x64,0x9c,0x83,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x94,0x43,0xff,0x64,0xff,0x64,0xf6,0xe4,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x42,0x03,0xf7,0x24,0xff,0x44,0xff,0x64,0x5a,0x83,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x64,0xcd,0xe3,0x29,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x52,0x83,0xff,0x24,0xff,0x64,0xf7,0x24,0x4a,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x24,0xde,0x44,0xff,0x64,0xff,0x64,0x9c,0x63,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x7b,0xa3,0xff,0x64,0xff,0x44,0xf7,0x04,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x3a,0xa8,0x3b,0x08,0x32,0xc7,0x19,0xc5,0x32,0xa7,0x3a,0xe8,0x1a,0x05,0x19,0xc5,0x19,0xc5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x32,0xa7,0x19,0xc5,0x7c,0x4f,0x63,0x2c,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x3a,0x88,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x19,0xe5,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x46,0x22,0x05,0x3a,0xc7,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x6b,0x23,0xff,0x64,0xff,0x64,0xff,0x44,0x21,0x02,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xd6,0x24,0xff,0x44,0xff,0x64,0xa4,0xa3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x83,0xc3,0xff,0x64,0xff,0x44,0xee,0xa4,0x31,0x63,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x41,0xe3,0xee,0xe4,0xff,0x64,0xff,0x44,0x6b,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x64,0xff,0x44,0xbd,0x43,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x42,0x02,0xff,0x44,0xff,0x44,0xff,0x44,0x52,0x83,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xde,0x44,0xff,0x64,0xff,0x44,0xad,0x03,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x44,0xff,0x64,0xff,0x24,0x18,0xe2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xee,0xe4,0xff,0x64,0xff,0x44,0x83,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x94,0x43,0xff,0x44,0xff,0x64,0xde,0x64,0x29,0x43,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x43,0xf7,0x04,0xff,0x64,0xff,0x44,0x5a,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xcd,0xc3,0xff,0x64,0xff,0x64,0xac,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x52,0x63,0xff,0x64,0xff,0x44,0xff,0x24,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xee,0xc4,0xff,0x64,0xff,0x44,0x9c,0x83,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x94,0x43,0xff,0x44,0xff,0x64,0xf6,0xe4,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x42,0x03,0xf7,0x24,0xff,0x64,0xff,0x64,0x5a,0x83,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xcd,0xe3,0x29,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x52,0x83,0xff,0x24,0xff,0x44,0xf7,0x24,0x4a,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x24,0xde,0x44,0xff,0x44,0xff,0x64,0x9c,0x63,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x7b,0xa3,0xff,0x64,0xff,0x64,0xf7,0x04,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x3a,0xa8,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x53,0x6b,0x8d,0x12,0x84,0xb1,0x84,0xb1,0x84,0xb1,0x84,0xb1,0x95,0x32,0x8c,0xd1,0x84,0xb1,0x95,0x32,0x95,0x12,0x84,0xb1,0x8d,0x12,0x53,0x6b,0x19,0xe5,0x74,0x2f,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x32,0x27,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0xa6,0x21,0x03,0x31,0x63,0x31,0x63,0x29,0x63,0x21,0x03,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x2a,0x66,0x2a,0x26,0x53,0x8a,0x53,0xab,0x53,0xab,0x53,0xab,0x53,0xab,0x53,0xab,0x53,0xab,0x53,0xab,0x42,0xe9,0x3a,0xc8,0x53,0x6a,0x32,0xa8,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x62,0xe3,0xf6,0xe4,0xf6,0xe4,0xf6,0xe4,0x21,0x02,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xcd,0xe4,0xf6,0xe4,0xf6,0xe4,0x9c,0x63,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x7b,0x83,0xf6,0xe4,0xf6,0xe4,0xde,0x44,0x29,0x63,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc3,0xde,0x64,0xf6,0xe4,0xee,0xe4,0x62,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0xa4,0xc3,0xf6,0xe4,0xf6,0xe4,0xad,0x03,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x41,0xe2,0xee,0xe4,0xf6,0xe4,0xf6,0xe4,0x52,0x63,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xcd,0xe3,0xf6,0xe4,0xf6,0xe4,0xa4,0xc3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x73,0x63,0xf6,0xe4,0xf6,0xe4,0xee,0xc4,0x18,0xe2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0x83,0xe6,0x64,0xf6,0xe4,0xf6,0xe4,0x7b,0xa3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x8c,0x03,0xf6,0xe4,0xf6,0xe4,0xd6,0x03,0x29,0x43,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x23,0xe6,0xa4,0xf6,0xe4,0xee,0xc4,0x5a,0x83,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xbd,0x63,0xf6,0xe4,0xf6,0xe4,0xa4,0xa3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x4a,0x42,0xf6,0xe4,0xf6,0xe4,0xee,0xc4,0x42,0x03,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xde,0x64,0xf6,0xe4,0xf6,0xe4,0x94,0x43,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x8c,0x03,0xf6,0xe4,0xf6,0xe4,0xe6,0x84,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x41,0xe3,0xee,0xa4,0xf6,0xe4,0xf6,0xe4,0x52,0x62,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0x9c,0x63,0xf6,0xe4,0xf6,0xe4,0xc5,0xa3,0x29,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x52,0x63,0xee,0xc4,0xf6,0xe4,0xee,0xa4,0x4a,0x23,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0xcd,0xc3,0xf6,0xe4,0xf6,0xe4,0x94,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x73,0x63,0xf6,0xe4,0xf6,0xe4,0xe6,0xa4,0x31,0x83,0x39,0xc7,0x39,0xe7,0x3a,0xa8,0x3b,0x08,0x32,0xa7,0x5b,0x6c,0xef,0x7d,0xff,0xff,0xff,0xff,0xef,0x7d,0xd6,0xda,0xef,0x7d,0xe7,0x3c,0xff,0xdf,0xef,0x5d,0xe7,0x5c,0xd6,0xfa,0xf7,0x9e,0xff,0xff,0xce,0x9a,0x2a,0x47,0x74,0x2f,0x5a,0xeb,0x31,0xa6,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x24,0x39,0xc7,0x32,0x27,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x6b,0x23,0xe6,0xa4,0xe6,0xa4,0xde,0x64,0x29,0x62,0x39,0xc7,0x8c,0x71,0x4b,0x6a,0x3a,0xc8,0xc6,0x38,0xff,0xff,0xf7,0xbe,0xf7,0xbe,0xff,0xdf,0xf7,0xbe,0xf7,0x9e,0xff,0xff,0xf7,0xde,0xef,0x7d,0xff,0xdf,0xff,0xff,0xf7,0xbe,0xc6,0x38,0x4b,0x69,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x18,0xe3,0x41,0xe3,0x41,0xe3,0x41,0xe3,0x18,0xc3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x04,0x39,0xc3,0x41,0xe3,0x41,0xe3,0x31,0x83,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x43,0x41,0xe3,0x41,0xe3,0x39,0xc3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe3,0x39,0xa3,0x41,0xe3,0x41,0xe3,0x29,0x43,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x29,0x63,0x41,0xe3,0x41,0xe3,0x31,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x03,0x41,0xe3,0x41,0xe3,0x41,0xe3,0x21,0x23,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x39,0xa3,0x41,0xe3,0x41,0xe3,0x31,0xa3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x21,0x03,0x41,0xe3,0x41,0xe3,0x41,0xe3,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe3,0x39,0xc3,0x41,0xe3,0x41,0xe3,0x21,0x23,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x29,0x43,0x41,0xe3,0x41,0xe3,0x39,0xc3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x23,0x39,0xe3,0x41,0xe3,0x41,0xe3,0x29,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x29,0x63,0x41,0xe3,0x41,0xe3,0x31,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x03,0x41,0xe3,0x41,0xe3,0x41,0xe3,0x21,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x04,0x39,0xa3,0x41,0xe3,0x41,0xe3,0x31,0x63,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x63,0x41,0xe3,0x41,0xe3,0x41,0xe3,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe3,0x39,0xc3,0x41,0xe3,0x41,0xe3,0x21,0x03,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x45,0x31,0x83,0x41,0xe3,0x41,0xe3,0x39,0xc3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x03,0x41,0xe3,0x41,0xe3,0x41,0xe3,0x21,0x23,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x31,0x63,0x41,0xe3,0x41,0xe3,0x31,0x83,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x21,0x23,0x41,0xe3,0x41,0xe3,0x39,0xc3,0x18,0xe3,0x39,0xc7,0x39,0xe7,0x3a,0xa8,0x32,0xc7,0x2a,0x46,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x50,0xb5,0xf7,0xad,0x75,0x74,0x6f,0xbe,0x17,0x9c,0xf3,0x95,0x53,0xad,0xd5,0x84,0x91,0xf7,0xde,0xff,0xff,0x8c,0xd2,0x74,0x2f,0x5a,0xeb,0x29,0x65,0x5a,0xa2,0x9c,0x83,0x9c,0x83,0x94,0x23,0x10,0xa2,0x39,0xc7,0x3a,0x47,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x4b,0x4a,0x84,0xb1,0xff,0xdf,0xf7,0xbe,0xbe,0x17,0x9d,0x33,0xce,0x99,0xad,0xb5,0xad,0xb5,0xce,0xb9,0xa5,0x94,0xb5,0xb6,0xa5,0x54,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xd5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x32,0x67,0x1a,0x05,0x2a,0x67,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x2f,0xce,0x79,0xad,0x96,0x95,0x53,0x9d,0x13,0x94,0xd2,0x9d,0x53,0xf7,0x9e,0xad,0x75,0xef,0x5d,0xff,0xff,0xf7,0x9e,0x6b,0xce,0x4a,0x69,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x3a,0x87,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x73,0x63,0xff,0x44,0xff,0x44,0xf7,0x04,0x31,0x62,0x39,0xc7,0x8c,0x71,0x53,0x4b,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xce,0x99,0xf7,0xbe,0xe7,0x5c,0x9d,0x74,0x9d,0x53,0xb5,0xf6,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x21,0xe6,0x19,0xe5,0x3a,0xe8,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x50,0xc6,0x59,0x8c,0x91,0x9d,0x73,0xce,0x79,0x7c,0x2f,0x9d,0x53,0xce,0x79,0x84,0x91,0xf7,0x9e,0xff,0xff,0xb5,0xb6,0x19,0xe5,0x39,0xe7,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x3a,0x47,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0x86,0x4a,0x22,0x94,0x43,0x94,0x43,0x94,0x23,0x21,0x22,0x39,0xc7,0x8c,0x71,0x4a,0xea,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xc6,0x79,0xdf,0x1b,0xde,0xfb,0xad,0xd6,0xde,0xfb,0xce,0x99,0x9c,0xf3,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x29,0xe6,0x32,0xa7,0x3b,0x08,0x74,0x4f,0xf7,0xbe,0xff,0xff,0xff,0xff,0xe7,0x3c,0xc6,0x38,0xd6,0xdb,0xe7,0x3c,0xff,0xdf,0xd6,0x9a,0xdf,0x1c,0xce,0x79,0xde,0xfb,0xff,0xff,0xe7,0x3c,0x4b,0x4a,0x19,0xe5,0x39,0xc7,0x29,0x65,0x7b,0x83,0xde,0x44,0xde,0x44,0xcd,0xe3,0x10,0xa2,0x39,0xc7,0x32,0x27,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xc7,0x8c,0x71,0x4b,0x29,0x6c,0x2d,0xf7,0xde,0xff,0xff,0xff,0xff,0xdf,0x1b,0xdf,0x1b,0xad,0xd5,0x9d,0x53,0xe7,0x3c,0xbe,0x37,0x8c,0xd1,0xbe,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x04,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x04,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x04,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x31,0x86,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x45,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x39,0xc7,0x39,0xe7,0x3a,0x87,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x53,0x6c,0x8c,0xf2,0x95,0x33,0x95,0x33,0x95,0x33,0x9d,0x33,0xa5,0xb4,0x9d,0x54,0x95,0x33,0xa5,0xb5,0xa5,0xb5,0xa5,0x94,0x95,0x33,0x63,0xcd,0x3a,0xe8,0x32,0xc7,0x39,0xe7,0x31,0x86,0x21,0x03,0x29,0x43,0x29,0x43,0x29,0x23,0x21,0x04,0x39,0xc7,0x32,0x47,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x52,0xaa,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x71,0x53,0x6a,0x3b,0x08,0x9d,0x53,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x5c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5c,0xd6,0xba,0x7c,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x6b,0x03,0xee,0xe4,0xee,0xe4,0xee,0xe4,0x21,0x02,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xcd,0xc3,0xee,0xe4,0xee,0xe4,0x94,0x23,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x7b,0x83,0xee,0xe4,0xee,0xe4,0xde,0x44,0x29,0x63,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x41,0xe3,0xe6,0x84,0xee,0xe4,0xee,0xc4,0x62,0xc2,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0xac,0xe3,0xee,0xe4,0xee,0xe4,0xad,0x03,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x41,0xe2,0xee,0xc4,0xee,0xe4,0xee,0xe4,0x52,0x63,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xcd,0xe3,0xee,0xe4,0xee,0xe4,0x9c,0x83,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x7b,0xa3,0xee,0xe4,0xee,0xe4,0xee,0xa4,0x18,0xe2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0x83,0xde,0x64,0xee,0xe4,0xee,0xe4,0x83,0xa3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x8c,0x03,0xee,0xe4,0xee,0xe4,0xcd,0xe3,0x29,0x43,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x23,0xe6,0xa4,0xee,0xe4,0xee,0xc4,0x52,0x63,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xc5,0x83,0xee,0xe4,0xee,0xe4,0x9c,0x83,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x4a,0x42,0xee,0xe4,0xee,0xe4,0xee,0xc4,0x41,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xde,0x64,0xee,0xe4,0xee,0xe4,0x94,0x43,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x8c,0x03,0xee,0xe4,0xee,0xe4,0xde,0x64,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x42,0x03,0xe6,0xa4,0xee,0xe4,0xee,0xe4,0x52,0x62,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0x9c,0x63,0xee,0xe4,0xee,0xe4,0xbd,0x63,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x52,0x63,0xee,0xc4,0xee,0xe4,0xe6,0xa4,0x4a,0x23,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x24,0xd6,0x03,0xee,0xe4,0xee,0xe4,0x8c,0x23,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x7b,0x83,0xee,0xe4,0xee,0xe4,0xe6,0x84,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x3a,0xa8,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x05,0x63,0xcc,0x4a,0x89,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x63,0x6c,0x43,0x28,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x74,0x6f,0x63,0x2c,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x94,0xb2,0x53,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x22,0x05,0x3a,0xc7,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x6b,0x23,0xff,0x44,0xff,0x44,0xff,0x64,0x21,0x02,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xd6,0x24,0xff,0x44,0xff,0x64,0xa4,0xa3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x83,0xc3,0xff,0x64,0xff,0x64,0xee,0xa4,0x31,0x63,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x41,0xe3,0xee,0xe4,0xff,0x64,0xff,0x44,0x6b,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x44,0xff,0x64,0xbd,0x43,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x42,0x02,0xff,0x44,0xff,0x64,0xff,0x44,0x52,0x83,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xde,0x44,0xff,0x44,0xff,0x44,0xad,0x03,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x64,0xff,0x44,0xff,0x24,0x18,0xe2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xee,0xe4,0xff,0x44,0xff,0x64,0x83,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x94,0x43,0xff,0x44,0xff,0x64,0xde,0x64,0x29,0x43,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x43,0xf7,0x04,0xff,0x44,0xff,0x44,0x5a,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xcd,0xc3,0xff,0x44,0xff,0x64,0xac,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x52,0x63,0xff,0x64,0xff,0x64,0xff,0x24,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xee,0xc4,0xff,0x44,0xff,0x64,0x9c,0x83,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x94,0x43,0xff,0x64,0xff,0x44,0xf6,0xe4,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x42,0x03,0xf7,0x24,0xff,0x64,0xff,0x64,0x5a,0x83,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x64,0xff,0x44,0xcd,0xe3,0x29,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x52,0x83,0xff,0x24,0xff,0x44,0xf7,0x24,0x4a,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x24,0xde,0x44,0xff,0x64,0xff,0x44,0x9c,0x63,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x7b,0xa3,0xff,0x44,0xff,0x64,0xf7,0x04,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x32,0x47,0x19,0xe5,0x22,0x26,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x32,0x87,0x4b,0x4a,0x3a,0xc8,0x32,0x67,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x32,0xa8,0x19,0xe5,0x74,0x2f,0x5a,0xeb,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x5b,0xcc,0x9d,0x53,0x9d,0x53,0x9d,0x53,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x53,0x9d,0x53,0x95,0x12,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3a,0xc7,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x6b,0x23,0xff,0x44,0xff,0x44,0xff,0x64,0x21,0x02,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xd6,0x24,0xff,0x64,0xff,0x44,0xa4,0xa3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x83,0xc3,0xff,0x64,0xff,0x64,0xee,0xa4,0x31,0x63,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x41,0xe3,0xee,0xe4,0xff,0x44,0xff,0x44,0x6b,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x64,0xff,0x44,0xbd,0x43,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x42,0x02,0xff,0x44,0xff,0x44,0xff,0x44,0x52,0x83,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xde,0x44,0xff,0x64,0xff,0x44,0xad,0x03,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x64,0xff,0x44,0xff,0x24,0x18,0xe2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xee,0xe4,0xff,0x64,0xff,0x64,0x83,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x94,0x43,0xff,0x64,0xff,0x64,0xde,0x64,0x29,0x43,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x43,0xf7,0x04,0xff,0x44,0xff,0x44,0x5a,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xcd,0xc3,0xff,0x44,0xff,0x64,0xac,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x52,0x63,0xff,0x64,0xff,0x44,0xff,0x24,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xee,0xc4,0xff,0x44,0xff,0x64,0x9c,0x83,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x94,0x43,0xff,0x64,0xff,0x44,0xf6,0xe4,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x42,0x03,0xf7,0x24,0xff,0x44,0xff,0x64,0x5a,0x83,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x64,0xff,0x64,0xcd,0xe3,0x29,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x52,0x83,0xff,0x24,0xff,0x44,0xf7,0x24,0x4a,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x24,0xde,0x44,0xff,0x64,0xff,0x64,0x9c,0x63,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x7b,0xa3,0xff,0x44,0xff,0x64,0xf7,0x04,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x2a,0x06,0x7c,0x70,0xd6,0xba,0xef,0x5d,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xe7,0x5c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5c,0xef,0x5d,0xe7,0x5c,0xef,0x5d,0xc6,0x79,0x3a,0xc8,0x74,0x2f,0x5a,0xeb,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe7,0x22,0x46,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x31,0xa6,0x4a,0x22,0xa4,0xa3,0xa4,0xa3,0xa4,0xa3,0x18,0xe2,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x8c,0x03,0xa4,0xa3,0xa4,0xa3,0x6b,0x02,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x52,0x62,0xa4,0xa3,0xa4,0xa3,0x94,0x43,0x29,0x23,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x63,0x94,0x43,0xa4,0xa3,0xa4,0xa3,0x42,0x02,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x6b,0x03,0xa4,0xa3,0xa4,0xa3,0x7b,0x63,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0x82,0xa4,0xa3,0xa4,0xa3,0xa4,0xa3,0x41,0xe2,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0x8b,0xe3,0xa4,0xa3,0xa4,0xa3,0x73,0x43,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x52,0x62,0xa4,0xa3,0xa4,0xa3,0xa4,0xa3,0x18,0xc2,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x03,0x94,0x43,0xa4,0xa3,0xa4,0xa3,0x4a,0x42,0x29,0x65,0x39,0xe7,0x39,0xe7,0x21,0x24,0x62,0xc3,0xa4,0xa3,0xa4,0xa3,0x94,0x23,0x21,0x23,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0x9c,0x83,0xa4,0xa3,0xa4,0xa3,0x41,0xe2,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0x83,0xc3,0xa4,0xa3,0xa4,0xa3,0x73,0x43,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0x86,0x39,0xa2,0xa4,0xa3,0xa4,0xa3,0x9c,0xa3,0x31,0x82,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x94,0x43,0xa4,0xa3,0xa4,0xa3,0x62,0xe2,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x62,0xc2,0xa4,0xa3,0xa4,0xa3,0x9c,0x63,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0x83,0x9c,0x83,0xa4,0xa3,0xa4,0xa3,0x39,0xc2,0x31,0x86,0x39,0xe7,0x39,0xe7,0x21,0x24,0x6b,0x23,0xa4,0xa3,0xa4,0xa3,0x83,0xc3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x39,0xa2,0x9c,0x83,0xa4,0xa3,0x9c,0x83,0x39,0xa2,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x83,0xe3,0xa4,0xa3,0xa4,0xa3,0x62,0xe3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x4a,0x22,0xa4,0xa3,0xa4,0xa3,0x9c,0x63,0x21,0x03,0x39,0xc7,0x39,0xe7,0x8c,0x71,0xff,0xdf,0xff,0xff,0xff,0xff,0xad,0xd6,0x7c,0x4f,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x8c,0xd1,0x9d,0x54,0xd6,0xba,0xe7,0x3c,0xd6,0xba,0xd6,0xda,0xff,0xff,0x9d,0x73,0x84,0x90,0x5a,0xeb,0x31,0x86,0x29,0x63,0x42,0x03,0x42,0x03,0x39,0xc3,0x18,0xe3,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x32,0xc7,0x3b,0x08,0x2a,0x86,0x32,0xc7,0x32,0xa7,0x2a,0x66,0x22,0x26,0x19,0xe5,0x22,0x26,0x3a,0xe7,0x2a,0x46,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x39,0xe7,0x39,0xc7,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0x86,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x65,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x31,0x86,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x65,0x39,0xe7,0x39,0xe7,0xce,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x63,0xcd,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x7c,0x70,0xad,0xb5,0xef,0x5d,0xa5,0x94,0xb5,0xf6,0xef,0x7d,0xff,0xff,0xf7,0xbe,0xad,0xb5,0x5a,0xeb,0x29,0x65,0x83,0xc3,0xf6,0xe4,0xf6,0xe4,0xde,0x64,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x42,0xe9,0x53,0x6a,0x22,0x05,0x53,0x6b,0x32,0x88,0x2a,0x47,0x32,0x67,0x22,0x26,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x4a,0x69,0x42,0x28,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x3a,0x07,0x39,0xe7,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x4a,0x69,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x39,0xe7,0x39,0xe7,0x42,0x28,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x4a,0x69,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x42,0x28,0x42,0x28,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x3a,0x07,0x4a,0x89,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x4a,0x69,0x42,0x49,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x3a,0x07,0x4a,0x69,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x42,0x48,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x42,0x28,0x42,0x48,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xce,0x79,0x95,0x13,0xff,0xff,0xf7,0x9e,0xff,0xff,0xff,0xff,0xe7,0x3c,0x8c,0xb2,0xf7,0xbe,0x8c,0xf1,0xb5,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xd6,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x3a,0xa8,0xce,0x79,0xef,0x5d,0xac,0xf2,0x94,0x2e,0x93,0xee,0xc5,0xf7,0xe7,0x3c,0xce,0x79,0x2a,0x66,0x19,0xe5,0x63,0xad,0x8c,0xf1,0x64,0x0d,0x95,0x53,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x90,0xe7,0x5c,0xc6,0x58,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x47,0x7c,0x2f,0xe7,0x5c,0xd6,0xdb,0x53,0x2b,0x32,0x87,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x8c,0xd1,0xef,0x7d,0xbe,0x38,0x4b,0x4a,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x32,0xa7,0x53,0x4b,0xde,0xdb,0xef,0x5d,0x74,0x0f,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x4a,0xbe,0x17,0xef,0x7d,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xce,0x79,0xe7,0x3c,0x6b,0xce,0x32,0x87,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x3a,0xc8,0x95,0x32,0xef,0x9d,0xad,0xd5,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xd6,0xba,0xdf,0x1b,0x63,0xed,0x19,0xe5,0x32,0xa7,0x32,0x87,0x19,0xe5,0x42,0xe8,0xad,0xd6,0xef,0x7d,0xa5,0x74,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4f,0xe7,0x3c,0xce,0x99,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x3a,0xc7,0x63,0xcc,0xd6,0xba,0xe7,0x1c,0x74,0x2e,0x3a,0xc7,0x3a,0xc7,0x32,0xa7,0x21,0xe5,0x2a,0x47,0xad,0xb5,0xf7,0xbe,0xa5,0x75,0x32,0x47,0x19,0xe5,0x19,0xe5,0x94,0xf3,0xff,0xff,0xff,0xff,0xff,0xdf,0xbd,0xd7,0x9d,0x13,0xc6,0x38,0xef,0x5d,0x8c,0xb1,0xff,0xff,0xd6,0xda,0xb5,0xb6,0xa5,0x54,0xff,0xff,0xad,0xd5,0xbe,0x58,0xff,0xff,0xff,0xff,0xad,0xd5,0x84,0xd1,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xe7,0x3c,0xff,0xdf,0xcd,0x94,0xbc,0xd0,0xbc,0xd0,0xde,0x79,0xf7,0x9e,0xde,0xfb,0x22,0x05,0x32,0xa8,0xb5,0xf7,0x64,0x0d,0x53,0x8a,0x7c,0x6f,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x4a,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x84,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xb5,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x8c,0xd2,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0x68,0xc6,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x63,0xad,0x19,0xe5,0x19,0xe5,0x94,0xf3,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xb9,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x32,0x87,0x19,0xe5,0x4b,0x0a,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x95,0x33,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xdf,0x9d,0x34,0x3a,0xe8,0x32,0x87,0x53,0x4b,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfa,0x5b,0xab,0x3b,0x08,0x43,0x49,0xb5,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x95,0x12,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x8c,0xd2,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0x95,0x19,0xe5,0x19,0xe5,0x53,0x2b,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x53,0x2b,0x19,0xe5,0x19,0xe5,0x95,0x33,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xde,0xfb,0x4b,0x49,0x84,0xd1,0x5a,0xeb,0x29,0x65,0x39,0xc2,0x6b,0x23,0x6b,0x23,0x62,0xe3,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x5b,0x8c,0xe7,0x1c,0xf7,0xbe,0xc5,0x74,0xb4,0x90,0xac,0x90,0xde,0x78,0xef,0x7d,0xde,0xdb,0x22,0x05,0x3a,0xc8,0xad,0xb5,0x4b,0x6a,0x43,0x28,0x9d,0x53,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xff,0xdf,0xf7,0x9e,0xf7,0x9e,0xff,0xff,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xf7,0x9e,0xef,0x9d,0xff,0xdf,0xf7,0xbe,0xff,0xdf,0xd6,0xda,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x63,0xed,0xff,0xdf,0xf7,0xde,0xef,0x9d,0xf7,0xbe,0xff,0xff,0xb5,0xf6,0x2a,0x66,0x32,0x87,0xe7,0x3c,0xf7,0xbe,0xff,0xff,0xf7,0xbe,0xf7,0xbe,0xff,0xdf,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb6,0x16,0xff,0xff,0xf7,0xbe,0xef,0x7d,0xff,0xdf,0xff,0xff,0x74,0x8f,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xff,0xff,0xf7,0x9e,0xef,0x9e,0xff,0xdf,0xff,0xff,0x4a,0xea,0x2a,0x46,0x84,0xd1,0xff,0xff,0xf7,0xbe,0xef,0x9d,0xf7,0xbe,0xff,0xff,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xff,0xff,0xf7,0x9e,0xf7,0x9e,0xff,0xdf,0xf7,0xbe,0x4b,0x49,0x32,0x87,0x95,0x33,0xff,0xff,0xf7,0xbe,0xef,0x7d,0xf7,0xbe,0xff,0xff,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0xff,0xdf,0xf7,0x9e,0xf7,0x9e,0xff,0xff,0xde,0xfb,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0xe7,0x3c,0xff,0xff,0xf7,0x9e,0xef,0x9d,0xff,0xdf,0xff,0xff,0x2a,0x87,0x2a,0x66,0x95,0x13,0xff,0xdf,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xff,0xff,0x94,0xf3,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x27,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x4b,0x2a,0x4b,0x4a,0x3a,0xa8,0x3a,0x88,0x4b,0x2a,0x53,0x6a,0x53,0x6a,0x4b,0x49,0x3b,0x08,0x84,0xd1,0x5a,0xeb,0x31,0xa6,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x22,0x06,0x53,0x6b,0x5b,0x8c,0x42,0xea,0x84,0x70,0x63,0xad,0x53,0x6c,0x6c,0x0d,0x4b,0x0a,0x19,0xe5,0x32,0xa7,0x8c,0xf1,0xa5,0x74,0x4b,0x49,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0xa5,0x94,0xad,0xb5,0x9d,0x54,0xc6,0x79,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x42,0xc9,0xef,0x7d,0x9d,0x53,0xef,0x7d,0x94,0xf2,0xad,0xb5,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0xbe,0x95,0x32,0xad,0x95,0x95,0x33,0xd6,0xda,0xbe,0x37,0x3b,0x08,0x43,0x08,0xe7,0x3c,0xad,0xb5,0xef,0x9d,0x95,0x12,0x9d,0x13,0xf7,0xbe,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb6,0x16,0xd6,0xfb,0x9d,0x53,0xa5,0x95,0x95,0x33,0xf7,0xbe,0x74,0x6f,0x3a,0xe8,0x3a,0xe7,0xd6,0xda,0xc6,0x58,0xa5,0x54,0xad,0xb5,0xa5,0x74,0xff,0xdf,0x53,0x4b,0x3a,0xe8,0x8c,0xd1,0xf7,0x9e,0x9d,0x74,0xad,0xb5,0x9d,0x53,0xdf,0x1b,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xb5,0xf6,0xa5,0x74,0xa5,0x94,0x9d,0x73,0xf7,0x9e,0x4b,0x49,0x32,0x87,0x95,0x33,0xe7,0x3c,0x9d,0x53,0xa5,0x95,0x84,0xd1,0xf7,0xbe,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0xa5,0x94,0xad,0xb5,0xad,0xb5,0xc6,0x78,0xde,0xfb,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xe7,0x3c,0xbe,0x37,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xff,0xff,0x3b,0x08,0x3b,0x08,0x9d,0x53,0xce,0x99,0xce,0x79,0xa5,0x75,0x9c,0xf3,0xd6,0xba,0x94,0xf3,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0x5a,0xeb,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0x64,0x0d,0x64,0x0d,0x5b,0xab,0x3b,0x08,0x3a,0xe7,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x32,0xc7,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xbe,0xad,0xb5,0xce,0x79,0xe7,0x3c,0xa5,0x94,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x42,0xc9,0xf7,0x9e,0x95,0x32,0xb5,0xd6,0xbe,0x17,0xb5,0xd6,0xd6,0xda,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x5b,0xad,0xef,0x5d,0xa5,0x95,0xa5,0x95,0xdf,0x1b,0xb5,0xf7,0xad,0xd6,0x22,0x25,0x22,0x26,0xe7,0x1c,0xad,0xb5,0xad,0xb5,0xad,0xd6,0xb5,0xb6,0xf7,0xbe,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb6,0x16,0xb5,0xf6,0xd6,0xda,0xad,0xb6,0xb5,0xd6,0xe7,0x1c,0x63,0xcd,0x1a,0x05,0x19,0xe5,0xd6,0xba,0x9d,0x53,0xd6,0xda,0xce,0x99,0xb5,0xb6,0xf7,0x9e,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xdf,0x1b,0xc6,0x58,0xc6,0x58,0xdf,0x1b,0xb6,0x16,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xa5,0x74,0xde,0xfb,0xde,0xfb,0x95,0x33,0xef,0x7d,0x4b,0x49,0x32,0x87,0x95,0x33,0xce,0x99,0xce,0x99,0xb6,0x17,0xbe,0x37,0xde,0xfb,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0x9e,0x95,0x12,0xc6,0x58,0xe7,0x3c,0xad,0xd6,0xde,0xfb,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3a,0xe8,0x2a,0x66,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0xe7,0x3c,0x8c,0xd2,0xce,0x9a,0xce,0x99,0xa5,0x75,0xf7,0xbe,0x22,0x26,0x22,0x25,0x94,0xf2,0xde,0xdb,0x95,0x13,0x7c,0x50,0xde,0xfb,0xc6,0x58,0x94,0xf3,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x47,0x5b,0x8c,0x8c,0xb1,0x8c,0xb2,0x8c,0xb2,0x8c,0xb2,0x8c,0xb2,0x94,0xf2,0x95,0x33,0x94,0xf2,0x8c,0xb2,0x8c,0xd2,0x95,0x33,0x84,0xd0,0x43,0x28,0x84,0xd1,0x5a,0xeb,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xce,0x99,0xb5,0xd6,0xad,0xd6,0x32,0xc7,0x63,0xad,0x8c,0xb1,0x8c,0xb1,0x8c,0xb1,0x8c,0xb1,0x8c,0xb1,0x8c,0xb1,0x8c,0xb2,0x63,0xcd,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0xa5,0xb5,0x9d,0x74,0xd6,0xda,0xd6,0xda,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x53,0x8b,0xf7,0xbe,0xe7,0x5c,0xce,0x99,0xf7,0xbe,0xe7,0x3c,0xd6,0xda,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x5b,0xad,0xf7,0xbe,0x84,0x91,0x84,0xb1,0xd6,0x9a,0xdf,0x1b,0xad,0xd6,0x22,0x25,0x22,0x26,0xe7,0x1c,0xf7,0x9e,0xce,0x99,0xef,0x7d,0xe7,0x3c,0xf7,0xdf,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb6,0x16,0xde,0xfb,0x8c,0xd2,0xad,0xb6,0xad,0xb6,0xf7,0xbe,0x63,0xed,0x22,0x46,0x22,0x46,0xd6,0xba,0xc6,0x78,0x8d,0x12,0xc6,0x58,0xc6,0x38,0xff,0xdf,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xef,0x9d,0xa5,0x74,0xa5,0xb5,0xce,0x99,0xe7,0x5c,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xbe,0x37,0x9d,0x53,0xd6,0xba,0xce,0x79,0xf7,0x9e,0x4b,0x49,0x32,0x87,0x95,0x33,0xe7,0x5c,0x9d,0x53,0xad,0xf6,0xb6,0x17,0xf7,0xbe,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0x9d,0x73,0x95,0x32,0xde,0xfb,0xd6,0xda,0xde,0xfb,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0xe7,0x3c,0xb5,0xf7,0x84,0xb1,0xc6,0x59,0xbe,0x17,0xff,0xff,0x19,0xe5,0x19,0xc5,0x8c,0xd2,0xff,0xff,0xce,0x9a,0xd6,0xda,0xf7,0x9e,0xef,0x7d,0x94,0xf3,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x32,0x88,0xc6,0x58,0xff,0xdf,0xff,0xff,0xf7,0xbe,0xd6,0xba,0xdf,0x1b,0xf7,0x9e,0xde,0xfb,0xf7,0x9e,0xff,0xff,0xf7,0x9e,0xef,0x7d,0xff,0xff,0xff,0xdf,0x7c,0x6f,0x84,0xd1,0x5a,0xeb,0x31,0xa6,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xb5,0xf6,0xbe,0x37,0x95,0x12,0x22,0x05,0x42,0xc9,0x74,0x0e,0x6b,0xee,0x6b,0xce,0x63,0x0b,0x6b,0x2c,0x6b,0x2c,0x6b,0x2c,0x42,0xe9,0x22,0x46,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0x9d,0x53,0x95,0x12,0x7c,0x6f,0xad,0xd5,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x5b,0xcb,0xf7,0x9e,0xe7,0x1c,0xad,0x95,0x9d,0x53,0xbe,0x57,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0x9e,0x9d,0x53,0x95,0x32,0x74,0x6e,0xb6,0x16,0xbe,0x37,0x3b,0x08,0x43,0x08,0xe7,0x3c,0xef,0x5d,0xb5,0xf6,0x9d,0x53,0xa5,0x54,0xf7,0xbe,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb6,0x16,0xce,0xba,0x84,0x91,0x8c,0xf1,0x74,0x4e,0xef,0x7d,0x74,0x6f,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xbe,0x37,0x84,0x91,0x7c,0x70,0x7c,0x6f,0xf7,0xbe,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xef,0x9d,0x9d,0x73,0x8d,0x12,0x6c,0x4e,0xc6,0x58,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xb5,0xf6,0x95,0x32,0x84,0xd0,0x7c,0xb0,0xef,0x9d,0x4b,0x49,0x32,0x87,0x95,0x33,0xdf,0x1b,0x95,0x32,0x95,0x12,0x64,0x0d,0xe7,0x3c,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0x9d,0x53,0x95,0x32,0x7c,0xb0,0xa5,0x74,0xde,0xfb,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0xe7,0x1c,0xad,0xb6,0x84,0x91,0x74,0x2f,0x74,0x2f,0xff,0xdf,0x19,0xe5,0x19,0xc5,0x8c,0xd2,0xff,0xdf,0xc6,0x58,0xa5,0x54,0x84,0x91,0xe7,0x1c,0x94,0xf3,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x84,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x54,0xc6,0x18,0xa5,0x54,0xb5,0xd6,0xa5,0x54,0x6c,0x0e,0xe7,0x5c,0xb5,0xd6,0x95,0x33,0xff,0xff,0xff,0xff,0xe7,0x5c,0x95,0x12,0x5a,0xeb,0x29,0x65,0x62,0xe2,0xac,0xc3,0xac,0xc3,0x94,0x43,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x33,0x63,0xec,0x53,0x8a,0x6c,0x0d,0x19,0xe5,0x74,0x0f,0xe7,0x3c,0xe7,0x3c,0xd6,0x99,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x3a,0x47,0x32,0xc7,0x19,0xe5,0x2a,0x87,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0x84,0xb0,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xdf,0x1b,0xa5,0x94,0xbe,0x37,0xf7,0xbe,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x53,0x6b,0xf7,0x9e,0x7c,0x50,0x8c,0xd1,0xde,0xfb,0xff,0xff,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xdf,0x1b,0xad,0x95,0xb6,0x17,0xf7,0xbe,0xbe,0x37,0x3b,0x08,0x43,0x28,0xe7,0x3c,0x94,0xf2,0x63,0xcd,0xce,0x99,0xff,0xdf,0xff,0xdf,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0xad,0xd6,0xff,0xdf,0xc6,0x78,0x9d,0x53,0xd6,0xda,0xff,0xff,0x63,0xad,0x19,0xe5,0x19,0xe5,0xd6,0xba,0xf7,0xbe,0xad,0xd6,0xa5,0x94,0xdf,0x1b,0xff,0xff,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xff,0xff,0xd6,0xba,0xad,0xb5,0xc6,0x78,0xff,0xdf,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xef,0x7d,0xb5,0xf6,0xb5,0xd6,0xe7,0x3c,0xf7,0xbe,0x4b,0x49,0x32,0x87,0x95,0x33,0xff,0xdf,0xce,0x99,0xa5,0x94,0xce,0xb9,0xff,0xff,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0xe7,0x5c,0xa5,0x94,0xad,0xd6,0xf7,0x9e,0xde,0xfb,0x4b,0x49,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0xe7,0x3c,0xef,0x7d,0xb5,0xb6,0x9d,0x33,0xe7,0x3c,0xff,0xff,0x19,0xe5,0x19,0xe5,0x8c,0xd2,0xde,0xfb,0x5b,0x4c,0xa5,0x75,0xf7,0x9e,0xff,0xff,0x94,0xf3,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x84,0x91,0x9d,0x54,0xb5,0xd6,0xc6,0x58,0xbe,0x17,0xd6,0x9a,0xa5,0x54,0xa5,0x94,0xf7,0x9e,0xff,0xff,0xff,0xff,0xdf,0x1b,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xd5,0xc6,0x58,0x6c,0x0d,0xb5,0xf6,0x19,0xe5,0x6b,0xce,0xce,0x99,0xd6,0x99,0xc6,0x37,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x3a,0x47,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x42,0xe9,0xe7,0x3c,0x95,0x12,0xbe,0x37,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xbe,0x74,0x4f,0x95,0x33,0x9d,0x54,0xc6,0x79,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x87,0x3a,0xc9,0xf7,0x9e,0xff,0xff,0xef,0x9d,0xbe,0x37,0xbe,0x17,0xd6,0xfb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x7d,0x74,0x4f,0x9d,0x33,0x9d,0x54,0xce,0xba,0xbe,0x37,0x3b,0x08,0x43,0x28,0xe7,0x3c,0xff,0xff,0xf7,0xbe,0xc6,0x79,0x9d,0x33,0xf7,0xbe,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x1a,0x05,0xad,0xb5,0xc6,0x78,0x7c,0x6f,0x94,0xf3,0x9d,0x13,0xef,0x7d,0x6c,0x0e,0x2a,0x46,0x2a,0x46,0xd6,0xba,0xa5,0x74,0x84,0xb1,0x9d,0x54,0xa5,0x95,0xf7,0xbe,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xe7,0x5c,0x7c,0x6f,0x9d,0x53,0x9d,0x54,0xd6,0xda,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0x9d,0x53,0x95,0x12,0x9d,0x54,0xb5,0xf6,0xf7,0x9e,0x4b,0x49,0x32,0x87,0x95,0x33,0xd6,0xda,0x7c,0x4f,0x9d,0x33,0x9d,0x54,0xef,0x7d,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0x6c,0x2e,0x95,0x12,0x9d,0x54,0xc6,0x58,0xde,0xfb,0x4b,0x49,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0xe7,0x1c,0x94,0xf2,0x84,0x50,0x9c,0xf3,0xad,0x95,0xff,0xdf,0x19,0xe5,0x19,0xc5,0x8c,0xd2,0xff,0xff,0xff,0xff,0xe7,0x1c,0x8c,0xd2,0xde,0xdb,0x94,0xf3,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x94,0xf3,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x38,0xd6,0xdb,0xa5,0x54,0xa5,0x54,0xb5,0xd6,0x84,0xb1,0xc6,0x58,0x5b,0x8c,0x7c,0x6f,0xc6,0x78,0xff,0xff,0xf7,0xbe,0x9d,0x34,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0x5b,0xcc,0xad,0xd5,0x64,0x0d,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x32,0x87,0x5a,0xaa,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x42,0xa9,0x4b,0x29,0x32,0x67,0x2a,0x47,0x1a,0x05,0x63,0xcd,0xdf,0x1c,0xa5,0x74,0xbe,0x37,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0xa5,0x74,0x9d,0x73,0x9d,0x73,0xbe,0x37,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x42,0xe9,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfa,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0x9e,0x9d,0x73,0x9d,0x73,0x9d,0x73,0xce,0xb9,0xbe,0x37,0x3b,0x08,0x43,0x28,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x1a,0x05,0x19,0xe5,0xad,0xd6,0xd6,0xda,0x8c,0xf2,0x8c,0xd2,0x95,0x33,0xf7,0x9e,0x74,0x8f,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xbe,0x57,0x9d,0x73,0x9d,0x73,0xa5,0x94,0xf7,0xbe,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xef,0x5d,0x9d,0x74,0x9d,0x73,0x9d,0x73,0xce,0xb9,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xb5,0xf6,0x9d,0x73,0x9d,0x73,0xad,0xd5,0xf7,0x9e,0x4b,0x49,0x32,0x87,0x95,0x33,0xdf,0x1b,0x9d,0x73,0x9d,0x73,0x95,0x53,0xef,0x7d,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0x9d,0x73,0x9d,0x73,0x9d,0x73,0xc6,0x58,0xde,0xfb,0x3a,0xe8,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0xe7,0x3c,0xad,0xb5,0x8c,0xd2,0x8c,0xd2,0x9d,0x54,0xff,0xdf,0x19,0xe5,0x19,0xc5,0x8c,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x94,0xf3,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x32,0x67,0xde,0xfb,0xff,0xff,0xff,0xff,0xef,0x7d,0x9d,0x74,0xbe,0x38,0xdf,0x1c,0x9d,0x54,0xce,0x79,0xef,0x7d,0xe7,0x3c,0xf7,0xbe,0xe7,0x1c,0xff,0xff,0x95,0x13,0x74,0x2f,0x5a,0xeb,0x29,0x65,0x73,0x43,0xde,0x44,0xde,0x44,0xcd,0xc3,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x32,0x74,0x6f,0xad,0xd5,0x64,0x0d,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x2a,0x66,0x32,0x87,0x5a,0xaa,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xb5,0x96,0xde,0xda,0xe7,0x1c,0xc6,0x58,0xb5,0xf6,0x74,0x4e,0x8c,0x91,0xa5,0x54,0x9d,0x53,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xbe,0xa5,0x94,0xef,0x5d,0xde,0xfb,0xad,0xd6,0xd6,0xda,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x05,0x53,0x6a,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xb9,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xef,0x7d,0xad,0xb5,0xef,0x5d,0xd6,0xda,0xc6,0x58,0xbe,0x37,0x3b,0x08,0x43,0x08,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x2a,0x66,0x1a,0x05,0x19,0xe5,0x32,0xa7,0xb6,0x16,0xad,0xb5,0xce,0x79,0xef,0x5d,0xad,0xd6,0xef,0x5d,0x74,0x8f,0x3b,0x08,0x3b,0x08,0xd6,0xda,0x9d,0x73,0xe7,0x1c,0xef,0x5d,0xad,0xb5,0xf7,0xbe,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xde,0xfb,0xbe,0x37,0xef,0x5d,0xd6,0xba,0xbe,0x37,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xa5,0x74,0xef,0x5d,0xe7,0x3c,0x95,0x12,0xef,0x9d,0x4b,0x49,0x32,0x87,0x95,0x33,0xc6,0x78,0xc6,0x78,0xef,0x5d,0xb5,0xf6,0xe7,0x3c,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0x95,0x32,0xef,0x5d,0xde,0xfb,0xb5,0xd6,0xde,0xfb,0x2a,0x47,0x22,0x05,0x3a,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0xe7,0x1c,0x84,0xb1,0xe7,0x3c,0xe7,0x5d,0x94,0xf3,0xf7,0xbe,0x19,0xe5,0x19,0xc5,0x7c,0x50,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x0f,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x3a,0xa9,0x8c,0xb1,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xd6,0xa5,0x74,0x43,0x29,0x84,0xb0,0x5a,0xeb,0x31,0x86,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0xb5,0x95,0x32,0x84,0xd1,0x74,0x4e,0x3a,0xe8,0x2a,0x87,0x19,0xe5,0x2a,0x66,0x32,0x87,0x5a,0xaa,0x62,0xeb,0x62,0xeb,0x62,0xeb,0xb5,0x75,0xd6,0xba,0xe7,0x1c,0xc6,0x58,0xbe,0x36,0x7c,0x8f,0x9d,0x33,0x9d,0x34,0xbe,0x17,0x63,0xcc,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x6b,0xed,0xff,0xdf,0x9d,0x53,0xad,0xb6,0xa5,0x54,0xd6,0xba,0xd6,0xda,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x1a,0x05,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x43,0x08,0xa5,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x84,0xd0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xf7,0xde,0x8d,0x12,0xb5,0xf6,0x9d,0x53,0xde,0xfb,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0x22,0x26,0x32,0xa7,0x3a,0xe8,0xb5,0xf6,0xd6,0xba,0x8c,0xd2,0xb5,0xf6,0x95,0x32,0xff,0xdf,0x74,0x8f,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xc6,0x78,0x9d,0x74,0xa5,0x95,0xad,0xb5,0xff,0xff,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xef,0x7d,0x9d,0x53,0xb5,0xd6,0x9d,0x53,0xe7,0x3c,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xa5,0x74,0xa5,0x54,0x9d,0x34,0xbe,0x17,0xf7,0xbe,0x4b,0x49,0x32,0x87,0x95,0x33,0xe7,0x3c,0x95,0x32,0xb5,0xf6,0x8c,0xf2,0xff,0xdf,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0xad,0xb5,0xb5,0xd6,0xa5,0x74,0xce,0x99,0xde,0xdb,0x32,0x67,0x3a,0xc7,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0xe7,0x3c,0xad,0xb6,0x94,0xf3,0x9d,0x34,0xa5,0x74,0xff,0xff,0x22,0x05,0x1a,0x05,0x32,0xa8,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x42,0xc9,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x1a,0x05,0x2a,0x46,0x84,0xb0,0x5a,0xeb,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x32,0x87,0x22,0x26,0x22,0x05,0x22,0x25,0x22,0x05,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x32,0x87,0x5a,0xaa,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x42,0x68,0x3a,0xa8,0x3a,0xa8,0x32,0x88,0x22,0x05,0x22,0x26,0x84,0xb1,0x8c,0xb1,0x3a,0xa8,0x32,0x67,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x5b,0x6c,0xff,0xff,0xf7,0xdf,0xef,0x5d,0xef,0x7d,0xff,0xff,0xd6,0xba,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x43,0x49,0x9d,0x74,0xdf,0x1b,0xde,0xfb,0x8c,0xf1,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xf7,0xbe,0xef,0x5d,0xf7,0x9e,0xff,0xff,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x7c,0x50,0xce,0x99,0xdf,0x1b,0xa5,0x74,0x2a,0x67,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x2a,0x66,0x7c,0x8f,0x5b,0xcb,0x22,0x46,0xad,0xb5,0xff,0xff,0xef,0x9d,0xef,0x5d,0xf7,0xde,0xff,0xff,0x74,0x8f,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xff,0xff,0xf7,0x9e,0xef,0x5d,0xf7,0xde,0xff,0xff,0x5b,0xcc,0x3b,0x08,0x8c,0xd1,0xff,0xff,0xf7,0xbe,0xef,0x5d,0xef,0x9d,0xff,0xff,0xbe,0x37,0x3b,0x08,0x3b,0x08,0xef,0x7d,0xff,0xdf,0xef,0x5d,0xe7,0x5c,0xff,0xdf,0xf7,0xbe,0x4b,0x49,0x32,0x87,0x95,0x33,0xff,0xff,0xef,0x9e,0xef,0x5d,0xf7,0xbe,0xff,0xff,0x8c,0xf1,0x3b,0x08,0x64,0x0d,0xf7,0xbe,0xff,0xdf,0xef,0x7d,0xef,0x7d,0xff,0xff,0xde,0xfb,0x43,0x29,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3a,0xe7,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0xe7,0x3c,0xff,0xff,0xef,0x7d,0xef,0x5d,0xff,0xdf,0xff,0xff,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x63,0xec,0xbe,0x37,0xe7,0x3c,0xc6,0x78,0x64,0x0d,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x84,0xd0,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x5b,0x6c,0x63,0xad,0x63,0xcd,0x19,0xe5,0x22,0x05,0x63,0xad,0xce,0x79,0xce,0x79,0xbd,0xf6,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x3a,0x67,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x5b,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xc7,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x19,0xe5,0x2a,0x67,0x4b,0x49,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0xbe,0x57,0x74,0x4d,0x19,0xc5,0xa5,0x75,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x6f,0x3b,0x08,0x3b,0x08,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x53,0x8b,0x3b,0x08,0x7c,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x3b,0x08,0x3a,0xe8,0xe7,0x5d,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0xdf,0xf7,0x9e,0x4b,0x29,0x32,0x87,0x8c,0xf2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0xf1,0x3b,0x08,0x63,0xec,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfb,0x43,0x49,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x32,0x87,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x2a,0x66,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x66,0x32,0xa8,0x2a,0x67,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x32,0x87,0x74,0x4f,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x84,0xd1,0x74,0x4f,0x2a,0x67,0x7c,0x70,0x5a,0xeb,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x2a,0x47,0xce,0x59,0xe7,0x3c,0xe7,0x3c,0x5b,0x8c,0x3a,0xe7,0x84,0x90,0xef,0x5d,0xef,0x5d,0xd6,0xba,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x42,0xa8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0xd1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x22,0x46,0x22,0x05,0x19,0xe5,0x19,0xe5,0x32,0x87,0x22,0x26,0x19,0xe5,0x74,0x0f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x42,0xe9,0x22,0x25,0x22,0x25,0x84,0x91,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x2a,0x46,0x22,0x25,0x42,0xe9,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x63,0xcd,0x22,0x25,0x22,0x05,0xb5,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0x3a,0xe8,0x32,0x87,0x5b,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x63,0xec,0x3b,0x08,0x43,0x08,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x9d,0x54,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x2a,0x47,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xdf,0xde,0xdb,0xe7,0x3c,0xff,0xff,0xe7,0x3c,0xde,0xfb,0xff,0xff,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xdf,0x53,0x6c,0x74,0x2f,0x5a,0xeb,0x29,0x65,0x10,0xa2,0x10,0xa2,0x10,0xa2,0x10,0xa2,0x18,0xc3,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x2a,0x47,0xd6,0x9a,0xef,0x7d,0xef,0x7d,0x63,0xcd,0x2a,0x46,0x21,0xe5,0x4b,0x0a,0x5b,0x6c,0x63,0xcc,0x5a,0xaa,0x62,0xcb,0x62,0xcb,0x62,0xcb,0x32,0x27,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x4b,0x2b,0xe7,0x3c,0xff,0xdf,0xf7,0xbe,0xb5,0xd6,0x22,0x06,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xef,0x7d,0xff,0xdf,0xf7,0xbe,0xb5,0xf6,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x3b,0x08,0x2a,0x86,0x19,0xc5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x2a,0x26,0xa5,0x54,0xf7,0xbe,0xff,0xdf,0xef,0x7d,0x7c,0x50,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0xb5,0xf6,0xff,0xdf,0xff,0xdf,0xe7,0x3c,0x5b,0x6c,0x22,0x05,0x22,0x05,0x22,0x05,0x74,0x4f,0xef,0x9d,0xff,0xdf,0xf7,0x9e,0x9d,0x54,0x22,0x05,0x22,0x05,0x22,0x05,0x3a,0xe8,0xd6,0xda,0xff,0xdf,0xff,0xdf,0xd6,0xda,0x42,0xc9,0x32,0xc7,0x32,0x87,0x22,0x05,0x95,0x13,0xf7,0xbe,0xff,0xdf,0xf7,0xbe,0x95,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xdf,0x1c,0xff,0xdf,0xf7,0xbe,0xc6,0x78,0x3a,0xc8,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x32,0x87,0x32,0x87,0x32,0xc8,0x22,0x05,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0xc6,0x58,0xff,0xdf,0xff,0xdf,0xde,0xfb,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0xb5,0xf6,0xad,0xd6,0xde,0xfb,0x9d,0x53,0xb5,0xd6,0xde,0xfb,0x9d,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x8c,0xf2,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0x87,0x2a,0x26,0x5b,0x2c,0x5a,0xeb,0x5a,0xeb,0x3a,0x88,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x22,0x25,0x43,0x08,0x8c,0xb1,0x94,0xd2,0x95,0x12,0x95,0x12,0x5b,0x8c,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x2a,0x67,0x63,0xcd,0x4b,0x2a,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x22,0x46,0x2a,0x66,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x6c,0x2e,0x63,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x1a,0x05,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0x74,0x2e,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xcc,0x6c,0x2d,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x6c,0x2e,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x53,0x4b,0x5b,0xac,0x32,0x67,0x19,0xe5,0x32,0xc7,0x32,0x87,0x19,0xe5,0x32,0xa7,0x53,0x8b,0x74,0x4e,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x2a,0x47,0x6c,0x2e,0x5b,0xcc,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x46,0x3b,0x08,0x2a,0x87,0x22,0x05,0x7c,0x8f,0xe7,0x1b,0x3a,0xe8,0x19,0xe5,0x2a,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x63,0xec,0x6c,0x2d,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0xa5,0x74,0xad,0xb5,0xc6,0x99,0xbe,0x37,0xff,0xff,0xff,0xdf,0x9d,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x6b,0xee,0x5a,0xeb,0x29,0x66,0x29,0x65,0x9c,0xf3,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x25,0x32,0xc7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x2a,0x46,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x32,0xa7,0x19,0xc5,0x32,0xc7,0x32,0x87,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x4b,0x29,0x6c,0x0d,0x3b,0x08,0x22,0x05,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xc6,0x78,0x6c,0x2c,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x99,0xc6,0x78,0xa5,0x74,0xbe,0x38,0x9d,0x74,0xc6,0x58,0xde,0xfb,0x84,0xb1,0xd6,0xda,0xef,0x7d,0xff,0xff,0xef,0x5d,0x9d,0x74,0x5a,0xeb,0x29,0x65,0x8c,0x03,0xff,0x44,0xff,0x44,0xee,0xc4,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x5b,0x8c,0x52,0xaa,0x29,0x66,0x29,0x65,0x84,0x50,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x25,0x32,0xc7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3a,0xe8,0x3b,0x08,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x4b,0x49,0x4b,0x6a,0x4b,0x6a,0x4b,0x69,0x4b,0x49,0x4b,0x69,0x4b,0x69,0x4b,0x69,0x4b,0x69,0x4b,0x69,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x69,0x4b,0x69,0x4b,0x69,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x69,0x4b,0x69,0x4b,0x69,0x4b,0x69,0x4b,0x69,0x4b,0x6a,0x3a,0xa8,0x2a,0x47,0x4b,0x49,0x3b,0x08,0x2a,0x46,0x43,0x09,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x43,0x29,0x2a,0x67,0x2a,0x47,0x3a,0xe8,0x4b,0x49,0x32,0xa7,0x2a,0x47,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x32,0x67,0x32,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x47,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x2a,0x67,0x32,0xa8,0x4b,0x49,0x4b,0x6a,0x43,0x09,0x2a,0x46,0x43,0x09,0x3a,0xe8,0x2a,0x46,0x43,0x09,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x69,0x4b,0x49,0x32,0xa7,0x2a,0x46,0x43,0x09,0x4b,0x49,0x3a,0xe8,0x2a,0x47,0x2a,0x47,0x2a,0x46,0x2a,0x26,0x2a,0x26,0x2a,0x26,0x2a,0x26,0x32,0x87,0x4b,0x49,0x3a,0xe8,0x2a,0x47,0x2a,0x26,0x22,0x26,0x22,0x26,0x2a,0x67,0x43,0x49,0x32,0xa8,0x2a,0x67,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x69,0x4b,0x6a,0x4b,0x69,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x6a,0xad,0xd5,0x63,0xec,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x53,0xab,0xd6,0xfa,0xff,0xff,0xff,0xff,0xf7,0x9e,0xc6,0x58,0xc6,0x78,0xff,0xdf,0xce,0xb9,0xbe,0x57,0xf7,0x9e,0xc6,0x78,0xbe,0x57,0xe7,0x3c,0xff,0xdf,0x8c,0xf1,0x84,0xd1,0x5a,0xeb,0x29,0x65,0x41,0xe2,0x8b,0xe3,0x8b,0xe3,0x83,0xa3,0x10,0xa2,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x32,0x67,0x94,0xb2,0xa4,0xf3,0x9c,0xf3,0x42,0xa9,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x22,0x25,0x32,0xc7,0x19,0xe5,0x22,0x05,0x22,0x26,0x2a,0x46,0x3b,0x08,0x2a,0x46,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0x84,0xb0,0x4a,0xa9,0x39,0xe7,0x31,0xe7,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe7,0x31,0xe7,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xa6,0x29,0xa6,0x31,0xc6,0x31,0xa6,0x29,0x85,0x31,0xc6,0x31,0xe6,0x31,0xe7,0x31,0xe6,0x31,0xc6,0x29,0xa6,0x29,0x85,0x29,0x85,0x31,0xc6,0x31,0xa6,0x29,0x86,0x29,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xa6,0x29,0xa6,0x29,0xa5,0x29,0xa6,0x31,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xa6,0x31,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xe6,0x31,0xe6,0x31,0xe6,0x31,0xc6,0x29,0x85,0x29,0xa6,0x29,0xa6,0x29,0x85,0x31,0xc6,0x31,0xc6,0x31,0xe6,0x31,0xe6,0x31,0xc6,0x31,0xc6,0x29,0x85,0x29,0x85,0x31,0xc6,0x31,0xc6,0x29,0xa6,0x29,0x86,0x29,0x86,0x29,0x85,0x29,0x85,0x29,0x85,0x29,0x85,0x29,0x85,0x31,0xc6,0x31,0xc6,0x29,0xa6,0x29,0x85,0x29,0x85,0x29,0x65,0x29,0x65,0x29,0x85,0x31,0xc6,0x29,0xa6,0x29,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xa6,0x29,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xa6,0x29,0xa6,0x29,0xa6,0x29,0xa6,0x29,0xa6,0x31,0xa6,0x31,0xa6,0x29,0xa6,0x29,0xa6,0x29,0xa6,0x29,0xa6,0x29,0xa6,0x29,0xa6,0x29,0xa6,0x3a,0x07,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0xa5,0x54,0xad,0xb5,0xad,0xb5,0xad,0xb5,0x95,0x33,0x43,0x29,0x84,0xd1,0x5a,0xeb,0x31,0xa6,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xc7,0x9c,0xd3,0x53,0x6a,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xde,0xfb,0xf7,0x9e,0xf7,0x9e,0x5b,0x6c,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x7c,0x50,0xa5,0x74,0x53,0x2a,0x7b,0xee,0x63,0x6b,0x74,0x0e,0xa5,0x94,0x74,0x2f,0x19,0xe5,0x63,0xac,0x95,0x32,0x53,0x8b,0x84,0xd0,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x8c,0x91,0x39,0xe7,0x18,0xe3,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x42,0x04,0x5a,0x83,0x39,0xa4,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x64,0x52,0x63,0x52,0x64,0x29,0x44,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x39,0xa4,0x5a,0x83,0x41,0xe4,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x44,0x4a,0x24,0x5a,0x83,0x31,0x64,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x64,0x5a,0x83,0x4a,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x41,0xe4,0x5a,0x83,0x39,0xa4,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x44,0x52,0x63,0x52,0x63,0x29,0x44,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x39,0xc4,0x5a,0x83,0x41,0xe4,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x44,0x4a,0x44,0x5a,0x83,0x31,0x84,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x84,0x5a,0x83,0x4a,0x24,0x29,0x44,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x42,0x04,0x5a,0x83,0x39,0xa4,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x64,0x52,0x64,0x52,0x64,0x29,0x64,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x39,0xc4,0x5a,0x83,0x42,0x04,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x44,0x4a,0x24,0x5a,0x83,0x31,0x84,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x84,0x5a,0x83,0x4a,0x44,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x41,0xe4,0x5a,0x83,0x39,0xa4,0x21,0x24,0x18,0xc3,0x08,0xa2,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x6f,0x5a,0xcb,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x84,0x70,0x4b,0x49,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x32,0x87,0xb5,0xf7,0xe7,0x1c,0xe7,0x1c,0x42,0xc9,0x19,0xe5,0x19,0xe5,0x4b,0x0a,0xe7,0x1c,0xff,0xdf,0xcd,0xb5,0xb4,0xb0,0xb4,0xb0,0xde,0x58,0xf7,0x9e,0xe7,0x3c,0x43,0x09,0xc6,0x38,0x6c,0x2e,0x74,0x6f,0xd6,0xda,0x6c,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x5a,0xeb,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0x52,0x67,0x4a,0x67,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x27,0x52,0x67,0x52,0x67,0x52,0x67,0x4a,0x67,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x83,0xa6,0xf6,0x40,0xf6,0x60,0xe5,0xe1,0x62,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x27,0xbd,0x03,0xf6,0x60,0xf6,0x60,0xbd,0x03,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe6,0xe6,0x21,0xf6,0x60,0xee,0x41,0x7b,0x86,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xa4,0x64,0xf6,0x60,0xf6,0x60,0xd5,0xa2,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x67,0xd5,0xa2,0xf6,0x60,0xf6,0x60,0x9c,0x44,0x41,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x83,0xa5,0xee,0x40,0xf6,0x60,0xe6,0x01,0x62,0xe6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xbd,0x03,0xf6,0x60,0xf6,0x60,0xbd,0x03,0x42,0x27,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe6,0xe6,0x01,0xf6,0x60,0xee,0x41,0x83,0x86,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x9c,0x64,0xf6,0x60,0xf6,0x60,0xd5,0xa2,0x52,0x67,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xd5,0xa2,0xf6,0x60,0xf6,0x60,0x9c,0x45,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x83,0xa6,0xee,0x41,0xf6,0x60,0xe6,0x01,0x62,0xe6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xbd,0x03,0xf6,0x60,0xf6,0x60,0xbd,0x03,0x42,0x27,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe6,0xe6,0x01,0xf6,0x60,0xee,0x40,0x7b,0x86,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0xa4,0x65,0xf6,0x60,0xf6,0x60,0xd5,0x82,0x52,0x67,0x6b,0x4d,0x84,0x30,0x73,0xae,0x52,0x87,0xd5,0xa2,0xf6,0x60,0xf6,0x60,0x9c,0x45,0x5a,0xcb,0x52,0x8a,0x4a,0x69,0x52,0x8a,0x83,0xa6,0xf6,0x40,0xf6,0x60,0xe6,0x01,0x62,0xe7,0x39,0xe7,0x21,0x04,0x19,0x63,0x32,0xc7,0x2a,0x46,0x22,0x25,0x2a,0x66,0x3b,0x08,0x3a,0x47,0x3a,0x27,0x3a,0x27,0x3a,0x27,0x3a,0x27,0x3a,0x27,0x3a,0x27,0x3a,0x27,0x3a,0xa8,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x19,0xe5,0x22,0x25,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x1a,0x05,0x4b,0x0a,0xe7,0x1c,0xff,0xdf,0xcd,0xb5,0xbc,0xb0,0xbc,0xb0,0xde,0x58,0xf7,0x9e,0xe7,0x3c,0x43,0x49,0xbe,0x17,0x43,0x49,0x74,0x6f,0x9d,0x53,0xc6,0x78,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0x84,0x30,0x08,0x41,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x9c,0x45,0xf6,0x60,0xf6,0x60,0xf6,0x60,0xe5,0xe2,0x62,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x46,0xe6,0x01,0xf6,0x60,0xf6,0x60,0xf6,0x60,0xf6,0x60,0xdd,0xe2,0x62,0xe6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x73,0xae,0x84,0x30,0x63,0x0b,0xd5,0xa2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xb4,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x26,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xf6,0x80,0x7b,0x89,0x52,0xaa,0x6b,0x4d,0x5a,0xeb,0xb4,0xc3,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xcd,0x62,0x42,0x07,0x39,0xe7,0x39,0xe7,0x52,0x67,0xee,0x21,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x8b,0xc5,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8b,0xc5,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x01,0x62,0xe9,0x4a,0x49,0x4a,0x69,0x5a,0xca,0xd5,0x82,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xac,0x84,0x5a,0xcb,0x42,0x28,0x5a,0xeb,0x73,0x47,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x6b,0x06,0x39,0xe7,0x39,0xe7,0x39,0xe7,0xb4,0xc3,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xd5,0x82,0x42,0x07,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xee,0x21,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x8b,0xe5,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x94,0x25,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x21,0x52,0x67,0x39,0xe7,0x39,0xe7,0x4a,0x27,0xdd,0xc1,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xb4,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x27,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x73,0x26,0x39,0xe7,0x39,0xe7,0x42,0x07,0xb4,0xe3,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc1,0x42,0x07,0x39,0xe7,0x39,0xe7,0x52,0x67,0xf6,0x40,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x25,0x6b,0x4d,0x9c,0xf3,0x84,0x10,0x8b,0xe5,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x40,0x73,0x8c,0x8c,0x71,0x8c,0x71,0x63,0x0b,0xd5,0xa2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xb4,0xe3,0x39,0xe7,0x39,0xe7,0x08,0xa2,0x19,0xa4,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x6a,0xb5,0xd6,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x2a,0x87,0x3b,0x08,0x32,0xa7,0x32,0x87,0x3b,0x08,0x22,0x46,0x2a,0x67,0xad,0xd6,0xc6,0x58,0x9c,0xd2,0x9c,0x91,0x94,0x70,0xa5,0x33,0xbe,0x18,0xad,0x75,0x22,0x05,0x8c,0xd2,0xbe,0x37,0x7c,0x8f,0xbe,0x37,0x9d,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xad,0xb5,0x9c,0xf3,0x52,0x8a,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x73,0x8d,0xee,0x42,0xee,0x42,0xee,0x42,0xee,0x42,0xee,0x42,0xb5,0x07,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x73,0x8d,0xcd,0x85,0xee,0x42,0xee,0x42,0xee,0x42,0xee,0x42,0xf6,0x61,0xfe,0x80,0xac,0x84,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x8c,0x51,0x73,0x8e,0x52,0xa9,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x42,0x5a,0xeb,0x84,0x30,0x6b,0x4d,0x73,0x45,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x8c,0x08,0x84,0x30,0x84,0x10,0x6b,0x6d,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x63,0x0a,0x42,0x28,0x42,0x28,0x5a,0xc8,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x24,0x63,0x0c,0x42,0x08,0x52,0x8a,0x94,0x24,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x41,0x7b,0x8a,0x8c,0x71,0x8c,0x51,0x73,0xad,0xe6,0x02,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x84,0x10,0x8c,0x51,0x8c,0x51,0x8b,0xe8,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x7b,0x67,0x73,0x8e,0x6b,0x4d,0x5a,0xeb,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xe2,0x5a,0xaa,0x42,0x28,0x5a,0xcb,0x6b,0x28,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x24,0x6b,0x6d,0x84,0x30,0x5a,0xeb,0xa4,0x83,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x62,0xe8,0x42,0x28,0x4a,0x49,0x6b,0x4b,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x22,0x5a,0xeb,0x7b,0xef,0x5a,0xcb,0x7b,0x85,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x8b,0xe8,0x4a,0x69,0x63,0x2c,0x5a,0xeb,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x01,0x52,0x68,0x73,0xae,0x4a,0x69,0x5a,0xa7,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x64,0x73,0xae,0x63,0x0c,0x6b,0x6d,0x9c,0x24,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x6b,0x08,0x5a,0xcb,0x7b,0xef,0x5a,0xea,0xe5,0xe2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x42,0x42,0x07,0x39,0xe7,0x21,0x24,0x22,0x05,0x4b,0x49,0x95,0x12,0x32,0x87,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0xad,0xd5,0x7c,0x90,0xb5,0xf6,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x46,0x3b,0x08,0x19,0xe5,0x32,0x67,0x32,0x67,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x9c,0xd3,0x9c,0xf3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf1,0x9c,0xf1,0x9c,0xf1,0x9c,0xf1,0x9c,0xf1,0x9c,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd2,0x9c,0xf1,0x9c,0xf1,0x9c,0xf1,0x9c,0xf1,0xb5,0x4d,0xfe,0x80,0x9c,0x24,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x69,0x8c,0x51,0x8c,0x71,0x5a,0xea,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x42,0x8c,0x71,0x7b,0xcf,0x73,0xae,0x7b,0x86,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x7b,0x87,0x5a,0xeb,0x6b,0x6d,0x63,0x2c,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x7b,0xee,0x7b,0xef,0x84,0x10,0x73,0x6a,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x25,0x84,0x10,0x7b,0xcf,0x84,0x10,0x9c,0x45,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x41,0x6b,0x29,0x4a,0x49,0x42,0x28,0x52,0x89,0xe6,0x02,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x5a,0xeb,0x7b,0xcf,0x63,0x2c,0x7b,0x86,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x83,0xc8,0x84,0x30,0x9c,0xf3,0x8c,0x51,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe5,0xe2,0x73,0xae,0x7b,0xef,0x84,0x30,0x83,0xca,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x65,0x84,0x30,0x8c,0x71,0x94,0x92,0xa4,0x83,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x6b,0x29,0x73,0xae,0x7b,0xcf,0x83,0xee,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x22,0x84,0x30,0x8c,0x71,0x8c,0x51,0x83,0xa6,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x29,0x7b,0xef,0x94,0x92,0x84,0x0f,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x01,0x6b,0x2b,0x8c,0x71,0x9c,0xd3,0x73,0x6a,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x64,0x8c,0x51,0x8c,0x51,0x84,0x10,0x9c,0x24,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x83,0xcb,0x9c,0xd3,0x6b,0x6d,0x4a,0x48,0xe6,0x02,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x42,0x42,0x07,0x39,0xe7,0x21,0x44,0x32,0x66,0x64,0x0c,0xd6,0xd9,0x3a,0xe8,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x53,0x8a,0xad,0xd6,0x7c,0x8f,0xbe,0x38,0xad,0xd5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x22,0x46,0x3b,0x08,0x19,0xe5,0x19,0xc5,0x22,0x05,0x63,0xcc,0x53,0x8b,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x84,0xb0,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xad,0x10,0xa4,0x85,0x52,0x67,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x0c,0x7b,0xcf,0x6b,0x4d,0x73,0x8d,0xdd,0xc1,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x63,0x2c,0x6b,0x6d,0x52,0x8a,0x73,0x46,0xf6,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x7b,0xa8,0x94,0x92,0x84,0x10,0x4a,0x69,0xbd,0x03,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xd5,0xa2,0x52,0x69,0x63,0x0c,0x5a,0xcb,0x52,0x87,0xee,0x41,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x05,0x4a,0x69,0x4a,0x69,0x52,0x8a,0x8b,0xe5,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x21,0x73,0x6a,0x73,0xae,0x73,0x8e,0x73,0x6c,0xdd,0xc2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xb4,0xc3,0x7b,0xcf,0x8c,0x51,0x8c,0x51,0x8c,0x09,0xf6,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x73,0x46,0x6b,0x4d,0x63,0x2c,0x5a,0xcb,0xbd,0x03,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x52,0x89,0x42,0x08,0x39,0xe7,0x62,0xc7,0xee,0x41,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x04,0x5a,0xeb,0x73,0x8e,0x52,0xaa,0x9c,0x44,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x40,0x52,0x87,0x39,0xe7,0x5a,0xcb,0x62,0xea,0xdd,0xe1,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x52,0xaa,0x63,0x2c,0x4a,0x69,0x7b,0x66,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x73,0x66,0x63,0x2c,0x4a,0x69,0x4a,0x69,0xbd,0x03,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xe1,0x52,0x89,0x63,0x0c,0x52,0xaa,0x5a,0xc8,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x44,0x5a,0xeb,0x52,0x8a,0x5a,0xeb,0x94,0x04,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x40,0x63,0x09,0x4a,0x69,0x6b,0x6d,0x5a,0xca,0xdd,0xc2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x39,0xe7,0x39,0xe7,0x21,0x24,0x19,0xa4,0x22,0x05,0x2a,0x66,0x1a,0x05,0x19,0xe5,0x3a,0xe7,0x3b,0x08,0x74,0x6f,0x6c,0x2e,0x3b,0x08,0x4b,0x49,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x22,0x46,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x22,0x05,0xbe,0x16,0x9d,0x73,0x1a,0x05,0x32,0xa7,0x3b,0x08,0x3a,0xc7,0x32,0xa7,0x32,0xa7,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x84,0x90,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x8c,0x51,0x84,0x30,0x84,0x30,0x6b,0x6d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x69,0x52,0x8a,0x42,0x28,0x52,0xaa,0xac,0x84,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x83,0x86,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x87,0xdd,0xc2,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x4a,0x27,0x4a,0x49,0x6b,0x4d,0x63,0x0c,0x83,0xa5,0xf6,0x60,0xfe,0x80,0xf6,0x80,0x9c,0x44,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x27,0xc5,0x23,0xfe,0x80,0xfe,0x80,0xee,0x41,0x5a,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe6,0xee,0x21,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x52,0x89,0x4a,0x49,0x42,0x08,0x42,0x07,0xa4,0x64,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x7b,0x86,0x52,0xaa,0x7b,0xcf,0x73,0x8e,0x52,0x88,0xdd,0xc2,0xfe,0x80,0xfe,0x80,0xd5,0xa2,0x52,0x67,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x83,0x86,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xa4,0x64,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xc5,0x23,0xfe,0x80,0xfe,0x80,0xee,0x21,0x6b,0x06,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe7,0xee,0x41,0xfe,0x80,0xfe,0x80,0xc5,0x43,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0xa4,0x84,0xf6,0x80,0xfe,0x80,0xf6,0x60,0x83,0xa5,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x67,0xdd,0xe1,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x52,0x67,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x83,0xc5,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xa4,0x84,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xee,0x21,0x62,0xe7,0x63,0x0c,0x63,0x2c,0x84,0x10,0x6b,0x06,0xee,0x21,0xfe,0x80,0xfe,0x80,0xc5,0x43,0x6b,0x4c,0x73,0xae,0x73,0xae,0x63,0x0c,0xa4,0x84,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x83,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x64,0x22,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x22,0x46,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x43,0x08,0x3a,0xc7,0x19,0xe5,0x32,0xc7,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x84,0x90,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xa5,0x14,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x71,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x27,0x8b,0xc5,0xac,0xa3,0x73,0x66,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xa4,0x64,0xa4,0x64,0x52,0x87,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x73,0x66,0xac,0xa3,0x83,0xc6,0x42,0x27,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0x94,0x25,0xac,0x84,0x62,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe7,0xac,0x84,0x94,0x25,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x27,0x83,0xc6,0xac,0xa3,0x73,0x46,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0x87,0xa4,0x64,0xa4,0x64,0x52,0x87,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x7b,0x66,0xac,0xa3,0x83,0xc6,0x42,0x27,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0x9c,0x25,0xac,0x84,0x62,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x07,0xac,0x84,0x94,0x25,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x27,0x8b,0xc6,0xac,0xa3,0x73,0x66,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xa4,0x64,0xa4,0x64,0x5a,0xa7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x73,0x66,0xac,0xa3,0x8b,0xc6,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0x94,0x25,0xac,0x84,0x6b,0x07,0x39,0xe7,0x42,0x08,0x42,0x28,0x63,0x2c,0x39,0xe7,0x62,0xe7,0xa4,0x84,0x9c,0x45,0x4a,0x47,0x4a,0x49,0x73,0xae,0x6b,0x6d,0x4a,0x49,0x42,0x27,0x83,0xc6,0xac,0xa3,0x7b,0x66,0x42,0x07,0x39,0xe7,0x39,0xe7,0x29,0x85,0x32,0xa7,0x3a,0xe8,0x32,0xc7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x22,0x46,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x32,0x67,0xa5,0x74,0x94,0xf2,0x22,0x06,0x9d,0x54,0x95,0x12,0x22,0x26,0x7c,0x50,0x9d,0x13,0x22,0x26,0x84,0x91,0x3a,0xe8,0x32,0xc7,0x3b,0x08,0x3a,0xe7,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x84,0x90,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x94,0x92,0x94,0x92,0x94,0x92,0x73,0x8e,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x29,0x85,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x22,0x46,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x3a,0xa8,0xe7,0x1c,0xde,0xfb,0x2a,0x47,0xde,0xfb,0xe7,0x3c,0x4b,0x2b,0xb5,0xf7,0xef,0x7d,0x6b,0xce,0x7c,0x70,0x19,0xe5,0x22,0x05,0x3b,0x08,0x32,0x87,0x19,0xc5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x43,0x49,0x84,0x90,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xa5,0x34,0xa5,0x14,0xa5,0x14,0x84,0x10,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x29,0x85,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x31,0xdf,0x1a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x22,0x46,0x3b,0x08,0x19,0xe5,0x19,0xe5,0x3a,0xa8,0xd6,0xba,0xd6,0x99,0x2a,0x47,0xce,0x99,0xd6,0xba,0x4b,0x0a,0xad,0xb5,0xde,0xfb,0x63,0xad,0x7c,0x70,0x22,0x05,0x84,0x91,0xb5,0xf6,0xad,0x95,0x42,0xe9,0x22,0x26,0x3b,0x08,0x3b,0x08,0x43,0x29,0x84,0x90,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xa5,0x14,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x71,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x49,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x63,0x2c,0x63,0x2c,0x52,0xaa,0x4a,0x69,0x63,0x2c,0x63,0x2c,0x63,0x2c,0x42,0x08,0x63,0x2c,0x63,0x2c,0x63,0x2c,0x42,0x28,0x5a,0xeb,0x63,0x2c,0x63,0x2c,0x52,0x8a,0x52,0x8a,0x63,0x2c,0x63,0x2c,0x5a,0xeb,0x4a,0x49,0x63,0x2c,0x63,0x2c,0x63,0x2c,0x42,0x08,0x63,0x0c,0x63,0x2c,0x63,0x2c,0x4a,0x69,0x52,0xaa,0x63,0x2c,0x63,0x2c,0x5a,0xcb,0x4a,0x69,0x63,0x2c,0x63,0x2c,0x63,0x0c,0x42,0x28,0x63,0x0c,0x63,0x2c,0x63,0x2c,0x4a,0x49,0x5a,0xcb,0x63,0x2c,0x63,0x2c,0x52,0xaa,0x4a,0x69,0x63,0x2c,0x63,0x2c,0x63,0x0c,0x42,0x28,0x63,0x2c,0x63,0x2c,0x63,0x2c,0x4a,0x49,0x5a,0xeb,0x63,0x2c,0x63,0x2c,0x52,0x8a,0x39,0xe7,0x29,0x85,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xeb,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x06,0x3a,0xa8,0x4b,0x6a,0x19,0xe5,0x3a,0xa9,0x5b,0x4c,0xce,0x58,0xc6,0x38,0x3a,0x47,0xc6,0x38,0xce,0x79,0x4a,0xea,0xad,0x74,0xd6,0xba,0x63,0x6c,0x7c,0x70,0x2a,0x47,0xce,0x79,0xe7,0x3c,0xe7,0x3c,0x7c,0x90,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x7c,0x70,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x84,0x30,0x84,0x10,0x84,0x10,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x84,0x10,0x7b,0xcf,0x7b,0xcf,0x7b,0xcf,0x7b,0xcf,0x7b,0xcf,0x7b,0xcf,0x7b,0xcf,0x7b,0xcf,0x7b,0xcf,0x94,0xb2,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x71,0xb5,0x96,0xb5,0x96,0x84,0x10,0x6b,0x6d,0xb5,0x96,0xb5,0x96,0xad,0x75,0x4a,0x49,0xb5,0x96,0xb5,0x96,0xad,0x75,0x5a,0xcb,0x9c,0xd3,0xb5,0x96,0xb5,0x96,0x7b,0xcf,0x7b,0xcf,0xb5,0x96,0xb5,0x96,0x9c,0xd3,0x5a,0xcb,0xad,0x75,0xb5,0x96,0xb5,0x96,0x4a,0x69,0xa5,0x34,0xb5,0x96,0xb5,0x96,0x6b,0x6d,0x7b,0xef,0xb5,0x96,0xb5,0x96,0x94,0x92,0x63,0x2c,0xb5,0x96,0xb5,0x96,0xad,0x55,0x52,0xaa,0xa5,0x34,0xb5,0x96,0xb5,0x96,0x63,0x0c,0x94,0x92,0xb5,0x96,0xb5,0x96,0x84,0x30,0x6b,0x4d,0xb5,0x96,0xb5,0x96,0xa5,0x14,0x52,0xaa,0xad,0x55,0xb5,0x96,0xb5,0x96,0x5a,0xeb,0x94,0xb2,0xb5,0x96,0xb5,0x96,0x73,0xae,0x39,0xe7,0x32,0x06,0x3a,0xe8,0x3a,0xe8,0x43,0x29,0x4b,0x49,0x4b,0x4a,0x4b,0x4a,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x4b,0x49,0x6c,0x0d,0xf7,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf2,0x9d,0x54,0x9d,0x74,0x4b,0x2b,0x63,0x8d,0x73,0x8d,0x62,0xeb,0x62,0xeb,0x5a,0xaa,0x63,0x0b,0x63,0x0b,0x5a,0xaa,0x62,0xeb,0x63,0x0c,0x42,0x28,0x7c,0x70,0x22,0x05,0x9d,0x13,0xce,0x58,0xce,0x58,0x4b,0x2a,0x2a,0x87,0x3b,0x08,0x3b,0x08,0x43,0x29,0x7c,0x6f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xa5,0x34,0xa5,0x34,0xa5,0x34,0x84,0x10,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x0c,0x6b,0x4d,0x63,0x2c,0x42,0x08,0x9c,0x69,0xcd,0xa9,0xcd,0xa9,0x94,0x28,0x73,0x48,0xc5,0xa9,0xcd,0xa9,0xc5,0x89,0x4a,0x27,0xc5,0x89,0xcd,0xa9,0xc5,0x89,0x5a,0xa7,0xa4,0xa9,0xcd,0xa9,0xcd,0xa9,0x8b,0xe8,0x7b,0xa8,0xcd,0xa9,0xcd,0xa9,0xac,0xe9,0x5a,0xa7,0xc5,0x69,0xcd,0xa9,0xcd,0xa9,0x52,0x67,0xb5,0x29,0xcd,0xa9,0xcd,0xa9,0x73,0x68,0x83,0xe8,0xcd,0xa9,0xcd,0xa9,0xa4,0xa8,0x6b,0x08,0xc5,0xa9,0xcd,0xa9,0xbd,0x69,0x52,0x87,0xb5,0x29,0xcd,0xa9,0xcd,0xa9,0x6b,0x07,0x9c,0x89,0xcd,0xa9,0xcd,0xa9,0x94,0x48,0x6b,0x28,0xc5,0x89,0xcd,0xa9,0xb5,0x09,0x52,0x87,0xbd,0x49,0xcd,0xa9,0xc5,0xa9,0x62,0xe7,0x9c,0x89,0xcd,0xa9,0xcd,0xa9,0x7b,0xa8,0x5a,0xcb,0x5b,0x0b,0x63,0x2c,0x63,0x4c,0x6b,0x8d,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x7b,0xcf,0x84,0x30,0x8c,0x51,0x8c,0x51,0x8c,0x51,0xad,0x55,0xff,0xdf
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0xa5,0x75,0x7c,0x90,0x7c,0xb0,0x42,0xe9,0x63,0x8d,0x73,0x8d,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x4a,0x48,0x7c,0x70,0x42,0xa9,0x3a,0x48,0x31,0x86,0x31,0x86,0x7c,0x0f,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x84,0x10,0x7b,0xef,0x7b,0xef,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xa4,0x64,0xcd,0x82,0xcd,0x42,0x8b,0xc5,0x42,0x07,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x2c,0x39,0xe7,0x31,0x86,0x31,0x86,0xb4,0xa2,0xf6,0x60,0xf6,0x60,0xac,0x82,0x7b,0x64,0xf6,0x60,0xf6,0x60,0xf6,0x40,0x4a,0x25,0xf6,0x40,0xf6,0x60,0xf6,0x60,0x62,0xc4,0xc5,0x21,0xf6,0x60,0xf6,0x60,0xa4,0x62,0x8b,0xc3,0xf6,0x60,0xf6,0x60,0xcd,0x61,0x5a,0xa4,0xee,0x20,0xf6,0x60,0xf6,0x60,0x52,0x65,0xdd,0xa1,0xf6,0x60,0xf6,0x60,0x8b,0xa3,0x9c,0x23,0xf6,0x60,0xf6,0x60,0xc5,0x41,0x6b,0x04,0xf6,0x60,0xf6,0x60,0xe6,0x00,0x5a,0x85,0xdd,0xa1,0xf6,0x60,0xf6,0x60,0x73,0x24,0xbc,0xe2,0xf6,0x60,0xf6,0x60,0xb4,0xc2,0x73,0x44,0xf6,0x60,0xf6,0x60,0xdd,0xc1,0x5a,0x85,0xe6,0x00,0xf6,0x60,0xf6,0x60,0x6b,0x04,0xbc,0xe2,0xf6,0x60,0xf6,0x60,0x94,0x03,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x63,0xac,0x6b,0xee,0x74,0x4f,0x4b,0x2b,0x63,0x8d,0x73,0x8d,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x4a,0x48,0x94,0xf2,0x5b,0x4b,0x63,0x4d,0x29,0x65,0x29,0x65,0xa5,0x34,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x42,0x27,0xbd,0x23,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x94,0x05,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x2c,0x39,0xe7,0x31,0x86,0x31,0x86,0x52,0x65,0x62,0xc4,0x62,0xc4,0x52,0x45,0x42,0x05,0x62,0xc4,0x62,0xc4,0x62,0xc4,0x39,0xa6,0x62,0xc4,0x62,0xc4,0x62,0xc4,0x39,0xe6,0x52,0x65,0x62,0xc4,0x62,0xc4,0x4a,0x45,0x4a,0x25,0x62,0xc4,0x62,0xc4,0x5a,0x85,0x39,0xc6,0x62,0xa4,0x62,0xc4,0x62,0xc4,0x39,0xc6,0x5a,0xa5,0x62,0xc4,0x62,0xc4,0x4a,0x25,0x4a,0x25,0x62,0xc4,0x62,0xc4,0x52,0x65,0x41,0xe5,0x62,0xc4,0x62,0xc4,0x5a,0xa4,0x39,0xc6,0x5a,0x85,0x62,0xc4,0x62,0xc4,0x42,0x05,0x52,0x65,0x62,0xc4,0x62,0xc4,0x52,0x65,0x42,0x05,0x62,0xc4,0x62,0xc4,0x5a,0xa5,0x39,0xc6,0x5a,0xa4,0x62,0xc4,0x62,0xc4,0x41,0xe5,0x52,0x65,0x62,0xc4,0x62,0xc4,0x4a,0x25,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0xa5,0x74,0x5b,0x6c,0xa5,0x74,0x84,0x91,0x63,0x8d,0x73,0x8d,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x62,0xeb,0x4a,0x48,0x7c,0x70,0x2a,0x47,0x4a,0x89,0x29,0x66,0x29,0x66,0x53,0x4b,0x22,0x46,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x84,0x30,0x84,0x10,0x84,0x10,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x62,0xe6,0xf6,0x40,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xe1,0x4a,0x47,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x2c,0x39,0xe7,0x31,0x86,0x31,0x86,0x8c,0x71,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x6b,0x4d,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x94,0xf2,0xbe,0x18,0xb5,0xf6,0x7c,0x90,0x5b,0x8c,0x6b,0x6d,0x5a,0xcb,0x5a,0xcb,0x52,0x89,0x52,0x89,0x52,0x89,0x52,0x89,0x5a,0xca,0x62,0xeb,0x42,0x48,0x7c,0x70,0x32,0x87,0xce,0x99,0xef,0x5c,0xef,0x5c,0x53,0x2b,0x19,0xe5,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x7b,0xcf,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x42,0x08,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x52,0x8a,0xd6,0x9a,0xe7,0x3c,0xe7,0x3c,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xf7,0x9e,0xef,0x5d,0x6b,0x6d,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x6b,0x06,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x21,0x52,0x87,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x39,0xc7,0x31,0x86,0x31,0x86,0xad,0x75,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x4a,0x49,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x4a,0x69,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x22,0x05,0x3a,0xe7,0x32,0xc7,0x3a,0xc8,0x5b,0x8c,0xd6,0xba,0xd6,0x99,0x32,0x47,0x32,0x67,0x2a,0x46,0x21,0xc5,0xad,0xb5,0xe7,0x1b,0x6b,0xcd,0x53,0x8b,0x43,0x09,0xce,0x79,0xef,0x5d,0xef,0x5d,0x63,0xcd,0x19,0xe5,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xa5,0x14,0x9c,0xf3,0x9c,0xf3,0x7b,0xef,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x9c,0xf3,0x9c,0xd3,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x9c,0xf3,0x9c,0xf3,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x9c,0xd3,0xa5,0x34,0xe7,0x3c,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x7d,0xef,0x5d,0xef,0x5c,0xef,0x7d,0xf7,0x9e,0xf7,0xbe,0xf7,0xbe,0xe7,0x3c,0xa5,0x34,0x9c,0xf3,0x63,0x0c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x5a,0xc6,0xee,0x21,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xd5,0xa2,0x42,0x27,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xea,0x62,0xe5,0x4a,0x45,0x31,0x86,0xad,0x75,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x39,0xc7,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3a,0xe7,0x53,0x8b,0xde,0xfb,0xd6,0xda,0x2a,0x47,0x2a,0x87,0x2a,0x46,0x19,0xc5,0xb5,0xd6,0xe7,0x3c,0x74,0x4f,0x32,0xa7,0x19,0xe5,0x53,0x6c,0xa5,0x54,0x84,0xb1,0x22,0x05,0x22,0x05,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x84,0x30,0x84,0x10,0x84,0x10,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x6b,0x6d,0xad,0x75,0xad,0x75,0x6b,0x4d,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0xad,0x75,0xb5,0x96,0x84,0x10,0x42,0x28,0x39,0xe7,0x39,0xe7,0x52,0xaa,0xad,0x75,0xb5,0xb6,0xe7,0x3c,0xf7,0xbe,0xf7,0x9e,0xe7,0x1c,0xde,0xdb,0xde,0xda,0xde,0xda,0xde,0xda,0xe7,0x1b,0xf7,0x9e,0xf7,0xbe,0xe7,0x3c,0xb5,0xb6,0xb5,0x96,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x42,0x07,0xa4,0x84,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xee,0x21,0x7b,0x66,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x39,0xe7,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x52,0xaa,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x87,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x3a,0xc9,0xe7,0x1c,0xde,0xfb,0x2a,0x47,0x2a,0x87,0x2a,0x46,0x19,0xe5,0xb5,0xf7,0xef,0x5d,0x63,0xad,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xad,0x75,0xad,0x55,0xad,0x55,0x84,0x30,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0xa5,0x14,0xa5,0x14,0xa5,0x14,0xa5,0x14,0x9c,0xf3,0x9c,0xf3,0xa5,0x14,0x63,0x0c,0x39,0xe7,0x39,0xe7,0x52,0xaa,0xad,0x75,0xb5,0xb6,0xe7,0x3c,0xf7,0xbe,0xe7,0x3c,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xe7,0x1b,0xf7,0x9e,0xe7,0x3c,0xb5,0xb6,0xb5,0x96,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x42,0x27,0x7b,0x65,0xa4,0x64,0x9c,0x44,0x6b,0x06,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xbd,0xd7,0xb5,0xb6,0xb5,0xb6,0xbd,0xd7,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x87,0x3a,0xe8,0x2a,0x46,0x19,0xe5,0x19,0xe5,0x2a,0x26,0x84,0x91,0x84,0x91,0x22,0x06,0x2a,0x87,0x2a,0x46,0x19,0xe5,0x6b,0xce,0x94,0xf3,0x32,0x67,0x22,0x05,0x32,0xc7,0x63,0xcc,0x74,0x4f,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x6b,0x6d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0x92,0x84,0x30,0x94,0x92,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x9c,0xf3,0x63,0x0c,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0x9c,0xf3,0xde,0xfb,0xf7,0x7d,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xef,0x7d,0xe7,0x1c,0x9c,0xf3,0x9c,0xd3,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xee,0x20,0xa4,0x42,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xa5,0x14,0xad,0x75,0x9c,0xf3,0xa5,0x34,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x87,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x32,0xc7,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x32,0xa7,0x2a,0x46,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x1a,0x05,0x32,0xa7,0x3b,0x08,0x7c,0x90,0xd6,0xda,0xad,0xd6,0x7c,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x7b,0xef,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x5a,0xcb,0x18,0xc3,0x08,0x61,0x10,0x82,0x4a,0x69,0x94,0x92,0x9c,0xd3,0x9c,0xf3,0x63,0x0c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x28,0x52,0x8a,0xde,0xdb,0xef,0x5d,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xbd,0x09,0xbd,0x0a,0xef,0x3c,0xef,0x7d,0x6b,0x4d,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x5a,0xa7,0x52,0x87,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x52,0x86,0x42,0x05,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xa5,0x34,0xc6,0x38,0xad,0x75,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x32,0x87,0x32,0xc7,0x19,0xe5,0x22,0x05,0x3a,0xe7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0x9d,0x74,0xc6,0x58,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x7b,0xcf,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x4a,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xe7,0x94,0xb2,0x9c,0xf3,0x73,0xae,0x94,0x92,0x94,0x92,0x39,0xe7,0x39,0xe7,0x4a,0x69,0xde,0xdb,0xef,0x5d,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xb4,0xe8,0xbd,0x08,0xef,0x3c,0xef,0x7d,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x62,0xe6,0xd5,0xa2,0xee,0x40,0xee,0x40,0xbd,0x03,0x4a,0x47,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xe5,0xe1,0x9c,0x23,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xbd,0xf7,0xc6,0x38,0xbd,0xf7,0xc6,0x18,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xc5,0x42,0xe9,0x95,0x11,0x3b,0x08,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xbe,0x17,0x53,0x8a,0x8c,0xd1,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x8c,0x51,0x84,0x30,0x84,0x30,0x6b,0x6d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x94,0xb2,0x94,0x92,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x7b,0xcf,0x9c,0xf3,0x7b,0xcf,0x84,0x30,0x8c,0x71,0x4a,0x69,0x8c,0x71,0x94,0xb2,0xde,0xfb,0xef,0x7d,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xef,0x5d,0xe7,0x3c,0x9c,0xd3,0x8c,0x71,0x5a,0xcb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x4a,0x67,0xdd,0xc2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xb4,0xc4,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xa5,0x14,0xc6,0x18,0xa5,0x14,0xad,0x55,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x5b,0xcc,0xdf,0x3b,0x3a,0xe8,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xc6,0x58,0xb5,0xd6,0xad,0xb5,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xa5,0x34,0xa5,0x34,0xa5,0x34,0x84,0x10,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0x73,0x8e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5a,0xcb,0x9c,0xf3,0x7b,0xef,0x84,0x30,0x84,0x30,0x52,0xaa,0xad,0x75,0xb5,0xb6,0xe7,0x1c,0xf7,0xbe,0xe7,0x1c,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xe6,0xfb,0xf7,0x9e,0xef,0x5d,0xbd,0xd7,0xb5,0x96,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x6b,0x06,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x01,0x52,0x67,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x40,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xa5,0x34,0xb5,0x96,0xb5,0x96,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x39,0xe7,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x52,0xaa,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x22,0x05,0x2a,0x86,0x1a,0x05,0x19,0xe5,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x7c,0x6f,0xa5,0xb4,0x3b,0x08,0x43,0x28,0x6c,0x0d,0x7c,0x90,0x7c,0x8f,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x84,0x10,0x7b,0xef,0x7b,0xef,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0x6b,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xaa,0x9c,0xf3,0x84,0x10,0x63,0x2c,0x73,0xae,0x52,0xaa,0xad,0x75,0xb5,0xb6,0xe7,0x1c,0xf7,0xbe,0xf7,0x9e,0xe7,0x1b,0xde,0xda,0xde,0xda,0xde,0xda,0xde,0xda,0xe7,0x1b,0xf7,0x9d,0xf7,0xbe,0xef,0x5d,0xbd,0xd7,0xb5,0x96,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x6b,0x06,0xf6,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x01,0x52,0x87,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xea,0x8b,0xe4,0x62,0xe4,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xbd,0xf7,0xad,0x55,0xc6,0x18,0xbd,0xf7,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xbd,0xd7,0xb5,0x96,0xb5,0x96,0xbd,0xd7,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x5a,0xeb,0x5a,0xcb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xcb,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xa5,0x73,0x3b,0x08,0x3b,0x08,0x63,0xed,0xc6,0x79,0xad,0xb5,0x63,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xad,0x75,0xad,0x75,0xad,0x75,0x8c,0x51,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0x6b,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xaa,0x9c,0xf3,0x84,0x30,0x84,0x10,0x8c,0x71,0x52,0x8a,0xa5,0x14,0xad,0x55,0xde,0xfb,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xef,0x7d,0xef,0x3c,0xe7,0x3c,0xef,0x5d,0xf7,0x9e,0xf7,0xbe,0xf7,0xbe,0xef,0x5d,0xad,0x75,0xa5,0x34,0x63,0x0c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x52,0x87,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x23,0x42,0x07,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x0a,0x9c,0x43,0x73,0x24,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xb5,0x96,0x9c,0xf3,0xa5,0x34,0xa5,0x34,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xad,0x55,0xad,0x75,0x94,0x92,0x8c,0x71,0xad,0x75,0xbd,0xf7,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x52,0xaa,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3a,0xe8,0x22,0x46,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x32,0xc7,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0xb6,0x17,0x5b,0xab,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0x6b,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xaa,0x9c,0xf3,0x73,0xae,0x7b,0xef,0x73,0x8e,0x42,0x08,0x4a,0x69,0x5a,0xcb,0xde,0xdb,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xf7,0x9e,0xef,0x7d,0xef,0x7d,0xef,0x5d,0xa5,0x14,0x4a,0x69,0x4a,0x49,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x83,0xa6,0xe6,0x01,0xfe,0x80,0xf6,0x60,0xd5,0xa2,0x5a,0xa7,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xad,0x75,0xb5,0x96,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xb5,0xb6,0xad,0x55,0x9c,0xd3,0x94,0x92,0x8c,0x51,0x94,0xb2,0xad,0x75,0xce,0x59,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x22,0x46,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x22,0x26,0x22,0x46,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x46,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x8c,0x51,0x84,0x30,0x84,0x30,0x6b,0x6d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0x84,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2c,0x9c,0xf3,0x84,0x30,0x7b,0xef,0x84,0x10,0x39,0xe7,0x39,0xe7,0x42,0x08,0x63,0x2c,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x4d,0x6b,0x4d,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x87,0x6b,0x06,0x6b,0x06,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xad,0x75,0xb5,0xb6,0xc6,0x38,0xce,0x59,0xc6,0x38,0xb5,0x96,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x8c,0x51,0xad,0x75,0xce,0x59,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe8,0x19,0xe5,0x22,0x46,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x46,0x32,0xa7,0x19,0xe5,0x2a,0x47,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4b,0x0a,0x4a,0xea,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xa5,0x14,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x71,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0x94,0xb2,0x21,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xc3,0x8c,0x71,0x9c,0xf3,0x6b,0x6d,0x63,0x0c,0x7b,0xcf,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x2a,0xc5,0x42,0x8b,0xc3,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xad,0x55,0xc6,0x38,0xc6,0x38,0xb5,0x96,0xc6,0x38,0xce,0x59,0xc6,0x38,0xb5,0x96,0x94,0xb2,0x8c,0x51,0x94,0xb2,0x94,0xb2,0x94,0xb2,0xa5,0x14,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x47,0x32,0x87,0x4b,0x49,0x3a,0xe8,0x22,0x26,0xad,0x75,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xc6,0x58,0x22,0x06,0x3a,0xe8,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x6a,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xa5,0x34,0xa5,0x34,0xa5,0x34,0x84,0x10,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x7b,0xcf,0x18,0xe3,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x82,0x73,0x8e,0x94,0xb2,0x9c,0xf3,0x6b,0x6d,0x63,0x2c,0x7b,0xef,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x84,0x30,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xea,0x62,0xe5,0x4a,0x45,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xa5,0x14,0xbd,0xd7,0xa5,0x34,0xad,0x55,0xc6,0x38,0xc6,0x38,0xce,0x59,0xbd,0xd7,0xad,0x75,0x9c,0xd3,0x8c,0x71,0x94,0x92,0x94,0x92,0xb5,0x96,0xc6,0x38,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xed,0x9d,0x34,0x74,0x6f,0x84,0xd0,0x7c,0x6f,0x4b,0x0a,0xc6,0x58,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xc6,0x79,0x4b,0x0a,0x7c,0x6f,0x84,0xd0,0x84,0xd0,0x84,0xd0,0x84,0xd0,0x84,0xd0,0xad,0x95,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xa4,0xf1,0x73,0x47,0x42,0x28,0x42,0x08,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x8c,0x71,0x5a,0xcb,0x42,0x28,0x52,0xaa,0x84,0x30,0x94,0xb2,0x9c,0xd3,0x9c,0xf3,0x63,0x0c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xee,0x40,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xbd,0xf7,0xad,0x75,0xbd,0xd7,0xbd,0xd7,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xbd,0xf7,0xad,0x75,0xad,0x75,0x9c,0xf3,0xb5,0x96,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xc6,0x38,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xc6,0x79,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xb5,0x4e,0xf6,0x60,0x83,0xc5,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0x63,0x0c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xa5,0x14,0xbd,0xf7,0xc6,0x38,0xb5,0x96,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xc6,0x38,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xc6,0x79,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xad,0x95,0xa5,0x34,0x84,0x10,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x91,0xd5,0xe7,0xd5,0xe7,0xd5,0xe7,0xd5,0xe7,0xd5,0xe7,0xbd,0x4c,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xb2,0xc5,0x8a,0xd5,0xe7,0xd5,0xe7,0xd5,0xe7,0xd5,0xe7,0xde,0x05,0xfe,0x80,0xac,0xa4,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x69,0x8c,0x51,0xa5,0x34,0xa5,0x34,0x8c,0x51,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0xa5,0x34,0xa5,0x34,0x94,0xb2,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xee,0x20,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xa5,0x34,0xad,0x55,0xb5,0xb6,0xad,0x55,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xc6,0x38,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xce,0x79,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3a,0xc7,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xc6,0x58,0x52,0x8a,0x10,0xa2,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xcd,0x63,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x80,0x83,0x86,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x94,0x25,0xf6,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x83,0x85,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xeb,0xb5,0x96,0xad,0x75,0x5a,0xcb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0xb5,0x96,0xb5,0x96,0x73,0x8e,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xea,0x62,0xc5,0x4a,0x25,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xb5,0xb6,0xc6,0x38,0xb5,0x96,0xbd,0xd7,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xad,0x55,0x9c,0xf3,0x94,0xb2,0x9c,0xf3,0xa5,0x14,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xcb,0x5a,0xeb,0x5a,0xcb,0x5a,0xeb,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x32,0x87,0x19,0xe5,0x8c,0xd2,0xdf,0x1b,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xe7,0x1c,0xad,0xb6,0x19,0xc5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x94,0xf2,0x32,0x87,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x43,0x28,0xb6,0x16,0x4a,0x49,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0x83,0xa6,0x8b,0xc6,0x8b,0xc6,0x6b,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x73,0x47,0x8b,0xc6,0x8b,0xc6,0x8b,0xc6,0x8b,0xc6,0x6b,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x28,0x5a,0xeb,0x5a,0xeb,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xeb,0x5a,0xeb,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xd5,0x81,0x93,0xe3,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xb5,0xb6,0xc6,0x18,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xa5,0x14,0xc6,0x18,0x9c,0xf3,0xbd,0xf7,0x9c,0xf3,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x39,0xe7,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x5a,0xcb,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x05,0x22,0x05,0x3a,0xe7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x2a,0x47,0x2a,0x66,0x22,0x46,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x43,0x28,0xa5,0x94,0x42,0x48,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x63,0x0c,0x6b,0x6d,0x42,0x08,0x7b,0xcf,0x52,0xaa,0x7b,0xcf,0x8c,0x71,0x6b,0x4d,0x94,0xb2,0x84,0x10,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xb5,0x96,0xbd,0xf7,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xad,0x55,0xc6,0x38,0xb5,0x96,0xc6,0x18,0xa5,0x34,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0xaa,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x2a,0x66,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x66,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x8c,0xb1,0x3a,0xc8,0xc6,0x37,0x7c,0xb0,0x22,0x05,0x22,0x25,0x3b,0x08,0x3b,0x08,0x95,0x32,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x6b,0x4d,0x7b,0xcf,0x4a,0x69,0x94,0x92,0x73,0x8e,0x84,0x30,0x9c,0xd3,0x52,0xaa,0x7b,0xcf,0x4a,0x49,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x40,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x18,0xa5,0x34,0xa5,0x34,0xbd,0xf7,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xad,0x75,0xc6,0x38,0xad,0x75,0x9c,0xd3,0xad,0x55,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0xaa,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x32,0xa7,0x32,0xa7,0x2a,0x66,0x8c,0x91,0x43,0x09,0x8c,0xf1,0x7c,0x6f,0x2a,0x47,0x32,0x67,0x42,0xe8,0x3b,0x08,0x84,0xd0,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x73,0xae,0x84,0x10,0x6b,0x4d,0x73,0xae,0x8c,0x71,0x84,0x30,0x84,0x10,0x5a,0xcb,0x73,0xae,0x4a,0x49,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xea,0x8b,0xe4,0x62,0xe4,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xa5,0x34,0xbd,0xf7,0xc6,0x18,0xad,0x55,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xa5,0x14,0xc6,0x38,0x94,0xb2,0xb5,0xb6,0x9c,0xd3,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0xaa,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x74,0x2f,0x94,0xf3,0x9d,0x33,0x95,0x13,0x94,0xf2,0x94,0xf2,0x8c,0xd2,0x32,0x87,0x7c,0x90,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x0c,0x5a,0xeb,0x52,0x8a,0x42,0x08,0x52,0x8a,0x5a,0xcb,0x4a,0x69,0x52,0x8a,0x52,0x8a,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x0a,0x94,0x03,0x6b,0x04,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xa5,0x34,0xc6,0x38,0xc6,0x38,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xa5,0x34,0xa5,0x14,0x94,0xb2,0xc6,0x18,0xa5,0x34,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0xaa,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x84,0x71,0xb5,0xd6,0xad,0xb6,0xad,0xb6,0xad,0xb6,0xb5,0xf6,0xb5,0xd6,0xad,0xb6,0xad,0xd6,0x95,0x13,0x22,0x06,0x74,0x4f,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x8e,0x73,0x8e,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0x8e,0x73,0x8e,0x73,0x8e,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0x8e,0x73,0x8e,0x73,0x8e,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x73,0xae,0x7b,0xcf,0x5a,0xeb,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xbd,0xd7,0xb5,0xb6,0xbd,0xd7,0xbd,0xd7,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xb5,0xb6,0xa5,0x14,0xad,0x55,0xad,0x75,0xb5,0x96,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0xaa,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0xbe,0x18,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xd6,0x9a,0x32,0x67,0x74,0x4f,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xeb,0x6b,0x6d,0x6b,0x6d,0x5a,0xeb,0x73,0xae,0x63,0x0c,0x6b,0x6d,0x6b,0x4d,0x5a,0xeb,0x73,0xae,0x63,0x0c,0x73,0x8e,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x84,0x10,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0x84,0x30,0x42,0x28,0x4a,0x69,0x94,0xb2,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0x6b,0x6d,0x42,0x28,0x52,0xaa,0xa5,0x14,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0x73,0xae,0x6b,0x4d,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xad,0x55,0xad,0x75,0x9c,0xf3,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xb5,0xb6,0xad,0x55,0x94,0x92,0xad,0x55,0x9c,0xd3,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0xaa,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x95,0x13,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xbe,0x17,0x2a,0x26,0x74,0x2f,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x5a,0xcb,0x5a,0xcb,0x6b,0x4d,0x73,0xae,0x7b,0xcf,0x5a,0xeb,0x84,0x10,0x63,0x2c,0x7b,0xcf,0x73,0x8e,0x63,0x0c,0x84,0x10,0x63,0x2c,0x7b,0xcf,0x5a,0xcb,0x5a,0xcb,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x8c,0x51,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x39,0xe7,0x42,0x28,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x6b,0x6d,0x39,0xe7,0x52,0x8a,0xad,0x75,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x73,0xae,0x6b,0x4d,0x6b,0x2a,0xd5,0xa1,0x94,0x03,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xa5,0x34,0xbd,0xd7,0xad,0x75,0xb5,0x96,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x18,0x9c,0xd3,0xbd,0xd7,0x9c,0xd3,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xde,0xfa,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x22,0x06,0x19,0xe5,0x7c,0x6f,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xeb,0x21,0x24,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xc3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x8c,0x51,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x39,0xe7,0x42,0x28,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x6b,0x6d,0x39,0xe7,0x52,0x8a,0xad,0x75,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x73,0xae,0x6b,0x4d,0x5a,0xcb,0x5a,0x86,0x42,0x05,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x18,0xb5,0x96,0xc6,0x18,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xad,0x75,0xa5,0x34,0xb5,0x96,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xaa,0x84,0xd0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x05,0x19,0xe5,0x21,0xe5,0x21,0xe5,0x21,0xe5,0x21,0xe5,0x21,0xe5,0x21,0xe5,0x21,0xe5,0x21,0xe5,0x19,0xe5,0x1a,0x05,0x7c,0x8f,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xeb,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x8c,0x51,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x39,0xe7,0x42,0x28,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x6b,0x6d,0x39,0xe7,0x52,0x8a,0xad,0x75,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x73,0xae,0x6b,0x4d,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xad,0x75,0xbd,0xf7,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xad,0x55,0x9c,0xd3,0x94,0x92,0x9c,0xd3,0x9c,0xd3,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x5a,0xcb,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x39,0xc7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x22,0x05,0x74,0x0f,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0x8c,0xd2,0x2a,0x46,0x6c,0x2e,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x63,0x2c,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xc7,0x63,0x0c,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x8c,0x51,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x39,0xe7,0x42,0x28,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x6b,0x6d,0x39,0xe7,0x52,0x8a,0xad,0x75,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x73,0xae,0x6b,0x4d,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xbd,0xd7,0xc6,0x18,0xc6,0x18,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xbd,0xf7,0x9c,0xd3,0xc6,0x18,0x9c,0xd3,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x37,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xd6,0xba,0x4b,0x6a,0x7c,0x8f,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x6d,0x7b,0xef,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x8c,0x51,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x8c,0x51,0xb5,0x96,0xb5,0xb6,0xb5,0xb6,0xb5,0x96,0x8c,0x51,0x39,0xe7,0x42,0x28,0x9c,0xf3,0xb5,0x96,0xb5,0xb6,0xb5,0x96,0xb5,0x96,0x6b,0x6d,0x39,0xe7,0x52,0x8a,0xad,0x75,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x73,0xae,0x6b,0x4d,0x6b,0x2a,0xee,0x20,0xa4,0x42,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xbd,0xd7,0xad,0x75,0xa5,0x34,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xad,0x75,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0xa5,0x14,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x2a,0x66,0x95,0x13,0xde,0xfb,0xde,0xdb,0xde,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0xdb,0xde,0xfb,0xbe,0x17,0x32,0xa7,0x74,0x6f,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x28,0x4a,0x49,0x4a,0x69,0x4a,0x49,0x5a,0xcb,0x4a,0x69,0x5a,0xcb,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x7b,0xcf,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x8c,0x51,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x73,0x8e,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x73,0x8e,0x31,0xa6,0x39,0xe7,0x84,0x10,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x5a,0xeb,0x31,0xa6,0x42,0x28,0x8c,0x71,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x63,0x2c,0x6b,0x4d,0x5a,0xea,0x6a,0xe5,0x52,0x45,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xb5,0x96,0x9c,0xf3,0xad,0x75,0xbd,0xd7,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xb5,0x96,0x9c,0xf3,0xa5,0x14,0x9c,0xf3,0xb5,0x96,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x1a,0x05,0x2a,0x47,0x3a,0xa8,0x32,0x88,0x53,0x4b,0x53,0x6a,0x53,0x8b,0x32,0x88,0x32,0x88,0x3a,0x88,0x32,0x67,0x19,0xe5,0x7c,0x90,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x6b,0x4d,0x7b,0xcf,0x6b,0x4d,0x84,0x10,0x5a,0xcb,0x8c,0x71,0x84,0x10,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x5a,0xeb,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0x86,0x6b,0x4d,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x18,0xc3,0x18,0xe3,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x18,0xe3,0x18,0xc3,0x18,0xe3,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x63,0x0c,0x63,0x0a,0xc5,0x42,0x8b,0xc3,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xbd,0xd7,0xad,0x55,0xa5,0x34,0xb5,0x96,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xa5,0x14,0xb5,0x96,0x94,0xb2,0xb5,0x96,0x9c,0xd3,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x2a,0x46,0x22,0x46,0x22,0x46,0x84,0xb1,0x4b,0x29,0x3b,0x08,0x22,0x46,0x22,0x46,0x22,0x46,0x2a,0x46,0x32,0xc7,0x95,0x32,0x42,0x28,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x6b,0x6d,0x7b,0xef,0x4a,0x49,0x73,0xae,0x7b,0xcf,0x84,0x30,0x84,0x30,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0xae,0x8c,0x51,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x42,0x08,0x9c,0xd3,0x4a,0x49,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xb5,0x96,0xa5,0x34,0xad,0x55,0xb5,0xb6,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xa5,0x14,0xc6,0x18,0xa5,0x34,0xc6,0x18,0x9c,0xf3,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xa5,0xb5,0x42,0x49,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x7b,0xef,0x7b,0xcf,0x63,0x0c,0x84,0x30,0x63,0x0c,0x8c,0x51,0x73,0x8e,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x5a,0xeb,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0x86,0x63,0x2c,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x18,0xbd,0xf7,0xbd,0xd7,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xbd,0xd7,0xc6,0x38,0xbd,0xf7,0xb5,0x96,0xbd,0xd7,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x4a,0x69,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x22,0x46,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xbe,0x37,0x4a,0x49,0x10,0x82,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe7,0xac,0xa4,0xb4,0xe3,0xb4,0xe3,0x94,0x25,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x67,0x9c,0x44,0xb4,0xe3,0xb4,0xe3,0xb4,0xe3,0xb4,0xe3,0x94,0x05,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x7b,0xef,0x7b,0xcf,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xcf,0x7b,0xef,0x5a,0xcb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x8e,0x84,0x30,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x94,0x92,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x63,0x0a,0xa4,0x83,0x73,0x44,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xb5,0x96,0x9c,0xf3,0xa5,0x14,0xa5,0x14,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xa5,0x14,0xc6,0x38,0x94,0xb2,0xa5,0x14,0x9c,0xd3,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xeb,0x52,0x8a,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x7c,0x50,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x9d,0x33,0x7c,0x50,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0xc6,0x58,0x5a,0xeb,0x21,0x04,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x69,0xe6,0x02,0xf6,0x80,0xf6,0x80,0xf6,0x80,0xf6,0x80,0x9c,0x46,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x69,0xb4,0xe4,0xf6,0x80,0xf6,0x80,0xf6,0x80,0xf6,0x80,0xf6,0x80,0xfe,0x80,0x94,0x24,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x63,0x2c,0xb5,0x96,0xad,0x75,0x5a,0xeb,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0xb5,0x96,0xb5,0x96,0x73,0xae,0x42,0x08,0x39,0xe7,0x39,0xe7,0x63,0x2c,0x73,0x8e,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xc7,0x7b,0xef,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x62,0xea,0x8b,0xc4,0x62,0xe4,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x18,0x9c,0xf3,0xad,0x75,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xa5,0x14,0xbd,0xd7,0x94,0xb2,0xbd,0xf7,0x9c,0xf3,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x5a,0xcb,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xaa,0x39,0xe7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xbd,0xf7,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xce,0x79,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xa5,0x54,0xa5,0x34,0x8c,0x71,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0xb5,0x4e,0xb5,0x4e,0xb5,0x4e,0xb5,0x4e,0xb5,0x4e,0xa5,0x10,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x94,0xb2,0xad,0x0f,0xb5,0x4e,0xb5,0x4e,0xb5,0x4e,0xb5,0x4e,0xbd,0x6c,0xfe,0x80,0xac,0xa4,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0xa5,0x14,0xa5,0x14,0x94,0xb2,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x9c,0xf3,0xa5,0x14,0x9c,0xd3,0x5a,0xcb,0x39,0xe7,0x39,0xe7,0x63,0x0c,0x6b,0x6d,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0xa6,0x7b,0xcf,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xad,0x75,0xbd,0xf7,0xb5,0xb6,0xbd,0xf7,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xb5,0xb6,0xa5,0x34,0xad,0x75,0xc6,0x18,0xb5,0xb6,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x42,0x08,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xc6,0x38,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xc6,0x79,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x74,0x4e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xa4,0xf0,0xdd,0xc2,0x6b,0x06,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x6b,0x6d,0x7b,0xef,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x8c,0x51,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xbd,0xd7,0xad,0x55,0xad,0x55,0xb5,0xb6,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xad,0x55,0xc6,0x38,0xa5,0x14,0x9c,0xf3,0xa5,0x14,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xec,0x63,0xcd,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xc6,0x38,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xc6,0x79,0x19,0xc5,0x2a,0x86,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x73,0x8c,0x63,0x0c,0x63,0x0c,0x52,0xaa,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x7b,0xcf,0x39,0xe7,0x21,0x04,0x31,0x86,0x63,0x2c,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x5a,0xeb,0x63,0x2c,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x31,0xa6,0x73,0x8e,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xd5,0xa1,0x94,0x03,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xa5,0x34,0xc6,0x38,0xc6,0x38,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xa5,0x14,0xc6,0x18,0x94,0xb2,0xbd,0xf7,0x9c,0xf3,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x63,0xed,0x8c,0xd2,0x63,0xac,0x6c,0x2d,0x63,0xcd,0x3a,0xa9,0xc6,0x38,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xc6,0x79,0x32,0x68,0x63,0xcd,0x6c,0x2d,0x6c,0x2d,0x6c,0x2d,0x6c,0x2d,0x6c,0x2d,0xa5,0x74,0x4b,0x4a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xad,0x75,0xad,0x75,0xad,0x75,0x8c,0x51,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x94,0xb2,0x6b,0x6d,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x4a,0x69,0x94,0xb2,0x9c,0xd3,0x6b,0x6d,0x6b,0x4d,0x6b,0x4d,0x73,0xae,0x8c,0x51,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x42,0x08,0x94,0xb2,0x42,0x28,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x5a,0xea,0x5a,0xa6,0x42,0x05,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xa5,0x34,0xbd,0xf7,0xbd,0xf7,0xad,0x55,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xad,0x55,0x94,0x92,0x9c,0xd3,0xc6,0x18,0xad,0x55,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x43,0x29,0x6b,0xee,0x74,0x2f,0x7c,0x90,0x74,0x4f,0x53,0x2b,0xad,0x95,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xce,0x79,0x4b,0x0a,0x74,0x4f,0x7c,0x90,0x7c,0x90,0x7c,0x90,0x7c,0x90,0x7c,0x90,0x74,0x4e,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xad,0x75,0xad,0x75,0xad,0x75,0x8c,0x51,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x94,0xb2,0x18,0xc3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x7b,0xcf,0x9c,0xd3,0x84,0x30,0xa5,0x14,0xa5,0x14,0x42,0x28,0x5a,0xcb,0x18,0xe3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x4a,0x49,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xee,0x20,0xa4,0x42,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x18,0xad,0x75,0xad,0x75,0xc6,0x18,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xad,0x75,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0xa5,0x34,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x4b,0x0a,0x74,0x0f,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x74,0x2f,0x5b,0x8c,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x73,0x8e,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x84,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x8a,0x9c,0xd3,0x6b,0x6d,0x8c,0x71,0x7b,0xcf,0x39,0xe7,0x5a,0xeb,0x21,0x04,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xb5,0x96,0xa5,0x34,0xad,0x55,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xb5,0x96,0xa5,0x14,0xa5,0x14,0xa5,0x14,0xb5,0x96,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x2a,0x66,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x71,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x73,0xae,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x49,0x9c,0xd3,0x84,0x30,0x63,0x0c,0x7b,0xcf,0x39,0xe7,0x63,0x0c,0x31,0x86,0x29,0x45,0x29,0x45,0x29,0x65,0x29,0x65,0x21,0x24,0x29,0x65,0x29,0x45,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x65,0x29,0x45,0x29,0x65,0x29,0x45,0x29,0x65,0x4a,0x49,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x6b,0x2a,0xf6,0x40,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xa5,0x14,0xc6,0x38,0xc6,0x38,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xb5,0xb6,0xad,0x55,0x94,0x92,0xa5,0x34,0x9c,0xd3,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x7c,0x90,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x7b,0xcf,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x7b,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x49,0x9c,0xd3,0x6b,0x4d,0x94,0x92,0x84,0x30,0x39,0xe7,0x4a,0x49,0x52,0x8a,0x52,0x8a,0x73,0x8e,0x8c,0x51,0x8c,0x71,0x6b,0x6d,0x9c,0xd3,0x7b,0xcf,0x8c,0x71,0x84,0x30,0x73,0x8e,0x9c,0xd3,0x7b,0xcf,0x94,0x92,0x52,0x8a,0x5a,0xcb,0x84,0x10,0x84,0x10,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x5a,0xea,0x73,0x25,0x52,0x65,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xad,0x55,0xb5,0x96,0xb5,0xb6,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xa5,0x14,0xbd,0xf7,0x9c,0xf3,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0xa6,0x52,0x45,0x52,0x46,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x52,0xaa,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb6,0x16,0x6c,0x2d,0x6c,0x2d,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x8c,0xd1,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x73,0x8e,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x7b,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x49,0x9c,0xd3,0x7b,0xef,0x6b,0x4d,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x49,0x4a,0x69,0x4a,0x69,0x4a,0x49,0x52,0x8a,0x4a,0x49,0x4a,0x69,0x4a,0x69,0x4a,0x49,0x52,0x8a,0x4a,0x49,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x63,0x2c,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xc3,0x18,0xe3,0x63,0x0c,0x63,0x2a,0xc5,0x42,0x8b,0xc3,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x18,0xb5,0xb6,0xb5,0x96,0xbd,0xf7,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x18,0xc6,0x38,0xbd,0xd7,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x41,0xe5,0x9b,0xe0,0x93,0xc2,0x62,0xea,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xcb,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xad,0xd5,0xad,0xd5,0x95,0x12,0x43,0x28,0x3b,0x08,0x3b,0x08,0x7c,0x6f,0xb5,0xd6,0xad,0xd5,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0x8c,0xf2,0x8c,0xf2,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x69,0x95,0x33,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0x92,0x94,0x92,0x94,0x92,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x84,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xaa,0x9c,0xd3,0x73,0x8e,0x84,0x10,0x84,0x10,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x0c,0x63,0x2c,0x63,0x2c,0x63,0x2c,0x73,0xae,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x4a,0x69,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x73,0xae,0x6b,0x6d,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xb5,0xb6,0xad,0x75,0xa5,0x14,0xa5,0x14,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0xa6,0x62,0xc4,0x62,0xc5,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x5a,0xcb,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xb6,0x17,0xa5,0x95,0xad,0xd5,0x43,0x29,0x3b,0x08,0x3b,0x08,0x63,0xed,0xd6,0xda,0x9d,0x53,0x95,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xf6,0x5b,0xab,0x8c,0xd1,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x69,0x95,0x12,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xa5,0x14,0x9c,0xf3,0x9c,0xf3,0x7b,0xef,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x94,0xb2,0x18,0xe3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x7b,0xef,0x9c,0xd3,0x6b,0x6d,0x73,0xae,0x8c,0x51,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x9c,0xd3,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0x8c,0x51,0x63,0x0c,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x28,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xad,0x55,0xad,0x55,0xc6,0x18,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0x74,0x4e,0x95,0x32,0x7c,0xb0,0x3b,0x08,0x3b,0x08,0x43,0x08,0x8c,0xd1,0x6c,0x2d,0xa5,0x94,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xbe,0x37,0xb5,0xf6,0xd6,0xba,0x84,0xd1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x95,0x12,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x6b,0x6d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x94,0xb2,0x6b,0x6d,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x8a,0x94,0xb2,0x9c,0xd3,0x63,0x0c,0x4a,0x69,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x63,0x0a,0xac,0xa3,0x7b,0x64,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xbd,0xd7,0xb5,0x96,0x9c,0xf3,0xa5,0x34,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x32,0xa5,0xb5,0x53,0x6a,0xa5,0x74,0x32,0xa7,0x22,0x05,0x22,0x05,0xad,0xb5,0x7c,0x90,0x74,0x4e,0x95,0x32,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x53,0x8a,0x43,0x28,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x9d,0x33,0x94,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xad,0x75,0xad,0x55,0xad,0x55,0x84,0x30,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x7b,0xef,0x39,0xc7,0x21,0x24,0x31,0x86,0x6b,0x4d,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0xb6,0xb5,0x96,0xb5,0x96,0xb5,0xb6,0xb5,0x96,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xea,0x7b,0x65,0x5a,0x85,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xbd,0xd7,0xb5,0x96,0xb5,0xb6,0xbd,0xd7,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0x95,0x33,0xad,0xd6,0x9d,0x34,0x19,0xe5,0x22,0x05,0x22,0x05,0x84,0xb1,0x94,0xf2,0xb5,0xf6,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0xb5,0xd6,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x84,0x30,0x84,0x10,0x84,0x10,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xb5,0x96,0xbd,0xf7,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0x64,0x0d,0x5b,0xac,0x7c,0x50,0x22,0x26,0x84,0xaf,0x84,0xb0,0x84,0x90,0x32,0x67,0x74,0x6f,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0xbe,0x17,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xa5,0x14,0xa5,0x14,0xa5,0x14,0x7b,0xef,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x94,0xb2,0xa5,0x14,0x9c,0xf3,0x94,0xb2,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0xa5,0x14,0xa5,0x14,0x9c,0xd3,0x5a,0xeb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xf6,0x60,0xa4,0x62,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xbd,0xd7,0xc6,0x18,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0x7c,0x6f,0xad,0xb5,0xb5,0xb6,0x32,0x87,0x8c,0xf1,0x84,0xd0,0xa5,0xb5,0x9d,0x33,0x74,0x4e,0x95,0x32,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xad,0xb5,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x63,0x2c,0xb5,0x96,0xad,0x75,0x63,0x0c,0x4a,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x49,0xb5,0x96,0xb5,0x96,0x7b,0xcf,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x51,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x2a,0xdd,0xc1,0x9c,0x23,0x31,0x86,0xad,0x75,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xbd,0xd7,0xc6,0x38,0xc6,0x38,0xbd,0xf7,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xce,0x59,0xc6,0x38,0xce,0x59,0xc6,0x38,0xce,0x59,0xce,0x59,0xc6,0x38,0xc6,0x38,0xce,0x59,0x84,0x10,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x52,0x8a,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xa5,0x74,0x8c,0xd2,0x8c,0xd2,0x3b,0x08,0x32,0xa7,0x22,0x46,0x63,0xcd,0x53,0x6b,0xad,0xb5,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x9d,0x53,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0x92,0x8c,0x71,0x8c,0x71,0x73,0x8e,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x69,0x7b,0xef,0x7b,0xef,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x7b,0xef,0x5a,0xcb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x8c,0x71,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x9c,0xf3,0x84,0x10,0x52,0x8a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x4a,0x46,0x39,0xe6,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xa5,0x14,0xad,0x55,0xad,0x55,0xad,0x55,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x31,0xa6,0x6a,0xe3,0x73,0x04,0x52,0x89,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x5a,0xcb,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x2a,0x66,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0xa7,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x8c,0xd1,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xad,0x55,0xad,0x55,0xad,0x55,0x84,0x30,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xef,0x84,0x30,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xcb,0x39,0xc7,0x31,0x86,0x31,0x86,0xad,0x75,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xb5,0xb6,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0xc6,0x38,0x84,0x10,0x31,0x86,0x39,0xc5,0x93,0xc0,0x9b,0xe1,0x62,0xea,0x5a,0xcb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xcb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xcb,0x5a,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0xcb,0x5a,0xcb,0x42,0x08,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3a,0xe8,0x1a,0x05,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x43,0x28,0x2a,0x67,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x84,0xd1,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x84,0x10,0x7b,0xef,0x7b,0xef,0x63,0x2c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x8e,0x39,0xe7,0x31,0x86,0x31,0x86,0x6b,0x6d,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x94,0x91,0x8c,0x71,0x94,0x91,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x8c,0x71,0x52,0xaa,0x31,0x86,0x31,0x86,0x41,0xe5,0x4a,0x26,0x42,0x07,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x39,0xc7,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x32,0xa7,0x19,0xe5,0xad,0x75,0xde,0xfb,0xde,0xfb,0x4b,0x0a,0x19,0xe5,0x19,0xe5,0x2a,0x47,0xce,0x9a,0xde,0xfb,0xde,0xdb,0x3a,0xc8,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x84,0xb0,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xad,0x75,0xad,0x55,0xad,0x55,0x84,0x30,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x8e,0x39,0xe7,0x31,0x86,0x31,0x86,0x7b,0x44,0x9c,0x42,0x9c,0x42,0x73,0x44,0x5a,0x85,0x9c,0x42,0xa4,0x42,0x9c,0x22,0x39,0xe6,0x9c,0x42,0xa4,0x42,0x9c,0x42,0x4a,0x45,0x83,0xa3,0xa4,0x42,0xa4,0x42,0x73,0x24,0x62,0xc4,0xa4,0x42,0xa4,0x42,0x8b,0xc3,0x4a,0x25,0x9c,0x23,0xa4,0x42,0xa4,0x42,0x42,0x05,0x93,0xe3,0xa4,0x42,0xa4,0x42,0x62,0xc4,0x6b,0x04,0xa4,0x42,0xa4,0x42,0x83,0xa3,0x52,0x65,0x9c,0x42,0xa4,0x42,0x9c,0x23,0x4a,0x25,0x8b,0xe3,0xa4,0x42,0xa4,0x42,0x52,0x85,0x7b,0x63,0xa4,0x42,0xa4,0x42,0x7b,0x44,0x5a,0x85,0x9c,0x42,0xa4,0x42,0x93,0xe3,0x4a,0x25,0x94,0x03,0xa4,0x42,0x9c,0x42,0x52,0x65,0x7b,0x63,0xa4,0x42,0xa4,0x42,0x6a,0xe4,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x5a,0xcb,0xf7,0x9e
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xce,0x59,0xef,0x7d,0xef,0x7d,0x8c,0xd1,0x22,0x05,0x19,0xe5,0x32,0x67,0xef,0x5c,0xef,0x7d,0xef,0x5d,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0x92,0x8c,0x71,0x8c,0x71,0x73,0x8e,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x8e,0x39,0xe7,0x31,0xa6,0x31,0x86,0xb4,0xc2,0xfe,0x80,0xfe,0x80,0xac,0xa2,0x7b,0x64,0xf6,0x80,0xfe,0x80,0xf6,0x60,0x4a,0x25,0xf6,0x60,0xfe,0x80,0xf6,0x60,0x62,0xc4,0xc5,0x41,0xfe,0x80,0xfe,0x80,0xa4,0x62,0x8b,0xe3,0xfe,0x80,0xfe,0x80,0xd5,0x81,0x62,0xa4,0xee,0x40,0xfe,0x80,0xfe,0x80,0x52,0x85,0xdd,0xc1,0xfe,0x80,0xfe,0x80,0x8b,0xc3,0x9c,0x23,0xfe,0x80,0xfe,0x80,0xcd,0x41,0x73,0x24,0xfe,0x80,0xfe,0x80,0xee,0x20,0x5a,0x85,0xdd,0xc1,0xfe,0x80,0xfe,0x80,0x73,0x44,0xbd,0x02,0xfe,0x80,0xfe,0x80,0xb4,0xc2,0x73,0x44,0xf6,0x60,0xfe,0x80,0xdd,0xc1,0x5a,0x85,0xee,0x20,0xfe,0x80,0xfe,0x80,0x6b,0x04,0xbd,0x02,0xfe,0x80,0xfe,0x80,0x94,0x03,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xc6,0x31,0xa6,0x31,0xc6,0x31,0xa6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x31,0xc6,0x39,0xe7,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x52,0x8a,0x6b,0x4d,0xef,0x7d
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x8c,0xb2,0xad,0x55,0xad,0x55,0x63,0xcd,0x3a,0xe7,0x22,0x05,0x32,0x67,0xa5,0x54,0xad,0x55,0xa5,0x54,0x32,0x87,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x73,0x8e,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xeb,0x6b,0x4d,0x63,0x0c,0x42,0x08,0x9c,0x8d,0xc5,0xef,0xc5,0xef,0x8c,0x2c,0x73,0x6a,0xc5,0xcf,0xc5,0xef,0xc5,0xaf,0x4a,0x48,0xc5,0xcf,0xc5,0xef,0xc5,0xcf,0x5a,0xc9,0xa4,0xee,0xc5,0xef,0xc5,0xef,0x84,0x0b,0x83,0xcb,0xc5,0xef,0xc5,0xef,0xad,0x0d,0x5a,0xc9,0xc5,0xaf,0xc5,0xef,0xc5,0xef,0x52,0x68,0xb5,0x6f,0xc5,0xef,0xc5,0xef,0x73,0x8a,0x84,0x0c,0xc5,0xcf,0xc5,0xef,0xa4,0xcd,0x6b,0x2a,0xc5,0xcf,0xc5,0xef,0xbd,0x8f,0x52,0x88,0xb5,0x4e,0xc5,0xef,0xc5,0xef,0x63,0x09,0x9c,0xad,0xc5,0xef,0xc5,0xef,0x94,0x6c,0x6b,0x4a,0xc5,0xcf,0xc5,0xef,0xb5,0x4e,0x52,0xa9,0xbd,0x8f,0xc5,0xef,0xc5,0xcf,0x62,0xe9,0xa4,0xcd,0xc5,0xef,0xc5,0xef,0x7b,0xcb,0x52,0xaa,0x42,0x88,0x22,0x26,0x2a,0x66,0x2a,0x66,0x2a,0x46,0x32,0x87,0x22,0x26,0x32,0xc7,0x19,0xc5,0x32,0x87,0x3a,0xe8,0x3a,0xe8,0x4b,0x49,0x74,0x4e,0x63,0xec,0x43,0x08,0x63,0xcc,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xff,0xdf,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3a,0xe8,0x42,0xc9,0x5b,0x0c,0x29,0x66,0x29,0x65,0x73,0xee,0x32,0xa7,0x32,0xa7,0x63,0xad,0x3a,0x08,0x29,0x66,0x39,0xe7,0x6b,0xee,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x94,0x92,0x94,0x92,0x73,0xae,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x51,0xad,0x55,0xad,0x55,0x7b,0xef,0x6b,0x4d,0xad,0x55,0xad,0x55,0xa5,0x34,0x4a,0x49,0xad,0x55,0xad,0x55,0xa5,0x34,0x52,0xaa,0x94,0x92,0xad,0x55,0xad,0x55,0x73,0xae,0x73,0xae,0xad,0x55,0xad,0x55,0x94,0x92,0x52,0xaa,0xa5,0x34,0xad,0x55,0xad,0x55,0x4a,0x69,0x9c,0xf3,0xad,0x55,0xad,0x55,0x6b,0x4d,0x7b,0xcf,0xad,0x55,0xad,0x55,0x8c,0x51,0x63,0x0c,0xad,0x55,0xad,0x55,0xa5,0x14,0x52,0x8a,0x9c,0xf3,0xad,0x55,0xad,0x55,0x5a,0xeb,0x8c,0x51,0xad,0x55,0xad,0x55,0x84,0x10,0x63,0x2c,0xad,0x55,0xad,0x55,0x9c,0xd3,0x52,0x8a,0xa5,0x14,0xad,0x55,0xad,0x55,0x5a,0xcb,0x8c,0x71,0xad,0x55,0xad,0x55,0x73,0x8e,0x39,0xe7,0x29,0xa5,0x22,0x05,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x43,0x08,0xad,0xb5,0x84,0xb0,0xa5,0x74,0x7c,0x8f,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x5b,0x8c,0x73,0xae,0x29,0x66,0x29,0x65,0x8c,0x71,0x32,0x67,0x32,0xa7,0x7c,0x50,0x4a,0x69,0x29,0x65,0x42,0x08,0x84,0x70,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x71,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x49,0x4a,0x69,0x4a,0x69,0x42,0x28,0x42,0x28,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x39,0xe7,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x08,0x4a,0x49,0x4a,0x69,0x4a,0x69,0x42,0x28,0x42,0x28,0x4a,0x69,0x4a,0x69,0x4a,0x49,0x42,0x08,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x08,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x28,0x42,0x28,0x4a,0x69,0x4a,0x69,0x4a,0x49,0x42,0x08,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x08,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x08,0x4a,0x49,0x4a,0x69,0x4a,0x69,0x4a,0x49,0x42,0x28,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x08,0x4a,0x69,0x4a,0x69,0x4a,0x69,0x42,0x08,0x4a,0x49,0x4a,0x69,0x4a,0x69,0x42,0x28,0x39,0xe7,0x29,0x85,0x21,0xe5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x43,0x08,0x95,0x33,0x43,0x29,0x74,0x6f,0x7c,0x90,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x32,0xc7,0x22,0x06,0x6b,0x6d,0x4a,0x69,0x4a,0x69,0x53,0x0b,0x22,0x46,0x32,0xa7,0x42,0xc9,0x52,0xca,0x4a,0x69,0x4a,0x69,0x2a,0x26,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x84,0x10,0x7b,0xef,0x7b,0xef,0x6b,0x4d,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x21,0x64,0x19,0xc5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x84,0xb1,0xbe,0x17,0x6c,0x4e,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x19,0xe5,0xc6,0x38,0xf7,0x9e,0xf7,0x9e,0x74,0x0f,0x22,0x46,0x32,0xa7,0x32,0x67,0xef,0x7d,0xf7,0x9e,0xf7,0x9d,0x32,0x67,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0x6f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0xad,0x55,0xad,0x55,0xad,0x55,0x84,0x30,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x41,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x41,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x21,0x65,0x19,0xc5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x43,0x28,0xb5,0xf6,0x84,0xb0,0xbe,0x17,0x8d,0x12,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x32,0x87,0x19,0xe5,0xb5,0xd6,0xe7,0x3c,0xe7,0x3c,0x74,0x0f,0x22,0x46,0x32,0xa7,0x32,0x67,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0x32,0x67,0x22,0x26,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4f,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xf3,0xb5,0x96,0xb5,0x96,0xb5,0x96,0x8c,0x71,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xbd,0x03,0xdd,0xc3,0xa4,0x64,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x83,0x85,0xd5,0x83,0xcd,0x83,0x7b,0x86,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xac,0x84,0xdd,0xe3,0xb4,0xe3,0x5a,0xa7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x26,0xc5,0x43,0xd5,0xa3,0x94,0x05,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x94,0x05,0xdd,0xc3,0xc5,0x43,0x6b,0x06,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xbc,0xe4,0xdd,0xc3,0xa4,0x84,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x83,0x86,0xd5,0x83,0xcd,0x83,0x7b,0x86,0x41,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xa4,0x84,0xdd,0xc3,0xb4,0xe4,0x5a,0xa7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x06,0xc5,0x43,0xd5,0xc3,0x94,0x05,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0x94,0x25,0xd5,0xc3,0xc5,0x43,0x6b,0x06,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xb4,0xe3,0xdd,0xe2,0xa4,0x84,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0x86,0xcd,0x83,0xcd,0x83,0x7b,0x86,0x41,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xa4,0x84,0xdd,0xe3,0xb4,0xe3,0x5a,0x87,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x06,0xc5,0x43,0xd5,0xa3,0x94,0x05,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x27,0x94,0x05,0xd5,0xc3,0xc5,0x43,0x6b,0x06,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xbd,0x03,0xdd,0xc3,0xa4,0x84,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x19,0xc5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x64,0x0d,0x8d,0x12,0x5b,0xcc,0x5b,0xcb,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xc5,0x2a,0x66,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x53,0x4b,0x74,0x2e,0x6c,0x0e,0x32,0x68,0x22,0x46,0x32,0xa7,0x21,0xe5,0x5b,0x8c,0x74,0x4e,0x5b,0xad,0x22,0x05,0x2a,0x46,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x2e,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x7b,0xcd,0x6b,0x4d,0x6b,0x4d,0x5a,0xcb,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x73,0xae,0x84,0x10,0x52,0xaa,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x45,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xc6,0xee,0x41,0xfe,0x80,0xfe,0x80,0xee,0x40,0x5a,0xc8,0x52,0xaa,0x4a,0x69,0x52,0x8a,0x9c,0x44,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xb4,0xe3,0x5a,0xcb,0x4a,0x49,0x5a,0xeb,0x4a,0x67,0xdd,0xc2,0xfe,0x80,0xfe,0x80,0xf6,0x80,0x73,0x26,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x66,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xd5,0xa2,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x42,0x07,0xbd,0x03,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x25,0x52,0xaa,0x4a,0x49,0x63,0x0c,0x5a,0xc7,0xee,0x21,0xfe,0x80,0xfe,0x80,0xee,0x21,0x6b,0x08,0x52,0xaa,0x52,0x8a,0x52,0xaa,0x9c,0x25,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x5a,0xeb,0x52,0xaa,0x52,0x8a,0x5a,0xc9,0xdd,0xc2,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x83,0xa6,0x6b,0x4d,0x42,0x08,0x63,0x0c,0x7b,0x86,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x63,0x2b,0x5a,0xcb,0x4a,0x69,0x52,0xaa,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x64,0x63,0x2c,0x4a,0x69,0x5a,0xeb,0x62,0xe8,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xf6,0x40,0x5a,0xc7,0x63,0x0c,0x4a,0x69,0x5a,0xcb,0xa4,0x64,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x43,0x5a,0xcb,0x73,0xae,0x7b,0xcf,0x4a,0x68,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xf6,0x80,0x7b,0x86,0x4a,0x49,0x4a,0x49,0x63,0x2c,0x7b,0x85,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xdd,0xe2,0x42,0x27,0x39,0xe7,0x39,0xe7,0x42,0x07,0xc5,0x23,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x21,0xe5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x42,0xe9,0x3a,0xa9,0x4b,0x4a,0x43,0x09,0x3a,0xa8,0x3a,0xa8,0x32,0xa7,0x32,0x88,0x3a,0x88,0x4b,0x4a,0x3a,0xa8,0x32,0x88,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x4e,0x94,0xd2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x94,0xb2,0x94,0xb2,0x9c,0xd3,0x94,0xb2,0x9c,0xd3,0x9c,0xd3,0xa4,0xf0,0xd5,0xa2,0x62,0xe6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x9c,0xd3,0x7b,0xef,0x52,0xa9,0xe5,0xe1,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x22,0x63,0x0b,0x84,0x10,0x63,0x0c,0x73,0x46,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x8c,0x09,0x8c,0x71,0x84,0x10,0x6b,0x6d,0xbd,0x23,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x84,0x2f,0x84,0x10,0x84,0x30,0x62,0xe8,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x05,0x6b,0x4d,0x7b,0xef,0x5a,0xcb,0x94,0x04,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x41,0x63,0x08,0x4a,0x69,0x73,0xae,0x52,0x88,0xe5,0xe2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbc,0xe3,0x84,0x10,0x84,0x10,0x84,0x10,0x83,0xa7,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x8c,0x09,0x8c,0x71,0x84,0x10,0x73,0x8e,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xe2,0x73,0x8d,0x84,0x30,0x84,0x30,0x8c,0x0b,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x86,0x8c,0x51,0x7b,0xef,0x94,0x92,0xa4,0x64,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x40,0x8c,0x2d,0x8c,0x51,0x84,0x30,0x7b,0xcd,0xe5,0xe1,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x02,0x7b,0xef,0x84,0x30,0x94,0x92,0x94,0x28,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x7b,0x66,0x9c,0xf3,0x84,0x10,0x84,0x0f,0xc5,0x23,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe5,0xe1,0x63,0x0a,0x9c,0xd3,0x94,0xb2,0x62,0xe8,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x84,0x73,0x8e,0x7b,0xcf,0x8c,0x71,0x9c,0x24,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x40,0x6b,0x29,0x7b,0xcf,0x7b,0xcf,0x4a,0x68,0xdd,0xe2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x22,0x42,0x07,0x39,0xe7,0x21,0x44,0x21,0xc5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x3a,0xe8,0xb5,0xb6,0x7c,0x50,0x94,0xf2,0x84,0x91,0x84,0x91,0x8c,0xd1,0x53,0x4a,0xad,0x95,0x8c,0xb1,0x95,0x33,0x8c,0xd2,0xa5,0x54,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0x8c,0xb1,0xad,0x75,0xad,0x55,0xad,0x75,0xad,0x55,0xad,0x55,0xad,0x54,0xb5,0x4d,0xb5,0x4d,0xb5,0x4d,0xb5,0x4d,0xb5,0x4d,0xb5,0x50,0xad,0x55,0xad,0x55,0xad,0x55,0xad,0x55,0xad,0x55,0xad,0x55,0xad,0x55,0xb5,0x4f,0xb5,0x4d,0xb5,0x4d,0xb5,0x4d,0xb5,0x4d,0xbd,0x6b,0xfe,0x80,0xa4,0x84,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x8a,0x8c,0x71,0x8c,0x51,0x5a,0xa9,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x42,0x84,0x30,0x7b,0xcf,0x7b,0xef,0x7b,0x66,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x83,0xe8,0x5a,0xeb,0x42,0x08,0x4a,0x49,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x63,0x2b,0x42,0x08,0x42,0x28,0x5a,0xa7,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x65,0x84,0x30,0x6b,0x6d,0x7b,0xcf,0x9c,0x25,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x41,0x7b,0xcb,0x8c,0x51,0x84,0x10,0x73,0x8c,0xe6,0x02,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x63,0x2c,0x5a,0xeb,0x5a,0xeb,0x7b,0x66,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x7b,0xa8,0x52,0x8a,0x6b,0x4d,0x52,0x89,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe5,0xe2,0x5a,0xca,0x7b,0xef,0x7b,0xef,0x6b,0x48,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x45,0x5a,0xcb,0x52,0x8a,0x5a,0xcb,0xa4,0x83,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x7b,0xaa,0x52,0x8a,0x5a,0xeb,0x5a,0xe9,0xe6,0x01,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x22,0x63,0x0b,0x4a,0x49,0x5a,0xeb,0x83,0xa6,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x7b,0x86,0x63,0x0c,0x52,0x8a,0x5a,0xca,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x01,0x83,0xee,0x5a,0xeb,0x6b,0x6d,0x62,0xe8,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xac,0x84,0x63,0x2c,0x42,0x28,0x73,0x8d,0x9c,0x24,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x94,0x4d,0x8c,0x51,0x6b,0x6d,0x6b,0x4c,0xe5,0xe2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x42,0x42,0x07,0x39,0xe7,0x29,0x65,0x21,0xe5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x32,0x87,0x9d,0x13,0x9d,0x13,0xd6,0xba,0xce,0x79,0x74,0x0f,0x8c,0xd1,0x5b,0x8b,0x7c,0x70,0xbd,0xf7,0xce,0x99,0xc6,0x38,0x74,0x0f,0x6b,0xee,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0x94,0xb2,0x29,0x65,0x52,0xaa,0x5a,0xcb,0x5a,0xcb,0x5a,0xca,0xee,0x21,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xac,0xa6,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xcb,0x5a,0xca,0xbd,0x24,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x44,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x6b,0x4d,0x73,0x8e,0x6b,0x6d,0x6b,0x4b,0xe5,0xe1,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x22,0x63,0x0c,0x63,0x2c,0x52,0x8a,0x73,0x66,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x8c,0x29,0x8c,0x71,0x73,0x8e,0x7b,0xcf,0xbd,0x23,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x7b,0xcd,0x7b,0xcf,0x73,0xae,0x6b,0x29,0xf6,0x61,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x94,0x25,0x63,0x2c,0x52,0xaa,0x52,0x8a,0x94,0x04,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xee,0x41,0x62,0xc7,0x63,0x2c,0x6b,0x4d,0x4a,0x68,0xe5,0xe2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbc,0xe3,0x7b,0xef,0x9c,0xf3,0x8c,0x51,0x83,0xc7,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x83,0xc8,0x7b,0xef,0x84,0x10,0x84,0x30,0xc5,0x43,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xdd,0xe2,0x73,0x8d,0x84,0x30,0x8c,0x71,0x8c,0x0b,0xf6,0x41,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x86,0x8c,0x51,0x73,0xae,0x84,0x30,0xa4,0x63,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x8c,0x4d,0x8c,0x71,0x7b,0xcf,0x7b,0xed,0xe5,0xe1,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x22,0x7b,0xce,0x7b,0xef,0x94,0x92,0x94,0x29,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x7b,0x66,0x84,0x30,0x84,0x30,0x8c,0x71,0xc5,0x23,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe5,0xe1,0x63,0x0a,0x9c,0xd3,0x8c,0x71,0x5a,0xc8,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x64,0x7b,0xcf,0xa5,0x14,0x6b,0x6d,0x94,0x24,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x73,0x69,0x6b,0x4d,0x4a,0x69,0x52,0x89,0xdd,0xe2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x22,0x42,0x07,0x39,0xe7,0x21,0x24,0x21,0xe5,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x22,0x26,0x2a,0x66,0x3b,0x08,0x2a,0x87,0x9d,0x13,0xce,0x58,0xef,0x5a,0xef,0x7b,0x94,0xd2,0x8c,0xd1,0x5b,0x8b,0x84,0xb1,0xef,0x5b,0xef,0x7b,0xef,0x7c,0x74,0x2f,0x6b,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x7c,0x2f,0x00,0x00,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x46,0xbd,0x23,0xc5,0x43,0xc5,0x43,0xac,0xa4,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0x87,0xb4,0xc4,0xc5,0x43,0xc5,0x43,0xc5,0x43,0xc5,0x43,0xac,0x84,0x52,0x67,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x52,0xaa,0x4a,0x69,0x4a,0x49,0x52,0x89,0xcd,0x62,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x64,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xe6,0xee,0x40,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x62,0xe8,0x52,0xaa,0x63,0x0c,0x52,0x8a,0xa4,0x64,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xbd,0x03,0x52,0x8a,0x6b,0x4d,0x63,0x2c,0x52,0x67,0xdd,0xe2,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x7b,0x66,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0x85,0xf6,0x60,0xfe,0x80,0xfe,0x80,0xdd,0xc2,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x42,0x07,0xc5,0x23,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x9c,0x44,0x63,0x2c,0x73,0x8e,0x6b,0x6d,0x62,0xe7,0xee,0x41,0xfe,0x80,0xfe,0x80,0xee,0x21,0x62,0xe7,0x63,0x2c,0x7b,0xcf,0x52,0x8a,0x9c,0x64,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xc5,0x43,0x4a,0x69,0x84,0x10,0x7b,0xef,0x5a,0xa9,0xdd,0xe1,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x8b,0xc6,0x5a,0xcb,0x42,0x28,0x42,0x28,0x83,0xa6,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xe5,0xe1,0x63,0x0a,0x52,0x8a,0x6b,0x4d,0x4a,0x69,0xcd,0x62,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x84,0x4a,0x69,0x6b,0x6d,0x63,0x2c,0x62,0xe7,0xf6,0x80,0xfe,0x80,0xfe,0x80,0xf6,0x60,0x62,0xe7,0x63,0x2c,0x5a,0xeb,0x52,0xaa,0xa4,0x84,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xcd,0x62,0x63,0x2c,0x52,0xaa,0x63,0x0c,0x4a,0x68,0xe6,0x21,0xfe,0x80,0xfe,0x80,0xfe,0x80,0x83,0xc6,0x73,0x8e,0x4a,0x49,0x63,0x2c,0x83,0xa5,0xf6,0x80,0xfe,0x80,0xfe,0x80,0xe6,0x01,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x42,0x07,0xc5,0x42,0xfe,0x80,0xfe,0x80,0xfe,0x80,0xa4,0x64,0x39,0xe7,0x31,0xa6,0x19,0x64,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xc5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x66,0x4b,0x49,0xc6,0x58,0xa5,0x54,0xbe,0x38,0x63,0xcd,0x9d,0x13,0xb5,0xd6,0xe7,0x19,0xe7,0x19,0x8c,0x71,0x8c,0xd1,0x5b,0x8b,0x84,0xb1,0xe7,0x1a,0xef,0x39,0xe7,0x3a,0x84,0x91,0x74,0x0e,0xd6,0xba,0xad,0xb5,0xc6,0x78,0x5b,0xcb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0x42,0x68,0x08,0x41,0x31,0x86,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xc7,0xcd,0x82,0xe6,0x01,0xbd,0x03,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x94,0x05,0xdd,0xe1,0xdd,0xe1,0x8b,0xe5,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xc5,0x23,0xe6,0x01,0xcd,0x62,0x5a,0xc6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x7b,0x66,0xd5,0xa2,0xe5,0xe1,0xac,0xa4,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xac,0xa4,0xe6,0x01,0xd5,0xa2,0x73,0x46,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x62,0xc6,0xcd,0x62,0xe6,0x01,0xbd,0x23,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x94,0x05,0xdd,0xe1,0xdd,0xe1,0x8b,0xe5,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xbd,0x23,0xe6,0x01,0xcd,0x62,0x5a,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x46,0xd5,0xa1,0xe5,0xe1,0xa4,0x84,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xac,0x84,0xe5,0xe1,0xd5,0xa2,0x73,0x46,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xcd,0x62,0xe6,0x01,0xbd,0x03,0x4a,0x47,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8b,0xe5,0xdd,0xe1,0xdd,0xe1,0x8b,0xe5,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x47,0xbd,0x03,0xe6,0x01,0xcd,0x62,0x5a,0xa7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x73,0x46,0xd5,0xa2,0xe5,0xe1,0xa4,0x84,0x42,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x42,0x07,0xa4,0x84,0xe5,0xe1,0xdd,0xc1,0x73,0x26,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x5a,0xa7,0xcd,0x82,0xe6,0x01,0xbd,0x03,0x4a,0x47,0x31,0xa6,0x10,0xc2,0x2a,0x46,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xc5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3a,0xe7,0x19,0xe5,0x2a,0x46,0x43,0x28,0xad,0xb5,0x84,0x91,0xb5,0xd6,0x5b,0xac,0x9d,0x13,0x95,0x13,0xff,0xff,0xff,0xdf,0x5b,0x8c,0x8c,0xd1,0x5b,0x8b,0x7c,0x70,0xd6,0xda,0xff,0xff,0xe7,0x5c,0x74,0x0f,0x74,0x4f,0xb5,0xf6,0x9d,0x74,0xbe,0x17,0x53,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xd1,0x39,0xe7,0x08,0x41,0x08,0x61,0x08,0x61,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xa2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x10,0xa2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xa2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x10,0xa2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xa2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x10,0xa2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xa2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x10,0xa2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xa2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x10,0xa2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xa2,0x18,0xc2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x18,0xc2,0x10,0xa2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xa2,0x18,0xc2,0x10,0x82,0x10,0xa2,0x08,0xa2,0x11,0x84,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xc5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x22,0x26,0x19,0xe5,0x32,0xa7,0x74,0x2e,0xb5,0xd7,0x7c,0x30,0x2a,0x66,0x9d,0x13,0x95,0x13,0xff,0xff,0xff,0xdf,0x5b,0x8c,0x8c,0xd1,0x5b,0x8b,0x7c,0x70,0xd6,0xda,0xff,0xff,0xe7,0x5c,0x74,0x0f,0x74,0x4f,0x63,0xec,0xad,0x95,0x8c,0xf1,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x5b,0x8b,0x3a,0xa8,0x32,0x46,0x32,0x67,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x3a,0xa8,0x32,0x67,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x29,0xe6,0x3a,0x87,0x3a,0x87,0x2a,0x06,0x21,0xe6,0x3a,0x87,0x3a,0xa8,0x2a,0x06,0x21,0xe6,0x32,0x27,0x3a,0xa8,0x32,0x47,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x32,0x47,0x3a,0xa8,0x32,0x47,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x29,0xe6,0x32,0x67,0x3a,0xa8,0x32,0x26,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x2a,0x26,0x3a,0xa8,0x32,0x67,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x2a,0x06,0x3a,0xa8,0x32,0x67,0x29,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x21,0xe6,0x29,0xe6,0x3a,0x87,0x3a,0xa8,0x2a,0x26,0x21,0xe6,0x32,0x47,0x3a,0xa8,0x32,0x26,0x21,0xe6,0x32,0x26,0x3a,0xa8,0x32,0x47,0x21,0xe6,0x2a,0x26,0x3a,0xa8,0x3a,0xa8,0x2a,0x06,0x21,0xe6,0x32,0x47,0x3a,0xa8,0x2a,0x26,0x21,0xe6,0x32,0x47,0x3a,0xa8,0x32,0x67,0x21,0xe6,0x2a,0x06,0x3a,0xa8,0x3a,0x87,0x29,0xe6,0x21,0xe6,0x2a,0x06,0x3a,0xa8,0x3a,0xa8,0x32,0x67,0x21,0xe6,0x3a,0x87,0x3a,0xa8,0x3a,0x87,0x3a,0xa7,0x3a,0xa8,0x3a,0xc8,0x42,0xe8,0x32,0x87,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3a,0xc7,0x22,0x05,0x2a,0x46,0xbe,0x38,0xad,0xd5,0xce,0xb9,0x53,0x4b,0x9d,0x13,0xa5,0x74,0xf7,0x7c,0xf7,0x7c,0x5b,0x8c,0x7c,0x70,0x4b,0x0a,0x8c,0xf1,0xd6,0xba,0xf7,0x9d,0xe7,0x1b,0x74,0x0f,0x7c,0x4f,0xad,0xd6,0xad,0xb5,0xd6,0xba,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x22,0x25,0x32,0xa7,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x22,0x25,0x3a,0xe7,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x22,0x05,0x3a,0xe7,0x32,0xc7,0x1a,0x05,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0x87,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x3b,0x08,0x22,0x46,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xc5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x22,0x26,0x7c,0x70,0x9d,0x54,0x6c,0x0d,0x4b,0x4a,0x95,0x12,0xc6,0x57,0xf7,0x79,0xf7,0x7a,0x84,0x70,0x7c,0x70,0x3a,0x88,0x8c,0xf2,0xef,0x5a,0xef,0x79,0xef,0x7a,0x74,0x2f,0x74,0x0e,0xad,0xd5,0x9d,0x74,0x7c,0x90,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x84,0xd1,0xbe,0x58,0xb6,0x16,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xb5,0xf6,0xc6,0x58,0x8c,0xf1,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xad,0xd5,0xbe,0x58,0x84,0xd1,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x95,0x32,0xbe,0x58,0xb5,0xf6,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x84,0xb0,0xbe,0x17,0xb6,0x16,0x5b,0xac,0x19,0xc5,0x19,0xe5,0x2a,0x86,0x2a,0x46,0x42,0xc9,0x9d,0x34,0xbe,0x58,0x95,0x33,0x2a,0x46,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x53,0x4b,0xad,0xb5,0xbe,0x37,0x7c,0x6f,0x22,0x06,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x47,0x84,0xb1,0xbe,0x37,0x9d,0x53,0x3a,0xa8,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x3a,0x88,0x9d,0x54,0xc6,0x78,0x95,0x13,0x32,0x67,0x2a,0x46,0x3a,0xe8,0x2a,0x86,0x22,0x06,0x7c,0x2f,0xbe,0x37,0xb5,0xf6,0x4b,0x0a,0x22,0x05,0x32,0xc7,0x3b,0x08,0x2a,0x46,0x4b,0x0a,0xa5,0x75,0xbe,0x37,0x84,0xb1,0x22,0x06,0x22,0x05,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x5b,0xab,0x74,0x6e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x2a,0x66,0x2a,0x86,0x3a,0xc8,0xad,0xb5,0xef,0x3c,0xef,0x3c,0x63,0xcd,0x2a,0x46,0x19,0xe5,0x3a,0xc9,0xe7,0x3c,0xef,0x3c,0xe7,0x3c,0x3a,0xa9,0x2a,0x67,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x5b,0xec,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xdf,0xad,0xb5,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xc7,0x22,0x25,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x53,0x2b,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb5,0x22,0x26,0x22,0x05,0x22,0x05,0xbd,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x42,0xe9,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x84,0x90,0xf7,0xde,0xff,0xff,0xff,0xff,0xf7,0xbe,0x63,0xad,0x19,0xc5,0x19,0xc5,0x42,0xc9,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xd6,0x22,0x06,0x19,0xe5,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x5b,0x6c,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xdf,0x95,0x13,0x19,0xe5,0x19,0xe5,0x22,0x06,0xc6,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1c,0x2a,0x47,0x19,0xc5,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x32,0xc7,0x1a,0x05,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x2a,0x26,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0x43,0x08,0x2a,0x87,0x22,0x05,0x8c,0xd2,0xff,0xdf,0xff,0xff,0xff,0xff,0xef,0x7d,0x6c,0x2e,0x3b,0x08,0x2a,0x46,0x42,0xe9,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb5,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x7c,0x8f,0xef,0x5c,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x32,0xa7,0x22,0x26,0x32,0xc7,0x19,0xe5,0x32,0x87,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x47,0x74,0x0f,0x5b,0x8d,0x19,0xe5,0x22,0x05,0x22,0x26,0x22,0x06,0x74,0x2f,0x7c,0x50,0x7c,0x50,0x22,0x06,0x2a,0x66,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x38,0x3b,0x08,0x3b,0x08,0xb6,0x16,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0xad,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x53,0x8b,0x32,0xa7,0x5b,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x74,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x43,0x09,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x32,0xa7,0x32,0xa7,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x42,0xea,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0xbe,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x3a,0xa8,0x19,0xe5,0x53,0x4b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0xb1,0x19,0xe5,0x22,0x05,0x3a,0xc7,0x3a,0xc7,0x1a,0x05,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x7c,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x63,0xed,0x19,0xe5,0x3a,0xa8,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x2a,0x46,0x19,0xe5,0xad,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x53,0x6a,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x43,0x28,0x4b,0x69,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x84,0xb0,0x8c,0x91,0x8c,0xd2,0x8c,0x91,0x8c,0x91,0x8c,0x91,0x8c,0xb1,0x94,0xd2,0x94,0xd2,0x9d,0x73,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe7,0x3a,0xc7,0x2a,0x86,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x53,0x6b,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x4b,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x32,0xc7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0xc6,0x78,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0xcc,0x32,0xa7,0x74,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x32,0xa7,0x4b,0x4a,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x43,0x09,0x32,0xa7,0xbe,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x2f,0x22,0x26,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x3a,0xc9,0x22,0x05,0x8c,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x75,0x22,0x05,0x3a,0xc7,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x32,0x87,0x9d,0x73,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0x91,0x22,0x25,0x5b,0xab,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0x19,0xe5,0x2a,0x46,0xce,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x63,0xad,0x19,0xe5,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x84,0xf1,0xb5,0xf5,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x8c,0xd1,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x53,0x8a,0x7c,0x90,0xbe,0x37,0xef,0x5d,0xde,0xfb,0x43,0x28,0x43,0x28,0x4b,0x6a,0x7c,0x6f,0xa5,0x95,0xe7,0x3c,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xd6,0xda,0xa5,0x94,0xb5,0xf6,0xef,0x9d,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xef,0x9d,0xb6,0x16,0xad,0xb5,0xd6,0xda,0xf7,0xbe,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0xbe,0x38,0xf7,0x9e,0xbe,0x17,0xa5,0x94,0xce,0x99,0xff,0xff,0x5b,0xac,0x2a,0x87,0x74,0x4f,0xff,0xff,0xce,0x99,0xa5,0x94,0xb5,0xf6,0xf7,0x9e,0xc6,0x58,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x2a,0x87,0x43,0x29,0xf7,0x9e,0xdf,0x1b,0xad,0xd5,0xad,0xb5,0xe7,0x5c,0xe7,0x5c,0x42,0xe9,0x2a,0x87,0xbe,0x17,0xf7,0xbe,0xbe,0x17,0xa5,0x94,0xce,0x99,0xff,0xff,0x84,0xb0,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0xd6,0xda,0xef,0x5d,0xa5,0x75,0xa5,0x54,0xd6,0xba,0xff,0xdf,0x43,0x0a,0x3a,0xe7,0x8d,0x12,0xff,0xdf,0xc6,0x58,0x95,0x13,0xad,0xb6,0xf7,0xbe,0xad,0x95,0x3a,0xc7,0x32,0xc7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x32,0x87,0x3a,0xe8,0x95,0x33,0xff,0xdf,0xc6,0x38,0xa5,0x94,0xc6,0x78,0xff,0xdf,0x84,0x91,0x32,0xc7,0x5b,0xab,0xf7,0xbe,0xd6,0xda,0xad,0xd5,0xad,0xb5,0xef,0x7d,0xd6,0xda,0x22,0x25,0x3b,0x08,0xce,0x99,0xf7,0x9e,0xb5,0xd6,0xa5,0x94,0xce,0xb9,0xff,0xff,0x63,0xad,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x6c,0x4d,0x7c,0x8f,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x8c,0xd1,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xbe,0x37,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x6c,0x2d,0xbe,0x58,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xbe,0xa5,0x74,0xd6,0xda,0xce,0x99,0xad,0xb5,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xb6,0x17,0xce,0x99,0xde,0xfb,0x95,0x32,0xef,0x9d,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x26,0xc6,0x78,0xa5,0x94,0xce,0x99,0xd6,0xba,0xa5,0x74,0xef,0x7d,0x63,0xec,0x32,0xc7,0x7c,0x6f,0xef,0x7d,0x9d,0x53,0xd6,0xba,0xc6,0x78,0xbe,0x17,0xc6,0x58,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x32,0xc7,0x4b,0x6a,0xef,0x7d,0x8c,0xf1,0xd6,0xba,0xdf,0x1b,0x9d,0x53,0xe7,0x5c,0x43,0x29,0x32,0xc7,0xbe,0x37,0xad,0xd6,0xc6,0x78,0xd6,0xdb,0x9d,0x74,0xe7,0x3c,0x84,0xb1,0x32,0x87,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x87,0xce,0xba,0xa5,0x54,0xd6,0xba,0xd6,0xba,0x95,0x13,0xef,0x7d,0x5b,0xcb,0x3a,0xc7,0x84,0x90,0xdf,0x1b,0x9d,0x13,0xd6,0x9a,0xbe,0x17,0xc6,0x59,0xad,0xd6,0x32,0xc7,0x22,0x05,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x87,0x3a,0xe8,0x2a,0x66,0x8c,0xd2,0xd6,0xba,0xb6,0x17,0xde,0xfb,0xa5,0x94,0xdf,0x1b,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xef,0x7d,0x9d,0x33,0xce,0xba,0xde,0xfb,0x9d,0x74,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xa5,0x74,0xd6,0xba,0xde,0xfb,0xad,0xb5,0xef,0x7d,0x6b,0xed,0x3b,0x08,0x22,0x26,0x19,0xe5,0x32,0xa7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x2a,0x86,0x2a,0x66,0x2a,0x46,0x8c,0xd1,0x39,0xe7,0x29,0x65,0x29,0x23,0x31,0x63,0x31,0x63,0x29,0x43,0x21,0x04,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xe7,0x5c,0xc6,0x78,0xce,0xb9,0xf7,0xbe,0xde,0xfb,0x95,0x32,0xf7,0xbe,0xd6,0xda,0xd6,0xda,0xd6,0xda,0xf7,0xbe,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xbe,0x9d,0x33,0x9d,0x54,0xce,0x99,0xb5,0xf6,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xbe,0x37,0xa5,0x94,0xc6,0x58,0x8c,0xf1,0xef,0x9d,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x1a,0x05,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0xc6,0x79,0xa5,0x74,0xad,0x96,0x95,0x13,0x9d,0x34,0xef,0x7d,0x4b,0x2a,0x1a,0x05,0x6c,0x0e,0xef,0x9d,0x94,0xd2,0x8c,0xb1,0xc6,0x58,0xc6,0x38,0xc6,0x38,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x3a,0xa8,0xef,0x7d,0x8c,0xd2,0x84,0x91,0xd6,0xda,0x94,0xf3,0xe7,0x5c,0x32,0x67,0x22,0x05,0xb5,0xf7,0xbd,0xf7,0xa5,0x75,0xad,0x95,0xad,0x75,0xe7,0x3c,0x7c,0x50,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x22,0x05,0x2a,0x46,0x3a,0xe8,0x32,0x87,0x19,0xe5,0xce,0xba,0xa5,0x54,0xa5,0x75,0xa5,0x74,0x9d,0x13,0xf7,0x9e,0x53,0xab,0x22,0x05,0x7c,0x70,0xdf,0x1c,0x8c,0xb1,0x84,0x91,0xc6,0x38,0xd6,0xba,0xad,0xb5,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x87,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x8c,0xf2,0xde,0xfb,0xa5,0x74,0xb5,0xd6,0x9d,0x74,0xe7,0x3c,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xef,0x9d,0x9d,0x53,0x8c,0xf1,0xde,0xfb,0xad,0xb5,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xad,0xd5,0xa5,0x95,0xad,0xd6,0xb5,0xd6,0xf7,0x9e,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x4b,0x49,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x22,0x46,0x3a,0xc8,0x32,0x87,0x2a,0x46,0x8c,0xd1,0x39,0xc7,0x21,0x24,0x8c,0x03,0xde,0x44,0xde,0x44,0xbd,0x63,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xde,0x95,0x33,0xc6,0x78,0xbe,0x17,0xb6,0x16,0xde,0xfb,0x95,0x32,0xf7,0x9e,0xb6,0x16,0x7c,0x8f,0x9d,0x53,0xd6,0xba,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0xad,0xd5,0xa5,0x94,0xb5,0xf6,0xde,0xfb,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xce,0xba,0x9d,0x73,0xad,0xf6,0xad,0xd5,0xf7,0xbe,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0xa7,0xc6,0x58,0xce,0x9a,0x94,0xf2,0x9d,0x54,0xad,0x95,0xff,0xdf,0x5b,0xcc,0x3a,0xe8,0x7c,0x90,0xf7,0xde,0xa5,0x94,0xa5,0x74,0xad,0xd6,0xe7,0x3c,0xc6,0x58,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x53,0x8a,0xef,0x7d,0xb5,0xf6,0x9d,0x53,0xb5,0xf6,0xc6,0x79,0xe7,0x5d,0x4b,0x49,0x3a,0xe8,0xbe,0x37,0xe7,0x3c,0x9d,0x53,0xad,0xb5,0xb5,0xf6,0xf7,0xbe,0x84,0xd1,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3b,0x08,0x32,0x87,0x19,0xe5,0x19,0xe5,0xce,0xba,0xce,0x79,0x8c,0xf2,0xa5,0x95,0xbe,0x17,0xf7,0xbe,0x42,0xe9,0x19,0xe5,0x7c,0x70,0xef,0x7d,0x94,0xf2,0x9d,0x33,0xad,0xd5,0xef,0x7d,0xa5,0x75,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x86,0x3a,0xe8,0x2a,0x66,0x19,0xe5,0x22,0x26,0x9d,0x53,0xe7,0x3c,0x9d,0x73,0xad,0xb5,0xad,0xb5,0xf7,0x9e,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xf7,0x9e,0xb5,0xf6,0x9d,0x73,0xb5,0xf6,0xce,0xba,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xd6,0xda,0x9d,0x73,0xad,0xd5,0xbe,0x17,0xff,0xdf,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xce,0x99,0x6c,0x0d,0x19,0xe5,0x32,0xc7,0x63,0xcd,0xc6,0x58,0x43,0x09,0x2a,0x46,0x8c,0xd1,0x39,0xc7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xbe,0x84,0xb0,0xff,0xdf,0xdf,0x1b,0xad,0xd5,0xde,0xfb,0x95,0x32,0xff,0xff,0xff,0xff,0xa5,0xb5,0xd6,0xba,0xd6,0xda,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xd6,0xda,0xb5,0xf6,0x8c,0xf2,0xc6,0x78,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xe7,0x5d,0xce,0x99,0x94,0xf2,0x9d,0x74,0xf7,0x9e,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xc7,0x3a,0xe7,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x22,0x25,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0xbe,0x38,0xef,0x5d,0xc6,0x79,0x8c,0xb1,0x74,0x2f,0xf7,0xbe,0x63,0xed,0x2a,0x66,0x74,0x2f,0xff,0xdf,0xd6,0xda,0xad,0xb5,0x74,0x0e,0xce,0x99,0xc6,0x38,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x42,0xe9,0xf7,0x9e,0xdf,0x1b,0xbe,0x37,0x8c,0xb1,0xad,0xb5,0xe7,0x5c,0x3a,0xa8,0x2a,0x46,0xbd,0xf7,0xef,0x7d,0xce,0xb9,0x8c,0xd2,0x84,0x90,0xef,0x7d,0x7c,0x70,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x2a,0x46,0x22,0x26,0x19,0xe5,0x19,0xc5,0x19,0xe5,0xce,0xba,0xe7,0x5c,0xc6,0x38,0x95,0x12,0x9d,0x74,0xf7,0xbe,0x3a,0xc9,0x19,0xc5,0x7c,0x70,0xf7,0xbe,0xce,0x99,0xa5,0x95,0x7c,0x8f,0xdf,0x1c,0xa5,0x75,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x9d,0x73,0xf7,0x9e,0xce,0xb9,0x9d,0x53,0x95,0x12,0xef,0x7d,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xf7,0xbe,0xde,0xfb,0xbe,0x37,0x7c,0x8f,0xc6,0x58,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xef,0x5d,0xce,0x99,0x8c,0xf1,0x8d,0x12,0xf7,0xbe,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xf7,0xbe,0x9d,0x54,0x9d,0x54,0xf7,0xbe,0xef,0x7d,0x43,0x09,0x2a,0x46,0x8c,0xd1,0x39,0xc7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xce,0x99,0xff,0xdf,0xf7,0x9e,0xf7,0xbe,0xde,0xfb,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xf7,0xde,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0x95,0x12,0x95,0x33,0xce,0x99,0xef,0x7d,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xc6,0x78,0x84,0xb0,0xbe,0x37,0xde,0xfb,0xf7,0xbe,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x46,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xe5,0xbe,0x38,0xc6,0x58,0x8c,0x91,0xb5,0xd6,0xde,0xdb,0xff,0xdf,0x53,0x4b,0x19,0xe5,0x6b,0xee,0xf7,0xbe,0x74,0x0f,0x9d,0x13,0xce,0x79,0xef,0x7d,0xc6,0x38,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x43,0x09,0xef,0x7d,0x9d,0x74,0x94,0xf2,0xce,0x79,0xe7,0x3c,0xe7,0x5c,0x3a,0xc8,0x2a,0x66,0xbe,0x17,0xde,0xfb,0x7c,0x4f,0xb5,0xb6,0xd6,0xda,0xff,0xdf,0x7c,0x90,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0xd6,0xba,0xc6,0x78,0x94,0xf2,0xc6,0x58,0xde,0xdb,0xf7,0xbe,0x3a,0xc9,0x19,0xe5,0x7c,0x70,0xef,0x7d,0x8c,0xd1,0xad,0x95,0xce,0x99,0xf7,0x9e,0xa5,0x75,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x2a,0x86,0x3b,0x08,0x2a,0x66,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x9d,0x73,0xdf,0x1b,0x84,0xb0,0xb5,0xd6,0xd6,0xda,0xf7,0xde,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xf7,0x9e,0xa5,0x74,0xa5,0x54,0xce,0x99,0xe7,0x3c,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xce,0x99,0x84,0xb1,0xbe,0x17,0xde,0xfb,0xff,0xdf,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x43,0x09,0x2a,0x46,0x8c,0xd1,0x39,0xc7,0x21,0x24,0x5a,0xa2,0x8c,0x23,0x8c,0x23,0x7b,0xa3,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xad,0xf6,0x6c,0x2e,0x8d,0x11,0xde,0xfb,0xde,0xfb,0x95,0x32,0xdf,0x1b,0xb5,0xf6,0xe7,0x3c,0xc6,0x58,0xde,0xfb,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0xbe,0x37,0xbe,0x17,0xbe,0x17,0xde,0xfb,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xde,0xfb,0xbe,0x17,0xbe,0x17,0xc6,0x38,0xf7,0x9e,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x19,0xe5,0xbe,0x38,0xde,0xdb,0xb5,0xd6,0xbd,0xf7,0xc6,0x58,0xf7,0xde,0x4b,0x2a,0x2a,0x66,0x7c,0x90,0xf7,0xbe,0xb5,0xd6,0xb5,0xd6,0xbd,0xf7,0xe7,0x1c,0xc6,0x58,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x53,0x8a,0xef,0x9d,0xc6,0x58,0xbe,0x17,0xbe,0x17,0xce,0xba,0xe7,0x5d,0x4b,0x49,0x3a,0xe8,0xbe,0x37,0xe7,0x3c,0xb5,0xf7,0xbe,0x17,0xbe,0x17,0xf7,0xbe,0x84,0xd1,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0xd6,0xda,0xd6,0xda,0xbe,0x17,0xb5,0xf7,0xc6,0x18,0xf7,0xbe,0x3a,0xc9,0x19,0xe5,0x7c,0x70,0xf7,0x9e,0xbe,0x17,0xb5,0xf7,0xb5,0xd6,0xe7,0x5d,0xa5,0x75,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x9d,0x73,0xef,0x5d,0xbe,0x17,0xbe,0x17,0xbe,0x17,0xef,0x9d,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xf7,0x9e,0xc6,0x58,0xbe,0x17,0xbe,0x17,0xd6,0xda,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xde,0xfb,0xbe,0x17,0xbe,0x17,0xc6,0x58,0xf7,0xbe,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xa5,0x75,0xf7,0xbe,0x7c,0x50,0x94,0xf2,0xef,0x7d,0x43,0x09,0x2a,0x46,0x8c,0xd1,0x39,0xe7,0x31,0x86,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x65,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xd6,0xda,0x8c,0xf1,0x9d,0x53,0xbe,0x37,0xde,0xfb,0x95,0x32,0xdf,0x1b,0x8d,0x11,0xad,0xf5,0x9d,0x53,0xd6,0xda,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xbe,0x84,0xb0,0x9d,0x94,0x9d,0x53,0x95,0x53,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xad,0xd5,0x9d,0x53,0x9d,0x94,0x7c,0x8f,0xef,0x7d,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x25,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x46,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0xbe,0x38,0x95,0x13,0x8c,0xf2,0x9d,0x94,0x84,0xb1,0xef,0x5d,0x5b,0xac,0x3b,0x08,0x7c,0x90,0xe7,0x5d,0x63,0xad,0x95,0x13,0x95,0x32,0xad,0xd5,0xc6,0x38,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x3a,0xa8,0xef,0x5d,0x6c,0x0e,0x94,0xf2,0x94,0xf2,0x8c,0xb1,0xe7,0x3c,0x32,0x67,0x19,0xe5,0xb5,0xf7,0x95,0x33,0x8c,0xd2,0x94,0xf2,0x74,0x2f,0xdf,0x1c,0x7c,0x4f,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0xce,0xba,0x9d,0x13,0x8c,0xf2,0x94,0xf2,0x74,0x2f,0xef,0x7d,0x42,0xe9,0x1a,0x05,0x84,0xd1,0xde,0xfb,0x6c,0x0e,0x94,0xf2,0x84,0x91,0xbe,0x17,0xa5,0x75,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x9d,0x73,0xce,0x99,0x95,0x32,0x9d,0x94,0x7c,0xb0,0xde,0xfb,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xef,0x5d,0x84,0xd1,0x9d,0x94,0x9d,0x73,0x9d,0x74,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0x9d,0x53,0x9d,0x73,0x9d,0x94,0x8c,0xf1,0xef,0x7d,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xc5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xa5,0x54,0xce,0x79,0xa5,0x74,0x95,0x13,0xef,0x7d,0x43,0x09,0x19,0xe5,0x84,0x90,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xad,0xb5,0xd6,0xda,0xf7,0xbe,0xff,0xdf,0xde,0xfb,0x95,0x32,0xf7,0xbe,0xe7,0x3c,0xef,0x7d,0xef,0x5d,0xf7,0xbe,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xbe,0x9d,0x53,0xe7,0x3c,0xce,0xb9,0xc6,0x38,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xb5,0xf6,0xce,0xb9,0xe7,0x5c,0x9d,0x53,0xf7,0xbe,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xc7,0x1a,0x05,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x25,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x2a,0x87,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x25,0x3a,0xe7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0xbe,0x38,0xad,0xd6,0xd6,0xba,0xe7,0x3c,0x95,0x13,0xf7,0x9e,0x64,0x0d,0x3a,0xe8,0x74,0x4f,0xef,0x7d,0x95,0x13,0xe7,0x3c,0xb5,0xf7,0xce,0x59,0xc6,0x38,0x2a,0x66,0x22,0x46,0x19,0xe5,0x19,0xc5,0x22,0x25,0x32,0xa7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x53,0x6a,0xef,0x7d,0x95,0x12,0xdf,0x1b,0xdf,0x1b,0xa5,0x74,0xe7,0x5c,0x4b,0x29,0x3a,0xe7,0xbe,0x37,0xbe,0x17,0xc6,0x58,0xe7,0x3c,0xad,0xb5,0xef,0x7d,0x84,0xd1,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0x3a,0xe7,0xd6,0xda,0xa5,0x94,0xd6,0xfb,0xe7,0x3c,0x8d,0x12,0xf7,0xbe,0x5b,0xab,0x3a,0xe8,0x8d,0x12,0xdf,0x1c,0x94,0xf2,0xe7,0x3c,0xa5,0x95,0xd6,0xdb,0xad,0x75,0x2a,0x66,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x7c,0x8f,0x74,0x6e,0x3b,0x08,0x9d,0x73,0xd6,0xda,0xad,0xf6,0xe7,0x5c,0xad,0xb5,0xe7,0x5d,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xef,0x7d,0x95,0x32,0xe7,0x3c,0xde,0xfb,0xb5,0xf6,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xb6,0x17,0xd6,0xba,0xe7,0x3c,0xad,0x95,0xf7,0xbe,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x22,0x26,0x1a,0x05,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xe7,0x3c,0xad,0xb5,0xef,0x9d,0xdf,0x1b,0xef,0x7d,0x43,0x09,0x19,0xe5,0x74,0x4f,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xa5,0x94,0x8c,0xf1,0x95,0x12,0xb6,0x16,0xde,0xfb,0x95,0x32,0xf7,0x9e,0xb5,0xf6,0xa5,0x95,0x84,0xb0,0xdf,0x1b,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xce,0xb9,0xad,0xb5,0xb5,0xf6,0xf7,0x9e,0xd6,0xda,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xef,0x7d,0xad,0xd6,0xb5,0xf6,0xd6,0xfb,0xf7,0xbe,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x32,0xa7,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x46,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x22,0x05,0x3a,0xe7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0xc6,0x58,0xf7,0x9e,0xb5,0xd6,0xad,0x75,0xc6,0x79,0xff,0xff,0x64,0x0d,0x2a,0x66,0x6b,0xee,0xff,0xff,0xc6,0x78,0xad,0x95,0xad,0xb6,0xf7,0xbe,0xc6,0x58,0x3b,0x08,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x32,0xc7,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x43,0x09,0xf7,0x9e,0xde,0xfb,0xad,0xb5,0xad,0xb5,0xef,0x7d,0xe7,0x5c,0x3a,0xc8,0x2a,0x66,0xbe,0x17,0xf7,0xde,0xad,0xd5,0xad,0xb5,0xce,0x99,0xff,0xff,0x84,0x90,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0x2a,0x66,0xd6,0xda,0xef,0x7d,0xb5,0xd6,0xad,0xb5,0xd6,0xda,0xff,0xdf,0x4b,0x4a,0x2a,0x66,0x84,0x91,0xff,0xdf,0xbe,0x17,0xad,0x75,0xb5,0xd6,0xff,0xdf,0xad,0xb5,0x3a,0xe8,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0xa5,0xb4,0xa5,0x93,0x3b,0x08,0x9d,0x73,0xf7,0xde,0xb5,0xf6,0xb5,0xd6,0xce,0x99,0xff,0xff,0x84,0x91,0x3a,0xe7,0x53,0x6b,0xf7,0xbe,0xd6,0xda,0xad,0xd6,0xad,0xd5,0xef,0x9d,0xd6,0xda,0x2a,0x66,0x3a,0xe7,0xce,0x79,0xf7,0xbe,0xb5,0xf6,0xad,0xb5,0xd6,0xda,0xff,0xff,0x6b,0xed,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x26,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xef,0x7d,0xbe,0x38,0xa5,0x74,0xad,0x95,0xef,0x7d,0x43,0x09,0x19,0xe5,0x74,0x4f,0x39,0xe7,0x31,0xa6,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x31,0x86,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xef,0x7d,0xa5,0x94,0xc6,0x58,0xb5,0xf6,0xde,0xfb,0x95,0x32,0xf7,0xbe,0xb5,0xf6,0xad,0xb5,0xde,0xfb,0xff,0xdf,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0x3b,0x08,0x3b,0x08,0xbe,0x37,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x22,0x26,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x22,0x25,0x3a,0xe8,0x32,0x87,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x2a,0x87,0xb6,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x4b,0x4a,0x19,0xe5,0x5b,0x8c,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x32,0x87,0x19,0xe5,0x22,0x25,0x3a,0xe7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x32,0x68,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x32,0x87,0x22,0x26,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x6c,0x0e,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x26,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x43,0x09,0x22,0x26,0x74,0x2f,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x74,0x2a,0x86,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x43,0x28,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x2f,0x3a,0xe7,0x4b,0x4a,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x2a,0x66,0x3a,0xe7,0xbe,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x5b,0x6c,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x2a,0x46,0x19,0xe5,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0x9d,0x54,0x7c,0x50,0xce,0x99,0xf7,0xde,0xef,0x7d,0x43,0x09,0x19,0xc5,0x74,0x4f,0x39,0xe7,0x21,0x24,0x39,0xe2,0x5a,0xa3,0x5a,0xa3,0x52,0x62,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xb5,0xd6,0xce,0xb9,0xb6,0x17,0xe7,0x5c,0xde,0xfb,0x95,0x32,0xef,0x5d,0x8c,0xf1,0x9d,0x53,0x9d,0x73,0xe7,0x5c,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xd6,0xfb,0xff,0xff,0xff,0xdf,0xb5,0xf6,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xad,0xd5,0xff,0xdf,0xff,0xff,0xdf,0x1b,0x6c,0x2e,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x32,0xa7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x22,0x05,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xc5,0x19,0xe5,0x3a,0xe7,0x32,0xc7,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x2a,0x66,0x3a,0xe8,0x32,0xa8,0x9d,0x34,0xf7,0xbe,0xff,0xff,0xdf,0x1b,0x6c,0x0e,0x19,0xe5,0x2a,0x46,0x3b,0x08,0x6c,0x0e,0xde,0xfb,0xff,0xff,0xff,0xdf,0xa5,0x94,0x3a,0xe8,0x19,0xe5,0x22,0x25,0x3a,0xe7,0x32,0xa7,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x19,0xe5,0x19,0xc5,0x19,0xe5,0x19,0xe5,0x4b,0x0a,0xce,0xba,0xff,0xff,0xff,0xff,0xbe,0x58,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x43,0x29,0x95,0x32,0xf7,0xbe,0xff,0xff,0xe7,0x3c,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xad,0xd6,0xff,0xdf,0xff,0xff,0xd6,0xda,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x43,0x28,0x7c,0xb0,0xef,0x5d,0xff,0xff,0xf7,0xbe,0x9d,0x73,0x3a,0xc8,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x95,0x33,0xf7,0xbe,0xff,0xff,0xef,0x7d,0x74,0x4f,0x22,0x26,0x3a,0xe7,0x32,0x87,0x4b,0x2a,0xd6,0xda,0xff,0xff,0xff,0xdf,0xb5,0xf6,0x3a,0xa8,0x2a,0x66,0x3a,0xe7,0x2a,0x67,0x9d,0x54,0xff,0xdf,0xff,0xff,0xdf,0x1b,0x63,0xcd,0x22,0x26,0x3b,0x08,0x22,0x25,0x22,0x05,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x2a,0x87,0x19,0xe5,0x22,0x26,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x32,0x87,0x19,0xe5,0x22,0x05,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xf7,0xbe,0xd6,0xda,0xad,0xb5,0xa5,0x74,0xef,0x7d,0x43,0x09,0x19,0xc5,0x74,0x4f,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xbe,0x37,0x9d,0x33,0x9d,0x33,0xd6,0xda,0xde,0xfb,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0x53,0x8b,0x53,0x8b,0x63,0xec,0xad,0xd5,0x95,0x12,0x5b,0xab,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x8c,0xf2,0xbe,0x17,0x5b,0xcc,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x4b,0x2a,0x3a,0x88,0x4b,0x2a,0x4b,0x2a,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x42,0xc9,0x53,0x6a,0x42,0xa9,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0xa8,0x53,0x6a,0x42,0xe9,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x4b,0x2a,0x4b,0x4a,0x3a,0x88,0x42,0xe9,0x84,0x90,0xbe,0x17,0x63,0xed,0x42,0xe9,0x3a,0xa9,0x53,0x6a,0x4b,0x2a,0x3a,0xa8,0x53,0x2b,0xad,0xd6,0x84,0xb1,0x53,0x8b,0x3a,0xa8,0x3a,0xa9,0x53,0x6a,0x53,0x4a,0x3a,0xa9,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x3a,0x88,0x4b,0x09,0x5b,0xab,0xa5,0x74,0x94,0xd2,0x42,0xc9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x73,0xee,0xad,0x95,0x5b,0x4b,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x42,0xc9,0x7c,0x50,0xad,0x75,0x42,0xea,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x3a,0xa9,0x5b,0x4c,0xb5,0xd6,0x74,0x0f,0x42,0xa9,0x3a,0xa8,0x3a,0xa9,0x53,0x6a,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x53,0x8b,0x7c,0x6f,0xbe,0x37,0x6c,0x2e,0x4b,0x0a,0x3a,0x88,0x53,0x6a,0x4b,0x09,0x3a,0xa8,0x5b,0x8b,0xad,0xb5,0x95,0x12,0x53,0x8b,0x3a,0x88,0x4b,0x09,0x53,0x6a,0x3a,0xa8,0x4b,0x0a,0x84,0xb0,0xb5,0xf6,0x6b,0xed,0x42,0xc9,0x42,0xc9,0x43,0x29,0x22,0x25,0x22,0x05,0x3b,0x08,0x43,0x29,0x4b,0x4a,0x3a,0xa8,0x3a,0xc9,0x53,0x6a,0x43,0x28,0x3b,0x08,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x43,0x09,0x19,0xe5,0x74,0x4f,0x39,0xc7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xbe,0x95,0x32,0xde,0xfb,0xe7,0x3c,0x9d,0x73,0xde,0xfb,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xf6,0x8c,0x91,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0xb1,0x8c,0xb1,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x71,0x8c,0xd1,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0xb1,0x8c,0xb1,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x71,0x8c,0xd1,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0xd1,0x8c,0x91,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x91,0x8c,0xb1,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x71,0x8c,0xd1,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0xb1,0x8c,0xb1,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x7c,0x50,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x84,0x50,0x84,0x71,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x84,0x51,0x84,0x50,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x7c,0x50,0x84,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x84,0x50,0x84,0x50,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x7c,0x50,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0xb1,0x8c,0x91,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x91,0x8c,0xd1,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0xd1,0x8c,0x71,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x91,0x8c,0xb1,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x8c,0x51,0xbd,0xf7,0x32,0x07,0x31,0xe6,0x31,0xe7,0x63,0x2c,0x8c,0x51,0x8c,0x51,0x8c,0x51,0x9d,0x13,0x95,0x12,0x32,0xa7,0x19,0xe5,0x1a,0x05,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x53,0x8b,0x22,0x26,0x74,0x4f,0x39,0xc7,0x21,0x24,0x9c,0x83,0xf7,0x24,0xf7,0x24,0xd6,0x24,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0x95,0x12,0x8c,0xd1,0xce,0x79,0xbe,0x38,0xde,0xfb,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x63,0x4c,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x3a,0x07,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x69,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x4a,0x49,0x5b,0x0b,0x19,0xe5,0x19,0xe5,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x43,0x09,0x3a,0xe8,0x7c,0x90,0x39,0xc7,0x29,0x45,0x29,0x62,0x39,0xa2,0x39,0xa2,0x31,0x82,0x18,0xe3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xad,0xd5,0xc6,0x78,0xef,0x7d,0xff,0xff,0xde,0xfb,0x95,0x32,0xff,0xdf,0xbe,0x37,0xad,0xb5,0xc6,0x58,0xff,0xdf,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x31,0xe7,0x22,0x05,0x32,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xdf,0x1b,0xb5,0xd6,0xb5,0xd6,0xde,0xfb,0xef,0x7d,0x3a,0xa8,0x2a,0x46,0x8c,0xd1,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xdf,0x1b,0x84,0xd0,0x95,0x12,0xb5,0xf6,0xde,0xfb,0x95,0x32,0xde,0xfb,0xad,0xd5,0xe7,0x5c,0xbe,0x17,0xd6,0xda,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x21,0x24,0x41,0xe3,0x4a,0x23,0x4a,0x23,0x31,0x82,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x62,0x4a,0x23,0x4a,0x23,0x42,0x03,0x21,0x03,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc3,0x42,0x03,0x4a,0x23,0x4a,0x23,0x29,0x42,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x31,0x82,0x4a,0x23,0x4a,0x23,0x39,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x23,0x4a,0x23,0x4a,0x23,0x4a,0x23,0x21,0x02,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x39,0xa3,0x4a,0x23,0x4a,0x23,0x39,0xa3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x43,0x4a,0x23,0x4a,0x23,0x42,0x03,0x21,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x03,0x42,0x03,0x4a,0x23,0x4a,0x23,0x29,0x62,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x31,0x82,0x4a,0x23,0x4a,0x23,0x41,0xe3,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xc2,0x4a,0x23,0x4a,0x23,0x4a,0x23,0x21,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x39,0xa3,0x4a,0x23,0x4a,0x23,0x39,0xc3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x23,0x4a,0x23,0x4a,0x23,0x42,0x03,0x21,0x03,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x24,0x41,0xe3,0x4a,0x23,0x4a,0x23,0x29,0x62,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x29,0x42,0x4a,0x23,0x4a,0x23,0x42,0x03,0x21,0x03,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x21,0x03,0x42,0x03,0x4a,0x23,0x4a,0x23,0x29,0x42,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x39,0xa3,0x4a,0x23,0x4a,0x23,0x39,0xc3,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x02,0x4a,0x23,0x4a,0x23,0x4a,0x23,0x21,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0x39,0xc3,0x4a,0x23,0x4a,0x23,0x39,0xa3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x42,0x4a,0x23,0x4a,0x23,0x42,0x03,0x21,0x03,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x21,0x23,0x42,0x03,0x4a,0x23,0x4a,0x23,0x29,0x42,0x29,0x65,0x39,0xe7,0x39,0xe7,0x3a,0xc7,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0x9d,0x33,0xd6,0xba,0xd6,0xda,0x84,0xb1,0xef,0x5d,0x3a,0xa8,0x19,0xc5,0x7c,0x70,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xb5,0xd6,0x84,0xd1,0xc6,0x58,0xe7,0x5c,0xde,0xfb,0x95,0x32,0xe7,0x3c,0xa5,0x94,0xff,0xff,0xb5,0xd6,0xdf,0x1b,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x29,0x44,0xd6,0x24,0xff,0x24,0xff,0x24,0x9c,0x63,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x24,0xff,0x24,0xee,0xc4,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0xf6,0xe4,0xff,0x24,0xff,0x24,0x83,0xc3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x9c,0x83,0xff,0x24,0xff,0x24,0xd6,0x24,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x4a,0x23,0xf7,0x04,0xff,0x24,0xf7,0x04,0x42,0x02,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xb5,0x23,0xff,0x24,0xff,0x24,0xb5,0x23,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x62,0xe3,0xf7,0x24,0xff,0x24,0xee,0xc4,0x42,0x03,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x63,0xe6,0x84,0xff,0x24,0xff,0x24,0x8b,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x9c,0x63,0xff,0x24,0xff,0x24,0xde,0x44,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x02,0xff,0x24,0xff,0x24,0xff,0x24,0x6b,0x02,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0xad,0x03,0xff,0x24,0xff,0x24,0xc5,0xc3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x5a,0xa3,0xff,0x24,0xff,0x24,0xf6,0xe4,0x39,0xc3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x64,0xce,0x03,0xff,0x24,0xff,0x24,0x83,0xe3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x73,0x43,0xff,0x24,0xff,0x24,0xe6,0xa4,0x39,0xc3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0x83,0xee,0xc4,0xff,0x24,0xff,0x24,0x7b,0x83,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xad,0x03,0xff,0x24,0xff,0x24,0xcd,0xe3,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x42,0xff,0x24,0xff,0x24,0xff,0x24,0x52,0x62,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xbd,0x83,0xff,0x24,0xff,0x24,0xb5,0x23,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x6b,0x23,0xff,0x24,0xff,0x24,0xee,0xc4,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xde,0x64,0xff,0x24,0xff,0x24,0x73,0x63,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0x9d,0x33,0x8c,0xb1,0xce,0x79,0x9d,0x34,0xef,0x7d,0x3a,0xa8,0x19,0xe5,0x74,0x4f,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xa5,0xb5,0xad,0xd5,0xad,0xf6,0xd6,0xfa,0xde,0xfb,0x95,0x32,0xef,0x7d,0xad,0xb5,0xef,0x7d,0xf7,0xbe,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x29,0x44,0xde,0x44,0xff,0x64,0xff,0x64,0x9c,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x44,0xff,0x64,0xf6,0xe4,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0xff,0x24,0xff,0x64,0xff,0x44,0x83,0xe3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xa4,0xa3,0xff,0x64,0xff,0x64,0xde,0x64,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x4a,0x23,0xff,0x44,0xff,0x44,0xff,0x44,0x4a,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xb5,0x43,0xff,0x64,0xff,0x44,0xb5,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x62,0xe3,0xff,0x44,0xff,0x44,0xf7,0x04,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x63,0xe6,0xa4,0xff,0x64,0xff,0x64,0x8c,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x9c,0x83,0xff,0x64,0xff,0x64,0xe6,0x84,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x02,0xff,0x64,0xff,0x64,0xff,0x64,0x6b,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x64,0xff,0x44,0xcd,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x5a,0xa3,0xff,0x64,0xff,0x44,0xf7,0x24,0x41,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x64,0xd6,0x24,0xff,0x44,0xff,0x44,0x8b,0xe3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x73,0x63,0xff,0x44,0xff,0x64,0xee,0xc4,0x39,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0x83,0xee,0xe4,0xff,0x64,0xff,0x64,0x7b,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xb5,0x23,0xff,0x64,0xff,0x44,0xd6,0x04,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x42,0xff,0x64,0xff,0x64,0xff,0x64,0x52,0x82,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xc5,0xa3,0xff,0x64,0xff,0x44,0xbd,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x6b,0x23,0xff,0x64,0xff,0x64,0xf6,0xe4,0x39,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xe6,0x84,0xff,0x64,0xff,0x64,0x7b,0x83,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xd6,0xba,0xbe,0x17,0xd6,0xda,0xd6,0xdb,0xef,0x7d,0x3a,0xa8,0x19,0xe5,0x74,0x4f,0x39,0xc7,0x29,0x65,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x24,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xe7,0x3c,0xbe,0x37,0x84,0xb0,0xc6,0x58,0xde,0xfb,0x95,0x32,0xff,0xdf,0xbe,0x37,0x95,0x32,0x8c,0xf2,0xdf,0x1c,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x29,0x44,0xde,0x44,0xff,0x64,0xff,0x64,0x9c,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x64,0xff,0x64,0xf6,0xe4,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0xff,0x24,0xff,0x64,0xff,0x64,0x83,0xe3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xa4,0xa3,0xff,0x44,0xff,0x64,0xde,0x64,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x4a,0x23,0xff,0x44,0xff,0x44,0xff,0x44,0x4a,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xb5,0x43,0xff,0x64,0xff,0x64,0xb5,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x62,0xe3,0xff,0x44,0xff,0x64,0xf7,0x04,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x63,0xe6,0xa4,0xff,0x44,0xff,0x64,0x8c,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x9c,0x83,0xff,0x64,0xff,0x44,0xe6,0x84,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x02,0xff,0x44,0xff,0x64,0xff,0x64,0x6b,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x64,0xff,0x64,0xcd,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x5a,0xa3,0xff,0x64,0xff,0x64,0xf7,0x24,0x41,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x64,0xd6,0x24,0xff,0x64,0xff,0x64,0x8b,0xe3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x73,0x63,0xff,0x44,0xff,0x64,0xee,0xc4,0x39,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0x83,0xee,0xe4,0xff,0x64,0xff,0x64,0x7b,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xb5,0x23,0xff,0x64,0xff,0x64,0xd6,0x04,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x42,0xff,0x64,0xff,0x64,0xff,0x64,0x52,0x82,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xc5,0xa3,0xff,0x64,0xff,0x44,0xbd,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x6b,0x23,0xff,0x64,0xff,0x64,0xf6,0xe4,0x39,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xe6,0x84,0xff,0x64,0xff,0x64,0x7b,0x83,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xce,0x79,0x7c,0x50,0xa5,0x75,0x7c,0x90,0xef,0x7d,0x3a,0xa8,0x19,0xe5,0x74,0x4f,0x39,0xc7,0x21,0x24,0x8c,0x03,0xde,0x44,0xde,0x44,0xbd,0x63,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x95,0x32,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0x8c,0xd1,0x9d,0x33,0xc6,0x38,0xdf,0x1b,0xde,0xfb,0x95,0x32,0xf7,0xbe,0x95,0x33,0x95,0x12,0xa5,0xb5,0xef,0x7d,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x21,0x04,0x52,0x82,0x63,0x03,0x63,0x03,0x42,0x02,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x29,0x62,0x63,0x03,0x63,0x03,0x5a,0xc3,0x18,0xc3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0x63,0x03,0x63,0x03,0x63,0x03,0x39,0xc2,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x42,0x02,0x63,0x03,0x63,0x03,0x5a,0xa3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x22,0x62,0xe3,0x63,0x03,0x63,0x03,0x29,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0x4a,0x42,0x63,0x03,0x63,0x03,0x41,0xe2,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x31,0x62,0x62,0xe3,0x63,0x03,0x62,0xe3,0x29,0x43,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x03,0x5a,0xc3,0x63,0x03,0x63,0x03,0x39,0xc2,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x41,0xe2,0x63,0x03,0x63,0x03,0x5a,0xa3,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xc2,0x63,0x03,0x63,0x03,0x63,0x03,0x31,0x82,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x4a,0x22,0x63,0x03,0x63,0x03,0x52,0x62,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x29,0x42,0x63,0x03,0x63,0x03,0x62,0xe3,0x21,0x22,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x04,0x52,0x42,0x63,0x03,0x63,0x03,0x39,0xc2,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x39,0xa2,0x63,0x03,0x63,0x03,0x62,0xc3,0x29,0x43,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x21,0x03,0x5a,0xc3,0x63,0x03,0x63,0x03,0x39,0xc2,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x42,0x02,0x63,0x03,0x63,0x03,0x5a,0x83,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe2,0x63,0x03,0x63,0x03,0x63,0x03,0x18,0xe2,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x52,0x62,0x63,0x03,0x63,0x03,0x52,0x62,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x31,0x82,0x63,0x03,0x63,0x03,0x62,0xe3,0x21,0x23,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x21,0x23,0x5a,0xa3,0x63,0x03,0x63,0x03,0x39,0xa2,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0xb5,0xf6,0x84,0xd1,0x7c,0xb0,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xff,0xff,0xbe,0x17,0xa5,0x54,0x9d,0x33,0xef,0x7d,0x3a,0xa8,0x19,0xe5,0x74,0x4f,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x95,0x52,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xb5,0xd6,0xad,0xd5,0xad,0xd5,0xce,0xb9,0xde,0xfb,0x95,0x32,0xf7,0xbe,0xce,0x99,0xe7,0x5c,0xef,0x7d,0xff,0xdf,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xc7,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x74,0x4f,0x7c,0xb0,0x84,0xd0,0x63,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xff,0xff,0xf7,0xde,0xce,0x79,0xef,0x5d,0xef,0x7d,0x4b,0x2a,0x19,0xe5,0x74,0x4f,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x95,0x52,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xbe,0x74,0x6f,0xad,0xd5,0xa5,0x94,0xa5,0x95,0xde,0xfb,0x95,0x32,0xef,0x7d,0xa5,0x94,0x74,0x4e,0x8c,0xf1,0xd6,0xba,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x3a,0x27,0x3b,0x08,0xd6,0xba,0x8c,0xf2,0x74,0x6f,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xbe,0x37,0xe7,0x3c,0xe7,0x3c,0xa5,0x95,0xef,0x7d,0x53,0x6a,0x32,0x87,0x7c,0x50,0x39,0xc7,0x21,0x24,0x73,0x43,0xac,0xe3,0xac,0xe3,0x94,0x43,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x8d,0x11,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xde,0x8c,0xf2,0xd6,0xfa,0xbe,0x37,0xc6,0x58,0xde,0xfb,0x95,0x32,0xf7,0xbe,0xbe,0x57,0x84,0xd1,0x9d,0x53,0xde,0xfb,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x3a,0x27,0x3b,0x08,0xa5,0x74,0x95,0x12,0xbe,0x17,0x74,0x4e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xa5,0x54,0xb5,0xf7,0xb5,0xf7,0x8c,0xf1,0xef,0x7d,0x3a,0xc9,0x32,0xa7,0x8c,0xd1,0x39,0xc7,0x31,0x86,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x8c,0xb1,0x43,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xd6,0xda,0xa5,0x74,0xb5,0xd6,0xf7,0xbe,0xde,0xfb,0x95,0x32,0xf7,0x9e,0xbe,0x37,0xd6,0xda,0xc6,0x79,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x29,0x65,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x86,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0x86,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x29,0x45,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x65,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x45,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x86,0x39,0xe7,0x39,0xe7,0x31,0x86,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x65,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x65,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x86,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x45,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x31,0x86,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x65,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x86,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x29,0x45,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x45,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x31,0x86,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x4b,0x49,0x3b,0x08,0x4b,0x6a,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xef,0x7d,0xf7,0xbe,0xf7,0x9e,0xef,0x9e,0xef,0x7d,0x3a,0xa8,0x19,0xe5,0x53,0x4a,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x5b,0x4b,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xde,0x95,0x12,0xad,0xb5,0x9d,0x73,0xb6,0x16,0xde,0xfb,0x95,0x32,0xef,0x5d,0x8c,0xf1,0x9d,0x73,0x84,0xf1,0xe7,0x3c,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x21,0x24,0xa4,0xc3,0xbd,0x63,0xbd,0x63,0x73,0x63,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x6b,0x03,0xbd,0x63,0xbd,0x63,0xb5,0x23,0x31,0x83,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0xb5,0x43,0xbd,0x63,0xbd,0x63,0x62,0xc2,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x7b,0x83,0xbd,0x63,0xbd,0x63,0xa4,0xa3,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x39,0xa2,0xbd,0x63,0xbd,0x63,0xbd,0x43,0x39,0xa2,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0x8b,0xe3,0xbd,0x63,0xbd,0x63,0x8c,0x03,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x4a,0x43,0xbd,0x63,0xbd,0x63,0xb5,0x23,0x39,0xc3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x43,0xac,0xe3,0xbd,0x63,0xbd,0x63,0x6b,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x73,0x63,0xbd,0x63,0xbd,0x63,0xa4,0xc3,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe2,0xbd,0x63,0xbd,0x63,0xbd,0x63,0x52,0x62,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x8b,0xe3,0xbd,0x63,0xbd,0x63,0x94,0x63,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x4a,0x22,0xbd,0x63,0xbd,0x63,0xb5,0x43,0x31,0x82,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x44,0xa4,0xa3,0xbd,0x63,0xbd,0x63,0x63,0x03,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x52,0x82,0xbd,0x63,0xbd,0x63,0xad,0x03,0x31,0x83,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x29,0x63,0xb5,0x23,0xbd,0x63,0xbd,0x63,0x5a,0xa2,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x8b,0xe3,0xbd,0x63,0xbd,0x63,0x9c,0x63,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x41,0xe2,0xbd,0x63,0xbd,0x63,0xbd,0x63,0x4a,0x02,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x94,0x23,0xbd,0x63,0xbd,0x63,0x83,0xe3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x52,0x62,0xbd,0x63,0xbd,0x63,0xb5,0x03,0x29,0x63,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x29,0x63,0xac,0xc3,0xbd,0x63,0xbd,0x63,0x5a,0xa2,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xad,0xd5,0x95,0x32,0x95,0x53,0xad,0xb5,0xef,0x7d,0x4b,0x4a,0x19,0xe5,0x21,0xe5,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x32,0x67,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xf7,0xbe,0x9d,0x53,0xff,0xff,0xef,0x9d,0xa5,0xb5,0xde,0xfb,0x95,0x32,0xd6,0xfb,0xc6,0x58,0xbe,0x37,0xd6,0xba,0xce,0x99,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x29,0x44,0xde,0x44,0xff,0x64,0xff,0x44,0x9c,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x44,0xff,0x64,0xf6,0xe4,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0xff,0x24,0xff,0x44,0xff,0x44,0x83,0xe3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xa4,0xa3,0xff,0x64,0xff,0x64,0xde,0x64,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x4a,0x23,0xff,0x44,0xff,0x64,0xff,0x44,0x4a,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xb5,0x43,0xff,0x64,0xff,0x64,0xb5,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x62,0xe3,0xff,0x44,0xff,0x44,0xf7,0x04,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x63,0xe6,0xa4,0xff,0x44,0xff,0x64,0x8c,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x9c,0x83,0xff,0x44,0xff,0x64,0xe6,0x84,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x02,0xff,0x64,0xff,0x64,0xff,0x64,0x6b,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x64,0xff,0x64,0xcd,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x5a,0xa3,0xff,0x64,0xff,0x64,0xf7,0x24,0x41,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x64,0xd6,0x24,0xff,0x64,0xff,0x64,0x8b,0xe3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x73,0x63,0xff,0x44,0xff,0x64,0xee,0xc4,0x39,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0x83,0xee,0xe4,0xff,0x44,0xff,0x64,0x7b,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xb5,0x23,0xff,0x64,0xff,0x64,0xd6,0x04,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x42,0xff,0x64,0xff,0x64,0xff,0x64,0x52,0x82,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xc5,0xa3,0xff,0x64,0xff,0x64,0xbd,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x6b,0x23,0xff,0x64,0xff,0x64,0xf6,0xe4,0x39,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xe6,0x84,0xff,0x64,0xff,0x64,0x7b,0x83,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xa5,0x74,0xff,0xdf,0xff,0xdf,0x95,0x53,0xef,0x7d,0x53,0xab,0x32,0xc7,0x21,0xe5,0x39,0xe7,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x39,0xc7,0x32,0x67,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xbe,0x37,0x8c,0xf1,0x8d,0x12,0xdf,0x1b,0xde,0xfb,0x95,0x32,0xf7,0x9e,0x8c,0xf1,0xad,0xd5,0xce,0x99,0xef,0x9d,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x29,0x44,0xde,0x44,0xff,0x44,0xff,0x64,0x9c,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x83,0xc3,0xff,0x64,0xff,0x44,0xf6,0xe4,0x31,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0xff,0x24,0xff,0x44,0xff,0x64,0x83,0xe3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xa4,0xa3,0xff,0x64,0xff,0x64,0xde,0x64,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x4a,0x23,0xff,0x44,0xff,0x64,0xff,0x44,0x4a,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0xb5,0x43,0xff,0x44,0xff,0x64,0xb5,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x62,0xe3,0xff,0x44,0xff,0x64,0xf7,0x04,0x4a,0x23,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x63,0xe6,0xa4,0xff,0x64,0xff,0x64,0x8c,0x03,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x9c,0x83,0xff,0x64,0xff,0x64,0xe6,0x84,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x02,0xff,0x64,0xff,0x64,0xff,0x64,0x6b,0x43,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x23,0xff,0x44,0xff,0x64,0xcd,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x5a,0xa3,0xff,0x64,0xff,0x64,0xf7,0x24,0x41,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x64,0xd6,0x24,0xff,0x64,0xff,0x64,0x8b,0xe3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x73,0x63,0xff,0x44,0xff,0x44,0xee,0xc4,0x39,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0x83,0xee,0xe4,0xff,0x44,0xff,0x64,0x7b,0xa3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0xb5,0x23,0xff,0x64,0xff,0x64,0xd6,0x04,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x4a,0x42,0xff,0x64,0xff,0x64,0xff,0x64,0x52,0x82,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xc5,0xa3,0xff,0x44,0xff,0x64,0xbd,0x43,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x6b,0x23,0xff,0x64,0xff,0x44,0xf6,0xe4,0x39,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0xa3,0xe6,0x84,0xff,0x64,0xff,0x64,0x7b,0x83,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xc6,0x78,0x9d,0x53,0x9d,0x33,0xbe,0x17,0xef,0x7d,0x53,0xab,0x3b,0x08,0x32,0x87,0x39,0xc7,0x21,0x24,0x4a,0x22,0x6b,0x23,0x6b,0x23,0x5a,0xa2,0x18,0xe3,0x39,0xc7,0x3a,0x67,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xce,0xb9,0x95,0x32,0xef,0x7d,0x9d,0x53,0xad,0xd5,0xde,0xfb,0xff,0xdf,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x21,0x24,0xb5,0x43,0xd6,0x24,0xd6,0x24,0x83,0xe3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x62,0xc3,0xd6,0x24,0xd6,0x24,0xcd,0xc3,0x31,0x83,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x18,0xc2,0xcd,0xe3,0xd6,0x24,0xd6,0x24,0x73,0x63,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x83,0xe3,0xd6,0x24,0xd6,0x24,0xbd,0x63,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x39,0xc2,0xd6,0x04,0xd6,0x24,0xd6,0x04,0x41,0xe2,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x04,0x9c,0x63,0xd6,0x24,0xd6,0x24,0x9c,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x52,0x83,0xd6,0x04,0xd6,0x24,0xcd,0xe3,0x41,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x43,0xc5,0x83,0xd6,0x24,0xd6,0x24,0x7b,0x83,0x29,0x65,0x39,0xe7,0x39,0xe7,0x29,0x65,0x7b,0xa3,0xd6,0x24,0xd6,0x24,0xbd,0x63,0x18,0xc3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x20,0xe2,0xd6,0x24,0xd6,0x24,0xd6,0x24,0x62,0xc2,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x21,0x24,0x94,0x43,0xd6,0x24,0xd6,0x24,0xac,0xe3,0x21,0x04,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x4a,0x42,0xd6,0x24,0xd6,0x24,0xce,0x04,0x39,0xa3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x24,0xac,0xe3,0xd6,0x24,0xd6,0x24,0x73,0x43,0x29,0x45,0x39,0xe7,0x39,0xe7,0x29,0x65,0x62,0xc3,0xd6,0x24,0xd6,0x24,0xc5,0xc3,0x39,0xc3,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x29,0x63,0xc5,0xa3,0xd6,0x24,0xd6,0x24,0x6b,0x03,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x45,0x94,0x43,0xd6,0x24,0xd6,0x24,0xb5,0x23,0x18,0xe3,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x31,0x82,0xd6,0x24,0xd6,0x24,0xd6,0x24,0x4a,0x22,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x18,0xe3,0xa4,0xa3,0xd6,0x24,0xd6,0x24,0x9c,0x83,0x21,0x24,0x39,0xe7,0x39,0xe7,0x31,0x86,0x5a,0xa3,0xd6,0x24,0xd6,0x24,0xcd,0xc3,0x31,0x83,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x31,0x63,0xbd,0x63,0xd6,0x24,0xd6,0x24,0x6b,0x03,0x29,0x45,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xef,0x5d,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xef,0x7d,0x53,0xab,0x3b,0x08,0x32,0xa7,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x84,0x70,0x43,0x28,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x0d,0xff,0xdf,0xf7,0xbe,0xdf,0x1b,0xa5,0xb5,0x74,0x6e,0x53,0x6a,0x95,0x12,0xff,0xff,0xce,0x99,0x9d,0x53,0x7c,0x6f,0xde,0xfb,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x29,0x45,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x04,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x04,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x65,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x21,0x04,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x45,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x04,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x04,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x24,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x31,0x86,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x31,0xa6,0x39,0xe7,0x39,0xe7,0x29,0x45,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x29,0x45,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x21,0x04,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x04,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x29,0x45,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x31,0x86,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x04,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x21,0x04,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x31,0x86,0x39,0xe7,0x39,0xe7,0x29,0x65,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x24,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x21,0x24,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x29,0x65,0x39,0xe7,0x39,0xe7,0x31,0xa6,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x21,0x04,0x39,0xc7,0x39,0xe7,0x39,0xc7,0x21,0x24,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x18,0xe3,0x31,0x86,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xe7,0x5d,0xe7,0x5d,0x8c,0xf1,0x74,0x6f,0xe7,0x3c,0xef,0x7d,0x53,0xab,0x3b,0x08,0x32,0xa7,0x39,0xe7,0x21,0x24,0xa4,0xa3,0xff,0x44,0xff,0x44,0xde,0x44,0x18,0xc3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xa5,0x94,0x64,0x0d,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0xef,0x7d,0x9d,0x74,0xad,0xf6,0xdf,0x1b,0xff,0xdf,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x3a,0x27,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xad,0xb5,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x53,0x8a,0x9d,0x74,0x53,0x8a,0x3b,0x08,0x32,0xa7,0x39,0xc7,0x21,0x24,0x9c,0x83,0xf6,0xe4,0xf6,0xe4,0xd6,0x03,0x18,0xc3,0x39,0xc7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x6b,0xcd,0xc6,0x38,0x7c,0x70,0x42,0xe8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x43,0x09,0x9d,0x33,0x9d,0x33,0x4b,0x29,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x6b,0xee,0xb5,0xb6,0x5b,0x8b,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x53,0x4a,0xad,0x95,0x94,0xf2,0x42,0xe8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x42,0xe8,0x8c,0xd1,0xc6,0x58,0x5b,0x8c,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x5b,0x6b,0xb5,0xb6,0x74,0x2f,0x42,0xe8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x63,0x8c,0xad,0x75,0x63,0xac,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x63,0xac,0xb5,0xb6,0x6b,0xee,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x42,0xe8,0x8c,0xb1,0x8c,0xd2,0x42,0xe8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x4b,0x09,0x94,0xf2,0x94,0xf2,0x43,0x09,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x4b,0x09,0xa5,0x34,0x84,0x90,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x84,0x70,0xad,0x95,0x53,0x6b,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x5b,0x8b,0xb5,0xd6,0x84,0x70,0x3a,0xc8,0x3a,0xc8,0x3a,0xc8,0x3a,0xe8,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xa7,0x39,0xe7,0x29,0x45,0x29,0x62,0x39,0xc2,0x39,0xc2,0x31,0x82,0x18,0xe3,0x39,0xe7,0x8c,0x91,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0xff,0xff,0xff,0xff,0xf7,0xbe,0xce,0x99,0x95,0x53,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x9d,0x53,0xf7,0xbe,0xff,0xff,0xff,0xdf,0xb6,0x16,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x63,0xed,0xce,0xba,0xff,0xff,0xff,0xff,0xd6,0xfa,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x43,0x29,0x9d,0x74,0xf7,0x9e,0xff,0xff,0xef,0x9d,0x8d,0x11,0x43,0x29,0x3b,0x08,0x3b,0x08,0x74,0x6f,0xdf,0x1b,0xff,0xff,0xff,0xff,0xce,0x99,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0xc6,0x78,0xff,0xff,0xff,0xff,0xef,0x9d,0x95,0x32,0x43,0x29,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xe7,0x5c,0xff,0xff,0xf7,0xde,0xad,0xd5,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x8c,0xd1,0xef,0x7d,0xff,0xff,0xef,0x7d,0x95,0x32,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x95,0x12,0xef,0x7d,0xff,0xff,0xf7,0xbe,0xa5,0x94,0x43,0x49,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xc6,0x78,0xff,0xdf,0xff,0xdf,0xc6,0x79,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x63,0xcc,0xce,0xb9,0xff,0xdf,0xff,0xff,0xce,0x99,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0xd6,0xda,0xff,0xff,0xff,0xdf,0xb6,0x17,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x53,0x6a,0xb6,0x16,0xff,0xdf,0xff,0xff,0xe7,0x5c,0x7c,0xb0,0x43,0x28,0x3b,0x08,0x43,0x08,0x8c,0xf1,0xe7,0x5c,0xff,0xff,0xff,0xdf,0xb6,0x16,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x39,0xc7,0x39,0xc7,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x39,0xe7,0x84,0x90,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xb5,0xf6,0x8c,0xf1,0x53,0xab,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xd5,0x3b,0x08,0x4b,0x49,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x53,0x8a,0x3b,0x08,0x9d,0x53,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x32,0x3b,0x08,0x4b,0x69,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfa,0x3b,0x08,0x3b,0x08,0xc6,0x78,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x64,0x0d,0x3b,0x08,0x74,0x6f,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb6,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x32,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xb5,0x3b,0x08,0x4b,0x4a,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1c,0x53,0x6a,0x3b,0x08,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x5d,0x43,0x29,0x3b,0x08,0x5b,0xab,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x3b,0x08,0x3b,0x08,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x6c,0x0d,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0xe8,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x42,0xc8,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xf7,0xdf,0xa5,0x94,0x84,0xd1,0x95,0x33,0xef,0x7d,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xd6,0xba,0x95,0x53,0x95,0x32,0xd6,0xba,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xff,0xdf,0xb5,0xf6,0x95,0x53,0xad,0xd5,0xf7,0xde,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xff,0xce,0x99,0x95,0x53,0x95,0x53,0xdf,0x1b,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xe7,0x1c,0x9d,0x53,0x95,0x12,0xa5,0xb5,0xff,0xff,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xff,0xc6,0x58,0x95,0x53,0xa5,0x94,0xef,0x7d,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xdf,0xb6,0x16,0x9d,0x74,0xb5,0xf6,0xff,0xdf,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xdf,0xad,0xf6,0x95,0x53,0xa5,0xb5,0xf7,0xbe,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xe7,0x3c,0x9d,0x74,0xa5,0x94,0xde,0xfb,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xdf,0x1c,0x9d,0x73,0x9d,0x73,0xde,0xfb,0xf7,0xbe,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xce,0xba,0x9d,0x73,0xa5,0x94,0xef,0x5d,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xef,0x7d,0x95,0x53,0x95,0x53,0xbe,0x58,0xff,0xff,0x74,0x4f,0x3b,0x08,0x74,0x4e,0xf7,0xbe,0xd6,0xda,0xe7,0x3c,0xa5,0x94,0xdf,0x1b,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3a,0x67,0x3a,0x67,0x4a,0xc9,0x6b,0x8d,0x84,0x50,0x8c,0x71,0x53,0x0a,0x3a,0x67,0x3a,0xc8,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xe7,0x5c,0xad,0xd5,0xdf,0x1b,0xde,0xfb,0xce,0x99,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xe7,0x5c,0x95,0x53,0xe7,0x1c,0xef,0x5d,0x95,0x12,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xce,0x99,0xce,0x99,0xe7,0x1c,0xb5,0xf6,0xce,0xb9,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xbe,0xb5,0xf6,0xe7,0x3c,0xef,0x7d,0xa5,0x74,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xa5,0x94,0xe7,0x3c,0xde,0xfb,0xbe,0x17,0xef,0x5d,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xef,0x7d,0x9d,0x53,0xe7,0x3c,0xd6,0xba,0xbe,0x17,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xde,0xfb,0xad,0xb5,0xde,0xfb,0xbe,0x17,0xd6,0xba,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xdf,0x1b,0xad,0xd5,0xdf,0x1b,0xce,0xb9,0xce,0x99,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xa5,0x74,0xde,0xfb,0xe7,0x1c,0x95,0x32,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xa5,0x74,0xdf,0x1b,0xdf,0x1b,0x9d,0x53,0xef,0x9d,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xef,0x9d,0x9d,0x74,0xde,0xfb,0xde,0xfb,0xa5,0x94,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xa5,0x94,0xdf,0x1b,0xe7,0x3c,0xad,0xb5,0xef,0x7d,0x74,0x4f,0x3b,0x08,0x74,0x4e,0xe7,0x5d,0xbe,0x37,0xbe,0x38,0xc6,0x79,0xa5,0xb5,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0x95,0x32,0xb5,0xf6,0xa5,0x95,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x9d,0x53,0xb6,0x16,0xb6,0x16,0x7c,0x90,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x63,0xed,0x9d,0x74,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xef,0x9d,0x7c,0xb0,0x8d,0x11,0xc6,0x78,0xd6,0xda,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xad,0xb5,0x95,0x33,0xd6,0xba,0x9d,0x74,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xd6,0xda,0x9d,0x53,0xad,0xb5,0xad,0xd5,0xdf,0x1b,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xbe,0x9d,0x53,0x9d,0x33,0xce,0x99,0xad,0xd6,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xbe,0x37,0x95,0x32,0xad,0xd5,0xb5,0xd6,0xf7,0x9e,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xf7,0x9e,0x95,0x33,0x9d,0x33,0xc6,0x58,0xc6,0x79,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xdf,0x1b,0x9d,0x53,0x95,0x33,0xb6,0x17,0xde,0xfb,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x5c,0x95,0x32,0x95,0x33,0xbe,0x37,0xd6,0xda,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xa5,0x74,0xa5,0x74,0xd6,0xda,0x95,0x32,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0x9d,0x74,0xad,0x95,0xce,0x99,0x9d,0x74,0xef,0x9d,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xef,0x9d,0x95,0x32,0x8c,0xf1,0xdf,0x1b,0xad,0xd6,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xbe,0x37,0xa5,0x94,0xb5,0xf6,0xad,0xb5,0xf7,0x9e,0x74,0x4f,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xad,0xb5,0x9d,0x53,0xf7,0x9e,0xd6,0xda,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x74,0x6f,0x8d,0x12,0x74,0x6f,0xd6,0xda,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xc6,0x78,0x84,0xb0,0x8d,0x12,0xce,0xb9,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x43,0x28,0x9d,0x73,0xce,0xb9,0xd6,0xda,0xad,0xb5,0x5b,0xcb,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xf7,0xbe,0xb5,0xf6,0xb6,0x16,0xbe,0x37,0xe7,0x5c,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xce,0xb9,0xb6,0x16,0xbe,0x58,0xd6,0xba,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xef,0x9d,0xb6,0x17,0xbe,0x57,0xc6,0x78,0xf7,0xbe,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xdf,0xc6,0x78,0xb6,0x16,0xbe,0x37,0xde,0xfb,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xdf,0x1b,0xb5,0xf6,0xb6,0x16,0xbe,0x37,0xf7,0xbe,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xdf,0xbe,0x58,0xbe,0x57,0xc6,0x78,0xef,0x7d,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xf7,0xbe,0xc6,0x58,0xce,0x79,0xce,0x99,0xf7,0x9e,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xf7,0xbe,0xbe,0x58,0xbe,0x58,0xc6,0x78,0xef,0x9e,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xd6,0xda,0xc6,0x58,0xd6,0xda,0xd6,0xda,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xce,0xb9,0xb6,0x16,0xc6,0x58,0xd6,0xda,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xce,0x99,0xc6,0x58,0xd6,0xda,0xe7,0x3c,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xdf,0x1b,0xb6,0x16,0xbe,0x37,0xce,0x99,0xff,0xdf,0x74,0x4f,0x3b,0x08,0x74,0x4e,0xff,0xff,0xff,0xdf,0xdf,0x1b,0xbe,0x37,0xdf,0x1b,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0x95,0x12,0x53,0x8a,0x63,0xed,0x7c,0x8f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xce,0x99,0x7c,0xb0,0x8c,0xf1,0xd6,0xda,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xe7,0x5c,0xd6,0xda,0x7c,0x8f,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xdf,0xc6,0x78,0x95,0x12,0xb5,0xf6,0xc6,0x79,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xd6,0xda,0x8c,0xf1,0xad,0xd5,0x9d,0x53,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xef,0x9d,0xbe,0x37,0x8c,0xf1,0x9d,0x73,0xce,0xda,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xdf,0xce,0x99,0x95,0x12,0xb6,0x17,0x95,0x32,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xef,0x7d,0xbe,0x37,0x9d,0x53,0xad,0x95,0xef,0x7d,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xdf,0xbe,0x58,0x7c,0xb0,0xb5,0xf6,0xb5,0xf6,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xf7,0xbe,0xbe,0x17,0x9d,0x33,0xad,0xb5,0xd6,0xda,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xf7,0xbe,0xbe,0x37,0x84,0xb0,0xad,0xb5,0xce,0x79,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xce,0xba,0x8c,0xf1,0xbe,0x17,0x95,0x12,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xce,0x99,0x95,0x12,0xad,0xb5,0x8c,0xf1,0xef,0x9d,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xce,0x99,0x8c,0xd1,0xbe,0x37,0xad,0xb5,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xdf,0x3b,0xad,0xb5,0x95,0x12,0xa5,0x74,0xef,0x7d,0x74,0x4f,0x3b,0x08,0x74,0x4e,0xef,0x9d,0x84,0xd1,0xad,0xb5,0xd6,0xda,0xf7,0xbe,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x74,0x6f,0x8c,0xf1,0x9d,0x53,0x7c,0xb0,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x8c,0xf1,0xad,0xf6,0xad,0xd5,0x84,0xb0,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0x8c,0xf1,0xbe,0x58,0xde,0xfb,0x7c,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xff,0xff,0xff,0x95,0x33,0x95,0x12,0xd6,0xda,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xff,0xff,0xc6,0x78,0x95,0x32,0xa5,0x74,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xdf,0x8c,0xf2,0x9d,0x53,0xe7,0x3c,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xff,0xff,0xff,0xb5,0xf6,0x8d,0x12,0x9d,0x74,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xff,0xff,0xf7,0xbe,0x7c,0x90,0x8c,0xd1,0xf7,0xbe,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xff,0xff,0xff,0x95,0x33,0x95,0x32,0xc6,0x78,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xdf,0x9d,0x53,0x95,0x33,0xdf,0x1b,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xdf,0x8d,0x12,0x95,0x33,0xd6,0xda,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xff,0xff,0xc6,0x58,0xa5,0x94,0xa5,0x74,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xff,0xff,0xce,0x99,0x9d,0x73,0x9d,0x53,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xff,0xff,0x9d,0x74,0xa5,0xb5,0xad,0xb5,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xff,0xff,0xef,0x7d,0x84,0xd1,0xa5,0x74,0xf7,0x9e,0x74,0x4f,0x3b,0x08,0x74,0x4e,0xff,0xdf,0xd6,0xda,0xa5,0x94,0x95,0x12,0xd6,0xda,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x63,0xed,0x8c,0xf1,0xa5,0x74,0x8c,0xf1,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xe7,0x5c,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xad,0xd5,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0x7c,0x8f,0x3b,0x08,0x53,0x8a,0x9d,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x53,0x8b,0x3b,0x08,0x43,0x28,0x63,0xed,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xff,0xff,0xff,0xf7,0xbe,0xef,0x7d,0xff,0xff,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xff,0xff,0xff,0xff,0xe7,0x5c,0xf7,0x9e,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xef,0x7d,0xe7,0x5c,0xff,0xff,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xff,0xff,0xff,0xf7,0xde,0xe7,0x3c,0xf7,0xdf,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xff,0xdf,0xff,0xff,0xf7,0x9e,0xf7,0xbe,0xff,0xff,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xff,0xff,0xff,0xf7,0x9e,0xdf,0x1b,0xff,0xdf,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xff,0xe7,0x5d,0xde,0xfb,0xff,0xff,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xff,0xef,0x9d,0xdf,0x1b,0xff,0xff,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xff,0xff,0xff,0xff,0xd6,0xfb,0xf7,0x9e,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xff,0xff,0xff,0xdf,0xdf,0x1b,0xf7,0xbe,0xf7,0xbe,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xff,0xff,0xf7,0xbe,0xd6,0xda,0xf7,0xbe,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xff,0xff,0xff,0xff,0xe7,0x3c,0xef,0x7d,0xff,0xff,0x74,0x4f,0x3b,0x08,0x74,0x4e,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xf7,0xbe,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xce,0x99,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xd6,0xfb,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0x74,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1b,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xef,0x7d,0xde,0xfb,0xdf,0x1b,0xef,0x5d,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xde,0xfb,0x74,0x2e,0x74,0x2e,0xd6,0xba,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xef,0x7d,0x95,0x12,0xce,0xb9,0xbe,0x37,0xce,0x99,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xa5,0x94,0xde,0xfb,0xdf,0x1b,0xad,0xd6,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xd6,0xda,0xce,0x99,0xdf,0x1b,0xbe,0x17,0xde,0xfb,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xbe,0xad,0xd6,0xd6,0xda,0xd6,0xda,0xad,0xd5,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xa5,0xb4,0xce,0x79,0xd6,0xba,0xad,0x95,0xef,0x7d,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xef,0x9d,0xad,0xd5,0xdf,0x1b,0xce,0x99,0xce,0x99,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x5c,0xbe,0x37,0xe7,0x5c,0xce,0xb9,0xdf,0x1b,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x3c,0xb6,0x16,0xdf,0x1b,0xce,0x79,0xde,0xfb,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xb5,0xf6,0xe7,0x3c,0xe7,0x3c,0xbe,0x17,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xb5,0xd6,0xe7,0x5c,0xe7,0x5c,0xb5,0xf6,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0x9e,0xb5,0xf6,0xe7,0x5c,0xe7,0x3c,0xbe,0x38,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xb6,0x16,0xde,0xfb,0xdf,0x1b,0xb5,0xf7,0xf7,0x9e,0x74,0x4f,0x3b,0x08,0x63,0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x84,0xb0,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x7c,0xb0,0xad,0xb5,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xef,0x9d,0xde,0xfb,0xde,0xfb,0xde,0xfb,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xef,0x7d,0x95,0x32,0xc6,0x78,0xb5,0xf6,0xce,0x99,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0x95,0x32,0xad,0xf5,0xb5,0xf6,0x9d,0x53,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xd6,0xba,0x9d,0x53,0xad,0xd5,0x8d,0x12,0xd6,0xfa,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xbe,0x9d,0x53,0xb5,0xf6,0xb5,0xf6,0x9d,0x73,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xad,0xf6,0xce,0x99,0xd6,0xba,0xad,0xb5,0xef,0x9d,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xef,0x7d,0x84,0xb0,0xad,0xd5,0xa5,0x94,0xc6,0x58,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x3c,0x8c,0xf1,0xa5,0x94,0x95,0x12,0xd6,0xba,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x3c,0x8c,0xf1,0xad,0xd5,0x9d,0x73,0xd6,0xba,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0x95,0x32,0xa5,0x94,0xa5,0x94,0x95,0x32,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0x9d,0x53,0xad,0xd5,0xad,0xd5,0x95,0x32,0xef,0x9d,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xef,0x9d,0x8c,0xf1,0xad,0xd5,0xa5,0xb5,0xad,0xb5,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xad,0xd5,0xad,0xd5,0xb5,0xf6,0x9d,0x53,0xef,0x7d,0x74,0x4f,0x3b,0x08,0x53,0x8a,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0xad,0xd5,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xff,0xef,0x5d,0xdf,0x1b,0xe7,0x3c,0xff,0xdf,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xef,0x9d,0xef,0x5d,0xe7,0x5c,0xef,0x9d,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xf7,0xbe,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xff,0xdf,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xff,0xef,0x9d,0xe7,0x5c,0xe7,0x5d,0xf7,0x9e,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xf7,0xde,0xdf,0x3b,0xd6,0xfb,0xef,0x7d,0xff,0xff,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xff,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xff,0xdf,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xdf,0xef,0x7d,0xef,0x9d,0xef,0x9d,0xf7,0xbe,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xdf,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xff,0xdf,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xef,0x7d,0xf7,0x9e,0xef,0x9d,0xef,0x9e,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xef,0x9d,0xef,0x7d,0xef,0x7d,0xef,0x9d,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xef,0x7d,0xef,0x9d,0xef,0x9d,0xf7,0x9e,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xf7,0x9e,0xef,0x7d,0xef,0x7d,0xef,0x9d,0xff,0xff,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x7c,0x8f,0xef,0x7d,0xff,0xff,0xff,0xdf,0xb6,0x17,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x17,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xa5,0x94,0xce,0x99,0xbe,0x37,0x84,0xd0,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0xb5,0xf6,0x5b,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xf7,0x9e,0x95,0x12,0xb5,0xf6,0x9d,0x74,0xce,0x99,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xb5,0xf6,0xad,0xb5,0xb5,0xf6,0xad,0xb5,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xe7,0x3c,0x9d,0x53,0xb5,0xf6,0x95,0x33,0xe7,0x5c,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xdf,0x9d,0x74,0xb5,0xd6,0xa5,0x94,0xb5,0xf6,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xbe,0x58,0xad,0xb5,0xb6,0x16,0x9d,0x53,0xf7,0x9e,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xf7,0xbe,0x9d,0x53,0xb5,0xf6,0xa5,0x94,0xd6,0xba,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xef,0x9d,0x9d,0x33,0xb5,0xf6,0x95,0x32,0xe7,0x3c,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x4d,0x9d,0x93,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xef,0x7d,0x9d,0x53,0xb5,0xf6,0x9d,0x53,0xde,0xfb,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xb6,0x16,0xad,0xb5,0x9d,0x74,0xad,0xb5,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xad,0xd6,0xad,0xb5,0xad,0xb5,0xa5,0xb4,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0x9e,0xad,0xb5,0xad,0xb5,0xa5,0x74,0xbe,0x37,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xc6,0x79,0xad,0x95,0xbe,0x17,0xa5,0x94,0xf7,0xbe,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0x74,0x4e,0x6c,0x2d,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0x6c,0x2e,0xad,0xd5,0xd6,0xda,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x43,0x29,0x8c,0xf1,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xef,0x5d,0x9d,0x73,0xef,0x7d,0xc6,0x58,0xc6,0x58,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xe7,0x5c,0x9d,0x74,0xef,0x7d,0xf7,0x9e,0xa5,0x74,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xce,0x79,0xce,0x99,0xf7,0xbe,0xbe,0x37,0xce,0xba,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xbe,0x9d,0x54,0xef,0x7d,0xef,0x5d,0x95,0x33,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xad,0xd5,0xce,0xb9,0xef,0x5d,0xad,0xd5,0xef,0x7d,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xef,0x7d,0xa5,0x74,0xf7,0xbe,0xdf,0x1b,0xbe,0x17,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xde,0xfb,0xbe,0x37,0xff,0xdf,0xc6,0x78,0xd6,0xba,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf0,0x9d,0x72,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xdf,0x1b,0xad,0xb5,0xf7,0xbe,0xd6,0xda,0xce,0x79,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xa5,0x94,0xf7,0x9e,0xf7,0xbe,0x9d,0x53,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0x9d,0x54,0xf7,0xbe,0xf7,0xbe,0xa5,0x94,0xef,0x7d,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xef,0x7d,0x9d,0x73,0xff,0xdf,0xf7,0xbe,0xad,0xb5,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xa5,0xb5,0xe7,0x3c,0xf7,0xbe,0xb5,0xd6,0xef,0x7d,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x6c,0x2e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x95,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0xab,0x6c,0x2d,0x3b,0x08,0x43,0x29,0x7c,0x6f,0x63,0xec,0x3b,0x08,0x3b,0x08,0x43,0x49,0xa5,0x94,0x3b,0x08,0x3b,0x08,0xa5,0x74,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xdf,0xc6,0x78,0x9d,0x73,0xad,0xd6,0xf7,0x9e,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xd6,0xda,0x9d,0x53,0x9d,0x73,0xce,0x99,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xf7,0x9e,0xa5,0x94,0x95,0x32,0xad,0xd5,0xf7,0xbe,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xff,0xc6,0x78,0x9d,0x53,0xa5,0x94,0xdf,0x1b,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xef,0x9d,0xbe,0x37,0xb5,0xf6,0xce,0x99,0xff,0xff,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xdf,0xad,0xf6,0x95,0x53,0x9d,0x74,0xef,0x7d,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xf7,0xbe,0xa5,0x94,0x95,0x32,0x9d,0x73,0xef,0x9d,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xdf,0xad,0xb5,0x95,0x53,0x9d,0x74,0xef,0x9d,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xc6,0x78,0x95,0x32,0x95,0x33,0xce,0x99,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xce,0xb9,0x95,0x53,0x95,0x53,0xce,0x99,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xb6,0x17,0x95,0x32,0x95,0x53,0xd6,0xda,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xef,0x7d,0x95,0x53,0x95,0x53,0xb6,0x17,0xff,0xdf,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xab,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x90,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x99,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xf7,0xbe,0x8d,0x12,0x3b,0x08,0xb5,0xf6,0x63,0xec,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xef,0x9d,0xd6,0xda,0xd6,0xda,0xef,0x5d,0x8c,0xf1,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xf7,0xbe,0xf7,0xbe,0xa5,0x95,0x9d,0x53,0xd6,0xda,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xff,0xff,0xff,0xff,0xd6,0xda,0xe7,0x3c,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xf7,0xbe,0xc6,0x78,0xff,0xff,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xdf,0xad,0x95,0xdf,0x1b,0xd6,0xda,0xbe,0x37,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xb6,0x16,0xa5,0x94,0xff,0xdf,0xad,0x95,0xf7,0xbe,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xf7,0x9e,0x8c,0xf1,0xef,0x7d,0xc6,0x58,0xde,0xfb,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x5c,0x9d,0x73,0xf7,0xde,0xb5,0xf6,0xef,0x7d,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xff,0xff,0xdf,0xce,0x99,0xff,0xff,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xff,0xff,0xff,0xff,0xd6,0xba,0xef,0x7d,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xff,0xff,0xff,0xff,0xce,0xba,0xe7,0x5c,0xf7,0xbe,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xff,0xff,0xff,0xff,0xc6,0x78,0xff,0xdf,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xff,0xff,0xff,0xff,0xe7,0x5d,0xce,0xb9,0xff,0xff,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcb,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0xb4,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xa5,0x95,0xde,0xfb,0xd6,0xda,0xe7,0x5c,0x64,0x0d,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xd6,0xda,0x74,0x4e,0x74,0x4e,0x74,0x4e,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xf7,0x9e,0x8d,0x12,0xb5,0xf7,0xe7,0x3c,0xce,0x99,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xbe,0x37,0xa5,0x94,0x9d,0x73,0x84,0xd0,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xef,0x7d,0xbe,0x17,0xb6,0x17,0x74,0x6f,0xe7,0x3c,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xbe,0xad,0xb6,0x9d,0x53,0xe7,0x5c,0x9d,0x53,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xa5,0xb4,0xb6,0x17,0xb5,0xf6,0xc6,0x38,0xe7,0x5c,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xef,0x7d,0x95,0x12,0x9d,0x74,0xdf,0x1b,0xb6,0x17,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x3c,0x9d,0x33,0xad,0xb5,0xd6,0xda,0xd6,0xda,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xf7,0x9e,0xbe,0x17,0xbe,0x17,0x7c,0x90,0xd6,0xda,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xd6,0xda,0xc6,0x78,0xb5,0xf6,0x95,0x12,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xce,0x99,0xbe,0x17,0xa5,0x95,0x9d,0x53,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xc6,0x58,0xb6,0x17,0xa5,0x74,0x9d,0x74,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xce,0xb9,0xa5,0x94,0xa5,0x94,0x84,0xb0,0xf7,0xbe,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xb5,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x4e,0x84,0xd0,0x5b,0xcc,0x95,0x32,0x84,0xd0,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xff,0xf7,0x9e,0xa5,0xb4,0xa5,0x95,0xe7,0x5c,0xad,0xf6,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xf7,0x9e,0xef,0x7d,0xef,0x7d,0xf7,0x9e,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xf7,0xbe,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xff,0xdf,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xdf,0xce,0x99,0xef,0x7d,0x9d,0x53,0xc6,0x99,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xce,0x99,0xf7,0xdf,0xc6,0x78,0xad,0xd5,0xff,0xdf,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xf7,0x9e,0xc6,0x78,0xdf,0x1b,0x9d,0x53,0xde,0xfb,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xef,0x5d,0xce,0x99,0xc6,0x78,0x9d,0x53,0xe7,0x5d,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xdf,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xf7,0xbe,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xe7,0x3c,0xdf,0x1b,0xdf,0x1b,0xe7,0x3c,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xef,0x7d,0xe7,0x3c,0xe7,0x3c,0xef,0x7d,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xe7,0x3c,0xdf,0x1b,0xdf,0x1b,0xef,0x7d,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xf7,0x9e,0xe7,0x3c,0xe7,0x3c,0xe7,0x5c,0xff,0xff,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x73,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xd6,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0x8d,0x12,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xd6,0xda,0x7c,0xb0,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xf5,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xce,0x99,0xb5,0xf6,0xce,0x99,0xce,0x99,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xf7,0xde,0xff,0xdf,0xbe,0x37,0xb5,0xf6,0xf7,0xbe,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xff,0xce,0x99,0x95,0x33,0xa5,0x74,0xdf,0x1b,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xff,0xff,0xff,0xff,0xef,0x7d,0xce,0xba,0xff,0xff,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xf7,0xbe,0xb5,0xf6,0xf7,0xde,0xde,0xfb,0xe7,0x5c,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xf7,0xbe,0xdf,0x1b,0xff,0xdf,0xef,0x7d,0xef,0x7d,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xef,0x9d,0xb5,0xf6,0xff,0xdf,0xd6,0xda,0xef,0x9d,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xd6,0xba,0xff,0xdf,0xf7,0xbe,0xdf,0x1c,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xd6,0xda,0xf7,0xbe,0xce,0x99,0xde,0xfb,0xf7,0x9e,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xe7,0x5d,0xff,0xff,0xff,0xff,0xce,0x99,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xdf,0x1b,0xbe,0x17,0xc6,0x58,0xf7,0xbe,0xff,0xff,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x99,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0xd6,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0x95,0x12,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xa5,0x94,0xad,0xd5,0xce,0x79,0xc6,0x78,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x74,0x3b,0x08,0x4b,0x6a,0xe7,0x5c,0x9d,0x53,0xc6,0x78,0x9d,0x74,0x95,0x12,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xd6,0xda,0xbe,0x17,0xa5,0x94,0xc6,0x58,0xce,0xb9,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xf7,0xbe,0xad,0x95,0xa5,0x74,0xd6,0xba,0x9d,0x73,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xdf,0x1b,0xb6,0x17,0xb5,0xf6,0x7c,0x6f,0xf7,0x9e,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xef,0x7d,0x8c,0xf1,0xad,0xd5,0xde,0xfb,0xb6,0x17,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xde,0xfb,0xc6,0x78,0xa5,0xb5,0x95,0x32,0xd6,0xba,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xdf,0x1b,0x84,0xb0,0xb6,0x16,0xd6,0xda,0xce,0x99,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xad,0xb5,0xef,0x7d,0x95,0x12,0xa5,0x95,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xb5,0xd6,0xef,0x9d,0xa5,0x74,0x95,0x53,0xef,0x9d,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xad,0xd5,0xad,0xb5,0xdf,0x1c,0xa5,0x94,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0x9d,0x74,0xe7,0x3c,0x8c,0xf1,0xad,0xd5,0xf7,0xbe,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0xad,0xb5,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xc6,0x78,0x53,0xab,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x69,0x84,0xd1,0xce,0xb9,0xef,0x5d,0xef,0x7d,0xe7,0x3c,0xb5,0xf6,0x63,0xed,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xe7,0x3c,0xe7,0x3c,0xd6,0xda,0xde,0xfb,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0xce,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x5b,0xcb,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xad,0xd6,0xa5,0x74,0x9d,0x73,0xa5,0xb5,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xff,0xff,0xc6,0x79,0x95,0x12,0xa5,0x74,0xe7,0x3c,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xdf,0xad,0xb5,0xa5,0x54,0x84,0xb0,0xbe,0x17,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x99,0xef,0x7d,0xd6,0xfb,0xd6,0xfb,0xdf,0x1b,0xff,0xdf,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xef,0x9d,0xbe,0x37,0xc6,0x78,0x8c,0xf1,0xd6,0xba,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xef,0x7d,0x8c,0xf1,0x95,0x32,0xad,0xb5,0xdf,0x1b,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xe7,0x5c,0xc6,0x78,0xbe,0x58,0x9d,0x33,0xdf,0x1b,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xb5,0xf6,0x8d,0x12,0xbe,0x38,0xad,0xb5,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xb5,0xf6,0x9d,0x53,0xce,0xb9,0xc6,0x78,0xef,0x9d,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xff,0xff,0xe7,0x3c,0xa5,0x94,0xad,0xb5,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xc6,0x78,0xad,0x95,0xb5,0xf6,0xef,0x7d,0xf7,0xbe,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x74,0x4e,0xbe,0x37,0xdf,0x1c,0xef,0x9d,0xe7,0x3c,0xce,0x99,0x7c,0x8f,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xf7,0x9e,0x63,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x4b,0x6a,0x53,0x8a,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x64,0x0d,0x6c,0x0d,0x4b,0x6a,0x4b,0x6a,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xa5,0x94,0xce,0xb9,0xb5,0xf6,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xef,0x5d,0xff,0xdf,0xf7,0xbe,0xff,0xff,0xff,0xff,0xf7,0x9e,0x5b,0xab,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xf7,0xde,0xf7,0xbe,0xff,0xff,0x9d,0x53,0x3b,0x08,0x4b,0x6a,0xff,0xff,0xff,0xdf,0xf7,0xbe,0xf7,0xbe,0xff,0xff,0xe7,0x3c,0x3b,0x08,0x3b,0x08,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x64,0x0d,0x3b,0x08,0x7c,0x90,0xff,0xff,0xff,0xdf,0xff,0xff,0xf7,0xbe,0xff,0xff,0xc6,0x58,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8d,0x12,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xdf,0xff,0xff,0xad,0xd6,0x3b,0x08,0x53,0x6a,0xe7,0x5c,0xff,0xff,0xf7,0xde,0xff,0xff,0xff,0xff,0xef,0x7d,0x53,0x8b,0x3b,0x08,0xf7,0xbe,0xff,0xff,0xf7,0xbe,0xff,0xff,0xff,0xff,0xf7,0xbe,0x43,0x49,0x3b,0x08,0x5b,0xcc,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xde,0xfb,0x3b,0x08,0x3b,0x08,0xce,0xb9,0xff,0xff,0xf7,0xbe,0xff,0xdf,0xff,0xff,0xff,0xff,0x74,0x4f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x53,0x8a,0x4b,0x6a,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xdf,0x6c,0x2d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x6a,0xe7,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x4b,0x6a,0x3b,0x08,0x9d,0x53,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0xf1,0x3b,0x08,0x4b,0x69,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1b,0x3b,0x08,0x3b,0x08,0x9d,0x53,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0x53,0xab,0x3b,0x08,0x74,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x8c,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x53,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x94,0x3b,0x08,0x4b,0x49,0xdf,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5c,0x53,0x8a,0x3b,0x08,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x43,0x29,0x3b,0x08,0x5b,0xab,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xba,0x3b,0x08,0x3b,0x08,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x63,0xec,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x37,0x3b,0x08,0x3b,0x08,0x6c,0x2d,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x53,0xab,0x3b,0x08,0x43,0x28,0xc6,0x78,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x94,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xc6,0x79,0xff,0xdf,0xff,0xff,0xef,0x9e,0x84,0xd1,0x3b,0x08,0x3b,0x08,0x43,0x28,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x7c,0x90,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8b,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x9d,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x49,0xef,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0xad,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x3b,0x08,0x3b,0x08,0xad,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xf6,0x3b,0x08,0x3b,0x08,0x43,0x28,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x53,0x3b,0x08,0x3b,0x08,0x7c,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xfb,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xc6,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xef,0x7d,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x69,0xbe,0x17,0xef,0x9d,0xf7,0x9e,0xc6,0x58,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x84,0xb0,0xe7,0x3c,0xf7,0x9e,0xdf,0x1b,0x74,0x6f,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x5b,0xcc,0xd6,0xba,0xf7,0x9e,0xef,0x7d,0xad,0xf6,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0x7c,0xb0,0x63,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xd6,0xda,0xf7,0x9e,0xef,0x7d,0x9d,0x53,0x43,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x64,0x0d,0xdf,0x1b,0xef,0x9d,0xde,0xfb,0x74,0x6e,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x4e,0xdf,0x1b,0xf7,0x9e,0xe7,0x5c,0x95,0x32,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xb5,0xf6,0xe7,0x5c,0xe7,0x5c,0xb5,0xf6,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x4b,0x49,0xb5,0xf6,0xef,0x7d,0xef,0x7d,0xb6,0x17,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x8a,0xbe,0x58,0xef,0x7d,0xe7,0x5c,0x9d,0x74,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0xa5,0x94,0xef,0x7d,0xf7,0x9e,0xd6,0xda,0x6c,0x0d,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x6c,0x2e,0xf7,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0xb9,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x8a,0x5b,0xcc,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x5b,0xcc,0x43,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x5b,0xcc,0x53,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x5b,0xab,0x53,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x08,0x53,0x8b,0x43,0x28,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x28,0x5b,0xab,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x43,0x29,0x4b,0x49,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x53,0x8a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x53,0x6a,0x4b,0x6a,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x4b,0x49,0x5b,0xcc,0x43,0x29,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x3b,0x08,0x63,0xec,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,0x6c,0x0d,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x3a,0xe8,0x43,0x29,0x84,0xb0,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xce,0x99,0x95,0x13,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x6c,0x0e,0x7c,0x70,0x9d,0x33,0xd6,0xda,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+};
\ No newline at end of file
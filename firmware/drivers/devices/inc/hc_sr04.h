@@ -14,6 +14,10 @@
  * 
  * @note When disconnected return 0.
  * 
+ * @note Echo edges are timestamped by interruption, so reads block the calling task 
+ * (without using the CPU) until the echo finishes. HcSr04StartRanging() measures 
+ * continuously in its own task and reads return the last median filtered distance immediately.
+ * 
  * @note When ussing dedicated connector in ESP-EDU:
  * |   HC_SR04      |   EDU-CIAA	|
  * |:--------------:|:-------------:|
@@ -29,6 +33,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 17/10/2026 | Interrupt-timestamped echo and continuous ranging with median filter	|
+ * | 17/10/2026 | Median of the measured distances only, echo pin changes on re-init	|
  * 
  **/
 
@@ -37,8 +43,18 @@
 #include <stdint.h>
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#define HC_SR04_MEDIAN_MAX	9	/*!< Maximun length of median filter window */
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Median filter of the last distances
+ */
+typedef struct {
+	uint16_t samples[HC_SR04_MEDIAN_MAX];	/*!< Last distances (mm) */
+	uint8_t len;							/*!< Window length */
+	uint8_t count;							/*!< Distances in the window (less than len until it fills) */
+	uint8_t index;							/*!< Position of the next distance */
+} hc_sr04_median_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -46,6 +62,8 @@
 /**
  * @brief HC_SR04 initialization.
  * 
+ * @note It can be initialized again with other pins (not while ranging).
+ * 
  * @param echo GPIO number wher echo pin is connected
  * @param trigger GPIO number wher trigger pin is connected
  * @return true 
@@ -66,6 +84,83 @@ uint16_t HcSr04ReadDistanceInCentimeters(void);
  */
 uint16_t HcSr04ReadDistanceInInches(void);
 
+/**
+ * @brief Read distance
+ * 
+ * @return uint16_t measured distance in mm.
+ */
+uint16_t HcSr04ReadDistanceInMillimeters(void);
+
+/**
+ * @brief Start continuous ranging at the maximun rate of the sensor (one measurement every 60ms).
+ * 
+ * @param median_len Length of median filter window (1: no filter, up to HC_SR04_MEDIAN_MAX)
+ * @param func_p Function to be called after each new measurement (NULL if not used)
+ * @param param_p Parameter passed to func_p
+ * @return true if ranging started, false if already running or not initialized
+ */
+bool HcSr04StartRanging(uint8_t median_len, void *func_p, void *param_p);
+
+/**
+ * @brief Stop continuous ranging.
+ * 
+ */
+void HcSr04StopRanging(void);
+
+/**
+ * @brief Width of echo pulse from edge timestamps.
+ * 
+ * @param rise_us Timestamp of rising edge in usec
+ * @param fall_us Timestamp of falling edge in usec
+ * @return uint32_t echo width in usec (0 if timestamps are not valid)
+ */
+uint32_t HcSr04EchoWidth(int64_t rise_us, int64_t fall_us);
+
+/**
+ * @brief Convert echo pulse width to distance.
+ * 
+ * @param width_us Echo width in usec
+ * @return uint16_t distance in mm (saturated to maximun distance)
+ */
+uint16_t HcSr04EchoToMillimeters(uint32_t width_us);
+
+/**
+ * @brief Distance from the timestamps of the echo pulse edges.
+ * 
+ * @param rise_us Timestamp of rising edge in usec
+ * @param fall_us Timestamp of falling edge in usec
+ * @return uint16_t distance in mm (0 if timestamps are not valid, saturated to maximun distance)
+ */
+uint16_t HcSr04EdgesToMillimeters(int64_t rise_us, int64_t fall_us);
+
+/**
+ * @brief Median of a set of distances.
+ * 
+ * @note samples array is sorted in place.
+ * 
+ * @param samples Distances
+ * @param len Number of distances
+ * @return uint16_t median value
+ */
+uint16_t HcSr04Median(uint16_t *samples, uint8_t len);
+
+/**
+ * @brief Start a median filter.
+ * 
+ * @param filter Median filter
+ * @param len Window length (1: no filter, up to HC_SR04_MEDIAN_MAX)
+ */
+void HcSr04MedianInit(hc_sr04_median_t *filter, uint8_t len);
+
+/**
+ * @brief Add a distance to a median filter.
+ * 
+ * @param filter Median filter
+ * @param distance_mm New distance in mm
+ * @return uint16_t median of the last len distances (of all the distances added while there are fewer)
+ */
+uint16_t HcSr04MedianAdd(hc_sr04_median_t *filter, uint16_t distance_mm);
+
 /**
  * @brief HC_SR04 de-initialization.
  * 
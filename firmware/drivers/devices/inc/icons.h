@@ -12,6 +12,7 @@
  * @note Available sizes: 22x22 pixels, 30x30 pixels, 59x59 pixels, 89x89 pixels.
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
+ * (assets/icons.c) and compressed as 2 colors palette images (image_rle.h) with tools/image_rle_conv.
  * 
  * @author Albano Peñalva
  *
@@ -20,6 +21,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 17/10/2026 | Icons stored as compressed palette images                             |
  * 
  **/
 
@@ -104,8 +106,8 @@ typedef enum {
 typedef struct{
 	uint8_t 		height;   		/*!< Icon height in pixels */
 	uint8_t 		width;			/*!< Icon width in pixels */
-	uint16_t 		offset;			/*!< Offset between icons in data array */
-	const uint8_t 	*data; 			/*!< Icon data array */
+	const uint16_t 	*offset;		/*!< Position of each icon in data array, and end of the last one */
+	const uint8_t 	*data; 			/*!< Compressed icons data array (background: index 0, foreground: index 1) */
 } icon_font_t;
 
 /*==================[external data declaration]==============================*/
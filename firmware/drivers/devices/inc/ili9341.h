@@ -12,6 +12,9 @@
  * TFT color display connected to the ESP-EDU. It uses a SPI port and 3 GPIOs to 
  * communicate with the ILI9341 LCD driver chip.
  *
+ * @note The driver functions must be called from a single task. Other tasks can
+ * draw through the render queue of ili9341_render.h, without waiting for the LCD.
+ *
  * @author Albano Peñalva
  *
  * @note Hardware connections:
@@ -33,6 +36,13 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 17/10/2026 | Framebuffer mode with dirty-rectangle flushing |
+ * | 17/10/2026 | Lines, circles and triangles drawn as runs     |
+ * | 17/10/2026 | Text lines in one window, glyph cache          |
+ * | 17/10/2026 | Compressed images and icons, streamed decode   |
+ * | 17/10/2026 | Strip chart with hardware vertical scroll      |
+ * | 17/10/2026 | No function statics, render queue module       |
+ * | 17/10/2026 | Framebuffer pixels kept on rotation            |
  *
  */
 
@@ -41,11 +51,13 @@
 #include "spi_mcu.h"
 #include "fonts.h"
 #include "icons.h"
+#include "image_rle.h"
 /*==================[macros]=================================================*/
 /* LCD settings */
 #define ILI9341_WIDTH       240			/*!< LCD width in pixels */
 #define ILI9341_HEIGHT      320			/*!< LCD height in pixels */
 #define ILI9341_PIXEL_MAX	76800
+#define ILI9341_CHART_MAX_TRACES	4	/*!< Maximum number of traces of the strip chart */
 /* 16bits colors (RGB565) */			/*	 R,   G,   B */
 #define ILI9341_BLACK          	0x0000  /*   0,   0,   0 */
 #define ILI9341_NAVY           	0x000F 	/*   0,   0, 128 */
@@ -80,6 +92,34 @@ typedef enum ili9341_orientation {
 	ILI9341_Landscape_1, 	/*!< Landscape orientation mode 1 */
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
+
+/**
+ * @brief  Strip chart trace
+ */
+typedef struct {
+	uint16_t color;			/*!< Trace color (RGB565) */
+	int32_t min;			/*!< Value at the bottom of the chart (initial value if autoscale) */
+	int32_t max;			/*!< Value at the top of the chart (initial value if autoscale) */
+	uint8_t autoscale;		/*!< Fit min and max to the values shown */
+} ili9341_trace_t;
+
+/**
+ * @brief  Strip chart configuration
+ */
+typedef struct {
+	uint16_t x;				/*!< X position of the left side of the chart */
+	uint16_t width;			/*!< Chart width in pixels (columns shown) */
+	uint16_t y;				/*!< Y position of the top of the chart */
+	uint16_t height;		/*!< Chart height in pixels */
+	uint16_t background;	/*!< Background color (RGB565) */
+	uint16_t grid;			/*!< Grid color (RGB565) */
+	uint16_t grid_rows;		/*!< Horizontal grid lines (0: none) */
+	uint16_t grid_columns;	/*!< Columns between vertical grid lines (0: none) */
+	uint32_t sample_rate;	/*!< Samples per second added to the chart */
+	uint32_t column_rate;	/*!< Columns per second drawn (up to sample_rate) */
+	uint8_t traces;			/*!< Number of traces (up to ILI9341_CHART_MAX_TRACES) */
+	ili9341_trace_t trace[ILI9341_CHART_MAX_TRACES];	/*!< Traces */
+} ili9341_chart_config_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -110,6 +150,8 @@ void ILI9341Fill(uint16_t color);
 
 /**
  * @brief  		Rotates LCD to specific orientation
+ * @note		As the LCD, the framebuffer keeps what is on the screen: its pixels are moved 
+ * 				to the new orientation, nothing more is sent on the next flush.
  * @param[in]	orientation: LCD orientation
  * @retval 		None
  */
@@ -141,6 +183,8 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 
 /**
  * @brief  		Draw an integer on the LCD
+ * @note		Every digit takes the width of the widest digit of the font, so the
+ * 				number does not move when its value changes
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	num: Number to be displayed
@@ -154,6 +198,8 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
 
 /**
  * @brief  		Draw a string on the LCD
+ * @note		Each line of the string is sent as a single window, with one column of
+ * 				background between characters. Text beyond the LCD area is clipped
  * @param[in] 	x: X position of top left corner of first character in string
  * @param[in]  	y: Y position of top left corner of first character in string
  * @param[in]  	str: Pointer to first character
@@ -267,6 +313,76 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Draw a compressed picture on the LCD
+ * @note		Pictures are compressed with tools/image_rle_conv, from the same uint8_t 
+ * 				arrays used by ILI9341DrawPicture. They are decoded while they are sent,
+ * 				the part outside the LCD is clipped
+ * @param[in] 	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in] 	image: Compressed picture (up to 1024 pixels width)
+ * @retval 		None
+ */
+void ILI9341DrawImage(uint16_t x, uint16_t y, const image_rle_t* image);
+
+/**
+ * @brief  		Enables framebuffer mode
+ * @note		A full-screen RGB565 off-screen buffer is allocated in DMA capable RAM.
+ * 				While it is enabled, all ILI9341Draw* functions only modify this buffer 
+ * 				and record the modified areas. Call ILI9341Flush() to update the LCD.
+ * @param 		None
+ * @retval 		1 when success, 0 when fails
+ */
+uint8_t ILI9341FramebufferInit(void);
+
+/**
+ * @brief  		Sends the areas of the framebuffer modified since the last flush to the LCD
+ * @note		Each dirty rectangle is sent as a single memory window using large SPI (DMA) transfers.
+ * 				Does nothing if framebuffer mode is not enabled.
+ * @param 		None
+ * @retval 		None
+ */
+void ILI9341Flush(void);
+
+/**
+ * @brief  		Disables framebuffer mode and releases its memory
+ * @note		Pending modifications are flushed to the LCD before releasing the buffer.
+ * 				After this call ILI9341Draw* functions write directly to the LCD again.
+ * @param 		None
+ * @retval 		None
+ */
+void ILI9341FramebufferDeInit(void);
+
+/**
+ * @brief  		Starts a scrolling strip chart
+ * @note		The chart scrolls from right to left using the vertical scrolling of the
+ * 				ILI9341, so each new column costs a one pixel wide window write and a
+ * 				scroll update. The scrolling area spans the full LCD height: the chart
+ * 				must take whole columns of the LCD (other drawings can only go to its
+ * 				left or right). Needs a landscape orientation and no framebuffer mode.
+ * 				Do not rotate the LCD or draw on the chart columns until ILI9341ChartDeInit
+ * @param[in] 	config: Chart configuration
+ * @retval 		1 when success, 0 when fails
+ */
+uint8_t ILI9341ChartInit(const ili9341_chart_config_t *config);
+
+/**
+ * @brief  		Adds a sample of each trace to the strip chart
+ * @note		Samples are decimated from sample_rate to column_rate: each column shows 
+ * 				the range of the samples it takes, so peaks are not lost
+ * @param[in] 	samples: One sample per trace
+ * @retval 		None
+ */
+void ILI9341ChartAdd(const int32_t *samples);
+
+/**
+ * @brief  		Stops the strip chart and restores the LCD scrolling
+ * @note		Without the scroll, chart columns are shown in the order they have in the 
+ * 				LCD memory: the chart area should be redrawn
+ * @retval 		None
+ */
+void ILI9341ChartDeInit(void);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
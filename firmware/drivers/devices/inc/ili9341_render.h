@@ -0,0 +1,158 @@
+#ifndef ILI9341_RENDER_H_
+#define ILI9341_RENDER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup ILI9341_RENDER ILI9341 render queue
+ ** @{ */
+
+/** \brief Drawing commands for the ILI9341 LCD from any task, rendered by a display task.
+ *
+ * ILI9341RenderFill(), ILI9341RenderBlit(), ILI9341RenderImage(), ILI9341RenderText()
+ * and ILI9341RenderLine() only put a command in a lock-free queue (any number of tasks
+ * can add commands at the same time) and return: they never wait for the LCD.
+ * The display task takes all the queued commands at once and, before drawing them,
+ * drops the ones that would not be seen:
+ *
+ * - Commands with the same widget identifier as a later command of the batch: a
+ *   widget command must redraw the whole widget (e.g. a value shown with its background).
+ * - Commands hidden by a later fill, blit or image that covers all their area.
+ *
+ * The remaining commands are drawn in order with the ILI9341 driver (and flushed if
+ * framebuffer mode is enabled). While the display task runs, all the drawing must be
+ * done through the queue: the ILI9341 driver functions can only be called from one task.
+ *
+ * @note Pictures, images and fonts are not copied: they must stay valid until they are
+ * drawn (ILI9341RenderSync()). Texts are copied, up to ILI9341_RENDER_TEXT_MAX characters.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "ili9341.h"
+/*==================[macros]=================================================*/
+#define ILI9341_RENDER_QUEUE_SIZE	32		/*!< Commands in the queue (power of 2) */
+#define ILI9341_RENDER_TEXT_MAX		31		/*!< Characters of a text command */
+#define ILI9341_RENDER_NO_WIDGET	0		/*!< Command that is never replaced by a later one */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Render queue statistics since ILI9341RenderInit()
+ */
+typedef struct {
+	uint32_t submitted;			/*!< Commands queued */
+	uint32_t rejected;			/*!< Commands not queued because the queue was full */
+	uint32_t drawn;				/*!< Commands drawn */
+	uint32_t coalesced;			/*!< Commands dropped: replaced by a later command of the same widget or hidden */
+	uint32_t batches;			/*!< Batches of commands taken by the display task */
+	uint16_t depth;				/*!< Commands waiting in the queue now */
+	uint16_t max_depth;			/*!< Most commands waiting in the queue */
+	uint32_t latency_avg_us;	/*!< Mean time from queueing to drawn (us) */
+	uint32_t latency_max_us;	/*!< Longest time from queueing to drawn (us) */
+} ili9341_render_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Starts the display task
+ * @note		The LCD must be initialized (ILI9341Init) and oriented before
+ * @param[in]  	priority: Display task priority (usually lower than the measurement tasks)
+ * @retval 		1 when success, 0 when fails
+ */
+uint8_t ILI9341RenderInit(uint8_t priority);
+
+/**
+ * @brief  		Queues a filled rectangle
+ * @param[in]  	widget: Widget redrawn by the command (ILI9341_RENDER_NO_WIDGET: none)
+ * @param[in]  	x0: Top left X position
+ * @param[in]  	y0: Top left Y position
+ * @param[in]  	x1: Bottom right X position
+ * @param[in]  	y1: Bottom right Y position
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		1 when queued, 0 when the queue is full
+ */
+uint8_t ILI9341RenderFill(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Queues a picture (as ILI9341DrawPicture)
+ * @param[in]  	widget: Widget redrawn by the command (ILI9341_RENDER_NO_WIDGET: none)
+ * @param[in]  	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in]  	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	pic: Picture (RGB565, MSB first), not copied
+ * @retval 		1 when queued, 0 when the queue is full
+ */
+uint8_t ILI9341RenderBlit(uint16_t widget, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pic);
+
+/**
+ * @brief  		Queues a compressed picture (as ILI9341DrawImage)
+ * @param[in]  	widget: Widget redrawn by the command (ILI9341_RENDER_NO_WIDGET: none)
+ * @param[in]  	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in]  	image: Compressed picture, not copied
+ * @retval 		1 when queued, 0 when the queue is full
+ */
+uint8_t ILI9341RenderImage(uint16_t widget, uint16_t x, uint16_t y, const image_rle_t *image);
+
+/**
+ * @brief  		Queues a text (as ILI9341DrawString)
+ * @param[in]  	widget: Widget redrawn by the command (ILI9341_RENDER_NO_WIDGET: none)
+ * @param[in]  	x: X position of top left corner of the text
+ * @param[in]  	y: Y position of top left corner of the text
+ * @param[in]  	str: Text, copied (up to ILI9341_RENDER_TEXT_MAX characters)
+ * @param[in]  	font: Font, not copied
+ * @param[in]  	foreground: Color of the characters (RGB565)
+ * @param[in]  	background: Color of the background (RGB565)
+ * @retval 		1 when queued, 0 when the queue is full
+ */
+uint8_t ILI9341RenderText(uint16_t widget, uint16_t x, uint16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Queues a line (as ILI9341DrawLine)
+ * @param[in]  	widget: Widget redrawn by the command (ILI9341_RENDER_NO_WIDGET: none)
+ * @param[in]  	x0: X position of the first point
+ * @param[in]  	y0: Y position of the first point
+ * @param[in]  	x1: X position of the second point
+ * @param[in]  	y1: Y position of the second point
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		1 when queued, 0 when the queue is full
+ */
+uint8_t ILI9341RenderLine(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Waits until all the queued commands are drawn (or dropped)
+ * @param[in]  	timeout_ms: Maximum wait in milliseconds
+ * @retval 		1 when the queue is empty, 0 on timeout
+ */
+uint8_t ILI9341RenderSync(uint32_t timeout_ms);
+
+/**
+ * @brief  		Gets the render queue statistics
+ * @note		The coalescing rate is coalesced / submitted
+ * @param[out] 	stats: Statistics
+ * @retval 		None
+ */
+void ILI9341RenderGetStats(ili9341_render_stats_t *stats);
+
+/**
+ * @brief  		Stops the display task, after drawing the queued commands
+ * @note		Commands queued by other tasks while it stops are either refused or drawn
+ * @retval 		None
+ */
+void ILI9341RenderDeInit(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ILI9341_RENDER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,122 @@
+#ifndef IMAGE_RLE_H_
+#define IMAGE_RLE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup IMAGE_RLE Compressed images
+ ** @{ */
+
+/** \brief Lossless compressed RGB565 images and palette icons for LCD display.
+ *
+ * Images are decoded as a stream, in pieces of any number of pixels, so they can be
+ * sent to the LCD without decompressing them whole.
+ *
+ * RGB565 images are coded as in QOI (https://qoiformat.org), with channels of 5, 6
+ * and 5 bits. Each pixel is compared with the previous one (initially black) and with
+ * a table of the 64 last seen colors, indexed by (3 * r + 5 * g + 7 * b) % 64:
+ *
+ * | Code                | Bytes | Meaning                                                        |
+ * |:-------------------:|:-----:|:---------------------------------------------------------------|
+ * | 00iiiiii            | 1     | Color at position i of the table                               |
+ * | 01rrggbb            | 1     | Red, green and blue differences (-2..1, bias 2)                |
+ * | 10gggggg rrrrbbbb   | 2     | Green difference (-32..31, bias 32), red and blue differences  |
+ * |                     |       | minus half the green difference (-8..7, bias 8)                |
+ * | 11nnnnnn            | 1     | n + 1 (1..62) pixels equal to the previous one                 |
+ * | 0xFE cccccccc cccc… | 3     | RGB565 color, MSB first                                        |
+ * | 0xFF nnnnnnnn nnnn… | 3     | n + 63 (63..65598) pixels equal to the previous one, MSB first |
+ *
+ * Palette images (up to 16 colors) store the color index of each pixel, in k bits
+ * (the bits needed for the palette size):
+ *
+ * | Code                | Bytes | Meaning                                                        |
+ * |:-------------------:|:-----:|:---------------------------------------------------------------|
+ * | 0 iii…              | 1     | 7 / k pixels, first pixel on the most significant bits         |
+ * | 1 nnn… iii…         | 1     | n + 1 pixels of index i (n has 7 - k bits)                     |
+ * | 1 111… iii… nnnnnnnn| 2     | 2^(7 - k) + n pixels of index i                                |
+ *
+ * Images are compressed with ImageRleEncode(), the tool in tools/image_rle_conv
+ * generates the C source of images and icons.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define IMAGE_RLE_PALETTE_MAX	16		/*!< Maximum number of colors of a palette image */
+#define IMAGE_RLE_INDEX_SIZE	64		/*!< Colors of the table of last seen colors */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Compressed image
+ */
+typedef struct {
+	uint16_t width;				/*!< Image width in pixels */
+	uint16_t height;			/*!< Image height in pixels */
+	uint8_t palette_size;		/*!< Colors of the palette (0: RGB565 image) */
+	const uint16_t *palette;	/*!< Palette colors (RGB565). NULL if they are given when drawing */
+	uint32_t size;				/*!< Bytes of compressed data */
+	const uint8_t *data;		/*!< Compressed data */
+} image_rle_t;
+
+/**
+ * @brief Decoder state
+ */
+typedef struct {
+	const image_rle_t *image;				/*!< Image being decoded */
+	uint32_t pos;							/*!< Next byte of compressed data */
+	uint32_t left;							/*!< Pixels of the image not decoded yet */
+	uint32_t run;							/*!< Pixels left of the current run */
+	uint16_t pixel;							/*!< Last decoded pixel (RGB565 or palette index) */
+	uint8_t bits;							/*!< Bits per palette index */
+	uint8_t literal;						/*!< Palette indexes left in the literal being decoded */
+	uint8_t literal_data;					/*!< Literal being decoded */
+	uint16_t palette[IMAGE_RLE_PALETTE_MAX];	/*!< Palette colors (LCD byte order) */
+	uint16_t index[IMAGE_RLE_INDEX_SIZE];	/*!< Last seen colors (RGB565) */
+} image_rle_decoder_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Start decoding an image
+ * @param[out] 	decoder: Decoder state
+ * @param[in]  	image: Compressed image
+ * @param[in]  	palette: Palette colors (RGB565) for palette images, NULL to use the image palette
+ * @retval 		None
+ */
+void ImageRleDecoderInit(image_rle_decoder_t *decoder, const image_rle_t *image, const uint16_t *palette);
+
+/**
+ * @brief  		Decode the next pixels of an image
+ * @param[in]  	decoder: Decoder state
+ * @param[out] 	pixels: Decoded pixels, 2 bytes/pixel in LCD byte order (MSB first)
+ * @param[in]  	count: Pixels to decode
+ * @retval 		Pixels decoded (less than count at the end of the data)
+ */
+uint32_t ImageRleDecode(image_rle_decoder_t *decoder, uint16_t *pixels, uint32_t count);
+
+/**
+ * @brief  		Compress an image
+ * @param[in]  	pixels: RGB565 colors, or palette indexes if palette_size is not 0
+ * @param[in]  	count: Number of pixels
+ * @param[in]  	palette_size: Colors of the palette (0: RGB565 image)
+ * @param[out] 	data: Compressed data
+ * @param[in]  	size: Size of data in bytes (3 * count is always enough)
+ * @retval 		Bytes of compressed data, 0 if they do not fit in data or the palette is too big
+ */
+uint32_t ImageRleEncode(const uint16_t *pixels, uint32_t count, uint8_t palette_size, uint8_t *data, uint32_t size);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* IMAGE_RLE_H_ */
+
+/*==================[end of file]============================================*/
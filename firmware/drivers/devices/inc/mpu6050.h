@@ -17,6 +17,8 @@
  * |   Date	| Description                                    			|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         		|
+ * | 17/10/2026 | FIFO burst-read streaming		                         		|
+ * | 17/10/2026 | Blocks dropped by a full queue counted	               		|
  * 
  **/
 
@@ -409,7 +411,33 @@
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
 // note: DMP code memory blocks defined at end of header file
 
+#define MPU6050_FIFO_SIZE           1024    // FIFO size in bytes
+#define MPU6050_FIFO_FRAME_SIZE     12      // Accel XYZ + gyro XYZ (16 bits each) per sample in FIFO
+#define MPU6050_BLOCK_SIZE          32      // Samples per streaming block
+#define MPU6050_BLOCK_QTY           4       // Blocks queued for the consumer
+#define MPU6050_MIN_SAMPLE_RATE     4       // Minimun sample rate (Hz): sample rate divider is 8 bits
+#define MPU6050_MAX_SAMPLE_RATE     1000    // Maximun sample rate (Hz) with DLPF enabled
+
 /*==================[typedef]================================================*/
+/**
+ * @brief Streaming configuration
+ */
+typedef struct {
+	gpio_t int_pin;			/*!< GPIO connected to MPU6050 INT pin (data ready interruption) */
+	uint16_t sample_rate;	/*!< Sample rate in Hz (MPU6050_MIN_SAMPLE_RATE to MPU6050_MAX_SAMPLE_RATE, rounded to 1000 / n) */
+	void *func_p;			/*!< Function to be called after each new block queued (NULL if not used) */
+	void *param_p;			/*!< Parameter passed to func_p */
+} mpu6050_stream_t;
+
+/**
+ * @brief Block of samples read from FIFO (raw values, see MPU6050_scaleBlock())
+ */
+typedef struct {
+	int64_t timestamp;							/*!< Time of last sample (usec, esp_timer_get_time() base) */
+	uint32_t sequence;							/*!< Block number (a gap means lost blocks) */
+	int16_t accel[MPU6050_BLOCK_SIZE][3];		/*!< Accelerometer X, Y, Z */
+	int16_t gyro[MPU6050_BLOCK_SIZE][3];		/*!< Gyroscope X, Y, Z */
+} mpu6050_block_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -2658,6 +2686,58 @@ void MPU6050_getFIFOBytes(uint8_t *data, uint8_t length);
  */
 uint8_t MPU6050_getDeviceID();
 
+// FIFO streaming
+/** Start FIFO streaming of accelerometer and gyroscope.
+ * Configures sample rate divider, DLPF, FIFO and data ready interruption. A
+ * task drains the FIFO in bursts (one I2C transaction for a whole block) and
+ * queues blocks of MPU6050_BLOCK_SIZE samples. The sample rate is the 1kHz
+ * gyroscope output rate divided by an integer: 300 Hz runs at 333 Hz.
+ * @param config Streaming configuration
+ * @return true if streaming started (false if already streaming or sample rate out of range)
+ */
+bool MPU6050_startStreaming(const mpu6050_stream_t *config);
+
+/** Stop FIFO streaming.
+ * Data ready interruption is disabled first, then waits for the streaming task
+ * to finish the block it is reading.
+ */
+void MPU6050_stopStreaming();
+
+/** Read a block of samples.
+ * @param block Where block will be copied
+ * @param timeout_ms Maximun time to wait for a block (0: don't wait)
+ * @return true if a block was read
+ */
+bool MPU6050_readBlock(mpu6050_block_t *block, uint32_t timeout_ms);
+
+/** Get number of FIFO overflows (samples lost) since streaming started.
+ * @return FIFO overflows
+ */
+uint32_t MPU6050_getStreamOverflows();
+
+/** Get number of blocks dropped since streaming started.
+ * A block is dropped when the queue is full (MPU6050_BLOCK_QTY blocks not read),
+ * func_p is not called for it and its sequence number is skipped.
+ * @return Blocks dropped
+ */
+uint32_t MPU6050_getStreamDroppedBlocks();
+
+/** Parse accel and gyro samples from FIFO data.
+ * @param data FIFO bytes (accel XYZ, gyro XYZ per frame, big endian)
+ * @param length Number of bytes (incomplete frames are ignored)
+ * @param accel Array where accelerometer samples will be stored
+ * @param gyro Array where gyroscope samples will be stored
+ * @return Number of samples parsed
+ */
+uint16_t MPU6050_parseFIFO(const uint8_t *data, uint16_t length, int16_t (*accel)[3], int16_t (*gyro)[3]);
+
+/** Convert a block to physical units, using full scale ranges set when streaming started.
+ * @param block Block of raw samples
+ * @param accel_g Array of MPU6050_BLOCK_SIZE accelerations in g
+ * @param gyro_dps Array of MPU6050_BLOCK_SIZE angular rates in degrees/sec
+ */
+void MPU6050_scaleBlock(const mpu6050_block_t *block, float (*accel_g)[3], float (*gyro_dps)[3]);
+
 /** Set Device ID.
  * Write a new ID into the WHO_AM_I register (no idea why this should ever be
  * necessary though).
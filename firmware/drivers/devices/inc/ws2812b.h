@@ -19,11 +19,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 17/10/2026 | Hardware-timed (RMT) double-buffered frames							|
+ * | 17/10/2026 | RMT initialization errors release the resources, frame status			|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include "sdkconfig.h"
 #include "esp_err.h"
 #include "gpio_mcu.h"
@@ -63,6 +66,53 @@ void ws2812bSend(rgb_led_t led_color);
  */
 void ws2812bSendRet(void);
 
+/**
+ * @brief Hardware-timed NeoPixel stripe initialization.
+ * 
+ * @note Bit timing is generated by the RMT peripheral, so it is not affected by interrupts.
+ * Two frame buffers are allocated, so the next frame can be encoded while the current one 
+ * is being transmitted. Use it instead of ws2812bInit().
+ * 
+ * @param pin GPIO number where NeoPixel data pin (DIN) will be connected
+ * @param len Number of NeoPixels in the stripe
+ * @return true when success, false if the RMT channel or the buffers could not be allocated
+ * (everything allocated is released)
+ */
+bool ws2812bInitRmt(gpio_t pin, uint16_t len);
+
+/**
+ * @brief Gamma correction of a color component, as seen by the eye.
+ * 
+ * @param component Color component (0 to 255)
+ * @return uint8_t Level sent to the NeoPixel
+ */
+uint8_t ws2812bGammaCorrection(uint8_t component);
+
+/**
+ * @brief Set the brightness applied (together with gamma correction) to the next frames.
+ * 
+ * @param bright Brightness level (0 to 255)
+ */
+void ws2812bSetBrightness(uint8_t bright);
+
+/**
+ * @brief Encode a whole stripe frame and start its transmission (hardware-timed).
+ * 
+ * @note Returns as soon as the frame is encoded. It only waits if two frames are 
+ * already pending transmission.
+ * 
+ * @param colors Array of stripe length with 24 bits colors (0x00RRGGBB). NULL turns all NeoPixels off.
+ * @return true if the frame transmission started, false if it could not be started
+ * (or ws2812bInitRmt() was not successful)
+ */
+bool ws2812bSendFrame(const uint32_t *colors);
+
+/**
+ * @brief Wait until all frames have been transmitted.
+ * 
+ */
+void ws2812bWaitFrame(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -12,17 +12,78 @@
 /*==================[inclusions]=============================================*/
 #include "hc_sr04.h"
 #include "delay_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define MAX_US		17700	/* maximun distance time in us (300cm or 118inch) */
 #define MAX_CM		300		/* maximun distance time in cm */
-#define MAX_INCH	118		/* maximun distance time in inch */
 #define US2CM		59		/* scale factor to conver pulse width to cm */
-#define US2INCH		150		/* scale factor to conver pulse width to inch */
 #define WAIT_MAX	5900	/* maximun time to wait for echo signal */
+#define TRIGGER_US	10		/* trigger pulse width */
+#define ECHO_TIMEOUT_MS	40	/* maximun time from trigger to falling edge of echo (sensor gives up at ~38ms) */
+#define CYCLE_MS	60		/* minimun measurement cycle recommended by the manufacturer */
+#define RANGING_TASK_STACK		2048
+#define RANGING_TASK_PRIORITY	5
 /*==================[internal data declaration]==============================*/
 static gpio_t echo_st, trigger_st; /**<  Stores the pin inicilization*/
+static SemaphoreHandle_t echo_done = NULL;		/**< Given by the echo ISR at the falling edge */
+static bool echo_int = false;					/**< Echo interruption enabled on echo_st */
+static volatile int64_t echo_rise_us = 0;		/**< Timestamp of echo rising edge */
+static volatile int64_t pulse_rise_us = 0;		/**< Timestamps of the edges of the last echo pulse */
+static volatile int64_t pulse_fall_us = 0;
+static TaskHandle_t ranging_task_handle = NULL;
+static volatile bool ranging = false;
+static hc_sr04_median_t median;					/**< Last distances of continuous ranging */
+static volatile uint16_t filtered_mm = 0;		/**< Last median filtered distance (mm) */
+static void *ranging_func_p = NULL;
+static void *ranging_param_p = NULL;
 /*==================[internal functions declaration]=========================*/
+static void IRAM_ATTR HcSr04EchoIsr(void *arg){
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	int64_t now = esp_timer_get_time();
+	if(GPIORead(echo_st)){
+		echo_rise_us = now;
+	}else if(echo_rise_us != 0){
+		pulse_rise_us = echo_rise_us;
+		pulse_fall_us = now;
+		echo_rise_us = 0;
+		xSemaphoreGiveFromISR(echo_done, &xHigherPriorityTaskWoken);
+	}
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/**
+ * @brief Trigger a measurement and wait (not busy) for the echo.
+ * 
+ * @return uint16_t distance in mm, 0 if there was no echo
+ */
+static uint16_t HcSr04Measure(void){
+	/* Discard an echo that arrived after a previous timeout */
+	xSemaphoreTake(echo_done, 0);
+	echo_rise_us = 0;
+	GPIOOn(trigger_st);
+	DelayUs(TRIGGER_US);
+	GPIOOff(trigger_st);
+	if(xSemaphoreTake(echo_done, pdMS_TO_TICKS(ECHO_TIMEOUT_MS) + 1) != pdTRUE){
+		return 0;
+	}
+	return HcSr04EdgesToMillimeters(pulse_rise_us, pulse_fall_us);
+}
 
+static void HcSr04RangingTask(void *pvParameter){
+	TickType_t last_wake = xTaskGetTickCount();
+	while(ranging){
+		filtered_mm = HcSr04MedianAdd(&median, HcSr04Measure());
+		if(ranging_func_p != NULL){
+			((void (*)(void *))ranging_func_p)(ranging_param_p);
+		}
+		vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(CYCLE_MS) + 1);
+	}
+	ranging_task_handle = NULL;
+	vTaskDelete(NULL);
+}
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
@@ -32,6 +93,13 @@ static gpio_t echo_st, trigger_st; /**<  Stores the pin inicilization*/
 /*==================[external functions definition]==========================*/
 
 bool HcSr04Init(gpio_t echo, gpio_t trigger){
+	if(echo_done == NULL){
+		echo_done = xSemaphoreCreateBinary();
+	}
+	/** Echo pin may change from a previous initialization */
+	if(echo_int){
+		GPIODeactivInt(echo_st);
+	}
 	echo_st = echo;
 	trigger_st = trigger;
 
@@ -39,54 +107,126 @@ bool HcSr04Init(gpio_t echo, gpio_t trigger){
 	GPIOInit(echo, GPIO_INPUT);
 	GPIOInit(trigger, GPIO_OUTPUT);
 
+	/** Echo edges are timestamped by interruption */
+	GPIOActivIntBothEdges(echo, HcSr04EchoIsr, NULL);
+	echo_int = true;
+
 	return true;
 }
 
-uint16_t HcSr04ReadDistanceInCentimeters(void){
-	uint16_t distance = 0, waiting = 0;
-	GPIOOn(trigger_st);
-	DelayUs(10);
-	GPIOOff(trigger_st);
-	while(!GPIORead(echo_st)){
-		DelayUs(10);
-		waiting += 10;
-		if(waiting > WAIT_MAX){
-			return 0;
+uint32_t HcSr04EchoWidth(int64_t rise_us, int64_t fall_us){
+	if(fall_us <= rise_us){
+		return 0;
+	}
+	return (uint32_t)(fall_us - rise_us);
+}
+
+uint16_t HcSr04EchoToMillimeters(uint32_t width_us){
+	if(width_us > MAX_US){
+		return MAX_CM * 10;
+	}
+	return (width_us * 10 + US2CM / 2) / US2CM;
+}
+
+uint16_t HcSr04EdgesToMillimeters(int64_t rise_us, int64_t fall_us){
+	return HcSr04EchoToMillimeters(HcSr04EchoWidth(rise_us, fall_us));
+}
+
+uint16_t HcSr04Median(uint16_t *samples, uint8_t len){
+	uint8_t i, j;
+	uint16_t aux;
+	if(len == 0){
+		return 0;
+	}
+	/* Insertion sort: len is small */
+	for(i=1; i<len; i++){
+		aux = samples[i];
+		for(j=i; (j>0) && (samples[j-1] > aux); j--){
+			samples[j] = samples[j-1];
 		}
+		samples[j] = aux;
+	}
+	return samples[len/2];
+}
+
+void HcSr04MedianInit(hc_sr04_median_t *filter, uint8_t len){
+	if(len == 0){
+		len = 1;
 	}
-	do{
-		DelayUs(10);
-		distance += 10;
-		if(distance > MAX_US)
-			return MAX_CM;
+	if(len > HC_SR04_MEDIAN_MAX){
+		len = HC_SR04_MEDIAN_MAX;
 	}
-	while(GPIORead(echo_st));
-	return (distance/US2CM);
+	filter->len = len;
+	filter->count = 0;
+	filter->index = 0;
+}
+
+uint16_t HcSr04MedianAdd(hc_sr04_median_t *filter, uint16_t distance_mm){
+	uint8_t i;
+	uint16_t window[HC_SR04_MEDIAN_MAX];
+	filter->samples[filter->index] = distance_mm;
+	filter->index = (filter->index + 1) % filter->len;
+	if(filter->count < filter->len){
+		filter->count++;
+	}
+	/* Only the distances measured: the window fills during the first measurements */
+	for(i=0; i<filter->count; i++){
+		window[i] = filter->samples[i];
+	}
+	return HcSr04Median(window, filter->count);
+}
+
+uint16_t HcSr04ReadDistanceInCentimeters(void){
+	if(ranging){
+		return filtered_mm / 10;
+	}
+	return HcSr04Measure() / 10;
 }
 
 uint16_t HcSr04ReadDistanceInInches(void){
-	uint16_t distance = 0, waiting = 0;
-	GPIOOn(trigger_st);
-	DelayUs(10);
-	GPIOOff(trigger_st);
-	while(!GPIORead(echo_st)){
-		DelayUs(10);
-		waiting += 10;
-		if(waiting > WAIT_MAX){
-			return 0;
-		}
+	if(ranging){
+		return filtered_mm * 10 / 254;
 	}
-	do{
-		DelayUs(10);
-		distance += 10;
-		if(distance > MAX_US)
-			return MAX_INCH;
+	return HcSr04Measure() * 10 / 254;
+}
+
+bool HcSr04StartRanging(uint8_t median_len, void *func_p, void *param_p){
+	if(ranging || !echo_int){
+		return false;
 	}
-	while(GPIORead(echo_st));
-	return (distance/US2INCH);
+	HcSr04MedianInit(&median, median_len);
+	filtered_mm = 0;
+	ranging_func_p = func_p;
+	ranging_param_p = param_p;
+	ranging = true;
+	if(xTaskCreate(&HcSr04RangingTask, "HC-SR04", RANGING_TASK_STACK, NULL, RANGING_TASK_PRIORITY, &ranging_task_handle) != pdPASS){
+		ranging = false;
+		return false;
+	}
+	return true;
+}
+
+void HcSr04StopRanging(void){
+	ranging = false;
+	/* Wait for the current measurement to finish */
+	while(ranging_task_handle != NULL){
+		vTaskDelay(1);
+	}
+}
+
+uint16_t HcSr04ReadDistanceInMillimeters(void){
+	if(ranging){
+		return filtered_mm;
+	}
+	return HcSr04Measure();
 }
 
 bool HcSr04Deinit(void){
+	HcSr04StopRanging();
+	if(echo_int){
+		GPIODeactivInt(echo_st);
+		echo_int = false;
+	}
 	GPIODeinit();
 	return true;
 }
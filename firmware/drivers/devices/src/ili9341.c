@@ -11,22 +11,36 @@
 
 /*==================[inclusions]=============================================*/
 #include "ili9341.h"
+#include <string.h>
+#include "esp_heap_caps.h"
 #include "fonts.h"
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
 /*==================[macros and definitions]=================================*/
+#undef NULL
 #define NULL 0
 
 #define SPI_BR 20000000				/*!< Frequency of sck for SPI communication */
 #define MAX_PIXEL 320*240*2			/*!< Maximum number of bytes to write on LCD */
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
-#define MSK_BIT8 0x80				/*!< 8th bit mask */
-#define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
 #define UP -1						/*!< Vertical grow direction */
+#define MADCTL_MY 0x80				/*!< Memory access control: row address order */
+#define MADCTL_MX 0x40				/*!< Memory access control: column address order */
+#define MADCTL_MV 0x20				/*!< Memory access control: row/column exchange */
+#define FB_MAX_DIRTY 8				/*!< Maximum number of dirty rectangles tracked in framebuffer mode */
+#define FB_FLUSH_BUFFER_SIZE 4096	/*!< Staging buffer size (bytes) used to flush rectangles narrower than the LCD */
+#define FB_MERGE_MARGIN 8			/*!< Dirty rectangles closer than this (in pixels) are merged into one */
+#define RUN_BUFFER_SIZE (2 * ILI9341_HEIGHT)	/*!< Bytes of color sent per transfer when drawing a run (a whole row in landscape) */
+#define STREAM_BUFFER_SIZE 2048		/*!< Size (bytes) of each of the two buffers used to send text and image rows */
+#define GLYPH_CACHE_SLOTS 16		/*!< Pre-rendered glyphs kept in the glyph cache */
+#define GLYPH_CACHE_SLOT_SIZE 1024	/*!< Bytes per cached glyph (fonts up to 30 pixels height fit) */
+#define FIRST_CHAR ' '				/*!< First character of the fonts */
+#define LAST_CHAR '~'				/*!< Last character of the fonts */
+#define CHART_MARGIN 8				/*!< Autoscale leaves 1/CHART_MARGIN of the range over and under the values */
 
 /* Command List */
 #define RESET				0x01 	/*!< Resets the commands and parameters to their S/W Reset default values */
@@ -40,7 +54,9 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VERT_SCROLL_DEF		0x33 	/*!< Define the vertical scrolling area of the display */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
+#define VERT_SCROLL_ADDR	0x37 	/*!< Frame memory line shown at the top of the vertical scrolling area */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
 #define WRITE_CTRL_DISP		0x53 	/*!< Control display brightness */
@@ -64,6 +80,7 @@
 
 #define HighByte(x) x >> 8			/*!< High byte of a 16 bits data */
 #define LowByte(x) x & 0xFF			/*!< Low byte of a 16 bits data */
+#define SwapBytes(x) (uint16_t)(((x) >> 8) | ((x) << 8))	/*!< RGB565 color in LCD (big endian) byte order */
 /*==================[typedef]================================================*/
 /**
  * @brief  Structure with LCD orientation properties
@@ -82,6 +99,42 @@ typedef struct {
     uint32_t databytes; 	/*!< Number of bytes of data to transmit */
     uint8_t *data;			/*!< Pointer to data or parameters array */
 } lcd_cmd_t;
+
+/**
+ * @brief Rectangular area of the LCD (inclusive coordinates)
+ */
+typedef struct {
+	uint16_t x0;			/*!< Start column */
+	uint16_t y0;			/*!< Start row */
+	uint16_t x1;			/*!< End column */
+	uint16_t y1;			/*!< End row */
+} rect_t;
+
+/**
+ * @brief Pre-rendered glyph of the glyph cache
+ */
+typedef struct {
+	const Font_t *font;		/*!< Font of the glyph (NULL if the slot is empty) */
+	char data;				/*!< Character */
+	uint16_t foreground;	/*!< Color for bits set to 1 (RGB565) */
+	uint16_t background;	/*!< Color for bits set to 0 (RGB565) */
+	uint32_t last_use;		/*!< Cache access count when last used */
+	uint16_t *pixels;		/*!< Glyph rows, width pixels each (LCD byte order) */
+} glyph_t;
+
+/**
+ * @brief State of a strip chart trace
+ */
+typedef struct {
+	int32_t min;			/*!< Value at the bottom of the chart */
+	int32_t max;			/*!< Value at the top of the chart */
+	int32_t last;			/*!< Last sample */
+	int32_t previous;		/*!< Last sample of the previous column */
+	int32_t column_min;		/*!< Lowest sample of the column being decimated */
+	int32_t column_max;		/*!< Highest sample of the column being decimated */
+	int32_t sweep_min;		/*!< Lowest sample of the last chart width (autoscale) */
+	int32_t sweep_max;		/*!< Highest sample of the last chart width (autoscale) */
+} chart_trace_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -93,6 +146,15 @@ typedef struct {
  */
 void WriteLCD(lcd_cmd_t * data);
 
+/**
+ * @brief  		Queue command and parameters/data to LCD without waiting for the transfer
+ * @note		Only commands and parameters of up to 4 bytes are copied by the SPI driver, 
+ * 				larger data buffers must remain valid until SpiWaitAll() returns
+ * @param[in]  	data: Structure with the command and parameters/data to send
+ * @retval 		None
+ */
+void QueueLCD(lcd_cmd_t * data);
+
 /**
  * @brief  		Define an area of frame memory where MCU can access
  * @param[in]  	x1: Start column
@@ -114,6 +176,209 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Start drawing runs of a determined color
+ * @param[in]	color: color of the runs
+ * @retval 		None
+ */
+void RunBegin(uint16_t color);
+
+/**
+ * @brief  		Draw a run (horizontal or vertical segment, or any rectangle) clipped to the LCD area
+ * @note		The run is one address window and one burst write, queued without waiting 
+ * 				for the transfer to finish. Only valid between RunBegin() and RunEnd().
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @retval 		None
+ */
+void RunDraw(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @brief  		Wait until all runs queued since RunBegin() are on the LCD
+ * @retval 		None
+ */
+void RunEnd(void);
+
+/**
+ * @brief  		Draw the runs of a circle between two points of its first octant
+ * @note		Points from (xa, y) to (xb, y) make horizontal runs in 4 octants and 
+ * 				vertical runs in the other 4
+ * @param[in]  	x0: X coordinate of center circle point
+ * @param[in]  	y0: Y coordinate of center circle point
+ * @param[in]  	xa: First X of the points (relative to center)
+ * @param[in]  	xb: Last X of the points (relative to center)
+ * @param[in]  	y: Y of the points (relative to center)
+ * @retval 		None
+ */
+void CircleRuns(int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t y);
+
+/**
+ * @brief  		Set the colors of the 1bpp expansion table
+ * @param[in]	foreground: Color for bits set to 1 (RGB565)
+ * @param[in]	background: Color for bits set to 0 (RGB565)
+ * @retval 		None
+ */
+void TextColors(uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Expand a row of a 1bpp bitmap, 4 pixels per table access
+ * @param[out] 	dst: Pixels (LCD byte order)
+ * @param[in]  	bits: Bitmap row, MSB first
+ * @param[in] 	width: Pixels to expand
+ * @retval 		None
+ */
+void ExpandRow(uint16_t *dst, const uint8_t *bits, uint16_t width);
+
+/**
+ * @brief  		Get a character pre-rendered with the colors of the expansion table
+ * @note		The least recently used glyph is replaced on a miss
+ * @param[in]  	font: Pointer to used font
+ * @param[in] 	data: Character
+ * @retval 		Glyph pixels (LCD byte order), NULL if it does not fit in the cache
+ */
+const uint16_t *GlyphCacheGet(Font_t *font, char data);
+
+/**
+ * @brief  		Width of a line of text
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	count: Number of characters
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	cell: Width of each character (0: character width and one pixel between characters)
+ * @retval 		Width in pixels
+ */
+uint16_t TextWidth(const char *str, uint16_t count, Font_t *font, uint8_t cell);
+
+/**
+ * @brief  		Render rows of a line of text
+ * @param[out] 	dst: First pixel of the first row (LCD byte order)
+ * @param[in]  	stride: Pixels from a row of dst to the next
+ * @param[in]  	row: First row of the text to render
+ * @param[in]  	rows: Number of rows
+ * @param[in]  	width: Pixels of each row to render (the text is clipped)
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	count: Number of characters
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	cell: Width of each character (0: character width and one pixel between characters)
+ * @retval 		None
+ */
+void TextRender(uint16_t *dst, uint16_t stride, uint16_t row, uint16_t rows, uint16_t width, 
+	const char *str, uint16_t count, Font_t *font, uint8_t cell);
+
+/**
+ * @brief  		Draw a line of text in a single LCD window
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	count: Number of characters ('\r' are skipped)
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for chars (RGB565)
+ * @param[in]  	background: Color for chars background (RGB565)
+ * @param[in]  	cell: Width of each character (0: character width and one pixel between characters)
+ * @retval 		None
+ */
+void TextLine(uint16_t x, uint16_t y, const char *str, uint16_t count, Font_t *font, 
+	uint16_t foreground, uint16_t background, uint8_t cell);
+
+/**
+ * @brief  		Decode a compressed image straight to the LCD (or the framebuffer)
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	image: Compressed image (up to STREAM_BUFFER_SIZE / 2 pixels width)
+ * @param[in]  	palette: Palette colors (RGB565) for palette images, NULL to use the image palette
+ * @retval 		None
+ */
+void ImageStream(uint16_t x, uint16_t y, const image_rle_t *image, const uint16_t *palette);
+
+/**
+ * @brief  		Set the vertical scrolling area and the line shown at its start
+ * @param[in]  	top: Lines of the top fixed area
+ * @param[in]  	lines: Lines of the scrolling area
+ * @param[in]  	start: Frame memory line shown at the start of the scrolling area
+ * @retval 		None
+ */
+void ScrollArea(uint16_t top, uint16_t lines, uint16_t start);
+
+/**
+ * @brief  		Row of the strip chart for a value of a trace
+ * @param[in]  	trace: Trace state
+ * @param[in]  	value: Sample value
+ * @retval 		Row (inside the chart)
+ */
+uint16_t ChartRow(chart_trace_t *trace, int32_t value);
+
+/**
+ * @brief  		Draw the decimated samples as a new column of the strip chart, and scroll it
+ * @retval 		None
+ */
+void ChartColumn(void);
+
+/**
+ * @brief  		Add an area to the framebuffer dirty list, merging it with an 
+ * 				existing one when they touch or when the list is full
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @retval 		None
+ */
+void FbMarkDirty(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @brief  		Fill an area of the framebuffer with a determined color
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void FbFill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Copy a RGB565 picture into the framebuffer
+ * @param[in] 	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in] 	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	pic: Pointer to first byte of picture
+ * @retval 		None
+ */
+void FbDrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
+
+/**
+ * @brief  		Position on the LCD panel of a pixel, for a memory access control
+ * @param[in]  	mem_acc: Memory access control (MY, MX and MV bits)
+ * @param[in]  	x: Column with that memory access control
+ * @param[in]  	y: Row with that memory access control
+ * @param[out] 	column: Panel column (0 to ILI9341_WIDTH - 1)
+ * @param[out] 	row: Panel row (0 to ILI9341_HEIGHT - 1)
+ * @retval 		None
+ */
+void PanelPosition(uint8_t mem_acc, uint16_t x, uint16_t y, uint16_t *column, uint16_t *row);
+
+/**
+ * @brief  		Pixel of a position of the LCD panel, for a memory access control (inverse of PanelPosition)
+ * @param[in]  	mem_acc: Memory access control (MY, MX and MV bits)
+ * @param[in]  	column: Panel column
+ * @param[in]  	row: Panel row
+ * @param[out] 	x: Column with that memory access control
+ * @param[out] 	y: Row with that memory access control
+ * @retval 		None
+ */
+void PanelPixel(uint8_t mem_acc, uint16_t column, uint16_t row, uint16_t *x, uint16_t *y);
+
+/**
+ * @brief  		Move the framebuffer pixels and dirty rectangles to a new orientation, 
+ * 				so that each one keeps its place on the LCD panel
+ * @note		The pixels are moved in place, following the cycles of the permutation
+ * @param[in]  	old_mem_acc: Memory access control of the framebuffer layout
+ * @param[in]  	new_mem_acc: Memory access control of the new layout
+ * @retval 		None
+ */
+void FbRelayout(uint8_t old_mem_acc, uint8_t new_mem_acc);
+
 /*==================[internal data definition]===============================*/
 /**
  * @brief Initial LCD configuration parameters
@@ -174,7 +439,7 @@ lcd_cmd_t lcd_on = {DISPLAY_ON, NULL, NULL};		/*!< Exit sleep mode */
 /*
  * @brief: SPI port configuration compatible with LCD interface
  */
-spi_mcu_config_t spi_conf = {
+static spi_mcu_config_t spi_conf = {
 	.device = NULL, 
 	.clk_mode = MODE0, 
 	.bitrate = SPI_BR, 
@@ -191,26 +456,58 @@ static orientation_properties_t lcd_orientation = {
 		ILI9341_Portrait_1
 };	/*!< Default orientation configuration */
 
+static uint8_t lcd_mem_acc = 0x48;				/*!< Memory access control of the orientation */
+static uint16_t *framebuffer = NULL;			/*!< Off-screen RGB565 buffer in LCD byte order (NULL when framebuffer mode is disabled) */
+static uint8_t *fb_moved;						/*!< A bit per framebuffer pixel, for FbRelayout (after the pixels) */
+static rect_t dirty_rect[FB_MAX_DIRTY];			/*!< Areas of the framebuffer modified since last flush */
+static uint8_t dirty_count = 0;					/*!< Number of valid entries in dirty_rect */
+static uint8_t flush_buffer[FB_FLUSH_BUFFER_SIZE];	/*!< Staging buffer to group partial rows in a single transfer */
+
+static rect_t lcd_window = {1, 1, 0, 0};		/*!< Address window last sent to the LCD (none at start) */
+static uint8_t run_pixel[RUN_BUFFER_SIZE];		/*!< Color of the runs being drawn, repeated (LCD byte order) */
+static uint16_t run_color;						/*!< Color of the runs being drawn (RGB565) */
+
+static uint16_t text_lut[16][4];				/*!< 4 bits of a 1bpp bitmap to 4 pixels (LCD byte order) */
+static uint16_t text_foreground, text_background;	/*!< Colors of text_lut (RGB565) */
+static uint8_t text_lut_valid = false;			/*!< text_lut has been built */
+static uint16_t stream_buffer[2][STREAM_BUFFER_SIZE / 2];	/*!< Text and image rows: one is filled while the other is sent */
+static glyph_t glyph_cache[GLYPH_CACHE_SLOTS];	/*!< Pre-rendered glyphs */
+static uint16_t *glyph_pool = NULL;				/*!< Pixels of the cached glyphs (allocated on first use) */
+static uint32_t glyph_use_count = 0;			/*!< Cache accesses, to find the least recently used glyph */
+
+static ili9341_chart_config_t chart;			/*!< Strip chart configuration (chart.width = 0: no chart) */
+static chart_trace_t chart_trace[ILI9341_CHART_MAX_TRACES];	/*!< Strip chart traces */
+static uint16_t chart_template[ILI9341_WIDTH];	/*!< Empty chart column: background and grid (LCD byte order) */
+static uint16_t chart_buffer[2][ILI9341_WIDTH];	/*!< Chart columns: one is filled while the other is sent */
+static uint8_t chart_next = 0;					/*!< Chart buffer of the next column */
+static uint16_t chart_top;						/*!< Top fixed area lines, the scrolling area is the chart */
+static uint16_t chart_start;					/*!< Frame memory line shown at the start of the scrolling area */
+static uint32_t chart_phase;					/*!< Decimation accumulator: column_rate added per sample */
+static uint32_t chart_columns;					/*!< Columns drawn */
+
 /*==================[internal functions definition]==========================*/
 
 void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
+	QueueLCD(data);
+	/* Callers reuse their buffers as soon as this returns */
+	SpiWaitAll(ili9341_spi);
+}
+
+void QueueLCD(lcd_cmd_t * data){
 	/* If command is NULL don't send command */
 	if (data->cmd != NULL){
-		/* Send command */
-		GPIOOff(ili9341_dc);
-		SpiWrite(ili9341_spi, &data->cmd, 1);
+		/* Send command (DC pin is set low by the SPI driver) */
+		SpiQueueWrite(ili9341_spi, &data->cmd, 1, SPI_DC_COMMAND);
 	}
 	/* If there are parameters or data to send */
 	if (data->databytes != NULL){
-		/* Send parameters or data */
-		GPIOOn(ili9341_dc);
-		SpiWrite(ili9341_spi, data->data, data->databytes);
+		/* Send parameters or data (DC pin is set high by the SPI driver) */
+		SpiQueueWrite(ili9341_spi, data->data, data->databytes, SPI_DC_DATA);
 	}
 }
 
 void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
-	static uint16_t aux;
+	uint16_t aux;
 	/* The lower column must be send first */
 	if (x0 > x1){
 		aux = x0;
@@ -227,44 +524,630 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
 	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
 	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
-	WriteLCD(&lcd_columns);
-	WriteLCD(&lcd_rows);
+	/* 4 bytes parameters are copied by the SPI driver: the window goes out with the next write.
+	   Columns or rows already set (e.g. runs in the same row) are not sent again */
+	if ((x0 != lcd_window.x0) || (x1 != lcd_window.x1)){
+		QueueLCD(&lcd_columns);
+		lcd_window.x0 = x0;
+		lcd_window.x1 = x1;
+	}
+	if ((y0 != lcd_window.y0) || (y1 != lcd_window.y1)){
+		QueueLCD(&lcd_rows);
+		lcd_window.y0 = y0;
+		lcd_window.y1 = y1;
+	}
 }
 
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	static uint16_t i;
-	static int32_t bytes_count;
-	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	RunBegin(color);
+	RunDraw(x0, y0, x1, y1);
+	RunEnd();
+}
 
-	x_dist = x1 - x0;
-	y_dist = y1 - y0;
+void RunBegin(uint16_t color){
+	uint16_t i;
+
+	run_color = color;
+	if (framebuffer != NULL){
+		return;
+	}
+	/* The previous primitive has already waited for its transfers: the buffer can be reused */
+	for (i = 0; i < RUN_BUFFER_SIZE; i += 2){
+		run_pixel[i] = HighByte(color);
+		run_pixel[i + 1] = LowByte(color);
+	}
+}
+
+void RunDraw(int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	int16_t aux;
+	uint32_t bytes_count, chunk;
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+
+	/* Sort corners and clip to LCD area */
 	if (x0 > x1){
-		x_dist = - x_dist;
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
 	}
 	if (y0 > y1){
-		y_dist = - y_dist;
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	if ((x1 < 0) || (y1 < 0) || (x0 >= lcd_orientation.width) || (y0 >= lcd_orientation.height)){
+		return;
+	}
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (y0 < 0){
+		y0 = 0;
+	}
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
+	}
+	if (framebuffer != NULL){
+		FbFill(x0, y0, x1, y1, run_color);
+		return;
 	}
-	/* Number of bytes to write. We have to write 2 bytes/pixel (16bits color) */
-	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
-	/* Define area to fill */
 	SetCursorPosition(x0, y0, x1, y1);
+	QueueLCD(&lcd_write);
+	/* Every transfer reads the same color buffer, so none of them has to be waited for */
+	bytes_count = (x1 - x0 + 1) * (y1 - y0 + 1) * 2;
+	while (bytes_count > 0){
+		chunk = (bytes_count > RUN_BUFFER_SIZE) ? RUN_BUFFER_SIZE : bytes_count;
+		SpiQueueWrite(ili9341_spi, run_pixel, chunk, SPI_DC_DATA);
+		bytes_count -= chunk;
+	}
+}
+
+void RunEnd(void){
+	if (framebuffer == NULL){
+		SpiWaitAll(ili9341_spi);
+	}
+}
+
+void CircleRuns(int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t y){
+	if (xa == 0){
+		/* Runs starting on an axis are joined with their mirror image */
+		RunDraw(x0 - xb, y0 + y, x0 + xb, y0 + y);
+		RunDraw(x0 - xb, y0 - y, x0 + xb, y0 - y);
+		RunDraw(x0 + y, y0 - xb, x0 + y, y0 + xb);
+		RunDraw(x0 - y, y0 - xb, x0 - y, y0 + xb);
+	}
+	else{
+		/* Each run shares its rows or its columns with the previous one, so they are not sent again */
+		RunDraw(x0 + xa, y0 + y, x0 + xb, y0 + y);
+		RunDraw(x0 - xb, y0 + y, x0 - xa, y0 + y);
+		RunDraw(x0 - xb, y0 - y, x0 - xa, y0 - y);
+		RunDraw(x0 + xa, y0 - y, x0 + xb, y0 - y);
+		RunDraw(x0 + y, y0 + xa, x0 + y, y0 + xb);
+		RunDraw(x0 + y, y0 - xb, x0 + y, y0 - xa);
+		RunDraw(x0 - y, y0 - xb, x0 - y, y0 - xa);
+		RunDraw(x0 - y, y0 + xa, x0 - y, y0 + xb);
+	}
+}
+
+void TextColors(uint16_t foreground, uint16_t background){
+	uint8_t i, j;
+
+	if (text_lut_valid && (foreground == text_foreground) && (background == text_background)){
+		return;
+	}
+	/* Cached glyphs are rendered with the table colors: entries of other colors are kept */
+	text_foreground = foreground;
+	text_background = background;
+	foreground = SwapBytes(foreground);
+	background = SwapBytes(background);
+	for (i = 0; i < 16; i++){
+		for (j = 0; j < 4; j++){
+			text_lut[i][j] = (i & (0x08 >> j)) ? foreground : background;
+		}
+	}
+	text_lut_valid = true;
+}
+
+void ExpandRow(uint16_t *dst, const uint8_t *bits, uint16_t width){
+	const uint16_t *pixels;
+
+	while (width >= 8){
+		memcpy(dst, text_lut[*bits >> 4], 4 * sizeof(uint16_t));
+		memcpy(dst + 4, text_lut[*bits & 0x0F], 4 * sizeof(uint16_t));
+		dst += 8;
+		bits++;
+		width -= 8;
+	}
+	if (width > 0){
+		pixels = text_lut[*bits >> 4];
+		memcpy(dst, pixels, ((width > 4) ? 4 : width) * sizeof(uint16_t));
+		if (width > 4){
+			memcpy(dst + 4, text_lut[*bits & 0x0F], (width - 4) * sizeof(uint16_t));
+		}
+	}
+}
+
+const uint16_t *GlyphCacheGet(Font_t *font, char data){
+	uint8_t i, lru = 0;
+	glyph_t *glyph;
+	const char_info_t *info = &font->info[data - FIRST_CHAR];
+	uint16_t row, row_bytes = (info->width + 7) / 8;
+
+	if (info->width * font->font_height * sizeof(uint16_t) > GLYPH_CACHE_SLOT_SIZE){
+		return NULL;
+	}
+	if (glyph_pool == NULL){
+		glyph_pool = heap_caps_malloc(GLYPH_CACHE_SLOTS * GLYPH_CACHE_SLOT_SIZE, MALLOC_CAP_8BIT);
+		if (glyph_pool == NULL){
+			return NULL;
+		}
+		for (i = 0; i < GLYPH_CACHE_SLOTS; i++){
+			glyph_cache[i].font = NULL;
+			glyph_cache[i].pixels = &glyph_pool[i * GLYPH_CACHE_SLOT_SIZE / sizeof(uint16_t)];
+		}
+	}
+	glyph_use_count++;
+	for (i = 0; i < GLYPH_CACHE_SLOTS; i++){
+		glyph = &glyph_cache[i];
+		if ((glyph->font == font) && (glyph->data == data) && 
+			(glyph->foreground == text_foreground) && (glyph->background == text_background)){
+			glyph->last_use = glyph_use_count;
+			return glyph->pixels;
+		}
+		if ((glyph->font == NULL) || (glyph->last_use < glyph_cache[lru].last_use)){
+			lru = i;
+			if (glyph->font == NULL){
+				break;
+			}
+		}
+	}
+	/* Miss: render the glyph over the least recently used one */
+	glyph = &glyph_cache[lru];
+	glyph->font = font;
+	glyph->data = data;
+	glyph->foreground = text_foreground;
+	glyph->background = text_background;
+	glyph->last_use = glyph_use_count;
+	for (row = 0; row < font->font_height; row++){
+		ExpandRow(&glyph->pixels[row * info->width], &font->data[info->offset + row * row_bytes], info->width);
+	}
+	return glyph->pixels;
+}
+
+uint16_t TextWidth(const char *str, uint16_t count, Font_t *font, uint8_t cell){
+	uint16_t i, width = 0;
+	char data;
+
+	for (i = 0; i < count; i++){
+		data = str[i];
+		if (data == '\r'){
+			continue;
+		}
+		if ((data < FIRST_CHAR) || (data > LAST_CHAR)){
+			data = FIRST_CHAR;
+		}
+		width += (cell != 0) ? cell : font->info[data - FIRST_CHAR].width + 1;
+	}
+	/* No space after the last character */
+	if ((cell == 0) && (width > 0)){
+		width--;
+	}
+	return width;
+}
+
+void TextRender(uint16_t *dst, uint16_t stride, uint16_t row, uint16_t rows, uint16_t width, 
+	const char *str, uint16_t count, Font_t *font, uint8_t cell){
+	uint16_t i, j, r, col, pixels, advance, row_bytes, background;
+	const uint16_t *glyph;
+	const char_info_t *info;
+	char data;
+
+	background = SwapBytes(text_background);
+	col = 0;
+	for (i = 0; (i < count) && (col < width); i++){
+		data = str[i];
+		if (data == '\r'){
+			continue;
+		}
+		if ((data < FIRST_CHAR) || (data > LAST_CHAR)){
+			data = FIRST_CHAR;
+		}
+		info = &font->info[data - FIRST_CHAR];
+		advance = (cell != 0) ? cell : info->width + 1;
+		/* Glyph columns, clipped to the cell and to the window */
+		pixels = (info->width < advance) ? info->width : advance;
+		if (pixels > width - col){
+			pixels = width - col;
+		}
+		glyph = GlyphCacheGet(font, data);
+		if (glyph != NULL){
+			for (r = 0; r < rows; r++){
+				memcpy(&dst[r * stride + col], &glyph[(row + r) * info->width], pixels * sizeof(uint16_t));
+			}
+		}
+		else{
+			row_bytes = (info->width + 7) / 8;
+			for (r = 0; r < rows; r++){
+				ExpandRow(&dst[r * stride + col], &font->data[info->offset + (row + r) * row_bytes], pixels);
+			}
+		}
+		col += pixels;
+		/* Background up to the next character */
+		pixels = advance - pixels;
+		if (pixels > width - col){
+			pixels = width - col;
+		}
+		for (r = 0; r < rows; r++){
+			for (j = 0; j < pixels; j++){
+				dst[r * stride + col + j] = background;
+			}
+		}
+		col += pixels;
+	}
+}
+
+void TextLine(uint16_t x, uint16_t y, const char *str, uint16_t count, Font_t *font, 
+	uint16_t foreground, uint16_t background, uint8_t cell){
+	uint16_t width, height, row, rows, batch;
+	uint8_t buffer = 0;
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+
+	width = TextWidth(str, count, font, cell);
+	if ((width == 0) || (x >= lcd_orientation.width) || (y >= lcd_orientation.height)){
+		return;
+	}
+	/* Bounding box of the line, clipped to LCD area */
+	if (width > lcd_orientation.width - x){
+		width = lcd_orientation.width - x;
+	}
+	height = font->font_height;
+	if (height > lcd_orientation.height - y){
+		height = lcd_orientation.height - y;
+	}
+	TextColors(foreground, background);
+
+	if (framebuffer != NULL){
+		TextRender(&framebuffer[y * lcd_orientation.width + x], lcd_orientation.width, 0, height, width, str, count, font, cell);
+		FbMarkDirty(x, y, x + width - 1, y + height - 1);
+		return;
+	}
+
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	QueueLCD(&lcd_write);
+	batch = (STREAM_BUFFER_SIZE / 2) / width;
+	for (row = 0; row < height; row += rows){
+		rows = (height - row < batch) ? height - row : batch;
+		TextRender(stream_buffer[buffer], width, row, rows, width, str, count, font, cell);
+		/* The other buffer is still being sent: wait for it before queueing this one, 
+		   the next batch is rendered in the buffer just released */
+		if (row > 0){
+			SpiWaitAll(ili9341_spi);
+		}
+		SpiQueueWrite(ili9341_spi, (uint8_t *)stream_buffer[buffer], rows * width * sizeof(uint16_t), SPI_DC_DATA);
+		buffer ^= 1;
+	}
+	SpiWaitAll(ili9341_spi);
+}
+
+void ImageStream(uint16_t x, uint16_t y, const image_rle_t *image, const uint16_t *palette){
+	image_rle_decoder_t decoder;
+	uint16_t width, height, row, rows, batch;
+	uint8_t buffer = 0;
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
+	batch = (STREAM_BUFFER_SIZE / 2) / image->width;
+	if ((batch == 0) || (x >= lcd_orientation.width) || (y >= lcd_orientation.height)){
+		return;
 	}
-	/* Start writing LCD memory */
+	/* Clip to LCD area */
+	width = (x + image->width > lcd_orientation.width) ? lcd_orientation.width - x : image->width;
+	height = (y + image->height > lcd_orientation.height) ? lcd_orientation.height - y : image->height;
+	ImageRleDecoderInit(&decoder, image, palette);
+
+	if (framebuffer != NULL){
+		for (row = 0; row < height; row++){
+			if (width == image->width){
+				ImageRleDecode(&decoder, &framebuffer[(y + row) * lcd_orientation.width + x], width);
+			}
+			else{
+				ImageRleDecode(&decoder, stream_buffer[0], image->width);
+				memcpy(&framebuffer[(y + row) * lcd_orientation.width + x], stream_buffer[0], width * sizeof(uint16_t));
+			}
+		}
+		FbMarkDirty(x, y, x + width - 1, y + height - 1);
+		return;
+	}
+
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	QueueLCD(&lcd_write);
+	for (row = 0; row < height; row += rows){
+		rows = (height - row < batch) ? height - row : batch;
+		if (width == image->width){
+			ImageRleDecode(&decoder, stream_buffer[buffer], rows * width);
+		}
+		else{
+			/* Whole image rows, the clipped part of each row is overwritten by the next one */
+			for (uint16_t r = 0; r < rows; r++){
+				ImageRleDecode(&decoder, &stream_buffer[buffer][r * width], image->width);
+			}
+		}
+		/* The other buffer is still being sent: wait for it before queueing this one */
+		if (row > 0){
+			SpiWaitAll(ili9341_spi);
+		}
+		SpiQueueWrite(ili9341_spi, (uint8_t *)stream_buffer[buffer], rows * width * sizeof(uint16_t), SPI_DC_DATA);
+		buffer ^= 1;
+	}
+	SpiWaitAll(ili9341_spi);
+}
+
+void ScrollArea(uint16_t top, uint16_t lines, uint16_t start){
+	uint16_t bottom = ILI9341_HEIGHT - top - lines;
+	uint8_t area[] = {HighByte(top), LowByte(top), HighByte(lines), LowByte(lines), HighByte(bottom), LowByte(bottom)};
+	lcd_cmd_t lcd_area = {VERT_SCROLL_DEF, 6, area};
+	uint8_t line[] = {HighByte(start), LowByte(start)};
+	lcd_cmd_t lcd_start = {VERT_SCROLL_ADDR, 2, line};
+
+	WriteLCD(&lcd_area);
+	WriteLCD(&lcd_start);
+}
+
+uint16_t ChartRow(chart_trace_t *trace, int32_t value){
+	int64_t row;
+
+	if (value <= trace->min){
+		return chart.y + chart.height - 1;
+	}
+	if (value >= trace->max){
+		return chart.y;
+	}
+	row = (int64_t)(value - trace->min) * (chart.height - 1) / ((int64_t)trace->max - trace->min);
+	return chart.y + chart.height - 1 - row;
+}
+
+void ChartColumn(void){
+	uint16_t *column = chart_buffer[chart_next];
+	uint16_t i, row0, row1, aux, color, line, lcd_x;
+	int32_t span;
+	chart_trace_t *trace;
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	uint8_t start[2];
+	lcd_cmd_t lcd_start = {VERT_SCROLL_ADDR, 2, start};
+
+	/* This buffer was queued two columns ago */
+	SpiWaitAll(ili9341_spi);
+	if ((chart.grid_columns != 0) && (chart_columns % chart.grid_columns == 0)){
+		color = SwapBytes(chart.grid);
+		for (i = 0; i < chart.height; i++){
+			column[i] = color;
+		}
+	}
+	else{
+		memcpy(column, chart_template, chart.height * sizeof(uint16_t));
+	}
+	for (i = 0; i < chart.traces; i++){
+		trace = &chart_trace[i];
+		if (chart.trace[i].autoscale){
+			/* Each sweep the range shrinks to the values of the last one, new values out of range expand it at once */
+			if ((chart_columns % chart.width == 0) && (chart_columns > 0)){
+				span = (trace->sweep_max - trace->sweep_min) / CHART_MARGIN + 1;
+				trace->min = trace->sweep_min - span;
+				trace->max = trace->sweep_max + span;
+				trace->sweep_min = trace->column_min;
+				trace->sweep_max = trace->column_max;
+			}
+			else{
+				trace->sweep_min = (trace->column_min < trace->sweep_min) ? trace->column_min : trace->sweep_min;
+				trace->sweep_max = (trace->column_max > trace->sweep_max) ? trace->column_max : trace->sweep_max;
+			}
+			if ((trace->column_min < trace->min) || (trace->column_max > trace->max)){
+				span = (trace->sweep_max - trace->sweep_min) / CHART_MARGIN + 1;
+				trace->min = (trace->column_min < trace->min) ? trace->sweep_min - span : trace->min;
+				trace->max = (trace->column_max > trace->max) ? trace->sweep_max + span : trace->max;
+			}
+		}
+		/* Vertical segment joining the previous column with all the samples of this one */
+		row0 = ChartRow(trace, trace->column_max);
+		row1 = ChartRow(trace, trace->column_min);
+		if (chart_columns > 0){
+			aux = ChartRow(trace, trace->previous);
+			row0 = (aux < row0) ? aux : row0;
+			row1 = (aux > row1) ? aux : row1;
+		}
+		color = SwapBytes(chart.trace[i].color);
+		for (aux = row0; aux <= row1; aux++){
+			column[aux - chart.y] = color;
+		}
+		trace->previous = trace->last;
+		trace->column_min = INT32_MAX;
+		trace->column_max = INT32_MIN;
+	}
+
+	/* The new column takes the frame memory line of the oldest one and the scroll moves one line, 
+	   so it is shown at the right end of the chart */
+	if (lcd_orientation.orientation == ILI9341_Landscape_1){
+		line = chart_start;
+		chart_start = chart_top + (chart_start - chart_top + 1) % chart.width;
+		lcd_x = line;
+	}
+	else{
+		/* Rows (and the scroll) are reversed */
+		chart_start = chart_top + (chart_start - chart_top + chart.width - 1) % chart.width;
+		line = chart_start;
+		lcd_x = ILI9341_HEIGHT - 1 - line;
+	}
+	start[0] = HighByte(chart_start);
+	start[1] = LowByte(chart_start);
+	SetCursorPosition(lcd_x, chart.y, lcd_x, chart.y + chart.height - 1);
+	QueueLCD(&lcd_write);
+	SpiQueueWrite(ili9341_spi, (uint8_t *)column, chart.height * sizeof(uint16_t), SPI_DC_DATA);
+	QueueLCD(&lcd_start);
+	chart_next ^= 1;
+	chart_columns++;
+}
 
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+void FbMarkDirty(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+	uint8_t i, best = 0;
+	uint32_t growth, best_growth = UINT32_MAX;
+	rect_t merged;
+
+	/* Extend an existing rectangle if the new area overlaps or is close to it */
+	for (i = 0; i < dirty_count; i++){
+		if ((x0 <= dirty_rect[i].x1 + FB_MERGE_MARGIN) && (x1 + FB_MERGE_MARGIN >= dirty_rect[i].x0) &&
+			(y0 <= dirty_rect[i].y1 + FB_MERGE_MARGIN) && (y1 + FB_MERGE_MARGIN >= dirty_rect[i].y0)){
+			best = i;
+			best_growth = 0;
+			break;
+		}
+	}
+	if (best_growth != 0){
+		if (dirty_count < FB_MAX_DIRTY){
+			dirty_rect[dirty_count].x0 = x0;
+			dirty_rect[dirty_count].y0 = y0;
+			dirty_rect[dirty_count].x1 = x1;
+			dirty_rect[dirty_count].y1 = y1;
+			dirty_count++;
+			return;
+		}
+		/* List is full: merge with the rectangle whose bounding box grows the least */
+		for (i = 0; i < FB_MAX_DIRTY; i++){
+			merged.x0 = (x0 < dirty_rect[i].x0) ? x0 : dirty_rect[i].x0;
+			merged.y0 = (y0 < dirty_rect[i].y0) ? y0 : dirty_rect[i].y0;
+			merged.x1 = (x1 > dirty_rect[i].x1) ? x1 : dirty_rect[i].x1;
+			merged.y1 = (y1 > dirty_rect[i].y1) ? y1 : dirty_rect[i].y1;
+			growth = (merged.x1 - merged.x0 + 1) * (merged.y1 - merged.y0 + 1) -
+					 (dirty_rect[i].x1 - dirty_rect[i].x0 + 1) * (dirty_rect[i].y1 - dirty_rect[i].y0 + 1);
+			if (growth < best_growth){
+				best_growth = growth;
+				best = i;
+			}
+		}
+	}
+	if (x0 < dirty_rect[best].x0) dirty_rect[best].x0 = x0;
+	if (y0 < dirty_rect[best].y0) dirty_rect[best].y0 = y0;
+	if (x1 > dirty_rect[best].x1) dirty_rect[best].x1 = x1;
+	if (y1 > dirty_rect[best].y1) dirty_rect[best].y1 = y1;
+}
+
+void FbFill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	uint16_t i, j, aux;
+	uint16_t *row;
+
+	/* Sort corners and clip to LCD area */
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	if ((x0 >= lcd_orientation.width) || (y0 >= lcd_orientation.height)){
+		return;
+	}
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
+	}
+	color = SwapBytes(color);
+	for (i = y0; i <= y1; i++){
+		row = &framebuffer[i * lcd_orientation.width];
+		for (j = x0; j <= x1; j++){
+			row[j] = color;
+		}
+	}
+	FbMarkDirty(x0, y0, x1, y1);
+}
+
+void FbDrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
+	uint16_t i, w, h;
+
+	if ((x >= lcd_orientation.width) || (y >= lcd_orientation.height)){
+		return;
+	}
+	/* Clip to LCD area */
+	w = (x + width > lcd_orientation.width) ? lcd_orientation.width - x : width;
+	h = (y + height > lcd_orientation.height) ? lcd_orientation.height - y : height;
+	/* Pictures are already stored as 2 bytes/pixel in LCD byte order */
+	for (i = 0; i < h; i++){
+		memcpy(&framebuffer[(y + i) * lcd_orientation.width + x], &pic[i * width * 2], w * 2);
+	}
+	FbMarkDirty(x, y, x + w - 1, y + h - 1);
+}
+
+void PanelPosition(uint8_t mem_acc, uint16_t x, uint16_t y, uint16_t *column, uint16_t *row){
+	uint16_t aux;
+
+	/* Columns and pages are exchanged first, then the panel order of each one is applied */
+	if (mem_acc & MADCTL_MV){
+		aux = x;
+		x = y;
+		y = aux;
+	}
+	*column = (mem_acc & MADCTL_MX) ? ILI9341_WIDTH - 1 - x : x;
+	*row = (mem_acc & MADCTL_MY) ? ILI9341_HEIGHT - 1 - y : y;
+}
+
+void PanelPixel(uint8_t mem_acc, uint16_t column, uint16_t row, uint16_t *x, uint16_t *y){
+	if (mem_acc & MADCTL_MX){
+		column = ILI9341_WIDTH - 1 - column;
+	}
+	if (mem_acc & MADCTL_MY){
+		row = ILI9341_HEIGHT - 1 - row;
+	}
+	*x = (mem_acc & MADCTL_MV) ? row : column;
+	*y = (mem_acc & MADCTL_MV) ? column : row;
+}
+
+void FbRelayout(uint8_t old_mem_acc, uint8_t new_mem_acc){
+	uint32_t start, i, j;
+	uint16_t old_width, new_width, x, y, column, row, pixel, aux;
+	uint8_t k;
+
+	old_width = (old_mem_acc & MADCTL_MV) ? ILI9341_HEIGHT : ILI9341_WIDTH;
+	new_width = (new_mem_acc & MADCTL_MV) ? ILI9341_HEIGHT : ILI9341_WIDTH;
+	memset(fb_moved, 0, ILI9341_PIXEL_MAX / 8);
+	for (start = 0; start < ILI9341_PIXEL_MAX; start++){
+		if (fb_moved[start / 8] & (1 << (start % 8))){
+			continue;
+		}
+		/* Each pixel takes the place of the next one of its cycle, until the cycle is closed */
+		i = start;
+		pixel = framebuffer[start];
+		do{
+			PanelPosition(old_mem_acc, i % old_width, i / old_width, &column, &row);
+			PanelPixel(new_mem_acc, column, row, &x, &y);
+			j = y * new_width + x;
+			aux = framebuffer[j];
+			framebuffer[j] = pixel;
+			pixel = aux;
+			fb_moved[j / 8] |= 1 << (j % 8);
+			i = j;
+		} while (i != start);
+	}
+	/* Rectangles on the panel are still rectangles: only their corners are moved */
+	for (k = 0; k < dirty_count; k++){
+		PanelPosition(old_mem_acc, dirty_rect[k].x0, dirty_rect[k].y0, &column, &row);
+		PanelPixel(new_mem_acc, column, row, &dirty_rect[k].x0, &dirty_rect[k].y0);
+		PanelPosition(old_mem_acc, dirty_rect[k].x1, dirty_rect[k].y1, &column, &row);
+		PanelPixel(new_mem_acc, column, row, &dirty_rect[k].x1, &dirty_rect[k].y1);
+		if (dirty_rect[k].x0 > dirty_rect[k].x1){
+			aux = dirty_rect[k].x0;
+			dirty_rect[k].x0 = dirty_rect[k].x1;
+			dirty_rect[k].x1 = aux;
+		}
+		if (dirty_rect[k].y0 > dirty_rect[k].y1){
+			aux = dirty_rect[k].y0;
+			dirty_rect[k].y0 = dirty_rect[k].y1;
+			dirty_rect[k].y1 = aux;
+		}
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
 }
 
 /*==================[external functions definition]==========================*/
@@ -278,6 +1161,8 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	ili9341_rst = gpio_rst;
 	GPIOInit(ili9341_dc, GPIO_OUTPUT);
 	GPIOInit(ili9341_rst, GPIO_OUTPUT);
+	SpiInit(&spi_conf);
+	SpiSetDCPin(ili9341_spi, ili9341_dc);
 
 	/* RST must be held low for minimum 10µsec after VCC have been applied */
 	DelayUs(10);
@@ -286,6 +1171,8 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	DelayUs(10);
 	/* It will be necessary to wait 5msec before sending new command following software reset */
 	WriteLCD(&lcd_reset);
+	lcd_window.x0 = lcd_window.y0 = 1;
+	lcd_window.x1 = lcd_window.y1 = 0;
 	DelayMs(5);
 	/* Send initial configuration to LCD */
 	for (uint8_t i = 0; i < sizeof(lcd_init)/sizeof(lcd_cmd_t); i++){
@@ -303,6 +1190,13 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 }
 
 void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color){
+	if (framebuffer != NULL){
+		if ((x < lcd_orientation.width) && (y < lcd_orientation.height)){
+			framebuffer[y * lcd_orientation.width + x] = SwapBytes(color);
+			FbMarkDirty(x, y, x, y);
+		}
+		return;
+	}
 	/* Define area (pixel) to fill */
 	SetCursorPosition(x, y, x, y);
 	uint8_t pixels[] = {HighByte(color), LowByte(color)};
@@ -325,7 +1219,7 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 		break;
 
 	case ILI9341_Portrait_2:
-		mem_acc[0] = 0x88;		/*!< Row Address Order (MY) = 1, Column Address Order (MX) = 1, Row/Column Exchange (MV) = 0 */
+		mem_acc[0] = 0x88;		/*!< Row Address Order (MY) = 1, Column Address Order (MX) = 0, Row/Column Exchange (MV) = 0 */
 		lcd_orientation.width = ILI9341_WIDTH;
 		lcd_orientation.height = ILI9341_HEIGHT;
 		lcd_orientation.orientation = ILI9341_Portrait_2;
@@ -345,157 +1239,71 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 		lcd_orientation.orientation = ILI9341_Landscape_2;
 		break;
 	}
-	lcd_cmd_t lcd_mem_acc = {MEM_ACC_CTRL, 1, mem_acc};
-	WriteLCD(&lcd_mem_acc);
+	lcd_cmd_t lcd_mem_acc_ctrl = {MEM_ACC_CTRL, 1, mem_acc};
+	WriteLCD(&lcd_mem_acc_ctrl);
+	/* The LCD keeps its frame memory: the framebuffer pixels (and the ones not flushed yet)
+	   are moved to the new layout, with the width of the new orientation as stride */
+	if ((framebuffer != NULL) && (mem_acc[0] != lcd_mem_acc)){
+		FbRelayout(lcd_mem_acc, mem_acc[0]);
+	}
+	lcd_mem_acc = mem_acc[0];
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
-	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
-	/* Set coordinates */
-	lcd_x = x;
-	lcd_y = y;
-
 	/* If at the end of a line of display, go to new line and set x to 0 position */
-	if ((lcd_x + font->info[data - ' '].width) > lcd_orientation.width)	{
-		lcd_y += font->font_height;
-		lcd_x = 0;
-	}
-
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
+	if ((data >= FIRST_CHAR) && (data <= LAST_CHAR) && ((x + font->info[data - FIRST_CHAR].width) > lcd_orientation.width)){
+		y += font->font_height;
+		x = 0;
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	TextLine(x, y, &data, 1, font, foreground, background, 0);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
-	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
-	/* Set coordinates */
-	lcd_x = x;
-	lcd_y = y;
+	uint16_t palette[] = {background, foreground};
+	image_rle_t image = {icon_font->width, icon_font->height, 2, NULL, 
+		icon_font->offset[icon + 1] - icon_font->offset[icon], &icon_font->data[icon_font->offset[icon]]};
 
 	/* If at the end of a line of display, go to new line and set x to 0 position */
-	if ((lcd_x + icon_font->width) > lcd_orientation.width)	{
-		lcd_y += icon_font->height;
-		lcd_x = 0;
-	}
-
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
+	if ((x + icon_font->width) > lcd_orientation.width)	{
+		y += icon_font->height;
+		x = 0;
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	ImageStream(x, y, &image, palette);
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint16_t i;
-	static uint16_t lcd_x, lcd_y;
-
-	/* Set coordinates */
-	lcd_x = x;
-	lcd_y = y;
-
-	for (i=0; i<dig; i++){
-		lcd_x = x + font->info[num%10 + '0' - ' '].width * (dig-1-i) + 1;
-		ILI9341DrawChar(lcd_x, lcd_y, num%10 + '0', font, foreground, background);
-		num = num/10;
+	char digits[UINT8_MAX];
+	uint8_t i, cell;
+
+	/* All digits in cells of the same width, so the number does not move when it changes */
+	cell = 0;
+	for (i = 0; i < 10; i++){
+		if (font->info['0' + i - FIRST_CHAR].width > cell){
+			cell = font->info['0' + i - FIRST_CHAR].width;
+		}
 	}
+	for (i = 0; i < dig; i++){
+		digits[dig - 1 - i] = num % 10 + '0';
+		num = num / 10;
+	}
+	TextLine(x + 1, y, digits, dig, font, foreground, background, cell);
 }
 
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
-	static uint16_t lcd_x, lcd_y;
+	uint16_t lcd_x, lcd_y, count;
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
 
-	while (*str != '\0'){	/* End of string */
+	/* Each line of the string is sent in a single window */
+	while (*str != '\0'){
+		count = 0;
+		while ((str[count] != '\0') && (str[count] != '\n')){
+			count++;
+		}
+		TextLine(lcd_x, lcd_y, str, count, font, foreground, background, 0);
+		str += count;
 		/* New line */
 		if (*str == '\n'){
 			lcd_y += font->font_height + 1;
@@ -509,20 +1317,11 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 			}
 			str++;
 		}
-		else if (*str == '\r'){
-				str++;
-			}
-
-		/* Put character to LCD */
-		ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
-		lcd_x += font->info[*str - ' '].width + 1;
-		/* Next character */
-		str++;
 	}
 }
 
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height){
-	static uint16_t w;
+	uint16_t w;
 
 	*height = font->font_height;
 	w = 0;
@@ -535,7 +1334,8 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 }
 
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	int16_t x, y, next_x, next_y, run_x, run_y;
 
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width){
@@ -569,41 +1369,58 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 		y_grow = DOWN;
 	}
 
+	RunBegin(color);
 	/* Vertical or horizontal line */
 	if (x_dist == 0 || y_dist == 0){
-		Fill(x0, y0, x1, y1, color);
+		RunDraw(x0, y0, x1, y1);
 	}
 	/* Diagonal line */
 	else{
 		error = x_dist - y_dist;
+		x = x0;
+		y = y0;
+		run_x = x;
+		run_y = y;
 
 		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
 			/* Loop ends when start point reaches end point */
-			if (x0 == x1 && y0 == y1){
+			if (x == x1 && y == y1){
+				RunDraw(run_x, run_y, x, y);
 				break;
 			}
+			next_x = x;
+			next_y = y;
 			error_2 = 2 * error;
 			/* Determine if line must grow in x direction */
 			if (error_2 > -y_dist){
 				error -= y_dist;
-				x0 += x_grow;	/* Move start point */
+				next_x += x_grow;
 			}
 			/* Determine if line must grow in y direction */
 			if (error_2 < x_dist){
 				error += x_dist;
-				y0 += y_grow;	/* Move start point */
+				next_y += y_grow;
+			}
+			/* Points are grouped in a run along the major axis until the line moves along the minor one */
+			if ((x_dist >= y_dist) ? (next_y != y) : (next_x != x)){
+				RunDraw(run_x, run_y, x, y);
+				run_x = next_x;
+				run_y = next_y;
 			}
+			x = next_x;
+			y = next_y;
 		}
 	}
+	RunEnd();
 }
 
 void ILI9341DrawRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	ILI9341DrawLine(x0, y0, x1, y0, color);		/* Draw top line */
-	ILI9341DrawLine(x1, y0, x1, y1, color);		/* Draw right line */
-	ILI9341DrawLine(x0, y1, x1, y1, color);		/* Draw bottom line */
-	ILI9341DrawLine(x0, y0, x0, y1, color);		/* Draw left line */
+	RunBegin(color);
+	RunDraw(x0, y0, x1, y0);		/* Draw top line */
+	RunDraw(x1, y0, x1, y1);		/* Draw right line */
+	RunDraw(x0, y1, x1, y1);		/* Draw bottom line */
+	RunDraw(x0, y0, x0, y1);		/* Draw left line */
+	RunEnd();
 }
 
 void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
@@ -611,43 +1428,35 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 }
 
 void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
+	int16_t f, ddF_x, ddF_y, x, y, x_run;
 
 	f = 1 - r;
 	ddF_x = 1;
 	ddF_y = -2 * r;
 	x = 0;
 	y = r;
-
-	ILI9341DrawPixel(x0, y0 + r, color);
-	ILI9341DrawPixel(x0, y0 - r, color);
-	ILI9341DrawPixel(x0 + r, y0, color);
-	ILI9341DrawPixel(x0 - r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        ILI9341DrawPixel(x0 + x, y0 + y, color);
-        ILI9341DrawPixel(x0 - x, y0 + y, color);
-        ILI9341DrawPixel(x0 + x, y0 - y, color);
-        ILI9341DrawPixel(x0 - x, y0 - y, color);
-
-        ILI9341DrawPixel(x0 + y, y0 + x, color);
-        ILI9341DrawPixel(x0 - y, y0 + x, color);
-        ILI9341DrawPixel(x0 + y, y0 - x, color);
-        ILI9341DrawPixel(x0 - y, y0 - x, color);
-    }
+	x_run = 0;
+
+	RunBegin(color);
+	while (x < y){
+		if (f >= 0){
+			/* y is about to change: the points since x_run are a run */
+			CircleRuns(x0, y0, x_run, x, y);
+			x_run = x + 1;
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+	}
+	CircleRuns(x0, y0, x_run, x, y);
+	RunEnd();
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
+	int16_t f, ddF_x, ddF_y, x, y;
 
 	f = 1 - r;
 	ddF_x = 1;
@@ -655,28 +1464,28 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 	x = 0;
 	y = r;
 
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
+	/* Each row of the circle is a single span */
+	RunBegin(color);
+	RunDraw(x0 - r, y0, x0 + r, y0);
+	while (x < y){
+		if (f >= 0){
+			/* y is about to change: x is the widest point of rows y0 + y and y0 - y */
+			RunDraw(x0 - x, y0 + y, x0 + x, y0 + y);
+			RunDraw(x0 - x, y0 - y, x0 + x, y0 - y);
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
 
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
-    }
+		RunDraw(x0 - y, y0 + x, x0 + y, y0 + x);
+		RunDraw(x0 - y, y0 - x, x0 + y, y0 - x);
+	}
+	RunDraw(x0 - x, y0 + y, x0 + x, y0 + y);
+	RunDraw(x0 - x, y0 - y, x0 + x, y0 - y);
+	RunEnd();
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -686,15 +1495,15 @@ void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
 }
 
 void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
-	static int16_t x_0 = 0;
-	static int16_t y_0 = 0;
-	static int16_t x_1 = 0;
-	static int16_t y_1 = 0;
-	static int16_t x_2 = 0;
-	static int16_t y_2 = 0;
-	static int16_t x_aux = 0;
-	static int16_t y_aux = 0;
-	static int16_t scanline_y = 0;
+	int16_t x_0 = 0;
+	int16_t y_0 = 0;
+	int16_t x_1 = 0;
+	int16_t y_1 = 0;
+	int16_t x_2 = 0;
+	int16_t y_2 = 0;
+	int16_t x_aux = 0;
+	int16_t y_aux = 0;
+	int16_t scanline_y = 0;
 	float invslope1, invslope2, curx1, curx2;
 	if((y0 <= y1) && (y0 <= y2)){
 		x_0 = x0;
@@ -739,15 +1548,25 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 			y_2 = y0;
 		}
 	}
-	if(y_1 == y_2){
+	/* Each row of the triangle is a single span */
+	RunBegin(color);
+	if(y_0 == y_2){
+		// All vertices in the same row
+		x_aux = (x_1 > x_2) ? x_1 : x_2;
+		x_aux = (x_0 > x_aux) ? x_0 : x_aux;
+		x_1 = (x_1 < x_2) ? x_1 : x_2;
+		x_1 = (x_0 < x_1) ? x_0 : x_1;
+		RunDraw(x_1, y_0, x_aux, y_0);
+	}
+	else if(y_1 == y_2){
 		// Bottom flat triangle
 		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
 		invslope2 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
 		curx1 = x_0;
 		curx2 = x_0;
 		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+		while(scanline_y <= y_1){
+			RunDraw((int)curx1, scanline_y, (int)curx2, scanline_y);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -760,8 +1579,8 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx1 = x_2;
 		curx2 = x_2;
 		scanline_y = y_2;
-		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+		while(scanline_y >= y_0){
+			RunDraw((int)curx1, scanline_y, (int)curx2, scanline_y);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
@@ -778,7 +1597,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			RunDraw((int)curx1, scanline_y, (int)curx2, scanline_y);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -790,44 +1609,200 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			RunDraw((int)curx1, scanline_y, (int)curx2, scanline_y);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
 		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
+		RunDraw(x_1, y_1, x_aux, y_aux);
   	}
+	RunEnd();
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint32_t bytes_count, pos, chunk;
+	uint8_t buffer = 0;
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+
+	if (framebuffer != NULL){
+		FbDrawPicture(x, y, width, height, pic);
+		return;
+	}
 
 	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	QueueLCD(&lcd_write);
+
+	/* Pictures in flash are copied to DMA capable memory, while the previous chunk is sent */
+	bytes_count = (uint32_t)width * height * 2;
+	for (pos = 0; pos < bytes_count; pos += chunk){
+		chunk = (bytes_count - pos < STREAM_BUFFER_SIZE) ? bytes_count - pos : STREAM_BUFFER_SIZE;
+		memcpy(stream_buffer[buffer], &pic[pos], chunk);
+		if (pos > 0){
+			SpiWaitAll(ili9341_spi);
+		}
+		SpiQueueWrite(ili9341_spi, (uint8_t *)stream_buffer[buffer], chunk, SPI_DC_DATA);
+		buffer ^= 1;
+	}
+	SpiWaitAll(ili9341_spi);
+}
+
+void ILI9341DrawImage(uint16_t x, uint16_t y, const image_rle_t* image){
+	ImageStream(x, y, image, NULL);
+}
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = width * height * 2;
+uint8_t ILI9341FramebufferInit(void){
+	if (framebuffer == NULL){
+		framebuffer = heap_caps_malloc(ILI9341_PIXEL_MAX * 2 + ILI9341_PIXEL_MAX / 8, MALLOC_CAP_DMA);
+		if (framebuffer == NULL){
+			return false;
+		}
+		fb_moved = (uint8_t *)&framebuffer[ILI9341_PIXEL_MAX];
+	}
+	/* Start on White (as ILI9341Init leaves the LCD) and send the whole screen on first flush */
+	memset(framebuffer, 0xFF, ILI9341_PIXEL_MAX * 2);
+	dirty_count = 0;
+	FbMarkDirty(0, 0, lcd_orientation.width - 1, lcd_orientation.height - 1);
+	return true;
+}
 
-	/* Start writing LCD memory */
+void ILI9341Flush(void){
+	uint8_t i;
+	uint16_t row;
+	uint32_t row_bytes, bytes_count, chunk;
+	uint8_t *data;
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	if (framebuffer == NULL){
+		return;
+	}
+	for (i = 0; i < dirty_count; i++){
+		SetCursorPosition(dirty_rect[i].x0, dirty_rect[i].y0, dirty_rect[i].x1, dirty_rect[i].y1);
+		WriteLCD(&lcd_write);
+		row_bytes = (dirty_rect[i].x1 - dirty_rect[i].x0 + 1) * 2;
+		if (row_bytes == lcd_orientation.width * 2){
+			/* Full width rows are contiguous in the framebuffer: queue them straight from it */
+			data = (uint8_t *)&framebuffer[dirty_rect[i].y0 * lcd_orientation.width];
+			bytes_count = row_bytes * (dirty_rect[i].y1 - dirty_rect[i].y0 + 1);
+			while (bytes_count > 0){
+				chunk = (bytes_count > SPI_MAX_TRANSFER_SIZE) ? SPI_MAX_TRANSFER_SIZE : bytes_count;
+				SpiQueueWrite(ili9341_spi, data, chunk, SPI_DC_DATA);
+				data += chunk;
+				bytes_count -= chunk;
+			}
+			SpiWaitAll(ili9341_spi);
+		}
+		else{
+			/* Group as many partial rows as fit in the staging buffer in each transfer */
+			bytes_count = 0;
+			for (row = dirty_rect[i].y0; row <= dirty_rect[i].y1; row++){
+				if (bytes_count + row_bytes > FB_FLUSH_BUFFER_SIZE){
+					lcd_cmd_t lcd_pixels = {NULL, bytes_count, flush_buffer};
+					WriteLCD(&lcd_pixels);
+					bytes_count = 0;
+				}
+				memcpy(&flush_buffer[bytes_count], &framebuffer[row * lcd_orientation.width + dirty_rect[i].x0], row_bytes);
+				bytes_count += row_bytes;
+			}
+			lcd_cmd_t lcd_pixels = {NULL, bytes_count, flush_buffer};
+			WriteLCD(&lcd_pixels);
+		}
+	}
+	dirty_count = 0;
+}
+
+void ILI9341FramebufferDeInit(void){
+	if (framebuffer != NULL){
+		ILI9341Flush();
+		heap_caps_free(framebuffer);
+		framebuffer = NULL;
+	}
+}
+
+uint8_t ILI9341ChartInit(const ili9341_chart_config_t *config){
+	uint16_t i, row;
+
+	if ((lcd_orientation.orientation != ILI9341_Landscape_1) && (lcd_orientation.orientation != ILI9341_Landscape_2)){
+		return false;
+	}
+	if ((framebuffer != NULL) || (config->width == 0) || (config->height == 0) ||
+		(config->x + config->width > ILI9341_HEIGHT) || (config->y + config->height > ILI9341_WIDTH) ||
+		(config->traces > ILI9341_CHART_MAX_TRACES) || (config->column_rate == 0) || 
+		(config->column_rate > config->sample_rate)){
+		return false;
+	}
+	chart = *config;
+	for (i = 0; i < chart.traces; i++){
+		if (chart.trace[i].max <= chart.trace[i].min){
+			chart.trace[i].max = chart.trace[i].min + 1;
 		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
+		chart_trace[i].min = chart.trace[i].min;
+		chart_trace[i].max = chart.trace[i].max;
+		chart_trace[i].column_min = INT32_MAX;
+		chart_trace[i].column_max = INT32_MIN;
+		chart_trace[i].sweep_min = INT32_MAX;
+		chart_trace[i].sweep_max = INT32_MIN;
+	}
+	chart_phase = 0;
+	chart_columns = 0;
+	chart_next = 0;
+
+	/* Empty column: background and horizontal grid lines */
+	for (i = 0; i < chart.height; i++){
+		chart_template[i] = SwapBytes(chart.background);
+	}
+	for (i = 1; i <= chart.grid_rows; i++){
+		chart_template[i * chart.height / (chart.grid_rows + 1)] = SwapBytes(chart.grid);
+	}
+	/* The whole columns scroll: clear them on all the LCD height */
+	Fill(chart.x, 0, chart.x + chart.width - 1, lcd_orientation.height - 1, chart.background);
+	RunBegin(chart.grid);
+	for (i = 1; i <= chart.grid_rows; i++){
+		row = chart.y + i * chart.height / (chart.grid_rows + 1);
+		RunDraw(chart.x, row, chart.x + chart.width - 1, row);
+	}
+	RunEnd();
+
+	/* In landscape the LCD rows are the frame memory columns: the scrolling area is the chart width. 
+	   With MY = 1 (Landscape_2) the frame memory lines go from right to left */
+	if (lcd_orientation.orientation == ILI9341_Landscape_1){
+		chart_top = chart.x;
+	}
+	else{
+		chart_top = ILI9341_HEIGHT - chart.x - chart.width;
+	}
+	chart_start = chart_top;
+	ScrollArea(chart_top, chart.width, chart_start);
+	return true;
+}
+
+void ILI9341ChartAdd(const int32_t *samples){
+	uint8_t i;
+	chart_trace_t *trace;
+
+	if (chart.width == 0){
+		return;
+	}
+	for (i = 0; i < chart.traces; i++){
+		trace = &chart_trace[i];
+		trace->last = samples[i];
+		trace->column_min = (samples[i] < trace->column_min) ? samples[i] : trace->column_min;
+		trace->column_max = (samples[i] > trace->column_max) ? samples[i] : trace->column_max;
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	/* Bresenham style decimation: column_rate / sample_rate columns per sample */
+	chart_phase += chart.column_rate;
+	if (chart_phase >= chart.sample_rate){
+		chart_phase -= chart.sample_rate;
+		ChartColumn();
+	}
+}
+
+void ILI9341ChartDeInit(void){
+	if (chart.width == 0){
+		return;
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	SpiWaitAll(ili9341_spi);
+	ScrollArea(0, ILI9341_HEIGHT, 0);
+	chart.width = 0;
 }
 
 uint8_t ILI9341DeInit(void){
@@ -0,0 +1,387 @@
+/**
+ * @file ili9341_render.c
+ * @brief Drawing commands for the ILI9341 LCD from any task, rendered by a display task
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ili9341_render.h"
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define RENDER_TASK_STACK	4096
+#define QUEUE_MASK			(ILI9341_RENDER_QUEUE_SIZE - 1)
+
+/**
+ * @brief Drawing command types
+ */
+typedef enum {
+	RENDER_FILL,			/*!< Filled rectangle */
+	RENDER_BLIT,			/*!< Picture */
+	RENDER_IMAGE,			/*!< Compressed picture */
+	RENDER_TEXT,			/*!< Text */
+	RENDER_LINE,			/*!< Line */
+} render_type_t;
+
+/**
+ * @brief Drawing command
+ */
+typedef struct {
+	uint8_t type;			/*!< Command type (render_type_t) */
+	uint8_t hidden;			/*!< Dropped by the display task */
+	uint16_t widget;		/*!< Widget redrawn by the command */
+	uint16_t x0, y0;		/*!< Fill and line: first corner/point. Others: top left corner */
+	uint16_t x1, y1;		/*!< Fill and line: second corner/point. Blit: width and height */
+	uint16_t left, top;		/*!< Area changed by the command (right < left: unknown) */
+	uint16_t right, bottom;
+	uint16_t color;			/*!< Color, or text foreground */
+	uint16_t background;	/*!< Text background */
+	const void *data;		/*!< Picture, compressed picture or font */
+	uint32_t queued;		/*!< Time the command was queued (us) */
+	char text[ILI9341_RENDER_TEXT_MAX + 1];	/*!< Text */
+} render_cmd_t;
+
+/**
+ * @brief Queue position. A slot can be written by the producer that takes position
+ * sequence, and read by the display task when sequence is position + 1
+ */
+typedef struct {
+	uint32_t sequence;		/*!< Position of the queue the slot is ready for */
+	render_cmd_t cmd;		/*!< Command */
+} render_slot_t;
+/*==================[internal data declaration]==============================*/
+static render_slot_t render_queue[ILI9341_RENDER_QUEUE_SIZE];	/*!< Bounded lock-free queue (any number of producers, one consumer) */
+static uint32_t render_tail = 0;			/*!< Next position to be taken by a producer */
+static uint32_t render_head = 0;			/*!< Next position to be read by the display task */
+static render_cmd_t render_batch[ILI9341_RENDER_QUEUE_SIZE];	/*!< Commands taken by the display task */
+static TaskHandle_t render_task_handle = NULL;	/*!< Display task (NULL when it is stopped) */
+static bool rendering = false;				/*!< Commands are accepted (atomic access) */
+static bool render_stop = false;			/*!< The display task must draw the last commands and end (atomic access) */
+static uint32_t render_producers = 0;		/*!< Producers inside RenderPush() (atomic access) */
+static ili9341_render_stats_t render_stats;
+static uint64_t render_latency_sum = 0;		/*!< Latency of all the drawn commands (us) */
+static uint32_t render_done = 0;			/*!< Commands drawn or dropped */
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief  		Put a command in the queue and wake up the display task
+ * @param[in]  	cmd: Command
+ * @retval 		1 when queued, 0 when the queue is full or the display task is stopped
+ */
+uint8_t RenderPush(render_cmd_t *cmd);
+
+/**
+ * @brief  		Take the oldest command of the queue (display task only)
+ * @param[out] 	cmd: Command
+ * @retval 		1 when a command is taken, 0 when the queue is empty
+ */
+uint8_t RenderPop(render_cmd_t *cmd);
+
+/**
+ * @brief  		Check if a command of the batch is replaced or covered by a later one
+ * @param[in]  	index: Command of render_batch
+ * @param[in]  	count: Commands of render_batch
+ * @retval 		1 when the command does not need to be drawn
+ */
+uint8_t RenderHidden(uint8_t index, uint8_t count);
+
+/**
+ * @brief  		Draw a command with the ILI9341 driver
+ * @param[in]  	cmd: Command
+ * @retval 		None
+ */
+void RenderDraw(render_cmd_t *cmd);
+
+/**
+ * @brief  		Take all the queued commands, drop the ones that would not be seen and draw the others
+ * @retval 		Commands taken
+ */
+uint8_t RenderBatch(void);
+
+/**
+ * @brief  		Display task: draws the commands when it is notified
+ * @param[in]  	param: Not used
+ * @retval 		None
+ */
+void RenderTask(void *param);
+/*==================[internal functions definition]==========================*/
+uint8_t RenderPush(render_cmd_t *cmd){
+	uint32_t pos;
+	uint16_t depth, max_depth;
+	int32_t diff;
+	render_slot_t *slot;
+
+	/* Announce the producer before checking the flag: ILI9341RenderDeInit() clears the flag 
+	   before waiting for the producers, so either this one sees it cleared or it is waited for */
+	__atomic_fetch_add(&render_producers, 1, __ATOMIC_SEQ_CST);
+	if (!__atomic_load_n(&rendering, __ATOMIC_SEQ_CST)){
+		__atomic_fetch_sub(&render_producers, 1, __ATOMIC_RELEASE);
+		return false;
+	}
+	cmd->hidden = false;
+	cmd->queued = (uint32_t)esp_timer_get_time();
+	/* Take a position: the slot must be free (read by the display task) */
+	pos = __atomic_load_n(&render_tail, __ATOMIC_RELAXED);
+	while (1){
+		slot = &render_queue[pos & QUEUE_MASK];
+		diff = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - pos);
+		if (diff == 0){
+			if (__atomic_compare_exchange_n(&render_tail, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+				break;
+			}
+		}
+		else if (diff < 0){
+			__atomic_fetch_add(&render_stats.rejected, 1, __ATOMIC_RELAXED);
+			__atomic_fetch_sub(&render_producers, 1, __ATOMIC_RELEASE);
+			return false;
+		}
+		else{
+			/* Another producer took it */
+			pos = __atomic_load_n(&render_tail, __ATOMIC_RELAXED);
+		}
+	}
+	slot->cmd = *cmd;
+	__atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+	__atomic_fetch_add(&render_stats.submitted, 1, __ATOMIC_RELEASE);
+
+	depth = pos + 1 - __atomic_load_n(&render_head, __ATOMIC_RELAXED);
+	max_depth = __atomic_load_n(&render_stats.max_depth, __ATOMIC_RELAXED);
+	while ((depth > max_depth) &&
+		!__atomic_compare_exchange_n(&render_stats.max_depth, &max_depth, depth, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+	}
+	xTaskNotifyGive(render_task_handle);
+	__atomic_fetch_sub(&render_producers, 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+uint8_t RenderPop(render_cmd_t *cmd){
+	render_slot_t *slot = &render_queue[render_head & QUEUE_MASK];
+
+	if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != render_head + 1){
+		return false;
+	}
+	*cmd = slot->cmd;
+	/* Free for the producer that takes this slot on the next lap (which then sees the new head) */
+	__atomic_store_n(&render_head, render_head + 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&slot->sequence, render_head + ILI9341_RENDER_QUEUE_SIZE - 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+uint8_t RenderHidden(uint8_t index, uint8_t count){
+	render_cmd_t *cmd = &render_batch[index];
+	render_cmd_t *later;
+	uint8_t i;
+
+	for (i = index + 1; i < count; i++){
+		later = &render_batch[i];
+		if ((cmd->widget != ILI9341_RENDER_NO_WIDGET) && (later->widget == cmd->widget)){
+			return true;
+		}
+		/* Fills and pictures set all the pixels of their area */
+		if (((later->type == RENDER_FILL) || (later->type == RENDER_BLIT) || (later->type == RENDER_IMAGE)) &&
+			(cmd->right >= cmd->left) && (later->left <= cmd->left) && (later->top <= cmd->top) &&
+			(later->right >= cmd->right) && (later->bottom >= cmd->bottom)){
+			return true;
+		}
+	}
+	return false;
+}
+
+void RenderDraw(render_cmd_t *cmd){
+	switch (cmd->type){
+	case RENDER_FILL:
+		ILI9341DrawFilledRectangle(cmd->x0, cmd->y0, cmd->x1, cmd->y1, cmd->color);
+		break;
+	case RENDER_BLIT:
+		ILI9341DrawPicture(cmd->x0, cmd->y0, cmd->x1, cmd->y1, cmd->data);
+		break;
+	case RENDER_IMAGE:
+		ILI9341DrawImage(cmd->x0, cmd->y0, cmd->data);
+		break;
+	case RENDER_TEXT:
+		ILI9341DrawString(cmd->x0, cmd->y0, cmd->text, (Font_t *)cmd->data, cmd->color, cmd->background);
+		break;
+	case RENDER_LINE:
+		ILI9341DrawLine(cmd->x0, cmd->y0, cmd->x1, cmd->y1, cmd->color);
+		break;
+	default:
+		break;
+	}
+}
+
+uint8_t RenderBatch(void){
+	uint8_t count = 0, drawn = 0, i;
+	uint32_t now, latency;
+
+	while ((count < ILI9341_RENDER_QUEUE_SIZE) && RenderPop(&render_batch[count])){
+		count++;
+	}
+	if (count == 0){
+		return 0;
+	}
+	for (i = 0; i < count; i++){
+		render_batch[i].hidden = RenderHidden(i, count);
+		if (!render_batch[i].hidden){
+			RenderDraw(&render_batch[i]);
+			drawn++;
+		}
+	}
+	/* Nothing is done if framebuffer mode is disabled */
+	ILI9341Flush();
+
+	now = (uint32_t)esp_timer_get_time();
+	for (i = 0; i < count; i++){
+		if (!render_batch[i].hidden){
+			latency = now - render_batch[i].queued;
+			render_latency_sum += latency;
+			if (latency > render_stats.latency_max_us){
+				render_stats.latency_max_us = latency;
+			}
+		}
+	}
+	render_stats.drawn += drawn;
+	render_stats.coalesced += count - drawn;
+	render_stats.batches++;
+	__atomic_fetch_add(&render_done, count, __ATOMIC_RELEASE);
+	return count;
+}
+
+void RenderTask(void *param){
+	while (!__atomic_load_n(&render_stop, __ATOMIC_ACQUIRE)){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		/* Commands queued while drawing a batch are taken in the next one */
+		while (RenderBatch() > 0){
+		}
+	}
+	/* No producer is left: draw the last commands */
+	while (RenderBatch() > 0){
+	}
+	__atomic_store_n(&render_task_handle, NULL, __ATOMIC_RELEASE);
+	vTaskDelete(NULL);
+}
+
+/*==================[external functions definition]==========================*/
+uint8_t ILI9341RenderInit(uint8_t priority){
+	uint32_t i;
+
+	if (__atomic_load_n(&render_task_handle, __ATOMIC_ACQUIRE) != NULL){
+		return false;
+	}
+	for (i = 0; i < ILI9341_RENDER_QUEUE_SIZE; i++){
+		render_queue[i].sequence = i;
+	}
+	render_tail = 0;
+	render_head = 0;
+	memset(&render_stats, 0, sizeof(render_stats));
+	render_latency_sum = 0;
+	render_done = 0;
+
+	render_stop = false;
+	if (xTaskCreate(&RenderTask, "ILI9341", RENDER_TASK_STACK, NULL, priority, &render_task_handle) != pdPASS){
+		render_task_handle = NULL;
+		return false;
+	}
+	/* Producers notify the task: accept commands once its handle is set */
+	__atomic_store_n(&rendering, true, __ATOMIC_SEQ_CST);
+	return true;
+}
+
+uint8_t ILI9341RenderFill(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	render_cmd_t cmd = {.type = RENDER_FILL, .widget = widget, .color = color};
+
+	cmd.x0 = cmd.left = (x0 < x1) ? x0 : x1;
+	cmd.y0 = cmd.top = (y0 < y1) ? y0 : y1;
+	cmd.x1 = cmd.right = (x0 < x1) ? x1 : x0;
+	cmd.y1 = cmd.bottom = (y0 < y1) ? y1 : y0;
+	return RenderPush(&cmd);
+}
+
+uint8_t ILI9341RenderBlit(uint16_t widget, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pic){
+	render_cmd_t cmd = {.type = RENDER_BLIT, .widget = widget, .x0 = x, .y0 = y, .x1 = width, .y1 = height, .data = pic,
+		.left = x, .top = y, .right = x + width - 1, .bottom = y + height - 1};
+
+	if ((width == 0) || (height == 0)){
+		return false;
+	}
+	return RenderPush(&cmd);
+}
+
+uint8_t ILI9341RenderImage(uint16_t widget, uint16_t x, uint16_t y, const image_rle_t *image){
+	render_cmd_t cmd = {.type = RENDER_IMAGE, .widget = widget, .x0 = x, .y0 = y, .data = image,
+		.left = x, .top = y, .right = x + image->width - 1, .bottom = y + image->height - 1};
+
+	if ((image->width == 0) || (image->height == 0)){
+		return false;
+	}
+	return RenderPush(&cmd);
+}
+
+uint8_t ILI9341RenderText(uint16_t widget, uint16_t x, uint16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background){
+	render_cmd_t cmd = {.type = RENDER_TEXT, .widget = widget, .x0 = x, .y0 = y, .data = font,
+		.color = foreground, .background = background, .left = 1, .right = 0};
+	uint16_t width, height;
+
+	strncpy(cmd.text, str, ILI9341_RENDER_TEXT_MAX);
+	cmd.text[ILI9341_RENDER_TEXT_MAX] = '\0';
+	/* Only the area of single line texts is known */
+	if (strchr(cmd.text, '\n') == NULL){
+		ILI9341GetStringSize(cmd.text, font, &width, &height);
+		cmd.left = x;
+		cmd.top = y;
+		cmd.right = x + width;
+		cmd.bottom = y + height;
+	}
+	return RenderPush(&cmd);
+}
+
+uint8_t ILI9341RenderLine(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	render_cmd_t cmd = {.type = RENDER_LINE, .widget = widget, .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1, .color = color};
+
+	cmd.left = (x0 < x1) ? x0 : x1;
+	cmd.top = (y0 < y1) ? y0 : y1;
+	cmd.right = (x0 < x1) ? x1 : x0;
+	cmd.bottom = (y0 < y1) ? y1 : y0;
+	return RenderPush(&cmd);
+}
+
+uint8_t ILI9341RenderSync(uint32_t timeout_ms){
+	TickType_t start = xTaskGetTickCount();
+
+	while (__atomic_load_n(&render_done, __ATOMIC_ACQUIRE) != __atomic_load_n(&render_stats.submitted, __ATOMIC_ACQUIRE)){
+		if (xTaskGetTickCount() - start > pdMS_TO_TICKS(timeout_ms)){
+			return false;
+		}
+		vTaskDelay(1);
+	}
+	return true;
+}
+
+void ILI9341RenderGetStats(ili9341_render_stats_t *stats){
+	*stats = render_stats;
+	stats->depth = __atomic_load_n(&render_tail, __ATOMIC_RELAXED) - __atomic_load_n(&render_head, __ATOMIC_RELAXED);
+	stats->latency_avg_us = (stats->drawn > 0) ? render_latency_sum / stats->drawn : 0;
+}
+
+void ILI9341RenderDeInit(void){
+	if (!__atomic_load_n(&rendering, __ATOMIC_SEQ_CST)){
+		return;
+	}
+	/* New commands are refused, the ones being queued are waited for */
+	__atomic_store_n(&rendering, false, __ATOMIC_SEQ_CST);
+	while (__atomic_load_n(&render_producers, __ATOMIC_ACQUIRE) != 0){
+		vTaskDelay(1);
+	}
+	__atomic_store_n(&render_stop, true, __ATOMIC_RELEASE);
+	xTaskNotifyGive(render_task_handle);
+	while (__atomic_load_n(&render_task_handle, __ATOMIC_ACQUIRE) != NULL){
+		vTaskDelay(1);
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,361 @@
+/**
+ * @file image_rle.c
+ * @brief Lossless compressed RGB565 images and palette icons
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "image_rle.h"
+/*==================[macros and definitions]=================================*/
+#define OP_INDEX		0x00		/*!< Color of the table of last seen colors */
+#define OP_DIFF			0x40		/*!< Small difference with the previous color */
+#define OP_LUMA			0x80		/*!< Difference with the previous color driven by green */
+#define OP_RUN			0xC0		/*!< Short run of the previous color */
+#define OP_RGB			0xFE		/*!< RGB565 color */
+#define OP_LONG_RUN		0xFF		/*!< Long run of the previous color */
+#define OP_MASK			0xC0		/*!< Bits of the code of 1 byte operations */
+#define RUN_MAX			62			/*!< Longest short run */
+#define LONG_RUN_MAX	(UINT16_MAX + RUN_MAX + 1)	/*!< Longest long run */
+#define PALETTE_RUN		0x80		/*!< Palette run (otherwise literal indexes) */
+#define LITERAL_BITS	7			/*!< Bits of the palette indexes of a literal */
+
+#define Red(c)		(((c) >> 11) & 0x1F)		/*!< Red channel of a RGB565 color */
+#define Green(c)	(((c) >> 5) & 0x3F)			/*!< Green channel of a RGB565 color */
+#define Blue(c)		((c) & 0x1F)				/*!< Blue channel of a RGB565 color */
+#define Hash(c)		((Red(c) * 3 + Green(c) * 5 + Blue(c) * 7) % IMAGE_RLE_INDEX_SIZE)	/*!< Position on the table of last seen colors */
+#define Half(d)		(((d) + 32) / 2 - 16)		/*!< Green difference (-32..31) to red/blue scale, rounded down */
+#define SwapBytes(x) (uint16_t)(((x) >> 8) | ((x) << 8))	/*!< RGB565 color in LCD (big endian) byte order */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief  		Bits needed for the indexes of a palette
+ * @param[in]  	palette_size: Colors of the palette
+ * @retval 		Bits per index (1 to 4)
+ */
+uint8_t PaletteBits(uint8_t palette_size);
+
+/**
+ * @brief  		Decode the next pixels of a RGB565 image
+ * @param[in]  	decoder: Decoder state
+ * @param[out] 	pixels: Decoded pixels (LCD byte order)
+ * @param[in]  	count: Pixels to decode
+ * @retval 		Pixels decoded
+ */
+uint32_t DecodeRgb(image_rle_decoder_t *decoder, uint16_t *pixels, uint32_t count);
+
+/**
+ * @brief  		Decode the next pixels of a palette image
+ * @param[in]  	decoder: Decoder state
+ * @param[out] 	pixels: Decoded pixels (LCD byte order)
+ * @param[in]  	count: Pixels to decode
+ * @retval 		Pixels decoded
+ */
+uint32_t DecodePalette(image_rle_decoder_t *decoder, uint16_t *pixels, uint32_t count);
+
+/**
+ * @brief  		Compress a RGB565 image
+ * @param[in]  	pixels: RGB565 colors
+ * @param[in]  	count: Number of pixels
+ * @param[out] 	data: Compressed data
+ * @param[in]  	size: Size of data in bytes
+ * @retval 		Bytes of compressed data, 0 if they do not fit in data
+ */
+uint32_t EncodeRgb(const uint16_t *pixels, uint32_t count, uint8_t *data, uint32_t size);
+
+/**
+ * @brief  		Compress a palette image
+ * @param[in]  	pixels: Palette indexes
+ * @param[in]  	count: Number of pixels
+ * @param[in]  	palette_size: Colors of the palette
+ * @param[out] 	data: Compressed data
+ * @param[in]  	size: Size of data in bytes
+ * @retval 		Bytes of compressed data, 0 if they do not fit in data or an index is out of the palette
+ */
+uint32_t EncodePalette(const uint16_t *pixels, uint32_t count, uint8_t palette_size, uint8_t *data, uint32_t size);
+/*==================[internal data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+uint8_t PaletteBits(uint8_t palette_size){
+	uint8_t bits = 1;
+
+	while ((1 << bits) < palette_size){
+		bits++;
+	}
+	return bits;
+}
+
+uint32_t DecodeRgb(image_rle_decoder_t *decoder, uint16_t *pixels, uint32_t count){
+	const uint8_t *data = decoder->image->data;
+	uint32_t size = decoder->image->size;
+	uint32_t n = 0, len;
+	uint16_t pixel = decoder->pixel;
+	uint16_t color = SwapBytes(pixel);
+	uint8_t op, r, g, b;
+	int8_t dg;
+
+	while (n < count){
+		if (decoder->run > 0){
+			len = (decoder->run < count - n) ? decoder->run : count - n;
+			decoder->run -= len;
+			while (len-- > 0){
+				pixels[n++] = color;
+			}
+			continue;
+		}
+		if (decoder->pos >= size){
+			break;
+		}
+		op = data[decoder->pos++];
+		if (op >= OP_RGB){
+			if (decoder->pos + 2 > size){
+				break;
+			}
+			len = (data[decoder->pos] << 8) | data[decoder->pos + 1];
+			decoder->pos += 2;
+			if (op == OP_LONG_RUN){
+				decoder->run = len + RUN_MAX + 1;
+				continue;
+			}
+			pixel = len;
+		}
+		else if ((op & OP_MASK) == OP_RUN){
+			decoder->run = (op & ~OP_MASK) + 1;
+			continue;
+		}
+		else if ((op & OP_MASK) == OP_INDEX){
+			pixel = decoder->index[op];
+		}
+		else if ((op & OP_MASK) == OP_DIFF){
+			r = (Red(pixel) + ((op >> 4) & 0x03) - 2) & 0x1F;
+			g = (Green(pixel) + ((op >> 2) & 0x03) - 2) & 0x3F;
+			b = (Blue(pixel) + (op & 0x03) - 2) & 0x1F;
+			pixel = (r << 11) | (g << 5) | b;
+		}
+		else{
+			if (decoder->pos >= size){
+				break;
+			}
+			dg = (op & ~OP_MASK) - 32;
+			op = data[decoder->pos++];
+			r = (Red(pixel) + Half(dg) + (op >> 4) - 8) & 0x1F;
+			g = (Green(pixel) + dg) & 0x3F;
+			b = (Blue(pixel) + Half(dg) + (op & 0x0F) - 8) & 0x1F;
+			pixel = (r << 11) | (g << 5) | b;
+		}
+		decoder->index[Hash(pixel)] = pixel;
+		color = SwapBytes(pixel);
+		pixels[n++] = color;
+	}
+	decoder->pixel = pixel;
+	return n;
+}
+
+uint32_t DecodePalette(image_rle_decoder_t *decoder, uint16_t *pixels, uint32_t count){
+	const uint8_t *data = decoder->image->data;
+	uint32_t size = decoder->image->size;
+	uint32_t n = 0, len;
+	uint8_t bits = decoder->bits;
+	uint8_t mask = (1 << bits) - 1;
+	uint8_t run_max = 1 << (LITERAL_BITS - bits);
+	uint16_t color;
+	uint8_t op;
+
+	while (n < count){
+		if (decoder->run > 0){
+			len = (decoder->run < count - n) ? decoder->run : count - n;
+			decoder->run -= len;
+			color = decoder->palette[decoder->pixel];
+			while (len-- > 0){
+				pixels[n++] = color;
+			}
+			continue;
+		}
+		if (decoder->literal > 0){
+			decoder->literal--;
+			pixels[n++] = decoder->palette[(decoder->literal_data >> (bits * decoder->literal)) & mask];
+			continue;
+		}
+		if (decoder->pos >= size){
+			break;
+		}
+		op = data[decoder->pos++];
+		if (op & PALETTE_RUN){
+			decoder->pixel = op & mask;
+			len = ((op & ~PALETTE_RUN) >> bits) + 1;
+			if ((len == run_max) && (decoder->pos < size)){
+				len += data[decoder->pos++];
+			}
+			decoder->run = len;
+		}
+		else{
+			decoder->literal = LITERAL_BITS / bits;
+			decoder->literal_data = op;
+		}
+	}
+	return n;
+}
+
+uint32_t EncodeRgb(const uint16_t *pixels, uint32_t count, uint8_t *data, uint32_t size){
+	uint16_t index[IMAGE_RLE_INDEX_SIZE] = {0};
+	uint16_t pixel, previous = 0;
+	uint32_t i, run = 0, pos = 0;
+	int8_t dr, dg, db;
+
+	for (i = 0; i <= count; i++){
+		pixel = (i < count) ? pixels[i] : previous;
+		if ((i < count) && (pixel == previous) && (run < LONG_RUN_MAX)){
+			run++;
+			continue;
+		}
+		/* Pending run of the previous color */
+		if (run > 0){
+			if (pos + 3 > size){
+				return 0;
+			}
+			if (run <= RUN_MAX){
+				data[pos++] = OP_RUN | (run - 1);
+			}
+			else{
+				data[pos++] = OP_LONG_RUN;
+				data[pos++] = (run - RUN_MAX - 1) >> 8;
+				data[pos++] = (run - RUN_MAX - 1) & 0xFF;
+			}
+			run = 0;
+		}
+		if (i == count){
+			break;
+		}
+		if (pixel == previous){
+			/* Run split at LONG_RUN_MAX */
+			run = 1;
+			continue;
+		}
+		if (pos + 3 > size){
+			return 0;
+		}
+		if (index[Hash(pixel)] == pixel){
+			data[pos++] = OP_INDEX | Hash(pixel);
+		}
+		else{
+			index[Hash(pixel)] = pixel;
+			/* Channel differences, wrapped around */
+			dr = ((Red(pixel) - Red(previous) + 16) & 0x1F) - 16;
+			dg = ((Green(pixel) - Green(previous) + 32) & 0x3F) - 32;
+			db = ((Blue(pixel) - Blue(previous) + 16) & 0x1F) - 16;
+			if ((dr >= -2) && (dr <= 1) && (dg >= -2) && (dg <= 1) && (db >= -2) && (db <= 1)){
+				data[pos++] = OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2);
+			}
+			else if ((dr - Half(dg) >= -8) && (dr - Half(dg) <= 7) && (db - Half(dg) >= -8) && (db - Half(dg) <= 7)){
+				data[pos++] = OP_LUMA | (dg + 32);
+				data[pos++] = ((dr - Half(dg) + 8) << 4) | (db - Half(dg) + 8);
+			}
+			else{
+				data[pos++] = OP_RGB;
+				data[pos++] = pixel >> 8;
+				data[pos++] = pixel & 0xFF;
+			}
+		}
+		previous = pixel;
+	}
+	return pos;
+}
+
+uint32_t EncodePalette(const uint16_t *pixels, uint32_t count, uint8_t palette_size, uint8_t *data, uint32_t size){
+	uint8_t bits = PaletteBits(palette_size);
+	uint8_t literal = LITERAL_BITS / bits;
+	uint32_t run_max = 1 << (LITERAL_BITS - bits);
+	uint32_t i, j, run, pos = 0;
+
+	for (i = 0; i < count; i++){
+		if (pixels[i] >= palette_size){
+			return 0;
+		}
+	}
+	i = 0;
+	while (i < count){
+		if (pos + 2 > size){
+			return 0;
+		}
+		run = 1;
+		while ((i + run < count) && (pixels[i + run] == pixels[i]) && (run < run_max + UINT8_MAX)){
+			run++;
+		}
+		if (run >= literal){
+			if (run < run_max){
+				data[pos++] = PALETTE_RUN | ((run - 1) << bits) | pixels[i];
+			}
+			else{
+				data[pos++] = PALETTE_RUN | ((run_max - 1) << bits) | pixels[i];
+				data[pos++] = run - run_max;
+			}
+			i += run;
+		}
+		else{
+			/* Last literal padded with index 0 */
+			data[pos] = 0;
+			for (j = 0; j < literal; j++){
+				data[pos] = (data[pos] << bits) | ((i + j < count) ? pixels[i + j] : 0);
+			}
+			pos++;
+			i += literal;
+		}
+	}
+	return pos;
+}
+
+/*==================[external functions definition]==========================*/
+void ImageRleDecoderInit(image_rle_decoder_t *decoder, const image_rle_t *image, const uint16_t *palette){
+	uint8_t i;
+
+	decoder->image = image;
+	decoder->pos = 0;
+	decoder->left = (uint32_t)image->width * image->height;
+	decoder->run = 0;
+	decoder->pixel = 0;
+	decoder->literal = 0;
+	decoder->bits = 0;
+	if (image->palette_size > 0){
+		decoder->bits = PaletteBits(image->palette_size);
+		if (palette == NULL){
+			palette = image->palette;
+		}
+		for (i = 0; (i < image->palette_size) && (i < IMAGE_RLE_PALETTE_MAX); i++){
+			decoder->palette[i] = SwapBytes(palette[i]);
+		}
+	}
+	for (i = 0; i < IMAGE_RLE_INDEX_SIZE; i++){
+		decoder->index[i] = 0;
+	}
+}
+
+uint32_t ImageRleDecode(image_rle_decoder_t *decoder, uint16_t *pixels, uint32_t count){
+	/* The last literal of a palette image can have padding */
+	if (count > decoder->left){
+		count = decoder->left;
+	}
+	if (decoder->bits != 0){
+		count = DecodePalette(decoder, pixels, count);
+	}
+	else{
+		count = DecodeRgb(decoder, pixels, count);
+	}
+	decoder->left -= count;
+	return count;
+}
+
+uint32_t ImageRleEncode(const uint16_t *pixels, uint32_t count, uint8_t palette_size, uint8_t *data, uint32_t size){
+	if (palette_size > IMAGE_RLE_PALETTE_MAX){
+		return 0;
+	}
+	if (palette_size > 0){
+		return EncodePalette(pixels, count, palette_size, data, size);
+	}
+	return EncodeRgb(pixels, count, data, size);
+}
+
+/*==================[end of file]============================================*/
@@ -13,32 +13,113 @@
 #include "mpu6050.h"
 #include "math.h"
 #include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define I2C_NUM I2C_NUM_0
+#define STREAM_TASK_STACK		3072
+#define STREAM_TASK_PRIORITY	10
+#define GYRO_OUTPUT_RATE		1000	// Gyroscope output rate (Hz) with DLPF enabled
 
 /*==================[internal data definition]===============================*/
 uint8_t devAddr;
 uint8_t buffer[14];
+static TaskHandle_t stream_task_handle = NULL;
+static QueueHandle_t stream_queue = NULL;
+static bool streaming = false;								/*!< Streaming task must go on (atomic access) */
+static bool stream_task_stopped = false;					/*!< Streaming task left its loop (atomic access) */
+static uint32_t stream_period_us;							/*!< Sample period programmed (usec) */
+static mpu6050_stream_t stream_config;
+static mpu6050_block_t stream_block;						/*!< Block being filled */
+static uint8_t fifo_data[MPU6050_BLOCK_SIZE * MPU6050_FIFO_FRAME_SIZE];
+static uint32_t stream_overflows = 0;						/*!< Atomic access */
+static uint32_t stream_dropped = 0;							/*!< Blocks not queued, the queue was full (atomic access) */
+static float accel_lsb = 16384.0;							/*!< LSB per g */
+static float gyro_lsb = 131.0;								/*!< LSB per degree/sec */
 /*==================[internal functions declaration]=========================*/
+/** Read consecutive registers in a single transaction (repeated start between
+ * register selection and data).
+ * @param dev I2C slave device address
+ * @param reg First register to read
+ * @param data Buffer to store read data in
+ * @param len Number of bytes to read
+ */
+static void MPU6050_burstRead(uint8_t dev, uint8_t reg, uint8_t *data, uint16_t len){
+	i2c_read_t read = {dev, reg, len, data};
+	I2C_readBatch(&read, 1, I2C_MASTER_TIMEOUT_MS);
+}
+
+static void IRAM_ATTR MPU6050_dataReadyIsr(void *arg){
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	vTaskNotifyGiveFromISR(stream_task_handle, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/** Drain FIFO in blocks. The task wakes up on every data ready interruption
+ * (one per sample), but FIFO is only read when the interruptions counted complete
+ * the current block, or when they are missed for twice the time of a block.
+ */
+static void MPU6050_streamTask(void *pvParameter){
+	uint32_t pending = 0;
+	uint16_t fill = 0, count, frames, n;
+	uint32_t sequence = 0;
+	/* Wake up anyway if interruptions are missed */
+	TickType_t timeout = pdMS_TO_TICKS(2 * MPU6050_BLOCK_SIZE * stream_period_us / 1000) + 1;
+	while(__atomic_load_n(&streaming, __ATOMIC_ACQUIRE)){
+		n = ulTaskNotifyTake(pdTRUE, timeout);
+		pending += n;
+		if(!__atomic_load_n(&streaming, __ATOMIC_ACQUIRE)){
+			break;
+		}
+		if((n > 0) && (pending < (MPU6050_BLOCK_SIZE - fill))){
+			continue;
+		}
+		pending = 0;
+		MPU6050_burstRead(devAddr, MPU6050_RA_FIFO_COUNTH, fifo_data, 2);
+		count = (((uint16_t)fifo_data[0]) << 8) | fifo_data[1];
+		if(count >= MPU6050_FIFO_SIZE){
+			/* Oldest samples were overwritten and frames are no longer aligned */
+			MPU6050_resetFIFO();
+			__atomic_fetch_add(&stream_overflows, 1, __ATOMIC_RELAXED);
+			continue;
+		}
+		frames = count / MPU6050_FIFO_FRAME_SIZE;
+		while(frames > 0){
+			n = MPU6050_BLOCK_SIZE - fill;
+			if(n > frames){
+				n = frames;
+			}
+			MPU6050_burstRead(devAddr, MPU6050_RA_FIFO_R_W, fifo_data, n * MPU6050_FIFO_FRAME_SIZE);
+			MPU6050_parseFIFO(fifo_data, n * MPU6050_FIFO_FRAME_SIZE, &stream_block.accel[fill], &stream_block.gyro[fill]);
+			fill += n;
+			frames -= n;
+			if(fill == MPU6050_BLOCK_SIZE){
+				/* Samples still in FIFO are newer than the last one in the block */
+				stream_block.timestamp = esp_timer_get_time() - (int64_t)frames * stream_period_us;
+				stream_block.sequence = sequence++;
+				if(xQueueSend(stream_queue, &stream_block, 0) != pdTRUE){
+					/* Consumer is late: the block is lost, its sequence number is skipped */
+					__atomic_fetch_add(&stream_dropped, 1, __ATOMIC_RELAXED);
+				}
+				else if(stream_config.func_p != NULL){
+					((void (*)(void *))stream_config.func_p)(stream_config.param_p);
+				}
+				fill = 0;
+			}
+		}
+	}
+	/* Wait to be deleted by MPU6050_stopStreaming(), that may still notify the task */
+	__atomic_store_n(&stream_task_stopped, true, __ATOMIC_RELEASE);
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+	}
+}
 
 /*==================[external functions definition]==========================*/
 void MPU6050_ReadRegister(uint8_t reg, uint8_t *data, uint8_t len){
-	uint8_t dev = 0x68;
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(dev, reg);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (dev << 1) | I2C_MASTER_READ, 1));
-
-	if(len>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, len, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+len-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000));
-	i2c_cmd_link_delete(cmd);
+	MPU6050_burstRead(0x68, reg, data, len);
 }
 
 void MPU6050_Address(uint8_t address) {
@@ -2766,4 +2847,101 @@ void MPU6050_setDeviceID(uint8_t id) {
     I2C_writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id);
 }
 
+// FIFO streaming
+
+bool MPU6050_startStreaming(const mpu6050_stream_t *config) {
+    uint8_t divider;
+    if (streaming || (config->sample_rate < MPU6050_MIN_SAMPLE_RATE) || (config->sample_rate > MPU6050_MAX_SAMPLE_RATE)) {
+        return false;
+    }
+    stream_config = *config;
+    if (stream_queue == NULL) {
+        stream_queue = xQueueCreate(MPU6050_BLOCK_QTY, sizeof(mpu6050_block_t));
+    }
+    xQueueReset(stream_queue);
+    stream_overflows = 0;
+    stream_dropped = 0;
+    accel_lsb = 16384.0 / (1 << MPU6050_getFullScaleAccelRange());
+    gyro_lsb = 131.0 / (1 << MPU6050_getFullScaleGyroRange());
+
+    /* DLPF enabled: gyroscope output rate is 1kHz, same as accelerometer */
+    MPU6050_setDLPFMode(MPU6050_DLPF_BW_188);
+    divider = GYRO_OUTPUT_RATE / config->sample_rate - 1;
+    MPU6050_setRate(divider);
+    stream_period_us = (divider + 1) * (1000000 / GYRO_OUTPUT_RATE);
+    MPU6050_setFIFOEnabled(false);
+    I2C_writeByte(devAddr, MPU6050_RA_FIFO_EN, (1 << MPU6050_XG_FIFO_EN_BIT) | (1 << MPU6050_YG_FIFO_EN_BIT) |
+        (1 << MPU6050_ZG_FIFO_EN_BIT) | (1 << MPU6050_ACCEL_FIFO_EN_BIT));
+    MPU6050_resetFIFO();
+
+    __atomic_store_n(&streaming, true, __ATOMIC_RELEASE);
+    stream_task_stopped = false;
+    if (xTaskCreate(&MPU6050_streamTask, "MPU6050", STREAM_TASK_STACK, NULL, STREAM_TASK_PRIORITY, &stream_task_handle) != pdPASS) {
+        __atomic_store_n(&streaming, false, __ATOMIC_RELEASE);
+        return false;
+    }
+    GPIOInit(config->int_pin, GPIO_INPUT);
+    GPIOActivInt(config->int_pin, MPU6050_dataReadyIsr, true, NULL);
+    MPU6050_setIntEnabled(1 << MPU6050_INTERRUPT_DATA_RDY_BIT);
+    MPU6050_setFIFOEnabled(true);
+    return true;
+}
+
+void MPU6050_stopStreaming() {
+    if (!streaming) {
+        return;
+    }
+    /* No more notifications from the interruption once it returns */
+    GPIODeactivInt(stream_config.int_pin);
+    __atomic_store_n(&streaming, false, __ATOMIC_RELEASE);
+    xTaskNotifyGive(stream_task_handle);
+    while (!__atomic_load_n(&stream_task_stopped, __ATOMIC_ACQUIRE)) {
+        vTaskDelay(1);
+    }
+    vTaskDelete(stream_task_handle);
+    stream_task_handle = NULL;
+    MPU6050_setIntEnabled(0);
+    MPU6050_setFIFOEnabled(false);
+}
+
+bool MPU6050_readBlock(mpu6050_block_t *block, uint32_t timeout_ms) {
+    if (stream_queue == NULL) {
+        return false;
+    }
+    return (xQueueReceive(stream_queue, block, pdMS_TO_TICKS(timeout_ms)) == pdTRUE);
+}
+
+uint32_t MPU6050_getStreamOverflows() {
+    return __atomic_load_n(&stream_overflows, __ATOMIC_RELAXED);
+}
+
+uint32_t MPU6050_getStreamDroppedBlocks() {
+    return __atomic_load_n(&stream_dropped, __ATOMIC_RELAXED);
+}
+
+uint16_t MPU6050_parseFIFO(const uint8_t *data, uint16_t length, int16_t (*accel)[3], int16_t (*gyro)[3]) {
+    uint16_t samples = length / MPU6050_FIFO_FRAME_SIZE;
+    uint16_t i;
+    uint8_t axis;
+    for (i = 0; i < samples; i++) {
+        for (axis = 0; axis < 3; axis++) {
+            accel[i][axis] = (int16_t)((data[2*axis] << 8) | data[2*axis + 1]);
+            gyro[i][axis] = (int16_t)((data[6 + 2*axis] << 8) | data[6 + 2*axis + 1]);
+        }
+        data += MPU6050_FIFO_FRAME_SIZE;
+    }
+    return samples;
+}
+
+void MPU6050_scaleBlock(const mpu6050_block_t *block, float (*accel_g)[3], float (*gyro_dps)[3]) {
+    uint16_t i;
+    uint8_t axis;
+    for (i = 0; i < MPU6050_BLOCK_SIZE; i++) {
+        for (axis = 0; axis < 3; axis++) {
+            accel_g[i][axis] = block->accel[i][axis] / accel_lsb;
+            gyro_dps[i][axis] = block->gyro[i][axis] / gyro_lsb;
+        }
+    }
+}
+
 /*==================[end of file]============================================*/
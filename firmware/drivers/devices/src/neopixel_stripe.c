@@ -10,6 +10,7 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <stddef.h>
 #include "neopixel_stripe.h"
 #include "ws2812b.h"
 /*==================[macros and definitions]=================================*/
@@ -25,6 +26,7 @@
 uint16_t stripe_length;
 uint8_t stripe_bright = MAX_BRIGHT;
 neopixel_color_t *stripe_colors; 
+bool stripe_rmt = false;			/*> Stripe driven by hardware-timed (RMT) frames */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -38,11 +40,19 @@ neopixel_color_t *stripe_colors;
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array){
     stripe_length = len;
 	stripe_colors = color_array;
-    ws2812bInit(pin);
+	/* Bit-banging is only used if the RMT peripheral is not available */
+	stripe_rmt = ws2812bInitRmt(pin, len);
+	if(!stripe_rmt){
+    	ws2812bInit(pin);
+	}
 }
 
 void NeoPixelAllOff(void){
     rgb_led_t led;
+	if(stripe_rmt){
+		ws2812bSendFrame(NULL);
+		return;
+	}
 	ws2812bSendRet();
 	ws2812bSendRet();
 	ws2812bSendRet();
@@ -70,6 +80,11 @@ void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color){
 void NeoPixelSetArray(neopixel_color_t *color_array){
     rgb_led_t led;
 	uint16_t red, green, blue;
+	if(stripe_rmt){
+		/* Brightness and gamma are applied by the encoder */
+		ws2812bSendFrame(color_array);
+		return;
+	}
 	ws2812bSendRet();
 	ws2812bSendRet();
 	ws2812bSendRet();
@@ -106,6 +121,9 @@ void NeoPixelShift(bool upwards){
 
 void NeoPixelBrightness(uint8_t bright){
 	stripe_bright = bright;
+	if(stripe_rmt){
+		ws2812bSetBrightness(bright);
+	}
 	NeoPixelSetArray(stripe_colors);
 }
 
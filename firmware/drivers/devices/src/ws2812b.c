@@ -11,20 +11,62 @@
 
 /*==================[inclusions]=============================================*/
 #include "ws2812b.h"
+#include <stdlib.h>
 #include "gpio_mcu.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/rmt_tx.h"
 #include "gpio_fast_out_mcu.h"
 #include "delay_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define RET_CMD (50)    // ret command 50us low
 #define BIT_0   (1)     // bit 0
 #define BIT_7   (1<<7)  // bit 0
+#define RMT_RESOLUTION_HZ   10000000    // 0.1us per RMT tick
+#define RMT_MEM_SYMBOLS     48          // RMT channel memory (in symbols)
+#define T0H_TICKS           4           // bit 0 high time: 0.4us
+#define T0L_TICKS           8           // bit 0 low time: 0.8us
+#define T1H_TICKS           8           // bit 1 high time: 0.8us
+#define T1L_TICKS           4           // bit 1 low time: 0.4us
+#define RET_TICKS           (RET_CMD * RMT_RESOLUTION_HZ / 1000000 / 2)   // half of the ret command (each symbol has 2 levels)
+#define BITS_PER_LED        24          // GRB, 8 bits each
+#define FRAME_BUFFERS       2           // Frame being transmitted and frame being encoded
 /*==================[internal data declaration]==============================*/
 gpio_t pin_number;
+rmt_channel_handle_t rmt_channel = NULL;        // RMT channel (NULL if not using hardware timing)
+rmt_encoder_handle_t rmt_encoder = NULL;        // Copy encoder: frames are already encoded as symbols
+SemaphoreHandle_t free_frames = NULL;           // Frame buffers not pending transmission
+rmt_symbol_word_t *frame_buffer[FRAME_BUFFERS]; // Encoded frames (one symbol per bit plus ret command)
+uint8_t next_frame = 0;                         // Next frame buffer to encode
+uint16_t frame_leds = 0;                        // NeoPixels in stripe
+uint8_t color_lut[256];                         // Brightness and gamma correction per color level
 /*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR rmt_tx_done_isr(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *edata, void *user_data){
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xSemaphoreGiveFromISR(free_frames, &xHigherPriorityTaskWoken);
+    return (xHigherPriorityTaskWoken == pdTRUE);
+}
+
+/**
+ * @brief Release the RMT channel, encoder, semaphore and frame buffers allocated by
+ * ws2812bInitRmt() (the ones not allocated are NULL).
+ */
+static void ws2812bFreeRmt(void);
 
 /*==================[internal data definition]===============================*/
+static const rmt_symbol_word_t bit_0 = {
+    .level0 = 1, .duration0 = T0H_TICKS,
+    .level1 = 0, .duration1 = T0L_TICKS,
+};
+static const rmt_symbol_word_t bit_1 = {
+    .level0 = 1, .duration0 = T1H_TICKS,
+    .level1 = 0, .duration1 = T1L_TICKS,
+};
+static const rmt_symbol_word_t ret_cmd = {
+    .level0 = 0, .duration0 = RET_TICKS,
+    .level1 = 0, .duration1 = RET_TICKS,
+};
 static const uint8_t gamma_table[256] = {
     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
     0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,
@@ -47,6 +89,26 @@ static const uint8_t gamma_table[256] = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void ws2812bFreeRmt(void){
+    uint8_t i;
+    if(rmt_channel != NULL){
+        rmt_del_channel(rmt_channel);
+        rmt_channel = NULL;
+    }
+    if(rmt_encoder != NULL){
+        rmt_del_encoder(rmt_encoder);
+        rmt_encoder = NULL;
+    }
+    if(free_frames != NULL){
+        vSemaphoreDelete(free_frames);
+        free_frames = NULL;
+    }
+    free(frame_buffer[0]);
+    for(i=0; i<FRAME_BUFFERS; i++){
+        frame_buffer[i] = NULL;
+    }
+}
+
 void IRAM_ATTR ws2812bSendHigh(gpio_t pin){
     GPIOFastWrite(1);
     //delay 0.8us
@@ -373,4 +435,101 @@ void ws2812bSendRet(void){
     DelayUs(RET_CMD);
 }
 
+bool ws2812bInitRmt(gpio_t pin, uint16_t len){
+    uint8_t i;
+    uint32_t frame_symbols = len * BITS_PER_LED + 1;
+    pin_number = pin;
+    frame_leds = len;
+    /* All frame buffers in one allocation */
+    frame_buffer[0] = malloc(FRAME_BUFFERS * frame_symbols * sizeof(rmt_symbol_word_t));
+    if(frame_buffer[0] == NULL){
+        return false;
+    }
+    for(i=1; i<FRAME_BUFFERS; i++){
+        frame_buffer[i] = frame_buffer[0] + i * frame_symbols;
+    }
+    rmt_tx_channel_config_t channel_config = {
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .gpio_num = pin,
+        .mem_block_symbols = RMT_MEM_SYMBOLS,
+        .resolution_hz = RMT_RESOLUTION_HZ,
+        .trans_queue_depth = FRAME_BUFFERS,
+    };
+    if(rmt_new_tx_channel(&channel_config, &rmt_channel) != ESP_OK){
+        rmt_channel = NULL;
+        ws2812bFreeRmt();
+        return false;
+    }
+    rmt_copy_encoder_config_t encoder_config = {};
+    if(rmt_new_copy_encoder(&encoder_config, &rmt_encoder) != ESP_OK){
+        rmt_encoder = NULL;
+        ws2812bFreeRmt();
+        return false;
+    }
+    free_frames = xSemaphoreCreateCounting(FRAME_BUFFERS, FRAME_BUFFERS);
+    if(free_frames == NULL){
+        ws2812bFreeRmt();
+        return false;
+    }
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = rmt_tx_done_isr,
+    };
+    if((rmt_tx_register_event_callbacks(rmt_channel, &callbacks, NULL) != ESP_OK) || (rmt_enable(rmt_channel) != ESP_OK)){
+        ws2812bFreeRmt();
+        return false;
+    }
+    ws2812bSetBrightness(UINT8_MAX);
+    return true;
+}
+
+void ws2812bSetBrightness(uint8_t bright){
+    uint16_t i;
+    for(i=0; i<256; i++){
+        color_lut[i] = ws2812bGammaCorrection((i * bright) >> 8);
+    }
+}
+
+bool ws2812bSendFrame(const uint32_t *colors){
+    uint16_t i;
+    uint32_t grb;
+    int8_t bit;
+    rmt_symbol_word_t *symbol;
+    rmt_transmit_config_t transmit_config = {
+        .loop_count = 0,
+    };
+
+    if(rmt_channel == NULL){
+        return false;
+    }
+    /* Wait for a buffer that isn't on the wire */
+    xSemaphoreTake(free_frames, portMAX_DELAY);
+    symbol = frame_buffer[next_frame];
+    for(i=0; i<frame_leds; i++){
+        grb = 0;
+        if(colors != NULL){
+            grb = (color_lut[(colors[i] >> 8) & 0xFF] << 16) |     // Green
+                  (color_lut[(colors[i] >> 16) & 0xFF] << 8) |     // Red
+                  color_lut[colors[i] & 0xFF];                      // Blue
+        }
+        for(bit=BITS_PER_LED-1; bit>=0; bit--){
+            *symbol++ = (grb & (1 << bit)) ? bit_1 : bit_0;
+        }
+    }
+    *symbol = ret_cmd;
+    if(rmt_transmit(rmt_channel, rmt_encoder, frame_buffer[next_frame], 
+        (frame_leds * BITS_PER_LED + 1) * sizeof(rmt_symbol_word_t), &transmit_config) != ESP_OK){
+        /* No transmission done interruption will free the buffer */
+        xSemaphoreGive(free_frames);
+        return false;
+    }
+    next_frame = (next_frame + 1) % FRAME_BUFFERS;
+    return true;
+}
+
+void ws2812bWaitFrame(void){
+    if(rmt_channel != NULL){
+        rmt_tx_wait_all_done(rmt_channel, portMAX_DELAY);
+    }
+}
+
 /*==================[end of file]============================================*/
@@ -0,0 +1,274 @@
+/**
+ * @file mock_adc.c
+ * @brief Host mock of the ESP-IDF ADC continuous mode driver, replaying recorded signals
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "mock_adc.h"
+#include "esp_adc/adc_oneshot.h"
+#include "esp_adc/adc_cali_scheme.h"
+#include "driver/sdm.h"
+/*==================[macros and definitions]=================================*/
+#define MOCK_ADC_PATTERN	8			/*!< Maximun pattern lenght */
+
+/**
+ * @brief ADC continuous mode handle
+ */
+struct mock_adc_continuous {
+	adc_continuous_handle_cfg_t config;
+	adc_continuous_evt_cbs_t callbacks;
+	void *user_data;
+	adc_digi_pattern_config_t pattern[MOCK_ADC_PATTERN];
+	uint32_t pattern_num;
+	uint32_t next;					/*!< Pattern entry of the next conversion */
+	uint8_t *store;					/*!< Ring of frames */
+	uint32_t frames;				/*!< Frames that fit in the store */
+	uint32_t head;					/*!< Oldest frame stored */
+};
+
+/**
+ * @brief Signal replayed by a channel
+ */
+typedef struct {
+	const uint16_t *samples;
+	uint32_t lenght;
+	uint32_t position;				/*!< Next sample converted */
+} replay_t;
+/*==================[internal data declaration]==============================*/
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;		/*!< Converter, driver task and configuration run in different threads */
+static struct mock_adc_continuous *adc = NULL;
+static replay_t replays[MOCK_ADC_CHANNELS];
+static mock_adc_stats_t stats;
+/*==================[internal functions declaration]=========================*/
+/** @brief Convert a frame in the store (with the lock held) */
+static bool ConvertFrame(void);
+
+/*==================[internal functions definition]==========================*/
+static bool ConvertFrame(void){
+	uint32_t results = adc->config.conv_frame_size / SOC_ADC_DIGI_RESULT_BYTES, i;
+	adc_digi_output_data_t *result;
+	adc_digi_pattern_config_t *entry;
+	replay_t *replay;
+	uint8_t *frame;
+
+	if (stats.stored == adc->frames){
+		stats.dropped++;
+		return false;
+	}
+	frame = &adc->store[((adc->head + stats.stored) % adc->frames) * adc->config.conv_frame_size];
+	for (i = 0; i < results; i++){
+		entry = &adc->pattern[adc->next];
+		adc->next = (adc->next + 1) % adc->pattern_num;
+		replay = &replays[entry->channel];
+		result = (adc_digi_output_data_t *)&frame[i * SOC_ADC_DIGI_RESULT_BYTES];
+		result->val = 0;
+		result->type2.channel = entry->channel;
+		result->type2.unit = entry->unit;
+		if (replay->lenght > 0){
+			result->type2.data = replay->samples[replay->position];
+			replay->position = (replay->position + 1) % replay->lenght;
+		}
+	}
+	stats.stored++;
+	return true;
+}
+
+/*==================[external functions definition]==========================*/
+void MockAdcReplay(uint8_t channel, const uint16_t *samples, uint32_t lenght){
+	pthread_mutex_lock(&lock);
+	replays[channel].samples = samples;
+	replays[channel].lenght = lenght;
+	replays[channel].position = 0;
+	pthread_mutex_unlock(&lock);
+}
+
+uint32_t MockAdcConvert(uint32_t frames){
+	adc_continuous_evt_data_t event;
+	uint32_t converted;
+	bool stored;
+
+	for (converted = 0; converted < frames; converted++){
+		pthread_mutex_lock(&lock);
+		if ((adc == NULL) || !stats.running){
+			pthread_mutex_unlock(&lock);
+			break;
+		}
+		stored = ConvertFrame();
+		stats.converted++;
+		event.conv_frame_buffer = NULL;
+		event.size = adc->config.conv_frame_size;
+		pthread_mutex_unlock(&lock);
+		/* Interruption context: outside of the lock, as the callback may read frames */
+		if (stored && (adc->callbacks.on_conv_done != NULL)){
+			adc->callbacks.on_conv_done(adc, &event, adc->user_data);
+		}
+		else if (!stored && (adc->callbacks.on_pool_ovf != NULL)){
+			adc->callbacks.on_pool_ovf(adc, &event, adc->user_data);
+		}
+	}
+	return converted;
+}
+
+void MockAdcGetStats(mock_adc_stats_t *stats_out){
+	pthread_mutex_lock(&lock);
+	*stats_out = stats;
+	pthread_mutex_unlock(&lock);
+}
+
+esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *hdl_config, adc_continuous_handle_t *ret_handle){
+	struct mock_adc_continuous *handle;
+
+	if ((hdl_config->conv_frame_size == 0) || (hdl_config->max_store_buf_size < hdl_config->conv_frame_size)){
+		return ESP_ERR_INVALID_ARG;
+	}
+	if ((handle = calloc(1, sizeof(struct mock_adc_continuous))) == NULL){
+		return ESP_ERR_NO_MEM;
+	}
+	handle->config = *hdl_config;
+	handle->frames = hdl_config->max_store_buf_size / hdl_config->conv_frame_size;
+	if ((handle->store = malloc(handle->frames * hdl_config->conv_frame_size)) == NULL){
+		free(handle);
+		return ESP_ERR_NO_MEM;
+	}
+	pthread_mutex_lock(&lock);
+	adc = handle;
+	pthread_mutex_unlock(&lock);
+	*ret_handle = handle;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_config(adc_continuous_handle_t handle, const adc_continuous_config_t *config){
+	uint32_t i;
+
+	if ((config->pattern_num == 0) || (config->pattern_num > MOCK_ADC_PATTERN)){
+		return ESP_ERR_INVALID_ARG;
+	}
+	for (i = 0; i < config->pattern_num; i++){
+		if ((config->adc_pattern[i].channel >= MOCK_ADC_CHANNELS) || (config->adc_pattern[i].unit != ADC_UNIT_1)){
+			return ESP_ERR_INVALID_ARG;
+		}
+	}
+	if ((config->sample_freq_hz < SOC_ADC_SAMPLE_FREQ_THRES_LOW) || (config->sample_freq_hz > SOC_ADC_SAMPLE_FREQ_THRES_HIGH)){
+		return ESP_ERR_INVALID_ARG;
+	}
+	pthread_mutex_lock(&lock);
+	if (stats.running){
+		stats.refused++;
+		pthread_mutex_unlock(&lock);
+		return ESP_ERR_INVALID_STATE;
+	}
+	memcpy(handle->pattern, config->adc_pattern, config->pattern_num * sizeof(adc_digi_pattern_config_t));
+	handle->pattern_num = config->pattern_num;
+	handle->next = 0;
+	stats.configs++;
+	pthread_mutex_unlock(&lock);
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_register_event_callbacks(adc_continuous_handle_t handle, const adc_continuous_evt_cbs_t *cbs, void *user_data){
+	pthread_mutex_lock(&lock);
+	if (stats.running){
+		stats.refused++;
+		pthread_mutex_unlock(&lock);
+		return ESP_ERR_INVALID_STATE;
+	}
+	handle->callbacks = *cbs;
+	handle->user_data = user_data;
+	pthread_mutex_unlock(&lock);
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_start(adc_continuous_handle_t handle){
+	esp_err_t err = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if (stats.running || (handle->pattern_num == 0)){
+		stats.refused++;
+		err = ESP_ERR_INVALID_STATE;
+	}
+	else{
+		stats.running = true;
+	}
+	pthread_mutex_unlock(&lock);
+	return err;
+}
+
+esp_err_t adc_continuous_stop(adc_continuous_handle_t handle){
+	esp_err_t err = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if (!stats.running){
+		stats.refused++;
+		err = ESP_ERR_INVALID_STATE;
+	}
+	else{
+		stats.running = false;
+	}
+	pthread_mutex_unlock(&lock);
+	return err;
+}
+
+esp_err_t adc_continuous_read(adc_continuous_handle_t handle, uint8_t *buf, uint32_t length_max, uint32_t *out_length, uint32_t timeout_ms){
+	uint32_t lenght;
+
+	pthread_mutex_lock(&lock);
+	if (!stats.running){
+		pthread_mutex_unlock(&lock);
+		return ESP_ERR_INVALID_STATE;
+	}
+	/* Frames are not waited for */
+	if (stats.stored == 0){
+		pthread_mutex_unlock(&lock);
+		return ESP_ERR_TIMEOUT;
+	}
+	lenght = (length_max < handle->config.conv_frame_size) ? length_max : handle->config.conv_frame_size;
+	memcpy(buf, &handle->store[handle->head * handle->config.conv_frame_size], lenght);
+	handle->head = (handle->head + 1) % handle->frames;
+	stats.stored--;
+	stats.read++;
+	*out_length = lenght;
+	pthread_mutex_unlock(&lock);
+	return ESP_OK;
+}
+
+esp_err_t adc_oneshot_new_unit(const adc_oneshot_unit_init_cfg_t *init_config, adc_oneshot_unit_handle_t *ret_unit){
+	*ret_unit = NULL;
+	return ESP_OK;
+}
+
+esp_err_t adc_oneshot_config_channel(adc_oneshot_unit_handle_t handle, adc_channel_t channel, const adc_oneshot_chan_cfg_t *config){
+	return ESP_OK;
+}
+
+esp_err_t adc_oneshot_read(adc_oneshot_unit_handle_t handle, adc_channel_t chan, int *out_raw){
+	*out_raw = 0;
+	return ESP_OK;
+}
+
+esp_err_t adc_cali_create_scheme_curve_fitting(const adc_cali_curve_fitting_config_t *config, adc_cali_handle_t *ret_handle){
+	*ret_handle = NULL;
+	return ESP_OK;
+}
+
+esp_err_t sdm_new_channel(const sdm_config_t *config, sdm_channel_handle_t *ret_chan){
+	*ret_chan = NULL;
+	return ESP_OK;
+}
+
+esp_err_t sdm_channel_enable(sdm_channel_handle_t chan){
+	return ESP_OK;
+}
+
+esp_err_t sdm_channel_set_pulse_density(sdm_channel_handle_t chan, int8_t density){
+	return ESP_OK;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,78 @@
+#ifndef MOCK_ADC_H_
+#define MOCK_ADC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of the ESP-IDF ADC continuous mode driver, replaying recorded signals
+ *
+ * Each channel replays its recorded signal, from the start and looping at its end. While
+ * the ADC runs, MockAdcConvert() converts frames following the configured pattern: they
+ * are stored and the conversion done callback is called, as the DMA interruption does.
+ * Frames converted while the store is full are dropped. As in ESP-IDF, the ADC can't be
+ * configured while it runs. Single reads, calibration and the DAC do nothing.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "esp_adc/adc_continuous.h"
+/*==================[macros]=================================================*/
+#define MOCK_ADC_CHANNELS	7			/*!< Channels of ADC unit 1 */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief ADC continuous mode driver state
+ */
+typedef struct {
+	uint32_t configs;			/*!< Configurations done */
+	uint32_t refused;			/*!< Calls refused: configuration, start or stop in the wrong state */
+	uint32_t converted;			/*!< Frames converted */
+	uint32_t dropped;			/*!< Frames dropped by a full store */
+	uint32_t read;				/*!< Frames read */
+	uint32_t stored;			/*!< Frames stored, not read yet */
+	bool running;				/*!< ADC started */
+} mock_adc_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Set the signal replayed by a channel, from its first sample
+ *
+ * @param channel Channel (ADC_CHANNEL_0 ...)
+ * @param samples Raw 12 bits samples (kept, not copied)
+ * @param lenght Number of samples, looped
+ */
+void MockAdcReplay(uint8_t channel, const uint16_t *samples, uint32_t lenght);
+
+/**
+ * @brief Convert frames, calling the conversion done callback after each one
+ *
+ * @param frames Frames to convert
+ * @return Frames converted: 0 if the ADC is stopped
+ */
+uint32_t MockAdcConvert(uint32_t frames);
+
+/**
+ * @brief Get the ADC continuous mode driver state
+ *
+ * @param stats State (output)
+ */
+void MockAdcGetStats(mock_adc_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_ADC_H_ */
+
+/*==================[end of file]============================================*/
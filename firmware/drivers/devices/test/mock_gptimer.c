@@ -0,0 +1,216 @@
+/**
+ * @file mock_gptimer.c
+ * @brief Host mock of the ESP-IDF general purpose timer driver, and of the ROM delay
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <pthread.h>
+#include <stdlib.h>
+#include "mock_gptimer.h"
+#include "esp_rom_sys.h"
+/*==================[macros and definitions]=================================*/
+/**
+ * @brief General purpose timer
+ */
+struct mock_gptimer {
+	gptimer_event_callbacks_t callbacks;
+	void *user_data;
+	bool enabled;
+	bool started;
+	uint64_t count;
+	bool alarm_enabled;
+	uint64_t alarm;
+};
+/*==================[internal data declaration]==============================*/
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;	/*!< Protects the timer and the counters */
+static mock_gptimer_stats_t stats;
+static struct mock_gptimer *last_timer;		/*!< Last timer created: the one moved by the test */
+static uint32_t read_time;					/*!< Counts moved by each read */
+/*==================[internal functions declaration]=========================*/
+/** @brief Count a call refused (lock taken), returning its error */
+static esp_err_t Refuse(esp_err_t error);
+
+/*==================[internal functions definition]==========================*/
+static esp_err_t Refuse(esp_err_t error){
+	stats.refused++;
+	return error;
+}
+
+/*==================[external functions definition]==========================*/
+void MockGptimerReset(void){
+	pthread_mutex_lock(&lock);
+	stats.reads = 0;
+	stats.alarms_set = 0;
+	stats.alarms_late = 0;
+	stats.alarms_fired = 0;
+	stats.rom_delays = 0;
+	stats.refused = 0;
+	pthread_mutex_unlock(&lock);
+}
+
+void MockGptimerGetStats(mock_gptimer_stats_t *stats_out){
+	pthread_mutex_lock(&lock);
+	*stats_out = stats;
+	if (last_timer != NULL){
+		stats_out->running = last_timer->enabled && last_timer->started;
+		stats_out->count = last_timer->count;
+		stats_out->alarm_enabled = last_timer->alarm_enabled;
+		stats_out->alarm = last_timer->alarm;
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+void MockGptimerAdvance(uint32_t usec){
+	struct mock_gptimer *timer;
+	gptimer_alarm_event_data_t edata;
+	bool fire = false;
+
+	pthread_mutex_lock(&lock);
+	timer = last_timer;
+	if ((timer != NULL) && timer->enabled && timer->started){
+		timer->count += usec;
+		if (timer->alarm_enabled && (timer->count >= timer->alarm) && (timer->callbacks.on_alarm != NULL)){
+			/* One shot: the driver programs the next alarm from the callback */
+			timer->alarm_enabled = false;
+			edata.count_value = timer->count;
+			edata.alarm_value = timer->alarm;
+			stats.alarms_fired++;
+			fire = true;
+		}
+	}
+	pthread_mutex_unlock(&lock);
+	if (fire){
+		timer->callbacks.on_alarm(timer, &edata, timer->user_data);
+	}
+}
+
+void MockGptimerSetReadTime(uint32_t usec){
+	pthread_mutex_lock(&lock);
+	read_time = usec;
+	pthread_mutex_unlock(&lock);
+}
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *config, gptimer_handle_t *ret_timer){
+	struct mock_gptimer *timer;
+	esp_err_t error = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if ((config == NULL) || (ret_timer == NULL) || (config->resolution_hz == 0)){
+		error = Refuse(ESP_ERR_INVALID_ARG);
+	}
+	else if ((timer = calloc(1, sizeof(struct mock_gptimer))) == NULL){
+		error = ESP_ERR_NO_MEM;
+	}
+	else{
+		last_timer = timer;
+		stats.timers++;
+		*ret_timer = timer;
+	}
+	pthread_mutex_unlock(&lock);
+	return error;
+}
+
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t timer, const gptimer_event_callbacks_t *cbs, void *user_data){
+	esp_err_t error = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if ((timer == NULL) || (cbs == NULL)){
+		error = Refuse(ESP_ERR_INVALID_ARG);
+	}
+	else if (timer->enabled){
+		error = Refuse(ESP_ERR_INVALID_STATE);
+	}
+	else{
+		timer->callbacks = *cbs;
+		timer->user_data = user_data;
+	}
+	pthread_mutex_unlock(&lock);
+	return error;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t timer){
+	esp_err_t error = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if (timer == NULL){
+		error = Refuse(ESP_ERR_INVALID_ARG);
+	}
+	else if (timer->enabled){
+		error = Refuse(ESP_ERR_INVALID_STATE);
+	}
+	else{
+		timer->enabled = true;
+	}
+	pthread_mutex_unlock(&lock);
+	return error;
+}
+
+esp_err_t gptimer_start(gptimer_handle_t timer){
+	esp_err_t error = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if (timer == NULL){
+		error = Refuse(ESP_ERR_INVALID_ARG);
+	}
+	else if (!timer->enabled || timer->started){
+		error = Refuse(ESP_ERR_INVALID_STATE);
+	}
+	else{
+		timer->started = true;
+	}
+	pthread_mutex_unlock(&lock);
+	return error;
+}
+
+esp_err_t gptimer_get_raw_count(gptimer_handle_t timer, uint64_t *value){
+	esp_err_t error = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if ((timer == NULL) || (value == NULL)){
+		error = Refuse(ESP_ERR_INVALID_ARG);
+	}
+	else{
+		*value = timer->count;
+		if (timer->enabled && timer->started){
+			timer->count += read_time;
+		}
+		stats.reads++;
+	}
+	pthread_mutex_unlock(&lock);
+	return error;
+}
+
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t timer, const gptimer_alarm_config_t *config){
+	esp_err_t error = ESP_OK;
+
+	pthread_mutex_lock(&lock);
+	if (timer == NULL){
+		error = Refuse(ESP_ERR_INVALID_ARG);
+	}
+	else if (config == NULL){
+		timer->alarm_enabled = false;
+	}
+	else{
+		timer->alarm_enabled = true;
+		timer->alarm = config->alarm_count;
+		stats.alarms_set++;
+		if (config->alarm_count <= timer->count){
+			stats.alarms_late++;
+		}
+	}
+	pthread_mutex_unlock(&lock);
+	return error;
+}
+
+void esp_rom_delay_us(uint32_t us){
+	pthread_mutex_lock(&lock);
+	stats.rom_delays++;
+	pthread_mutex_unlock(&lock);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,87 @@
+#ifndef MOCK_GPTIMER_H_
+#define MOCK_GPTIMER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of the ESP-IDF general purpose timer driver, and of the ROM delay
+ *
+ * The count of the timer only moves when the test moves it, so deadlines and latencies
+ * are exact whatever the host scheduler does. When the count reaches the alarm, the alarm
+ * callback runs in the thread of the test, as an interruption would: outside the critical
+ * sections of the tasks. An alarm programmed at or before the count fires at the next move.
+ * Each count read can move the count forward, as the time the code takes between two reads.
+ * Calls ESP-IDF refuses (bad arguments, callbacks registered on an enabled timer, a timer
+ * started before being enabled) are counted. The ROM delay returns at once.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driver/gptimer.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief General purpose timer driver state (counters since the last MockGptimerReset())
+ */
+typedef struct {
+	uint32_t timers;			/*!< Timers created (not reset) */
+	bool running;				/*!< Last timer created enabled and started (not reset) */
+	uint64_t count;				/*!< Count of the last timer created (not reset) */
+	bool alarm_enabled;			/*!< Alarm of the last timer created programmed (not reset) */
+	uint64_t alarm;				/*!< Alarm count, if programmed (not reset) */
+	uint32_t reads;				/*!< Count reads */
+	uint32_t alarms_set;		/*!< Alarms programmed */
+	uint32_t alarms_late;		/*!< Alarms programmed at or before the count */
+	uint32_t alarms_fired;		/*!< Alarm callback calls */
+	uint32_t rom_delays;		/*!< ROM delays */
+	uint32_t refused;			/*!< Calls refused */
+} mock_gptimer_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Clear the counters
+ */
+void MockGptimerReset(void);
+
+/**
+ * @brief Get the general purpose timer driver state
+ *
+ * @param stats State (output)
+ */
+void MockGptimerGetStats(mock_gptimer_stats_t *stats);
+
+/**
+ * @brief Move the count of the running timer forward, and call the alarm callback if the
+ * count reaches the alarm
+ *
+ * @param usec Counts (microseconds at 1 MHz)
+ */
+void MockGptimerAdvance(uint32_t usec);
+
+/**
+ * @brief Move the count forward after each read, as the time taken by the code between reads
+ *
+ * @param usec Counts (0: the count only moves with MockGptimerAdvance())
+ */
+void MockGptimerSetReadTime(uint32_t usec);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_GPTIMER_H_ */
+
+/*==================[end of file]============================================*/
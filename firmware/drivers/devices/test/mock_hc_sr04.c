@@ -0,0 +1,88 @@
+/**
+ * @file mock_hc_sr04.c
+ * @brief Host mock of the GPIO and delay drivers with an HC-SR04 behind them
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "mock_hc_sr04.h"
+#include "delay_mcu.h"
+#include "mock_rtos.h"
+/*==================[macros and definitions]=================================*/
+#define US_PER_CM	59			/*!< Echo width per cm of distance */
+
+/*==================[internal data declaration]==============================*/
+static gpio_t echo_pin, trigger_pin;
+static uint16_t distance;			/*!< Distance in mm (0: no echo) */
+static uint8_t echo_level;			/*!< Level of the echo pin */
+static uint32_t echoes;
+static int32_t isr_pin = -1;		/*!< Pin with an interruption enabled (-1: none) */
+static void (*isr)(void *);
+static void *isr_arg;
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void MockHcSr04Connect(gpio_t echo, gpio_t trigger){
+	echo_pin = echo;
+	trigger_pin = trigger;
+	echoes = 0;
+}
+
+void MockHcSr04Distance(uint16_t distance_mm){
+	distance = distance_mm;
+}
+
+uint32_t MockHcSr04Echoes(void){
+	return echoes;
+}
+
+void GPIOInit(gpio_t pin, io_t io){
+}
+
+void GPIOOn(gpio_t pin){
+}
+
+void GPIOOff(gpio_t pin){
+	/* End of the trigger pulse: echo pulse, seen only by an interruption on the echo pin */
+	if ((pin != trigger_pin) || (distance == 0) || (isr_pin != echo_pin)){
+		return;
+	}
+	echoes++;
+	echo_level = 1;
+	isr(isr_arg);
+	/* The echo lasts its width even if the host preempts this thread */
+	MockRtosAdvanceTime(distance * US_PER_CM / 10);
+	echo_level = 0;
+	isr(isr_arg);
+}
+
+bool GPIORead(gpio_t pin){
+	return (pin == echo_pin) && echo_level;
+}
+
+void GPIOActivIntBothEdges(gpio_t pin, void *ptr_int_func, void *args){
+	isr_pin = pin;
+	isr = ptr_int_func;
+	isr_arg = args;
+}
+
+void GPIODeactivInt(gpio_t pin){
+	if (pin == isr_pin){
+		isr_pin = -1;
+	}
+}
+
+void GPIODeinit(void){
+}
+
+void DelayUs(uint16_t usec){
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,62 @@
+#ifndef MOCK_HC_SR04_H_
+#define MOCK_HC_SR04_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of the GPIO and delay drivers with an HC-SR04 behind them
+ *
+ * The sensor is wired to an echo and a trigger pin. At the end of a trigger pulse
+ * (GPIOOff() of the trigger pin) it answers with an echo pulse as wide as the distance
+ * set, calling the interruption of the echo pin at both edges. The echo is lost when
+ * the interruption is enabled on another pin.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Wire the sensor
+ *
+ * @param echo GPIO connected to the echo pin
+ * @param trigger GPIO connected to the trigger pin
+ */
+void MockHcSr04Connect(gpio_t echo, gpio_t trigger);
+
+/**
+ * @brief Set the distance to the obstacle
+ *
+ * @param distance_mm Distance in mm (0: no echo)
+ */
+void MockHcSr04Distance(uint16_t distance_mm);
+
+/**
+ * @brief Get the echo pulses seen by an interruption since MockHcSr04Connect()
+ *
+ * @return Echo pulses
+ */
+uint32_t MockHcSr04Echoes(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_HC_SR04_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,287 @@
+/**
+ * @file mock_lcd.c
+ * @brief Host mock of the SPI, GPIO and delay drivers with an ILI9341 model behind it
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "mock_lcd.h"
+#include "spi_mcu.h"
+#include "gpio_mcu.h"
+#include "delay_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MOCK_SMALL_TX		4		/*!< Writes up to this size (bytes) are copied into the transaction */
+#define RESET				0x01 	/*!< Resets the commands and parameters to their S/W Reset default values */
+#define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
+#define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
+#define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VERT_SCROLL_DEF		0x33 	/*!< Define the vertical scrolling area of the display */
+#define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
+#define VERT_SCROLL_ADDR	0x37 	/*!< Frame memory line shown at the top of the vertical scrolling area */
+#define MADCTL_MY			0x80	/*!< Row address order */
+#define MADCTL_MX			0x40	/*!< Column address order */
+#define MADCTL_MV			0x20	/*!< Row/column exchange */
+#define LCD_PARAM_MAX		6		/*!< Parameters kept of each command */
+
+/**
+ * @brief Queued SPI transaction
+ */
+typedef struct {
+	const uint8_t *buffer;			/*!< Data, read when the transaction is done */
+	uint8_t tx_data[MOCK_SMALL_TX];	/*!< Copy of short writes */
+	uint32_t size;					/*!< Bytes to write */
+	spi_dc_t dc;					/*!< Data/command pin level */
+} mock_trans_t;
+/*==================[internal data declaration]==============================*/
+static mock_trans_t queue[SPI_QUEUE_SIZE];	/*!< Transactions in flight */
+static uint8_t queue_first, queue_count;
+static mock_lcd_stats_t stats;
+
+static uint8_t lcd_cmd;						/*!< Last command received */
+static uint8_t lcd_param[LCD_PARAM_MAX];	/*!< Parameters of the last command */
+static uint8_t lcd_param_count;
+static uint16_t lcd_x0, lcd_x1, lcd_y0, lcd_y1;	/*!< Address window */
+static uint16_t lcd_x, lcd_y;				/*!< Memory write position */
+static uint8_t lcd_high;					/*!< First byte of the pixel being written */
+static uint8_t lcd_high_valid;
+static uint8_t lcd_madctl;					/*!< Memory access control (MY, MX and MV are modelled) */
+static uint16_t lcd_tfa, lcd_vsa = MOCK_LCD_HEIGHT;	/*!< Top fixed and vertical scrolling areas */
+static uint16_t lcd_vsp;					/*!< Vertical scrolling start address */
+/*==================[external data definition]===============================*/
+uint16_t mock_lcd_frame[MOCK_LCD_HEIGHT][MOCK_LCD_WIDTH];
+/*==================[internal functions declaration]=========================*/
+/** @brief ILI9341 model: decode a byte sent to the LCD */
+static void LcdByte(uint8_t byte, spi_dc_t dc);
+
+/** @brief Frame memory line and column of a column and page address (0: outside the frame memory, line and column 0) */
+static uint8_t LcdPosition(uint16_t x, uint16_t y, uint16_t *line, uint16_t *column);
+
+/** @brief Frame memory line shown on a line of the display, with the vertical scroll */
+static uint16_t LcdLine(uint16_t line);
+
+/** @brief Run the oldest queued transaction */
+static void TransDone(void);
+/*==================[internal functions definition]==========================*/
+static void LcdByte(uint8_t byte, spi_dc_t dc){
+	uint16_t line, column;
+
+	if (dc == SPI_DC_COMMAND){
+		lcd_cmd = byte;
+		lcd_param_count = 0;
+		lcd_high_valid = 0;
+		if (lcd_cmd == RESET){
+			lcd_madctl = 0;
+			lcd_tfa = 0;
+			lcd_vsa = MOCK_LCD_HEIGHT;
+			lcd_vsp = 0;
+		}
+		if (lcd_cmd == COLUMN_ADDR_SET){
+			stats.windows++;
+		}
+		if (lcd_cmd == VERT_SCROLL_ADDR){
+			stats.scrolls++;
+		}
+		if (lcd_cmd == MEM_WRITE){
+			lcd_x = lcd_x0;
+			lcd_y = lcd_y0;
+		}
+		return;
+	}
+	switch (lcd_cmd){
+	case COLUMN_ADDR_SET:
+	case PAGE_ADDR_SET:
+		if (lcd_param_count < 4){
+			lcd_param[lcd_param_count++] = byte;
+		}
+		if (lcd_param_count == 4){
+			if (lcd_cmd == COLUMN_ADDR_SET){
+				lcd_x0 = (lcd_param[0] << 8) | lcd_param[1];
+				lcd_x1 = (lcd_param[2] << 8) | lcd_param[3];
+			}
+			else{
+				lcd_y0 = (lcd_param[0] << 8) | lcd_param[1];
+				lcd_y1 = (lcd_param[2] << 8) | lcd_param[3];
+			}
+		}
+		break;
+	case MEM_ACC_CTRL:
+		lcd_madctl = byte;
+		break;
+	case VERT_SCROLL_DEF:
+		if (lcd_param_count < 6){
+			lcd_param[lcd_param_count++] = byte;
+		}
+		if (lcd_param_count == 6){
+			lcd_tfa = (lcd_param[0] << 8) | lcd_param[1];
+			lcd_vsa = (lcd_param[2] << 8) | lcd_param[3];
+		}
+		break;
+	case VERT_SCROLL_ADDR:
+		if (lcd_param_count < 2){
+			lcd_param[lcd_param_count++] = byte;
+		}
+		if (lcd_param_count == 2){
+			lcd_vsp = (lcd_param[0] << 8) | lcd_param[1];
+		}
+		break;
+	case MEM_WRITE:
+		if (!lcd_high_valid){
+			lcd_high = byte;
+			lcd_high_valid = 1;
+			break;
+		}
+		lcd_high_valid = 0;
+		/* Pixels outside the window or the frame memory are lost, as in the LCD */
+		if (lcd_y > lcd_y1){
+			break;
+		}
+		if (!LcdPosition(lcd_x, lcd_y, &line, &column)){
+			break;
+		}
+		mock_lcd_frame[line][column] = (lcd_high << 8) | byte;
+		if (lcd_x++ == lcd_x1){
+			lcd_x = lcd_x0;
+			lcd_y++;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static uint8_t LcdPosition(uint16_t x, uint16_t y, uint16_t *line, uint16_t *column){
+	uint16_t aux;
+
+	/* Columns are frame memory lines and pages are memory columns when exchanged (MV) */
+	if (lcd_madctl & MADCTL_MV){
+		aux = x;
+		x = y;
+		y = aux;
+	}
+	if ((x >= MOCK_LCD_WIDTH) || (y >= MOCK_LCD_HEIGHT)){
+		*line = 0;
+		*column = 0;
+		return 0;
+	}
+	/* Memory columns are kept as the driver writes them in portrait (MX set) */
+	*column = (lcd_madctl & MADCTL_MX) ? x : MOCK_LCD_WIDTH - 1 - x;
+	*line = (lcd_madctl & MADCTL_MY) ? MOCK_LCD_HEIGHT - 1 - y : y;
+	return 1;
+}
+
+static uint16_t LcdLine(uint16_t line){
+	if ((line < lcd_tfa) || (line >= lcd_tfa + lcd_vsa)){
+		return line;
+	}
+	return lcd_tfa + (lcd_vsp - lcd_tfa + line - lcd_tfa) % lcd_vsa;
+}
+
+static void TransDone(void){
+	mock_trans_t *t = &queue[queue_first];
+	const uint8_t *data = (t->size <= MOCK_SMALL_TX) ? t->tx_data : t->buffer;
+	uint32_t i;
+
+	for (i = 0; i < t->size; i++){
+		LcdByte(data[i], t->dc);
+	}
+	queue_first = (queue_first + 1) % SPI_QUEUE_SIZE;
+	queue_count--;
+}
+
+/*==================[external functions definition]==========================*/
+void MockLcdReset(uint16_t color){
+	uint16_t i, j;
+
+	SpiWaitAll(SPI_1);
+	for (i = 0; i < MOCK_LCD_HEIGHT; i++){
+		for (j = 0; j < MOCK_LCD_WIDTH; j++){
+			mock_lcd_frame[i][j] = color;
+		}
+	}
+	memset(&stats, 0, sizeof(stats));
+}
+
+void MockLcdGetStats(mock_lcd_stats_t *s){
+	*s = stats;
+}
+
+void MockLcdScreen(uint16_t *screen){
+	uint16_t x, y, width, height, line, column;
+
+	/* Pending transactions are done without counting a wait of the driver */
+	while (queue_count > 0){
+		TransDone();
+	}
+	width = (lcd_madctl & MADCTL_MV) ? MOCK_LCD_HEIGHT : MOCK_LCD_WIDTH;
+	height = (lcd_madctl & MADCTL_MV) ? MOCK_LCD_WIDTH : MOCK_LCD_HEIGHT;
+	for (y = 0; y < height; y++){
+		for (x = 0; x < width; x++){
+			LcdPosition(x, y, &line, &column);
+			screen[y * width + x] = mock_lcd_frame[LcdLine(line)][column];
+		}
+	}
+}
+
+uint8_t SpiInit(spi_mcu_config_t* spi){
+	return true;
+}
+
+void SpiSetDCPin(spi_dev_t device, uint8_t dc_pin){
+}
+
+uint8_t SpiQueueWrite(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size, spi_dc_t dc){
+	mock_trans_t *t;
+
+	if ((tx_buffer_size == 0) || (tx_buffer_size > SPI_MAX_TRANSFER_SIZE)){
+		return false;
+	}
+	/* All transactions in flight: wait for the oldest one */
+	if (queue_count == SPI_QUEUE_SIZE){
+		TransDone();
+	}
+	t = &queue[(queue_first + queue_count) % SPI_QUEUE_SIZE];
+	t->buffer = tx_buffer;
+	t->size = tx_buffer_size;
+	t->dc = dc;
+	if (tx_buffer_size <= MOCK_SMALL_TX){
+		memcpy(t->tx_data, tx_buffer, tx_buffer_size);
+	}
+	queue_count++;
+	stats.transactions++;
+	stats.bytes += tx_buffer_size;
+	return true;
+}
+
+void SpiWaitAll(spi_dev_t device){
+	while (queue_count > 0){
+		TransDone();
+	}
+	stats.waits++;
+}
+
+uint8_t SpiDeInit(spi_dev_t device){
+	SpiWaitAll(device);
+	return 0;
+}
+
+void GPIOInit(gpio_t pin, io_t io){
+}
+
+void GPIOOn(gpio_t pin){
+}
+
+void GPIOOff(gpio_t pin){
+}
+
+void DelayMs(uint16_t msec){
+}
+
+void DelayUs(uint16_t usec){
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,78 @@
+#ifndef MOCK_LCD_H_
+#define MOCK_LCD_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of the SPI, GPIO and delay drivers with an ILI9341 model behind it
+ *
+ * Queued SPI transactions are kept as the ESP-IDF driver does (up to SPI_QUEUE_SIZE in
+ * flight, buffers longer than 4 bytes are only read when the transaction is done), and
+ * decoded by a model of the ILI9341 frame memory: column/page address windows,
+ * memory writes, memory access control (MY, MX and MV of MEM_ACC_CTRL) and vertical
+ * scrolling. The frame memory is kept as seen in ILI9341_Portrait_1.
+ * The transactions and waits of each drawing are counted.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ * | 17/10/2026 | Landscape writes and vertical scrolling        |
+ * | 17/10/2026 | Column address order (MX)                      |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define MOCK_LCD_WIDTH	240			/*!< Columns of the LCD frame memory */
+#define MOCK_LCD_HEIGHT	320			/*!< Rows of the LCD frame memory */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief SPI traffic since the last MockLcdReset()
+ */
+typedef struct {
+	uint32_t transactions;		/*!< Queued SPI transactions (commands, parameters and data) */
+	uint32_t waits;				/*!< Calls to SpiWaitAll() */
+	uint32_t windows;			/*!< Address windows (COLUMN_ADDR_SET commands) */
+	uint32_t scrolls;			/*!< Vertical scrolling start updates (VERT_SCROLL_ADDR commands) */
+	uint32_t bytes;				/*!< Bytes transferred */
+} mock_lcd_stats_t;
+
+/*==================[external data declaration]==============================*/
+extern uint16_t mock_lcd_frame[MOCK_LCD_HEIGHT][MOCK_LCD_WIDTH];	/*!< LCD frame memory, [row][column] */
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Fill the frame memory with a color and clear the statistics
+ *
+ * @param color RGB565 color
+ */
+void MockLcdReset(uint16_t color);
+
+/**
+ * @brief Get the SPI traffic since the last MockLcdReset()
+ *
+ * @param stats Statistics (output)
+ */
+void MockLcdGetStats(mock_lcd_stats_t *stats);
+
+/**
+ * @brief Get the image shown on the display, with the orientation and scroll of the LCD
+ *
+ * @param screen Pixels, row by row: MOCK_LCD_WIDTH x MOCK_LCD_HEIGHT in portrait,
+ * MOCK_LCD_HEIGHT x MOCK_LCD_WIDTH in landscape (output)
+ */
+void MockLcdScreen(uint16_t *screen);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_LCD_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,223 @@
+/**
+ * @file mock_mpu6050.c
+ * @brief Host mock of the I2C and GPIO drivers with an MPU6050 behind them
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <pthread.h>
+#include <string.h>
+#include "mock_mpu6050.h"
+#include "mpu6050.h"
+#include "i2c_mcu.h"
+#include "gpio_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MOCK_REGISTERS		128		/*!< Register addresses */
+
+/*==================[internal data declaration]==============================*/
+static pthread_mutex_t mpu_lock = PTHREAD_MUTEX_INITIALIZER;	/*!< Registers and FIFO */
+static pthread_mutex_t gpio_lock = PTHREAD_MUTEX_INITIALIZER;	/*!< Interruption */
+static uint8_t registers[MOCK_REGISTERS];
+static uint8_t fifo[MPU6050_FIFO_SIZE];
+static uint16_t fifo_first, fifo_count;
+static mock_mpu_stats_t stats;
+static void (*isr)(void *) = NULL;		/*!< Data ready interruption (NULL: disabled) */
+static void *isr_arg;
+
+/*==================[internal functions declaration]=========================*/
+/** @brief Read a register, taking a byte from the FIFO for FIFO_R_W (mpu_lock taken) */
+static uint8_t ReadRegister(uint8_t reg);
+
+/** @brief Write a register, resetting the FIFO with USER_CTRL (mpu_lock taken) */
+static void WriteRegister(uint8_t reg, uint8_t data);
+
+/** @brief Read consecutive registers (FIFO_R_W is not incremented) */
+static void ReadRegisters(uint8_t reg, uint16_t length, uint8_t *data);
+
+/*==================[internal functions definition]==========================*/
+static uint8_t ReadRegister(uint8_t reg){
+	uint8_t data;
+
+	switch (reg){
+	case MPU6050_RA_FIFO_COUNTH:
+		return fifo_count >> 8;
+	case MPU6050_RA_FIFO_COUNTH + 1:
+		return fifo_count & 0xFF;
+	case MPU6050_RA_FIFO_R_W:
+		/* An empty FIFO gives the last byte again */
+		data = fifo[fifo_first];
+		if (fifo_count > 0){
+			fifo_first = (fifo_first + 1) % MPU6050_FIFO_SIZE;
+			fifo_count--;
+			stats.fifo_bytes++;
+		}
+		return data;
+	default:
+		return registers[reg % MOCK_REGISTERS];
+	}
+}
+
+static void WriteRegister(uint8_t reg, uint8_t data){
+	if ((reg == MPU6050_RA_USER_CTRL) && (data & (1 << MPU6050_USERCTRL_FIFO_RESET_BIT))){
+		fifo_first = 0;
+		fifo_count = 0;
+		data &= ~(1 << MPU6050_USERCTRL_FIFO_RESET_BIT);
+	}
+	registers[reg % MOCK_REGISTERS] = data;
+}
+
+static void ReadRegisters(uint8_t reg, uint16_t length, uint8_t *data){
+	uint16_t i;
+
+	pthread_mutex_lock(&mpu_lock);
+	stats.reads++;
+	if (reg == MPU6050_RA_FIFO_R_W){
+		stats.fifo_reads++;
+	}
+	for (i = 0; i < length; i++){
+		data[i] = ReadRegister((reg == MPU6050_RA_FIFO_R_W) ? reg : reg + i);
+	}
+	pthread_mutex_unlock(&mpu_lock);
+}
+
+/*==================[external functions definition]==========================*/
+void MockMpuReset(void){
+	pthread_mutex_lock(&mpu_lock);
+	memset(registers, 0, sizeof(registers));
+	memset(&stats, 0, sizeof(stats));
+	fifo_first = 0;
+	fifo_count = 0;
+	pthread_mutex_unlock(&mpu_lock);
+}
+
+void MockMpuSample(const int16_t accel[3], const int16_t gyro[3]){
+	uint8_t frame[MPU6050_FIFO_FRAME_SIZE];
+	uint8_t axis, i, interrupt;
+
+	for (axis = 0; axis < 3; axis++){
+		frame[2 * axis] = (uint16_t)accel[axis] >> 8;
+		frame[2 * axis + 1] = accel[axis] & 0xFF;
+		frame[6 + 2 * axis] = (uint16_t)gyro[axis] >> 8;
+		frame[6 + 2 * axis + 1] = gyro[axis] & 0xFF;
+	}
+	pthread_mutex_lock(&mpu_lock);
+	if ((registers[MPU6050_RA_USER_CTRL] & (1 << MPU6050_USERCTRL_FIFO_EN_BIT)) && (registers[MPU6050_RA_FIFO_EN] != 0)){
+		for (i = 0; i < MPU6050_FIFO_FRAME_SIZE; i++){
+			if (fifo_count == MPU6050_FIFO_SIZE){
+				fifo_first = (fifo_first + 1) % MPU6050_FIFO_SIZE;
+				fifo_count--;
+			}
+			fifo[(fifo_first + fifo_count) % MPU6050_FIFO_SIZE] = frame[i];
+			fifo_count++;
+		}
+	}
+	interrupt = registers[MPU6050_RA_INT_ENABLE] & (1 << MPU6050_INTERRUPT_DATA_RDY_BIT);
+	pthread_mutex_unlock(&mpu_lock);
+
+	pthread_mutex_lock(&gpio_lock);
+	if (interrupt && (isr != NULL)){
+		stats.interrupts++;
+		isr(isr_arg);
+	}
+	pthread_mutex_unlock(&gpio_lock);
+}
+
+uint8_t MockMpuRegister(uint8_t reg){
+	uint8_t data;
+
+	pthread_mutex_lock(&mpu_lock);
+	data = registers[reg % MOCK_REGISTERS];
+	pthread_mutex_unlock(&mpu_lock);
+	return data;
+}
+
+void MockMpuGetStats(mock_mpu_stats_t *stats_out){
+	pthread_mutex_lock(&mpu_lock);
+	*stats_out = stats;
+	pthread_mutex_unlock(&mpu_lock);
+}
+
+int8_t I2C_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout){
+	uint8_t b;
+
+	ReadRegisters(regAddr, 1, &b);
+	*data = (b >> bitNum) & 0x01;
+	return 1;
+}
+
+int8_t I2C_readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout){
+	uint8_t b;
+
+	ReadRegisters(regAddr, 1, &b);
+	*data = (b >> (bitStart - length + 1)) & ((1 << length) - 1);
+	return 1;
+}
+
+int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout){
+	ReadRegisters(regAddr, 1, data);
+	return 1;
+}
+
+int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout){
+	ReadRegisters(regAddr, length, data);
+	return length;
+}
+
+bool I2C_readBatch(i2c_read_t *reads, uint8_t qty, uint16_t timeout){
+	uint8_t i;
+
+	for (i = 0; i < qty; i++){
+		ReadRegisters(reads[i].regAddr, reads[i].length, reads[i].data);
+	}
+	return true;
+}
+
+bool I2C_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data){
+	uint8_t mask = 1 << bitNum;
+
+	pthread_mutex_lock(&mpu_lock);
+	stats.writes++;
+	WriteRegister(regAddr, (registers[regAddr % MOCK_REGISTERS] & ~mask) | (data ? mask : 0));
+	pthread_mutex_unlock(&mpu_lock);
+	return true;
+}
+
+bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data){
+	uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+
+	pthread_mutex_lock(&mpu_lock);
+	stats.writes++;
+	WriteRegister(regAddr, (registers[regAddr % MOCK_REGISTERS] & ~mask) | ((data << (bitStart - length + 1)) & mask));
+	pthread_mutex_unlock(&mpu_lock);
+	return true;
+}
+
+bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data){
+	pthread_mutex_lock(&mpu_lock);
+	stats.writes++;
+	WriteRegister(regAddr, data);
+	pthread_mutex_unlock(&mpu_lock);
+	return true;
+}
+
+void GPIOInit(gpio_t pin, io_t io){
+}
+
+void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
+	pthread_mutex_lock(&gpio_lock);
+	isr = ptr_int_func;
+	isr_arg = args;
+	pthread_mutex_unlock(&gpio_lock);
+}
+
+void GPIODeactivInt(gpio_t pin){
+	pthread_mutex_lock(&gpio_lock);
+	isr = NULL;
+	pthread_mutex_unlock(&gpio_lock);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,79 @@
+#ifndef MOCK_MPU6050_H_
+#define MOCK_MPU6050_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of the I2C and GPIO drivers with an MPU6050 behind them
+ *
+ * The registers are memory, except the FIFO: FIFO_COUNTH/FIFO_COUNTL give the bytes
+ * stored and each byte read from FIFO_R_W takes one, as the sensor does. Samples are
+ * added to the FIFO (when it is enabled) by MockMpuSample(), that also calls the data
+ * ready interruption of the GPIO when it is enabled in INT_ENABLE. GPIODeactivInt()
+ * waits for an interruption being called, as disabling it on the target does.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief I2C traffic since the last MockMpuReset()
+ */
+typedef struct {
+	uint32_t reads;				/*!< Read transactions */
+	uint32_t writes;			/*!< Write transactions */
+	uint32_t fifo_reads;		/*!< Read transactions of FIFO_R_W */
+	uint32_t fifo_bytes;		/*!< Bytes taken from the FIFO */
+	uint32_t interrupts;		/*!< Data ready interruptions called */
+} mock_mpu_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Clear the registers, the FIFO and the statistics
+ */
+void MockMpuReset(void);
+
+/**
+ * @brief Add a sample to the FIFO (the oldest bytes are lost when it is full) and
+ * call the data ready interruption
+ *
+ * @param accel Accelerometer X, Y, Z
+ * @param gyro Gyroscope X, Y, Z
+ */
+void MockMpuSample(const int16_t accel[3], const int16_t gyro[3]);
+
+/**
+ * @brief Get the value of a register
+ *
+ * @param reg Register address
+ * @return Register value
+ */
+uint8_t MockMpuRegister(uint8_t reg);
+
+/**
+ * @brief Get the I2C traffic since the last MockMpuReset()
+ *
+ * @param stats Statistics (output)
+ */
+void MockMpuGetStats(mock_mpu_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_MPU6050_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,164 @@
+/**
+ * @file mock_rmt.c
+ * @brief Host mock of the ESP-IDF RMT TX driver, and of the fast GPIO and delay drivers
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "mock_rmt.h"
+#include "gpio_fast_out_mcu.h"
+#include "delay_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MOCK_RMT_SYMBOLS	4096		/*!< Symbols kept of the last transmission */
+
+/**
+ * @brief RMT TX channel
+ */
+struct mock_rmt_channel {
+	rmt_tx_channel_config_t config;
+	rmt_tx_event_callbacks_t callbacks;
+	void *user_data;
+	bool enabled;
+};
+
+/**
+ * @brief Copy encoder
+ */
+struct mock_rmt_encoder {
+	uint32_t encoded;				/*!< Symbols copied */
+};
+/*==================[internal data declaration]==============================*/
+static uint32_t failures[MOCK_RMT_CALLS];	/*!< Next calls of each function that fail */
+static mock_rmt_stats_t stats;
+static rmt_symbol_word_t frame[MOCK_RMT_SYMBOLS];
+static uint32_t frame_symbols;
+/*==================[internal functions declaration]=========================*/
+/** @brief Whether a call must fail */
+static bool Fail(mock_rmt_call_t call);
+
+/*==================[internal functions definition]==========================*/
+static bool Fail(mock_rmt_call_t call){
+	if (failures[call] > 0){
+		failures[call]--;
+		return true;
+	}
+	return false;
+}
+
+/*==================[external functions definition]==========================*/
+void MockRmtFail(mock_rmt_call_t call, uint32_t count){
+	failures[call] = count;
+}
+
+void MockRmtGetStats(mock_rmt_stats_t *stats_out){
+	*stats_out = stats;
+}
+
+uint32_t MockRmtFrame(rmt_symbol_word_t *symbols, uint32_t max){
+	memcpy(symbols, frame, ((frame_symbols < max) ? frame_symbols : max) * sizeof(rmt_symbol_word_t));
+	return frame_symbols;
+}
+
+esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_handle_t *ret_chan){
+	struct mock_rmt_channel *channel;
+
+	if (Fail(MOCK_RMT_NEW_CHANNEL) || ((channel = calloc(1, sizeof(struct mock_rmt_channel))) == NULL)){
+		return ESP_ERR_NO_MEM;
+	}
+	channel->config = *config;
+	*ret_chan = channel;
+	stats.channels++;
+	return ESP_OK;
+}
+
+esp_err_t rmt_del_channel(rmt_channel_handle_t channel){
+	/* Only channels in init state can be deleted */
+	if (channel->enabled){
+		return ESP_FAIL;
+	}
+	free(channel);
+	stats.channels--;
+	return ESP_OK;
+}
+
+esp_err_t rmt_new_copy_encoder(const rmt_copy_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder){
+	struct mock_rmt_encoder *encoder;
+
+	if (Fail(MOCK_RMT_NEW_ENCODER) || ((encoder = calloc(1, sizeof(struct mock_rmt_encoder))) == NULL)){
+		return ESP_ERR_NO_MEM;
+	}
+	*ret_encoder = encoder;
+	stats.encoders++;
+	return ESP_OK;
+}
+
+esp_err_t rmt_del_encoder(rmt_encoder_handle_t encoder){
+	free(encoder);
+	stats.encoders--;
+	return ESP_OK;
+}
+
+esp_err_t rmt_tx_register_event_callbacks(rmt_channel_handle_t channel, const rmt_tx_event_callbacks_t *cbs, void *user_data){
+	if (Fail(MOCK_RMT_CALLBACKS) || channel->enabled){
+		return ESP_FAIL;
+	}
+	channel->callbacks = *cbs;
+	channel->user_data = user_data;
+	return ESP_OK;
+}
+
+esp_err_t rmt_enable(rmt_channel_handle_t channel){
+	if (Fail(MOCK_RMT_ENABLE) || channel->enabled){
+		return ESP_FAIL;
+	}
+	channel->enabled = true;
+	stats.enabled++;
+	return ESP_OK;
+}
+
+esp_err_t rmt_disable(rmt_channel_handle_t channel){
+	if (!channel->enabled){
+		return ESP_FAIL;
+	}
+	channel->enabled = false;
+	stats.enabled--;
+	return ESP_OK;
+}
+
+esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_handle_t encoder, const void *payload, size_t payload_bytes, const rmt_transmit_config_t *config){
+	rmt_tx_done_event_data_t done;
+
+	if (Fail(MOCK_RMT_TRANSMIT) || !channel->enabled){
+		return ESP_FAIL;
+	}
+	frame_symbols = payload_bytes / sizeof(rmt_symbol_word_t);
+	memcpy(frame, payload, ((frame_symbols < MOCK_RMT_SYMBOLS) ? frame_symbols : MOCK_RMT_SYMBOLS) * sizeof(rmt_symbol_word_t));
+	encoder->encoded += frame_symbols;
+	stats.transmissions++;
+	done.num_symbols = frame_symbols;
+	if (channel->callbacks.on_trans_done != NULL){
+		channel->callbacks.on_trans_done(channel, &done, channel->user_data);
+	}
+	return ESP_OK;
+}
+
+esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t channel, int timeout_ms){
+	return ESP_OK;
+}
+
+void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
+}
+
+void GPIOFastWrite(uint16_t value){
+}
+
+void DelayUs(uint16_t usec){
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,85 @@
+#ifndef MOCK_RMT_H_
+#define MOCK_RMT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of the ESP-IDF RMT TX driver, and of the fast GPIO and delay drivers
+ *
+ * Transmissions are done at once: the symbols of the last one are kept and the
+ * transmission done callback is called before rmt_transmit() returns. Calls can be
+ * made to fail, to check that the driver releases what it allocated. The fast GPIO
+ * and delay functions (bit-banged NeoPixels) do nothing.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "driver/rmt_tx.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief RMT driver calls that can fail
+ */
+typedef enum {
+	MOCK_RMT_NEW_CHANNEL = 0,		/*!< rmt_new_tx_channel() */
+	MOCK_RMT_NEW_ENCODER,			/*!< rmt_new_copy_encoder() */
+	MOCK_RMT_CALLBACKS,				/*!< rmt_tx_register_event_callbacks() */
+	MOCK_RMT_ENABLE,				/*!< rmt_enable() */
+	MOCK_RMT_TRANSMIT,				/*!< rmt_transmit() */
+	MOCK_RMT_CALLS
+} mock_rmt_call_t;
+
+/**
+ * @brief RMT driver state
+ */
+typedef struct {
+	uint32_t channels;			/*!< Channels not deleted */
+	uint32_t encoders;			/*!< Encoders not deleted */
+	uint32_t enabled;			/*!< Channels enabled */
+	uint32_t transmissions;		/*!< Transmissions done */
+} mock_rmt_stats_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Make the next calls of an RMT driver function fail
+ *
+ * @param call Function
+ * @param count Calls that fail
+ */
+void MockRmtFail(mock_rmt_call_t call, uint32_t count);
+
+/**
+ * @brief Get the RMT driver state
+ *
+ * @param stats State (output)
+ */
+void MockRmtGetStats(mock_rmt_stats_t *stats);
+
+/**
+ * @brief Get the symbols of the last transmission
+ *
+ * @param symbols Symbols (output)
+ * @param max Maximun number of symbols
+ * @return Number of symbols transmitted
+ */
+uint32_t MockRmtFrame(rmt_symbol_word_t *symbols, uint32_t max);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_RMT_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,288 @@
+/**
+ * @file mock_rtos.c
+ * @brief Host mock of the FreeRTOS tasks, notifications, queues and semaphores, and of the ESP-IDF timer
+ *
+ * Each task is a thread. Notifications are a counter protected by a mutex, and a
+ * condition variable to wait for it. A task deleted by another one ends when it waits
+ * for a notification. Queues are ring buffers protected by a mutex, semaphores are
+ * queues without items. Ticks are milliseconds of the monotonic clock, that
+ * tests can move forward.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "mock_rtos.h"
+/*==================[macros and definitions]=================================*/
+/**
+ * @brief Task
+ */
+struct mock_task {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t notified;
+	uint32_t notifications;			/*!< Notification value (count) */
+	bool deleted;					/*!< Deleted by another task */
+	TaskFunction_t function;
+	void *param;
+};
+
+/**
+ * @brief Queue
+ */
+struct mock_queue {
+	pthread_mutex_t lock;
+	pthread_cond_t changed;			/*!< An item was added or removed */
+	UBaseType_t length;
+	UBaseType_t item_size;
+	UBaseType_t head;				/*!< Next item to receive */
+	UBaseType_t count;				/*!< Items in the queue */
+	uint8_t *items;
+};
+/*==================[internal data declaration]==============================*/
+static __thread struct mock_task *current_task = NULL;	/*!< Task of the calling thread */
+static int64_t time_offset = 0;			/*!< Time moved forward by MockRtosAdvanceTime() (us, atomic access) */
+/*==================[internal functions declaration]=========================*/
+/** @brief Thread of a task */
+static void *TaskThread(void *arg);
+
+/** @brief Absolute time of a timeout in ticks from now, for pthread_cond_timedwait() */
+static void TimeoutEnd(TickType_t timeout, struct timespec *end);
+
+/** @brief Frees the task of the calling thread and ends the thread */
+static void TaskExit(void);
+/*==================[internal functions definition]==========================*/
+static void *TaskThread(void *arg){
+	current_task = arg;
+	current_task->function(current_task->param);
+	return NULL;
+}
+
+static void TimeoutEnd(TickType_t timeout, struct timespec *end){
+	clock_gettime(CLOCK_REALTIME, end);
+	end->tv_sec += timeout / 1000;
+	end->tv_nsec += (timeout % 1000) * 1000000L;
+	if (end->tv_nsec >= 1000000000L){
+		end->tv_sec++;
+		end->tv_nsec -= 1000000000L;
+	}
+}
+
+static void TaskExit(void){
+	pthread_mutex_destroy(&current_task->lock);
+	pthread_cond_destroy(&current_task->notified);
+	free(current_task);
+	current_task = NULL;
+	pthread_exit(NULL);
+}
+
+/*==================[external functions definition]==========================*/
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stack, void *param, UBaseType_t priority, TaskHandle_t *handle){
+	struct mock_task *task = calloc(1, sizeof(struct mock_task));
+
+	if (task == NULL){
+		return pdFALSE;
+	}
+	pthread_mutex_init(&task->lock, NULL);
+	pthread_cond_init(&task->notified, NULL);
+	task->function = function;
+	task->param = param;
+	if (handle != NULL){
+		*handle = task;
+	}
+	if (pthread_create(&task->thread, NULL, TaskThread, task) != 0){
+		free(task);
+		return pdFALSE;
+	}
+	pthread_detach(task->thread);
+	return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task){
+	if (task == NULL){
+		if (current_task != NULL){
+			TaskExit();
+		}
+		return;
+	}
+	/* Another task: the drivers only delete tasks waiting for a notification */
+	pthread_mutex_lock(&task->lock);
+	task->deleted = true;
+	pthread_cond_signal(&task->notified);
+	pthread_mutex_unlock(&task->lock);
+}
+
+void vTaskDelay(TickType_t ticks){
+	struct timespec delay = {ticks / 1000, (ticks % 1000) * 1000000L};
+
+	nanosleep(&delay, NULL);
+}
+
+void vTaskDelayUntil(TickType_t *previous_wake, TickType_t ticks){
+	TickType_t now = xTaskGetTickCount();
+
+	*previous_wake += ticks;
+	if ((int32_t)(*previous_wake - now) > 0){
+		vTaskDelay(*previous_wake - now);
+	}
+}
+
+TickType_t xTaskGetTickCount(void){
+	return (TickType_t)(esp_timer_get_time() / 1000);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task){
+	pthread_mutex_lock(&task->lock);
+	task->notifications++;
+	pthread_cond_signal(&task->notified);
+	pthread_mutex_unlock(&task->lock);
+	return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken){
+	xTaskNotifyGive(task);
+	*woken = pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t timeout){
+	struct mock_task *task = current_task;
+	struct timespec end;
+	uint32_t value;
+
+	TimeoutEnd(timeout, &end);
+	pthread_mutex_lock(&task->lock);
+	while ((task->notifications == 0) && !task->deleted){
+		if (timeout == portMAX_DELAY){
+			pthread_cond_wait(&task->notified, &task->lock);
+		}
+		else if (pthread_cond_timedwait(&task->notified, &task->lock, &end) != 0){
+			break;
+		}
+	}
+	if (task->deleted){
+		pthread_mutex_unlock(&task->lock);
+		TaskExit();
+	}
+	value = task->notifications;
+	if (value > 0){
+		task->notifications = clear ? 0 : value - 1;
+	}
+	pthread_mutex_unlock(&task->lock);
+	return value;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size){
+	struct mock_queue *queue = calloc(1, sizeof(struct mock_queue));
+
+	if (queue == NULL){
+		return NULL;
+	}
+	/* Semaphores have no items: one more byte, malloc(0) may give NULL */
+	queue->items = malloc(length * item_size + 1);
+	if (queue->items == NULL){
+		free(queue);
+		return NULL;
+	}
+	pthread_mutex_init(&queue->lock, NULL);
+	pthread_cond_init(&queue->changed, NULL);
+	queue->length = length;
+	queue->item_size = item_size;
+	return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t timeout){
+	struct timespec end;
+	BaseType_t sent = pdFALSE;
+
+	TimeoutEnd(timeout, &end);
+	pthread_mutex_lock(&queue->lock);
+	while ((queue->count == queue->length) && (timeout > 0)){
+		if (pthread_cond_timedwait(&queue->changed, &queue->lock, &end) != 0){
+			break;
+		}
+	}
+	if (queue->count < queue->length){
+		if (queue->item_size > 0){
+			memcpy(&queue->items[((queue->head + queue->count) % queue->length) * queue->item_size], item, queue->item_size);
+		}
+		queue->count++;
+		pthread_cond_broadcast(&queue->changed);
+		sent = pdTRUE;
+	}
+	pthread_mutex_unlock(&queue->lock);
+	return sent;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t timeout){
+	struct timespec end;
+	BaseType_t received = pdFALSE;
+
+	TimeoutEnd(timeout, &end);
+	pthread_mutex_lock(&queue->lock);
+	while ((queue->count == 0) && (timeout > 0)){
+		if (pthread_cond_timedwait(&queue->changed, &queue->lock, &end) != 0){
+			break;
+		}
+	}
+	if (queue->count > 0){
+		if (queue->item_size > 0){
+			memcpy(item, &queue->items[queue->head * queue->item_size], queue->item_size);
+		}
+		queue->head = (queue->head + 1) % queue->length;
+		queue->count--;
+		pthread_cond_broadcast(&queue->changed);
+		received = pdTRUE;
+	}
+	pthread_mutex_unlock(&queue->lock);
+	return received;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue){
+	pthread_mutex_lock(&queue->lock);
+	queue->head = 0;
+	queue->count = 0;
+	pthread_cond_broadcast(&queue->changed);
+	pthread_mutex_unlock(&queue->lock);
+	return pdPASS;
+}
+
+void vQueueDelete(QueueHandle_t queue){
+	pthread_mutex_destroy(&queue->lock);
+	pthread_cond_destroy(&queue->changed);
+	free(queue->items);
+	free(queue);
+}
+
+QueueHandle_t xQueueCreateCountingSemaphore(UBaseType_t max, UBaseType_t initial){
+	QueueHandle_t queue = xQueueCreate(max, 0);
+
+	if (queue != NULL){
+		queue->count = initial;
+	}
+	return queue;
+}
+
+int64_t esp_timer_get_time(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 + __atomic_load_n(&time_offset, __ATOMIC_RELAXED);
+}
+
+void MockRtosAdvanceTime(uint32_t usec){
+	__atomic_fetch_add(&time_offset, usec, __ATOMIC_RELAXED);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,42 @@
+#ifndef MOCK_RTOS_H_
+#define MOCK_RTOS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of FreeRTOS and of the ESP-IDF timer: control of the time
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Move esp_timer_get_time() and the ticks forward at once, so that a mock can
+ * time a signal without depending on the host scheduler
+ *
+ * @param usec Microseconds
+ */
+void MockRtosAdvanceTime(uint32_t usec);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_RTOS_H_ */
+
+/*==================[end of file]============================================*/
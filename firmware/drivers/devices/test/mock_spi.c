@@ -0,0 +1,199 @@
+/**
+ * @file mock_spi.c
+ * @brief Host mock of the ESP-IDF SPI master driver, and of the GPIO and delay drivers
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "mock_spi.h"
+#include "driver/gpio.h"
+#include "gpio_mcu.h"
+#include "delay_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MOCK_SPI_LOG		1024		/*!< Transactions logged */
+#define MOCK_SPI_QUEUE		32			/*!< Maximun queue size of a device */
+
+/**
+ * @brief Device added to the bus
+ */
+struct mock_spi_device {
+	spi_device_interface_config_t config;
+	spi_transaction_t *queue[MOCK_SPI_QUEUE];	/*!< Queued transactions, oldest first */
+	uint32_t first;
+	uint32_t count;
+};
+/*==================[internal data declaration]==============================*/
+static mock_spi_stats_t stats;
+static mock_spi_trans_t log_trans[MOCK_SPI_LOG];
+static uint32_t log_count;
+static int8_t gpio_level = -1;			/*!< Level of the last GPIO set */
+/*==================[internal functions declaration]=========================*/
+/** @brief Run a transaction: callbacks, loopback and log */
+static void Transfer(spi_device_handle_t handle, spi_transaction_t *trans, bool queued);
+
+/*==================[internal functions definition]==========================*/
+static void Transfer(spi_device_handle_t handle, spi_transaction_t *trans, bool queued){
+	const uint8_t *tx = (trans->flags & SPI_TRANS_USE_TXDATA) ? trans->tx_data : trans->tx_buffer;
+	uint8_t *rx = (trans->flags & SPI_TRANS_USE_RXDATA) ? trans->rx_data : trans->rx_buffer;
+	uint32_t bytes = trans->length / 8, i;
+	mock_spi_trans_t *entry;
+
+	if (handle->config.pre_cb != NULL){
+		handle->config.pre_cb(trans);
+	}
+	if ((rx != NULL) && (trans->rxlength > 0)){
+		for (i = 0; i < trans->rxlength / 8; i++){
+			rx[i] = (tx != NULL) ? tx[i] : 0xFF;
+		}
+	}
+	if (log_count < MOCK_SPI_LOG){
+		entry = &log_trans[log_count];
+		entry->bytes = bytes;
+		entry->dc = gpio_level;
+		entry->queued = queued;
+		memset(entry->data, 0, MOCK_SPI_DATA);
+		if (tx != NULL){
+			memcpy(entry->data, tx, (bytes < MOCK_SPI_DATA) ? bytes : MOCK_SPI_DATA);
+		}
+	}
+	log_count++;
+	stats.transactions++;
+	stats.bytes += bytes;
+	if (handle->config.post_cb != NULL){
+		handle->config.post_cb(trans);
+	}
+}
+
+/*==================[external functions definition]==========================*/
+void MockSpiReset(void){
+	uint32_t devices = stats.devices, pending = stats.pending;
+
+	memset(&stats, 0, sizeof(stats));
+	stats.devices = devices;
+	stats.pending = pending;
+	log_count = 0;
+}
+
+void MockSpiGetStats(mock_spi_stats_t *stats_out){
+	*stats_out = stats;
+}
+
+uint32_t MockSpiLog(mock_spi_trans_t *log, uint32_t max){
+	uint32_t count = (log_count < MOCK_SPI_LOG) ? log_count : MOCK_SPI_LOG;
+
+	memcpy(log, log_trans, ((count < max) ? count : max) * sizeof(mock_spi_trans_t));
+	return count;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t *bus_config, spi_dma_chan_t dma_chan){
+	static bool initialized = false;
+
+	/* A bus is initialized once */
+	if (initialized){
+		stats.refused++;
+		return ESP_ERR_INVALID_STATE;
+	}
+	initialized = true;
+	stats.buses++;
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host_id, const spi_device_interface_config_t *dev_config, spi_device_handle_t *handle){
+	struct mock_spi_device *device;
+
+	if ((dev_config->queue_size <= 0) || (dev_config->queue_size > MOCK_SPI_QUEUE)){
+		stats.refused++;
+		return ESP_ERR_INVALID_ARG;
+	}
+	if ((device = calloc(1, sizeof(struct mock_spi_device))) == NULL){
+		return ESP_ERR_NO_MEM;
+	}
+	device->config = *dev_config;
+	*handle = device;
+	stats.added++;
+	stats.devices++;
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle){
+	/* Results of queued transactions must be taken first */
+	if (handle->count > 0){
+		stats.refused++;
+		return ESP_ERR_INVALID_STATE;
+	}
+	free(handle);
+	stats.removed++;
+	stats.devices--;
+	return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans_desc, TickType_t ticks_to_wait){
+	/* Nothing would take a result while waiting: the queue would never free */
+	if (handle->count == (uint32_t)handle->config.queue_size){
+		stats.refused++;
+		return ESP_ERR_TIMEOUT;
+	}
+	handle->queue[(handle->first + handle->count) % MOCK_SPI_QUEUE] = trans_desc;
+	handle->count++;
+	stats.queued++;
+	stats.pending++;
+	if (handle->count > stats.max_pending){
+		stats.max_pending = handle->count;
+	}
+	return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans_desc, TickType_t ticks_to_wait){
+	if (handle->count == 0){
+		stats.refused++;
+		return ESP_ERR_TIMEOUT;
+	}
+	*trans_desc = handle->queue[handle->first];
+	handle->first = (handle->first + 1) % MOCK_SPI_QUEUE;
+	handle->count--;
+	stats.pending--;
+	Transfer(handle, *trans_desc, true);
+	return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc){
+	/* The result taken would be the one of a queued transaction */
+	if (handle->count > 0){
+		stats.refused++;
+		return ESP_ERR_INVALID_STATE;
+	}
+	Transfer(handle, trans_desc, false);
+	return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc){
+	return spi_device_transmit(handle, trans_desc);
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level){
+	gpio_level = (level != 0);
+	return ESP_OK;
+}
+
+void GPIOInit(gpio_t pin, io_t io){
+}
+
+void GPIOOn(gpio_t pin){
+}
+
+void GPIOOff(gpio_t pin){
+}
+
+void DelayMs(uint16_t msec){
+}
+
+void DelayUs(uint16_t usec){
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,91 @@
+#ifndef MOCK_SPI_H_
+#define MOCK_SPI_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Devices_Test Host tests
+ */
+
+/** \brief Host mock of the ESP-IDF SPI master driver, and of the GPIO and delay drivers
+ *
+ * Sits below spi_mcu, so the device handles and the transactions it creates are counted.
+ * Queued transactions wait, up to the queue size of their device, until their result is
+ * taken: then the pre-callback runs, the transaction is logged with the level of the last
+ * GPIO set by the ESP-IDF GPIO driver (the data/command pin) and the post-callback runs.
+ * Blocking transactions run at once, MISO wired to MOSI. Calls ESP-IDF refuses (a full
+ * queue, a blocking transaction or a device removal with queued transactions) are counted.
+ * The GPIO and delay drivers do nothing.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driver/spi_master.h"
+/*==================[macros]=================================================*/
+#define MOCK_SPI_DATA		4			/*!< First bytes logged of each transaction */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief SPI master driver state (counters since the last MockSpiReset())
+ */
+typedef struct {
+	uint32_t buses;				/*!< Bus initializations */
+	uint32_t added;				/*!< Devices added (handles created) */
+	uint32_t removed;			/*!< Devices removed */
+	uint32_t devices;			/*!< Handles not removed (not reset) */
+	uint32_t transactions;		/*!< Transactions done, queued or blocking */
+	uint32_t queued;			/*!< Queued transactions */
+	uint32_t pending;			/*!< Queued transactions whose result was not taken (not reset) */
+	uint32_t max_pending;		/*!< Most queued transactions of a device at the same time */
+	uint32_t refused;			/*!< Calls refused */
+	uint32_t bytes;				/*!< Bytes transferred */
+} mock_spi_stats_t;
+
+/**
+ * @brief Transaction done
+ */
+typedef struct {
+	uint32_t bytes;					/*!< Bytes transferred */
+	int8_t dc;						/*!< Level of the data/command pin (-1: never set) */
+	bool queued;					/*!< Queued or blocking */
+	uint8_t data[MOCK_SPI_DATA];	/*!< First bytes sent, as read when the transaction is done */
+} mock_spi_trans_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Clear the counters and the transactions logged
+ */
+void MockSpiReset(void);
+
+/**
+ * @brief Get the SPI master driver state
+ *
+ * @param stats State (output)
+ */
+void MockSpiGetStats(mock_spi_stats_t *stats);
+
+/**
+ * @brief Get the transactions done since the last MockSpiReset()
+ *
+ * @param log Transactions, oldest first (output)
+ * @param max Maximun number of transactions
+ * @return Number of transactions logged (the first MOCK_SPI_LOG ones are kept)
+ */
+uint32_t MockSpiLog(mock_spi_trans_t *log, uint32_t max);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOCK_SPI_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,11 @@
+#ifndef DRIVER_GPIO_H_
+#define DRIVER_GPIO_H_
+/* Host replacement of the ESP-IDF GPIO driver (see mock_spi.c) */
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level);
+
+#endif /* DRIVER_GPIO_H_ */
@@ -0,0 +1,5 @@
+#ifndef DRIVER_I2C_H_
+#define DRIVER_I2C_H_
+/* Host replacement of the ESP-IDF I2C driver: i2c_mcu is mocked (see mock_mpu6050.c) */
+
+#endif /* DRIVER_I2C_H_ */
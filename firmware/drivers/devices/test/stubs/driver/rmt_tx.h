@@ -0,0 +1,61 @@
+#ifndef DRIVER_RMT_TX_H_
+#define DRIVER_RMT_TX_H_
+/* Host replacement of the ESP-IDF RMT TX driver (see mock_rmt.c) */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+typedef struct mock_rmt_channel *rmt_channel_handle_t;
+typedef struct mock_rmt_encoder *rmt_encoder_handle_t;
+
+typedef union {
+	struct {
+		uint16_t duration0 : 15;
+		uint16_t level0 : 1;
+		uint16_t duration1 : 15;
+		uint16_t level1 : 1;
+	};
+	uint32_t val;
+} rmt_symbol_word_t;
+
+typedef enum {
+	RMT_CLK_SRC_DEFAULT,
+} rmt_clock_source_t;
+
+typedef struct {
+	int gpio_num;
+	rmt_clock_source_t clk_src;
+	uint32_t resolution_hz;
+	size_t mem_block_symbols;
+	size_t trans_queue_depth;
+} rmt_tx_channel_config_t;
+
+typedef struct {
+} rmt_copy_encoder_config_t;
+
+typedef struct {
+	size_t num_symbols;
+} rmt_tx_done_event_data_t;
+
+typedef bool (*rmt_tx_done_callback_t)(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *edata, void *user_ctx);
+
+typedef struct {
+	rmt_tx_done_callback_t on_trans_done;
+} rmt_tx_event_callbacks_t;
+
+typedef struct {
+	int loop_count;
+} rmt_transmit_config_t;
+
+esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_handle_t *ret_chan);
+esp_err_t rmt_del_channel(rmt_channel_handle_t channel);
+esp_err_t rmt_new_copy_encoder(const rmt_copy_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder);
+esp_err_t rmt_del_encoder(rmt_encoder_handle_t encoder);
+esp_err_t rmt_tx_register_event_callbacks(rmt_channel_handle_t channel, const rmt_tx_event_callbacks_t *cbs, void *user_data);
+esp_err_t rmt_enable(rmt_channel_handle_t channel);
+esp_err_t rmt_disable(rmt_channel_handle_t channel);
+esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_handle_t encoder, const void *payload, size_t payload_bytes, const rmt_transmit_config_t *config);
+esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t channel, int timeout_ms);
+
+#endif /* DRIVER_RMT_TX_H_ */
@@ -0,0 +1,68 @@
+#ifndef DRIVER_SPI_MASTER_H_
+#define DRIVER_SPI_MASTER_H_
+/* Host replacement of the ESP-IDF SPI master driver (see mock_spi.c) */
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#define SPI_TRANS_USE_RXDATA	(1 << 2)	/*!< Receive into rx_data instead of rx_buffer */
+#define SPI_TRANS_USE_TXDATA	(1 << 3)	/*!< Transmit tx_data instead of tx_buffer */
+
+typedef struct mock_spi_device *spi_device_handle_t;
+
+typedef enum {
+	SPI1_HOST,
+	SPI2_HOST,
+} spi_host_device_t;
+
+typedef enum {
+	SPI_DMA_DISABLED,
+	SPI_DMA_CH_AUTO = 3,
+} spi_dma_chan_t;
+
+typedef struct {
+	int mosi_io_num;
+	int miso_io_num;
+	int sclk_io_num;
+	int quadwp_io_num;
+	int quadhd_io_num;
+	int max_transfer_sz;
+} spi_bus_config_t;
+
+typedef struct spi_transaction_t spi_transaction_t;
+typedef void (*transaction_cb_t)(spi_transaction_t *trans);
+
+typedef struct {
+	uint8_t mode;
+	int clock_speed_hz;
+	int spics_io_num;
+	int queue_size;
+	transaction_cb_t pre_cb;
+	transaction_cb_t post_cb;
+} spi_device_interface_config_t;
+
+struct spi_transaction_t {
+	uint32_t flags;
+	size_t length;					/* Bits */
+	size_t rxlength;				/* Bits */
+	void *user;
+	union {
+		const void *tx_buffer;
+		uint8_t tx_data[4];
+	};
+	union {
+		void *rx_buffer;
+		uint8_t rx_data[4];
+	};
+};
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t *bus_config, spi_dma_chan_t dma_chan);
+esp_err_t spi_bus_add_device(spi_host_device_t host_id, const spi_device_interface_config_t *dev_config, spi_device_handle_t *handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans_desc, TickType_t ticks_to_wait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans_desc, TickType_t ticks_to_wait);
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc);
+
+#endif /* DRIVER_SPI_MASTER_H_ */
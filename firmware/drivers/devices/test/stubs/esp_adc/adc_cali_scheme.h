@@ -0,0 +1,18 @@
+#ifndef ESP_ADC_ADC_CALI_SCHEME_H_
+#define ESP_ADC_ADC_CALI_SCHEME_H_
+/* Host replacement of the ESP-IDF ADC calibration schemes (see mock_adc.c) */
+#include "esp_err.h"
+#include "hal/adc_types.h"
+
+typedef struct mock_adc_cali *adc_cali_handle_t;
+
+typedef struct {
+	adc_unit_t unit_id;
+	adc_channel_t chan;
+	adc_atten_t atten;
+	adc_bitwidth_t bitwidth;
+} adc_cali_curve_fitting_config_t;
+
+esp_err_t adc_cali_create_scheme_curve_fitting(const adc_cali_curve_fitting_config_t *config, adc_cali_handle_t *ret_handle);
+
+#endif /* ESP_ADC_ADC_CALI_SCHEME_H_ */
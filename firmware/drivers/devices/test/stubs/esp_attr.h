@@ -0,0 +1,7 @@
+#ifndef ESP_ATTR_H_
+#define ESP_ATTR_H_
+/* Host replacement of the ESP-IDF section attributes: everything runs from RAM */
+
+#define IRAM_ATTR
+
+#endif /* ESP_ATTR_H_ */
@@ -0,0 +1,12 @@
+#ifndef ESP_HEAP_CAPS_H_
+#define ESP_HEAP_CAPS_H_
+/* Host replacement of the ESP-IDF capabilities based allocator */
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA		(1 << 3)	/*!< Memory must be able to accessed by DMA */
+#define MALLOC_CAP_8BIT		(1 << 2)	/*!< Memory must allow for 8/16/...-bit data accesses */
+
+#define heap_caps_malloc(size, caps)	malloc(size)
+#define heap_caps_free(ptr)				free(ptr)
+
+#endif /* ESP_HEAP_CAPS_H_ */
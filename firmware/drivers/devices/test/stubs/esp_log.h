@@ -0,0 +1,5 @@
+#ifndef ESP_LOG_H_
+#define ESP_LOG_H_
+/* Host replacement of the ESP-IDF log: only included by the driver headers */
+
+#endif /* ESP_LOG_H_ */
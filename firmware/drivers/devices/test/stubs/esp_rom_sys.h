@@ -0,0 +1,8 @@
+#ifndef ESP_ROM_SYS_H_
+#define ESP_ROM_SYS_H_
+/* Host replacement of the ESP-IDF ROM functions: the busy wait (see mock_gptimer.c) */
+#include <stdint.h>
+
+void esp_rom_delay_us(uint32_t us);
+
+#endif /* ESP_ROM_SYS_H_ */
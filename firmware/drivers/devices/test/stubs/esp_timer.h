@@ -0,0 +1,8 @@
+#ifndef ESP_TIMER_H_
+#define ESP_TIMER_H_
+/* Host replacement of the ESP-IDF high resolution timer */
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
+
+#endif /* ESP_TIMER_H_ */
@@ -0,0 +1,31 @@
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+/* Host replacement of FreeRTOS: tasks are threads (see mock_rtos.c), a tick is 1 ms,
+ * critical sections are a mutex of their spinlock */
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_attr.h"
+
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE				1
+#define pdFALSE				0
+#define pdPASS				pdTRUE
+#define portMAX_DELAY		UINT32_MAX
+#define pdMS_TO_TICKS(ms)	((TickType_t)(ms))
+#define portYIELD_FROM_ISR(woken)	((void)(woken))
+#define portTICK_PERIOD_MS	1
+
+typedef pthread_mutex_t portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED	PTHREAD_MUTEX_INITIALIZER
+#define portENTER_CRITICAL(mux)			pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL(mux)			pthread_mutex_unlock(mux)
+#define portENTER_CRITICAL_ISR(mux)		pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL_ISR(mux)		pthread_mutex_unlock(mux)
+
+#endif /* FREERTOS_H_ */
@@ -0,0 +1,15 @@
+#ifndef QUEUE_H_
+#define QUEUE_H_
+/* Host replacement of the FreeRTOS queues (copies of fixed size items) */
+#include "freertos/FreeRTOS.h"
+
+typedef struct mock_queue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t timeout);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t timeout);
+BaseType_t xQueueReset(QueueHandle_t queue);
+void vQueueDelete(QueueHandle_t queue);
+QueueHandle_t xQueueCreateCountingSemaphore(UBaseType_t max, UBaseType_t initial);
+
+#endif /* QUEUE_H_ */
@@ -0,0 +1,22 @@
+#ifndef SEMPHR_H_
+#define SEMPHR_H_
+/* Host replacement of the FreeRTOS semaphores: queues of one empty item, as FreeRTOS does */
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+/* Static semaphores are allocated anyway, and freed by vSemaphoreDelete() */
+typedef struct {
+	uint8_t unused;
+} StaticSemaphore_t;
+
+#define xSemaphoreCreateBinary()					xQueueCreate(1, 0)
+#define xSemaphoreCreateBinaryStatic(buffer)		((void)(buffer), xQueueCreate(1, 0))
+#define xSemaphoreCreateCounting(max, initial)		xQueueCreateCountingSemaphore((max), (initial))
+#define xSemaphoreCreateMutex()						xQueueCreateCountingSemaphore(1, 1)
+#define vSemaphoreDelete(semaphore)					vQueueDelete(semaphore)
+#define xSemaphoreTake(semaphore, timeout)			xQueueReceive((semaphore), NULL, (timeout))
+#define xSemaphoreGive(semaphore)					xQueueSend((semaphore), NULL, 0)
+#define xSemaphoreGiveFromISR(semaphore, woken)		((void)(((woken) != NULL) && (*(woken) = pdFALSE)), xQueueSend((semaphore), NULL, 0))
+
+#endif /* SEMPHR_H_ */
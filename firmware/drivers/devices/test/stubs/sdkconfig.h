@@ -0,0 +1,5 @@
+#ifndef SDKCONFIG_H_
+#define SDKCONFIG_H_
+/* Host replacement of the ESP-IDF project configuration: default options */
+
+#endif /* SDKCONFIG_H_ */
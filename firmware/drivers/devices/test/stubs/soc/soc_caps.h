@@ -0,0 +1,10 @@
+#ifndef SOC_CAPS_H_
+#define SOC_CAPS_H_
+/* Host replacement of the ESP32-C6 capabilities used by the drivers */
+
+#define SOC_ADC_DIGI_RESULT_BYTES		4
+#define SOC_ADC_DIGI_MAX_BITWIDTH		12
+#define SOC_ADC_SAMPLE_FREQ_THRES_LOW	611
+#define SOC_ADC_SAMPLE_FREQ_THRES_HIGH	83333
+
+#endif /* SOC_CAPS_H_ */
@@ -0,0 +1,282 @@
+/**
+ * @file test_analog_io.c
+ * @brief Host test of the continuous (DMA) mode of the analog inputs, replaying recorded signals
+ *
+ * The mocked ADC replays a signal on each channel. The blocks of a channel must hold its
+ * signal in order, numbered from 0, whether it is sampled alone or with another channel,
+ * and blocks the reader doesn't take in time must show as a gap in the sequence. Starting
+ * a channel must not restart the blocks of the others. Then a channel is started and
+ * stopped while frames are converted: the blocks of the other channel must keep their
+ * samples in order and their sequence increasing, with a gap wherever samples were lost.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include "analog_io_mcu.h"
+#include "mock_adc.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_FREC		1000			/*!< Per channel (Hz) */
+#define SIGNAL_LENGHT	1000			/*!< Samples recorded: not a multiple of the block size */
+#define RAMP_LENGHT		4096			/*!< Each sample is the previous one plus 1 */
+#define WAIT_TIMEOUT_MS	1000			/*!< Maximun time for the driver task to split the frames */
+#define RESTARTS		200				/*!< Starts and stops of a channel while converting */
+/*==================[internal data declaration]==============================*/
+static uint16_t signals[2][SIGNAL_LENGHT];
+static uint16_t ramp[RAMP_LENGHT];
+static volatile uint32_t blocks_ready[2];	/*!< Blocks completed by channel (callback calls) */
+static volatile int converting;				/*!< Converter thread must go on */
+/*==================[internal functions declaration]=========================*/
+/** @brief Sleep a number of microseconds */
+static void Sleep(uint32_t usec);
+
+/** @brief Called by the driver task each time a block of a channel is completed */
+static void BlockReady(void *param);
+
+/** @brief Convert frames one at a time, as the driver task reads them, and wait for the blocks */
+static bool Convert(uint32_t frames, uint32_t blocks_ch0, uint32_t blocks_ch1);
+
+/** @brief Read the next block of a channel and check its sequence and samples */
+static uint32_t CheckBlock(adc_ch_t channel, uint32_t sequence, uint32_t position, const char *name);
+
+/** @brief Blocks of one and two channels, starting a channel and a slow reader */
+static uint32_t TestReplay(void);
+
+/** @brief Converter thread: frames until converting is cleared */
+static void *Converter(void *arg);
+
+/** @brief Blocks of a channel already started, read after starting or stopping another one */
+static uint32_t CheckRamp(int64_t *last_sequence, uint16_t *last_sample);
+
+/** @brief Start and stop a channel while converting */
+static uint32_t TestReconfigure(void);
+/*==================[internal functions definition]==========================*/
+static void Sleep(uint32_t usec){
+	struct timespec delay = {usec / 1000000, (usec % 1000000) * 1000L};
+
+	nanosleep(&delay, NULL);
+}
+
+static void BlockReady(void *param){
+	__atomic_fetch_add((uint32_t *)param, 1, __ATOMIC_RELEASE);
+}
+
+static bool Convert(uint32_t frames, uint32_t blocks_ch0, uint32_t blocks_ch1){
+	mock_adc_stats_t stats;
+	uint32_t i, waited;
+
+	for (i = 0; i < frames; i++){
+		MockAdcConvert(1);
+		/* The store never fills: no frame is dropped */
+		for (waited = 0; waited < WAIT_TIMEOUT_MS * 10; waited++){
+			MockAdcGetStats(&stats);
+			if (stats.stored == 0){
+				break;
+			}
+			Sleep(100);
+		}
+	}
+	for (waited = 0; waited < WAIT_TIMEOUT_MS * 10; waited++){
+		if ((__atomic_load_n(&blocks_ready[0], __ATOMIC_ACQUIRE) >= blocks_ch0) &&
+			(__atomic_load_n(&blocks_ready[1], __ATOMIC_ACQUIRE) >= blocks_ch1)){
+			return true;
+		}
+		Sleep(100);
+	}
+	printf("FAIL: %u and %u blocks completed instead of %u and %u\n", blocks_ready[0], blocks_ready[1], blocks_ch0, blocks_ch1);
+	return false;
+}
+
+static uint32_t CheckBlock(adc_ch_t channel, uint32_t sequence, uint32_t position, const char *name){
+	analog_block_t block;
+	uint32_t i;
+
+	if (!AnalogInputReadBlock(channel, &block)){
+		printf("FAIL: %s: no block %u of CH%u\n", name, sequence, channel);
+		return 1;
+	}
+	if (block.sequence != sequence){
+		printf("FAIL: %s: block of CH%u has sequence %u instead of %u\n", name, channel, block.sequence, sequence);
+		return 1;
+	}
+	for (i = 0; i < ANALOG_BLOCK_SIZE; i++){
+		if (block.samples[i] != signals[channel][(position + i) % SIGNAL_LENGHT]){
+			printf("FAIL: %s: sample %u of block %u of CH%u is %u instead of %u\n", name, i, sequence, channel,
+				block.samples[i], signals[channel][(position + i) % SIGNAL_LENGHT]);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static uint32_t TestReplay(void){
+	analog_block_t block;
+	uint32_t i, failures = 0;
+
+	MockAdcReplay(ADC_CHANNEL_0, signals[0], SIGNAL_LENGHT);
+	MockAdcReplay(ADC_CHANNEL_1, signals[1], SIGNAL_LENGHT);
+
+	/* Alone: a frame is a block */
+	AnalogStartContinuous(CH0);
+	if (!Convert(3, 3, 0)){
+		return 1;
+	}
+	for (i = 0; i < 3; i++){
+		failures += CheckBlock(CH0, i, i * ANALOG_BLOCK_SIZE, "one channel");
+	}
+
+	/* With CH1: half a block of each in a frame, the blocks of CH0 go on */
+	AnalogStartContinuous(CH1);
+	if (!Convert(4, 5, 2)){
+		return failures + 1;
+	}
+	for (i = 3; i < 5; i++){
+		failures += CheckBlock(CH0, i, i * ANALOG_BLOCK_SIZE, "CH1 started");
+	}
+	for (i = 0; i < 2; i++){
+		failures += CheckBlock(CH1, i, i * ANALOG_BLOCK_SIZE, "CH1 started");
+	}
+
+	/* Slow reader: the blocks that don't fit in the queue are dropped */
+	AnalogStopContinuous(CH1);
+	if (!Convert(ANALOG_BLOCK_QTY + 2, 5 + ANALOG_BLOCK_QTY + 2, 2)){
+		return failures + 1;
+	}
+	for (i = 5; i < 5 + ANALOG_BLOCK_QTY; i++){
+		failures += CheckBlock(CH0, i, i * ANALOG_BLOCK_SIZE, "slow reader");
+	}
+	if (AnalogInputReadBlock(CH0, &block)){
+		printf("FAIL: block %u read from a full queue\n", block.sequence);
+		failures++;
+	}
+	if (!Convert(1, 5 + ANALOG_BLOCK_QTY + 3, 2)){
+		return failures + 1;
+	}
+	failures += CheckBlock(CH0, 5 + ANALOG_BLOCK_QTY + 2, (5 + ANALOG_BLOCK_QTY + 2) * ANALOG_BLOCK_SIZE, "after a full queue");
+	if (AnalogInputReadBlock(CH1, &block)){
+		printf("FAIL: block %u of CH1 after it was stopped\n", block.sequence);
+		failures++;
+	}
+	AnalogStopContinuous(CH0);
+	printf("%-24s %10u blocks\n", "replay", blocks_ready[0] + blocks_ready[1]);
+	return failures;
+}
+
+static void *Converter(void *arg){
+	mock_adc_stats_t stats;
+
+	while (__atomic_load_n(&converting, __ATOMIC_ACQUIRE)){
+		/* As fast as the driver task reads: the store never fills */
+		MockAdcGetStats(&stats);
+		if (stats.stored == 0){
+			MockAdcConvert(1);
+		}
+		Sleep(20);
+	}
+	return NULL;
+}
+
+static uint32_t CheckRamp(int64_t *last_sequence, uint16_t *last_sample){
+	analog_block_t block;
+	uint32_t i;
+
+	while (AnalogInputReadBlock(CH0, &block)){
+		if ((int64_t)block.sequence <= *last_sequence){
+			printf("FAIL: block %u of CH0 after block %lld\n", block.sequence, (long long)*last_sequence);
+			return 1;
+		}
+		/* Without a gap, samples go on from the last block */
+		if (((int64_t)block.sequence == *last_sequence + 1) && (block.samples[0] != (*last_sample + 1) % RAMP_LENGHT)){
+			printf("FAIL: block %u of CH0 starts at %u after %u, without a gap\n", block.sequence, block.samples[0], *last_sample);
+			return 1;
+		}
+		for (i = 1; i < ANALOG_BLOCK_SIZE; i++){
+			if (block.samples[i] != (block.samples[i - 1] + 1) % RAMP_LENGHT){
+				printf("FAIL: sample %u of block %u of CH0 is %u after %u\n", i, block.sequence, block.samples[i], block.samples[i - 1]);
+				return 1;
+			}
+		}
+		*last_sequence = block.sequence;
+		*last_sample = block.samples[ANALOG_BLOCK_SIZE - 1];
+	}
+	return 0;
+}
+
+static uint32_t TestReconfigure(void){
+	analog_block_t block;
+	mock_adc_stats_t stats;
+	pthread_t converter;
+	int64_t last_sequence = -1;
+	uint16_t last_sample = RAMP_LENGHT - 1;		/* The ramp is replayed from 0 */
+	uint32_t restart, failures = 0;
+	bool first;
+
+	MockAdcReplay(ADC_CHANNEL_0, ramp, RAMP_LENGHT);
+	AnalogStartContinuous(CH0);
+	__atomic_store_n(&converting, 1, __ATOMIC_RELEASE);
+	pthread_create(&converter, NULL, Converter, NULL);
+	for (restart = 0; (restart < RESTARTS) && (failures == 0); restart++){
+		AnalogStartContinuous(CH1);
+		Sleep(500 + (restart % 7) * 100);
+		failures += CheckRamp(&last_sequence, &last_sample);
+		AnalogStopContinuous(CH1);
+		/* Blocks of CH1 start over at each start */
+		for (first = true; AnalogInputReadBlock(CH1, &block); first = false){
+			if (first && (block.sequence != 0)){
+				printf("FAIL: first block of CH1 after start %u has sequence %u\n", restart, block.sequence);
+				failures++;
+			}
+		}
+		Sleep(300 + (restart % 5) * 100);
+		failures += CheckRamp(&last_sequence, &last_sample);
+	}
+	__atomic_store_n(&converting, 0, __ATOMIC_RELEASE);
+	pthread_join(converter, NULL);
+	AnalogStopContinuous(CH0);
+	MockAdcGetStats(&stats);
+	printf("%-24s %10u restarts %lld blocks of CH0 %u frames\n", "reconfigure", restart, (long long)last_sequence + 1, stats.converted);
+	if (last_sequence < RESTARTS){
+		printf("FAIL: %lld blocks of CH0 in %u restarts\n", (long long)last_sequence + 1, restart);
+		failures++;
+	}
+	if (stats.refused != 0){
+		printf("FAIL: %u ADC calls refused\n", stats.refused);
+		failures++;
+	}
+	return failures;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	analog_input_config_t config = {CH0, ADC_CONTINUOUS, BlockReady, NULL, SAMPLE_FREC};
+	uint32_t failures = 0, i;
+
+	for (i = 0; i < SIGNAL_LENGHT; i++){
+		/* Recorded signals: a 10 Hz sine with noise, and a sawtooth */
+		signals[0][i] = 2048 + 1500 * sin(2 * M_PI * 10 * i / SAMPLE_FREC) + (rand() % 64) - 32;
+		signals[1][i] = (i * 37) % 4096;
+	}
+	for (i = 0; i < RAMP_LENGHT; i++){
+		ramp[i] = i;
+	}
+	config.param_p = (void *)&blocks_ready[0];
+	AnalogInputInit(&config);
+	config.input = CH1;
+	config.param_p = (void *)&blocks_ready[1];
+	AnalogInputInit(&config);
+	failures += TestReplay();
+	failures += TestReconfigure();
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,265 @@
+/**
+ * @file test_chart.c
+ * @brief Host test of the ILI9341 scrolling strip chart
+ *
+ * The chart is drawn on the mocked LCD in both landscape orientations and the image
+ * shown (frame memory seen through the vertical scroll) is compared with the columns
+ * expected for the samples: the newest one at the right end of the chart. The SPI
+ * traffic of each column and the decimation of the samples are checked, and the host
+ * time per sample is printed.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ili9341.h"
+#include "gpio_mcu.h"
+#include "mock_lcd.h"
+/*==================[macros and definitions]=================================*/
+#define SCREEN_WIDTH	MOCK_LCD_HEIGHT		/*!< Landscape width */
+#define SCREEN_HEIGHT	MOCK_LCD_WIDTH		/*!< Landscape height */
+#define OUTSIDE			ILI9341_BLACK		/*!< Color around the chart */
+#define CHART_X			40
+#define CHART_WIDTH		200
+#define CHART_Y			20
+#define CHART_HEIGHT	200
+#define GRID_ROWS		3
+#define GRID_COLUMNS	25
+#define SAMPLES_PER_COLUMN	10
+#define COLUMNS			(CHART_WIDTH + 150)	/*!< Columns drawn: the chart wraps around */
+#define MAX_TRANSACTIONS	6				/*!< SPI transactions per column (the first one sets the rows too) */
+/*==================[internal data declaration]==============================*/
+static uint16_t screen[SCREEN_HEIGHT * SCREEN_WIDTH];
+static int32_t column_value[COLUMNS][2];	/*!< Value of each column of each trace */
+static const ili9341_chart_config_t config = {
+	.x = CHART_X, .width = CHART_WIDTH, .y = CHART_Y, .height = CHART_HEIGHT,
+	.background = ILI9341_WHITE, .grid = ILI9341_LIGHTGREY, .grid_rows = GRID_ROWS, .grid_columns = GRID_COLUMNS,
+	.sample_rate = 1000, .column_rate = 1000 / SAMPLES_PER_COLUMN, .traces = 2,
+	.trace = {{ILI9341_BLUE, 0, CHART_HEIGHT - 1, 0}, {ILI9341_RED, 0, CHART_HEIGHT - 1, 0}},
+};
+/*==================[internal functions declaration]=========================*/
+/** @brief Expected color of a row of a column (column 0 is the first one drawn) */
+static uint16_t ExpectedColor(uint32_t column, uint16_t row);
+
+/** @brief Draw the columns with a fixed scale and check the image shown and the SPI traffic */
+static uint32_t TestColumns(ili9341_orientation_t orientation, const char *name);
+
+/** @brief Check the number of columns drawn for a sample rate that is not a multiple of the column rate */
+static uint32_t TestDecimation(void);
+
+/** @brief Check that an autoscaled trace fills the chart without being clipped */
+static uint32_t TestAutoscale(void);
+
+/** @brief Print the host time per sample of a 1 kHz signal at 60 columns/s */
+static void TimeSamples(void);
+/*==================[internal functions definition]==========================*/
+static uint16_t ExpectedColor(uint32_t column, uint16_t row){
+	uint16_t color = config.background;
+	int32_t value = CHART_Y + CHART_HEIGHT - 1 - row;
+	int32_t low, high;
+	uint8_t i;
+
+	if ((row < CHART_Y) || (row >= CHART_Y + CHART_HEIGHT)){
+		return config.background;
+	}
+	for (i = 1; i <= GRID_ROWS; i++){
+		if (row == CHART_Y + i * CHART_HEIGHT / (GRID_ROWS + 1)){
+			color = config.grid;
+		}
+	}
+	if (column % GRID_COLUMNS == 0){
+		color = config.grid;
+	}
+	/* Traces are segments from the previous column to this one, the last trace on top */
+	for (i = 0; i < config.traces; i++){
+		low = high = column_value[column][i];
+		if (column > 0){
+			low = (column_value[column - 1][i] < low) ? column_value[column - 1][i] : low;
+			high = (column_value[column - 1][i] > high) ? column_value[column - 1][i] : high;
+		}
+		if ((value >= low) && (value <= high)){
+			color = config.trace[i].color;
+		}
+	}
+	return color;
+}
+
+static uint32_t TestColumns(ili9341_orientation_t orientation, const char *name){
+	mock_lcd_stats_t before, after;
+	uint32_t column, i, failures = 0;
+	uint16_t x, y, expected;
+	int32_t samples[2];
+
+	ILI9341Rotate(orientation);
+	ILI9341Fill(OUTSIDE);
+	if (!ILI9341ChartInit(&config)){
+		printf("FAIL: %s chart init\n", name);
+		return 1;
+	}
+	MockLcdGetStats(&before);
+	for (column = 0; column < COLUMNS; column++){
+		column_value[column][0] = (column * 7) % CHART_HEIGHT;
+		column_value[column][1] = (column * column) % CHART_HEIGHT;
+		/* Samples between the previous value and this one are inside the segment */
+		for (i = 0; i < SAMPLES_PER_COLUMN; i++){
+			samples[0] = column_value[column][0];
+			if ((column > 0) && (i < SAMPLES_PER_COLUMN / 2)){
+				samples[0] = (column_value[column - 1][0] + column_value[column][0]) / 2;
+			}
+			samples[1] = column_value[column][1];
+			ILI9341ChartAdd(samples);
+		}
+	}
+	MockLcdGetStats(&after);
+	MockLcdScreen(screen);
+
+	for (y = 0; y < SCREEN_HEIGHT; y++){
+		for (x = 0; x < SCREEN_WIDTH; x++){
+			if ((x < CHART_X) || (x >= CHART_X + CHART_WIDTH)){
+				expected = OUTSIDE;
+			}
+			else{
+				expected = ExpectedColor(COLUMNS - CHART_WIDTH + x - CHART_X, y);
+			}
+			if (screen[y * SCREEN_WIDTH + x] != expected){
+				printf("FAIL: %s pixel (%u,%u) is 0x%04X instead of 0x%04X\n", name, x, y,
+					screen[y * SCREEN_WIDTH + x], expected);
+				failures++;
+				y = SCREEN_HEIGHT;
+				break;
+			}
+		}
+	}
+	printf("%-24s %10u columns %6.2f trans/column %6.2f waits/column\n", name, COLUMNS,
+		(double)(after.transactions - before.transactions) / COLUMNS, (double)(after.waits - before.waits) / COLUMNS);
+	if (after.transactions - before.transactions > MAX_TRANSACTIONS * COLUMNS + 2){
+		printf("FAIL: %s needs more than %u transactions per column\n", name, MAX_TRANSACTIONS);
+		failures++;
+	}
+	if (after.waits - before.waits > COLUMNS){
+		printf("FAIL: %s waits more than once per column\n", name);
+		failures++;
+	}
+	ILI9341ChartDeInit();
+	return failures;
+}
+
+static uint32_t TestDecimation(void){
+	ili9341_chart_config_t decimated = config;
+	mock_lcd_stats_t before, after;
+	int32_t samples[2] = {0, 0};
+	uint32_t i;
+
+	decimated.sample_rate = 1000;
+	decimated.column_rate = 60;
+	ILI9341Rotate(ILI9341_Landscape_1);
+	ILI9341ChartInit(&decimated);
+	MockLcdGetStats(&before);
+	for (i = 0; i < 3 * decimated.sample_rate; i++){
+		ILI9341ChartAdd(samples);
+	}
+	/* Run the last queued column */
+	MockLcdScreen(screen);
+	MockLcdGetStats(&after);
+	ILI9341ChartDeInit();
+	/* A scroll per column */
+	if (after.scrolls - before.scrolls != 3 * decimated.column_rate){
+		printf("FAIL: %u columns drawn for 3 s at %u columns/s\n", after.scrolls - before.scrolls, decimated.column_rate);
+		return 1;
+	}
+	return 0;
+}
+
+static uint32_t TestAutoscale(void){
+	ili9341_chart_config_t scaled = config;
+	int32_t samples[2], top = SCREEN_HEIGHT, bottom = 0;
+	uint32_t i;
+	uint16_t x, y;
+
+	scaled.traces = 1;
+	scaled.grid_rows = 0;
+	scaled.grid_columns = 0;
+	scaled.trace[0].min = 0;
+	scaled.trace[0].max = 1;
+	scaled.trace[0].autoscale = 1;
+	ILI9341Rotate(ILI9341_Landscape_2);
+	ILI9341Fill(OUTSIDE);
+	ILI9341ChartInit(&scaled);
+	/* A big pulse first, then a smaller triangle wave: the range follows the last sweep */
+	for (i = 0; i < 200 * SAMPLES_PER_COLUMN; i++){
+		samples[0] = (i == 100) ? 100000 : 0;
+		ILI9341ChartAdd(samples);
+	}
+	for (i = 0; i < 3 * CHART_WIDTH * SAMPLES_PER_COLUMN; i++){
+		samples[0] = 1000 + (int32_t)(i % 400 < 200 ? i % 400 : 400 - i % 400) * 20;
+		ILI9341ChartAdd(samples);
+	}
+	MockLcdScreen(screen);
+	ILI9341ChartDeInit();
+	for (y = 0; y < SCREEN_HEIGHT; y++){
+		for (x = CHART_X; x < CHART_X + CHART_WIDTH; x++){
+			if (screen[y * SCREEN_WIDTH + x] == scaled.trace[0].color){
+				top = (y < top) ? y : top;
+				bottom = (y > bottom) ? y : bottom;
+			}
+		}
+	}
+	printf("%-24s trace on rows %d to %d of %d to %d\n", "autoscale", top, bottom, CHART_Y, CHART_Y + CHART_HEIGHT - 1);
+	/* Inside the chart with the margin, and over most of its height */
+	if ((top <= CHART_Y) || (bottom >= CHART_Y + CHART_HEIGHT - 1) || (bottom - top < CHART_HEIGHT * 3 / 4)){
+		printf("FAIL: autoscaled trace does not fit the chart\n");
+		return 1;
+	}
+	return 0;
+}
+
+static void TimeSamples(void){
+	ili9341_chart_config_t ecg = config;
+	int32_t samples[2];
+	uint32_t i, count = 60 * 1000;
+	clock_t start;
+
+	ecg.sample_rate = 1000;
+	ecg.column_rate = 60;
+	ecg.traces = 1;
+	ecg.trace[0].autoscale = 1;
+	ILI9341Rotate(ILI9341_Landscape_1);
+	ILI9341ChartInit(&ecg);
+	start = clock();
+	for (i = 0; i < count; i++){
+		/* QRS like spike every 800 ms */
+		samples[0] = (i % 800 < 40) ? (int32_t)(i % 800) * 50 : 0;
+		ILI9341ChartAdd(samples);
+	}
+	printf("%-24s %.3f us/sample on host (1 kHz, 60 columns/s, SPI mocked)\n", "time",
+		(double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / count);
+	ILI9341ChartDeInit();
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	uint32_t failures = 0;
+
+	ILI9341Init(SPI_1, GPIO_3, GPIO_2);
+	/* Charts need a landscape orientation */
+	if (ILI9341ChartInit(&config)){
+		printf("FAIL: chart started in portrait\n");
+		failures++;
+	}
+	failures += TestColumns(ILI9341_Landscape_1, "chart landscape 1");
+	failures += TestColumns(ILI9341_Landscape_2, "chart landscape 2");
+	failures += TestDecimation();
+	failures += TestAutoscale();
+	TimeSamples();
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
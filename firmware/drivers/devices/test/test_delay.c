@@ -0,0 +1,277 @@
+/**
+ * @file test_delay.c
+ * @brief Host test of the delay driver (delay_mcu), with the ESP-IDF general purpose timer mocked
+ *
+ * Short delays, DelayUs(0) included, must use the ROM delay without creating the shared
+ * timer. Tasks waiting at the same time, started out of order, must each wake up at the
+ * first count at or after its deadline, earliest first, on a single timer. A deadline
+ * already passed when its alarm is programmed, or even before, must wake the task up
+ * without waiting for an alarm. The wake-up statistics must count every timer delay with
+ * its latency, and start over when reset.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <time.h>
+#include "delay_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "mock_gptimer.h"
+/*==================[macros and definitions]=================================*/
+#define WAITERS			6
+#define STEP_US			30				/*!< Count moved at a time: latencies up to STEP_US - 1 */
+#define WAIT_TIMEOUT_MS	1000			/*!< Maximun time for the tasks to start or wake up */
+#define QUEUED_MS		50				/*!< Time for the tasks started to queue their deadlines */
+
+/**
+ * @brief Task waiting for a delay
+ */
+typedef struct {
+	uint16_t delay;			/*!< Delay asked */
+	bool msec;				/*!< DelayMs() instead of DelayUs() */
+	uint64_t woken_at;		/*!< Count when the task ran again */
+	uint32_t order;			/*!< Tasks woken before */
+} waiter_t;
+/*==================[internal data declaration]==============================*/
+static waiter_t waiters[WAITERS] = {
+	{700, false}, {200, false}, {1, true}, {500, false}, {100, false}, {300, false},
+};
+static volatile uint32_t started;			/*!< Tasks that called the delay */
+static volatile uint32_t woken;				/*!< Tasks that returned from the delay */
+/*==================[internal functions declaration]=========================*/
+/** @brief Sleep a number of microseconds */
+static void Sleep(uint32_t usec);
+
+/** @brief Deadline of a task waiting, in microseconds from its start */
+static uint32_t Deadline(const waiter_t *waiter);
+
+/** @brief Task: delay, then log the count and the order */
+static void Waiter(void *param);
+
+/** @brief Wait for a number of tasks started or woken up */
+static bool WaitFor(volatile uint32_t *tasks, uint32_t count);
+
+/** @brief Check the wake-up statistics */
+static uint32_t CheckStats(uint32_t wakeups, uint32_t mean, uint32_t max, const char *name);
+
+/** @brief DelayUs(0) and the longest ROM delay don't touch the timer */
+static uint32_t TestShort(void);
+
+/** @brief Several tasks with deadlines out of order */
+static uint32_t TestWaiters(void);
+
+/** @brief Deadlines passed before or while the alarm is programmed */
+static uint32_t TestLate(void);
+
+/** @brief Statistics reset */
+static uint32_t TestReset(void);
+/*==================[internal functions definition]==========================*/
+static void Sleep(uint32_t usec){
+	struct timespec delay = {usec / 1000000, (usec % 1000000) * 1000L};
+
+	nanosleep(&delay, NULL);
+}
+
+static uint32_t Deadline(const waiter_t *waiter){
+	return waiter->msec ? waiter->delay * 1000 : waiter->delay;
+}
+
+static void Waiter(void *param){
+	waiter_t *waiter = param;
+	mock_gptimer_stats_t stats;
+
+	__atomic_fetch_add(&started, 1, __ATOMIC_RELEASE);
+	if (waiter->msec){
+		DelayMs(waiter->delay);
+	}
+	else{
+		DelayUs(waiter->delay);
+	}
+	MockGptimerGetStats(&stats);
+	waiter->woken_at = stats.count;
+	waiter->order = __atomic_fetch_add(&woken, 1, __ATOMIC_ACQ_REL);
+	vTaskDelete(NULL);
+}
+
+static bool WaitFor(volatile uint32_t *tasks, uint32_t count){
+	uint32_t waited;
+
+	for (waited = 0; waited < WAIT_TIMEOUT_MS * 10; waited++){
+		if (__atomic_load_n(tasks, __ATOMIC_ACQUIRE) >= count){
+			return true;
+		}
+		Sleep(100);
+	}
+	return false;
+}
+
+static uint32_t CheckStats(uint32_t wakeups, uint32_t mean, uint32_t max, const char *name){
+	delay_stats_t stats;
+
+	DelayGetStats(&stats);
+	if ((stats.wakeups != wakeups) || (stats.mean_latency_us != mean) || (stats.max_latency_us != max)){
+		printf("FAIL: %s: %u wake-ups, latency %u us mean %u us max, instead of %u, %u us and %u us\n", name,
+			stats.wakeups, stats.mean_latency_us, stats.max_latency_us, wakeups, mean, max);
+		return 1;
+	}
+	return 0;
+}
+
+static uint32_t TestShort(void){
+	mock_gptimer_stats_t stats;
+	uint32_t failures = 0;
+
+	MockGptimerReset();
+	DelayUs(0);
+	DelayUs(50);
+	MockGptimerGetStats(&stats);
+	printf("%-24s %10u ROM delays %u timers created\n", "short delays", stats.rom_delays, stats.timers);
+	if ((stats.rom_delays != 2) || (stats.timers != 0) || (stats.reads != 0)){
+		printf("FAIL: DelayUs(0) and DelayUs(50): %u ROM delays, %u timers created, %u count reads\n",
+			stats.rom_delays, stats.timers, stats.reads);
+		failures++;
+	}
+	failures += CheckStats(0, 0, 0, "short delays");
+	return failures;
+}
+
+static uint32_t TestWaiters(void){
+	mock_gptimer_stats_t stats;
+	uint64_t start;
+	uint32_t i, j, elapsed, expected, rank, wake, latency_sum = 0, latency_max = 0, failures = 0;
+
+	DelayResetStats();
+	MockGptimerReset();
+	MockGptimerGetStats(&stats);
+	start = stats.count;
+	started = 0;
+	woken = 0;
+	for (i = 0; i < WAITERS; i++){
+		xTaskCreate(Waiter, "waiter", 2048, &waiters[i], 5, NULL);
+	}
+	if (!WaitFor(&started, WAITERS)){
+		printf("FAIL: %u of %u tasks started\n", started, WAITERS);
+		return 1;
+	}
+	/* The count doesn't move meanwhile: every deadline is from the same start */
+	Sleep(QUEUED_MS * 1000);
+	MockGptimerGetStats(&stats);
+	if ((stats.timers != 1) || !stats.running || !stats.alarm_enabled || (stats.alarm != start + Deadline(&waiters[4]))){
+		printf("FAIL: %u tasks waiting: %u timers created, alarm %s at %llu instead of %llu\n", WAITERS, stats.timers,
+			stats.alarm_enabled ? "on" : "off", (unsigned long long)stats.alarm, (unsigned long long)(start + Deadline(&waiters[4])));
+		failures++;
+	}
+	for (elapsed = 0; __atomic_load_n(&woken, __ATOMIC_ACQUIRE) < WAITERS; ){
+		MockGptimerAdvance(STEP_US);
+		elapsed += STEP_US;
+		for (i = 0, expected = 0; i < WAITERS; i++){
+			expected += (Deadline(&waiters[i]) <= elapsed);
+		}
+		if (!WaitFor(&woken, expected)){
+			printf("FAIL: %u of %u tasks woken up %u us after the start\n", woken, expected, elapsed);
+			return failures + 1;
+		}
+	}
+	for (i = 0; i < WAITERS; i++){
+		for (j = 0, rank = 0; j < WAITERS; j++){
+			rank += (Deadline(&waiters[j]) < Deadline(&waiters[i]));
+		}
+		/* First count moved at or after the deadline */
+		wake = (Deadline(&waiters[i]) + STEP_US - 1) / STEP_US * STEP_US;
+		if ((waiters[i].woken_at != start + wake) || (waiters[i].order != rank)){
+			printf("FAIL: task %u (%u us) woken up %lld us after the start and %u-th, instead of %u us and %u-th\n", i,
+				Deadline(&waiters[i]), (long long)(waiters[i].woken_at - start), waiters[i].order, wake, rank);
+			failures++;
+		}
+		latency_sum += wake - Deadline(&waiters[i]);
+		if (wake - Deadline(&waiters[i]) > latency_max){
+			latency_max = wake - Deadline(&waiters[i]);
+		}
+	}
+	MockGptimerGetStats(&stats);
+	printf("%-24s %10u tasks %u alarms\n", "out of order", WAITERS, stats.alarms_fired);
+	if ((stats.timers != 1) || (stats.alarms_fired != WAITERS) || (stats.alarms_late != 0) || stats.alarm_enabled || (stats.refused != 0)){
+		printf("FAIL: %u tasks: %u timers created, %u alarms fired, %u programmed late, alarm %s, %u calls refused\n", WAITERS,
+			stats.timers, stats.alarms_fired, stats.alarms_late, stats.alarm_enabled ? "left on" : "off", stats.refused);
+		failures++;
+	}
+	failures += CheckStats(WAITERS, latency_sum / WAITERS, latency_max, "out of order");
+	return failures;
+}
+
+static uint32_t TestLate(void){
+	/* Read time 100 us: passed before the alarm; 40 us: passed while it is programmed */
+	static const uint32_t read_times[2] = {100, 40};
+	static waiter_t late = {60, false};
+	mock_gptimer_stats_t stats;
+	uint32_t i, failures = 0;
+
+	DelayResetStats();
+	for (i = 0; i < 2; i++){
+		MockGptimerReset();
+		MockGptimerSetReadTime(read_times[i]);
+		started = 0;
+		woken = 0;
+		xTaskCreate(Waiter, "late", 2048, &late, 5, NULL);
+		/* The count only moves when read: an alarm would never fire */
+		if (!WaitFor(&woken, 1)){
+			printf("FAIL: task not woken up by a deadline passed, count read every %u us\n", read_times[i]);
+			MockGptimerSetReadTime(0);
+			return failures + 1;
+		}
+		MockGptimerGetStats(&stats);
+		if ((stats.alarms_set != i) || (stats.alarms_late != i) || (stats.alarms_fired != 0) || stats.alarm_enabled){
+			printf("FAIL: deadline passed, count read every %u us: %u alarms programmed, %u late, %u fired, alarm %s\n",
+				read_times[i], stats.alarms_set, stats.alarms_late, stats.alarms_fired, stats.alarm_enabled ? "left on" : "off");
+			failures++;
+		}
+	}
+	MockGptimerSetReadTime(0);
+	printf("%-24s %10u tasks\n", "deadline passed", 2);
+	/* Woken up at the read after the deadline: 140 us after it, then 100 us */
+	failures += CheckStats(2, 120, 140, "deadline passed");
+	return failures;
+}
+
+static uint32_t TestReset(void){
+	static waiter_t waiter = {100, false};
+	uint32_t failures = 0;
+
+	DelayResetStats();
+	failures += CheckStats(0, 0, 0, "reset");
+	started = 0;
+	woken = 0;
+	xTaskCreate(Waiter, "waiter", 2048, &waiter, 5, NULL);
+	if (!WaitFor(&started, 1)){
+		printf("FAIL: task not started\n");
+		return failures + 1;
+	}
+	Sleep(QUEUED_MS * 1000);
+	MockGptimerAdvance(130);
+	if (!WaitFor(&woken, 1)){
+		printf("FAIL: task not woken up after a reset of the statistics\n");
+		return failures + 1;
+	}
+	failures += CheckStats(1, 30, 30, "after a reset");
+	return failures;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	uint32_t failures = 0;
+
+	failures += TestShort();
+	failures += TestWaiters();
+	failures += TestLate();
+	failures += TestReset();
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
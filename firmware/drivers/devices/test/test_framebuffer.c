@@ -0,0 +1,174 @@
+/**
+ * @file test_framebuffer.c
+ * @brief Host test of the ILI9341 framebuffer mode across rotations
+ *
+ * A scene is drawn in each orientation, rotating the LCD between them, straight to the
+ * mocked LCD: its frame memory is the golden image. The same scene drawn in framebuffer
+ * mode must leave the same frame memory, whether it is flushed once at the end or after
+ * the drawings of each orientation. As the LCD keeps its frame memory when it is rotated,
+ * a rotation alone must not send anything on the next flush, and rotating through all the
+ * orientations back to the first one must leave the framebuffer as it was.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "ili9341.h"
+#include "fonts.h"
+#include "gpio_mcu.h"
+#include "mock_lcd.h"
+/*==================[macros and definitions]=================================*/
+#define BACKGROUND		ILI9341_WHITE
+#define PICTURE_SIZE	24			/*!< Width and height of the picture drawn */
+#define ORIENTATIONS	4
+
+/**
+ * @brief When the framebuffer is flushed
+ */
+typedef enum {
+	DRAW_DIRECT,				/*!< No framebuffer: golden image */
+	FLUSH_AT_END,				/*!< Once, after drawing in all the orientations */
+	FLUSH_EACH,					/*!< After the drawings of each orientation, before rotating */
+} flush_mode_t;
+/*==================[internal data declaration]==============================*/
+static const ili9341_orientation_t orientations[ORIENTATIONS] = {
+	ILI9341_Landscape_1, ILI9341_Portrait_2, ILI9341_Landscape_2, ILI9341_Portrait_1
+};
+static const char *flush_names[] = {"direct", "flush at end", "flush each"};
+static uint16_t golden_frame[MOCK_LCD_HEIGHT][MOCK_LCD_WIDTH];
+static uint8_t picture[PICTURE_SIZE * PICTURE_SIZE * 2];
+/*==================[internal functions declaration]=========================*/
+/** @brief Asymmetric drawings, so that a mirrored or transposed pixel is seen */
+static void DrawScene(uint8_t index);
+
+/** @brief Draw the scene in all the orientations, ending in ILI9341_Portrait_1 */
+static void DrawRotations(flush_mode_t mode);
+
+/** @brief Frame memory is the golden image */
+static uint32_t CheckGolden(const char *name);
+
+/** @brief Rotations without drawings send nothing and keep the framebuffer */
+static uint32_t TestRotateOnly(void);
+/*==================[internal functions definition]==========================*/
+static void DrawScene(uint8_t index){
+	char text[] = "Rotation 0";
+
+	text[sizeof(text) - 2] += index;
+	ILI9341DrawFilledRectangle(10 + index * 5, 10, 60, 30 + index * 10, ILI9341_RED);
+	ILI9341DrawString(5, 50, text, &font_19, ILI9341_BLACK, ILI9341_LIGHTGREY);
+	ILI9341DrawLine(0, 100, 200, 140 + index * 20, ILI9341_BLUE);
+	ILI9341DrawFilledCircle(150, 180, 20 + index * 5, ILI9341_GREEN);
+	ILI9341DrawPicture(100 + index * 20, 20, PICTURE_SIZE, PICTURE_SIZE, picture);
+	/* Clipped by the right edge of the orientation */
+	ILI9341DrawInt(200, 200 + index, 98765, 5, &font_22, ILI9341_WHITE, ILI9341_BLACK);
+}
+
+static void DrawRotations(flush_mode_t mode){
+	uint8_t i;
+
+	ILI9341Rotate(ILI9341_Portrait_1);
+	MockLcdReset(BACKGROUND);
+	if (mode != DRAW_DIRECT){
+		ILI9341FramebufferInit();
+	}
+	for (i = 0; i < ORIENTATIONS; i++){
+		ILI9341Rotate(orientations[i]);
+		DrawScene(i);
+		if (mode == FLUSH_EACH){
+			ILI9341Flush();
+		}
+	}
+	if (mode != DRAW_DIRECT){
+		ILI9341FramebufferDeInit();
+	}
+}
+
+static uint32_t CheckGolden(const char *name){
+	uint16_t x, y;
+
+	for (y = 0; y < MOCK_LCD_HEIGHT; y++){
+		for (x = 0; x < MOCK_LCD_WIDTH; x++){
+			if (mock_lcd_frame[y][x] != golden_frame[y][x]){
+				printf("FAIL: %s pixel (%u,%u) is 0x%04X instead of 0x%04X\n", name, x, y,
+					mock_lcd_frame[y][x], golden_frame[y][x]);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+static uint32_t TestRotateOnly(void){
+	mock_lcd_stats_t stats;
+	uint32_t failures = 0;
+	uint8_t i;
+
+	/* Golden image of a single scene */
+	ILI9341Rotate(ILI9341_Portrait_1);
+	MockLcdReset(BACKGROUND);
+	DrawScene(0);
+	memcpy(golden_frame, mock_lcd_frame, sizeof(golden_frame));
+
+	/* Flushed before rotating: the LCD already shows the framebuffer */
+	MockLcdReset(BACKGROUND);
+	ILI9341FramebufferInit();
+	DrawScene(0);
+	ILI9341Flush();
+	for (i = 0; i < ORIENTATIONS; i++){
+		MockLcdReset(BACKGROUND);
+		ILI9341Rotate(orientations[i]);
+		ILI9341Flush();
+		MockLcdGetStats(&stats);
+		/* Only the memory access control command and its parameter */
+		if (stats.bytes > 2){
+			printf("FAIL: %u bytes sent by the flush after rotating\n", stats.bytes);
+			failures++;
+		}
+	}
+	ILI9341FramebufferDeInit();
+
+	/* Not flushed: the pixels and their dirty areas go around all the orientations */
+	MockLcdReset(BACKGROUND);
+	ILI9341FramebufferInit();
+	ILI9341Flush();
+	DrawScene(0);
+	for (i = 0; i < ORIENTATIONS; i++){
+		ILI9341Rotate(orientations[i]);
+	}
+	ILI9341FramebufferDeInit();
+	failures += CheckGolden("rotations without flush");
+	return failures;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	uint32_t failures = 0, i;
+	mock_lcd_stats_t stats;
+	flush_mode_t mode;
+
+	for (i = 0; i < PICTURE_SIZE * PICTURE_SIZE; i++){
+		/* Color changes along both axes */
+		picture[2 * i] = (i % PICTURE_SIZE) * 8;
+		picture[2 * i + 1] = (i / PICTURE_SIZE) * 8;
+	}
+	ILI9341Init(SPI_1, GPIO_3, GPIO_2);
+	DrawRotations(DRAW_DIRECT);
+	memcpy(golden_frame, mock_lcd_frame, sizeof(golden_frame));
+	for (mode = FLUSH_AT_END; mode <= FLUSH_EACH; mode++){
+		DrawRotations(mode);
+		MockLcdGetStats(&stats);
+		printf("%-24s %10u bytes\n", flush_names[mode], stats.bytes);
+		failures += CheckGolden(flush_names[mode]);
+	}
+	failures += TestRotateOnly();
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
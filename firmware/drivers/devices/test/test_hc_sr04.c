@@ -0,0 +1,206 @@
+/**
+ * @file test_hc_sr04.c
+ * @brief Host test of the HC-SR04 driver
+ *
+ * The distance is computed from synthetic echo edge timestamps and compared with the
+ * one of the echo width. The median filter must only use the distances measured while
+ * its window fills. Then the driver measures a mocked sensor: after being initialized
+ * again with another echo pin, and continuously, where the first filtered distance
+ * must already be the one measured.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <time.h>
+#include "hc_sr04.h"
+#include "mock_hc_sr04.h"
+/*==================[macros and definitions]=================================*/
+#define ECHO_PIN		GPIO_3
+#define OTHER_ECHO_PIN	GPIO_1
+#define TRIGGER_PIN		GPIO_2
+#define DISTANCE_MM		500
+#define DISTANCE_ERROR	2			/*!< Tolerance (mm): time between the mocked echo edges */
+#define MEDIAN_LEN		5
+#define RANGING_TIMEOUT	1000		/*!< Maximun time to the first continuous measurement (ms) */
+
+/**
+ * @brief Echo edges and the distance expected
+ */
+typedef struct {
+	int64_t rise_us;
+	int64_t fall_us;
+	uint16_t distance_mm;
+} edges_t;
+/*==================[internal data declaration]==============================*/
+static volatile uint32_t measurements;		/*!< Continuous measurements done */
+/*==================[internal functions declaration]=========================*/
+/** @brief Sleep a number of milliseconds */
+static void Sleep(uint32_t msec);
+
+/** @brief Distance of edge timestamps, with invalid and saturated pulses */
+static uint32_t TestEdges(void);
+
+/** @brief Median of the distances measured while the window fills, then of the last ones */
+static uint32_t TestMedian(void);
+
+/** @brief Check a measured distance */
+static uint32_t CheckDistance(uint16_t distance_mm, const char *name);
+
+/** @brief Measure after initializing again with another echo pin */
+static uint32_t TestReinit(void);
+
+/** @brief Called after each continuous measurement */
+static void Measured(void *param);
+
+/** @brief The first continuous measurement is not filtered with empty samples */
+static uint32_t TestRanging(void);
+/*==================[internal functions definition]==========================*/
+static void Sleep(uint32_t msec){
+	struct timespec delay = {msec / 1000, (msec % 1000) * 1000000L};
+
+	nanosleep(&delay, NULL);
+}
+
+static uint32_t TestEdges(void){
+	/* Timestamps of esp_timer_get_time() after a long time running */
+	const int64_t start = 3600LL * 1000000;
+	const edges_t edges[] = {
+		{start, start + 5900, 1000},		/* 59 us per cm */
+		{start, start + 59, 10},
+		{start, start + 30, 5},				/* Rounded */
+		{start, start + 17700, 3000},		/* Maximun distance */
+		{start, start + 30000, 3000},		/* Saturated */
+		{start, start, 0},					/* No pulse */
+		{start + 100, start, 0},			/* Falling edge before rising edge */
+	};
+	uint32_t i, failures = 0;
+	uint16_t distance;
+
+	for (i = 0; i < sizeof(edges) / sizeof(edges[0]); i++){
+		distance = HcSr04EdgesToMillimeters(edges[i].rise_us, edges[i].fall_us);
+		if (distance != edges[i].distance_mm){
+			printf("FAIL: %lld us echo is %u mm instead of %u mm\n", (long long)(edges[i].fall_us - edges[i].rise_us),
+				distance, edges[i].distance_mm);
+			failures++;
+		}
+		if ((edges[i].fall_us > edges[i].rise_us) &&
+			(distance != HcSr04EchoToMillimeters(HcSr04EchoWidth(edges[i].rise_us, edges[i].fall_us)))){
+			printf("FAIL: edges and width of a %lld us echo give different distances\n",
+				(long long)(edges[i].fall_us - edges[i].rise_us));
+			failures++;
+		}
+	}
+	return failures;
+}
+
+static uint32_t TestMedian(void){
+	/* Medians of the distances added up to each one, then of the last MEDIAN_LEN */
+	const uint16_t distances[] = {800, 900, 100, 850, 820, 3000, 3000, 3000, 810};
+	const uint16_t medians[] = {800, 900, 800, 850, 820, 850, 850, 3000, 3000};
+	hc_sr04_median_t filter;
+	uint32_t i, failures = 0;
+	uint16_t median;
+
+	HcSr04MedianInit(&filter, MEDIAN_LEN);
+	for (i = 0; i < sizeof(distances) / sizeof(distances[0]); i++){
+		median = HcSr04MedianAdd(&filter, distances[i]);
+		if (median != medians[i]){
+			printf("FAIL: median after %u distances is %u instead of %u\n", i + 1, median, medians[i]);
+			failures++;
+		}
+	}
+	/* Window lengths out of range */
+	HcSr04MedianInit(&filter, 0);
+	HcSr04MedianAdd(&filter, 100);
+	if (HcSr04MedianAdd(&filter, 200) != 200){
+		printf("FAIL: window of 0 distances is not 1\n");
+		failures++;
+	}
+	HcSr04MedianInit(&filter, HC_SR04_MEDIAN_MAX + 10);
+	if (filter.len != HC_SR04_MEDIAN_MAX){
+		printf("FAIL: window of %u distances\n", filter.len);
+		failures++;
+	}
+	return failures;
+}
+
+static uint32_t CheckDistance(uint16_t distance_mm, const char *name){
+	printf("%-24s %10u mm (%u mm)\n", name, distance_mm, DISTANCE_MM);
+	if ((distance_mm < DISTANCE_MM) || (distance_mm > DISTANCE_MM + DISTANCE_ERROR)){
+		printf("FAIL: %s distance is %u mm\n", name, distance_mm);
+		return 1;
+	}
+	return 0;
+}
+
+static uint32_t TestReinit(void){
+	uint32_t failures = 0;
+	uint16_t distance_cm;
+
+	MockHcSr04Connect(ECHO_PIN, TRIGGER_PIN);
+	MockHcSr04Distance(DISTANCE_MM);
+	HcSr04Init(ECHO_PIN, TRIGGER_PIN);
+	failures += CheckDistance(HcSr04ReadDistanceInMillimeters(), "first init");
+	HcSr04Deinit();
+
+	/* Sensor wired to another pin */
+	MockHcSr04Connect(OTHER_ECHO_PIN, TRIGGER_PIN);
+	HcSr04Init(OTHER_ECHO_PIN, TRIGGER_PIN);
+	failures += CheckDistance(HcSr04ReadDistanceInMillimeters(), "init on another pin");
+	distance_cm = HcSr04ReadDistanceInCentimeters();
+	if ((distance_cm < DISTANCE_MM / 10) || (distance_cm > (DISTANCE_MM + DISTANCE_ERROR) / 10)){
+		printf("FAIL: distance is %u cm\n", distance_cm);
+		failures++;
+	}
+	if (MockHcSr04Echoes() != 2){
+		printf("FAIL: %u echoes seen on the new pin instead of 2\n", MockHcSr04Echoes());
+		failures++;
+	}
+	return failures;
+}
+
+static void Measured(void *param){
+	measurements++;
+}
+
+static uint32_t TestRanging(void){
+	uint32_t failures = 0, waited;
+
+	measurements = 0;
+	if (!HcSr04StartRanging(MEDIAN_LEN, Measured, NULL)){
+		printf("FAIL: ranging not started\n");
+		return 1;
+	}
+	for (waited = 0; (measurements == 0) && (waited < RANGING_TIMEOUT); waited++){
+		Sleep(1);
+	}
+	failures += CheckDistance(HcSr04ReadDistanceInMillimeters(), "first ranging");
+	HcSr04StopRanging();
+	return failures;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	uint32_t failures = 0;
+
+	failures += TestEdges();
+	failures += TestMedian();
+	failures += TestReinit();
+	failures += TestRanging();
+	HcSr04Deinit();
+	if (HcSr04StartRanging(MEDIAN_LEN, NULL, NULL)){
+		printf("FAIL: ranging started after de-initialization\n");
+		HcSr04StopRanging();
+		failures++;
+	}
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
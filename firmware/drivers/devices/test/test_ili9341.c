@@ -0,0 +1,350 @@
+/**
+ * @file test_ili9341.c
+ * @brief Host test of the ILI9341 primitive rasteriser: pixels and SPI transactions
+ *
+ * Each primitive is drawn twice on the mocked LCD: with the previous algorithm, one
+ * pixel (or one line for filled shapes) per point, and with the driver function. Both 
+ * must leave the same pixels on the frame memory. The SPI traffic of the driver is 
+ * compared with the cost the previous driver had for the same pixels and lines: every 
+ * command, parameter and data buffer was a transaction that was waited for.
+ *
+ * Text is compared with the glyphs rendered straight from the font bitmaps, one window
+ * per character as the previous driver sent them.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "ili9341.h"
+#include "fonts.h"
+#include "gpio_mcu.h"
+#include "mock_lcd.h"
+/*==================[macros and definitions]=================================*/
+#define BACKGROUND		ILI9341_WHITE
+#define FOREGROUND		ILI9341_BLUE
+#define TEXT_FOREGROUND	ILI9341_BLACK
+#define TEXT_BACKGROUND	ILI9341_LIGHTGREY
+#define OLD_MAX_VALUE_SIZE	256		/*!< Bytes per data transfer of the previous driver */
+
+/**
+ * @brief Test of a primitive
+ */
+typedef struct {
+	const char *name;			/*!< Primitive and its parameters */
+	void (*reference)(void);	/*!< Drawing with the previous algorithm */
+	void (*draw)(void);			/*!< Drawing with the driver */
+	uint32_t min_ratio;			/*!< Minimun ratio between previous and driver transactions */
+	uint32_t max_waits;			/*!< Maximum SPI waits of the driver */
+} test_case_t;
+/*==================[internal data declaration]==============================*/
+static uint16_t reference_frame[MOCK_LCD_HEIGHT][MOCK_LCD_WIDTH];
+static mock_lcd_stats_t previous;	/*!< SPI traffic of the previous driver for the reference drawing */
+/*==================[internal functions declaration]=========================*/
+/** @brief Pixel of the reference drawing: window (4 transactions) and memory write (2), 3 waits */
+static void RefPixel(int16_t x, int16_t y);
+
+/** @brief Horizontal line of the reference drawing: window, memory write and a transaction per 256 bytes */
+static void RefHLine(int16_t x0, int16_t x1, int16_t y);
+
+/** @brief Previous ILI9341DrawLine(): Bresenham, a pixel per point */
+static void RefLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/** @brief Previous ILI9341DrawCircle(): midpoint, a pixel per point */
+static void RefCircle(int16_t x0, int16_t y0, int16_t r);
+
+/** @brief Previous ILI9341DrawFilledCircle(): midpoint, 4 lines per point */
+static void RefFilledCircle(int16_t x0, int16_t y0, int16_t r);
+
+/** @brief Previous ILI9341DrawFilledTriangle() (with y0 < y1 < y2): a line per row */
+static void RefFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/** @brief Previous text drawing: one window per character, clipped to the LCD (cell 0: proportional) */
+static void RefText(int16_t x, int16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background, uint8_t cell);
+
+/** @brief Width of the widest digit of a font */
+static uint8_t DigitCell(Font_t *font);
+
+/** @brief Check that a row of the frame memory has the foreground color from x0 to x1 */
+static uint32_t CheckRow(const char *name, int16_t x0, int16_t x1, int16_t y);
+/*==================[internal functions definition]==========================*/
+static void RefPixel(int16_t x, int16_t y){
+	ILI9341DrawPixel(x, y, FOREGROUND);
+	previous.transactions += 6;
+	previous.waits += 3;
+}
+
+static void RefHLine(int16_t x0, int16_t x1, int16_t y){
+	uint32_t chunks = (((x1 > x0) ? x1 - x0 : x0 - x1) + 1) * 2;
+
+	chunks = (chunks + OLD_MAX_VALUE_SIZE - 1) / OLD_MAX_VALUE_SIZE;
+	ILI9341DrawLine(x0, y, x1, y, FOREGROUND);
+	previous.transactions += 5 + chunks;
+	previous.waits += 3 + chunks;
+}
+
+static void RefLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	int16_t x_dist = (x1 > x0) ? x1 - x0 : x0 - x1;
+	int16_t y_dist = (y1 > y0) ? y1 - y0 : y0 - y1;
+	int16_t x_grow = (x1 > x0) ? 1 : -1;
+	int16_t y_grow = (y1 > y0) ? 1 : -1;
+	int16_t error = x_dist - y_dist, error_2;
+
+	while (1){
+		RefPixel(x0, y0);
+		if (x0 == x1 && y0 == y1){
+			break;
+		}
+		error_2 = 2 * error;
+		if (error_2 > -y_dist){
+			error -= y_dist;
+			x0 += x_grow;
+		}
+		if (error_2 < x_dist){
+			error += x_dist;
+			y0 += y_grow;
+		}
+	}
+}
+
+static void RefCircle(int16_t x0, int16_t y0, int16_t r){
+	int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+
+	RefPixel(x0, y0 + r);
+	RefPixel(x0, y0 - r);
+	RefPixel(x0 + r, y0);
+	RefPixel(x0 - r, y0);
+	while (x < y){
+		if (f >= 0){
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		RefPixel(x0 + x, y0 + y);
+		RefPixel(x0 - x, y0 + y);
+		RefPixel(x0 + x, y0 - y);
+		RefPixel(x0 - x, y0 - y);
+		RefPixel(x0 + y, y0 + x);
+		RefPixel(x0 - y, y0 + x);
+		RefPixel(x0 + y, y0 - x);
+		RefPixel(x0 - y, y0 - x);
+	}
+}
+
+static void RefFilledCircle(int16_t x0, int16_t y0, int16_t r){
+	int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+
+	RefPixel(x0, y0 + r);
+	RefPixel(x0, y0 - r);
+	RefPixel(x0 + r, y0);
+	RefPixel(x0 - r, y0);
+	RefHLine(x0 - r, x0 + r, y0);
+	while (x < y){
+		if (f >= 0){
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		RefHLine(x0 - x, x0 + x, y0 + y);
+		RefHLine(x0 + x, x0 - x, y0 - y);
+		RefHLine(x0 + y, x0 - y, y0 + x);
+		RefHLine(x0 + y, x0 - y, y0 - x);
+	}
+}
+
+static void RefFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2){
+	int16_t x_aux = (int)(x0 + (float)(y1 - y0) / (float)(y2 - y0) * (x2 - x0));
+	int16_t scanline_y;
+	float invslope1, invslope2, curx1, curx2;
+
+	invslope1 = (float)(x1 - x0) / (float)(y1 - y0);
+	invslope2 = (float)(x_aux - x0) / (float)(y1 - y0);
+	curx1 = x0;
+	curx2 = x0;
+	for (scanline_y = y0; scanline_y < y1; scanline_y++){
+		RefHLine((int)curx1, (int)curx2, scanline_y);
+		curx1 += invslope1;
+		curx2 += invslope2;
+	}
+	invslope1 = (float)(x2 - x1) / (float)(y2 - y1);
+	invslope2 = (float)(x2 - x_aux) / (float)(y2 - y1);
+	curx1 = x2;
+	curx2 = x2;
+	for (scanline_y = y2; scanline_y > y1; scanline_y--){
+		RefHLine((int)curx1, (int)curx2, scanline_y);
+		curx1 -= invslope1;
+		curx2 -= invslope2;
+	}
+	RefHLine(x1, x_aux, y1);
+}
+
+static void RefText(int16_t x, int16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background, uint8_t cell){
+	const char_info_t *info;
+	int16_t i, j, width, advance;
+	uint32_t chunks;
+	uint8_t bits;
+
+	for (; *str != '\0'; str++){
+		info = &font->info[*str - ' '];
+		width = info->width;
+		advance = (cell != 0) ? cell : width + 1;
+		for (i = 0; i < font->font_height; i++){
+			for (j = 0; (j < advance) && (str[1] != '\0' || cell != 0 || j < width); j++){
+				if ((x + j >= MOCK_LCD_WIDTH) || (y + i >= MOCK_LCD_HEIGHT)){
+					continue;
+				}
+				bits = font->data[info->offset + i * ((width + 7) / 8) + j / 8];
+				mock_lcd_frame[y + i][x + j] = ((j < width) && (bits & (0x80 >> (j % 8)))) ? foreground : background;
+			}
+		}
+		chunks = (width * font->font_height * 2 + OLD_MAX_VALUE_SIZE - 1) / OLD_MAX_VALUE_SIZE;
+		previous.transactions += 5 + chunks;
+		previous.waits += 3 + chunks;
+		x += advance;
+	}
+}
+
+static uint8_t DigitCell(Font_t *font){
+	uint8_t i, cell = 0;
+
+	for (i = 0; i < 10; i++){
+		if (font->info['0' + i - ' '].width > cell){
+			cell = font->info['0' + i - ' '].width;
+		}
+	}
+	return cell;
+}
+
+static uint32_t CheckRow(const char *name, int16_t x0, int16_t x1, int16_t y){
+	int16_t x;
+
+	for (x = x0; x <= x1; x++){
+		if (mock_lcd_frame[y][x] != FOREGROUND){
+			printf("FAIL: %s pixel (%d,%d) not drawn\n", name, x, y);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void RefShallowLine(void){ RefLine(10, 20, 229, 61); }
+static void ShallowLine(void){ ILI9341DrawLine(10, 20, 229, 61, FOREGROUND); }
+static void RefSteepLine(void){ RefLine(70, 300, 30, 5); }
+static void SteepLine(void){ ILI9341DrawLine(70, 300, 30, 5, FOREGROUND); }
+static void RefDiagonalLine(void){ RefLine(0, 0, 200, 200); }
+static void DiagonalLine(void){ ILI9341DrawLine(0, 0, 200, 200, FOREGROUND); }
+static void RefSmallCircle(void){ RefCircle(120, 160, 20); }
+static void SmallCircle(void){ ILI9341DrawCircle(120, 160, 20, FOREGROUND); }
+static void RefBigCircle(void){ RefCircle(120, 160, 110); }
+static void BigCircle(void){ ILI9341DrawCircle(120, 160, 110, FOREGROUND); }
+static void RefClippedCircle(void){ RefCircle(200, 40, 60); }
+static void ClippedCircle(void){ ILI9341DrawCircle(200, 40, 60, FOREGROUND); }
+static void RefFilledSmallCircle(void){ RefFilledCircle(120, 160, 20); }
+static void FilledSmallCircle(void){ ILI9341DrawFilledCircle(120, 160, 20, FOREGROUND); }
+static void RefFilledBigCircle(void){ RefFilledCircle(120, 160, 110); }
+static void FilledBigCircle(void){ ILI9341DrawFilledCircle(120, 160, 110, FOREGROUND); }
+static void RefTriangle(void){ RefFilledTriangle(20, 30, 200, 100, 80, 290); }
+static void Triangle(void){ ILI9341DrawFilledTriangle(80, 290, 20, 30, 200, 100, FOREGROUND); }
+
+static void RefString(void){
+	RefText(5, 10, "Temp: 36.5 C", &font_19, TEXT_FOREGROUND, TEXT_BACKGROUND, 0);
+	RefText(5, 30, "HR 72 bpm", &font_19, TEXT_FOREGROUND, TEXT_BACKGROUND, 0);
+}
+static void String(void){ ILI9341DrawString(5, 10, "Temp: 36.5 C\nHR 72 bpm", &font_19, TEXT_FOREGROUND, TEXT_BACKGROUND); }
+static void RefSmallInt(void){ RefText(21, 200, "00451", &font_11, TEXT_FOREGROUND, TEXT_BACKGROUND, 5); }
+static void SmallInt(void){ ILI9341DrawInt(20, 200, 451, 5, &font_11, TEXT_FOREGROUND, TEXT_BACKGROUND); }
+static void RefReadout(void){
+	RefText(11, 120, "1188", &font_30, TEXT_FOREGROUND, TEXT_BACKGROUND, DigitCell(&font_30));
+	RefText(11, 160, "1188", &font_30, ILI9341_RED, TEXT_BACKGROUND, DigitCell(&font_30));
+}
+static void Readout(void){
+	ILI9341DrawInt(10, 120, 1188, 4, &font_30, TEXT_FOREGROUND, TEXT_BACKGROUND);
+	ILI9341DrawInt(10, 160, 1188, 4, &font_30, ILI9341_RED, TEXT_BACKGROUND);
+}
+static void RefBigClipped(void){ RefText(101, 220, "0123", &font_89, TEXT_FOREGROUND, TEXT_BACKGROUND, DigitCell(&font_89)); }
+static void BigClipped(void){ ILI9341DrawInt(100, 220, 123, 4, &font_89, TEXT_FOREGROUND, TEXT_BACKGROUND); }
+
+static const test_case_t tests[] = {
+	{"line (10,20)-(229,61)",				RefShallowLine,			ShallowLine,		5,	1},
+	{"line (70,300)-(30,5)",				RefSteepLine,			SteepLine,			7,	1},
+	{"line (0,0)-(200,200)",				RefDiagonalLine,		DiagonalLine,		1,	1},
+	{"circle r=20",							RefSmallCircle,			SmallCircle,		2,	1},
+	{"circle r=110",						RefBigCircle,			BigCircle,			2,	1},
+	{"circle r=60 clipped",					RefClippedCircle,		ClippedCircle,		5,	1},
+	{"filled circle r=20",					RefFilledSmallCircle,	FilledSmallCircle,	1,	1},
+	{"filled circle r=110",					RefFilledBigCircle,		FilledBigCircle,	1,	1},
+	{"filled triangle",						RefTriangle,			Triangle,			1,	1},
+	{"string font_19, 2 lines",				RefString,				String,				10,	6},
+	{"int font_11",							RefSmallInt,			SmallInt,			5,	1},
+	{"int font_30, 2 colors",				RefReadout,				Readout,			5,	4},
+	{"int font_89 clipped",					RefBigClipped,			BigClipped,			3,	13},
+};
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	mock_lcd_stats_t driver;
+	uint32_t i, failures = 0;
+
+	ILI9341Init(SPI_1, GPIO_3, GPIO_2);
+	printf("%-24s %14s %14s %10s %10s\n", "primitive", "previous trans", "previous waits", "trans", "waits");
+	for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++){
+		MockLcdReset(BACKGROUND);
+		memset(&previous, 0, sizeof(previous));
+		tests[i].reference();
+		memcpy(reference_frame, mock_lcd_frame, sizeof(reference_frame));
+
+		MockLcdReset(BACKGROUND);
+		tests[i].draw();
+		MockLcdGetStats(&driver);
+
+		printf("%-24s %14u %14u %10u %10u\n", tests[i].name, previous.transactions, previous.waits,
+			driver.transactions, driver.waits);
+		if (memcmp(reference_frame, mock_lcd_frame, sizeof(reference_frame)) != 0){
+			printf("FAIL: %s pixels differ from the reference\n", tests[i].name);
+			failures++;
+		}
+		if (driver.transactions * tests[i].min_ratio > previous.transactions){
+			printf("FAIL: %s needs more than 1/%u of the previous transactions\n", tests[i].name, tests[i].min_ratio);
+			failures++;
+		}
+		/* The whole primitive is queued and waited for once (text: once per buffer of rows) */
+		if (driver.waits > tests[i].max_waits){
+			printf("FAIL: %s waits %u times for the SPI\n", tests[i].name, driver.waits);
+			failures++;
+		}
+
+		/* Same runs in framebuffer mode */
+		MockLcdReset(BACKGROUND);
+		ILI9341FramebufferInit();
+		tests[i].draw();
+		ILI9341FramebufferDeInit();
+		if (memcmp(reference_frame, mock_lcd_frame, sizeof(reference_frame)) != 0){
+			printf("FAIL: %s framebuffer pixels differ from the reference\n", tests[i].name);
+			failures++;
+		}
+	}
+
+	/* Flat edges of triangles are filled too */
+	MockLcdReset(BACKGROUND);
+	ILI9341DrawFilledTriangle(20, 200, 100, 200, 60, 250, FOREGROUND);
+	failures += CheckRow("flat top triangle", 20, 100, 200);
+	ILI9341DrawFilledTriangle(60, 100, 20, 150, 100, 150, FOREGROUND);
+	failures += CheckRow("flat bottom triangle", 20, 100, 150);
+	ILI9341DrawFilledTriangle(90, 5, 10, 5, 50, 5, FOREGROUND);
+	failures += CheckRow("single row triangle", 10, 90, 5);
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
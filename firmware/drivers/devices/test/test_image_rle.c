@@ -0,0 +1,260 @@
+/**
+ * @file test_image_rle.c
+ * @brief Host test of the compressed images: lossless round trip and drawing on the LCD
+ *
+ * Synthetic RGB565 and palette images are compressed and decoded back in pieces of
+ * random size. The generated icons and picture must decode to the arrays they were
+ * generated from (assets), and draw the same pixels on the mocked LCD as the raw
+ * picture and 1bpp icons did.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ili9341.h"
+#include "image_rle.h"
+#include "gpio_mcu.h"
+#include "mock_lcd.h"
+/*==================[macros and definitions]=================================*/
+#define TEST_PIXELS		(MOCK_LCD_WIDTH * MOCK_LCD_HEIGHT)	/*!< Pixels of the synthetic images */
+#define OLD_MAX_VALUE_SIZE	256		/*!< Bytes per data transfer of the previous driver */
+#define ICONS			64			/*!< Icons per size */
+#define BACKGROUND		ILI9341_WHITE
+#define FOREGROUND		ILI9341_BLUE
+#define PictureSize(w, h)	((w) * (h) * 2)	/*!< Bytes of a raw RGB565 picture */
+
+/**
+ * @brief Raw and compressed icons of a size
+ */
+typedef struct {
+	const uint8_t *raw;			/*!< 1bpp icons (assets) */
+	icon_font_t *icons;			/*!< Compressed icons */
+} icon_test_t;
+/*==================[internal data declaration]==============================*/
+extern const uint8_t icon22_data[], icon30_data[], icon59_data[], icon89_data[];
+extern const uint8_t picture[];
+extern const image_rle_t esp_edu_pic;
+
+static uint16_t pixels[TEST_PIXELS];
+static uint16_t decoded[TEST_PIXELS];
+static uint8_t encoded[3 * TEST_PIXELS];
+static uint16_t reference_frame[MOCK_LCD_HEIGHT][MOCK_LCD_WIDTH];
+
+static const icon_test_t icon_tests[] = {
+	{icon22_data, &icon_22},
+	{icon30_data, &icon_30},
+	{icon59_data, &icon_59},
+	{icon89_data, &icon_89},
+};
+/*==================[internal functions declaration]=========================*/
+/** @brief Compress and decode back in pieces of random size. Returns the compressed size, 0 on failure */
+static uint32_t RoundTrip(const char *name, uint32_t count, uint8_t palette_size);
+
+/** @brief Draw an icon from the 1bpp source on the mocked LCD frame memory */
+static void RefIcon(int16_t x, int16_t y, const icon_test_t *test, uint8_t icon);
+
+/** @brief Compare the mocked LCD with the reference frame */
+static uint32_t CheckFrame(const char *name);
+/*==================[internal functions definition]==========================*/
+static uint32_t RoundTrip(const char *name, uint32_t count, uint8_t palette_size){
+	static const uint16_t palette[IMAGE_RLE_PALETTE_MAX] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+	image_rle_t image = {MOCK_LCD_WIDTH, count / MOCK_LCD_WIDTH, palette_size, palette, 0, encoded};
+	image_rle_decoder_t decoder;
+	uint32_t i, n, piece;
+
+	image.size = ImageRleEncode(pixels, count, palette_size, encoded, sizeof(encoded));
+	if (image.size == 0){
+		printf("FAIL: %s not encoded\n", name);
+		return 0;
+	}
+	ImageRleDecoderInit(&decoder, &image, NULL);
+	for (n = 0; n < count; n += piece){
+		piece = 1 + rand() % 700;
+		piece = ImageRleDecode(&decoder, &decoded[n], piece);
+		if (piece == 0){
+			break;
+		}
+	}
+	if ((n != count) || (ImageRleDecode(&decoder, decoded, 1) != 0)){
+		printf("FAIL: %s decodes %u pixels of %u\n", name, n, count);
+		return 0;
+	}
+	for (i = 0; i < count; i++){
+		if ((uint16_t)((decoded[i] >> 8) | (decoded[i] << 8)) != pixels[i]){
+			printf("FAIL: %s pixel %u differs\n", name, i);
+			return 0;
+		}
+	}
+	printf("%-32s %8u %8u\n", name, palette_size ? count : 2 * count, image.size);
+	return image.size;
+}
+
+static void RefIcon(int16_t x, int16_t y, const icon_test_t *test, uint8_t icon){
+	uint16_t size = test->icons->width;
+	uint16_t row_bytes = (size + 7) / 8;
+	const uint8_t *bits = &test->raw[icon * size * row_bytes];
+	int16_t i, j;
+
+	for (i = 0; i < size; i++){
+		for (j = 0; j < size; j++){
+			if ((x + j < MOCK_LCD_WIDTH) && (y + i < MOCK_LCD_HEIGHT)){
+				reference_frame[y + i][x + j] = (bits[i * row_bytes + j / 8] & (0x80 >> (j % 8))) ? FOREGROUND : BACKGROUND;
+			}
+		}
+	}
+}
+
+static uint32_t CheckFrame(const char *name){
+	if (memcmp(reference_frame, mock_lcd_frame, sizeof(reference_frame)) != 0){
+		printf("FAIL: %s pixels differ from the reference\n", name);
+		return 1;
+	}
+	return 0;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	mock_lcd_stats_t stats;
+	uint32_t i, j, raw, compressed, failures = 0;
+	uint8_t palette_size;
+	char name[32];
+
+	srand(1);
+	printf("%-32s %8s %8s\n", "image", "raw", "bytes");
+	/* Worst cases: noise, and runs longer than a long run */
+	for (i = 0; i < TEST_PIXELS; i++){
+		pixels[i] = rand();
+	}
+	failures += (RoundTrip("RGB565 noise", TEST_PIXELS, 0) == 0);
+	for (i = 0; i < TEST_PIXELS; i++){
+		pixels[i] = ILI9341_DARKCYAN;
+	}
+	failures += (RoundTrip("RGB565 solid", TEST_PIXELS, 0) == 0);
+	/* Gradients use the difference codes, noise on top the color table */
+	for (i = 0; i < TEST_PIXELS; i++){
+		uint16_t x = i % MOCK_LCD_WIDTH, y = i / MOCK_LCD_WIDTH;
+		pixels[i] = (((x / 8) & 0x1F) << 11) | (((y / 5) & 0x3F) << 5) | ((x + y) / 18 & 0x1F);
+		if (rand() % 50 == 0){
+			pixels[i] = (rand() % 4) * 0x3333;
+		}
+	}
+	failures += (RoundTrip("RGB565 gradient", TEST_PIXELS, 0) == 0);
+	for (palette_size = 2; palette_size <= IMAGE_RLE_PALETTE_MAX; palette_size++){
+		/* Mostly short runs, for the literals, and some long ones */
+		for (i = 0; i < TEST_PIXELS; ){
+			uint16_t index = rand() % palette_size;
+			uint32_t run = (rand() % 4 == 0) ? 1 + rand() % 400 : 1 + rand() % 6;
+			for (j = 0; (j < run) && (i < TEST_PIXELS); j++){
+				pixels[i++] = index;
+			}
+		}
+		sprintf(name, "palette %u colors", palette_size);
+		failures += (RoundTrip(name, TEST_PIXELS, palette_size) == 0);
+	}
+	if (ImageRleEncode(pixels, TEST_PIXELS, IMAGE_RLE_PALETTE_MAX + 1, encoded, sizeof(encoded)) != 0){
+		printf("FAIL: palette of %u colors encoded\n", IMAGE_RLE_PALETTE_MAX + 1);
+		failures++;
+	}
+
+	/* Generated picture and icons against their sources */
+	printf("%-32s %8u %8u\n", "esp_edu_pic", PictureSize(esp_edu_pic.width, esp_edu_pic.height), esp_edu_pic.size);
+	for (i = 0; i < sizeof(icon_tests) / sizeof(icon_tests[0]); i++){
+		raw = icon_tests[i].icons->height * ((icon_tests[i].icons->width + 7) / 8) * ICONS;
+		compressed = icon_tests[i].icons->offset[ICONS];
+		printf("icons %-26u %8u %8u\n", icon_tests[i].icons->width, raw, compressed);
+	}
+
+	ILI9341Init(SPI_1, GPIO_3, GPIO_2);
+	MockLcdReset(BACKGROUND);
+	ILI9341DrawPicture(0, 0, esp_edu_pic.width, esp_edu_pic.height, picture);
+	MockLcdGetStats(&stats);
+	memcpy(reference_frame, mock_lcd_frame, sizeof(reference_frame));
+	printf("%-32s %8s %8s\n", "drawing", "trans", "waits");
+	raw = (PictureSize(esp_edu_pic.width, esp_edu_pic.height) + OLD_MAX_VALUE_SIZE - 1) / OLD_MAX_VALUE_SIZE;
+	printf("%-32s %8u %8u\n", "picture, previous driver", 5 + raw, 3 + raw);
+	printf("%-32s %8u %8u\n", "picture", stats.transactions, stats.waits);
+	MockLcdReset(BACKGROUND);
+	ILI9341DrawImage(0, 0, &esp_edu_pic);
+	MockLcdGetStats(&stats);
+	printf("%-32s %8u %8u\n", "compressed picture", stats.transactions, stats.waits);
+	failures += CheckFrame("compressed picture");
+	if (stats.waits * 5 > 3 + raw){
+		printf("FAIL: compressed picture waits %u times for the SPI\n", stats.waits);
+		failures++;
+	}
+	MockLcdReset(BACKGROUND);
+	ILI9341FramebufferInit();
+	ILI9341DrawImage(0, 0, &esp_edu_pic);
+	ILI9341FramebufferDeInit();
+	failures += CheckFrame("framebuffer compressed picture");
+
+	/* Clipped: the picture moved right and down */
+	MockLcdReset(BACKGROUND);
+	ILI9341DrawPicture(0, 0, esp_edu_pic.width, esp_edu_pic.height, picture);
+	for (i = MOCK_LCD_HEIGHT - 1; i >= 150; i--){
+		for (j = MOCK_LCD_WIDTH - 1; j >= 100; j--){
+			reference_frame[i][j] = mock_lcd_frame[i - 150][j - 100];
+		}
+	}
+	for (i = 0; i < MOCK_LCD_HEIGHT; i++){
+		for (j = 0; j < MOCK_LCD_WIDTH; j++){
+			if ((i < 150) || (j < 100)){
+				reference_frame[i][j] = BACKGROUND;
+			}
+		}
+	}
+	MockLcdReset(BACKGROUND);
+	ILI9341DrawImage(100, 150, &esp_edu_pic);
+	failures += CheckFrame("clipped compressed picture");
+	MockLcdReset(BACKGROUND);
+	ILI9341FramebufferInit();
+	ILI9341DrawImage(100, 150, &esp_edu_pic);
+	ILI9341FramebufferDeInit();
+	failures += CheckFrame("framebuffer clipped compressed picture");
+
+	/* Every icon, with the colors given when drawing */
+	for (i = 0; i < sizeof(icon_tests) / sizeof(icon_tests[0]); i++){
+		uint16_t size = icon_tests[i].icons->width;
+		raw = 0;
+		compressed = 0;
+		for (j = 0; j < ICONS; j++){
+			memset(reference_frame, 0, sizeof(reference_frame));
+			RefIcon(7, 9, &icon_tests[i], j);
+			MockLcdReset(0);
+			ILI9341DrawIcon(7, 9, j, icon_tests[i].icons, FOREGROUND, BACKGROUND);
+			MockLcdGetStats(&stats);
+			compressed += stats.waits;
+			raw += 3 + (PictureSize(size, size) + OLD_MAX_VALUE_SIZE - 1) / OLD_MAX_VALUE_SIZE;
+			sprintf(name, "icon %u of size %u", j, size);
+			failures += CheckFrame(name);
+			MockLcdReset(0);
+			ILI9341FramebufferInit();
+			memset(reference_frame, 0xFF, sizeof(reference_frame));
+			RefIcon(7, 9, &icon_tests[i], j);
+			ILI9341DrawIcon(7, 9, j, icon_tests[i].icons, FOREGROUND, BACKGROUND);
+			ILI9341FramebufferDeInit();
+			sprintf(name, "framebuffer icon %u of size %u", j, size);
+			failures += CheckFrame(name);
+		}
+		sprintf(name, "icons %u, waits previous/now", size);
+		printf("%-32s %8u %8u\n", name, raw, compressed);
+	}
+	/* Icons at the right edge go to the next line, as before */
+	memset(reference_frame, 0, sizeof(reference_frame));
+	RefIcon(0, 10 + 89, &icon_tests[3], 0);
+	MockLcdReset(0);
+	ILI9341DrawIcon(200, 10, 0, &icon_89, FOREGROUND, BACKGROUND);
+	failures += CheckFrame("icon at the right edge");
+
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,351 @@
+/**
+ * @file test_mpu6050.c
+ * @brief Host test of the MPU6050 FIFO streaming, with a mocked I2C bus
+ *
+ * The FIFO parser is checked with frames of known values. Then the streaming task
+ * drains the FIFO of the mocked sensor: blocks must hold every sample in order, with
+ * their sequence numbers, in a few I2C bursts. The sample rate divider and the block
+ * timestamp must follow the rate actually programmed, and a full FIFO must be counted
+ * as an overflow. Blocks that don't fit in the queue must be counted as dropped, with
+ * a gap in the sequence and without calling the block function. Finally streaming is started and stopped while the sensor keeps
+ * interrupting: no interruption may reach the task once it is stopped.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "mpu6050.h"
+#include "esp_timer.h"
+#include "mock_mpu6050.h"
+/*==================[macros and definitions]=================================*/
+#define INT_PIN			GPIO_3
+#define BLOCKS			4					/*!< Blocks streamed (MPU6050_BLOCK_QTY fit in the queue) */
+#define READ_TIMEOUT_MS	1000
+#define LEFT_IN_FIFO	9					/*!< Samples still in the FIFO when a block is completed */
+#define TIMESTAMP_ERROR	1500				/*!< Timestamp tolerance (us): time to take the block from the queue */
+#define RESTARTS		50					/*!< Streaming stops while the sensor interrupts */
+#define DROPPED			2					/*!< Blocks streamed after the queue is full */
+/*==================[internal data declaration]==============================*/
+static volatile int sensor_running;			/*!< Sensor thread must go on */
+static uint32_t blocks_queued;				/*!< Calls of the block function (atomic access) */
+/*==================[internal functions declaration]=========================*/
+/** @brief Sample values of sample number i */
+static void SampleValues(uint32_t i, int16_t accel[3], int16_t gyro[3]);
+
+/** @brief Sleep a number of microseconds */
+static void Sleep(uint32_t usec);
+
+/** @brief Parse frames and an incomplete one */
+static uint32_t TestParse(void);
+
+/** @brief Sample rates out of range are refused, the divider is the one of the rate */
+static uint32_t TestRates(void);
+
+/** @brief Stream blocks, check their samples, timestamp and FIFO overflows */
+static uint32_t TestStream(void);
+
+/** @brief Called by the streaming task after each block queued */
+static void BlockQueued(void *param);
+
+/** @brief Stream more blocks than the queue holds without reading them */
+static uint32_t TestDropped(void);
+
+/** @brief Sensor thread: samples and interruptions until sensor_running is cleared */
+static void *Sensor(void *arg);
+
+/** @brief Start and stop streaming while the sensor interrupts */
+static uint32_t TestStop(void);
+/*==================[internal functions definition]==========================*/
+static void SampleValues(uint32_t i, int16_t accel[3], int16_t gyro[3]){
+	uint8_t axis;
+
+	for (axis = 0; axis < 3; axis++){
+		accel[axis] = (int16_t)(i * 3 + axis - 16000);
+		gyro[axis] = (int16_t)(-(int32_t)i * 5 + axis * 1000);
+	}
+}
+
+static void Sleep(uint32_t usec){
+	struct timespec delay = {usec / 1000000, (usec % 1000000) * 1000L};
+
+	nanosleep(&delay, NULL);
+}
+
+static uint32_t TestParse(void){
+	uint8_t data[3 * MPU6050_FIFO_FRAME_SIZE + 5];
+	int16_t accel[4][3], gyro[4][3], expected_accel[3], expected_gyro[3];
+	uint16_t samples;
+	uint32_t i, failures = 0;
+	uint8_t axis;
+
+	for (i = 0; i < 3; i++){
+		SampleValues(i, expected_accel, expected_gyro);
+		for (axis = 0; axis < 3; axis++){
+			data[i * MPU6050_FIFO_FRAME_SIZE + 2 * axis] = (uint16_t)expected_accel[axis] >> 8;
+			data[i * MPU6050_FIFO_FRAME_SIZE + 2 * axis + 1] = expected_accel[axis] & 0xFF;
+			data[i * MPU6050_FIFO_FRAME_SIZE + 6 + 2 * axis] = (uint16_t)expected_gyro[axis] >> 8;
+			data[i * MPU6050_FIFO_FRAME_SIZE + 6 + 2 * axis + 1] = expected_gyro[axis] & 0xFF;
+		}
+	}
+	memset(&data[3 * MPU6050_FIFO_FRAME_SIZE], 0x55, 5);
+	memset(accel, 0, sizeof(accel));
+	samples = MPU6050_parseFIFO(data, sizeof(data), accel, gyro);
+	if (samples != 3){
+		printf("FAIL: %u samples parsed instead of 3\n", samples);
+		failures++;
+	}
+	for (i = 0; i < 3; i++){
+		SampleValues(i, expected_accel, expected_gyro);
+		if (memcmp(accel[i], expected_accel, sizeof(expected_accel)) || memcmp(gyro[i], expected_gyro, sizeof(expected_gyro))){
+			printf("FAIL: sample %u parsed wrong\n", i);
+			failures++;
+		}
+	}
+	if (accel[3][0] != 0){
+		printf("FAIL: incomplete frame parsed\n");
+		failures++;
+	}
+	return failures;
+}
+
+static uint32_t TestRates(void){
+	const uint16_t refused[] = {0, 1, 3, MPU6050_MAX_SAMPLE_RATE + 1};
+	const uint16_t rates[] = {MPU6050_MIN_SAMPLE_RATE, 300, MPU6050_MAX_SAMPLE_RATE};
+	const uint8_t dividers[] = {249, 2, 0};
+	mpu6050_stream_t config = {INT_PIN, 0, NULL, NULL};
+	uint32_t i, failures = 0;
+
+	for (i = 0; i < sizeof(refused) / sizeof(refused[0]); i++){
+		config.sample_rate = refused[i];
+		if (MPU6050_startStreaming(&config)){
+			printf("FAIL: streaming started at %u Hz\n", refused[i]);
+			MPU6050_stopStreaming();
+			failures++;
+		}
+	}
+	for (i = 0; i < sizeof(rates) / sizeof(rates[0]); i++){
+		config.sample_rate = rates[i];
+		if (!MPU6050_startStreaming(&config)){
+			printf("FAIL: streaming not started at %u Hz\n", rates[i]);
+			failures++;
+			continue;
+		}
+		if (MockMpuRegister(MPU6050_RA_SMPLRT_DIV) != dividers[i]){
+			printf("FAIL: divider %u at %u Hz instead of %u\n", MockMpuRegister(MPU6050_RA_SMPLRT_DIV), rates[i], dividers[i]);
+			failures++;
+		}
+		MPU6050_stopStreaming();
+	}
+	return failures;
+}
+
+static uint32_t TestStream(void){
+	/* Runs at 1000 / (2 + 1) = 333 Hz: a sample every 3 ms */
+	mpu6050_stream_t config = {INT_PIN, 300, NULL, NULL};
+	const uint32_t period_us = 3000;
+	mpu6050_block_t block;
+	mock_mpu_stats_t stats;
+	int16_t accel[3], gyro[3];
+	uint32_t i, b, failures = 0;
+	int64_t read_time, error;
+
+	MockMpuReset();
+	MPU6050_startStreaming(&config);
+	/* Faster than the sensor, but the FIFO only holds 85 samples */
+	for (i = 0; i < BLOCKS * MPU6050_BLOCK_SIZE; i++){
+		SampleValues(i, accel, gyro);
+		MockMpuSample(accel, gyro);
+		Sleep(period_us / 10);
+	}
+	for (b = 0; b < BLOCKS; b++){
+		if (!MPU6050_readBlock(&block, READ_TIMEOUT_MS)){
+			printf("FAIL: block %u not streamed\n", b);
+			MPU6050_stopStreaming();
+			return failures + 1;
+		}
+		if (block.sequence != b){
+			printf("FAIL: block %u has sequence %u\n", b, block.sequence);
+			failures++;
+		}
+		for (i = 0; i < MPU6050_BLOCK_SIZE; i++){
+			SampleValues(b * MPU6050_BLOCK_SIZE + i, accel, gyro);
+			if (memcmp(block.accel[i], accel, sizeof(accel)) || memcmp(block.gyro[i], gyro, sizeof(gyro))){
+				printf("FAIL: sample %u of block %u is wrong\n", i, b);
+				failures++;
+				break;
+			}
+		}
+	}
+	MockMpuGetStats(&stats);
+	printf("%-24s %10u blocks %6.2f FIFO reads/block %6.2f reads/block\n", "stream", BLOCKS,
+		(double)stats.fifo_reads / BLOCKS, (double)stats.reads / BLOCKS);
+	/* A burst per block, two when the samples of a block are split between two drains */
+	if (stats.fifo_reads > 2 * BLOCKS){
+		printf("FAIL: %u FIFO reads for %u blocks\n", stats.fifo_reads, BLOCKS);
+		failures++;
+	}
+
+	/* Without interruptions the task drains the FIFO on its timeout, with samples left */
+	MPU6050_setIntEnabled(0);
+	for (i = 0; i < MPU6050_BLOCK_SIZE + LEFT_IN_FIFO; i++){
+		SampleValues(i, accel, gyro);
+		MockMpuSample(accel, gyro);
+	}
+	if (!MPU6050_readBlock(&block, READ_TIMEOUT_MS)){
+		printf("FAIL: block not streamed without interruptions\n");
+		failures++;
+	}
+	else{
+		read_time = esp_timer_get_time();
+		error = block.timestamp - (read_time - (int64_t)LEFT_IN_FIFO * period_us);
+		printf("%-24s %10lld us timestamp error (%u samples in FIFO)\n", "timestamp", (long long)error, LEFT_IN_FIFO);
+		if ((error > 0) || (error < -TIMESTAMP_ERROR)){
+			printf("FAIL: timestamp %lld us from the last sample\n", (long long)error);
+			failures++;
+		}
+	}
+
+	/* More than the FIFO size: the frames are no longer aligned */
+	for (i = 0; i < MPU6050_FIFO_SIZE / MPU6050_FIFO_FRAME_SIZE + 1; i++){
+		SampleValues(i, accel, gyro);
+		MockMpuSample(accel, gyro);
+	}
+	for (i = 0; (i < READ_TIMEOUT_MS) && (MPU6050_getStreamOverflows() == 0); i++){
+		Sleep(1000);
+	}
+	if (MPU6050_getStreamOverflows() != 1){
+		printf("FAIL: %u overflows instead of 1\n", MPU6050_getStreamOverflows());
+		failures++;
+	}
+	MPU6050_stopStreaming();
+	return failures;
+}
+
+static void BlockQueued(void *param){
+	__atomic_fetch_add((uint32_t *)param, 1, __ATOMIC_RELEASE);
+}
+
+static uint32_t TestDropped(void){
+	mpu6050_stream_t config = {INT_PIN, 300, BlockQueued, (void *)&blocks_queued};
+	const uint32_t period_us = 3000;
+	const uint32_t blocks = MPU6050_BLOCK_QTY + DROPPED;
+	mpu6050_block_t block;
+	int16_t accel[3], gyro[3];
+	uint32_t i, failures = 0;
+
+	MockMpuReset();
+	__atomic_store_n(&blocks_queued, 0, __ATOMIC_RELEASE);
+	MPU6050_startStreaming(&config);
+	for (i = 0; i < blocks * MPU6050_BLOCK_SIZE; i++){
+		SampleValues(i, accel, gyro);
+		MockMpuSample(accel, gyro);
+		Sleep(period_us / 10);
+	}
+	for (i = 0; (i < READ_TIMEOUT_MS) && (MPU6050_getStreamDroppedBlocks() < DROPPED); i++){
+		Sleep(1000);
+	}
+	printf("%-24s %10u blocks %u dropped\n", "full queue", blocks, MPU6050_getStreamDroppedBlocks());
+	if ((MPU6050_getStreamDroppedBlocks() != DROPPED) || (__atomic_load_n(&blocks_queued, __ATOMIC_ACQUIRE) != MPU6050_BLOCK_QTY)){
+		printf("FAIL: %u blocks dropped and %u queued instead of %u and %u\n", MPU6050_getStreamDroppedBlocks(),
+			blocks_queued, DROPPED, MPU6050_BLOCK_QTY);
+		failures++;
+	}
+	for (i = 0; i < MPU6050_BLOCK_QTY; i++){
+		if (!MPU6050_readBlock(&block, 0) || (block.sequence != i)){
+			printf("FAIL: block %u of a full queue not read\n", i);
+			failures++;
+			break;
+		}
+	}
+	/* The next block shows the dropped ones as a gap */
+	for (i = 0; i < MPU6050_BLOCK_SIZE; i++){
+		MockMpuSample(accel, gyro);
+		Sleep(period_us / 10);
+	}
+	if (!MPU6050_readBlock(&block, READ_TIMEOUT_MS) || (block.sequence != blocks)){
+		printf("FAIL: block after the dropped ones not read or with sequence %u instead of %u\n", block.sequence, blocks);
+		failures++;
+	}
+	MPU6050_stopStreaming();
+	return failures;
+}
+
+static void *Sensor(void *arg){
+	int16_t accel[3] = {0, 0, 0}, gyro[3] = {0, 0, 0};
+
+	while (__atomic_load_n(&sensor_running, __ATOMIC_ACQUIRE)){
+		MockMpuSample(accel, gyro);
+		Sleep(50);
+	}
+	return NULL;
+}
+
+static uint32_t TestStop(void){
+	mpu6050_stream_t config = {INT_PIN, MPU6050_MAX_SAMPLE_RATE, NULL, NULL};
+	mock_mpu_stats_t before, after;
+	mpu6050_block_t block;
+	pthread_t sensor;
+	uint32_t restart, failures = 0;
+	int64_t start, duration, longest = 0;
+
+	MockMpuReset();
+	__atomic_store_n(&sensor_running, 1, __ATOMIC_RELEASE);
+	pthread_create(&sensor, NULL, Sensor, NULL);
+	for (restart = 0; restart < RESTARTS; restart++){
+		if (!MPU6050_startStreaming(&config)){
+			printf("FAIL: streaming not started again\n");
+			failures++;
+			break;
+		}
+		Sleep(2000 + restart * 100);
+		while (MPU6050_readBlock(&block, 0)){
+		}
+		start = esp_timer_get_time();
+		MPU6050_stopStreaming();
+		duration = esp_timer_get_time() - start;
+		longest = (duration > longest) ? duration : longest;
+		/* The sensor goes on sampling: its interruption must not be called any more */
+		MockMpuGetStats(&before);
+		Sleep(1000);
+		MockMpuGetStats(&after);
+		if (after.interrupts != before.interrupts){
+			printf("FAIL: %u interruptions after stop\n", after.interrupts - before.interrupts);
+			failures++;
+			break;
+		}
+		if (MockMpuRegister(MPU6050_RA_INT_ENABLE) != 0){
+			printf("FAIL: data ready interruption enabled after stop\n");
+			failures++;
+			break;
+		}
+	}
+	__atomic_store_n(&sensor_running, 0, __ATOMIC_RELEASE);
+	pthread_join(sensor, NULL);
+	printf("%-24s %10u restarts %6lld us longest stop\n", "stop", restart, (long long)longest);
+	return failures;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	uint32_t failures = 0;
+
+	MockMpuReset();
+	MPU6050_initialize();
+	failures += TestParse();
+	failures += TestRates();
+	failures += TestStream();
+	failures += TestDropped();
+	failures += TestStop();
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,297 @@
+/**
+ * @file test_render.c
+ * @brief Host test of the ILI9341 render queue and display task
+ *
+ * Several threads queue drawings at the same time, each one on its own area of the
+ * LCD. Whatever the order the commands are taken and coalesced in, the LCD must end
+ * as if each thread had drawn its commands directly. Commands dropped by the display
+ * task (same widget or hidden) must not change the result either. The statistics of
+ * the queue are printed. Finally the display task is stopped and started again while
+ * other threads keep queueing commands.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "ili9341.h"
+#include "ili9341_render.h"
+#include "fonts.h"
+#include "gpio_mcu.h"
+#include "mock_lcd.h"
+/*==================[macros and definitions]=================================*/
+#define BACKGROUND		ILI9341_WHITE
+#define PRODUCERS		4				/*!< Threads drawing at the same time */
+#define UPDATES			300				/*!< Updates of the area of each thread */
+#define AREA_HEIGHT		(MOCK_LCD_HEIGHT / PRODUCERS)
+#define SYNC_TIMEOUT_MS	5000
+#define RESTARTS		50				/*!< Display task stops while queueing */
+
+/**
+ * @brief Drawing functions, queued or direct
+ */
+typedef struct {
+	uint8_t (*fill)(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+	uint8_t (*text)(uint16_t widget, uint16_t x, uint16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background);
+	uint8_t (*line)(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+	uint8_t (*blit)(uint16_t widget, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pic);
+} draw_t;
+/*==================[internal data declaration]==============================*/
+static uint16_t reference_frame[MOCK_LCD_HEIGHT][MOCK_LCD_WIDTH];
+static uint8_t picture[MOCK_LCD_WIDTH * MOCK_LCD_HEIGHT * 2];	/*!< Full screen picture */
+static uint32_t retries[PRODUCERS];			/*!< Commands queued again because the queue was full */
+static uint32_t accepted[PRODUCERS];		/*!< Commands queued by each thread while the display task stops */
+static uint32_t late[PRODUCERS];			/*!< Commands queued after ILI9341RenderDeInit() returned */
+static uint8_t stopped;						/*!< ILI9341RenderDeInit() has returned (atomic access) */
+static uint8_t finish;						/*!< Producers must end (atomic access) */
+/*==================[internal functions declaration]=========================*/
+/** @brief ILI9341DrawFilledRectangle() with the ILI9341RenderFill() arguments */
+static uint8_t DirectFill(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/** @brief ILI9341DrawString() with the ILI9341RenderText() arguments */
+static uint8_t DirectText(uint16_t widget, uint16_t x, uint16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background);
+
+/** @brief ILI9341DrawLine() with the ILI9341RenderLine() arguments */
+static uint8_t DirectLine(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/** @brief ILI9341DrawPicture() with the ILI9341RenderBlit() arguments */
+static uint8_t DirectBlit(uint16_t widget, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pic);
+
+/** @brief Updates of the area of a producer: background, value and a line */
+static void DrawArea(const draw_t *draw, uint8_t producer, uint32_t *retry);
+
+/** @brief Producer thread */
+static void *Producer(void *arg);
+
+/** @brief Producer thread queueing until finish while the display task is stopped */
+static void *StopProducer(void *arg);
+
+/** @brief Stop the display task while other threads queue commands */
+static uint32_t TestStop(void);
+
+/** @brief Commands hidden by later ones, drawn after a slow picture so they are taken in one batch */
+static void DrawHidden(const draw_t *draw);
+
+/** @brief Compare the LCD with the reference frame */
+static uint32_t Check(const char *name);
+/*==================[internal functions definition]==========================*/
+static uint8_t DirectFill(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	ILI9341DrawFilledRectangle(x0, y0, x1, y1, color);
+	return true;
+}
+
+static uint8_t DirectText(uint16_t widget, uint16_t x, uint16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background){
+	char text[ILI9341_RENDER_TEXT_MAX + 1];
+
+	strncpy(text, str, ILI9341_RENDER_TEXT_MAX);
+	text[ILI9341_RENDER_TEXT_MAX] = '\0';
+	ILI9341DrawString(x, y, text, font, foreground, background);
+	return true;
+}
+
+static uint8_t DirectLine(uint16_t widget, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	ILI9341DrawLine(x0, y0, x1, y1, color);
+	return true;
+}
+
+static uint8_t DirectBlit(uint16_t widget, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pic){
+	ILI9341DrawPicture(x, y, width, height, pic);
+	return true;
+}
+
+static void DrawArea(const draw_t *draw, uint8_t producer, uint32_t *retry){
+	uint16_t top = producer * AREA_HEIGHT;
+	uint16_t widget = producer * 2 + 1;
+	uint32_t i;
+	char text[16];
+
+	for (i = 0; i < UPDATES; i++){
+		/* Each update covers the whole area, so any dropped command is redrawn later */
+		while (!draw->fill(widget, 0, top, MOCK_LCD_WIDTH - 1, top + AREA_HEIGHT - 1, (i * 2117 + producer) & 0xFFFF)){
+			(*retry)++;
+			sched_yield();
+		}
+		while (!draw->line(ILI9341_RENDER_NO_WIDGET, i % MOCK_LCD_WIDTH, top, MOCK_LCD_WIDTH - 1 - i % MOCK_LCD_WIDTH,
+			top + AREA_HEIGHT - 1, ILI9341_RED)){
+			(*retry)++;
+			sched_yield();
+		}
+		snprintf(text, sizeof(text), "%u:%05u", producer, i);
+		while (!draw->text(widget + 1, 10, top + 20, text, &font_19, ILI9341_BLACK, ILI9341_LIGHTGREY)){
+			(*retry)++;
+			sched_yield();
+		}
+	}
+}
+
+static void *Producer(void *arg){
+	static const draw_t queued = {ILI9341RenderFill, ILI9341RenderText, ILI9341RenderLine, ILI9341RenderBlit};
+	uint8_t producer = (uint8_t)(intptr_t)arg;
+
+	DrawArea(&queued, producer, &retries[producer]);
+	return NULL;
+}
+
+static void *StopProducer(void *arg){
+	uint8_t producer = (uint8_t)(intptr_t)arg;
+	uint8_t was_stopped;
+
+	while (!__atomic_load_n(&finish, __ATOMIC_ACQUIRE)){
+		was_stopped = __atomic_load_n(&stopped, __ATOMIC_ACQUIRE);
+		if (ILI9341RenderFill(ILI9341_RENDER_NO_WIDGET, producer, producer, producer, producer, ILI9341_RED)){
+			accepted[producer]++;
+			late[producer] += was_stopped;
+		}
+		else{
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static uint32_t TestStop(void){
+	pthread_t producers[PRODUCERS];
+	ili9341_render_stats_t stats;
+	struct timespec delay = {0, 200000};
+	uint32_t round, i, total, failures = 0;
+
+	for (round = 0; round < RESTARTS; round++){
+		memset(accepted, 0, sizeof(accepted));
+		memset(late, 0, sizeof(late));
+		__atomic_store_n(&stopped, 0, __ATOMIC_RELEASE);
+		__atomic_store_n(&finish, 0, __ATOMIC_RELEASE);
+		if (!ILI9341RenderInit(5)){
+			printf("FAIL: display task not restarted\n");
+			return failures + 1;
+		}
+		for (i = 0; i < PRODUCERS; i++){
+			pthread_create(&producers[i], NULL, StopProducer, (void *)(intptr_t)i);
+		}
+		nanosleep(&delay, NULL);
+		ILI9341RenderDeInit();
+		__atomic_store_n(&stopped, 1, __ATOMIC_RELEASE);
+		nanosleep(&delay, NULL);
+		__atomic_store_n(&finish, 1, __ATOMIC_RELEASE);
+		total = 0;
+		for (i = 0; i < PRODUCERS; i++){
+			pthread_join(producers[i], NULL);
+			total += accepted[i];
+			if (late[i] != 0){
+				printf("FAIL: %u commands queued after the display task stopped\n", late[i]);
+				failures++;
+			}
+		}
+		/* Every accepted command is drawn or coalesced before the task ends */
+		ILI9341RenderGetStats(&stats);
+		if ((stats.submitted != total) || (stats.drawn + stats.coalesced != total) || (stats.depth != 0)){
+			printf("FAIL: round %u, %u commands accepted, %u submitted, %u drawn, %u coalesced, %u left\n", round,
+				total, stats.submitted, stats.drawn, stats.coalesced, stats.depth);
+			failures++;
+		}
+	}
+	printf("%-22s %9u restarts with %u threads queueing\n", "stop while queueing", RESTARTS, PRODUCERS);
+	return failures;
+}
+
+static void DrawHidden(const draw_t *draw){
+	draw->blit(ILI9341_RENDER_NO_WIDGET, 0, 0, MOCK_LCD_WIDTH, MOCK_LCD_HEIGHT, picture);
+	/* Same widget: only the last value is drawn */
+	draw->text(1, 10, 10, "72 bpm", &font_30, ILI9341_BLACK, ILI9341_WHITE);
+	draw->text(1, 10, 10, "73 bpm", &font_30, ILI9341_BLACK, ILI9341_WHITE);
+	draw->text(1, 10, 10, "74 bpm", &font_30, ILI9341_BLACK, ILI9341_WHITE);
+	/* Covered by a later fill */
+	draw->line(ILI9341_RENDER_NO_WIDGET, 20, 100, 100, 150, ILI9341_RED);
+	draw->text(ILI9341_RENDER_NO_WIDGET, 30, 110, "hidden", &font_19, ILI9341_BLACK, ILI9341_WHITE);
+	draw->fill(ILI9341_RENDER_NO_WIDGET, 10, 90, 200, 200, ILI9341_NAVY);
+	/* Partly covered: drawn */
+	draw->line(ILI9341_RENDER_NO_WIDGET, 0, 250, 239, 180, ILI9341_GREEN);
+	draw->fill(ILI9341_RENDER_NO_WIDGET, 0, 240, 100, 300, ILI9341_ORANGE);
+}
+
+static uint32_t Check(const char *name){
+	if (memcmp(reference_frame, mock_lcd_frame, sizeof(reference_frame)) != 0){
+		printf("FAIL: %s pixels differ from the reference\n", name);
+		return 1;
+	}
+	return 0;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	static const draw_t direct = {DirectFill, DirectText, DirectLine, DirectBlit};
+	static const draw_t queued = {ILI9341RenderFill, ILI9341RenderText, ILI9341RenderLine, ILI9341RenderBlit};
+	pthread_t producers[PRODUCERS];
+	ili9341_render_stats_t stats;
+	uint32_t i, failures = 0, retry = 0;
+
+	ILI9341Init(SPI_1, GPIO_3, GPIO_2);
+	for (i = 0; i < sizeof(picture); i++){
+		picture[i] = i * 7 + i / 480;
+	}
+
+	/* Reference: each area drawn directly */
+	MockLcdReset(BACKGROUND);
+	for (i = 0; i < PRODUCERS; i++){
+		DrawArea(&direct, i, &retry);
+	}
+	memcpy(reference_frame, mock_lcd_frame, sizeof(reference_frame));
+
+	MockLcdReset(BACKGROUND);
+	if (!ILI9341RenderInit(5)){
+		printf("FAIL: display task not started\n");
+		return 1;
+	}
+	for (i = 0; i < PRODUCERS; i++){
+		pthread_create(&producers[i], NULL, Producer, (void *)(intptr_t)i);
+	}
+	for (i = 0; i < PRODUCERS; i++){
+		pthread_join(producers[i], NULL);
+		retry += retries[i];
+	}
+	if (!ILI9341RenderSync(SYNC_TIMEOUT_MS)){
+		printf("FAIL: queue not drawn in %u ms\n", SYNC_TIMEOUT_MS);
+		failures++;
+	}
+	ILI9341RenderGetStats(&stats);
+	failures += Check("concurrent producers");
+	printf("%-22s %9s %9s %9s %9s %9s %9s %9s %12s %12s\n", "render", "submitted", "rejected", "drawn", "coalesced",
+		"batches", "depth", "max depth", "latency avg", "latency max");
+	printf("%-22s %9u %9u %9u %9u %9u %9u %9u %9u us %9u us\n", "concurrent producers", stats.submitted, stats.rejected,
+		stats.drawn, stats.coalesced, stats.batches, stats.depth, stats.max_depth, stats.latency_avg_us, stats.latency_max_us);
+	if ((stats.submitted != PRODUCERS * UPDATES * 3) || (stats.rejected != retry) ||
+		(stats.drawn + stats.coalesced != stats.submitted) || (stats.depth != 0) ||
+		(stats.max_depth > ILI9341_RENDER_QUEUE_SIZE)){
+		printf("FAIL: statistics do not add up\n");
+		failures++;
+	}
+
+	/* Hidden commands */
+	MockLcdReset(BACKGROUND);
+	DrawHidden(&direct);
+	memcpy(reference_frame, mock_lcd_frame, sizeof(reference_frame));
+	MockLcdReset(BACKGROUND);
+	DrawHidden(&queued);
+	ILI9341RenderSync(SYNC_TIMEOUT_MS);
+	failures += Check("hidden commands");
+	ILI9341RenderDeInit();
+
+	failures += TestStop();
+
+	/* Stopped: nothing is queued */
+	if (ILI9341RenderFill(ILI9341_RENDER_NO_WIDGET, 0, 0, 10, 10, ILI9341_RED)){
+		printf("FAIL: command queued with the display task stopped\n");
+		failures++;
+	}
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
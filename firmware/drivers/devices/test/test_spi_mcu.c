@@ -0,0 +1,197 @@
+/**
+ * @file test_spi_mcu.c
+ * @brief Host test of the SPI driver (spi_mcu), with the ESP-IDF SPI master driver mocked
+ *
+ * Initializing a device again with the same configuration must keep its handle, and a
+ * new configuration must replace it. Queued writes must never exceed the queue of the
+ * device, must send short buffers as they were when queued and drive the data/command
+ * pin in the pre-callback, and blocking transfers must run after the queued ones. Then
+ * the ILI9341 driver draws on top of spi_mcu: the whole drawing must use a single device
+ * handle (creating one per chunk sent was the regression).
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "spi_mcu.h"
+#include "ili9341.h"
+#include "fonts.h"
+#include "gpio_mcu.h"
+#include "mock_spi.h"
+/*==================[macros and definitions]=================================*/
+#define DC_PIN			GPIO_3
+#define RST_PIN			GPIO_2
+#define INITS			100				/*!< Initializations with the same configuration */
+#define WRITES			(3 * SPI_QUEUE_SIZE)
+#define DATA_SIZE		64				/*!< Bytes of the data writes: sent from the buffer */
+#define LOOPBACK_SIZE	16
+/*==================[internal data declaration]==============================*/
+static mock_spi_trans_t log_trans[WRITES + 1];
+/*==================[internal functions declaration]=========================*/
+/** @brief Device handles kept while the configuration does not change */
+static uint32_t TestHandles(void);
+
+/** @brief Queued writes: queue size, short buffers copied and data/command pin */
+static uint32_t TestQueue(void);
+
+/** @brief A blocking transfer after queued writes */
+static uint32_t TestBlocking(void);
+
+/** @brief ILI9341 drawings use a single device handle */
+static uint32_t TestLcd(void);
+/*==================[internal functions definition]==========================*/
+static uint32_t TestHandles(void){
+	spi_mcu_config_t config = {SPI_1, MODE0, 1000000, SPI_POLLING, NULL, NULL};
+	mock_spi_stats_t stats;
+	uint32_t i, failures = 0;
+
+	MockSpiReset();
+	for (i = 0; i < INITS; i++){
+		SpiInit(&config);
+	}
+	MockSpiGetStats(&stats);
+	printf("%-24s %10u inits %u handles created\n", "same configuration", INITS, stats.added);
+	if ((stats.buses != 1) || (stats.added != 1) || (stats.devices != 1)){
+		printf("FAIL: %u inits: %u buses, %u handles created, %u alive\n", INITS, stats.buses, stats.added, stats.devices);
+		failures++;
+	}
+	config.bitrate = 2000000;
+	SpiInit(&config);
+	SpiInit(&config);
+	config.clk_mode = MODE3;
+	SpiInit(&config);
+	MockSpiGetStats(&stats);
+	if ((stats.added != 3) || (stats.removed != 2) || (stats.devices != 1)){
+		printf("FAIL: 2 new configurations: %u handles created, %u removed, %u alive\n", stats.added, stats.removed, stats.devices);
+		failures++;
+	}
+	SpiDeInit(SPI_1);
+	MockSpiGetStats(&stats);
+	if (stats.devices != 0){
+		printf("FAIL: %u handles alive after de-initialization\n", stats.devices);
+		failures++;
+	}
+	if (stats.refused != 0){
+		printf("FAIL: %u SPI calls refused\n", stats.refused);
+		failures++;
+	}
+	return failures;
+}
+
+static uint32_t TestQueue(void){
+	spi_mcu_config_t config = {SPI_1, MODE0, 1000000, SPI_POLLING, NULL, NULL};
+	static uint8_t data[WRITES][DATA_SIZE];
+	mock_spi_stats_t stats;
+	uint32_t i, count, failures = 0;
+	uint8_t command;
+
+	SpiInit(&config);
+	SpiSetDCPin(SPI_1, DC_PIN);
+	MockSpiReset();
+	for (i = 0; i < WRITES; i++){
+		if (i % 2 == 0){
+			command = i;
+			SpiQueueWrite(SPI_1, &command, 1, SPI_DC_COMMAND);
+			/* Copied when queued: it can change right away */
+			command = 0xFF;
+		}
+		else{
+			memset(data[i], i, DATA_SIZE);
+			SpiQueueWrite(SPI_1, data[i], DATA_SIZE, SPI_DC_DATA);
+		}
+	}
+	SpiWaitAll(SPI_1);
+	MockSpiGetStats(&stats);
+	printf("%-24s %10u writes %u in flight at most\n", "queued", stats.queued, stats.max_pending);
+	if ((stats.queued != WRITES) || (stats.pending != 0) || (stats.max_pending != SPI_QUEUE_SIZE) || (stats.refused != 0)){
+		printf("FAIL: %u writes queued, %u pending after waiting, %u in flight at most, %u refused\n",
+			stats.queued, stats.pending, stats.max_pending, stats.refused);
+		failures++;
+	}
+	count = MockSpiLog(log_trans, WRITES);
+	for (i = 0; (i < count) && (i < WRITES); i++){
+		if ((log_trans[i].bytes != ((i % 2 == 0) ? 1 : DATA_SIZE)) || (log_trans[i].data[0] != i)){
+			printf("FAIL: write %u sent %u bytes starting with %u\n", i, log_trans[i].bytes, log_trans[i].data[0]);
+			failures++;
+			break;
+		}
+		if (log_trans[i].dc != (int8_t)(i % 2)){
+			printf("FAIL: write %u sent with the data/command pin at %d\n", i, log_trans[i].dc);
+			failures++;
+			break;
+		}
+	}
+	return failures;
+}
+
+static uint32_t TestBlocking(void){
+	uint8_t tx[LOOPBACK_SIZE], rx[LOOPBACK_SIZE], command = 0x2C;
+	mock_spi_stats_t stats;
+	uint32_t i, count, failures = 0;
+
+	MockSpiReset();
+	for (i = 0; i < LOOPBACK_SIZE; i++){
+		tx[i] = i * 7;
+	}
+	memset(rx, 0, sizeof(rx));
+	for (i = 0; i < 3; i++){
+		SpiQueueWrite(SPI_1, &command, 1, SPI_DC_COMMAND);
+	}
+	SpiReadWrite(SPI_1, tx, rx, LOOPBACK_SIZE);
+	MockSpiGetStats(&stats);
+	count = MockSpiLog(log_trans, WRITES);
+	if ((stats.refused != 0) || (count != 4) || !log_trans[2].queued || log_trans[3].queued){
+		printf("FAIL: blocking transfer after 3 queued writes: %u refused, %u transactions\n", stats.refused, count);
+		failures++;
+	}
+	if (memcmp(tx, rx, LOOPBACK_SIZE)){
+		printf("FAIL: bytes read are not the ones written (MISO wired to MOSI)\n");
+		failures++;
+	}
+	return failures;
+}
+
+static uint32_t TestLcd(void){
+	mock_spi_stats_t stats;
+	uint32_t failures = 0;
+
+	SpiDeInit(SPI_1);
+	MockSpiReset();
+	ILI9341Init(SPI_1, DC_PIN, RST_PIN);
+	ILI9341DrawFilledRectangle(10, 10, 200, 100, ILI9341_RED);
+	ILI9341DrawString(5, 150, "Handles", &font_19, ILI9341_BLACK, ILI9341_WHITE);
+	ILI9341DrawFilledCircle(120, 240, 50, ILI9341_BLUE);
+	ILI9341Fill(ILI9341_GREEN);
+	MockSpiGetStats(&stats);
+	printf("%-24s %10u transactions %u handles created\n", "ILI9341", stats.transactions, stats.added);
+	if ((stats.added != 1) || (stats.devices != 1)){
+		printf("FAIL: ILI9341 drawing: %u handles created, %u alive\n", stats.added, stats.devices);
+		failures++;
+	}
+	if ((stats.transactions == 0) || (stats.max_pending > SPI_QUEUE_SIZE) || (stats.refused != 0)){
+		printf("FAIL: ILI9341 drawing: %u transactions, %u in flight at most, %u refused\n",
+			stats.transactions, stats.max_pending, stats.refused);
+		failures++;
+	}
+	return failures;
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+	uint32_t failures = 0;
+
+	failures += TestHandles();
+	failures += TestQueue();
+	failures += TestBlocking();
+	failures += TestLcd();
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
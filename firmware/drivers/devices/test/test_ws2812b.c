@@ -0,0 +1,220 @@
+/**
+ * @file test_ws2812b.c
+ * @brief Host test of the hardware-timed (RMT) WS2812B driver
+ *
+ * Each RMT call of the initialization is made to fail: the initialization must fail
+ * without leaving a channel, an encoder or memory allocated. The symbols of the frames
+ * sent are checked against the WS2812B bit timings and decoded: the colors must arrive
+ * in GRB order, MSB first, with brightness and gamma correction, followed by a reset.
+ * Finally failed transmissions must give their frame buffer back, so the next frames
+ * are still sent (a lost buffer blocks ws2812bSendFrame() forever).
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <unistd.h>
+#include "ws2812b.h"
+#include "mock_rmt.h"
+/*==================[macros and definitions]=================================*/
+#define PIN				GPIO_8
+#define LEDS			8
+#define BITS_PER_LED	24
+#define TICK_NS			100				/*!< RMT resolution */
+#define T0H_NS			400				/*!< WS2812B datasheet bit timings */
+#define T1H_NS			800
+#define T0L_NS			850
+#define T1L_NS			450
+#define TIMING_NS		150				/*!< Tolerance of the bit timings */
+#define RESET_NS		50000			/*!< Minimun low time to latch the colors */
+#define SEND_TIMEOUT_S	5				/*!< A frame buffer was lost if sending takes longer */
+#define FAILED_SENDS	3				/*!< More than the frame buffers */
+/*==================[internal data declaration]==============================*/
+static const uint32_t colors[LEDS] = {
+	0xFF0000, 0x00FF00, 0x0000FF, 0xFFFFFF, 0x000000, 0x123456, 0x808080, 0xA5015A
+};
+static rmt_symbol_word_t symbols[LEDS * BITS_PER_LED + 1];
+static int32_t allocated;			/*!< Memory blocks allocated and not freed */
+/*==================[internal functions declaration]=========================*/
+/** @brief malloc(), calloc() and free() of the C library (linked with --wrap) */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void __real_free(void *block);
+
+/** @brief Whether a duration in ticks is a bit timing of the datasheet */
+static bool Timing(uint32_t ticks, uint32_t ns);
+
+/** @brief Initialization failing at each RMT call releases everything */
+static uint32_t TestUnwind(void);
+
+/** @brief Symbols of a frame: bit timings, colors and reset */
+static uint32_t CheckFrame(const uint32_t *frame_colors, uint8_t bright, const char *name);
+
+/** @brief Failed transmissions do not keep frame buffers */
+static uint32_t TestTransmitFailure(void);
+
+/** @brief Ends the test when ws2812bSendFrame() waits for a lost frame buffer */
+static void Timeout(int signal);
+/*==================[internal functions definition]==========================*/
+static bool Timing(uint32_t ticks, uint32_t ns){
+	return (ticks * TICK_NS + TIMING_NS >= ns) && (ticks * TICK_NS <= ns + TIMING_NS);
+}
+
+static uint32_t TestUnwind(void){
+	const char *names[] = {"channel", "encoder", "callbacks", "enable"};
+	mock_rmt_stats_t stats;
+	int32_t before;
+	uint32_t failures = 0;
+	mock_rmt_call_t call;
+
+	for (call = MOCK_RMT_NEW_CHANNEL; call <= MOCK_RMT_ENABLE; call++){
+		MockRmtFail(call, 1);
+		before = allocated;
+		if (ws2812bInitRmt(PIN, LEDS)){
+			printf("FAIL: initialized with %s failing\n", names[call]);
+			failures++;
+			continue;
+		}
+		MockRmtGetStats(&stats);
+		if ((stats.channels != 0) || (stats.encoders != 0) || (stats.enabled != 0) || (allocated != before)){
+			printf("FAIL: %s failing leaves %u channels, %u encoders, %u enabled, %d blocks allocated\n", names[call],
+				stats.channels, stats.encoders, stats.enabled, allocated - before);
+			failures++;
+		}
+		if (ws2812bSendFrame(colors)){
+			printf("FAIL: frame sent after %s failing\n", names[call]);
+			failures++;
+		}
+	}
+	printf("%-24s %10u failing calls\n", "initialization", (uint32_t)MOCK_RMT_ENABLE + 1);
+	return failures;
+}
+
+static uint32_t CheckFrame(const uint32_t *frame_colors, uint8_t bright, const char *name){
+	uint32_t count, led, grb, expected, i;
+	rmt_symbol_word_t *symbol = symbols;
+	uint8_t component;
+
+	count = MockRmtFrame(symbols, LEDS * BITS_PER_LED + 1);
+	if (count != LEDS * BITS_PER_LED + 1){
+		printf("FAIL: %s has %u symbols\n", name, count);
+		return 1;
+	}
+	for (led = 0; led < LEDS; led++){
+		grb = 0;
+		for (i = 0; i < BITS_PER_LED; i++, symbol++){
+			if ((symbol->level0 != 1) || (symbol->level1 != 0)){
+				printf("FAIL: %s bit %u of LED %u is not high then low\n", name, i, led);
+				return 1;
+			}
+			if (Timing(symbol->duration0, T1H_NS) && Timing(symbol->duration1, T1L_NS)){
+				grb = (grb << 1) | 1;
+			}
+			else if (Timing(symbol->duration0, T0H_NS) && Timing(symbol->duration1, T0L_NS)){
+				grb = grb << 1;
+			}
+			else{
+				printf("FAIL: %s bit %u of LED %u lasts %u + %u ns\n", name, i, led,
+					symbol->duration0 * TICK_NS, symbol->duration1 * TICK_NS);
+				return 1;
+			}
+		}
+		expected = 0;
+		if (frame_colors != NULL){
+			/* Green, red, blue */
+			for (i = 0; i < 3; i++){
+				component = frame_colors[led] >> ((i == 0) ? 8 : (i == 1) ? 16 : 0);
+				expected = (expected << 8) | ws2812bGammaCorrection((component * bright) >> 8);
+			}
+		}
+		if (grb != expected){
+			printf("FAIL: %s LED %u is GRB 0x%06X instead of 0x%06X\n", name, led, grb, expected);
+			return 1;
+		}
+	}
+	if ((symbol->level0 != 0) || (symbol->level1 != 0) || ((symbol->duration0 + symbol->duration1) * TICK_NS < RESET_NS)){
+		printf("FAIL: %s does not end with a reset\n", name);
+		return 1;
+	}
+	return 0;
+}
+
+static uint32_t TestTransmitFailure(void){
+	mock_rmt_stats_t before, after;
+	uint32_t i, failures = 0;
+
+	MockRmtGetStats(&before);
+	MockRmtFail(MOCK_RMT_TRANSMIT, FAILED_SENDS);
+	for (i = 0; i < FAILED_SENDS; i++){
+		if (ws2812bSendFrame(colors)){
+			printf("FAIL: failed transmission reported as sent\n");
+			failures++;
+		}
+	}
+	alarm(SEND_TIMEOUT_S);
+	for (i = 0; i < FAILED_SENDS; i++){
+		if (!ws2812bSendFrame(colors)){
+			printf("FAIL: frame not sent after failed transmissions\n");
+			failures++;
+		}
+	}
+	alarm(0);
+	MockRmtGetStats(&after);
+	printf("%-24s %10u failed %u sent\n", "transmission", FAILED_SENDS, after.transmissions - before.transmissions);
+	return failures;
+}
+
+static void Timeout(int signal){
+	printf("FAIL: ws2812bSendFrame() waits for a frame buffer lost by a failed transmission\n");
+	_exit(1);
+}
+
+/*==================[external functions definition]==========================*/
+void *__wrap_malloc(size_t size){
+	void *block = __real_malloc(size);
+
+	allocated += (block != NULL);
+	return block;
+}
+
+void *__wrap_calloc(size_t count, size_t size){
+	void *block = __real_calloc(count, size);
+
+	allocated += (block != NULL);
+	return block;
+}
+
+void __wrap_free(void *block){
+	allocated -= (block != NULL);
+	__real_free(block);
+}
+
+int main(void){
+	uint32_t failures = 0;
+
+	signal(SIGALRM, Timeout);
+	failures += TestUnwind();
+	if (!ws2812bInitRmt(PIN, LEDS)){
+		printf("FAIL: initialization\n");
+		return 1;
+	}
+	ws2812bSendFrame(colors);
+	failures += CheckFrame(colors, UINT8_MAX, "full brightness");
+	ws2812bSetBrightness(64);
+	ws2812bSendFrame(colors);
+	failures += CheckFrame(colors, 64, "brightness 64");
+	ws2812bSendFrame(NULL);
+	failures += CheckFrame(NULL, UINT8_MAX, "all off");
+	failures += TestTransmitFailure();
+	printf("%u failures\n", failures);
+	return failures != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,295 @@
+/**
+ * @file image_rle_conv.c
+ * @brief Host converter of C arrays of images and icons to compressed images (image_rle.h)
+ *
+ * Reads the hexadecimal bytes of an array of a C source file, as written by LCD image
+ * and font generators, and writes the C source of the compressed image:
+ *
+ *   image_rle_conv picture <source.c> <array> <width> <height> <name>
+ *       RGB565 picture, 2 bytes/pixel MSB first. Defines const image_rle_t <name>.
+ *
+ *   image_rle_conv icons <source.c> <array> <size> <name> [<array> <size> <name> ...]
+ *       Monochromatic icons of size x size pixels, one after the other, rows padded
+ *       to a byte, MSB first. Defines icon_font_t <name> (icons.h) with 2 colors
+ *       palette images: background (0) and foreground (1).
+ *
+ * Every image is decoded back and compared with the source before writing it.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "image_rle.h"
+/*==================[macros and definitions]=================================*/
+#define BYTES_PER_LINE	12			/*!< Bytes per line of the generated arrays */
+
+/*==================[internal data declaration]==============================*/
+static uint8_t *encoded;			/*!< Compressed data buffer */
+static uint16_t *decoded;			/*!< Decoded pixels buffer */
+/*==================[internal functions declaration]=========================*/
+/** @brief Read the hexadecimal bytes of an array of a C source file. Returns the number of bytes, 0 if not found */
+static uint32_t ReadArray(const char *file_name, const char *array, uint8_t **bytes);
+
+/** @brief Compress an image and check that it decodes back to the same pixels. Returns the compressed size */
+static uint32_t Encode(const uint16_t *pixels, uint16_t width, uint16_t height, uint8_t palette_size);
+
+/** @brief Write bytes as the lines of a C array */
+static void WriteBytes(const uint8_t *bytes, uint32_t size);
+
+/** @brief Write the header of a generated file */
+static void WriteHeader(const char *name, const char *include);
+
+static int Picture(int argc, char *argv[]);
+static int Icons(int argc, char *argv[]);
+/*==================[internal functions definition]==========================*/
+static uint32_t ReadArray(const char *file_name, const char *array, uint8_t **bytes){
+	FILE *file;
+	char *text, *p, *end, *comment;
+	long length;
+	uint32_t count = 0;
+
+	file = fopen(file_name, "rb");
+	if (file == NULL){
+		return 0;
+	}
+	fseek(file, 0, SEEK_END);
+	length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	text = malloc(length + 1);
+	if (fread(text, 1, length, file) != (size_t)length){
+		length = 0;
+	}
+	text[length] = '\0';
+	fclose(file);
+
+	/* Array definition: "<array>[] = {" */
+	p = text;
+	while ((p = strstr(p, array)) != NULL){
+		if (((p == text) || !(isalnum((unsigned char)p[-1]) || (p[-1] == '_'))) && (strncmp(p + strlen(array), "[]", 2) == 0)){
+			break;
+		}
+		p += strlen(array);
+	}
+	if ((p == NULL) || ((p = strchr(p, '{')) == NULL) || ((end = strchr(p, '}')) == NULL)){
+		free(text);
+		return 0;
+	}
+	*bytes = malloc(end - p);
+	while (p < end){
+		/* Skip comments (they have the pixels drawn with '#') */
+		if ((p[0] == '/') && (p[1] == '/')){
+			comment = strchr(p, '\n');
+			p = (comment != NULL) ? comment : end;
+			continue;
+		}
+		if ((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X'))){
+			(*bytes)[count++] = strtoul(p, &p, 16);
+			continue;
+		}
+		p++;
+	}
+	free(text);
+	return count;
+}
+
+static uint32_t Encode(const uint16_t *pixels, uint16_t width, uint16_t height, uint8_t palette_size){
+	static const uint16_t palette[IMAGE_RLE_PALETTE_MAX] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+	image_rle_decoder_t decoder;
+	image_rle_t image = {width, height, palette_size, palette, 0, NULL};
+	uint32_t i, count = (uint32_t)width * height;
+	uint16_t pixel;
+
+	image.size = ImageRleEncode(pixels, count, palette_size, encoded, 3 * count);
+	image.data = encoded;
+	ImageRleDecoderInit(&decoder, &image, NULL);
+	if ((image.size == 0) || (ImageRleDecode(&decoder, decoded, count) != count)){
+		return 0;
+	}
+	/* Decoded pixels are in LCD byte order, palette images decode to their indexes */
+	for (i = 0; i < count; i++){
+		pixel = (decoded[i] >> 8) | (decoded[i] << 8);
+		if (pixel != pixels[i]){
+			return 0;
+		}
+	}
+	return image.size;
+}
+
+static void WriteBytes(const uint8_t *bytes, uint32_t size){
+	uint32_t i;
+
+	for (i = 0; i < size; i++){
+		printf("%s0x%02X,%s", (i % BYTES_PER_LINE == 0) ? "    " : "", bytes[i],
+			((i % BYTES_PER_LINE == BYTES_PER_LINE - 1) || (i == size - 1)) ? "\n" : " ");
+	}
+}
+
+static void WriteHeader(const char *name, const char *include){
+	printf("/**\n");
+	printf(" * @file %s.c\n", name);
+	printf(" * @brief Compressed images, generated with tools/image_rle_conv. Do not edit\n");
+	printf(" * @version 0.1\n");
+	printf(" * @date 2026-10-17\n");
+	printf(" * \n");
+	printf(" * @copyright Copyright (c) 2026\n");
+	printf(" * \n");
+	printf(" */\n\n");
+	printf("/*==================[inclusions]=============================================*/\n");
+	printf("#include \"%s\"\n", include);
+	printf("/*==================[macros and definitions]=================================*/\n\n");
+	printf("/*==================[internal data declaration]==============================*/\n\n");
+	printf("/*==================[internal functions declaration]=========================*/\n\n");
+	printf("/*==================[internal data definition]===============================*/\n");
+}
+
+static int Picture(int argc, char *argv[]){
+	uint8_t *bytes;
+	uint16_t *pixels;
+	uint16_t width, height;
+	uint32_t i, count, size;
+	const char *name;
+
+	if (argc != 7){
+		return -1;
+	}
+	width = atoi(argv[4]);
+	height = atoi(argv[5]);
+	name = argv[6];
+	count = (uint32_t)width * height;
+	if ((count == 0) || (ReadArray(argv[2], argv[3], &bytes) != 2 * count)){
+		fprintf(stderr, "%s: array %s is not a %ux%u RGB565 picture\n", argv[2], argv[3], width, height);
+		return 1;
+	}
+	pixels = malloc(count * sizeof(uint16_t));
+	encoded = malloc(3 * count);
+	decoded = malloc(count * sizeof(uint16_t));
+	for (i = 0; i < count; i++){
+		pixels[i] = (bytes[2 * i] << 8) | bytes[2 * i + 1];
+	}
+	size = Encode(pixels, width, height, 0);
+	if (size == 0){
+		fprintf(stderr, "%s: %s does not round trip\n", argv[2], argv[3]);
+		return 1;
+	}
+	fprintf(stderr, "%s: %u bytes -> %u bytes\n", name, 2 * count, size);
+
+	WriteHeader(name, "image_rle.h");
+	printf("/**\n * @brief %ux%u picture data array (%u bytes as RGB565). \n */\n", width, height, 2 * count);
+	printf("const uint8_t %s_data[] = {\n", name);
+	WriteBytes(encoded, size);
+	printf("};\n\n");
+	printf("/*==================[external data definition]===============================*/\n\n");
+	printf("const image_rle_t %s = {\n    %u,\n    %u,\n    0,\n    NULL,\n    %u,\n    %s_data\n};\n\n", name, width, height, size, name);
+	printf("/*==================[internal functions definition]==========================*/\n\n");
+	printf("/*==================[external functions definition]==========================*/\n\n");
+	printf("/*==================[end of file]============================================*/\n");
+	return 0;
+}
+
+static int Icons(int argc, char *argv[]){
+	uint8_t *bytes;
+	uint16_t *pixels;
+	uint16_t *offsets[argc];
+	uint16_t icons[argc];
+	uint16_t size, row_bytes;
+	uint32_t arg, i, row, col, length, raw = 0, total = 0, pos;
+	uint8_t *data;
+
+	if ((argc < 6) || ((argc - 3) % 3 != 0)){
+		return -1;
+	}
+	WriteHeader("icons", "icons.h");
+	for (arg = 3; arg < argc; arg += 3){
+		size = atoi(argv[arg + 1]);
+		row_bytes = (size + 7) / 8;
+		length = ReadArray(argv[2], argv[arg], &bytes);
+		if ((size == 0) || (length == 0) || (length % (size * row_bytes) != 0)){
+			fprintf(stderr, "%s: array %s is not a list of %ux%u icons\n", argv[2], argv[arg], size, size);
+			return 1;
+		}
+		icons[arg] = length / (size * row_bytes);
+		offsets[arg] = malloc((icons[arg] + 1) * sizeof(uint16_t));
+		pixels = malloc(size * size * sizeof(uint16_t));
+		encoded = malloc(3 * size * size);
+		decoded = malloc(size * size * sizeof(uint16_t));
+		data = malloc(3 * size * size * icons[arg]);
+		pos = 0;
+		for (i = 0; i < icons[arg]; i++){
+			for (row = 0; row < size; row++){
+				for (col = 0; col < size; col++){
+					pixels[row * size + col] = (bytes[(i * size + row) * row_bytes + col / 8] >> (7 - col % 8)) & 0x01;
+				}
+			}
+			length = Encode(pixels, size, size, 2);
+			if ((length == 0) || (pos + length > UINT16_MAX)){
+				fprintf(stderr, "%s: icon %u of %s does not round trip\n", argv[2], i, argv[arg]);
+				return 1;
+			}
+			offsets[arg][i] = pos;
+			memcpy(&data[pos], encoded, length);
+			pos += length;
+		}
+		offsets[arg][i] = pos;
+		raw += size * row_bytes * icons[arg];
+		total += pos;
+		fprintf(stderr, "%s: %u bytes -> %u bytes\n", argv[arg + 2], size * row_bytes * icons[arg], pos);
+
+		printf("/**\n * @brief %ux%u icon data array. \n */\n", size, size);
+		printf("const uint8_t %s_data[] = {\n", argv[arg + 2]);
+		for (i = 0; i < icons[arg]; i++){
+			printf("    /* @%u icon %u */\n", offsets[arg][i], i);
+			WriteBytes(&data[offsets[arg][i]], offsets[arg][i + 1] - offsets[arg][i]);
+		}
+		printf("};\n\n");
+		printf("/**\n * @brief %ux%u icon positions in data array. \n */\n", size, size);
+		printf("const uint16_t %s_offset[] = {\n", argv[arg + 2]);
+		for (i = 0; i <= icons[arg]; i++){
+			printf("%s%u,%s", (i % BYTES_PER_LINE == 0) ? "    " : "", offsets[arg][i],
+				((i % BYTES_PER_LINE == BYTES_PER_LINE - 1) || (i == icons[arg])) ? "\n" : " ");
+		}
+		printf("};\n\n");
+		free(bytes);
+		free(pixels);
+		free(encoded);
+		free(decoded);
+		free(data);
+	}
+	fprintf(stderr, "icons: %u bytes -> %u bytes\n", raw, total);
+
+	printf("/*==================[external data definition]===============================*/\n\n");
+	for (arg = 3; arg < argc; arg += 3){
+		size = atoi(argv[arg + 1]);
+		printf("icon_font_t %s = {\n    %u,\n    %u,\n    %s_offset,\n    %s_data\n};\n\n", argv[arg + 2], size, size, argv[arg + 2], argv[arg + 2]);
+	}
+	printf("/*==================[internal functions definition]==========================*/\n\n");
+	printf("/*==================[external functions definition]==========================*/\n\n");
+	printf("/*==================[end of file]============================================*/\n");
+	return 0;
+}
+
+/*==================[external functions definition]==========================*/
+int main(int argc, char *argv[]){
+	int error = -1;
+
+	if ((argc > 1) && (strcmp(argv[1], "picture") == 0)){
+		error = Picture(argc, argv);
+	}
+	else if ((argc > 1) && (strcmp(argv[1], "icons") == 0)){
+		error = Icons(argc, argv);
+	}
+	if (error < 0){
+		fprintf(stderr, "usage: %s picture <source.c> <array> <width> <height> <name>\n", argv[0]);
+		fprintf(stderr, "       %s icons <source.c> <array> <size> <name> [<array> <size> <name> ...]\n", argv[0]);
+	}
+	return error != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -13,6 +13,16 @@
  * 
  * @note The ESP-EDU have 4 analog inputs and 1 analog output, but the designated pin for 
  * the latter is shared with analog output 0 (CH0).
+ * 
+ * @note In continuous mode the ADC samples all started channels by DMA. Samples are
+ * grouped in blocks of ANALOG_BLOCK_SIZE values per channel, which are handed off through 
+ * a queue of ANALOG_BLOCK_QTY blocks. Single and continuous reads can't be used at the 
+ * same time, as both share the only ADC unit.
+ * 
+ * @note Starting or stopping a channel stops the ADC while it is configured again: the 
+ * other started channels lose their incomplete block and the samples not split yet, which 
+ * shows as a gap in their block sequence. Block callbacks run in the driver task, they 
+ * can't start or stop channels.
  *
  * @author Albano Peñalva
  *
@@ -21,11 +31,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 17/10/2026 | Continuous (DMA) sampling with timestamped blocks						|
+ * | 17/10/2026 | Channels started and stopped without restarting the others' blocks	|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include <stdbool.h>
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -40,6 +53,8 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+#define ANALOG_BLOCK_SIZE	256	/*!< Samples per channel in each continuous mode block */
+#define ANALOG_BLOCK_QTY	4	/*!< Blocks per channel waiting to be read before new ones are dropped */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -48,11 +63,21 @@ typedef enum adc_mode {
 typedef struct {			
 	adc_ch_t input;			/*!< Inputs: CH0, CH1, CH2, CH3 */
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
-	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
+	void *func_p;			/*!< Pointer to callback function called each time a block is ready (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint16_t sample_frec;	/*!< Sample frequency per channel in Hz (only for continuous mode). Sum over started channels: min 611Hz - max 83333Hz */
 } analog_input_config_t;	
 
+/**
+ * @brief Block of continuous mode samples of one channel
+ * 
+ */
+typedef struct {
+	int64_t timestamp;						/*!< Time of the first sample (in us since boot) */
+	uint32_t sequence;						/*!< Block number since the channel was started (gaps mean dropped blocks) */
+	uint16_t samples[ANALOG_BLOCK_SIZE];	/*!< Raw 12 bits samples */
+} analog_block_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -83,6 +108,9 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
+ * @note The channel must be initialized in ADC_CONTINUOUS mode. All started channels 
+ * are sampled at the sample_frec of the last initialized channel.
+ * 
  * @param channel Channel selected
  */
 void AnalogStartContinuous(adc_ch_t channel);
@@ -95,13 +123,24 @@ void AnalogStartContinuous(adc_ch_t channel);
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the oldest block of samples of a channel in continuous mode.
+ * 
+ * @note Blocks until a block is available.
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (ANALOG_BLOCK_SIZE raw samples)
  */
 void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
 
+/**
+ * @brief Read the oldest block of a channel in continuous mode, with its timestamp.
+ * 
+ * @param channel Channel selected.
+ * @param block Pointer to block where data is stored
+ * @return true if a block was read, false if there wasn't any available
+ */
+bool AnalogInputReadBlock(adc_ch_t channel, analog_block_t *block);
+
 /**
  * @brief Digital-to-Analog convert.
  * 
@@ -13,6 +13,10 @@
  * 
  * @note All delays will block the current RTOS task, with the exception of 
  * DelayUs with usec < 50.
+ * 
+ * Delays shorter than 100 ms share a single free running timer: each task waiting is 
+ * kept in a list sorted by deadline and the timer alarm wakes them up, so several 
+ * tasks can wait at the same time with microsecond resolution.
  *
  * @author Albano Peñalva
  *
@@ -21,6 +25,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 17/10/2026 | Shared timer with per-task wait list and wake-up latency statistics	|
  * 
  **/
 
@@ -29,6 +34,14 @@
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Wake-up latency statistics (time from deadline to task running again)
+ */
+typedef struct{
+	uint32_t wakeups;			/*!< Timer delays completed */
+	uint32_t mean_latency_us;	/*!< Mean wake-up latency in usec */
+	uint32_t max_latency_us;	/*!< Worst wake-up latency in usec */
+} delay_stats_t;
 
 /*==================[internal data declaration]==============================*/
 
@@ -54,6 +67,19 @@ void DelayMs(uint16_t msec);
  */
 void DelayUs(uint16_t usec);
 
+/**
+ * @brief Get the wake-up latency statistics of timer delays
+ * @param[out] stats statistics since start-up or last DelayResetStats()
+ * @return None
+ */
+void DelayGetStats(delay_stats_t *stats);
+
+/**
+ * @brief Reset the wake-up latency statistics
+ * @return None
+ */
+void DelayResetStats(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -26,6 +26,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 17/10/2026 | Input interruption on both edges										|
+ * | 17/10/2026 | Input interruption deactivation										|
  * 
  **/
 
@@ -134,6 +136,26 @@ bool GPIORead(gpio_t pin);
  */
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args);
 
+/**
+ * @brief Configure GPIO input interruption on both edges
+ * 
+ * @note Use GPIORead() inside the callback to know which edge happened
+ * 
+ * @param pin GPIO number
+ * @param ptr_int_func Pointer to callback function
+ * @param args 
+ */
+void GPIOActivIntBothEdges(gpio_t pin, void *ptr_int_func, void *args);
+
+/**
+ * @brief Disable GPIO input interruption
+ * 
+ * @note The callback function is not called after this function returns
+ * 
+ * @param pin GPIO number
+ */
+void GPIODeactivInt(gpio_t pin);
+
 /**
  * @brief Configure an input glitch filter to a GPIO
  * 
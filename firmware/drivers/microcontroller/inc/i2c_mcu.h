@@ -21,6 +21,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 30/01/2024 | Document creation		                         |
+ * | 17/10/2026 | Repeated start reads and batched reads		 |
  *
  */
 
@@ -40,6 +41,17 @@
 #define I2C_MASTER_TX_BUF_DISABLE   0           /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_RX_BUF_DISABLE   0           /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_TIMEOUT_MS       1000
+#define I2C_MAX_BATCH_READS         8           /*!< Maximun number of register reads in I2C_readBatch() */
+
+/**
+ * @brief Register read, to be used in I2C_readBatch()
+ */
+typedef struct {
+	uint8_t devAddr;		/*!< I2C slave device address */
+	uint8_t regAddr;		/*!< First register to read */
+	uint16_t length;		/*!< Number of bytes to read */
+	uint8_t *data;			/*!< Buffer to store read data in */
+} i2c_read_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -92,9 +104,9 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  * @brief Read word from an 16-bit device register.
  * @param devAddr
  * @param regAddr
- * @param data
+ * @param data Word read (MSB first), not modified if the read fails
  * @param timeout
- * @return
+ * @return Number of bytes read (0 indicates failure)
  */
 int8_t I2C_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout);
 
@@ -165,6 +177,15 @@ bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *d
  */
 void I2C_SelectRegister(uint8_t devAddr, uint8_t reg);
 
+/** @fn I2C_readBatch(i2c_read_t *reads, uint8_t qty, uint16_t timeout)
+ * @brief Read a list of registers in a single transaction (repeated start between reads).
+ * @param reads List of register reads
+ * @param qty Number of reads (up to I2C_MAX_BATCH_READS)
+ * @param timeout Optional read timeout in milliseconds (0 to use I2C_MASTER_TIMEOUT_MS)
+ * @return Status of read operation (true = success)
+ */
+bool I2C_readBatch(i2c_read_t *reads, uint8_t qty, uint16_t timeout);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -21,13 +21,15 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 17/10/2026 | Persistent device handles and queued transactions						|
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
-
+#define SPI_MAX_TRANSFER_SIZE	32768	/*!< Maximum number of bytes per transaction (DMA) */
+#define SPI_QUEUE_SIZE			8		/*!< Maximum number of queued transactions per device */
 /*==================[typedef]================================================*/
 
 /**
@@ -58,6 +60,15 @@ typedef enum {
 	SPI_INTERRUPT,		/*!< Interrupción */
 } transfer_mode_t;
 
+/**
+ * @brief Data/command pin level for queued transactions
+ */
+typedef enum {
+	SPI_DC_NONE,		/*!< Data/command pin is not changed */
+	SPI_DC_COMMAND,		/*!< Data/command pin low during transaction */
+	SPI_DC_DATA,		/*!< Data/command pin high during transaction */
+} spi_dc_t;
+
 /**
  * @brief SPI configuration structure
  */
@@ -108,6 +119,39 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Set the data/command GPIO driven by the SPI driver for queued transactions
+ * 
+ * @note The pin is set in the transaction pre-callback, right before the transfer starts.
+ * It must be already configured as output.
+ * 
+ * @param device SPI device
+ * @param dc_pin GPIO number used as data/command
+ */
+void SpiSetDCPin(spi_dev_t device, uint8_t dc_pin);
+
+/**
+ * @brief Queue a write transaction and return without waiting for it to finish
+ * 
+ * @note Writes of up to 4 bytes are copied, so tx_buffer can be released right away. 
+ * Larger buffers must remain valid until SpiWaitAll() returns. If SPI_QUEUE_SIZE 
+ * transactions are already in flight, waits for the oldest one to finish.
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer pointer to buffer where data is stored
+ * @param tx_buffer_size numbers of bytes to write (up to SPI_MAX_TRANSFER_SIZE)
+ * @param dc data/command pin level during the transaction
+ * @return uint8_t 1 when success, 0 when fails
+ */
+uint8_t SpiQueueWrite(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size, spi_dc_t dc);
+
+/**
+ * @brief Wait until all queued transactions of a device have finished
+ * 
+ * @param device SPI device
+ */
+void SpiWaitAll(spi_dev_t device);
+
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
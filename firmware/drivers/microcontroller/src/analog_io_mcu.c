@@ -11,6 +11,12 @@
 
 /*==================[inclusions]=============================================*/
 #include "analog_io_mcu.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
 #include "esp_adc/adc_cali_scheme.h"
@@ -19,13 +25,57 @@
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CHANNELS		4							// Number of analog inputs
+#define ADC_FRAME_SIZE		(ANALOG_BLOCK_SIZE * SOC_ADC_DIGI_RESULT_BYTES)	// Bytes of each DMA conversion frame
+#define ADC_FRAME_QTY		4							// Frames stored by the driver ring buffer
+#define ADC_TASK_STACK		4096						// Continuous mode task stack size
+#define ADC_TASK_PRIORITY	10							// Continuous mode task priority (above application tasks)
+/**
+ * @brief Continuous mode state of each channel
+ */
+typedef struct {
+	QueueHandle_t blocks;		/*!< Filled blocks waiting to be read */
+	analog_block_t current;		/*!< Block being filled */
+	uint16_t count;				/*!< Samples in current block */
+	uint32_t sequence;			/*!< Next block number */
+	bool active;				/*!< Channel started */
+	void (*func_p)(void*);		/*!< Callback for block ready */
+	void *param_p;				/*!< Callback parameter */
+} adc_cont_channel_t;
 /*==================[internal data declaration]==============================*/
 adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
 adc_oneshot_unit_handle_t adc1_single; 
-adc_continuous_handle_t adc2_cont;
+adc_continuous_handle_t adc1_cont = NULL;
+bool adc1_cont_running = false;
+uint16_t adc_cont_sample_frec = 0;		/*!< Sample frequency per channel */
+uint32_t adc_cont_total_frec = 0;		/*!< Sample frequency of the ADC (all started channels) */
+static adc_cont_channel_t adc_cont_ch[ADC_CHANNELS];
+static TaskHandle_t adc_cont_task = NULL;
+static SemaphoreHandle_t adc_cont_lock = NULL;	/*!< Held by the task while it splits frames, and while reconfiguring */
+static uint8_t adc_cont_frame[ADC_FRAME_SIZE];		/*!< DMA frame read (with adc_cont_lock held) */
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
 /*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR adc_conv_done_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	vTaskNotifyGiveFromISR(adc_cont_task, &xHigherPriorityTaskWoken);
+	return (xHigherPriorityTaskWoken == pdTRUE);
+}
+
+/**
+ * @brief Task that splits DMA frames into per channel blocks
+ * 
+ * @param param not used
+ */
+static void AnalogContinuousTask(void *param);
+
+/**
+ * @brief Start or stop a channel: stop the ADC, then configure and start it again with the channels started
+ * 
+ * @param channel Channel to start or stop
+ * @param active Start (true) or stop (false)
+ */
+static void AnalogContinuousConfig(adc_ch_t channel, bool active);
 
 /*==================[internal data definition]===============================*/
 adc_oneshot_unit_init_cfg_t init_config_single = {
@@ -39,6 +89,125 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void AnalogContinuousTask(void *param){
+	uint32_t frame_len, results, i;
+	int64_t frame_time;
+	adc_digi_output_data_t *result;
+	adc_cont_channel_t *ch;
+
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		/* Channels are not reconfigured in the middle of a frame */
+		xSemaphoreTake(adc_cont_lock, portMAX_DELAY);
+		/* Empty every frame stored by the driver */
+		while(adc_continuous_read(adc1_cont, adc_cont_frame, ADC_FRAME_SIZE, &frame_len, 0) == ESP_OK){
+			frame_time = esp_timer_get_time();
+			results = frame_len / SOC_ADC_DIGI_RESULT_BYTES;
+			for(i = 0; i < results; i++){
+				result = (adc_digi_output_data_t *)&adc_cont_frame[i * SOC_ADC_DIGI_RESULT_BYTES];
+				if(result->type2.channel >= ADC_CHANNELS){
+					continue;
+				}
+				ch = &adc_cont_ch[result->type2.channel];
+				if(!ch->active){
+					continue;
+				}
+				if(ch->count == 0){
+					/* The last result of the frame was converted when the frame was read */
+					ch->current.timestamp = frame_time - ((int64_t)(results - 1 - i) * 1000000) / adc_cont_total_frec;
+				}
+				ch->current.samples[ch->count++] = result->type2.data;
+				if(ch->count == ANALOG_BLOCK_SIZE){
+					ch->current.sequence = ch->sequence++;
+					/* If the reader is late the block is dropped (sequence gap) */
+					xQueueSend(ch->blocks, &ch->current, 0);
+					ch->count = 0;
+					if(ch->func_p != NULL){
+						ch->func_p(ch->param_p);
+					}
+				}
+			}
+		}
+		xSemaphoreGive(adc_cont_lock);
+	}
+}
+
+static void AnalogContinuousConfig(adc_ch_t channel, bool active){
+	adc_digi_pattern_config_t pattern[ADC_CHANNELS];
+	uint32_t frame_len;
+	uint8_t i, channels = 0;
+	bool discarded = false;
+
+	if(adc1_cont == NULL){
+		adc_cont_lock = xSemaphoreCreateMutex();
+		adc_continuous_handle_cfg_t handle_config = {
+			.max_store_buf_size = ADC_FRAME_SIZE * ADC_FRAME_QTY,
+			.conv_frame_size = ADC_FRAME_SIZE,
+		};
+		ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_config, &adc1_cont));
+		xTaskCreate(&AnalogContinuousTask, "analog_cont", ADC_TASK_STACK, NULL, ADC_TASK_PRIORITY, &adc_cont_task);
+		adc_continuous_evt_cbs_t callbacks = {
+			.on_conv_done = adc_conv_done_isr,
+		};
+		ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc1_cont, &callbacks, NULL));
+	}
+	/* Wait for the task to finish the frame it is splitting */
+	xSemaphoreTake(adc_cont_lock, portMAX_DELAY);
+	/* ADC can only be configured while stopped: frames of the old configuration are discarded */
+	if(adc1_cont_running){
+		while(adc_continuous_read(adc1_cont, adc_cont_frame, ADC_FRAME_SIZE, &frame_len, 0) == ESP_OK){
+			discarded = true;
+		}
+		adc_continuous_stop(adc1_cont);
+		adc1_cont_running = false;
+	}
+	for(i = 0; i < ADC_CHANNELS; i++){
+		/* Channels that go on lose their incomplete block and discarded samples: a gap in their sequence */
+		if(adc_cont_ch[i].active && ((adc_cont_ch[i].count > 0) || discarded)){
+			adc_cont_ch[i].count = 0;
+			adc_cont_ch[i].sequence++;
+		}
+	}
+	if(active && !adc_cont_ch[channel].active){
+		/* Blocks of a started channel start over */
+		adc_cont_ch[channel].count = 0;
+		adc_cont_ch[channel].sequence = 0;
+		xQueueReset(adc_cont_ch[channel].blocks);
+	}
+	adc_cont_ch[channel].active = active;
+	for(i = 0; i < ADC_CHANNELS; i++){
+		if(adc_cont_ch[i].active){
+			pattern[channels].atten = ADC_ATTENUATION;
+			pattern[channels].channel = ADC_CHANNEL_0 + i;
+			pattern[channels].unit = ADC_UNIT_1;
+			pattern[channels].bit_width = ADC_BITWIDTH;
+			channels++;
+		}
+	}
+	if(channels == 0){
+		xSemaphoreGive(adc_cont_lock);
+		return;
+	}
+	/* sample_frec is per channel, the ADC alternates between started channels */
+	adc_cont_total_frec = (uint32_t)adc_cont_sample_frec * channels;
+	if(adc_cont_total_frec < SOC_ADC_SAMPLE_FREQ_THRES_LOW){
+		adc_cont_total_frec = SOC_ADC_SAMPLE_FREQ_THRES_LOW;
+	}
+	if(adc_cont_total_frec > SOC_ADC_SAMPLE_FREQ_THRES_HIGH){
+		adc_cont_total_frec = SOC_ADC_SAMPLE_FREQ_THRES_HIGH;
+	}
+	adc_continuous_config_t cont_config = {
+		.pattern_num = channels,
+		.adc_pattern = pattern,
+		.sample_freq_hz = adc_cont_total_frec,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	ESP_ERROR_CHECK(adc_continuous_config(adc1_cont, &cont_config));
+	ESP_ERROR_CHECK(adc_continuous_start(adc1_cont));
+	adc1_cont_running = true;
+	xSemaphoreGive(adc_cont_lock);
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -99,20 +268,12 @@ void AnalogInputInit(analog_input_config_t *config){
 			}
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
+			if(adc_cont_ch[config->input].blocks == NULL){
+				adc_cont_ch[config->input].blocks = xQueueCreate(ANALOG_BLOCK_QTY, sizeof(analog_block_t));
 			}
+			adc_cont_ch[config->input].func_p = config->func_p;
+			adc_cont_ch[config->input].param_p = config->param_p;
+			adc_cont_sample_frec = config->sample_frec;
 		break;
 	}
 }
@@ -145,15 +306,33 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
 }
 
 void AnalogStartContinuous(adc_ch_t channel){
-
+	if(adc_cont_ch[channel].blocks == NULL){
+		return;
+	}
+	AnalogContinuousConfig(channel, true);
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
-
+	if(adc_cont_ch[channel].blocks == NULL){
+		return;
+	}
+	AnalogContinuousConfig(channel, false);
 }
 
 void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	analog_block_t block;
+	if(adc_cont_ch[channel].blocks == NULL){
+		return;
+	}
+	xQueueReceive(adc_cont_ch[channel].blocks, &block, portMAX_DELAY);
+	memcpy(values, block.samples, sizeof(block.samples));
+}
 
+bool AnalogInputReadBlock(adc_ch_t channel, analog_block_t *block){
+	if(adc_cont_ch[channel].blocks == NULL){
+		return false;
+	}
+	return (xQueueReceive(adc_cont_ch[channel].blocks, block, 0) == pdTRUE);
 }
 
 void AnalogOutputWrite(uint8_t value){
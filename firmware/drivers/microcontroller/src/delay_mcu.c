@@ -14,6 +14,7 @@
 #include "driver/gptimer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_rom_sys.h"
 /*==================[macros and definitions]=================================*/
 #define US_RESOLUTION_HZ	1000000	/*!< 1usec */
@@ -21,15 +22,144 @@
 #define SEC					1000000	/*!< 1sec = 1000msec */
 #define MIN_US				50	    /*!< minimun delay in usec to use gptimer */
 #define MIN_MS				100	    /*!< minimun delay in msec to use vTaskDelay */
+
+/**
+ * @brief Sleeping task. Lives in the caller's stack while it waits.
+ */
+typedef struct delay_node_s{
+	uint64_t deadline;						/*!< Timer count at which the task must wake up */
+	SemaphoreHandle_t semaphore;			/*!< Given by the alarm ISR at deadline */
+	StaticSemaphore_t semaphore_buffer;		/*!< Storage for the semaphore (no heap allocation) */
+	struct delay_node_s *next;				/*!< Next task to wake up (later deadline) */
+} delay_node_t;
+
+typedef enum{
+	TIMER_NONE,
+	TIMER_CREATING,
+	TIMER_READY,
+} timer_state_t;
 /*==================[internal data declaration]==============================*/
-SemaphoreHandle_t xDelaySemaphore = NULL;
+static gptimer_handle_t delay_timer = NULL;					/*!< Free running timer shared by all delays */
+static volatile timer_state_t delay_timer_state = TIMER_NONE;
+static delay_node_t *wait_list = NULL;						/*!< Sleeping tasks, sorted by deadline */
+static portMUX_TYPE delay_spinlock = portMUX_INITIALIZER_UNLOCKED;
+static delay_stats_t delay_stats = {0};
+static uint64_t latency_sum = 0;
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Wake up every task whose deadline has passed and program the alarm for the next one.
+ * 
+ * @note Must be called with delay_spinlock taken.
+ * 
+ * @param xHigherPriorityTaskWoken pdTRUE if a higher priority task was woken (NULL if not in ISR)
+ */
+static void IRAM_ATTR DelayServeList(BaseType_t *xHigherPriorityTaskWoken){
+	uint64_t now;
+	gptimer_alarm_config_t alarm_config = {0};
+	do{
+		gptimer_get_raw_count(delay_timer, &now);
+		while((wait_list != NULL) && (wait_list->deadline <= now)){
+			xSemaphoreGiveFromISR(wait_list->semaphore, xHigherPriorityTaskWoken);
+			wait_list = wait_list->next;
+		}
+		if(wait_list == NULL){
+			gptimer_set_alarm_action(delay_timer, NULL);
+			return;
+		}
+		alarm_config.alarm_count = wait_list->deadline;
+		gptimer_set_alarm_action(delay_timer, &alarm_config);
+		/* The deadline could have passed while the alarm was being programmed */
+		gptimer_get_raw_count(delay_timer, &now);
+	}while(wait_list->deadline <= now);
+}
+
 static bool IRAM_ATTR delay_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
 	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-	gptimer_stop(timer);
-	xSemaphoreGiveFromISR(xDelaySemaphore, &xHigherPriorityTaskWoken);
+	portENTER_CRITICAL_ISR(&delay_spinlock);
+	DelayServeList(&xHigherPriorityTaskWoken);
+	portEXIT_CRITICAL_ISR(&delay_spinlock);
 	return (xHigherPriorityTaskWoken == pdTRUE);
 }
+
+/**
+ * @brief Create and start the shared timer (only the first time it is called).
+ */
+static void DelayTimerInit(void){
+	bool create = false;
+	if(delay_timer_state == TIMER_READY){
+		return;
+	}
+	portENTER_CRITICAL(&delay_spinlock);
+	if(delay_timer_state == TIMER_NONE){
+		delay_timer_state = TIMER_CREATING;
+		create = true;
+	}
+	portEXIT_CRITICAL(&delay_spinlock);
+	if(!create){
+		/* Another task is creating the timer */
+		while(delay_timer_state != TIMER_READY){
+			vTaskDelay(1);
+		}
+		return;
+	}
+	gptimer_config_t delay_timer_config = {
+		.clk_src = GPTIMER_CLK_SRC_DEFAULT,
+		.direction = GPTIMER_COUNT_UP,
+		.resolution_hz = US_RESOLUTION_HZ,
+	};
+	ESP_ERROR_CHECK(gptimer_new_timer(&delay_timer_config, &delay_timer));
+	gptimer_event_callbacks_t delay_alarm = {
+		.on_alarm = delay_isr,
+	};
+	gptimer_register_event_callbacks(delay_timer, &delay_alarm, NULL);
+	gptimer_enable(delay_timer);
+	gptimer_start(delay_timer);
+	delay_timer_state = TIMER_READY;
+}
+
+/**
+ * @brief Block the calling task for usec microseconds using the shared timer.
+ * 
+ * @param usec microseconds to be in delay
+ */
+static void DelayWait(uint32_t usec){
+	delay_node_t node;
+	delay_node_t **prev;
+	uint64_t now;
+	uint32_t latency;
+
+	DelayTimerInit();
+	node.semaphore = xSemaphoreCreateBinaryStatic(&node.semaphore_buffer);
+	portENTER_CRITICAL(&delay_spinlock);
+	gptimer_get_raw_count(delay_timer, &now);
+	node.deadline = now + usec;
+	/* Insert sorted by deadline */
+	prev = &wait_list;
+	while((*prev != NULL) && ((*prev)->deadline <= node.deadline)){
+		prev = &(*prev)->next;
+	}
+	node.next = *prev;
+	*prev = &node;
+	if(wait_list == &node){
+		/* New earliest deadline: reprogram the alarm */
+		DelayServeList(NULL);
+	}
+	portEXIT_CRITICAL(&delay_spinlock);
+
+	xSemaphoreTake(node.semaphore, portMAX_DELAY);
+
+	gptimer_get_raw_count(delay_timer, &now);
+	latency = (uint32_t)(now - node.deadline);
+	portENTER_CRITICAL(&delay_spinlock);
+	delay_stats.wakeups++;
+	latency_sum += latency;
+	delay_stats.mean_latency_us = latency_sum / delay_stats.wakeups;
+	if(latency > delay_stats.max_latency_us){
+		delay_stats.max_latency_us = latency;
+	}
+	portEXIT_CRITICAL(&delay_spinlock);
+	vSemaphoreDelete(node.semaphore);
+}
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
@@ -44,32 +174,7 @@ void DelaySec(uint16_t sec){
 void DelayMs(uint16_t msec){
     // If the delay is too short, use the ESP32's internal timer
     if(msec<=MIN_MS){ 
-        if(xDelaySemaphore == NULL){
-            xDelaySemaphore = xSemaphoreCreateBinary();
-            gptimer_handle_t delay_timer = NULL;
-            gptimer_config_t delay_timer_config = {
-                .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-                .direction = GPTIMER_COUNT_UP,
-                .resolution_hz = US_RESOLUTION_HZ,
-            };
-            gptimer_new_timer(&delay_timer_config, &delay_timer);
-            gptimer_event_callbacks_t delay_alarm = {
-                .on_alarm = delay_isr,
-            };
-            gptimer_register_event_callbacks(delay_timer, &delay_alarm, NULL);
-            gptimer_enable(delay_timer);
-            gptimer_alarm_config_t alarm_config = {
-                .alarm_count = msec*MSEC, 
-            };
-            gptimer_set_alarm_action(delay_timer, &alarm_config);
-            gptimer_start(delay_timer);
-            if(xDelaySemaphore != NULL){
-                xSemaphoreTake(xDelaySemaphore, portMAX_DELAY);
-                xDelaySemaphore = NULL;
-            }
-            gptimer_disable(delay_timer);
-            gptimer_del_timer(delay_timer);
-        }
+        DelayWait((uint32_t)msec * MSEC);
     }else{       
         // If the delay is longer than the minimum delay, use vTaskDelay
         vTaskDelay(msec / portTICK_PERIOD_MS);
@@ -82,33 +187,21 @@ void DelayUs(uint16_t usec){
         esp_rom_delay_us(usec);
     }else{
         /* If the delay is longer than the minimum, use the ESP32's internal timer */
-        if(xDelaySemaphore == NULL){
-	        xDelaySemaphore = xSemaphoreCreateBinary();
-            gptimer_handle_t delay_timer = NULL;
-            gptimer_config_t delay_timer_config = {
-                .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-                .direction = GPTIMER_COUNT_UP,
-                .resolution_hz = US_RESOLUTION_HZ,
-            };
-            gptimer_new_timer(&delay_timer_config, &delay_timer);
-            gptimer_event_callbacks_t delay_alarm = {
-                .on_alarm = delay_isr,
-            };
-            gptimer_register_event_callbacks(delay_timer, &delay_alarm, NULL);
-            gptimer_enable(delay_timer);
-            gptimer_alarm_config_t alarm_config = {
-                .alarm_count = usec, 
-            };
-            gptimer_set_alarm_action(delay_timer, &alarm_config);
-            gptimer_start(delay_timer);
-            if(xDelaySemaphore != NULL){
-                /* Wait for the timer to finish */
-                xSemaphoreTake(xDelaySemaphore, portMAX_DELAY);
-                xDelaySemaphore = NULL;
-            }
-            gptimer_disable(delay_timer);
-            gptimer_del_timer(delay_timer);
-        }
+        DelayWait(usec);
     }
 }
 
+void DelayGetStats(delay_stats_t *stats){
+	portENTER_CRITICAL(&delay_spinlock);
+	*stats = delay_stats;
+	portEXIT_CRITICAL(&delay_spinlock);
+}
+
+void DelayResetStats(void){
+	portENTER_CRITICAL(&delay_spinlock);
+	delay_stats.wakeups = 0;
+	delay_stats.mean_latency_us = 0;
+	delay_stats.max_latency_us = 0;
+	latency_sum = 0;
+	portEXIT_CRITICAL(&delay_spinlock);
+}
@@ -24,7 +24,7 @@ typedef struct{
 	bool state;					/*!< GPIO output state */
 } digital_io_t;
 /*==================[internal data declaration]==============================*/
-
+static bool isr_service_installed = false;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -103,7 +103,6 @@ bool GPIORead(gpio_t pin){
 }
 
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
-	static bool isr_service_installed = false;
 	if(edge){
 		gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_POSEDGE);
 	} else{
@@ -116,6 +115,22 @@ void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
     gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
 }
 
+void GPIOActivIntBothEdges(gpio_t pin, void *ptr_int_func, void *args){
+	gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_ANYEDGE);
+	if(!isr_service_installed){	
+		gpio_install_isr_service(0);
+		isr_service_installed = true;
+	}
+    gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+}
+
+void GPIODeactivInt(gpio_t pin){
+	gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_DISABLE);
+	if(isr_service_installed){
+		gpio_isr_handler_remove(gpio_list[pin].pin);
+	}
+}
+
 void GPIOInputFilter(gpio_t pin){
 	static uint8_t filter_count = 0;
 	gpio_glitch_filter_handle_t filter;
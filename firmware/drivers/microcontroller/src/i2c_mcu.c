@@ -14,6 +14,7 @@
 #include <esp_err.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
 //#include "sdkconfig.h"
 
 #include "i2c_mcu.h"
@@ -23,9 +24,54 @@
 #undef ESP_ERROR_CHECK
 #define ESP_ERROR_CHECK(x)   do { esp_err_t rc = (x); if (rc != ESP_OK) { ESP_LOGE("err", "esp_err_t = %d", rc); /*assert(0 && #x);*/} } while(0);
 
+/* Each register read is START, address, register, START, address, data (up to 2 commands) */
+#define CMD_LINK_SIZE   I2C_LINK_RECOMMENDED_SIZE(2 * I2C_MAX_BATCH_READS)
+
 /*==================[internal data definition]===============================*/
+static uint8_t cmd_link_buffer[CMD_LINK_SIZE];	/*!< Command link storage, reused by every transaction */
+static SemaphoreHandle_t i2c_mutex = NULL;		/*!< Protects cmd_link_buffer */
+static StaticSemaphore_t i2c_mutex_buffer;
 
 /*==================[internal functions declaration]=========================*/
+/** Run a transaction built in the static command link.
+ * @param cmd Command link (already terminated with STOP)
+ * @param timeout Timeout in milliseconds (0 to use I2C_MASTER_TIMEOUT_MS)
+ * @return Status of operation (true = success)
+ */
+static bool I2C_run(i2c_cmd_handle_t cmd, uint16_t timeout){
+	esp_err_t rc;
+	if(timeout == 0){
+		timeout = I2C_MASTER_TIMEOUT_MS;
+	}
+	rc = i2c_master_cmd_begin(I2C_NUM, cmd, timeout/portTICK_PERIOD_MS);
+	if(rc != ESP_OK){
+		ESP_LOGE("err", "esp_err_t = %d", rc);
+	}
+	i2c_cmd_link_delete_static(cmd);
+	xSemaphoreGive(i2c_mutex);
+	return (rc == ESP_OK);
+}
+
+/** Take the static command link.
+ * @return Empty command link
+ */
+static i2c_cmd_handle_t I2C_link(void){
+	xSemaphoreTake(i2c_mutex, portMAX_DELAY);
+	return i2c_cmd_link_create_static(cmd_link_buffer, sizeof(cmd_link_buffer));
+}
+
+/** Append a register read with repeated start to a command link.
+ * @param cmd Command link
+ * @param read Register read
+ */
+static void I2C_appendRead(i2c_cmd_handle_t cmd, const i2c_read_t *read){
+	ESP_ERROR_CHECK(i2c_master_start(cmd));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (read->devAddr << 1) | I2C_MASTER_WRITE, 1));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, read->regAddr, 1));
+	ESP_ERROR_CHECK(i2c_master_start(cmd));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (read->devAddr << 1) | I2C_MASTER_READ, 1));
+	ESP_ERROR_CHECK(i2c_master_read(cmd, read->data, read->length, I2C_MASTER_LAST_NACK));
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -46,6 +92,10 @@ bool I2C_initialize( uint32_t clockRateHz )
 
     i2c_param_config(i2c_master_port, &conf);
 
+    if(i2c_mutex == NULL){
+        i2c_mutex = xSemaphoreCreateMutexStatic(&i2c_mutex_buffer);
+    }
+
     return i2c_driver_install(i2c_master_port, conf.mode, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
 	return true;
 };
@@ -124,23 +174,31 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(devAddr, regAddr);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-	ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
+	i2c_read_t read = {devAddr, regAddr, length, data};
+	if(!I2C_readBatch(&read, 1, timeout)){
+		return 0;
+	}
+	return length;
+}
 
+/** Read a list of registers in a single transaction (repeated start between reads).
+ * @param reads List of register reads
+ * @param qty Number of reads (up to I2C_MAX_BATCH_READS)
+ * @param timeout Optional read timeout in milliseconds (0 to use I2C_MASTER_TIMEOUT_MS)
+ * @return Status of read operation (true = success)
+ */
+bool I2C_readBatch(i2c_read_t *reads, uint8_t qty, uint16_t timeout) {
+	i2c_cmd_handle_t cmd;
+	uint8_t i;
+	if((qty == 0) || (qty > I2C_MAX_BATCH_READS)){
+		return false;
+	}
+	cmd = I2C_link();
+	for(i=0; i<qty; i++){
+		I2C_appendRead(cmd, &reads[i]);
+	}
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
-	return length;
+	return I2C_run(cmd, timeout);
 }
 
 bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
@@ -153,13 +211,12 @@ bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
 void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
 	i2c_cmd_handle_t cmd;
 
-	cmd = i2c_cmd_link_create();
+	cmd = I2C_link();
 	ESP_ERROR_CHECK(i2c_master_start(cmd));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, reg, 1));
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	I2C_run(cmd, 0);
 }
 
 /** write a single bit in an 8-bit device register.
@@ -170,8 +227,10 @@ void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
  * @return Status of operation (true = success)
  */
 bool I2C_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-    uint8_t b;
-    I2C_readByte(devAddr, regAddr, &b, 0);
+    uint8_t b = 0;
+    if (I2C_readByte(devAddr, regAddr, &b, 0) == 0) {
+        return false;
+    }
     b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
     return I2C_writeByte(devAddr, regAddr, b);
 }
@@ -214,16 +273,13 @@ bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t l
 bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
 	i2c_cmd_handle_t cmd;
 
-	cmd = i2c_cmd_link_create();
+	cmd = I2C_link();
 	ESP_ERROR_CHECK(i2c_master_start(cmd));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data, 1));
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
-	return true;
+	return I2C_run(cmd, 0);
 }
 
 /** Write single byte to an 8-bit device register.
@@ -236,16 +292,13 @@ bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
 bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
 	i2c_cmd_handle_t cmd;
 
-	cmd = i2c_cmd_link_create();
+	cmd = I2C_link();
 	ESP_ERROR_CHECK(i2c_master_start(cmd));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length-1, 0));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data[length-1], 1));
+	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length, 1));
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
-	i2c_cmd_link_delete(cmd);
-	return true;
+	return I2C_run(cmd, 0);
 }
 
 
@@ -253,15 +306,19 @@ bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *d
  * read word
  * @param devAddr
  * @param regAddr
- * @param data
+ * @param data Word read (MSB first), not modified if the read fails
  * @param timeout
- * @return
+ * @return Number of bytes read (0 indicates failure)
  */
 int8_t I2C_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout){
 	uint8_t msb[2] = {0,0};
-	I2C_readBytes(devAddr, regAddr, 2, msb, 0);
-	*data = (int16_t)((msb[0] << 8) | msb[1]);
-	return 0;
+	int8_t count;
+	count = I2C_readBytes(devAddr, regAddr, 2, msb, timeout);
+	if(count == 0){
+		return 0;
+	}
+	*data = (uint16_t)((msb[0] << 8) | msb[1]);
+	return count;
 }
 
 /*==================[end of file]============================================*/
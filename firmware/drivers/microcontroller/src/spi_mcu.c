@@ -14,6 +14,8 @@
 #include <stdint.h>
 #include <string.h>
 #include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
 #include "gpio_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define PIN_NUM_MISO	GPIO_22	/*!<  */
@@ -22,32 +24,86 @@
 #define PIN_NUM_CS1		GPIO_19	/*!<  */
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
+#define SPI_DEVICES		3		/*!< Number of devices (chip selects) on the bus */
+#define SPI_SMALL_TX	4		/*!< Writes up to this size (bytes) are copied into the transaction */
+#define NO_DC_PIN		-1		/*!< Data/command pin not configured */
+
+/**
+ * @brief Transaction with the information needed by the driver callbacks
+ */
+typedef struct {
+	spi_transaction_t trans;	/*!< ESP-IDF transaction (must be the first member) */
+	spi_dev_t device;			/*!< Device that owns the transaction */
+	spi_dc_t dc;				/*!< Data/command pin level during the transaction */
+} spi_mcu_trans_t;
+
+/**
+ * @brief State of each device on the bus
+ */
+typedef struct {
+	spi_device_handle_t handle;			/*!< Device handle, kept for the life of the device (NULL if not added) */
+	gpio_t cs_pin;						/*!< Chip select pin */
+	int8_t dc_pin;						/*!< Data/command pin (NO_DC_PIN if not used) */
+	clk_mode_t clk_mode;				/*!< Mode the device was added with */
+	uint32_t bitrate;					/*!< Speed the device was added with */
+	transfer_mode_t transfer_mode;		/*!< Transfer mode */
+	void (*isr_p)(void*);				/*!< Callback function for transaction end */
+	void *user_data;					/*!< Callback parameter */
+	spi_mcu_trans_t pool[SPI_QUEUE_SIZE];	/*!< Pre-allocated transactions for queued writes */
+	uint8_t next;						/*!< Next pool slot to use */
+	uint8_t in_flight;					/*!< Queued transactions not yet finished */
+} spi_mcu_device_t;
 /*==================[internal data declaration]==============================*/
-spi_device_handle_t spi_1, spi_2, spi_3;
 const spi_bus_config_t bus_cfg = {
     .miso_io_num = PIN_NUM_MISO,
     .mosi_io_num = PIN_NUM_MOSI,
     .sclk_io_num = PIN_NUM_CLK,
     .quadwp_io_num = -1,
     .quadhd_io_num = -1,
-    .max_transfer_sz = 4092
+    .max_transfer_sz = SPI_MAX_TRANSFER_SIZE
+};
+static spi_mcu_device_t spi_devices[SPI_DEVICES] = {
+	{.cs_pin = PIN_NUM_CS1, .dc_pin = NO_DC_PIN},
+	{.cs_pin = PIN_NUM_CS2, .dc_pin = NO_DC_PIN},
+	{.cs_pin = PIN_NUM_CS3, .dc_pin = NO_DC_PIN},
 };
-transfer_mode_t transfer_mode_1, transfer_mode_2, transfer_mode_3;
-void (*spi_1_isr_p)(void*);	/*!<  */
-void (*spi_2_isr_p)(void*);	/*!<  */
-void (*spi_3_isr_p)(void*);	/*!<  */
-void *spi_1_user_data;	    /*!<  */
-void *spi_2_user_data;	    /*!<  */
-void *spi_3_user_data;	    /*!<  */
 /*==================[internal functions declaration]=========================*/
-static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
-	spi_1_isr_p(spi_1_user_data);
+static void IRAM_ATTR spi_pre_cb(spi_transaction_t *t){
+	spi_mcu_trans_t *trans = (spi_mcu_trans_t *)t->user;
+	int8_t dc_pin = spi_devices[trans->device].dc_pin;
+	if((trans->dc != SPI_DC_NONE) && (dc_pin != NO_DC_PIN)){
+		gpio_set_level(dc_pin, trans->dc == SPI_DC_DATA);
+	}
 }
-static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
-	spi_2_isr_p(spi_2_user_data);
+static void IRAM_ATTR spi_post_cb(spi_transaction_t *t){
+	spi_mcu_trans_t *trans = (spi_mcu_trans_t *)t->user;
+	spi_mcu_device_t *dev = &spi_devices[trans->device];
+	if((dev->transfer_mode == SPI_INTERRUPT) && (dev->isr_p != NULL)){
+		dev->isr_p(dev->user_data);
+	}
 }
-static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
-	spi_3_isr_p(spi_3_user_data);
+
+/**
+ * @brief Run a blocking transaction, after any queued one of the same device
+ * 
+ * @param device SPI device
+ * @param trans Transaction to run
+ */
+static void SpiTransmit(spi_dev_t device, spi_mcu_trans_t *trans){
+	spi_mcu_device_t *dev = &spi_devices[device];
+	trans->device = device;
+	trans->dc = SPI_DC_NONE;
+	trans->trans.user = trans;
+	/* Polling transactions can't be mixed with queued ones */
+	SpiWaitAll(device);
+	switch(dev->transfer_mode){
+		case SPI_POLLING:
+			spi_device_polling_transmit(dev->handle, &trans->trans); 
+			break;
+		case SPI_INTERRUPT:
+			spi_device_transmit(dev->handle, &trans->trans); 
+			break;
+	}
 }
 /*==================[internal data definition]===============================*/
 
@@ -58,171 +114,118 @@ static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
     static bool spi_initialized = false;
+    spi_mcu_device_t *dev = &spi_devices[spi->device];
     if(!spi_initialized){
 	    spi_bus_initialize(SPI2_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
         spi_initialized = true;
+    }
+    dev->transfer_mode = spi->transfer_mode;
+    dev->isr_p = spi->func_p;
+    dev->user_data = spi->param_p;
+    /* Keep the device handle unless the bus parameters change */
+    if(dev->handle != NULL){
+        if((dev->clk_mode == spi->clk_mode) && (dev->bitrate == spi->bitrate)){
+            return 0;
+        }
+        SpiWaitAll(spi->device);
+        spi_bus_remove_device(dev->handle);
+        dev->handle = NULL;
     }
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .spics_io_num = dev->cs_pin,
+        .queue_size = SPI_QUEUE_SIZE,
+        .pre_cb = spi_pre_cb,
+        .post_cb = spi_post_cb,
     };
-    switch(spi->device){
-        case SPI_1:
-            dev_cfg.spics_io_num = PIN_NUM_CS1;
-            transfer_mode_1 = spi->transfer_mode;
-            if(transfer_mode_1 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_1_isr;
-            } 
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
-            spi_1_isr_p = spi->func_p;
-            spi_1_user_data = spi->param_p;
-            break;
-        case SPI_2:
-            dev_cfg.spics_io_num = PIN_NUM_CS2;
-            if(transfer_mode_2 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_2_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
-            spi_2_isr_p = spi->func_p;
-            spi_2_user_data = spi->param_p;
-            break;
-        case SPI_3:
-            dev_cfg.spics_io_num = PIN_NUM_CS3;
-            if(transfer_mode_3 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_3_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
-            spi_3_isr_p = spi->func_p;
-            spi_3_user_data = spi->param_p;
-            break;
-    }
+    spi_bus_add_device(SPI2_HOST, &dev_cfg, &dev->handle);
+    dev->clk_mode = spi->clk_mode;
+    dev->bitrate = spi->bitrate;
     return 0;
 }
 
 void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
-    spi_transaction_t t;
+    spi_mcu_trans_t t;
     memset(&t, 0, sizeof(t));       // Zero out the transaction
-    t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
-    t.rxlength = rx_buffer_size * 8;
-    t.rx_buffer = rx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
-    }
+    t.trans.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
+    t.trans.rxlength = rx_buffer_size * 8;
+    t.trans.rx_buffer = rx_buffer;        // Data
+    SpiTransmit(device, &t);
 }
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
-    spi_transaction_t t;
+    spi_mcu_trans_t t;
     memset(&t, 0, sizeof(t));       // Zero out the transaction
-    t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
-    t.tx_buffer = tx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
-    }
+    t.trans.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
+    t.trans.tx_buffer = tx_buffer;        // Data
+    SpiTransmit(device, &t);
 }
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
-    spi_transaction_t t;
+    spi_mcu_trans_t t;
     memset(&t, 0, sizeof(t));       // Zero out the transaction
-    t.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
-    t.rxlength = buffer_size * 8;
-    t.tx_buffer = tx_buffer;        // Data
-    t.rx_buffer = rx_buffer;        
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
+    t.trans.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
+    t.trans.rxlength = buffer_size * 8;
+    t.trans.tx_buffer = tx_buffer;        // Data
+    t.trans.rx_buffer = rx_buffer;        
+    SpiTransmit(device, &t);
+}
+
+void SpiSetDCPin(spi_dev_t device, uint8_t dc_pin){
+    spi_devices[device].dc_pin = dc_pin;
+}
+
+uint8_t SpiQueueWrite(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size, spi_dc_t dc){
+    spi_mcu_device_t *dev = &spi_devices[device];
+    spi_transaction_t *done;
+    spi_mcu_trans_t *t;
+
+    if((dev->handle == NULL) || (tx_buffer_size == 0) || (tx_buffer_size > SPI_MAX_TRANSFER_SIZE)){
+        return false;
+    }
+    /* All transactions in flight: the next slot is the oldest one, wait for it */
+    if(dev->in_flight == SPI_QUEUE_SIZE){
+        spi_device_get_trans_result(dev->handle, &done, portMAX_DELAY);
+        dev->in_flight--;
+    }
+    t = &dev->pool[dev->next];
+    dev->next = (dev->next + 1) % SPI_QUEUE_SIZE;
+    memset(&t->trans, 0, sizeof(t->trans));
+    t->trans.length = tx_buffer_size * 8;
+    t->trans.user = t;
+    t->device = device;
+    t->dc = dc;
+    if(tx_buffer_size <= SPI_SMALL_TX){
+        /* Short commands/parameters travel inside the transaction */
+        t->trans.flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->trans.tx_data, tx_buffer, tx_buffer_size);
+    } else{
+        t->trans.tx_buffer = tx_buffer;
+    }
+    if(spi_device_queue_trans(dev->handle, &t->trans, portMAX_DELAY) != ESP_OK){
+        return false;
+    }
+    dev->in_flight++;
+    return true;
+}
+
+void SpiWaitAll(spi_dev_t device){
+    spi_mcu_device_t *dev = &spi_devices[device];
+    spi_transaction_t *done;
+    while(dev->in_flight > 0){
+        spi_device_get_trans_result(dev->handle, &done, portMAX_DELAY);
+        dev->in_flight--;
     }
 }
 
 uint8_t SpiDeInit(spi_dev_t device){
+    spi_mcu_device_t *dev = &spi_devices[device];
+    if(dev->handle != NULL){
+        SpiWaitAll(device);
+        spi_bus_remove_device(dev->handle);
+        dev->handle = NULL;
+    }
     return 0;
 }
 
@@ -0,0 +1,178 @@
+/**
+ * @file bench.c
+ * @brief Host benchmark harness: timing, error measurement and JSON output
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "bench.h"
+/*==================[macros and definitions]=================================*/
+#ifndef BENCH_COMMIT
+#define BENCH_COMMIT "unknown"
+#endif
+/*==================[internal data declaration]==============================*/
+static bench_result_t results[BENCH_MAX_RESULTS];
+static uint16_t results_count = 0;
+static uint32_t failures = 0;
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Monotonic time in seconds
+ */
+static double BenchNow(void);
+
+/**
+ * @brief Time of a number of calls in seconds
+ */
+static double BenchRun(bench_func_t func, void * arg, uint32_t iterations);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static double BenchNow(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static double BenchRun(bench_func_t func, void * arg, uint32_t iterations){
+    double start = BenchNow();
+    for (uint32_t i = 0; i < iterations; i++){
+        func(arg);
+    }
+    return BenchNow() - start;
+}
+
+/*==================[external functions definition]==========================*/
+double BenchTime(bench_func_t func, void * arg){
+    // Warm up and find how many calls take at least BENCH_MIN_TIME
+    uint32_t iterations = 1;
+    double t = BenchRun(func, arg, iterations);
+    while (t < BENCH_MIN_TIME){
+        iterations *= 2;
+        t = BenchRun(func, arg, iterations);
+    }
+    double best = t;
+    for (uint8_t i = 0; i < BENCH_REPEAT; i++){
+        t = BenchRun(func, arg, iterations);
+        if (t < best){
+            best = t;
+        }
+    }
+    return best * 1e9 / iterations;
+}
+
+double BenchError(const float * out, const double * ref, uint32_t lenght, double * peak){
+    double error = 0, max = 0;
+    for (uint32_t i = 0; i < lenght; i++){
+        double e = fabs(out[i] - ref[i]);
+        if (e > error || isnan(e)){
+            error = e;
+        }
+        if (fabs(ref[i]) > max){
+            max = fabs(ref[i]);
+        }
+    }
+    if (peak != NULL){
+        *peak = max;
+    }
+    return error;
+}
+
+double BenchErrorQ15(const int16_t * out, const double * ref, uint32_t lenght, double * peak){
+    double error = 0, max = 0;
+    for (uint32_t i = 0; i < lenght; i++){
+        double e = fabs(out[i] - ref[i]);
+        if (e > error){
+            error = e;
+        }
+        if (fabs(ref[i]) > max){
+            max = fabs(ref[i]);
+        }
+    }
+    if (peak != NULL){
+        *peak = max;
+    }
+    return error;
+}
+
+void BenchAdd(const char * name, const char * variant, uint32_t samples, double ns_per_call, double max_error, double peak, double bound){
+    double relative = (peak > 0) ? max_error / peak : max_error;
+    if (results_count == 0){
+        printf("%-24s %-10s %8s %12s %10s %12s %10s\n", "name", "variant", "samples", "ns/call", "ns/sample", "Msamples/s", "rel.error");
+    }
+    if (results_count == BENCH_MAX_RESULTS){
+        return;
+    }
+    bench_result_t * r = &results[results_count++];
+    r->name = name;
+    r->variant = variant;
+    r->samples = samples;
+    r->ns_per_call = ns_per_call;
+    r->ns_per_sample = ns_per_call / samples;
+    r->msamples_per_s = 1e3 / r->ns_per_sample;
+    r->max_error = max_error;
+    r->reference_peak = peak;
+    r->bound = bound;
+    r->allocations = -1;
+    printf("%-24s %-10s %8u %12.1f %10.2f %12.2f %10.2e\n", name, variant, samples, r->ns_per_call, 
+        r->ns_per_sample, r->msamples_per_s, relative);
+    // NaN errors are never within the bound
+    if (!(relative <= bound)){
+        printf("FAIL: %s %s relative error %.2e over %.2e\n", name, variant, relative, bound);
+        failures++;
+    }
+}
+
+void BenchFail(const char * name, const char * message){
+    printf("FAIL: %s %s\n", name, message);
+    failures++;
+}
+
+uint32_t BenchFailures(void){
+    return failures;
+}
+
+void BenchSetAllocations(int32_t allocations){
+    if (results_count == 0){
+        return;
+    }
+    results[results_count - 1].allocations = allocations;
+    printf("%-24s %-10s %8d allocations/call\n", "", "", allocations);
+}
+
+bool BenchWriteJson(const char * path){
+    FILE * f = fopen(path, "w");
+    if (f == NULL){
+        return false;
+    }
+    fprintf(f, "{\n  \"commit\": \"%s\",\n  \"compiler\": \"%s\",\n  \"results\": [\n", BENCH_COMMIT, __VERSION__);
+    for (uint16_t i = 0; i < results_count; i++){
+        const bench_result_t * r = &results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"variant\": \"%s\", \"samples\": %u, \"ns_per_call\": %.3f, "
+            "\"ns_per_sample\": %.4f, \"msamples_per_s\": %.4f, \"max_error\": %.6e, \"reference_peak\": %.6e, \"bound\": %.6e, \"allocations\": %d}%s\n", 
+            r->name, r->variant, r->samples, r->ns_per_call, r->ns_per_sample, r->msamples_per_s, 
+            r->max_error, r->reference_peak, r->bound, r->allocations, (i == results_count - 1) ? "" : ",");
+    }
+    fprintf(f, "  ],\n  \"failures\": %u\n}\n", failures);
+    fclose(f);
+    return true;
+}
+
+void BenchSignal(float * signal, uint32_t lenght, uint32_t seed){
+    for (uint32_t i = 0; i < lenght; i++){
+        // Linear congruential generator, same values on every host
+        seed = seed * 1664525u + 1013904223u;
+        float noise = (float)(seed >> 8) / (1 << 24) - 0.5f;
+        signal[i] = 0.5f * sinf(2 * M_PI * 0.0123f * i) + 0.25f * cosf(2 * M_PI * 0.211f * i) + 0.1f * noise;
+    }
+}
+
+/*==================[end of file]============================================*/
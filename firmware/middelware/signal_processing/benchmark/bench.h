@@ -0,0 +1,183 @@
+#ifndef BENCH_H_
+#define BENCH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Benchmark Host benchmark
+ */
+
+/** \brief Host native benchmark and regression suite for the DSP code
+ * 
+ * Runs the esp-dsp kernels (ANSI and optimised C variants) and the signal processing 
+ * middleware on the development PC, built with the esp-dsp include_sim headers. Each 
+ * benchmark reports ns/sample, throughput and the maximun error against a double precision 
+ * reference, and the results are written as JSON to compare between commits. A relative
+ * error over the bound of its benchmark (or any other failed check) fails the run.
+ * 
+ * Host times are only useful as relative numbers: the ESP32-C6 has no FPU, so float kernels
+ * are much slower on target compared to the fixed point ones.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Heap allocations per call for the Mat benchmarks						|
+ * | 17/10/2026 | EKF benchmark, allocation counter shared by the C++ benchmarks		|
+ * | 17/10/2026 | Error bounds, failed checks fail the run								|
+ * | 17/10/2026 | Up to 128 results, for the FIR tap sweep								|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define BENCH_MIN_TIME      0.01    /*!< Minimun time of each measurement (s) */
+#define BENCH_REPEAT        5       /*!< Measurements per benchmark (the fastest one is reported) */
+#define BENCH_MAX_RESULTS   128     /*!< Maximun number of results */
+#define BENCH_F32_BOUND     1e-5    /*!< Relative error bound of float results against the double precision reference */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Function under test, called repeatedly with the same argument
+ */
+typedef void (*bench_func_t)(void * arg);
+
+/**
+ * @brief Result of a benchmark
+ */
+typedef struct {
+    const char * name;          /*!< Kernel or function name */
+    const char * variant;       /*!< Implementation (ansi, rv32, middleware, ...) */
+    uint32_t samples;           /*!< Samples (outputs) per call */
+    double ns_per_call;         /*!< Time of each call (ns) */
+    double ns_per_sample;       /*!< Time of each sample (ns) */
+    double msamples_per_s;      /*!< Throughput (Msamples/s) */
+    double max_error;           /*!< Maximun absolute error against the reference */
+    double reference_peak;      /*!< Maximun absolute value of the reference */
+    double bound;               /*!< Maximun relative error (max_error / reference_peak, max_error if the peak is 0) */
+    int32_t allocations;        /*!< Heap allocations per call (-1 if not measured) */
+} bench_result_t;
+
+/*==================[external functions declaration]=========================*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Measure the time of a function
+ * 
+ * @param func          Function under test
+ * @param arg           Argument of the function
+ * @return double       Time of each call (ns)
+ */
+double BenchTime(bench_func_t func, void * arg);
+
+/**
+ * @brief Maximun absolute error of a float array against a double precision reference
+ * 
+ * @param out           Array under test
+ * @param ref           Reference array
+ * @param lenght        Number of values
+ * @param peak          Maximun absolute value of the reference (output, can be NULL)
+ * @return double       Maximun absolute error
+ */
+double BenchError(const float * out, const double * ref, uint32_t lenght, double * peak);
+
+/**
+ * @brief Maximun absolute error of a Q15 array against a double precision reference
+ * 
+ * @param out           Array under test
+ * @param ref           Reference array (in LSB)
+ * @param lenght        Number of values
+ * @param peak          Maximun absolute value of the reference (output, can be NULL)
+ * @return double       Maximun absolute error (LSB)
+ */
+double BenchErrorQ15(const int16_t * out, const double * ref, uint32_t lenght, double * peak);
+
+/**
+ * @brief Store a result and print it, a relative error over the bound is a failure
+ * 
+ * @param name          Kernel or function name
+ * @param variant       Implementation (ansi, rv32, middleware, ...)
+ * @param samples       Samples (outputs) per call
+ * @param ns_per_call   Time of each call (ns)
+ * @param max_error     Maximun absolute error against the reference
+ * @param peak          Maximun absolute value of the reference
+ * @param bound         Maximun relative error (absolute error if the peak is 0)
+ */
+void BenchAdd(const char * name, const char * variant, uint32_t samples, double ns_per_call, double max_error, double peak, double bound);
+
+/**
+ * @brief Print a failed check and count it
+ * 
+ * @param name          Kernel or function name
+ * @param message       What failed
+ */
+void BenchFail(const char * name, const char * message);
+
+/**
+ * @brief Number of failed checks (errors over their bound included)
+ * 
+ * @return uint32_t     Failures
+ */
+uint32_t BenchFailures(void);
+
+/**
+ * @brief Count the heap allocations (C++ new) of one call of a function
+ * 
+ * @param func          Function under test
+ * @param arg           Argument of the function
+ * @return int32_t      Heap allocations
+ */
+int32_t BenchCountAllocations(bench_func_t func, void * arg);
+
+/**
+ * @brief Set the heap allocations per call of the last stored result
+ * 
+ * @param allocations   Heap allocations per call
+ */
+void BenchSetAllocations(int32_t allocations);
+
+/**
+ * @brief Write every result to a JSON file
+ * 
+ * @param path          File path
+ * @return true         File written
+ * @return false        The file could not be opened
+ */
+bool BenchWriteJson(const char * path);
+
+/**
+ * @brief Fill an array with a deterministic test signal (sum of tones and noise, peak below 1)
+ * 
+ * @param signal        Array to fill
+ * @param lenght        Number of values
+ * @param seed          Seed of the noise
+ */
+void BenchSignal(float * signal, uint32_t lenght, uint32_t seed);
+
+/** @brief esp-dsp kernels: FFT, biquad, FIR/FIRD, dotprod, conv/corr and matrix functions */
+void BenchDsp(void);
+
+/** @brief Signal processing middleware: FFTMagnitude, IIR filters (LowPassFilter), FIR filters, Goertzel bank, Welch, QRS detector and decimator */
+void BenchMiddleware(void);
+
+/** @brief esp-dsp dspm::Mat operators */
+void BenchMat(void);
+
+/** @brief esp-dsp ekf_imu13states filter step against the dense reference methods */
+void BenchEkf(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BENCH_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,54 @@
+/**
+ * @file bench_alloc.cpp
+ * @brief Counting allocator of the host benchmarks
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <new>
+#include "bench.h"
+/*==================[internal data declaration]==============================*/
+static uint32_t allocations;    /*!< Heap allocations since the last reset */
+/*==================[global allocator]=======================================*/
+/* Counting allocator: every heap allocation of the benchmark goes through here */
+void * operator new(size_t size){
+    allocations++;
+    void * ptr = malloc(size ? size : 1);
+    if (ptr == NULL){
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void * operator new[](size_t size){
+    return operator new(size);
+}
+
+void operator delete(void * ptr) noexcept{
+    free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept{
+    free(ptr);
+}
+
+void operator delete(void * ptr, size_t size) noexcept{
+    free(ptr);
+}
+
+void operator delete[](void * ptr, size_t size) noexcept{
+    free(ptr);
+}
+/*==================[external functions definition]==========================*/
+int32_t BenchCountAllocations(bench_func_t func, void * arg){
+    allocations = 0;
+    func(arg);
+    return allocations;
+}
+
+/*==================[end of file]============================================*/
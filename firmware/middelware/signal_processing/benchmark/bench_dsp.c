@@ -0,0 +1,335 @@
+/**
+ * @file bench_dsp.c
+ * @brief Host benchmarks of the esp-dsp kernels
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "bench.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define FFT_N           1024    /*!< Complex points of the FFTs */
+#define FILTER_N        4096    /*!< Samples of each filter call */
+#define FIR_TAPS        64      /*!< FIR/FIRD coefficients */
+#define FIRD_DECIM      4       /*!< FIRD decimation */
+#define DOT_N           1024    /*!< Dot product lenght */
+#define CONV_N          1024    /*!< Convolution/correlation signal lenght */
+#define CONV_K          64      /*!< Convolution kernel/correlation pattern lenght */
+#define MAT_N           16      /*!< Matrix size */
+#define Q15_SCALE       16384   /*!< Scale of the test signal for Q15 kernels */
+#define DOT_Q15_SCALE   2048    /*!< Scale of the dot product inputs (the result fits in Q15) */
+#define Q15_BOUND       1e-3    /*!< Relative error bound of the Q15 filter and dot product (a few LSB) */
+#define FFT_Q15_BOUND   2e-3    /*!< Relative error bound of the Q15 FFT (rounded on each of the log2(N) stages) */
+
+typedef esp_err_t (*fft_f32_func_t)(float * data, int N, float * w);
+typedef esp_err_t (*biquad_func_t)(const float * input, float * output, int len, float * coef, float * w);
+typedef esp_err_t (*fir_func_t)(fir_f32_t * fir, const float * input, float * output, int len);
+typedef esp_err_t (*dotprod_s16_func_t)(const int16_t * src1, const int16_t * src2, int16_t * dest, int len, int8_t shift);
+/*==================[internal data declaration]==============================*/
+static float signal[2 * FILTER_N];
+static float output[2 * FILTER_N];
+static int16_t signal_q15[2 * FILTER_N];
+static int16_t output_q15[2 * FILTER_N];
+static double reference[2 * FILTER_N];
+static float coeffs[FIR_TAPS];
+static int16_t coeffs_q15[FIR_TAPS];
+static float delay[FIR_TAPS];
+static int16_t delay_q15[FIR_TAPS];
+static float biquad_coef[5];
+static fir_f32_t fir;
+static fir_s16_t fir_q15;
+static fft_f32_func_t fft_f32;
+static biquad_func_t biquad;
+static fir_func_t fir_f32;
+static dotprod_s16_func_t dotprod_s16;
+/*==================[internal functions declaration]=========================*/
+/** @brief Double precision DFT of FFT_N complex points */
+static void ReferenceDFT(const double * x, double * X);
+
+static void RunFFT2R(void * arg);
+static void RunFFT4R(void * arg);
+static void RunFFT2RQ15(void * arg);
+static void RunBiquad(void * arg);
+static void RunFIR(void * arg);
+static void RunFIRD(void * arg);
+static void RunFIRDQ15(void * arg);
+static void RunDotprod(void * arg);
+static void RunDotprodQ15(void * arg);
+static void RunConv(void * arg);
+static void RunCorr(void * arg);
+static void RunMatMult(void * arg);
+static void RunMatAdd(void * arg);
+
+static void BenchFFT(void);
+static void BenchFilters(void);
+static void BenchVector(void);
+/*==================[internal functions definition]==========================*/
+static void ReferenceDFT(const double * x, double * X){
+    for (int k = 0; k < FFT_N; k++){
+        double re = 0, im = 0;
+        for (int n = 0; n < FFT_N; n++){
+            double c = cos(2 * M_PI * ((long)k * n % FFT_N) / FFT_N);
+            double s = sin(2 * M_PI * ((long)k * n % FFT_N) / FFT_N);
+            re += x[2 * n] * c + x[2 * n + 1] * s;
+            im += x[2 * n + 1] * c - x[2 * n] * s;
+        }
+        X[2 * k] = re;
+        X[2 * k + 1] = im;
+    }
+}
+
+static void RunFFT2R(void * arg){
+    memcpy(output, signal, 2 * FFT_N * sizeof(float));
+    fft_f32(output, FFT_N, dsps_fft_w_table_fc32);
+    dsps_bit_rev_fc32_ansi(output, FFT_N);
+}
+
+static void RunFFT4R(void * arg){
+    memcpy(output, signal, 2 * FFT_N * sizeof(float));
+    dsps_fft4r_fc32_ansi(output, FFT_N);
+    dsps_bit_rev4r_fc32(output, FFT_N);
+}
+
+static void RunFFT2RQ15(void * arg){
+    memcpy(output_q15, signal_q15, 2 * FFT_N * sizeof(int16_t));
+    dsps_fft2r_sc16_ansi(output_q15, FFT_N);
+    dsps_bit_rev_sc16_ansi(output_q15, FFT_N);
+}
+
+static void RunBiquad(void * arg){
+    float w[2] = {0, 0};
+    biquad(signal, output, FILTER_N, biquad_coef, w);
+}
+
+static void RunFIR(void * arg){
+    fir_f32(&fir, signal, output, FILTER_N);
+}
+
+static void RunFIRD(void * arg){
+    dsps_fird_f32_ansi(&fir, signal, output, FILTER_N / FIRD_DECIM);
+}
+
+static void RunFIRDQ15(void * arg){
+    dsps_fird_s16_ansi(&fir_q15, signal_q15, output_q15, FILTER_N / FIRD_DECIM);
+}
+
+static void RunDotprod(void * arg){
+    dsps_dotprod_f32_ansi(signal, &signal[DOT_N], output, DOT_N);
+}
+
+static void RunDotprodQ15(void * arg){
+    dotprod_s16(signal_q15, &signal_q15[DOT_N], output_q15, DOT_N, 0);
+}
+
+static void RunConv(void * arg){
+    dsps_conv_f32_ansi(signal, CONV_N, coeffs, CONV_K, output);
+}
+
+static void RunCorr(void * arg){
+    dsps_corr_f32_ansi(signal, CONV_N, coeffs, CONV_K, output);
+}
+
+static void RunMatMult(void * arg){
+    dspm_mult_f32_ansi(signal, &signal[MAT_N * MAT_N], output, MAT_N, MAT_N, MAT_N);
+}
+
+static void RunMatAdd(void * arg){
+    dspm_add_f32_ansi(signal, &signal[MAT_N * MAT_N], output, MAT_N, MAT_N, 0, 0, 0, 1, 1, 1);
+}
+
+static void BenchFFT(void){
+    static double x[2 * FFT_N];
+    double peak, error;
+    // Float
+    BenchSignal(signal, 2 * FFT_N, 1);
+    for (int i = 0; i < 2 * FFT_N; i++){
+        x[i] = signal[i];
+    }
+    ReferenceDFT(x, reference);
+    dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    dsps_fft4r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    const fft_f32_func_t fft2r[] = {dsps_fft2r_fc32_ansi_, dsps_fft2r_fc32_rv32_};
+    const char * fft2r_variant[] = {"ansi", "rv32"};
+    for (uint8_t v = 0; v < 2; v++){
+        fft_f32 = fft2r[v];
+        RunFFT2R(NULL);
+        error = BenchError(output, reference, 2 * FFT_N, &peak);
+        BenchAdd("fft2r_fc32", fft2r_variant[v], FFT_N, BenchTime(RunFFT2R, NULL), error, peak, BENCH_F32_BOUND);
+    }
+    RunFFT4R(NULL);
+    error = BenchError(output, reference, 2 * FFT_N, &peak);
+    BenchAdd("fft4r_fc32", "ansi", FFT_N, BenchTime(RunFFT4R, NULL), error, peak, BENCH_F32_BOUND);
+    // Q15, every stage divides by 2
+    for (int i = 0; i < 2 * FFT_N; i++){
+        signal_q15[i] = (int16_t)lrintf(signal[i] * Q15_SCALE);
+        x[i] = signal_q15[i];
+    }
+    ReferenceDFT(x, reference);
+    for (int i = 0; i < 2 * FFT_N; i++){
+        reference[i] /= FFT_N;
+    }
+    dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    RunFFT2RQ15(NULL);
+    error = BenchErrorQ15(output_q15, reference, 2 * FFT_N, &peak);
+    BenchAdd("fft2r_sc16", "ansi", FFT_N, BenchTime(RunFFT2RQ15, NULL), error, peak, FFT_Q15_BOUND);
+    dsps_fft2r_deinit_fc32();
+    dsps_fft4r_deinit_fc32();
+    dsps_fft2r_deinit_sc16();
+}
+
+static void BenchFilters(void){
+    double peak, error;
+    BenchSignal(signal, FILTER_N, 2);
+    // Biquad (direct form II, as esp-dsp)
+    dsps_biquad_gen_lpf_f32(biquad_coef, 0.05f, 0.7071f);
+    double w0 = 0, w1 = 0;
+    for (int n = 0; n < FILTER_N; n++){
+        double d0 = signal[n] - biquad_coef[3] * w0 - biquad_coef[4] * w1;
+        reference[n] = biquad_coef[0] * d0 + biquad_coef[1] * w0 + biquad_coef[2] * w1;
+        w1 = w0;
+        w0 = d0;
+    }
+    const biquad_func_t biquads[] = {dsps_biquad_f32_ansi, dsps_biquad_f32_rv32};
+    const char * variants[] = {"ansi", "rv32"};
+    for (uint8_t v = 0; v < 2; v++){
+        biquad = biquads[v];
+        RunBiquad(NULL);
+        error = BenchError(output, reference, FILTER_N, &peak);
+        BenchAdd("biquad_f32", variants[v], FILTER_N, BenchTime(RunBiquad, NULL), error, peak, BENCH_F32_BOUND);
+    }
+    // FIR, symmetric low pass (Hann windowed sinc)
+    for (int i = 0; i < FIR_TAPS; i++){
+        double t = i - (FIR_TAPS - 1) / 2.0;
+        double w = 0.5 - 0.5 * cos(2 * M_PI * i / (FIR_TAPS - 1));
+        coeffs[i] = (float)(0.2 * (t == 0 ? 1 : sin(M_PI * 0.2 * t) / (M_PI * 0.2 * t)) * w);
+        coeffs_q15[i] = (int16_t)lrintf(coeffs[i] * 32768);
+    }
+    for (int n = 0; n < FILTER_N; n++){
+        double acc = 0;
+        for (int k = 0; k < FIR_TAPS && k <= n; k++){
+            acc += (double)coeffs[k] * signal[n - k];
+        }
+        reference[n] = acc;
+    }
+    const fir_func_t firs[] = {dsps_fir_f32_ansi, dsps_fir_f32_rv32};
+    for (uint8_t v = 0; v < 2; v++){
+        fir_f32 = firs[v];
+        dsps_fir_init_f32(&fir, coeffs, delay, FIR_TAPS);
+        RunFIR(NULL);
+        error = BenchError(output, reference, FILTER_N, &peak);
+        BenchAdd("fir_f32", variants[v], FILTER_N, BenchTime(RunFIR, NULL), error, peak, BENCH_F32_BOUND);
+    }
+    // FIRD keeps every FIRD_DECIM-th output of the FIR
+    for (int n = 0; n < FILTER_N / FIRD_DECIM; n++){
+        reference[n] = reference[(n + 1) * FIRD_DECIM - 1];
+    }
+    dsps_fird_init_f32(&fir, coeffs, delay, FIR_TAPS, FIRD_DECIM);
+    RunFIRD(NULL);
+    error = BenchError(output, reference, FILTER_N / FIRD_DECIM, &peak);
+    BenchAdd("fird_f32", "ansi", FILTER_N / FIRD_DECIM, BenchTime(RunFIRD, NULL), error, peak, BENCH_F32_BOUND);
+    for (int n = 0; n < FILTER_N; n++){
+        signal_q15[n] = (int16_t)lrintf(signal[n] * Q15_SCALE);
+    }
+    for (int n = 0; n < FILTER_N / FIRD_DECIM; n++){
+        int m = (n + 1) * FIRD_DECIM - 1;
+        double acc = 0;
+        for (int k = 0; k < FIR_TAPS && k <= m; k++){
+            acc += (double)coeffs_q15[k] * signal_q15[m - k] / 32768;
+        }
+        reference[n] = acc;
+    }
+    dsps_fird_init_s16(&fir_q15, coeffs_q15, delay_q15, FIR_TAPS, FIRD_DECIM, 0, 0);
+    RunFIRDQ15(NULL);
+    error = BenchErrorQ15(output_q15, reference, FILTER_N / FIRD_DECIM, &peak);
+    BenchAdd("fird_s16", "ansi", FILTER_N / FIRD_DECIM, BenchTime(RunFIRDQ15, NULL), error, peak, Q15_BOUND);
+}
+
+static void BenchVector(void){
+    double peak, error;
+    // Dot product
+    BenchSignal(signal, DOT_N, 3);
+    BenchSignal(&signal[DOT_N], DOT_N, 4);
+    reference[0] = 0;
+    for (int i = 0; i < DOT_N; i++){
+        reference[0] += (double)signal[i] * signal[DOT_N + i];
+    }
+    RunDotprod(NULL);
+    error = BenchError(output, reference, 1, &peak);
+    BenchAdd("dotprod_f32", "ansi", DOT_N, BenchTime(RunDotprod, NULL), error, peak, BENCH_F32_BOUND);
+    reference[0] = 0;
+    for (int i = 0; i < 2 * DOT_N; i++){
+        signal_q15[i] = (int16_t)lrintf(signal[i] * DOT_Q15_SCALE);
+    }
+    for (int i = 0; i < DOT_N; i++){
+        reference[0] += (double)signal_q15[i] * signal_q15[DOT_N + i] / 32768;
+    }
+    const dotprod_s16_func_t dotprods[] = {dsps_dotprod_s16_ansi, dsps_dotprod_s16_rv32};
+    const char * variants[] = {"ansi", "rv32"};
+    for (uint8_t v = 0; v < 2; v++){
+        dotprod_s16 = dotprods[v];
+        RunDotprodQ15(NULL);
+        error = BenchErrorQ15(output_q15, reference, 1, &peak);
+        BenchAdd("dotprod_s16", variants[v], DOT_N, BenchTime(RunDotprodQ15, NULL), error, peak, Q15_BOUND);
+    }
+    // Convolution and correlation (coeffs holds the FIR low pass from BenchFilters)
+    BenchSignal(signal, CONV_N, 5);
+    for (int n = 0; n < CONV_N + CONV_K - 1; n++){
+        double acc = 0;
+        for (int k = 0; k < CONV_K; k++){
+            if (n - k >= 0 && n - k < CONV_N){
+                acc += (double)coeffs[k] * signal[n - k];
+            }
+        }
+        reference[n] = acc;
+    }
+    RunConv(NULL);
+    error = BenchError(output, reference, CONV_N + CONV_K - 1, &peak);
+    BenchAdd("conv_f32", "ansi", CONV_N + CONV_K - 1, BenchTime(RunConv, NULL), error, peak, BENCH_F32_BOUND);
+    for (int n = 0; n <= CONV_N - CONV_K; n++){
+        double acc = 0;
+        for (int k = 0; k < CONV_K; k++){
+            acc += (double)coeffs[k] * signal[n + k];
+        }
+        reference[n] = acc;
+    }
+    RunCorr(NULL);
+    error = BenchError(output, reference, CONV_N - CONV_K + 1, &peak);
+    BenchAdd("corr_f32", "ansi", CONV_N - CONV_K + 1, BenchTime(RunCorr, NULL), error, peak, BENCH_F32_BOUND);
+    // Matrix functions (outputs are the samples)
+    BenchSignal(signal, 2 * MAT_N * MAT_N, 6);
+    const float * a = signal;
+    const float * b = &signal[MAT_N * MAT_N];
+    for (int i = 0; i < MAT_N; i++){
+        for (int j = 0; j < MAT_N; j++){
+            double acc = 0;
+            for (int k = 0; k < MAT_N; k++){
+                acc += (double)a[i * MAT_N + k] * b[k * MAT_N + j];
+            }
+            reference[i * MAT_N + j] = acc;
+        }
+    }
+    RunMatMult(NULL);
+    error = BenchError(output, reference, MAT_N * MAT_N, &peak);
+    BenchAdd("dspm_mult_f32", "ansi", MAT_N * MAT_N, BenchTime(RunMatMult, NULL), error, peak, BENCH_F32_BOUND);
+    for (int i = 0; i < MAT_N * MAT_N; i++){
+        reference[i] = (double)a[i] + b[i];
+    }
+    RunMatAdd(NULL);
+    error = BenchError(output, reference, MAT_N * MAT_N, &peak);
+    BenchAdd("dspm_add_f32", "ansi", MAT_N * MAT_N, BenchTime(RunMatAdd, NULL), error, peak, BENCH_F32_BOUND);
+}
+
+/*==================[external functions definition]==========================*/
+void BenchDsp(void){
+    BenchFFT();
+    BenchFilters();
+    BenchVector();
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,121 @@
+/**
+ * @file bench_ekf.cpp
+ * @brief Host benchmark of the esp-dsp ekf_imu13states filter step
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "bench.h"
+#include "ekf_imu13states.h"
+/*==================[macros and definitions]=================================*/
+#define EKF_STEPS       2000        /*!< Steps of the input sequence */
+#define EKF_DT          0.002f      /*!< Step time (s), 500 Hz */
+#define EKF_STATES      13          /*!< States of the filter */
+#define EKF_R           0.01f       /*!< Measurement noise variance */
+
+/**
+ * @brief Filter with the dense prediction of the reference methods (temporary matrices, dense products)
+ */
+class ekf_imu13states_ref: public ekf_imu13states {
+public:
+    virtual void Process(float *u, float dt)
+    {
+        this->LinearizeFG(this->X, u);
+        this->RungeKuttaRef(this->X, u, dt);
+        this->CovariancePredictionRef(dt);
+    }
+};
+/*==================[internal data declaration]==============================*/
+static float gyro[EKF_STEPS][3];
+static float accel[EKF_STEPS][3];
+static float magn[EKF_STEPS][3];
+static ekf_imu13states * filter;
+static ekf_imu13states * filter_ref;
+static uint32_t step;
+/*==================[internal functions declaration]=========================*/
+/** @brief Gyroscope, accelerometer and magnetometer of a body rotating around the three axes */
+static void MakeInputs(void);
+
+/** @brief Filter step: prediction with the gyroscope and update with the accelerometer and magnetometer */
+static void FilterStep(ekf_imu13states * ekf13, uint32_t n);
+
+static void RunStep(void * arg);
+static void RunStepRef(void * arg);
+/*==================[internal functions definition]==========================*/
+static void MakeInputs(void){
+    const float gyro_err[3] = {0.1f, 0.2f, 0.3f};   // static gyroscope bias
+    float accel0_data[] = {0, 0, 1};
+    float magn0_data[] = {1, 0, 0};
+    dspm::Mat accel0(accel0_data, 3, 1);
+    dspm::Mat magn0(magn0_data, 3, 1);
+    dspm::Mat Rm = dspm::Mat::eye(3);
+    for (uint32_t n = 0; n < EKF_STEPS; n++){
+        float angle[3];
+        for (int i = 0; i < 3; i++){
+            float rate = (i + 1) * 0.5f * sinf(2 * M_PI * (0.2f + 0.1f * i) * n * EKF_DT);
+            gyro[n][i] = rate + gyro_err[i];
+            angle[i] = rate * EKF_DT;
+        }
+        Rm = Rm * ekf::eul2rotm(angle);
+        // accelerometer and magnetometer rotate to the opposite direction
+        dspm::Mat accel_data = Rm.t() * accel0;
+        dspm::Mat magn_data = Rm.t() * magn0;
+        accel_data /= accel_data.norm();
+        magn_data /= magn_data.norm();
+        for (int i = 0; i < 3; i++){
+            accel[n][i] = accel_data.data[i];
+            magn[n][i] = magn_data.data[i];
+        }
+    }
+}
+
+static void FilterStep(ekf_imu13states * ekf13, uint32_t n){
+    float R[6] = {EKF_R, EKF_R, EKF_R, EKF_R, EKF_R, EKF_R};
+    ekf13->Process(gyro[n], EKF_DT);
+    ekf13->UpdateRefMeasurement(accel[n], magn[n], R);
+}
+
+static void RunStep(void * arg){
+    FilterStep(filter, step);
+    step = (step + 1) % EKF_STEPS;
+}
+
+static void RunStepRef(void * arg){
+    FilterStep(filter_ref, step);
+    step = (step + 1) % EKF_STEPS;
+}
+
+/*==================[external functions definition]==========================*/
+void BenchEkf(void){
+    double reference[EKF_STATES];
+    double peak, error;
+    MakeInputs();
+    filter = new ekf_imu13states();
+    filter_ref = new ekf_imu13states_ref();
+    filter->Init();
+    filter_ref->Init();
+    // Same input sequence on both filters, the state is compared at the end
+    for (uint32_t n = 0; n < EKF_STEPS; n++){
+        FilterStep(filter, n);
+        FilterStep(filter_ref, n);
+    }
+    for (int i = 0; i < EKF_STATES; i++){
+        reference[i] = filter_ref->X.data[i];
+    }
+    error = BenchError(filter->X.data, reference, EKF_STATES, &peak);
+    step = 0;
+    BenchAdd("ekf13 step", "sparse", 1, BenchTime(RunStep, NULL), error, peak, BENCH_F32_BOUND);
+    BenchSetAllocations(BenchCountAllocations(RunStep, NULL));
+    step = 0;
+    BenchAdd("ekf13 step", "dense", 1, BenchTime(RunStepRef, NULL), 0, 0, BENCH_F32_BOUND);
+    BenchSetAllocations(BenchCountAllocations(RunStepRef, NULL));
+    delete filter;
+    delete filter_ref;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,259 @@
+/**
+ * @file bench_mat.cpp
+ * @brief Host benchmarks of the esp-dsp dspm::Mat operators
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <string.h>
+#include "bench.h"
+#include "mat.h"
+/*==================[macros and definitions]=================================*/
+#define MAT_SIZE        8       /*!< Size of the multiplied matrices */
+#define INV_SIZE        6       /*!< Size of the inverted matrix (e.g. EKF covariance blocks) */
+/*==================[internal data declaration]==============================*/
+static float data_a[MAT_SIZE * MAT_SIZE];
+static float data_b[MAT_SIZE * MAT_SIZE];
+static float data_inv[INV_SIZE * INV_SIZE];
+static double reference[MAT_SIZE * MAT_SIZE];
+static float result[MAT_SIZE * MAT_SIZE];
+static float result_operator[MAT_SIZE * MAT_SIZE];
+/*==================[internal functions declaration]=========================*/
+static void RunMult(void * arg);
+static void RunMultInto(void * arg);
+static void RunMultFixed(void * arg);
+static void RunMultTrans(void * arg);
+static void RunMultTransInto(void * arg);
+static void RunAdd(void * arg);
+static void RunAddInto(void * arg);
+static void RunTranspose(void * arg);
+static void RunTransposeInto(void * arg);
+static void RunInverse(void * arg);
+
+/** @brief Copy a matrix to the result array */
+static void MatStore(const dspm::Mat & m);
+
+/** @brief Save the result of an operator to compare it with the destination variant */
+static void SaveOperator(void);
+
+/** @brief Check that the destination variant gives exactly the same result as the operator */
+static void CheckIdentical(const char * name, uint32_t lenght);
+
+/** @brief Store the heap allocations of a destination variant, which must not allocate */
+static void CheckAllocationFree(const char * name, bench_func_t func);
+/*==================[internal functions definition]==========================*/
+static void SaveOperator(void){
+    memcpy(result_operator, result, sizeof(result));
+}
+
+static void CheckIdentical(const char * name, uint32_t lenght){
+    if (memcmp(result, result_operator, lenght * sizeof(float)) != 0){
+        BenchFail(name, "result differs from the operator");
+    }
+}
+
+static void CheckAllocationFree(const char * name, bench_func_t func){
+    int32_t allocations = BenchCountAllocations(func, NULL);
+    BenchSetAllocations(allocations);
+    if (allocations != 0){
+        BenchFail(name, "allocates heap memory");
+    }
+}
+
+static void MatStore(const dspm::Mat & m){
+    for (int i = 0; i < m.rows; i++){
+        for (int j = 0; j < m.cols; j++){
+            result[i * m.cols + j] = m.data[i * m.stride + j];
+        }
+    }
+}
+
+static void RunMult(void * arg){
+    dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    dspm::Mat b(data_b, MAT_SIZE, MAT_SIZE);
+    dspm::Mat c = a * b;
+    MatStore(c);
+}
+
+static void RunMultInto(void * arg){
+    static dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    static dspm::Mat b(data_b, MAT_SIZE, MAT_SIZE);
+    static dspm::Mat c(result, MAT_SIZE, MAT_SIZE);
+    dspm::Mat::mulInto(a, b, c);
+}
+
+static void RunMultFixed(void * arg){
+    static dspm::MatFixed<MAT_SIZE, MAT_SIZE> a, b, c;
+    memcpy(a.data, data_a, sizeof(data_a));
+    memcpy(b.data, data_b, sizeof(data_b));
+    dspm::Mat::mulInto(a, b, c);
+    MatStore(c);
+}
+
+static void RunMultTrans(void * arg){
+    dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    dspm::Mat b(data_b, MAT_SIZE, MAT_SIZE);
+    dspm::Mat c = a * b.t();
+    MatStore(c);
+}
+
+static void RunMultTransInto(void * arg){
+    static dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    static dspm::Mat b(data_b, MAT_SIZE, MAT_SIZE);
+    static dspm::Mat c(result, MAT_SIZE, MAT_SIZE);
+    dspm::Mat::mulTransInto(a, b, c);
+}
+
+static void RunAdd(void * arg){
+    dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    dspm::Mat b(data_b, MAT_SIZE, MAT_SIZE);
+    dspm::Mat c = a + b;
+    MatStore(c);
+}
+
+static void RunAddInto(void * arg){
+    static dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    static dspm::Mat b(data_b, MAT_SIZE, MAT_SIZE);
+    static dspm::Mat c(result, MAT_SIZE, MAT_SIZE);
+    dspm::Mat::addInto(a, b, c);
+}
+
+static void RunTranspose(void * arg){
+    dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    dspm::Mat c = a.t();
+    MatStore(c);
+}
+
+static void RunTransposeInto(void * arg){
+    static dspm::Mat a(data_a, MAT_SIZE, MAT_SIZE);
+    static dspm::Mat c(result, MAT_SIZE, MAT_SIZE);
+    dspm::Mat::transposeInto(a, c);
+}
+
+static void RunInverse(void * arg){
+    dspm::Mat a(data_inv, INV_SIZE, INV_SIZE);
+    dspm::Mat c = a.inverse();
+    MatStore(c);
+}
+
+/*==================[external functions definition]==========================*/
+void BenchMat(void){
+    double peak, error;
+    BenchSignal(data_a, MAT_SIZE * MAT_SIZE, 9);
+    BenchSignal(data_b, MAT_SIZE * MAT_SIZE, 10);
+    // Multiplication
+    for (int i = 0; i < MAT_SIZE; i++){
+        for (int j = 0; j < MAT_SIZE; j++){
+            double acc = 0;
+            for (int k = 0; k < MAT_SIZE; k++){
+                acc += (double)data_a[i * MAT_SIZE + k] * data_b[k * MAT_SIZE + j];
+            }
+            reference[i * MAT_SIZE + j] = acc;
+        }
+    }
+    RunMult(NULL);
+    SaveOperator();
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat operator*", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunMult, NULL), error, peak, BENCH_F32_BOUND);
+    BenchSetAllocations(BenchCountAllocations(RunMult, NULL));
+    RunMultInto(NULL);
+    CheckIdentical("Mat mulInto", MAT_SIZE * MAT_SIZE);
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat mulInto", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunMultInto, NULL), error, peak, BENCH_F32_BOUND);
+    CheckAllocationFree("Mat mulInto", RunMultInto);
+    RunMultFixed(NULL);
+    CheckIdentical("MatFixed mulInto", MAT_SIZE * MAT_SIZE);
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("MatFixed mulInto", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunMultFixed, NULL), error, peak, BENCH_F32_BOUND);
+    CheckAllocationFree("MatFixed mulInto", RunMultFixed);
+    // Multiplication by a transposed matrix
+    for (int i = 0; i < MAT_SIZE; i++){
+        for (int j = 0; j < MAT_SIZE; j++){
+            double acc = 0;
+            for (int k = 0; k < MAT_SIZE; k++){
+                acc += (double)data_a[i * MAT_SIZE + k] * data_b[j * MAT_SIZE + k];
+            }
+            reference[i * MAT_SIZE + j] = acc;
+        }
+    }
+    RunMultTrans(NULL);
+    SaveOperator();
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat operator* t", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunMultTrans, NULL), error, peak, BENCH_F32_BOUND);
+    BenchSetAllocations(BenchCountAllocations(RunMultTrans, NULL));
+    RunMultTransInto(NULL);
+    CheckIdentical("Mat mulTransInto", MAT_SIZE * MAT_SIZE);
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat mulTransInto", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunMultTransInto, NULL), error, peak, BENCH_F32_BOUND);
+    CheckAllocationFree("Mat mulTransInto", RunMultTransInto);
+    // Addition
+    for (int i = 0; i < MAT_SIZE * MAT_SIZE; i++){
+        reference[i] = (double)data_a[i] + data_b[i];
+    }
+    RunAdd(NULL);
+    SaveOperator();
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat operator+", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunAdd, NULL), error, peak, BENCH_F32_BOUND);
+    BenchSetAllocations(BenchCountAllocations(RunAdd, NULL));
+    RunAddInto(NULL);
+    CheckIdentical("Mat addInto", MAT_SIZE * MAT_SIZE);
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat addInto", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunAddInto, NULL), error, peak, BENCH_F32_BOUND);
+    CheckAllocationFree("Mat addInto", RunAddInto);
+    // Transpose
+    for (int i = 0; i < MAT_SIZE; i++){
+        for (int j = 0; j < MAT_SIZE; j++){
+            reference[j * MAT_SIZE + i] = data_a[i * MAT_SIZE + j];
+        }
+    }
+    RunTranspose(NULL);
+    SaveOperator();
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat t", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunTranspose, NULL), error, peak, BENCH_F32_BOUND);
+    BenchSetAllocations(BenchCountAllocations(RunTranspose, NULL));
+    RunTransposeInto(NULL);
+    CheckIdentical("Mat transposeInto", MAT_SIZE * MAT_SIZE);
+    error = BenchError(result, reference, MAT_SIZE * MAT_SIZE, &peak);
+    BenchAdd("Mat transposeInto", "ansi", MAT_SIZE * MAT_SIZE, BenchTime(RunTransposeInto, NULL), error, peak, BENCH_F32_BOUND);
+    CheckAllocationFree("Mat transposeInto", RunTransposeInto);
+    // Inverse of a diagonally dominant matrix, checked with Gauss-Jordan in double precision
+    BenchSignal(data_inv, INV_SIZE * INV_SIZE, 11);
+    double m[INV_SIZE][2 * INV_SIZE];
+    for (int i = 0; i < INV_SIZE; i++){
+        data_inv[i * INV_SIZE + i] += INV_SIZE;
+        for (int j = 0; j < INV_SIZE; j++){
+            m[i][j] = data_inv[i * INV_SIZE + j];
+            m[i][INV_SIZE + j] = (i == j) ? 1 : 0;
+        }
+    }
+    for (int i = 0; i < INV_SIZE; i++){
+        double p = m[i][i];
+        for (int j = 0; j < 2 * INV_SIZE; j++){
+            m[i][j] /= p;
+        }
+        for (int r = 0; r < INV_SIZE; r++){
+            if (r != i){
+                double f = m[r][i];
+                for (int j = 0; j < 2 * INV_SIZE; j++){
+                    m[r][j] -= f * m[i][j];
+                }
+            }
+        }
+    }
+    for (int i = 0; i < INV_SIZE; i++){
+        for (int j = 0; j < INV_SIZE; j++){
+            reference[i * INV_SIZE + j] = m[i][INV_SIZE + j];
+        }
+    }
+    RunInverse(NULL);
+    error = BenchError(result, reference, INV_SIZE * INV_SIZE, &peak);
+    BenchAdd("Mat inverse", "ansi", INV_SIZE * INV_SIZE, BenchTime(RunInverse, NULL), error, peak, BENCH_F32_BOUND);
+    BenchSetAllocations(BenchCountAllocations(RunInverse, NULL));
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,813 @@
+/**
+ * @file bench_middleware.c
+ * @brief Host benchmarks of the signal processing middleware
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "bench.h"
+#include "fft.h"
+#include "iir_filter.h"
+#include "fir_filter.h"
+#include "tone_tracking.h"
+#include "welch.h"
+#include "qrs_detector.h"
+#include "decimator.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define FFT_LENGHT      1024    /*!< Real samples of FFTMagnitude */
+#define FILTER_LENGHT   4096    /*!< Samples of each LowPassFilter call */
+#define ADC_SCALE       2000    /*!< Amplitude of the 12 bit test signal */
+#define FFT_Q15_BOUND   2e-3    /*!< Relative error bound of FFTMagnitudeQ15 (magnitude resolution of 1 ADC count) */
+#define FFT_TONE_BIN    101     /*!< Bin of the 12 bit tone of the SNR and SFDR checks (prime with FFT_LENGHT) */
+#define FFT_F32_DB_LOSS 0.5     /*!< Maximun SNR and SFDR loss of FFTMagnitude against dsps_snr_f32 and dsps_sfdr_f32 (dB) */
+#define FFT_Q15_DB_LOSS 3       /*!< Maximun SNR loss of FFTMagnitudeQ15 (dB) */
+#define FFT_Q15_SFDR    66      /*!< Minimun SFDR of FFTMagnitudeQ15 (dB), its spurs are below 1 ADC count */
+#define FIR_DIRECT_TAPS 31      /*!< Taps of the direct form FIR filter */
+#define FIR_FFT_TAPS    255     /*!< Taps of the FFT convolution FIR filter */
+#define GOERTZEL_BOUND  2e-4    /*!< Relative error bound of the Goertzel bank (float recursion over a block) */
+#define SDFT_BOUND      1e-2    /*!< Relative error bound of the sliding DFT (window weighted by the damping) */
+#define SDFT_WINDOWS    1000    /*!< Windows of each long run of the sliding DFT (rounding errors must not accumulate) */
+#define WELCH_LENGHT    256     /*!< FFT lenght of the Welch estimator */
+#define WELCH_ROWS      4       /*!< Spectrogram rows of the Welch estimator */
+#define ECG_FREC        360     /*!< Sample frequency of the synthetic ECG (Hz) */
+#define ECG_LENGHT      7200    /*!< Samples of the synthetic ECG (20 s) */
+#define ECG_MAX_BEATS   32
+#define ECG_TOLERANCE   18      /*!< Maximun distance of a detected beat to its R peak (50 ms) */
+#define ECG_SKIPPED     1000    /*!< Samples between NaN samples */
+#define ECG_TABLE_FREC  250     /*!< guia2_ej4 writes an ecg[] sample to the DAC every 4 ms */
+#define ECG_TABLE_BEAT  255     /*!< guia2_ej4 replays 255 of the 256 ecg[] samples, one beat */
+#define ECG_TABLE_TIME  60      /*!< Seconds of the ecg[] replay */
+#define ECG_TABLE_BEATS 57      /*!< Beats of the ecg[] replay, after the learning period */
+#define ECG_TABLE_HR    (60.0 * ECG_TABLE_FREC / ECG_TABLE_BEAT)  /*!< Heart rate of the ecg[] replay (58.8 bpm) */
+#define ECG_HR_TOLERANCE    0.5     /*!< Maximun heart rate error (bpm) */
+#define ADC_MID         2048    /*!< Mid scale of the 12 bit ADC */
+#define IIR_CHANNELS    IIR_MAX_CHANNELS
+#define DECIMATOR_STAGES    2
+#define DECIMATOR_SHIFT     3       /*!< 12 bit samples to Q15, with headroom for the filter overshoot */
+#define DECIMATOR_Q15_BOUND 1e-3    /*!< Relative error bound of the Q15 decimator (coefficients and outputs rounded) */
+/*==================[internal data declaration]==============================*/
+static float signal[FILTER_LENGHT];
+static float work[FILTER_LENGHT];
+static float output[FILTER_LENGHT];
+static int16_t signal_adc[FFT_LENGHT];
+static uint16_t output_adc[FFT_LENGHT / 2];
+static double reference[FILTER_LENGHT];
+static float fir_coeffs[FIR_MAX_TAPS];
+static fir_filter_t fir_filter;
+static fir_f32_t fir_ansi;
+static goertzel_t goertzel;
+static sdft_t sdft;
+static welch_t welch;
+static float ecg[ECG_LENGHT];
+static qrs_detector_t qrs;
+static qrs_beat_t beats[ECG_MAX_BEATS];
+/** ecg[] table of projects/guia2_ej4, replayed through AnalogOutputWrite */
+static const uint8_t ecg_table[ECG_TABLE_BEAT + 1] = {
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18,
+    18, 18, 18, 17, 17, 16, 16, 16, 16, 17, 17, 18, 18, 18, 17, 17, 17, 17, 18, 18, 19, 21, 22, 24, 25,
+    26, 27, 28, 29, 31, 32, 33, 34, 34, 35, 37, 38, 37, 34, 29, 24, 19, 15, 14, 15, 16, 17, 17, 17, 16,
+    15, 14, 13, 13, 13, 13, 13, 13, 13, 12, 12, 10, 6, 2, 3, 15, 43, 88, 145, 199, 237, 252, 242, 211,
+    167, 117, 70, 35, 16, 14, 22, 32, 38, 37, 32, 27, 24, 24, 26, 27, 28, 28, 27, 28, 28, 30, 31, 31,
+    31, 32, 33, 34, 36, 38, 39, 40, 41, 42, 43, 45, 47, 49, 51, 53, 55, 57, 60, 62, 65, 68, 71, 75, 79,
+    83, 87, 92, 97, 101, 106, 111, 116, 121, 125, 129, 133, 136, 138, 139, 140, 140, 139, 137, 133, 129,
+    123, 117, 109, 101, 92, 84, 77, 70, 64, 58, 52, 47, 42, 39, 36, 34, 31, 30, 28, 27, 26, 25, 25, 25,
+    25, 25, 25, 25, 25, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 23,
+    23, 22, 22, 21, 21, 21, 20, 20, 20, 20, 20, 19, 19, 18, 18, 18, 19, 19, 19, 19, 18, 17, 17, 18, 18,
+    18, 18, 18, 18, 18, 18, 17, 17, 17, 17, 17, 17, 17
+};
+static uint8_t beats_count;
+static uint16_t adc[FILTER_LENGHT];
+static int16_t output_q15[FILTER_LENGHT];
+static decimator_t decimator;
+static const uint8_t decimator_factors[DECIMATOR_STAGES] = {4, 2};
+static iir_filter_t iir_filter;
+/*==================[internal functions declaration]=========================*/
+/** @brief Double precision FFTMagnitude (Hann window, same scale) */
+static void ReferenceMagnitude(const double * x, double * mag, int n);
+
+/** @brief Low pass FIR filter at fs / 10 (Hann windowed sinc) */
+static void DesignLowPass(float * h, uint16_t taps);
+
+/** @brief Double precision magnitude of DFT bin k, periodic Hann window (as the sliding DFT) and FFTMagnitude scale */
+static double ReferenceBin(const double * x, int n, int k);
+
+/** @brief Double precision FIR filter */
+static void DesignLowPass(float * h, uint16_t taps){
+    for (int i = 0; i < taps; i++){
+        double t = i - (taps - 1) / 2.0;
+        double w = 0.5 - 0.5 * cos(2 * M_PI * i / (taps - 1));
+        h[i] = (float)(0.2 * (t == 0 ? 1 : sin(M_PI * 0.2 * t) / (M_PI * 0.2 * t)) * w);
+    }
+}
+
+static double ReferenceBin(const double * x, int n, int k){
+    double re = 0, im = 0;
+    for (int i = 0; i < n; i++){
+        double w = 0.5 - 0.5 * cos(2 * M_PI * i / n);
+        re += x[i] * w * cos(2 * M_PI * ((long)k * i % n) / n);
+        im -= x[i] * w * sin(2 * M_PI * ((long)k * i % n) / n);
+    }
+    return sqrt(re * re + im * im) * ((k == 0) ? 2.0 : 8.0) / n;
+}
+
+static void ReferenceFIR(const float * h, uint16_t taps, const float * x, double * y, int n);
+
+/** @brief SNR and SFDR (dB) of a tone from its magnitude spectrum, as dsps_snr_f32 and dsps_sfdr_f32 (without DC) */
+static void SpectrumQuality(const float * mag, uint16_t bins, double * snr, double * sfdr);
+
+static void RunFFTMagnitude(void * arg);
+static void RunFFTMagnitudeQ15(void * arg);
+static void RunLowPass(void * arg);
+static void RunBiquadCascade(void * arg);
+static void RunIIRChannels(void * arg);
+static void RunFIRFilter(void * arg);
+static void RunFIRAnsi(void * arg);
+static void RunGoertzel(void * arg);
+static void RunSlidingDFT(void * arg);
+static void RunWelch(void * arg);
+static void RunQRSDetector(void * arg);
+static void RunDecimator(void * arg);
+
+/** @brief SNR and SFDR of a 12 bit tone on FFTMagnitude and FFTMagnitudeQ15 against esp-dsp, invalid lenghts */
+static void BenchFFTQuality(void);
+
+/** @brief IIRFilterApply against the esp-dsp biquads, and with interleaved channels */
+static void BenchIIRFilter(void);
+
+/** @brief FIRFilterApply in direct form and with FFT convolution, in one call and in blocks, and both engines against dsps_fir_f32_ansi from 32 to FIR_MAX_TAPS taps */
+static void BenchFIRFilter(void);
+
+/** @brief Goertzel banks and sliding DFTs of 1 to TONE_MAX_BINS frequencies against the DFT, sliding DFT drift */
+static void BenchGoertzel(void);
+
+/** @brief Welch average and spectrogram rows (75% overlap) against the DFT of each hop */
+static void BenchWelch(void);
+
+/** @brief Synthetic ECG with known R peaks, its beats count and the number of samples */
+static uint16_t SyntheticECG(uint32_t * r_peaks);
+
+/** @brief QRS detector on a synthetic ECG (missed and extra beats, NaN samples skipped) and on the guia2_ej4 ecg[] replay (beats and heart rate) */
+static void BenchQRSDetector(void);
+
+/** @brief Double precision decimator chain, with the coefficients quantized to Q15 or not */
+static uint16_t ReferenceDecimator(bool q15, double * y);
+
+/** @brief Float and Q15 decimator chains (x4, x2) against the reference, in one call and in blocks */
+static void BenchDecimator(void);
+/*==================[internal functions definition]==========================*/
+static void ReferenceMagnitude(const double * x, double * mag, int n){
+    for (int k = 0; k < n / 2; k++){
+        double re = 0, im = 0;
+        for (int i = 0; i < n; i++){
+            double w = 0.5 - 0.5 * cos(2 * M_PI * i / (n - 1));
+            re += x[i] * w * cos(2 * M_PI * ((long)k * i % n) / n);
+            im -= x[i] * w * sin(2 * M_PI * ((long)k * i % n) / n);
+        }
+        mag[k] = sqrt(re * re + im * im) * ((k == 0) ? 2.0 : 8.0) / n;
+    }
+}
+
+static void ReferenceFIR(const float * h, uint16_t taps, const float * x, double * y, int n){
+    for (int i = 0; i < n; i++){
+        double acc = 0;
+        for (int k = 0; k < taps && k <= i; k++){
+            acc += (double)h[k] * x[i - k];
+        }
+        y[i] = acc;
+    }
+}
+
+static void SpectrumQuality(const float * mag, uint16_t bins, double * snr, double * sfdr){
+    const uint16_t snr_width = 7, sfdr_width = 5;
+    uint16_t max_pos = 0;
+    double noise = 0, spur = 0;
+    for (uint16_t k = 0; k < bins; k++){
+        max_pos = (mag[k] > mag[max_pos]) ? k : max_pos;
+    }
+    for (uint16_t k = snr_width; k < bins; k++){
+        if (k + snr_width < max_pos || k > max_pos + snr_width){
+            noise += (double)mag[k] * mag[k];
+        }
+    }
+    for (uint16_t k = sfdr_width; k < bins; k++){
+        if ((k + sfdr_width < max_pos || k > max_pos + sfdr_width) && mag[k] > spur){
+            spur = mag[k];
+        }
+    }
+    // The same window correction as dsps_snr_f32
+    *snr = 10 * log10((double)mag[max_pos] * mag[max_pos] / noise) - 2;
+    *sfdr = 20 * log10(mag[max_pos] / spur);
+}
+
+static void RunFFTMagnitude(void * arg){
+    FFTMagnitude(signal, output, FFT_LENGHT);
+}
+
+static void RunFFTMagnitudeQ15(void * arg){
+    FFTMagnitudeQ15(signal_adc, output_adc, FFT_LENGHT);
+}
+
+static void BenchFFTQuality(void){
+    static float tone[FFT_LENGHT], mag_q15[FFT_LENGHT / 2];
+    const uint16_t invalid[] = {0, 2, 3, FFT_LENGHT - 1, 2 * MAX_SIGNAL_LENGHT};
+    double snr, sfdr, snr_q15, sfdr_q15;
+    // 12 bit tone: quantization noise only
+    for (int i = 0; i < FFT_LENGHT; i++){
+        signal_adc[i] = (int16_t)lrint(ADC_SCALE * sin(2 * M_PI * FFT_TONE_BIN * i / FFT_LENGHT));
+        tone[i] = signal_adc[i];
+    }
+    double snr_ref = dsps_snr_f32(tone, FFT_LENGHT, 0);
+    double sfdr_ref = dsps_sfdr_f32(tone, FFT_LENGHT, 0);
+    memcpy(work, tone, sizeof(tone));
+    FFTMagnitude(work, output, FFT_LENGHT);
+    SpectrumQuality(output, FFT_LENGHT / 2, &snr, &sfdr);
+    if (!FFTMagnitudeQ15(signal_adc, output_adc, FFT_LENGHT)){
+        BenchFail("FFTMagnitudeQ15", "valid lenght refused");
+        return;
+    }
+    for (int k = 0; k < FFT_LENGHT / 2; k++){
+        mag_q15[k] = output_adc[k];
+    }
+    SpectrumQuality(mag_q15, FFT_LENGHT / 2, &snr_q15, &sfdr_q15);
+    printf("%-24s SNR %.1f dB SFDR %.1f dB (esp-dsp %.1f dB, %.1f dB)\n", "FFTMagnitude tone", snr, sfdr, snr_ref, sfdr_ref);
+    printf("%-24s SNR %.1f dB SFDR %.1f dB\n", "FFTMagnitudeQ15 tone", snr_q15, sfdr_q15);
+    if (!(fabs(snr - snr_ref) <= FFT_F32_DB_LOSS && fabs(sfdr - sfdr_ref) <= FFT_F32_DB_LOSS)){
+        BenchFail("FFTMagnitude", "SNR or SFDR differs from dsps_snr_f32 or dsps_sfdr_f32");
+    }
+    if (!(snr_q15 >= snr_ref - FFT_Q15_DB_LOSS && sfdr_q15 >= FFT_Q15_SFDR)){
+        BenchFail("FFTMagnitudeQ15", "SNR loss or SFDR over the bound");
+    }
+    // Invalid lenghts are refused, then the plan is made again for a valid one
+    for (uint8_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++){
+        if (FFTMagnitudeQ15(signal_adc, output_adc, invalid[i])){
+            BenchFail("FFTMagnitudeQ15", "invalid lenght not refused");
+        }
+    }
+    bool same = FFTMagnitudeQ15(signal_adc, output_adc, FFT_LENGHT);
+    for (int k = 0; k < FFT_LENGHT / 2; k++){
+        same &= (output_adc[k] == mag_q15[k]);
+    }
+    if (!same){
+        BenchFail("FFTMagnitudeQ15", "magnitude changes after an invalid lenght");
+    }
+}
+
+static void RunLowPass(void * arg){
+    LowPassFilter(signal, output, FILTER_LENGHT);
+}
+
+static void RunBiquadCascade(void * arg){
+    float w[IIR_MAX_SECTIONS][2] = {{0}};
+    const float * in = signal;
+    for (uint8_t s = 0; s < iir_filter.sections; s++){
+        dsps_biquad_f32(in, work, FILTER_LENGHT, iir_filter.coeff[s], w[s]);
+        in = work;
+    }
+}
+
+static void RunIIRChannels(void * arg){
+    IIRFilterApply(&iir_filter, signal, output, FILTER_LENGHT / IIR_CHANNELS);
+}
+
+static void BenchIIRFilter(void){
+    static float channel[FILTER_LENGHT / IIR_CHANNELS];
+    const int16_t lenght = FILTER_LENGHT / IIR_CHANNELS;
+    double peak, error;
+    // The LowPassFilter signal and reference: 4th order Butterworth at fs / 20
+    IIRFilterInit(&iir_filter, IIR_LOW_PASS, 1000, 50, ORDER_4, 1);
+    IIRFilterApply(&iir_filter, signal, output, FILTER_LENGHT);
+    RunBiquadCascade(NULL);
+    error = BenchError(work, reference, FILTER_LENGHT, &peak);
+    BenchAdd("LowPassFilter", "esp-dsp", FILTER_LENGHT, BenchTime(RunBiquadCascade, NULL), error, peak, BENCH_F32_BOUND);
+    if (memcmp(work, output, FILTER_LENGHT * sizeof(float)) != 0){
+        BenchFail("LowPassFilter", "result differs from dsps_biquad_f32");
+    }
+    // Interleaved channels: each one as filtered alone
+    IIRFilterInit(&iir_filter, IIR_LOW_PASS, 1000, 50, ORDER_4, IIR_CHANNELS);
+    RunIIRChannels(NULL);
+    error = 0;
+    for (uint8_t c = 0; c < IIR_CHANNELS; c++){
+        iir_filter_t single;
+        IIRFilterInit(&single, IIR_LOW_PASS, 1000, 50, ORDER_4, 1);
+        for (int16_t n = 0; n < lenght; n++){
+            channel[n] = signal[n * IIR_CHANNELS + c];
+        }
+        IIRFilterApply(&single, channel, channel, lenght);
+        for (int16_t n = 0; n < lenght; n++){
+            error = fmax(error, fabs(channel[n] - output[n * IIR_CHANNELS + c]));
+        }
+    }
+    BenchAdd("IIRFilter 9 channels", "middleware", lenght * IIR_CHANNELS, BenchTime(RunIIRChannels, NULL), error, 0, 0);
+}
+
+static void RunFIRFilter(void * arg){
+    FIRFilterApply(&fir_filter, signal, output, FILTER_LENGHT);
+}
+
+static void RunFIRAnsi(void * arg){
+    dsps_fir_f32_ansi(&fir_ansi, signal, output, FILTER_LENGHT);
+}
+
+static void BenchFIRFilter(void){
+    const uint16_t taps[] = {FIR_DIRECT_TAPS, FIR_FFT_TAPS};
+    const char * names[] = {"FIRFilter direct", "FIRFilter FFT"};
+    // Block sizes of a streaming acquisition, not aligned to the FFT blocks
+    const int16_t blocks[] = {1, 7, 64, 100, 333, 1000};
+    double peak, error;
+    BenchSignal(signal, FILTER_LENGHT, 12);
+    for (uint8_t f = 0; f < 2; f++){
+        DesignLowPass(fir_coeffs, taps[f]);
+        ReferenceFIR(fir_coeffs, taps[f], signal, reference, FILTER_LENGHT);
+        if (!FIRFilterInit(&fir_filter, fir_coeffs, taps[f])){
+            BenchFail(names[f], "not initialized");
+            continue;
+        }
+        // Outputs are delayed by the block latency
+        uint16_t latency = FIRFilterLatency(&fir_filter);
+        RunFIRFilter(NULL);
+        error = BenchError(&output[latency], reference, FILTER_LENGHT - latency, &peak);
+        memcpy(work, output, sizeof(work));
+        BenchAdd(names[f], "middleware", FILTER_LENGHT, BenchTime(RunFIRFilter, NULL), error, peak, BENCH_F32_BOUND);
+        // The same signal filtered in blocks of any size gives the same outputs
+        FIRFilterDeinit(&fir_filter);
+        FIRFilterInit(&fir_filter, fir_coeffs, taps[f]);
+        for (int i = 0, b = 0; i < FILTER_LENGHT; i += blocks[b], b = (b + 1) % (sizeof(blocks) / sizeof(blocks[0]))){
+            int16_t lenght = (FILTER_LENGHT - i < blocks[b]) ? FILTER_LENGHT - i : blocks[b];
+            FIRFilterApply(&fir_filter, &signal[i], &output[i], lenght);
+        }
+        if (memcmp(work, output, sizeof(work)) != 0){
+            BenchFail(names[f], "outputs depend on the block size");
+        }
+        FIRFilterDeinit(&fir_filter);
+    }
+    // Tap sweep: both engines and esp-dsp, to find the crossover of FIR_FFT_MIN_TAPS
+    static float reversed[FIR_MAX_TAPS], delay[FIR_MAX_TAPS + 4];
+    const char * sweep_names[] = {"FIR 32 taps", "FIR 64 taps", "FIR 128 taps", "FIR 256 taps", "FIR 512 taps", "FIR 1024 taps"};
+    const fir_engine_t engines[] = {FIR_ENGINE_DIRECT, FIR_ENGINE_FFT};
+    const char * engine_names[] = {"direct", "fft"};
+    for (uint8_t t = 0; t < sizeof(sweep_names) / sizeof(sweep_names[0]); t++){
+        uint16_t sweep_taps = 32 << t;
+        DesignLowPass(fir_coeffs, sweep_taps);
+        ReferenceFIR(fir_coeffs, sweep_taps, signal, reference, FILTER_LENGHT);
+        for (uint8_t e = 0; e < 2; e++){
+            if (!FIRFilterInitEngine(&fir_filter, fir_coeffs, sweep_taps, engines[e])){
+                BenchFail(sweep_names[t], "not initialized");
+                continue;
+            }
+            uint16_t latency = FIRFilterLatency(&fir_filter);
+            RunFIRFilter(NULL);
+            error = BenchError(&output[latency], reference, FILTER_LENGHT - latency, &peak);
+            BenchAdd(sweep_names[t], engine_names[e], FILTER_LENGHT, BenchTime(RunFIRFilter, NULL), error, peak, BENCH_F32_BOUND);
+            FIRFilterDeinit(&fir_filter);
+        }
+        // esp-dsp applies coeffs[0] to the oldest sample
+        for (int i = 0; i < sweep_taps; i++){
+            reversed[i] = fir_coeffs[sweep_taps - 1 - i];
+        }
+        dsps_fir_init_f32(&fir_ansi, reversed, delay, sweep_taps);
+        RunFIRAnsi(NULL);
+        error = BenchError(output, reference, FILTER_LENGHT, &peak);
+        BenchAdd(sweep_names[t], "ansi", FILTER_LENGHT, BenchTime(RunFIRAnsi, NULL), error, peak, BENCH_F32_BOUND);
+    }
+}
+
+static void RunGoertzel(void * arg){
+    for (int i = 0; i < FFT_LENGHT; i++){
+        GoertzelUpdate(&goertzel, signal[i]);
+    }
+}
+
+static void RunSlidingDFT(void * arg){
+    for (int i = 0; i < FFT_LENGHT; i++){
+        SlidingDFTUpdate(&sdft, signal[i]);
+    }
+}
+
+static void BenchGoertzel(void){
+    static double x[FFT_LENGHT];
+    const char * variants[] = {"1 bin", "2 bins", "4 bins", "8 bins", "16 bins", "32 bins"};
+    float freqs[TONE_MAX_BINS], magnitude[TONE_MAX_BINS];
+    double expected[TONE_MAX_BINS], peak, error;
+    uint8_t v = 0;
+    // One sample per second: the frequency of each DFT bin is its index
+    BenchSignal(signal, FFT_LENGHT, 21);
+    for (int i = 0; i < FFT_LENGHT; i++){
+        x[i] = signal[i];
+    }
+    ReferenceMagnitude(x, reference, FFT_LENGHT);
+    for (uint8_t i = 0; i < TONE_MAX_BINS; i++){
+        freqs[i] = 3 + 15 * i;
+        expected[i] = reference[3 + 15 * i];
+    }
+    for (uint8_t bins = 1; bins <= TONE_MAX_BINS; bins++){
+        if (!GoertzelInit(&goertzel, FFT_LENGHT, freqs, bins, FFT_LENGHT)){
+            BenchFail("Goertzel bank", "not initialized");
+            return;
+        }
+        RunGoertzel(NULL);
+        GoertzelMagnitude(&goertzel, magnitude);
+        error = BenchError(magnitude, expected, bins, &peak);
+        if ((bins & (bins - 1)) == 0){
+            BenchAdd("Goertzel bank", variants[v++], FFT_LENGHT, BenchTime(RunGoertzel, NULL), error, peak, GOERTZEL_BOUND);
+        }
+        else if (!(error <= GOERTZEL_BOUND * peak)){
+            BenchFail("Goertzel bank", "error over the bound");
+        }
+    }
+    // An invalid frequency leaves the bank as it was
+    goertzel_t before = goertzel;
+    freqs[TONE_MAX_BINS / 2] = 0;
+    if (GoertzelInit(&goertzel, FFT_LENGHT, freqs, TONE_MAX_BINS, FFT_LENGHT / 2) ||
+        memcmp(&before, &goertzel, sizeof(goertzel)) != 0){
+        BenchFail("Goertzel bank", "invalid frequency modifies the bank");
+    }
+    // Sliding DFT of the same bins, after a window and after a long run of windows
+    freqs[TONE_MAX_BINS / 2] = 3 + 15 * (TONE_MAX_BINS / 2);
+    for (uint8_t i = 0; i < TONE_MAX_BINS; i++){
+        expected[i] = ReferenceBin(x, FFT_LENGHT, 3 + 15 * i);
+    }
+    v = 0;
+    for (uint8_t bins = 1; bins <= TONE_MAX_BINS; bins++){
+        if (!SlidingDFTInit(&sdft, FFT_LENGHT, freqs, bins, FFT_LENGHT)){
+            BenchFail("Sliding DFT", "not initialized");
+            return;
+        }
+        RunSlidingDFT(NULL);
+        SlidingDFTMagnitude(&sdft, magnitude);
+        error = BenchError(magnitude, expected, bins, &peak);
+        if ((bins & (bins - 1)) == 0){
+            BenchAdd("Sliding DFT", variants[v++], FFT_LENGHT, BenchTime(RunSlidingDFT, NULL), error, peak, SDFT_BOUND);
+        }
+        else if (!(error <= SDFT_BOUND * peak)){
+            BenchFail("Sliding DFT", "error over the bound");
+        }
+    }
+    // The signal repeats every window: in a long run the magnitudes stay those of the first window. 
+    // The damping bounds the rounding errors (settled in a few 1 / (1 - SDFT_DAMPING) samples)
+    double settled = 0;
+    for (uint8_t run = 0; run < 2; run++){
+        for (uint32_t w = 0; w < SDFT_WINDOWS; w++){
+            RunSlidingDFT(NULL);
+        }
+        SlidingDFTMagnitude(&sdft, magnitude);
+        error = BenchError(magnitude, expected, TONE_MAX_BINS, &peak);
+        if (!(error <= SDFT_BOUND * peak) || (run == 1 && !(error <= 1.1 * settled))){
+            BenchFail("Sliding DFT", "magnitudes drift in a long run");
+        }
+        settled = error;
+    }
+    // Invalid parameters leave the sliding DFT as it was
+    sdft_t sdft_before = sdft;
+    if (SlidingDFTInit(&sdft, FFT_LENGHT, NULL, TONE_MAX_BINS, FFT_LENGHT) ||
+        SlidingDFTInit(&sdft, 0, freqs, TONE_MAX_BINS, FFT_LENGHT) ||
+        SlidingDFTInit(&sdft, -1, freqs, TONE_MAX_BINS, FFT_LENGHT) ||
+        memcmp(&sdft_before, &sdft, sizeof(sdft)) != 0){
+        BenchFail("Sliding DFT", "invalid parameters modify the sliding DFT");
+    }
+    SlidingDFTDeinit(&sdft);
+}
+
+static void RunWelch(void * arg){
+    WelchUpdate(&welch, signal, FILTER_LENGHT);
+}
+
+static void BenchWelch(void){
+    static double x[WELCH_LENGHT], mag[WELCH_LENGHT / 2], average[WELCH_LENGHT / 2];
+    static float row[WELCH_LENGHT / 2], older[WELCH_LENGHT / 2];
+    const uint16_t hop = WELCH_LENGHT / WELCH_OVERLAP_75;
+    const uint16_t frames = (FILTER_LENGHT - WELCH_LENGHT) / hop + 1;
+    // Block sizes of a streaming acquisition, not aligned to the hops
+    const int16_t blocks[] = {1, 7, 64, 100, 333, 1000};
+    double peak, error, row_error = 0, row_peak = 0;
+    BenchSignal(signal, FILTER_LENGHT, 33);
+    memset(average, 0, sizeof(average));
+    for (uint16_t f = 0; f < frames; f++){
+        for (int i = 0; i < WELCH_LENGHT; i++){
+            x[i] = signal[f * hop + i];
+        }
+        ReferenceMagnitude(x, mag, WELCH_LENGHT);
+        for (int k = 0; k < WELCH_LENGHT / 2; k++){
+            average[k] += mag[k] * mag[k] / frames;
+        }
+        // Spectrogram rows of the last spectra
+        uint16_t age = frames - 1 - f;
+        if (age < WELCH_ROWS){
+            if (!WelchInit(&welch, WELCH_LENGHT, WELCH_OVERLAP_75, WELCH_ROWS)){
+                BenchFail("Welch", "not initialized");
+                return;
+            }
+            WelchUpdate(&welch, signal, FILTER_LENGHT);
+            if (!WelchSpectrogramRow(&welch, age, row)){
+                BenchFail("Welch", "spectrogram row not available");
+            }
+            error = BenchError(row, mag, WELCH_LENGHT / 2, &peak);
+            row_error = (error > row_error) ? error : row_error;
+            row_peak = (peak > row_peak) ? peak : row_peak;
+            WelchDeinit(&welch);
+        }
+    }
+    WelchInit(&welch, WELCH_LENGHT, WELCH_OVERLAP_75, WELCH_ROWS);
+    RunWelch(NULL);
+    error = BenchError(WelchAverage(&welch), average, WELCH_LENGHT / 2, &peak);
+    memcpy(work, WelchAverage(&welch), WELCH_LENGHT / 2 * sizeof(float));
+    BenchAdd("Welch average", "middleware", FILTER_LENGHT, BenchTime(RunWelch, NULL), error, peak, BENCH_F32_BOUND);
+    if (!(row_error <= BENCH_F32_BOUND * row_peak)){
+        BenchFail("Welch spectrogram", "error over the bound");
+    }
+    // A row is the same one spectrum later, and the rows overwritten are not available
+    WelchSpectrogramRow(&welch, 0, row);
+    memcpy(older, row, sizeof(row));
+    WelchUpdate(&welch, signal, hop);
+    WelchSpectrogramRow(&welch, 1, row);
+    if (memcmp(older, row, sizeof(row)) != 0){
+        BenchFail("Welch spectrogram", "row changes with its age");
+    }
+    WelchUpdate(&welch, signal, WELCH_ROWS * hop);
+    if (WelchSpectrogramRow(&welch, WELCH_ROWS, row)){
+        BenchFail("Welch spectrogram", "row older than the ring copied");
+    }
+    // Rows read in place (no copy) are the rows copied
+    uint16_t ring_head;
+    uint32_t ring_frames;
+    const float * ring = WelchSpectrogramRing(&welch, &ring_head, &ring_frames);
+    for (uint16_t age = 0; age < WELCH_ROWS; age++){
+        WelchSpectrogramRow(&welch, age, row);
+        if (ring == NULL || memcmp(row, &ring[((ring_head + WELCH_ROWS - 1 - age) % WELCH_ROWS) * (WELCH_LENGHT / 2)], sizeof(row)) != 0){
+            BenchFail("Welch spectrogram", "row in the ring differs from the row copied");
+            break;
+        }
+    }
+    // One spectrum later: the oldest row is overwritten, the newest one is still valid
+    memcpy(output, &ring[ring_head * (WELCH_LENGHT / 2)], sizeof(row));
+    WelchSpectrogramRow(&welch, 0, older);
+    WelchUpdate(&welch, signal, hop);
+    if (WelchFrames(&welch) - ring_frames != 1 || memcmp(output, &ring[ring_head * (WELCH_LENGHT / 2)], sizeof(row)) == 0){
+        BenchFail("Welch spectrogram", "oldest row of the ring not overwritten by a new spectrum");
+    }
+    if (memcmp(older, &ring[((ring_head + WELCH_ROWS - 1) % WELCH_ROWS) * (WELCH_LENGHT / 2)], sizeof(row)) != 0){
+        BenchFail("Welch spectrogram", "row of the ring changed before being overwritten");
+    }
+    WelchDeinit(&welch);
+    // The same signal added in blocks of any size gives the same average
+    WelchInit(&welch, WELCH_LENGHT, WELCH_OVERLAP_75, 0);
+    for (int i = 0, b = 0; i < FILTER_LENGHT; i += blocks[b], b = (b + 1) % (sizeof(blocks) / sizeof(blocks[0]))){
+        int16_t lenght = (FILTER_LENGHT - i < blocks[b]) ? FILTER_LENGHT - i : blocks[b];
+        WelchUpdate(&welch, &signal[i], lenght);
+    }
+    if (WelchFrames(&welch) != frames || memcmp(work, WelchAverage(&welch), WELCH_LENGHT / 2 * sizeof(float)) != 0){
+        BenchFail("Welch average", "outputs depend on the block size");
+    }
+    WelchDeinit(&welch);
+}
+
+static uint16_t SyntheticECG(uint32_t * r_peaks){
+    // P wave, Q, R, S and T wave: amplitude, time from the R peak and width (s)
+    const double waves[5][3] = {{0.15, -0.2, 0.025}, {-0.15, -0.03, 0.01}, {1, 0, 0.01}, {-0.25, 0.03, 0.01}, {0.3, 0.3, 0.05}};
+    uint32_t noise = 1;
+    uint16_t count = 0;
+    for (int i = 0; i < ECG_LENGHT; i++){
+        // Baseline wander and noise
+        noise = noise * 1664525 + 1013904223;
+        ecg[i] = 0.1 * sin(2 * M_PI * 0.3 * i / ECG_FREC) + 0.02 * ((double)(noise >> 8) / (1 << 24) - 0.5);
+    }
+    // Heart rate varying from 60 to 85 bpm
+    for (double t = 0.5; t < (double)ECG_LENGHT / ECG_FREC - 0.5; t += 0.85 + 0.15 * sin(count)){
+        r_peaks[count++] = lround(t * ECG_FREC);
+        for (int i = 0; i < ECG_LENGHT; i++){
+            for (uint8_t w = 0; w < 5; w++){
+                double d = ((double)i / ECG_FREC - t - waves[w][1]) / waves[w][2];
+                ecg[i] += waves[w][0] * exp(-d * d / 2);
+            }
+        }
+    }
+    return count;
+}
+
+static void RunQRSDetector(void * arg){
+    const bool * skipped = arg;
+    qrs_beat_t beat;
+    QRSDetectorInit(&qrs, ECG_FREC);
+    beats_count = 0;
+    for (int i = 0; i < ECG_LENGHT; i++){
+        if (skipped != NULL && *skipped && i % ECG_SKIPPED == 0 && QRSDetectorUpdate(&qrs, NAN, &beat)){
+            beats_count = ECG_MAX_BEATS;
+        }
+        if (QRSDetectorUpdate(&qrs, ecg[i], &beat) && beats_count < ECG_MAX_BEATS){
+            beats[beats_count++] = beat;
+        }
+    }
+}
+
+static void BenchQRSDetector(void){
+    static qrs_beat_t first[ECG_MAX_BEATS];
+    uint32_t r_peaks[ECG_MAX_BEATS];
+    uint16_t count = SyntheticECG(r_peaks);
+    uint8_t missed = 0, extra = 0, detected = 0, first_count;
+    bool skipped = false;
+    RunQRSDetector(&skipped);
+    // Beats after the learning period and before the end of the record (searchback latency)
+    for (uint16_t b = 0; b < count; b++){
+        if (r_peaks[b] < 2 * ECG_FREC || r_peaks[b] + ECG_FREC > ECG_LENGHT){
+            continue;
+        }
+        bool found = false;
+        for (uint8_t d = 0; d < beats_count; d++){
+            found |= (beats[d].sample + ECG_TOLERANCE >= r_peaks[b] && beats[d].sample <= r_peaks[b] + ECG_TOLERANCE);
+        }
+        missed += !found;
+        detected += found;
+    }
+    for (uint8_t d = 0; d < beats_count; d++){
+        bool found = false;
+        for (uint16_t b = 0; b < count; b++){
+            found |= (beats[d].sample + ECG_TOLERANCE >= r_peaks[b] && beats[d].sample <= r_peaks[b] + ECG_TOLERANCE);
+        }
+        extra += !found;
+    }
+    if (missed > 0 || extra > 0 || detected == 0){
+        BenchFail("QRSDetector", "beats missed or detected without a QRS");
+    }
+    // NaN samples are skipped without changing the beats
+    memcpy(first, beats, sizeof(beats));
+    first_count = beats_count;
+    skipped = true;
+    RunQRSDetector(&skipped);
+    if (beats_count != first_count || memcmp(first, beats, first_count * sizeof(qrs_beat_t)) != 0){
+        BenchFail("QRSDetector", "NaN samples change the beats");
+    }
+    skipped = false;
+    BenchAdd("QRSDetector", "middleware", ECG_LENGHT, BenchTime(RunQRSDetector, &skipped), 0, 0, 0);
+    // guia2_ej4 ecg[] replay: the table is written to the DAC from the start again after ECG_TABLE_BEAT samples
+    qrs_beat_t beat;
+    uint32_t table_beats = 0;
+    bool heart_rate = true;
+    QRSDetectorInit(&qrs, ECG_TABLE_FREC);
+    for (uint32_t i = 0; i < ECG_TABLE_TIME * ECG_TABLE_FREC; i++){
+        if (QRSDetectorUpdate(&qrs, ecg_table[i % ECG_TABLE_BEAT], &beat)){
+            heart_rate &= (table_beats == 0 || fabs(beat.heart_rate - ECG_TABLE_HR) <= ECG_HR_TOLERANCE);
+            table_beats++;
+        }
+    }
+    if (table_beats != ECG_TABLE_BEATS){
+        BenchFail("QRSDetector", "beats of the guia2_ej4 ecg[] replay");
+    }
+    if (!heart_rate){
+        BenchFail("QRSDetector", "heart rate of the guia2_ej4 ecg[] replay");
+    }
+}
+
+static uint16_t ReferenceDecimator(bool q15, double * y){
+    static double x[FILTER_LENGHT];
+    static float h[DECIMATOR_TAPS_PER_FACTOR * 8];
+    uint16_t lenght = FILTER_LENGHT;
+    double scale = q15 ? (1 << DECIMATOR_SHIFT) : 1;
+    for (int i = 0; i < FILTER_LENGHT; i++){
+        x[i] = ((int32_t)adc[i] - ADC_MID) * scale;
+    }
+    for (uint8_t s = 0; s < DECIMATOR_STAGES; s++){
+        uint8_t factor = decimator_factors[s];
+        uint16_t taps = DECIMATOR_TAPS_PER_FACTOR * factor - 1;
+        DecimatorDesign(h, taps, factor);
+        // Output i ends with input (i + 1) * factor - 1, the filter is symmetric
+        for (int i = 0; i < lenght / factor; i++){
+            double acc = 0;
+            for (int k = 0; k < taps && k < (i + 1) * factor; k++){
+                double c = q15 ? lroundf(h[k] * 32768.0f) / 32768.0 : h[k];
+                acc += c * x[(i + 1) * factor - 1 - k];
+            }
+            y[i] = acc;
+        }
+        lenght /= factor;
+        memcpy(x, y, lenght * sizeof(double));
+    }
+    return lenght;
+}
+
+static void RunDecimator(void * arg){
+    if (decimator.format == DECIMATOR_FLOAT){
+        DecimatorProcess(&decimator, adc, FILTER_LENGHT, output);
+    } else {
+        DecimatorProcessQ15(&decimator, adc, FILTER_LENGHT, output_q15);
+    }
+}
+
+static void BenchDecimator(void){
+    const char * variants[] = {"float", "q15"};
+    // Multiples of the decimation factor, not aligned to each other
+    const int16_t blocks[] = {8, 56, 512, 1000};
+    static int16_t first_q15[FILTER_LENGHT];
+    double peak, error;
+    BenchSignal(signal, FILTER_LENGHT, 45);
+    for (int i = 0; i < FILTER_LENGHT; i++){
+        long x = ADC_MID + lrintf(signal[i] * ADC_SCALE / 2);
+        adc[i] = (x < 0) ? 0 : (x > 4095) ? 4095 : x;
+    }
+    for (uint8_t f = 0; f < 2; f++){
+        decimator_format_t format = (f == 0) ? DECIMATOR_FLOAT : DECIMATOR_Q15;
+        uint16_t lenght = ReferenceDecimator(format == DECIMATOR_Q15, reference);
+        if (!DecimatorInit(&decimator, format, decimator_factors, DECIMATOR_STAGES, FILTER_LENGHT, ADC_MID, DECIMATOR_SHIFT)){
+            BenchFail("Decimator x8", "not initialized");
+            continue;
+        }
+        RunDecimator(NULL);
+        if (format == DECIMATOR_FLOAT){
+            error = BenchError(output, reference, lenght, &peak);
+            memcpy(work, output, lenght * sizeof(float));
+        } else {
+            error = BenchErrorQ15(output_q15, reference, lenght, &peak);
+            memcpy(first_q15, output_q15, lenght * sizeof(int16_t));
+        }
+        BenchAdd("Decimator x8", variants[f], FILTER_LENGHT, BenchTime(RunDecimator, NULL), error, peak,
+            (format == DECIMATOR_FLOAT) ? BENCH_F32_BOUND : DECIMATOR_Q15_BOUND);
+        // The same signal decimated in blocks of any size gives the same outputs
+        DecimatorDeinit(&decimator);
+        DecimatorInit(&decimator, format, decimator_factors, DECIMATOR_STAGES, FILTER_LENGHT, ADC_MID, DECIMATOR_SHIFT);
+        uint16_t out = 0;
+        for (int i = 0, b = 0; i < FILTER_LENGHT; i += blocks[b], b = (b + 1) % (sizeof(blocks) / sizeof(blocks[0]))){
+            int16_t block = (FILTER_LENGHT - i < blocks[b]) ? FILTER_LENGHT - i : blocks[b];
+            if (format == DECIMATOR_FLOAT){
+                out += DecimatorProcess(&decimator, &adc[i], block, &output[out]);
+            } else {
+                out += DecimatorProcessQ15(&decimator, &adc[i], block, &output_q15[out]);
+            }
+        }
+        if (out != lenght || (format == DECIMATOR_FLOAT && memcmp(work, output, lenght * sizeof(float)) != 0) ||
+            (format == DECIMATOR_Q15 && memcmp(first_q15, output_q15, lenght * sizeof(int16_t)) != 0)){
+            BenchFail("Decimator x8", "outputs depend on the block size");
+        }
+        DecimatorDeinit(&decimator);
+    }
+}
+
+/*==================[external functions definition]==========================*/
+void BenchMiddleware(void){
+    static double x[FILTER_LENGHT];
+    double peak, error;
+    // FFTMagnitude
+    BenchSignal(signal, FFT_LENGHT, 7);
+    for (int i = 0; i < FFT_LENGHT; i++){
+        x[i] = signal[i];
+    }
+    ReferenceMagnitude(x, reference, FFT_LENGHT);
+    FFTInit();
+    RunFFTMagnitude(NULL);
+    error = BenchError(output, reference, FFT_LENGHT / 2, &peak);
+    BenchAdd("FFTMagnitude", "middleware", FFT_LENGHT, BenchTime(RunFFTMagnitude, NULL), error, peak, BENCH_F32_BOUND);
+    // FFTMagnitudeQ15 (12 bit samples)
+    for (int i = 0; i < FFT_LENGHT; i++){
+        signal_adc[i] = (int16_t)lrintf(signal[i] * ADC_SCALE);
+        x[i] = signal_adc[i];
+    }
+    ReferenceMagnitude(x, reference, FFT_LENGHT);
+    FFTInitQ15();
+    RunFFTMagnitudeQ15(NULL);
+    error = 0;
+    peak = 0;
+    for (int k = 0; k < FFT_LENGHT / 2; k++){
+        if (fabs(output_adc[k] - reference[k]) > error){
+            error = fabs(output_adc[k] - reference[k]);
+        }
+        if (reference[k] > peak){
+            peak = reference[k];
+        }
+    }
+    BenchAdd("FFTMagnitudeQ15", "middleware", FFT_LENGHT, BenchTime(RunFFTMagnitudeQ15, NULL), error, peak, FFT_Q15_BOUND);
+    BenchFFTQuality();
+    // LowPassFilter, 4th order Butterworth at fs / 20
+    BenchSignal(signal, FILTER_LENGHT, 8);
+    iir_filter_t filter;
+    IIRFilterInit(&filter, IIR_LOW_PASS, 1000, 50, ORDER_4, 1);
+    for (int n = 0; n < FILTER_LENGHT; n++){
+        reference[n] = signal[n];
+    }
+    for (uint8_t s = 0; s < filter.sections; s++){
+        const float * c = filter.coeff[s];
+        double w0 = 0, w1 = 0;
+        for (int n = 0; n < FILTER_LENGHT; n++){
+            double d0 = reference[n] - c[3] * w0 - c[4] * w1;
+            reference[n] = c[0] * d0 + c[1] * w0 + c[2] * w1;
+            w1 = w0;
+            w0 = d0;
+        }
+    }
+    LowPassInit(1000, 50, ORDER_4);
+    RunLowPass(NULL);
+    error = BenchError(output, reference, FILTER_LENGHT, &peak);
+    BenchAdd("LowPassFilter", "middleware", FILTER_LENGHT, BenchTime(RunLowPass, NULL), error, peak, BENCH_F32_BOUND);
+    BenchIIRFilter();
+    BenchFIRFilter();
+    BenchGoertzel();
+    BenchWelch();
+    BenchQRSDetector();
+    BenchDecimator();
+}
+
+/*==================[end of file]============================================*/
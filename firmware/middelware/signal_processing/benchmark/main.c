@@ -0,0 +1,38 @@
+/**
+ * @file main.c
+ * @brief Host benchmark and regression suite for the DSP code
+ * 
+ * Usage: dsp_bench [results.json]
+ * 
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include "bench.h"
+/*==================[macros and definitions]=================================*/
+#define BENCH_DEFAULT_OUTPUT    "bench.json"
+/*==================[external functions definition]==========================*/
+int main(int argc, char * argv[]){
+    const char * output = (argc > 1) ? argv[1] : BENCH_DEFAULT_OUTPUT;
+    BenchDsp();
+    BenchMat();
+    BenchEkf();
+    BenchMiddleware();
+    if (!BenchWriteJson(output)){
+        printf("Not possible to write %s\n", output);
+        return 1;
+    }
+    printf("Results written to %s\n", output);
+    if (BenchFailures() > 0){
+        printf("%u failures\n", BenchFailures());
+        return 1;
+    }
+    return 0;
+}
+
+/*==================[end of file]============================================*/
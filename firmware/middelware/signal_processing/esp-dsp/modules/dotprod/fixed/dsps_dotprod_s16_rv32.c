@@ -0,0 +1,46 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_dotprod.h"
+
+// Unrolled by 4 with pointer increments. Each product fits in 32 bits, but
+// the accumulator has to be 64 bits wide (two products of -32768 * -32768
+// already overflow int32), as in the ANSI version.
+esp_err_t dsps_dotprod_s16_rv32(const int16_t *src1, const int16_t *src2, int16_t *dest, int len, int8_t shift)
+{
+    // To make correct round operation we have to shift round value
+    long long acc = 0x7fff >> shift;
+
+    for (int i = 0 ; i < (len >> 2) ; i++) {
+        int32_t p0 = (int32_t)src1[0] * (int32_t)src2[0];
+        int32_t p1 = (int32_t)src1[1] * (int32_t)src2[1];
+        int32_t p2 = (int32_t)src1[2] * (int32_t)src2[2];
+        int32_t p3 = (int32_t)src1[3] * (int32_t)src2[3];
+        acc += p0;
+        acc += p1;
+        acc += p2;
+        acc += p3;
+        src1 += 4;
+        src2 += 4;
+    }
+    for (int i = 0 ; i < (len & 3) ; i++) {
+        acc += (int32_t)*src1++ * (int32_t)*src2++;
+    }
+
+    int final_shift = shift - 15;
+    if (final_shift > 0) {
+        *dest = (acc << final_shift);
+    } else {
+        *dest = (acc >> (-final_shift));
+    }
+    return ESP_OK;
+}
@@ -28,5 +28,12 @@
 #define dsps_dotprod_f32_aes3_enabled 1
 #endif
 
+#ifdef __riscv
+// Not faster than ansi in the host benchmark: only selected on request
+#if CONFIG_IDF_TARGET_ESP32C6 && CONFIG_DSP_RV32_DOTPROD_S16
+#define dsps_dotprod_s16_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6 && CONFIG_DSP_RV32_DOTPROD_S16
+#endif // __riscv
+
 
 #endif // _dsps_dotprod_platform_H_
@@ -0,0 +1,70 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "dsp_common.h"
+#include "esp_log.h"
+
+#include "dsps_dotprod.h"
+
+static const char *TAG = "dsps_dotprod_s16_rv32";
+
+#define DOTPROD_TEST_LEN 1024
+
+static int16_t src1[DOTPROD_TEST_LEN];
+static int16_t src2[DOTPROD_TEST_LEN];
+
+TEST_CASE("dsps_dotprod_s16_rv32 functionality", "[dsps]")
+{
+    for (int i = 0 ; i < DOTPROD_TEST_LEN ; i++) {
+        src1[i] = (int16_t)(i * 7919);
+        src2[i] = (int16_t)(i * 104729);
+    }
+    // Full scale inputs overflow an int32 accumulator
+    src1[0] = src2[0] = src1[1] = src2[1] = INT16_MIN;
+
+    for (int len = 0 ; len < 67 ; len++) {
+        for (int shift = 0 ; shift < 16 ; shift++) {
+            int16_t dest = 0;
+            int16_t dest_ansi = 0;
+            dsps_dotprod_s16_rv32(src1, src2, &dest, len, shift);
+            dsps_dotprod_s16_ansi(src1, src2, &dest_ansi, len, shift);
+            if (dest != dest_ansi) {
+                ESP_LOGE(TAG, "len=%i shift=%i calc = %i, expected=%i", len, shift, dest, dest_ansi);
+                TEST_ASSERT_EQUAL(dest_ansi, dest);
+            }
+        }
+    }
+}
+
+TEST_CASE("dsps_dotprod_s16_rv32 benchmark", "[dsps]")
+{
+    int16_t dest = 0;
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    dsps_dotprod_s16_rv32(src1, src2, &dest, DOTPROD_TEST_LEN, 0);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    float cycles = end_b - start_b;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_dotprod_s16_ansi(src1, src2, &dest, DOTPROD_TEST_LEN, 0);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_ansi = end_b - start_b;
+
+    ESP_LOGI(TAG, "dsps_dotprod_s16_rv32 - %f cycles per sample", cycles / DOTPROD_TEST_LEN);
+    ESP_LOGI(TAG, "dsps_dotprod_s16_ansi - %f cycles per sample", cycles_ansi / DOTPROD_TEST_LEN);
+    if (cycles >= cycles_ansi) {
+        TEST_ASSERT_MESSAGE (false, "rv32 version is not faster than ansi!");
+    }
+}
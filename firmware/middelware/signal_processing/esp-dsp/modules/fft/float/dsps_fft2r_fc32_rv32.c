@@ -0,0 +1,90 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "dsp_types.h"
+
+extern uint8_t dsps_fft2r_initialized;
+
+// RV32IMAC has no FPU, every float operation is a soft-float call.
+// The first group of each stage uses the twiddle 1 and the second one the
+// twiddle j (the table is bit reversed), so their butterflies are computed
+// without multiplications. The rest is the same radix-2 loop as the ANSI
+// version, walking the data with pointers instead of indexes.
+esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    float re_temp, im_temp;
+    float c, s;
+    float *top, *bot, *group;
+    int ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        int step = 2 * N2;
+        // j = 0: w = 1
+        top = data;
+        bot = data + step;
+        for (int i = 0; i < N2; i++) {
+            re_temp = bot[0];
+            im_temp = bot[1];
+            bot[0] = top[0] - re_temp;
+            bot[1] = top[1] - im_temp;
+            top[0] = top[0] + re_temp;
+            top[1] = top[1] + im_temp;
+            top += 2;
+            bot += 2;
+        }
+        if (ie > 1) {
+            // j = 1: w = j
+            top = data + 2 * step;
+            bot = top + step;
+            for (int i = 0; i < N2; i++) {
+                re_temp = bot[1];
+                im_temp = -bot[0];
+                bot[0] = top[0] - re_temp;
+                bot[1] = top[1] - im_temp;
+                top[0] = top[0] + re_temp;
+                top[1] = top[1] + im_temp;
+                top += 2;
+                bot += 2;
+            }
+        }
+        group = data + 4 * step;
+        const float *wp = w + 4;
+        for (int j = 2; j < ie; j++) {
+            c = wp[0];
+            s = wp[1];
+            wp += 2;
+            top = group;
+            bot = group + step;
+            for (int i = 0; i < N2; i++) {
+                re_temp = c * bot[0] + s * bot[1];
+                im_temp = c * bot[1] - s * bot[0];
+                bot[0] = top[0] - re_temp;
+                bot[1] = top[1] - im_temp;
+                top[0] = top[0] + re_temp;
+                top[1] = top[1] + im_temp;
+                top += 2;
+                bot += 2;
+            }
+            group += 2 * step;
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
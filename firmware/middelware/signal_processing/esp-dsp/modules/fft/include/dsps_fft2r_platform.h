@@ -32,5 +32,11 @@
 #define dsps_fft2r_sc16_aes3_enabled 1
 #endif
 
+#ifdef __riscv
+#if CONFIG_IDF_TARGET_ESP32C6
+#define dsps_fft2r_fc32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6
+#endif // __riscv
+
 
 #endif // _dsps_fft2r_platform_H_
@@ -0,0 +1,76 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "fft2r_rv32";
+
+static float data[1024 * 2];
+static float check_data[1024 * 2];
+
+TEST_CASE("dsps_fft2r_fc32_rv32 functionality", "[dsps]")
+{
+    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    TEST_ESP_OK(ret);
+
+    for (int N = 2 ; N <= 1024 ; N <<= 1) {
+        for (int i = 0 ; i < N * 2 ; i++) {
+            data[i] = (float)((i * 7919) % 2001 - 1000) / 1000;
+            check_data[i] = data[i];
+        }
+        TEST_ESP_OK(dsps_fft2r_fc32_rv32(data, N));
+        TEST_ESP_OK(dsps_fft2r_fc32_ansi(check_data, N));
+        // The ANSI version multiplies by cos(pi/2) ~ -4e-8 where the rv32
+        // version uses 0, the error grows with the output magnitude
+        float tolerance = 1e-5 * sqrtf(N);
+        for (int i = 0 ; i < N * 2 ; i++) {
+            if (fabsf(check_data[i] - data[i]) > tolerance) {
+                ESP_LOGE(TAG, "N=%i Data[%i] =%f, %f", N, i, data[i], check_data[i]);
+                TEST_ASSERT_EQUAL(check_data[i], data[i]);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fft2r_fc32_rv32(data, 1000));
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_fft2r_fc32_rv32 benchmark", "[dsps]")
+{
+    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    TEST_ESP_OK(ret);
+
+    for (int N = 64 ; N <= 1024 ; N <<= 1) {
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32_rv32(data, N);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        float cycles = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32_ansi(data, N);
+        end_b = dsp_get_cpu_cycle_count();
+        float cycles_ansi = end_b - start_b;
+
+        ESP_LOGI(TAG, "N=%i: rv32 %i cycles, ansi %i cycles", N, (int)cycles, (int)cycles_ansi);
+        if (cycles >= cycles_ansi) {
+            TEST_ASSERT_MESSAGE (false, "rv32 version is not faster than ansi!");
+        }
+    }
+    dsps_fft2r_deinit_fc32();
+}
@@ -0,0 +1,54 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fir.h"
+
+// Multiply-accumulate unrolled by 4 with pointer increments. The
+// accumulation order is the same as in the ANSI version, the results are
+// bit exact.
+static inline float dsps_fir_f32_rv32_mac(float acc, const float **coeffs, const float *delay, int len)
+{
+    const float *c = *coeffs;
+    for (int n = 0; n < (len >> 2); n++) {
+        acc += c[0] * delay[0];
+        acc += c[1] * delay[1];
+        acc += c[2] * delay[2];
+        acc += c[3] * delay[3];
+        c += 4;
+        delay += 4;
+    }
+    for (int n = 0; n < (len & 3); n++) {
+        acc += *c++ * *delay++;
+    }
+    *coeffs = c;
+    return acc;
+}
+
+esp_err_t dsps_fir_f32_rv32(fir_f32_t *fir, const float *input, float *output, int len)
+{
+    float *delay = fir->delay;
+    const int N = fir->N;
+    int pos = fir->pos;
+
+    for (int i = 0 ; i < len ; i++) {
+        const float *coeffs = fir->coeffs;
+        delay[pos] = input[i];
+        pos++;
+        if (pos >= N) {
+            pos = 0;
+        }
+        float acc = dsps_fir_f32_rv32_mac(0, &coeffs, &delay[pos], N - pos);
+        output[i] = dsps_fir_f32_rv32_mac(acc, &coeffs, delay, pos);
+    }
+    fir->pos = pos;
+    return ESP_OK;
+}
@@ -28,4 +28,10 @@
 #endif //
 #endif // __XTENSA__
 
+#ifdef __riscv
+#if CONFIG_IDF_TARGET_ESP32C6
+#define dsps_fir_f32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6
+#endif // __riscv
+
 #endif // _dsps_fir_platform_H_
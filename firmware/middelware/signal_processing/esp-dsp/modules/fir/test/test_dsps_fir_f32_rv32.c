@@ -0,0 +1,83 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include <malloc.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "dsp_common.h"
+#include "esp_log.h"
+
+#include "dsps_fir.h"
+
+static const char *TAG = "dsps_fir_f32_rv32";
+
+#define FIR_TEST_LEN    256
+#define FIR_MAX_COEFFS  64
+
+static float x[FIR_TEST_LEN];
+static float y[FIR_TEST_LEN];
+static float y_ansi[FIR_TEST_LEN];
+static float coeffs[FIR_MAX_COEFFS];
+static float delay[FIR_MAX_COEFFS];
+static float delay_ansi[FIR_MAX_COEFFS];
+
+TEST_CASE("dsps_fir_f32_rv32 functionality", "[dsps]")
+{
+    fir_f32_t fir;
+    fir_f32_t fir_ansi;
+
+    for (int i = 0 ; i < FIR_TEST_LEN ; i++) {
+        x[i] = (float)((i * 7919) % 2001 - 1000) / 1000;
+    }
+    for (int i = 0 ; i < FIR_MAX_COEFFS ; i++) {
+        coeffs[i] = 1.0f / (i + 1);
+    }
+    // Every remainder of the unrolled loop, several calls to wrap the delay line
+    for (int n = 1 ; n <= FIR_MAX_COEFFS ; n++) {
+        dsps_fir_init_f32(&fir, coeffs, delay, n);
+        dsps_fir_init_f32(&fir_ansi, coeffs, delay_ansi, n);
+        for (int r = 0 ; r < 3 ; r++) {
+            dsps_fir_f32_rv32(&fir, x, y, FIR_TEST_LEN - r);
+            dsps_fir_f32_ansi(&fir_ansi, x, y_ansi, FIR_TEST_LEN - r);
+            for (int i = 0 ; i < FIR_TEST_LEN - r ; i++) {
+                if (y[i] != y_ansi[i]) {
+                    ESP_LOGE(TAG, "N=%i [%i]calc = %f, expected=%f", n, i, y[i], y_ansi[i]);
+                    TEST_ASSERT_EQUAL(y_ansi[i], y[i]);
+                }
+            }
+            TEST_ASSERT_EQUAL(fir_ansi.pos, fir.pos);
+        }
+    }
+}
+
+TEST_CASE("dsps_fir_f32_rv32 benchmark", "[dsps]")
+{
+    fir_f32_t fir;
+    dsps_fir_init_f32(&fir, coeffs, delay, FIR_MAX_COEFFS);
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_rv32(&fir, x, y, FIR_TEST_LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    float cycles = (float)(end_b - start_b) / FIR_TEST_LEN;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_ansi(&fir, x, y, FIR_TEST_LEN);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_ansi = (float)(end_b - start_b) / FIR_TEST_LEN;
+
+    ESP_LOGI(TAG, "dsps_fir_f32_rv32 - %f per sample for %i taps", cycles, FIR_MAX_COEFFS);
+    ESP_LOGI(TAG, "dsps_fir_f32_ansi - %f per sample for %i taps", cycles_ansi, FIR_MAX_COEFFS);
+    if (cycles >= cycles_ansi) {
+        TEST_ASSERT_MESSAGE (false, "rv32 version is not faster than ansi!");
+    }
+}
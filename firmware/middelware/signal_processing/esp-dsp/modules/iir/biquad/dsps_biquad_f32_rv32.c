@@ -0,0 +1,49 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_biquad.h"
+
+// Coefficients and state are kept in registers and two samples are
+// processed per iteration, so the state is never written back inside the
+// loop. Operations are evaluated in the same order as the ANSI version, the
+// results are bit exact.
+esp_err_t dsps_biquad_f32_rv32(const float *input, float *output, int len, float *coef, float *w)
+{
+    const float b0 = coef[0];
+    const float b1 = coef[1];
+    const float b2 = coef[2];
+    const float a1 = coef[3];
+    const float a2 = coef[4];
+    float w0 = w[0];
+    float w1 = w[1];
+    float d0, d1;
+
+    for (int i = 0; i < (len >> 1); i++) {
+        d0 = input[0] - a1 * w0 - a2 * w1;
+        output[0] = b0 * d0 + b1 * w0 + b2 * w1;
+        d1 = input[1] - a1 * d0 - a2 * w0;
+        output[1] = b0 * d1 + b1 * d0 + b2 * w0;
+        w1 = d0;
+        w0 = d1;
+        input += 2;
+        output += 2;
+    }
+    if (len & 1) {
+        d0 = input[0] - a1 * w0 - a2 * w1;
+        output[0] = b0 * d0 + b1 * w0 + b2 * w1;
+        w1 = w0;
+        w0 = d0;
+    }
+    w[0] = w0;
+    w[1] = w1;
+    return ESP_OK;
+}
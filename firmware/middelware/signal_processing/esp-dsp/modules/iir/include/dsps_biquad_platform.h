@@ -21,5 +21,12 @@
 
 #endif // __XTENSA__
 
+#ifdef __riscv
+// Not faster than ansi in the host benchmark: only selected on request
+#if CONFIG_IDF_TARGET_ESP32C6 && CONFIG_DSP_RV32_BIQUAD_F32
+#define dsps_biquad_f32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6 && CONFIG_DSP_RV32_BIQUAD_F32
+#endif // __riscv
+
 
 #endif // _dsps_biquad_platform_H_
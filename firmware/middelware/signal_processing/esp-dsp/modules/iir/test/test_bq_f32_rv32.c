@@ -0,0 +1,87 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "dsp_common.h"
+#include "esp_log.h"
+
+#include "dsps_d_gen.h"
+#include "dsps_biquad_gen.h"
+#include "dsps_biquad.h"
+
+static const char *TAG = "dsps_biquad_f32_rv32";
+static const int bq_len = 1023;
+
+TEST_CASE("dsps_biquad_f32_rv32 functionality", "[dsps]")
+{
+    float *x = calloc(bq_len, sizeof(float));
+    float *y = calloc(bq_len, sizeof(float));
+    float *z = calloc(bq_len, sizeof(float));
+
+    // Odd length checks the tail, the second call checks the saved state
+    dsps_d_gen_f32(x, bq_len, 0);
+    float coeffs[5];
+    float w1[2] = {0};
+    float w2[2] = {0};
+    dsps_biquad_gen_lpf_f32(coeffs, 0.1, 1);
+    for (int r = 0 ; r < 2 ; r++) {
+        dsps_biquad_f32_rv32(x, y, bq_len, coeffs, w1);
+        dsps_biquad_f32_ansi(x, z, bq_len, coeffs, w2);
+        for (int i = 0 ; i < bq_len ; i++) {
+            if (y[i] != z[i]) {
+                ESP_LOGE(TAG, "[%i]calc = %f, expected=%f", i, y[i], z[i]);
+                TEST_ASSERT_EQUAL(z[i], y[i]);
+            }
+        }
+        TEST_ASSERT_EQUAL(w2[0], w1[0]);
+        TEST_ASSERT_EQUAL(w2[1], w1[1]);
+    }
+    free(x);
+    free(y);
+    free(z);
+}
+
+TEST_CASE("dsps_biquad_f32_rv32 benchmark", "[dsps]")
+{
+    float *x = calloc(bq_len, sizeof(float));
+    float *y = calloc(bq_len, sizeof(float));
+
+    float w1[2] = {0};
+    int repeat_count = 16;
+    dsps_d_gen_f32(x, bq_len, 0);
+    float coeffs[5];
+    dsps_biquad_gen_lpf_f32(coeffs, 0.1, 1);
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_biquad_f32_rv32(x, y, bq_len, coeffs, w1);
+    }
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    float cycles = (float)(end_b - start_b) / (bq_len * repeat_count);
+
+    start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_biquad_f32_ansi(x, y, bq_len, coeffs, w1);
+    }
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_ansi = (float)(end_b - start_b) / (bq_len * repeat_count);
+
+    ESP_LOGI(TAG, "dsps_biquad_f32_rv32 - %f per sample", cycles);
+    ESP_LOGI(TAG, "dsps_biquad_f32_ansi - %f per sample", cycles_ansi);
+    if (cycles >= cycles_ansi) {
+        TEST_ASSERT_MESSAGE (false, "rv32 version is not faster than ansi!");
+    }
+    free(x);
+    free(y);
+}
@@ -22,7 +22,12 @@ ekf::ekf(int x, int w) : NUMX(x),
     F(*new dspm::Mat(x, x)),
     G(*new dspm::Mat(x, w)),
     P(*new dspm::Mat(x, x)),
-    Q(*new dspm::Mat(w, w))
+    Q(*new dspm::Mat(w, w)),
+    Xlast(x, 1),
+    Xdot(x, 1),
+    Xsum(x, 1),
+    FP(x, x),
+    GQ(x, w)
 {
 
     this->P *= 0;
@@ -31,10 +36,14 @@ ekf::ekf(int x, int w) : NUMX(x),
     this->X.data[0] = 1; // direction to 0
     this->HP = new float[this->NUMX];
     this->Km = new float[this->NUMX];
+    this->Hnz = new int[this->NUMX];
     for (size_t i = 0; i < this->NUMX; i++) {
         this->HP[i] = 0;
         this->Km[i] = 0;
     }
+    SparseRowsAlloc(this->F_nz, x, x);
+    SparseRowsAlloc(this->G_nz, x, w);
+    SparseRowsAlloc(this->Q_nz, w, w);
 }
 
 ekf::~ekf()
@@ -45,8 +54,48 @@ ekf::~ekf()
     delete &P;
     delete &Q;
 
-    delete this->HP;
-    delete this->Km;
+    delete[] this->HP;
+    delete[] this->Km;
+    delete[] this->Hnz;
+    SparseRowsFree(this->F_nz);
+    SparseRowsFree(this->G_nz);
+    SparseRowsFree(this->Q_nz);
+}
+
+void ekf::SparseRowsAlloc(SparseRows &sparse, int rows, int cols)
+{
+    sparse.rows = rows;
+    sparse.cols = cols;
+    sparse.count = new int[rows];
+    sparse.index = new int[rows * cols];
+    sparse.value = new float[rows * cols];
+    for (int r = 0; r < rows; r++) {
+        sparse.count[r] = 0;
+    }
+}
+
+void ekf::SparseRowsFree(SparseRows &sparse)
+{
+    delete[] sparse.count;
+    delete[] sparse.index;
+    delete[] sparse.value;
+}
+
+void ekf::SparseRowsUpdate(const dspm::Mat &m, SparseRows &sparse, float scale)
+{
+    for (int r = 0; r < sparse.rows; r++) {
+        int *index = &sparse.index[r * sparse.cols];
+        float *value = &sparse.value[r * sparse.cols];
+        int count = 0;
+        for (int c = 0; c < sparse.cols; c++) {
+            if (m(r, c) != 0) {
+                index[count] = c;
+                value[count] = m(r, c) * scale;
+                count++;
+            }
+        }
+        sparse.count[r] = count;
+    }
 }
 
 void ekf::Process(float *u, float dt)
@@ -57,6 +106,38 @@ void ekf::Process(float *u, float dt)
 }
 
 void ekf::RungeKutta(dspm::Mat &x, float *U, float dt)
+{
+    // Same operations as RungeKuttaRef(), on the preallocated matrices
+    float dt2 = dt / 2.0f;
+
+    this->Xlast = x;
+    this->StateXdotInto(x, U, this->Xdot); // k1 = f(x, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        Xsum.data[i] = Xdot.data[i];
+        x.data[i] = Xlast.data[i] + Xdot.data[i] * dt2;
+    }
+
+    this->StateXdotInto(x, U, this->Xdot); // k2 = f(x + 0.5*dT*k1, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        Xsum.data[i] = Xsum.data[i] + 2.0f * Xdot.data[i];
+        x.data[i] = Xlast.data[i] + Xdot.data[i] * dt2;
+    }
+
+    this->StateXdotInto(x, U, this->Xdot); // k3 = f(x + 0.5*dT*k2, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        Xsum.data[i] = Xsum.data[i] + 2.0f * Xdot.data[i];
+        x.data[i] = Xlast.data[i] + Xdot.data[i] * dt;
+    }
+
+    this->StateXdotInto(x, U, this->Xdot); // k4 = f(x + dT * k3, u)
+
+    // Xnew = X + dT * (k1 + 2 * k2 + 2 * k3 + k4) / 6
+    for (int i = 0; i < this->NUMX; i++) {
+        x.data[i] = Xlast.data[i] + (Xsum.data[i] + Xdot.data[i]) * (dt / 6.0f);
+    }
+}
+
+void ekf::RungeKuttaRef(dspm::Mat &x, float *U, float dt)
 {
 
     float dt2 = dt / 2.0f;
@@ -78,64 +159,124 @@ void ekf::RungeKutta(dspm::Mat &x, float *U, float dt)
 }
 
 dspm::Mat ekf::SkewSym4x4(float w[3])
+{
+    dspm::Mat result(4, 4);
+    SkewSym4x4(w, result);
+    return result;
+}
+
+void ekf::SkewSym4x4(float w[3], dspm::Mat &result)
 {
     //={    0,  -w[0],  -w[1],  -w[2],
     //   w[0],      0,   w[2],  -w[1],
     //   w[1],  -w[2],      0,   w[0],
     //   w[2],   w[1],  -w[0],     0 };
 
-    dspm::Mat result(4, 4);
-    result.data[0] = 0;
-    result.data[1] = -w[0];
-    result.data[2] = -w[1];
-    result.data[3] = -w[2];
-
-    result.data[4] = w[0];
-    result.data[5] = 0;
-    result.data[6] = w[2];
-    result.data[7] = -w[1];
-
-    result.data[8] = w[1];
-    result.data[9] = -w[2];
-    result.data[10] = 0;
-    result.data[11] = w[0];
-
-    result.data[12] = w[2];
-    result.data[13] = w[1];
-    result.data[14] = -w[0];
-    result.data[15] = 0;
-
-    return result;
+    result(0, 0) = 0;
+    result(0, 1) = -w[0];
+    result(0, 2) = -w[1];
+    result(0, 3) = -w[2];
+
+    result(1, 0) = w[0];
+    result(1, 1) = 0;
+    result(1, 2) = w[2];
+    result(1, 3) = -w[1];
+
+    result(2, 0) = w[1];
+    result(2, 1) = -w[2];
+    result(2, 2) = 0;
+    result(2, 3) = w[0];
+
+    result(3, 0) = w[2];
+    result(3, 1) = w[1];
+    result(3, 2) = -w[0];
+    result(3, 3) = 0;
 }
 
 dspm::Mat ekf::qProduct(float *q)
 {
     dspm::Mat result(4, 4);
+    qProduct(q, result);
+    return result;
+}
 
-    result.data[0] = q[0];
-    result.data[1] = -q[1];
-    result.data[2] = -q[2];
-    result.data[3] = -q[3];
-
-    result.data[4] = q[1];
-    result.data[5] = q[0];
-    result.data[6] = -q[3];
-    result.data[7] = q[2];
+void ekf::qProduct(float *q, dspm::Mat &result)
+{
+    result(0, 0) = q[0];
+    result(0, 1) = -q[1];
+    result(0, 2) = -q[2];
+    result(0, 3) = -q[3];
+
+    result(1, 0) = q[1];
+    result(1, 1) = q[0];
+    result(1, 2) = -q[3];
+    result(1, 3) = q[2];
+
+    result(2, 0) = q[2];
+    result(2, 1) = q[3];
+    result(2, 2) = q[0];
+    result(2, 3) = -q[1];
+
+    result(3, 0) = q[3];
+    result(3, 1) = -q[2];
+    result(3, 2) = q[1];
+    result(3, 3) = q[0];
+}
 
-    result.data[8] = q[2];
-    result.data[9] = q[3];
-    result.data[10] = q[0];
-    result.data[11] = -q[1];
+void ekf::CovariancePrediction(float dt)
+{
+    // P = f*P*f' + (dt*dt)*G*Q*G', where f = I + F*dt.
+    // F, G and Q are mostly zero, so only their non zero elements are used.
+    SparseRowsUpdate(this->F, this->F_nz, dt);
+    SparseRowsUpdate(this->G, this->G_nz, dt);
+    SparseRowsUpdate(this->Q, this->Q_nz, 1);
+
+    // FP = f*P
+    for (int i = 0; i < this->NUMX; i++) {
+        const int *index = &F_nz.index[i * NUMX];
+        const float *value = &F_nz.value[i * NUMX];
+        for (int j = 0; j < this->NUMX; j++) {
+            float acc = P(i, j);
+            for (int n = 0; n < F_nz.count[i]; n++) {
+                acc += value[n] * P(index[n], j);
+            }
+            FP(i, j) = acc;
+        }
+    }
 
-    result.data[12] = q[3];
-    result.data[13] = -q[2];
-    result.data[14] = q[1];
-    result.data[15] = q[0];
+    // GQ = G*dt*Q
+    this->GQ.clear();
+    for (int i = 0; i < this->NUMX; i++) {
+        for (int n = 0; n < G_nz.count[i]; n++) {
+            int k = G_nz.index[i * NUMW + n];
+            float g = G_nz.value[i * NUMW + n];
+            for (int m = 0; m < Q_nz.count[k]; m++) {
+                GQ(i, Q_nz.index[k * NUMW + m]) += g * Q_nz.value[k * NUMW + m];
+            }
+        }
+    }
 
-    return result;
+    // P = FP*f' + GQ*(G*dt)', symmetric: only the upper triangle is calculated
+    for (int j = 0; j < this->NUMX; j++) {
+        const int *f_index = &F_nz.index[j * NUMX];
+        const float *f_value = &F_nz.value[j * NUMX];
+        const int *g_index = &G_nz.index[j * NUMW];
+        const float *g_value = &G_nz.value[j * NUMW];
+        for (int i = 0; i <= j; i++) {
+            float acc = FP(i, j);
+            for (int n = 0; n < F_nz.count[j]; n++) {
+                acc += FP(i, f_index[n]) * f_value[n];
+            }
+            float noise = 0;
+            for (int n = 0; n < G_nz.count[j]; n++) {
+                noise += GQ(i, g_index[n]) * g_value[n];
+            }
+            P(i, j) = P(j, i) = acc + noise;
+        }
+    }
 }
 
-void ekf::CovariancePrediction(float dt)
+void ekf::CovariancePredictionRef(float dt)
 {
     dspm::Mat f = this->F * dt;
 
@@ -152,19 +293,27 @@ void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
     dspm::Mat Z(expected, H.rows, 1);
 
     for (int m = 0; m < H.rows; m++) {
+        // H is sparse: only the non zero elements of the row are used
+        int count = 0;
+        for (int k = 0; k < this->NUMX; k++) {
+            if (H(m, k) != 0) {
+                Hnz[count++] = k;
+            }
+        }
         for (int j = 0; j < this->NUMX; j++) {
             // Find Hp = H*P
             HP[j] = 0;
         }
-        for (int k = 0; k < this->NUMX; k++) {
+        for (int n = 0; n < count; n++) {
+            int k = Hnz[n];
             for (int j = 0; j < this->NUMX; j++) {
                 // Find Hp = H*P
                 HP[j] += H(m, k) * P(k, j);
             }
         }
         HPHR = R[m]; // Find  HPHR = H*P*H' + R
-        for (int k = 0; k < this->NUMX; k++) {
-            HPHR += HP[k] * H(m, k);
+        for (int n = 0; n < count; n++) {
+            HPHR += HP[Hnz[n]] * H(m, Hnz[n]);
         }
         float invHPHR = 1.0f / HPHR;
         for (int k = 0; k < this->NUMX; k++) {
@@ -206,12 +355,18 @@ void ekf::UpdateRef(dspm::Mat &H, float *measured, float *expected, float *R)
 }
 
 dspm::Mat ekf::quat2rotm(float q[4])
+{
+    dspm::Mat Rm(3, 3);
+    quat2rotm(q, Rm);
+    return Rm;
+}
+
+void ekf::quat2rotm(float q[4], dspm::Mat &Rm)
 {
     float q0 = q[0];
     float q1 = q[1];
     float q2 = q[2];
     float q3 = q[3];
-    dspm::Mat Rm(3, 3);
 
     Rm(0, 0) = q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3;
     Rm(1, 0) = 2.0f * (q1 * q2 + q0 * q3);
@@ -222,8 +377,6 @@ dspm::Mat ekf::quat2rotm(float q[4])
     Rm(0, 2) = 2.0f * (q1 * q3 + q0 * q2);
     Rm(1, 2) = 2.0f * (q2 * q3 - q0 * q1);
     Rm(2, 2) = (q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3);
-
-    return Rm;
 }
 
 dspm::Mat ekf::quat2eul(const float q[4])
@@ -388,6 +541,12 @@ dspm::Mat ekf::dFdq(dspm::Mat &vector, dspm::Mat &q)
 dspm::Mat ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q)
 {
     dspm::Mat result(3, 4);
+    dFdq_inv(vector, q, result);
+    return result;
+}
+
+void ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q, dspm::Mat &result)
+{
     result(0, 0) = q.data[0] * vector.data[0] + q.data[3] * vector.data[1] - q.data[2] * vector.data[2];
     result(0, 1) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
     result(0, 2) = -q.data[2] * vector.data[0] + q.data[1] * vector.data[1] - q.data[0] * vector.data[2];
@@ -404,7 +563,6 @@ dspm::Mat ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q)
     result(2, 3) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
 
     result *= 2;
-    return result;
 }
 
 dspm::Mat ekf::StateXdot(dspm::Mat &x, float *u)
@@ -413,3 +571,8 @@ dspm::Mat ekf::StateXdot(dspm::Mat &x, float *u)
     dspm::Mat Xdot = (this->F * x + this->G * U);
     return Xdot;
 }
+
+void ekf::StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot)
+{
+    xdot = this->StateXdot(x, u);
+}
@@ -25,9 +25,23 @@
 /**
  * The ekf is a base class for Extended Kalman Filter.
  * It contains main matrix operations and define the processing flow.
+ *
+ * All the memory used by a filter step is allocated by the constructor, so Process() and
+ * Update() do not use the heap. The linearized matrices F, G and H and the noise matrix Q
+ * are mostly zero: only their non zero elements are used in the calculations.
  */
 class ekf {
 public:
+    /**
+     * Column indexes and values of the non zero elements of each row of a matrix
+     */
+    struct SparseRows {
+        int *count;     /*!< amount of non zero elements of each row */
+        int *index;     /*!< column indexes, row r starts at index[r * cols] */
+        float *value;   /*!< values, row r starts at value[r * cols] */
+        int rows;       /*!< amount of rows */
+        int cols;       /*!< amount of columns */
+    };
 
     /**
      * Constructor of EKF.
@@ -101,6 +115,17 @@ public:
      */
     void RungeKutta(dspm::Mat &x, float *u, float dt);
 
+    /**
+     * Runge-Kutta state update method with temporary matrices.
+     * This method just as a reference for research purpose.
+     * Not used in real calculations.
+     *
+     * @param[in] x: state vector
+     * @param[in] u: control measurement
+     * @param[in] dt: time interval from last update in seconds
+     */
+    void RungeKuttaRef(dspm::Mat &x, float *u, float dt);
+
     // System Dependent methods:
 
     /**
@@ -112,6 +137,16 @@ public:
      *      - derivative of input vector x and u
      */
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+
+    /**
+     * Derivative of state vector X, without allocation
+     * The default implementation calls StateXdot(). Derived classes should override it
+     * to keep the filter step free of heap allocations.
+     * @param[in] x: state vector
+     * @param[in] u: control measurement
+     * @param[out] xdot: derivative of input vector x and u
+     */
+    virtual void StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot);
     /**
      * Calculation of system state matrices F and G
      * @param[in] x: state vector
@@ -129,6 +164,14 @@ public:
      */
     virtual void CovariancePrediction(float dt);
 
+    /**
+     * Calculates covariance prediction matrux P with dense matrices.
+     * This method just as a reference for research purpose.
+     * Not used in real calculations.
+     * @param[in] dt: time interval from last update
+     */
+    virtual void CovariancePredictionRef(float dt);
+
     /**
      * Update of current state by measured values.
      * Optimized method for non correlated values
@@ -158,6 +201,41 @@ public:
      * Matrix for intermidieve calculations
     */
     float *Km;
+    /**
+     * Column indexes of the non zero elements of a row of H
+    */
+    int *Hnz;
+
+    dspm::Mat Xlast;    /*!< Runge-Kutta: state at the beginning of the step */
+    dspm::Mat Xdot;     /*!< Runge-Kutta: derivative of the state */
+    dspm::Mat Xsum;     /*!< Runge-Kutta: weighted sum of the derivatives */
+    dspm::Mat FP;       /*!< Covariance prediction: f*P */
+    dspm::Mat GQ;       /*!< Covariance prediction: G*Q*dt */
+    SparseRows F_nz;    /*!< Non zero elements of F*dt */
+    SparseRows G_nz;    /*!< Non zero elements of G*dt */
+    SparseRows Q_nz;    /*!< Non zero elements of Q */
+
+    /**
+     * Allocate the memory of a sparse rows description
+     * @param[out] sparse: sparse rows description
+     * @param[in] rows: amount of rows
+     * @param[in] cols: amount of columns
+     */
+    static void SparseRowsAlloc(SparseRows &sparse, int rows, int cols);
+
+    /**
+     * Free the memory of a sparse rows description
+     * @param[in] sparse: sparse rows description
+     */
+    static void SparseRowsFree(SparseRows &sparse);
+
+    /**
+     * Find the non zero elements of each row of a matrix
+     * @param[in] m: source matrix, same size as the sparse rows description
+     * @param[out] sparse: sparse rows description
+     * @param[in] scale: scale applied to the stored values
+     */
+    static void SparseRowsUpdate(const dspm::Mat &m, SparseRows &sparse, float scale);
 
 public:
     // Additional universal helper methods
@@ -170,6 +248,13 @@ public:
      */
     static dspm::Mat quat2rotm(float q[4]);
 
+    /**
+     * Convert quaternion to rotation matrix, without allocation.
+     * @param[in] q: quaternion
+     * @param[out] Rm: rotation matrix 3x3
+     */
+    static void quat2rotm(float q[4], dspm::Mat &Rm);
+
     /**
      * Convert rotation matrix to quaternion.
      * @param[in] R: rotation matrix
@@ -225,6 +310,14 @@ public:
      */
     static dspm::Mat dFdq_inv(dspm::Mat &vector, dspm::Mat &quat);
 
+    /**
+     * Df/dq: Derivative of vector by inverted quaternion, without allocation.
+     * @param[in] vector: input vector
+     * @param[in] quat: quaternion
+     * @param[out] result: derivative matrix 3x4, can be a sub-matrix
+     */
+    static void dFdq_inv(dspm::Mat &vector, dspm::Mat &quat, dspm::Mat &result);
+
     /**
      * Make skew-symmetric matrix of vector.
      * @param[in] w: source vector
@@ -234,6 +327,13 @@ public:
      */
     static dspm::Mat SkewSym4x4(float *w);
 
+    /**
+     * Make skew-symmetric matrix of vector, without allocation.
+     * @param[in] w: source vector
+     * @param[out] result: skew-symmetric matrix 4x4, can be a sub-matrix
+     */
+    static void SkewSym4x4(float *w, dspm::Mat &result);
+
     // q product
     // Rl = [q(1) - q(2) - q(3) - q(4); ...
     //      q(2)  q(1) - q(4)  q(3); ...
@@ -249,6 +349,13 @@ public:
      */
     static dspm::Mat qProduct(float *q);
 
+    /**
+     * Make right quaternion-product matrices, without allocation.
+     * @param[in] q: source quaternion
+     * @param[out] result: right quaternion-product matrix 4x4, can be a sub-matrix
+     */
+    static void qProduct(float *q, dspm::Mat &result);
+
 };
 
 #endif // _ekf_h_
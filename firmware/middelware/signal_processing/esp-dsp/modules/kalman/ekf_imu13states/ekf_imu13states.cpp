@@ -16,7 +16,8 @@
 
 ekf_imu13states::ekf_imu13states() : ekf(13, 18),
     mag0(3, 1),
-    accel0(3, 1)
+    accel0(3, 1),
+    H(10, 13)
 {
     this->NUMU = 3;
 }
@@ -51,24 +52,31 @@ void ekf_imu13states::Init()
 }
 
 dspm::Mat ekf_imu13states::StateXdot(dspm::Mat &x, float *u)
+{
+    dspm::Mat Xdot(this->NUMX, 1);
+    StateXdotInto(x, u, Xdot);
+    return Xdot;
+}
+
+void ekf_imu13states::StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot)
 {
     float wx = u[0] - x(4, 0); // subtract the biases on gyros
     float wy = u[1] - x(5, 0);
     float wz = u[2] - x(6, 0);
 
     float w[] = {wx, wy, wz};
-    dspm::Mat q = dspm::Mat(x.data, 4, 1);
+    dspm::Mat q(x.data, 4, 1);
 
     // qdot = Q * w
-    dspm::Mat Omega = 0.5 * SkewSym4x4(w);
-    dspm::Mat qdot = Omega * q;
-    dspm::Mat Xdot(this->NUMX, 1);
-    Xdot *= 0;
-    Xdot.Copy(qdot, 0, 0);
+    dspm::MatFixed<4, 4> Omega;
+    SkewSym4x4(w, Omega);
+    Omega *= 0.5f;
+    xdot.clear();
+    dspm::Mat qdot(xdot.data, 4, 1);
+    dspm::Mat::mulInto(Omega, q, qdot);
     // dwbias = 0
     // dMang_Ampl = 0
     // dMang_offset = 0
-    return Xdot;
 }
 
 void ekf_imu13states::LinearizeFG(dspm::Mat &x, float *u)
@@ -76,28 +84,36 @@ void ekf_imu13states::LinearizeFG(dspm::Mat &x, float *u)
     float w[3] = {(u[0] - x(4, 0)), (u[1] - x(5, 0)), (u[2] - x(6, 0))}; // subtract the biases on gyros
     // float w[3] = {u[0], u[1], u[2]}; // subtract the biases on gyros
 
-    this->F *= 0; // Initialize F and G matrixes.
-    this->G *= 0;
+    this->F.clear(); // Initialize F and G matrixes.
+    this->G.clear();
 
     // dqdot / dq - skey matrix
-    F.Copy(0.5 * ekf::SkewSym4x4(w), 0, 0);
+    dspm::Mat dq_dq = F.getROI(0, 0, 4, 4);
+    ekf::SkewSym4x4(w, dq_dq);
+    dq_dq *= 0.5f;
 
     // dqdot/dvector
-    dspm::Mat dq = -0.5 * qProduct(x.data);
-    dspm::Mat dq_q = dq.Get(0, 4, 1, 3);
+    dspm::MatFixed<4, 4> dq;
+    qProduct(x.data, dq);
+    dq *= -0.5f;
+    dspm::Mat dq_q = dq.getROI(0, 1, 4, 3);
 
     // dqdot / dnw
     G.Copy(dq_q, 0, 0);
     // dqdot / dwbias
     F.Copy(dq_q, 0, 4);
 
-    dspm::Mat rotm = -1 * this->quat2rotm(x.data); // Convert quat to rotation matrix
+    dspm::MatFixed<3, 3> rotm;
+    this->quat2rotm(x.data, rotm); // Convert quat to rotation matrix
+    rotm *= -1;
 
     G.Copy(rotm, 7, 6);
-    G.Copy(dspm::Mat::eye(3), 4, 3);   // random noise wbias
-    G.Copy(dspm::Mat::eye(3), 7, 12);  // random noise magnetometer amplitude
-    G.Copy(dspm::Mat::eye(3), 10, 9);  // magnetometer offset constant
-    G.Copy(dspm::Mat::eye(3), 10, 15); // random noise offset constant
+    for (int i = 0; i < 3; i++) {
+        G(4 + i, 3 + i) = 1;    // random noise wbias
+        G(7 + i, 12 + i) = 1;   // random noise magnetometer amplitude
+        G(10 + i, 9 + i) = 1;   // magnetometer offset constant
+        G(10 + i, 15 + i) = 1;  // random noise offset constant
+    }
 }
 
 void ekf_imu13states::Test()
@@ -184,33 +200,47 @@ void ekf_imu13states::TestFull(bool enable_att)
     std::cout << "Final State data : " << this->X.t() << std::endl;
 }
 
-void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float R[6])
+void ekf_imu13states::PrepareRefMeasurement(dspm::Mat &H, dspm::Mat &Re, float *accel_data, float *magn_data, float *measured_data, float *expected_data)
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
+    dspm::MatFixed<3, 3> Rm;
+    this->quat2rotm(quat.data, Rm);
+    dspm::Mat::transposeInto(Rm, Re);
 
     // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
+    dspm::Mat dAccel_dq = H.getROI(3, 0, 3, 4);
+    ekf::dFdq_inv(this->accel0, quat, dAccel_dq);
 
     // dMagn/dq
     dspm::Mat magn(&this->X.data[7], 3, 1);
     dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
+    dspm::Mat dMagn_dq = H.getROI(0, 0, 3, 4);
+    ekf::dFdq_inv(magn, quat, dMagn_dq);
 
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
+    dspm::MatFixed<3, 1> expected_magn;
+    dspm::MatFixed<3, 1> expected_accel;
+    dspm::Mat::mulInto(Re, magn, expected_magn);
+    dspm::Mat::addInto(expected_magn, magn_offset, expected_magn);
+    dspm::Mat::mulInto(Re, this->accel0, expected_accel);
 
-    float measured_data[6];
-    float expected_data[6];
     for (size_t i = 0; i < 3; i++) {
         measured_data[i] = magn_data[i];
         expected_data[i] = expected_magn.data[i];
         measured_data[i + 3] = accel_data[i];
         expected_data[i + 3] = expected_accel.data[i];
     }
+}
+
+void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float R[6])
+{
+    dspm::Mat quat(this->X.data, 4, 1);
+    dspm::Mat H = this->H.getROI(0, 0, 6, this->NUMX);
+    dspm::MatFixed<3, 3> Re;
+    float measured_data[6];
+    float expected_data[6];
+
+    H.clear();
+    PrepareRefMeasurement(H, Re, accel_data, magn_data, measured_data, expected_data);
 
     this->Update(H, measured_data, expected_data, R);
     quat /= quat.norm();
@@ -219,33 +249,18 @@ void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data,
 void ekf_imu13states::UpdateRefMeasurementMagn(float *accel_data, float *magn_data, float R[6])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
+    dspm::Mat H = this->H.getROI(0, 0, 6, this->NUMX);
+    dspm::MatFixed<3, 3> Re;
+    float measured_data[6];
+    float expected_data[6];
+
+    H.clear();
+    PrepareRefMeasurement(H, Re, accel_data, magn_data, measured_data, expected_data);
 
     // We include these two line to update magnetometer initial state
     H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
-
-    // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
-
-    // dMagn/dq
-    dspm::Mat magn(&this->X.data[7], 3, 1);
-    dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
-
-    float measured_data[6];
-    float expected_data[6];
-    for (size_t i = 0; i < 3; i++) {
-        measured_data[i] = magn_data[i];
-        expected_data[i] = expected_magn.data[i];
-        measured_data[i + 3] = accel_data[i];
-        expected_data[i + 3] = expected_accel.data[i];
+    for (int i = 0; i < 3; i++) {
+        H(i, 10 + i) = 1;
     }
 
     this->Update(H, measured_data, expected_data, R);
@@ -255,34 +270,22 @@ void ekf_imu13states::UpdateRefMeasurementMagn(float *accel_data, float *magn_da
 void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float *attitude, float R[10])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(10, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
+    dspm::MatFixed<3, 3> Re;
+    float measured_data[10];
+    float expected_data[10];
 
-    H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
-    // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
-    // dMagn/dq
-    dspm::Mat magn(&this->X.data[7], 3, 1);
-    dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
+    this->H.clear();
+    PrepareRefMeasurement(this->H, Re, accel_data, magn_data, measured_data, expected_data);
 
+    H.Copy(Re, 0, 7);
+    for (int i = 0; i < 3; i++) {
+        H(i, 10 + i) = 1;
+    }
     // dq/dq
-    H.Copy(dspm::Mat::eye(4), 6, 1);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
-
-    float measured_data[10];
-    float expected_data[10];
-    for (size_t i = 0; i < 3; i++) {
-        measured_data[i] = magn_data[i];
-        expected_data[i] = expected_magn.data[i];
-        measured_data[i + 3] = accel_data[i];
-        expected_data[i + 3] = expected_accel.data[i];
+    for (int i = 0; i < 4; i++) {
+        H(6 + i, 1 + i) = 1;
     }
+
     for (size_t i = 0; i < 4; i++) {
         measured_data[i + 6] = attitude[i];
         expected_data[i + 6] = this->X.data[i];
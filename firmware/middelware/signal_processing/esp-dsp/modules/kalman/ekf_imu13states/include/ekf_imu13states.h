@@ -37,6 +37,7 @@ public:
     // Method calculates Xdot values depends on U
     // U - gyroscope values in radian per seconds (rad/sec)
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+    virtual void StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot);
     virtual void LinearizeFG(dspm::Mat &x, float *u);
 
     /**
@@ -64,6 +65,11 @@ public:
     */
     int NUMU;
 
+    /**
+    *     Measurement matrix H for the reference measurements.
+    */
+    dspm::Mat H;
+
     /**
      * Update part of system state by reference measurements accelerometer and magnetometer.
      * Only attitude and gyro bias will be updated.
@@ -93,6 +99,20 @@ public:
      */
     void UpdateRefMeasurement(float *accel_data, float *magn_data, float *attitude, float R[10]);
 
+protected:
+    /**
+     * Prepare the accelerometer and magnetometer part of the measurement update, without allocation.
+     * Fills rows 0..5 of H with the derivatives by the attitude quaternion.
+     *
+     * @param[out] H: measurement matrix, cleared by the caller
+     * @param[out] Re: transposed rotation matrix of the attitude 3x3
+     * @param[in] accel_data: accelerometer measurement vector XYZ
+     * @param[in] magn_data: magnetometer measurement vector XYZ
+     * @param[out] measured_data: measured values, 6 elements
+     * @param[out] expected_data: expected values, 6 elements
+     */
+    void PrepareRefMeasurement(dspm::Mat &H, dspm::Mat &Re, float *accel_data, float *magn_data, float *measured_data, float *expected_data);
+
 };
 
 #endif // _ekf_imu13states_H_
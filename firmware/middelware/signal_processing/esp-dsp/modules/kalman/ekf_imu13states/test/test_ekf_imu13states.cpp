@@ -15,6 +15,7 @@
 #include <string.h>
 #include "unity.h"
 #include "dsp_platform.h"
+#include "dsp_common.h"
 #include "esp_log.h"
 
 #include "ekf_imu13states.h"
@@ -22,6 +23,63 @@
 
 static const char *TAG = "ekf_imu13states";
 
+// Filter with the dense prediction of the reference methods (temporary matrices, dense products)
+class ekf_imu13states_ref: public ekf_imu13states {
+public:
+    virtual void Process(float *u, float dt)
+    {
+        this->LinearizeFG(this->X, u);
+        this->RungeKuttaRef(this->X, u, dt);
+        this->CovariancePredictionRef(dt);
+    }
+};
+
+// Run the filter on a body rotating around the three axes, with a constant gyroscope bias.
+// mode 0: UpdateRefMeasurement, 1: UpdateRefMeasurementMagn, 2: UpdateRefMeasurement with attitude
+static unsigned int test_ekf13_run(ekf_imu13states *ekf13, int steps, int mode)
+{
+    const float pi = std::atan(1) * 4;
+    const float dt = 0.002;
+    float accel0_data[] = {0, 0, 1};
+    float magn0_data[] = {1, 0, 0};
+    dspm::Mat accel0(accel0_data, 3, 1);
+    dspm::Mat magn0(magn0_data, 3, 1);
+    dspm::Mat Rm = dspm::Mat::eye(3);
+    float R[10];
+    for (size_t i = 0; i < 10; i++) {
+        R[i] = 0.01;
+    }
+    unsigned int cycles = 0;
+
+    for (int n = 0; n < steps; n++) {
+        float gyro[3];
+        float angle[3];
+        for (int i = 0; i < 3; i++) {
+            float rate = (i + 1) * 0.5f * std::sin(2 * pi * (0.2f + 0.1f * i) * n * dt);
+            gyro[i] = rate + 0.1f * (i + 1);
+            angle[i] = rate * dt;
+        }
+        Rm = Rm * ekf::eul2rotm(angle);
+        dspm::Mat attitude = ekf::rotm2quat(Rm);
+        dspm::Mat accel_data = Rm.t() * accel0;
+        dspm::Mat magn_data = Rm.t() * magn0;
+        accel_data /= accel_data.norm();
+        magn_data /= magn_data.norm();
+
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        ekf13->Process(gyro, dt);
+        if (mode == 0) {
+            ekf13->UpdateRefMeasurement(accel_data.data, magn_data.data, R);
+        } else if (mode == 1) {
+            ekf13->UpdateRefMeasurementMagn(accel_data.data, magn_data.data, R);
+        } else {
+            ekf13->UpdateRefMeasurement(accel_data.data, magn_data.data, attitude.data, R);
+        }
+        cycles += dsp_get_cpu_cycle_count() - start_b;
+    }
+    return cycles;
+}
+
 
 TEST_CASE("ekf_imu13states functionality gyro only", "[dspm]")
 {
@@ -58,3 +116,27 @@ TEST_CASE("ekf_imu13states functionality gyro and magn", "[dspm]")
     printf("Expected result = %i, calculated result = %i\n", 200, (int)(1000 * ekf13->X.data[5] + 0.5));
     printf("Expected result = %i, calculated result = %i\n", 300, (int)(1000 * ekf13->X.data[6] + 0.5));
 }
+
+TEST_CASE("ekf_imu13states sparse step equivalence", "[dspm]")
+{
+    const int steps = 1000;
+    for (int mode = 0; mode < 3; mode++) {
+        ekf_imu13states *ekf13 = new ekf_imu13states();
+        ekf_imu13states *ekf13_ref = new ekf_imu13states_ref();
+        ekf13->Init();
+        ekf13_ref->Init();
+
+        unsigned int cycles = test_ekf13_run(ekf13, steps, mode);
+        unsigned int cycles_ref = test_ekf13_run(ekf13_ref, steps, mode);
+        ESP_LOGI(TAG, "Update mode %i: %i cycles per step, reference %i cycles per step", mode, cycles / steps, cycles_ref / steps);
+
+        for (int i = 0; i < ekf13->NUMX; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-4, ekf13_ref->X.data[i], ekf13->X.data[i]);
+            for (int j = 0; j < ekf13->NUMX; j++) {
+                TEST_ASSERT_FLOAT_WITHIN(1e-4, ekf13_ref->P(i, j), ekf13->P(i, j));
+            }
+        }
+        delete ekf13;
+        delete ekf13_ref;
+    }
+}
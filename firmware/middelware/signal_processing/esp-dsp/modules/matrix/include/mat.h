@@ -116,6 +116,16 @@ public:
      */
     Mat(const Mat &src);
 
+    /**
+     * @brief Move matrix.
+     *
+     * If src owns its buffer, the buffer is taken without allocation or copy.
+     * Otherwise it works as the copy constructor.
+     *
+     * @param[in] src: source matrix
+     */
+    Mat(Mat &&src);
+
     /**
      * @brief Create a subset of matrix as ROI (Region of Interest)
      *
@@ -207,6 +217,16 @@ public:
      */
     Mat &operator=(const Mat &src);
 
+    /**
+     * Move operator
+     * If both matrices own their buffers and the sizes are different, the buffers
+     * are exchanged (no allocation), otherwise the data is copied as with the copy operator.
+     * @param[in] src: source matrix
+     * @return
+     *      - matrix copy
+     */
+    Mat &operator=(Mat &&src);
+
     /**
      * Access to the matrix elements.
      * @param[in] row: row position
@@ -513,6 +533,75 @@ public:
      *      - determinant value
      */
     float det(int n);
+
+    /**
+     * @brief   Multiplication without allocation
+     * result = A*B. The result matrix must be preallocated with the right size
+     * and must not share data with A or B. Sub-matrices are supported.
+     * @param[in] A: Input matrix A [M]x[N]
+     * @param[in] B: Input matrix B [N]x[K]
+     * @param[out] result: result matrix [M]x[K]
+     */
+    static void mulInto(const Mat &A, const Mat &B, Mat &result);
+
+    /**
+     * @brief   Multiplication by a transposed matrix without allocation
+     * result = A*B^T, without building the transposed matrix.
+     * The result matrix must not share data with A or B.
+     * @param[in] A: Input matrix A [M]x[N]
+     * @param[in] B: Input matrix B [K]x[N]
+     * @param[out] result: result matrix [M]x[K]
+     */
+    static void mulTransInto(const Mat &A, const Mat &B, Mat &result);
+
+    /**
+     * @brief   Multiplication of a transposed matrix without allocation
+     * result = A^T*B, without building the transposed matrix.
+     * The result matrix must not share data with A or B.
+     * @param[in] A: Input matrix A [N]x[M]
+     * @param[in] B: Input matrix B [N]x[K]
+     * @param[out] result: result matrix [M]x[K]
+     */
+    static void transMulInto(const Mat &A, const Mat &B, Mat &result);
+
+    /**
+     * @brief   Sum without allocation
+     * result = A+B. The result matrix can be A or B.
+     * @param[in] A: Input matrix A
+     * @param[in] B: Input matrix B
+     * @param[out] result: result matrix
+     */
+    static void addInto(const Mat &A, const Mat &B, Mat &result);
+
+    /**
+     * @brief   Subtraction without allocation
+     * result = A-B. The result matrix can be A or B.
+     * @param[in] A: Input matrix A
+     * @param[in] B: Input matrix B
+     * @param[out] result: result matrix
+     */
+    static void subInto(const Mat &A, const Mat &B, Mat &result);
+
+    /**
+     * @brief   Transpose without allocation
+     * result = A^T. The result matrix must not share data with A.
+     * @param[in] A: Input matrix A [M]x[N]
+     * @param[out] result: result matrix [N]x[M]
+     */
+    static void transposeInto(const Mat &A, Mat &result);
+
+protected:
+    /**
+     * Check the size of a matrix and log an error if it is not the expected one.
+     * @param[in] op: name of the operation
+     * @param[in] m: matrix to check
+     * @param[in] rows: expected amount of rows
+     * @param[in] cols: expected amount of columns
+     * @return
+     *      - true if the size is correct
+     */
+    static bool checkSize(const char *op, const Mat &m, int rows, int cols);
+
 private:
     Mat cofactor(int row, int col, int n);
     Mat adjoint();
@@ -520,6 +609,74 @@ private:
     void allocate(); // Allocate buffer
     Mat expHelper(const Mat &m, int num);
 };
+/**
+ * @brief   Matrix with fixed size and internal storage
+ *
+ * The data is stored inside the object (on the stack or in static memory), so creating,
+ * copying and assigning a MatFixed never allocates. Together with the Mat::mulInto() family
+ * it allows per-sample linear algebra without heap traffic. Assigning a matrix of a different
+ * size is an error and leaves the matrix unchanged.
+ */
+template <int R, int C>
+class MatFixed : public Mat {
+public:
+    /**
+     * Constructor, matrix filled with 0.
+     */
+    MatFixed() : Mat(buffer, R, C)
+    {
+        clear();
+    }
+
+    /**
+     * Copy constructor.
+     * @param[in] src: source matrix
+     */
+    MatFixed(const MatFixed &src) : Mat(buffer, R, C)
+    {
+        Mat::operator=(src);
+    }
+
+    /**
+     * Constructor from a matrix of the same size.
+     * @param[in] src: source matrix
+     */
+    MatFixed(const Mat &src) : Mat(buffer, R, C)
+    {
+        clear();
+        *this = src;
+    }
+
+    /**
+     * Copy operator
+     * @param[in] src: source matrix
+     * @return
+     *      - matrix copy
+     */
+    MatFixed &operator=(const MatFixed &src)
+    {
+        Mat::operator=(src);
+        return *this;
+    }
+
+    /**
+     * Copy operator from a matrix of the same size
+     * @param[in] src: source matrix
+     * @return
+     *      - matrix copy
+     */
+    MatFixed &operator=(const Mat &src)
+    {
+        if (checkSize("MatFixed operator =", src, R, C)) {
+            Mat::operator=(src);
+        }
+        return *this;
+    }
+
+private:
+    float buffer[R * C];
+};
+
 /**
  * Print matrix to the standard iostream.
  * @param[in] os: output stream
@@ -89,7 +89,6 @@ Mat::Mat(float *data, int rows, int cols)
     this->stride = cols;
     this->padding = 0;
     this->length = this->rows * this->cols;
-    memcpy(this->data, data, this->length * sizeof(float));
 }
 
 
@@ -133,6 +132,31 @@ Mat::Mat(const Mat &m)
     }
 }
 
+Mat::Mat(Mat &&m)
+{
+    this->rows = m.rows;
+    this->cols = m.cols;
+    this->padding = m.padding;
+    this->stride = m.stride;
+    this->length = m.length;
+    this->sub_matrix = m.sub_matrix;
+    this->ext_buff = m.ext_buff;
+    this->data = m.data;
+
+    if (m.ext_buff == false) {
+        // take the buffer, m is left as an empty 0x0 matrix
+        m.ext_buff = true;
+        m.data = NULL;
+        m.rows = 0;
+        m.cols = 0;
+        m.stride = 0;
+        m.length = 0;
+    } else if (m.sub_matrix == false) {
+        allocate();
+        memcpy(this->data, m.data, this->length * sizeof(float));
+    }
+}
+
 Mat Mat::getROI(int startRow, int startCol, int roiRows, int roiCols, int stride)
 {
     Mat result(this->data, roiRows, roiCols, 0);
@@ -173,7 +197,7 @@ void Mat::Copy(const Mat &src, int row_pos, int col_pos)
     }
 
     for (size_t r = 0; r < src.rows; r++) {
-        memcpy(&this->data[(r + row_pos) * this->stride + col_pos], &src.data[r * src.cols], src.cols * sizeof(float));
+        memcpy(&this->data[(r + row_pos) * this->stride + col_pos], &src.data[r * src.stride], src.cols * sizeof(float));
     }
 }
 
@@ -257,6 +281,39 @@ Mat &Mat::operator=(const Mat &m)
     return *this;
 }
 
+Mat &Mat::operator=(Mat &&m)
+{
+    if (this == &m) {
+        return *this;
+    }
+
+    // External buffers and sub-matrices keep their memory, and a matrix of the same size
+    // keeps its buffer so sub-matrices taken from it stay valid: the data is copied
+    if (this->ext_buff || m.ext_buff || ((this->rows == m.rows) && (this->cols == m.cols))) {
+        return (*this = static_cast<const Mat &>(m));
+    }
+
+    float *data = this->data;
+    int rows = this->rows;
+    int cols = this->cols;
+
+    this->data = m.data;
+    this->rows = m.rows;
+    this->cols = m.cols;
+    this->stride = m.stride;
+    this->padding = m.padding;
+    this->length = m.length;
+
+    // m releases the previous buffer of this matrix
+    m.data = data;
+    m.rows = rows;
+    m.cols = cols;
+    m.stride = cols;
+    m.padding = 0;
+    m.length = rows * cols;
+    return *this;
+}
+
 Mat &Mat::operator+=(const Mat &m)
 {
     if ((this->rows != m.rows) || (this->cols != m.cols)) {
@@ -731,7 +788,7 @@ Mat Mat::cofactor(int row, int col, int n)
 
                 // Row is filled, so increase row index and
                 // reset col index
-                if (j == this->rows - 1) {
+                if (j == n - 1) {
                     j = 0;
                     i++;
                 }
@@ -818,6 +875,126 @@ Mat Mat::inverse()
     return result;
 }
 
+void Mat::mulInto(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.cols != B.rows) || !checkSize("mulInto", result, A.rows, B.cols)) {
+        ESP_LOGW("Mat", "mulInto Error: matrices do not have correct dimensions");
+        return;
+    }
+    if ((result.data == A.data) || (result.data == B.data)) {
+        ESP_LOGW("Mat", "mulInto Error: result matrix must not share data with the inputs");
+        return;
+    }
+
+    if (A.sub_matrix || B.sub_matrix || result.sub_matrix) {
+        dspm_mult_ex_f32(A.data, B.data, result.data, A.rows, A.cols, B.cols, A.padding, B.padding, result.padding);
+    } else {
+        dspm_mult_f32(A.data, B.data, result.data, A.rows, A.cols, B.cols);
+    }
+}
+
+void Mat::mulTransInto(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.cols != B.cols) || !checkSize("mulTransInto", result, A.rows, B.rows)) {
+        ESP_LOGW("Mat", "mulTransInto Error: matrices do not have correct dimensions");
+        return;
+    }
+    if ((result.data == A.data) || (result.data == B.data)) {
+        ESP_LOGW("Mat", "mulTransInto Error: result matrix must not share data with the inputs");
+        return;
+    }
+
+    // Same accumulation order as dspm_mult_f32_ansi, so the result matches A*B.t() exactly
+    for (int i = 0; i < A.rows; i++) {
+        const float *a = &A.data[i * A.stride];
+        for (int j = 0; j < B.rows; j++) {
+            const float *b = &B.data[j * B.stride];
+            float acc = a[0] * b[0];
+            for (int s = 1; s < A.cols; s++) {
+                acc += a[s] * b[s];
+            }
+            result.data[i * result.stride + j] = acc;
+        }
+    }
+}
+
+void Mat::transMulInto(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.rows != B.rows) || !checkSize("transMulInto", result, A.cols, B.cols)) {
+        ESP_LOGW("Mat", "transMulInto Error: matrices do not have correct dimensions");
+        return;
+    }
+    if ((result.data == A.data) || (result.data == B.data)) {
+        ESP_LOGW("Mat", "transMulInto Error: result matrix must not share data with the inputs");
+        return;
+    }
+
+    // Same accumulation order as dspm_mult_f32_ansi, so the result matches A.t()*B exactly
+    for (int i = 0; i < A.cols; i++) {
+        for (int j = 0; j < B.cols; j++) {
+            float acc = A.data[i] * B.data[j];
+            for (int s = 1; s < A.rows; s++) {
+                acc += A.data[s * A.stride + i] * B.data[s * B.stride + j];
+            }
+            result.data[i * result.stride + j] = acc;
+        }
+    }
+}
+
+void Mat::addInto(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.rows != B.rows) || (A.cols != B.cols) || !checkSize("addInto", result, A.rows, A.cols)) {
+        ESP_LOGW("Mat", "addInto Error: matrices do not have equal dimensions");
+        return;
+    }
+
+    if (A.sub_matrix || B.sub_matrix || result.sub_matrix) {
+        dspm_add_f32(A.data, B.data, result.data, A.rows, A.cols, A.padding, B.padding, result.padding, 1, 1, 1);
+    } else {
+        dsps_add_f32(A.data, B.data, result.data, A.length, 1, 1, 1);
+    }
+}
+
+void Mat::subInto(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.rows != B.rows) || (A.cols != B.cols) || !checkSize("subInto", result, A.rows, A.cols)) {
+        ESP_LOGW("Mat", "subInto Error: matrices do not have equal dimensions");
+        return;
+    }
+
+    if (A.sub_matrix || B.sub_matrix || result.sub_matrix) {
+        dspm_sub_f32(A.data, B.data, result.data, A.rows, A.cols, A.padding, B.padding, result.padding, 1, 1, 1);
+    } else {
+        dsps_sub_f32(A.data, B.data, result.data, A.length, 1, 1, 1);
+    }
+}
+
+void Mat::transposeInto(const Mat &A, Mat &result)
+{
+    if (!checkSize("transposeInto", result, A.cols, A.rows)) {
+        return;
+    }
+    if (result.data == A.data) {
+        ESP_LOGW("Mat", "transposeInto Error: result matrix must not share data with the input");
+        return;
+    }
+
+    for (int i = 0; i < A.rows; ++i) {
+        for (int j = 0; j < A.cols; ++j) {
+            result.data[j * result.stride + i] = A.data[i * A.stride + j];
+        }
+    }
+}
+
+bool Mat::checkSize(const char *op, const Mat &m, int rows, int cols)
+{
+    if ((m.rows != rows) || (m.cols != cols)) {
+        ESP_LOGE("Mat", "%s Error: matrix dimensions %dx%d, expected %dx%d", op, m.rows, m.cols, rows, cols);
+        return false;
+    }
+    return true;
+}
+
 void Mat::allocate()
 {
     this->ext_buff = false;
@@ -853,7 +1030,8 @@ Mat operator+(const Mat &m1, const Mat &m2)
         return temp;
     } else {
         Mat temp(m1);
-        return (temp += m2);
+        temp += m2;
+        return temp;
     }
 }
 
@@ -865,7 +1043,8 @@ Mat operator+(const Mat &m, float C)
         return temp;
     } else {
         Mat temp(m);
-        return (temp += C);
+        temp += C;
+        return temp;
     }
 }
 
@@ -901,7 +1080,8 @@ Mat operator-(const Mat &m1, const Mat &m2)
         return temp;
     } else {
         Mat temp(m1);
-        return (temp -= m2);
+        temp -= m2;
+        return temp;
     }
 }
 
@@ -913,7 +1093,8 @@ Mat operator-(const Mat &m, float C)
         return temp;
     } else {
         Mat temp(m);
-        return (temp -= C);
+        temp -= C;
+        return temp;
     }
 }
 
@@ -944,7 +1125,8 @@ Mat operator*(const Mat &m, float num)
         return temp;
     } else {
         Mat temp(m);
-        return (temp *= num);
+        temp *= num;
+        return temp;
     }
 }
 
@@ -961,7 +1143,8 @@ Mat operator/(const Mat &m, float num)
         return temp;
     } else {
         Mat temp(m);
-        return (temp /= num);
+        temp /= num;
+        return temp;
     }
 }
 
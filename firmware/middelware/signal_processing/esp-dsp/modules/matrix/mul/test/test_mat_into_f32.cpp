@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: 2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <utility>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dspm_mult.h"
+#include "dsp_tests.h"
+#include "mat.h"
+#include "test_mat_common.h"
+
+static const char *TAG = "[dspm]";
+
+#define MAT_M 5     // rows of A
+#define MAT_N 4     // cols of A, rows of B
+#define MAT_K 3     // cols of B
+
+// the destination variants must give bit exact the same result as the operators
+static void test_assert_identical_mat_mat(const dspm::Mat &m_expected, const dspm::Mat &m_actual, const char *message)
+{
+    TEST_ASSERT_EQUAL_INT_MESSAGE(m_expected.rows, m_actual.rows, message);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(m_expected.cols, m_actual.cols, message);
+    for (int row = 0; row < m_expected.rows; row++) {
+        for (int col = 0; col < m_expected.cols; col++) {
+            TEST_ASSERT_MESSAGE(m_expected(row, col) == m_actual(row, col), message);
+        }
+    }
+}
+
+static void test_mat_fill(dspm::Mat &m, float offset)
+{
+    for (int row = 0; row < m.rows; row++) {
+        for (int col = 0; col < m.cols; col++) {
+            m(row, col) = offset + (float)((row * 7 + col * 3) % 11) / 7.0f;
+        }
+    }
+}
+
+static void test_mat_into_full()
+{
+    dspm::Mat A(MAT_M, MAT_N);
+    dspm::Mat B(MAT_N, MAT_K);
+    dspm::Mat Bt(MAT_K, MAT_N);
+    dspm::Mat A2(MAT_M, MAT_N);
+    test_mat_fill(A, 0.1f);
+    test_mat_fill(B, -0.3f);
+    test_mat_fill(Bt, 0.7f);
+    test_mat_fill(A2, -1.1f);
+
+    dspm::Mat C(MAT_M, MAT_K);
+    dspm::Mat::mulInto(A, B, C);
+    test_assert_identical_mat_mat(A * B, C, "mulInto");
+
+    dspm::Mat D(MAT_M, MAT_K);
+    dspm::Mat::mulTransInto(A, Bt, D);
+    test_assert_identical_mat_mat(A * Bt.t(), D, "mulTransInto");
+
+    dspm::Mat E(MAT_N, MAT_N);
+    dspm::Mat::transMulInto(A, A2, E);
+    test_assert_identical_mat_mat(A.t() * A2, E, "transMulInto");
+
+    dspm::Mat F(MAT_M, MAT_N);
+    dspm::Mat::addInto(A, A2, F);
+    test_assert_identical_mat_mat(A + A2, F, "addInto");
+    dspm::Mat::subInto(A, A2, F);
+    test_assert_identical_mat_mat(A - A2, F, "subInto");
+
+    dspm::Mat G(MAT_N, MAT_M);
+    dspm::Mat::transposeInto(A, G);
+    test_assert_identical_mat_mat(A.t(), G, "transposeInto");
+
+    // the result of addInto/subInto can be one of the operands
+    dspm::Mat H = A;
+    dspm::Mat::addInto(H, A2, H);
+    test_assert_identical_mat_mat(A + A2, H, "addInto in place");
+
+    // wrong result size: the result matrix is not modified
+    dspm::Mat W(MAT_K, MAT_K);
+    W.clear();
+    dspm::Mat::mulInto(A, B, W);
+    test_assert_equal_mat_const(W, 0, "mulInto wrong size");
+}
+
+static void test_mat_into_sub()
+{
+    dspm::Mat A_full(MAT_M + 2, MAT_N + 2);
+    dspm::Mat B_full(MAT_N + 1, MAT_K + 3);
+    dspm::Mat C_full(MAT_M + 1, MAT_K + 2);
+    test_mat_fill(A_full, 0.2f);
+    test_mat_fill(B_full, -0.4f);
+    C_full.clear();
+
+    dspm::Mat A = A_full.getROI(1, 2, MAT_M, MAT_N);
+    dspm::Mat B = B_full.getROI(1, 0, MAT_N, MAT_K);
+    dspm::Mat C = C_full.getROI(1, 1, MAT_M, MAT_K);
+
+    dspm::Mat::mulInto(A, B, C);
+    test_assert_identical_mat_mat(A * B, C, "mulInto sub-matrix");
+
+    dspm::Mat Bt = B_full.getROI(0, 0, MAT_K, MAT_N);
+    dspm::Mat::mulTransInto(A, Bt, C);
+    test_assert_identical_mat_mat(A * Bt.t(), C, "mulTransInto sub-matrix");
+
+    // the area around the sub-matrix is not modified
+    for (int col = 0; col < C_full.cols; col++) {
+        TEST_ASSERT_EQUAL_FLOAT(0, C_full(0, col));
+    }
+    for (int row = 0; row < C_full.rows; row++) {
+        TEST_ASSERT_EQUAL_FLOAT(0, C_full(row, 0));
+    }
+}
+
+static void test_mat_fixed()
+{
+    dspm::MatFixed<MAT_M, MAT_N> A;
+    dspm::MatFixed<MAT_N, MAT_K> B;
+    dspm::MatFixed<MAT_M, MAT_K> C;
+    test_assert_equal_mat_const(A, 0, "MatFixed constructor");
+    test_mat_fill(A, 0.3f);
+    test_mat_fill(B, -0.2f);
+
+    dspm::Mat::mulInto(A, B, C);
+    test_assert_identical_mat_mat(A * B, C, "MatFixed mulInto");
+
+    // copy and assignment keep the internal storage
+    dspm::MatFixed<MAT_M, MAT_K> D(C);
+    TEST_ASSERT_TRUE(D.data != C.data);
+    test_assert_identical_mat_mat(C, D, "MatFixed copy");
+    float *data = D.data;
+    D = A * B;
+    TEST_ASSERT_TRUE(D.data == data);
+    test_assert_identical_mat_mat(C, D, "MatFixed assignment");
+
+    // a matrix of a different size is not assigned
+    D = A;
+    TEST_ASSERT_EQUAL_INT(MAT_M, D.rows);
+    TEST_ASSERT_EQUAL_INT(MAT_K, D.cols);
+    test_assert_identical_mat_mat(C, D, "MatFixed wrong size");
+}
+
+static void test_mat_move()
+{
+    dspm::Mat A(MAT_M, MAT_N);
+    test_mat_fill(A, 0.5f);
+
+    // a temporary moved into an owning matrix of another size gives its buffer
+    dspm::Mat B(2, 2);
+    dspm::Mat C = A * 2;
+    float *data = C.data;
+    B = std::move(C);
+    TEST_ASSERT_TRUE(B.data == data);
+    test_assert_identical_mat_mat(A * 2, B, "move assignment");
+
+    // a matrix of the same size keeps its buffer, so its sub-matrices stay valid
+    dspm::Mat S = B.getROI(1, 1, 2, 2);
+    B = A * 3;
+    TEST_ASSERT_TRUE(B.data == data);
+    test_assert_identical_mat_mat(B.getROI(1, 1, 2, 2), S, "move assignment same size");
+
+    // the moved matrix owns its buffer
+    dspm::Mat D(std::move(B));
+    TEST_ASSERT_TRUE(D.data == data);
+    test_assert_identical_mat_mat(A * 3, D, "move constructor");
+
+    // external buffers are never taken
+    float ext[MAT_M * MAT_N];
+    dspm::Mat E(ext, MAT_M, MAT_N);
+    E = A * 2;
+    TEST_ASSERT_TRUE(E.data == ext);
+    test_assert_identical_mat_mat(A * 2, E, "move assignment to external buffer");
+}
+
+static void test_mat_inverse_4x4()
+{
+    float data[16] = {4, 1, 0, 2,
+                      1, 5, 1, 0,
+                      0, 1, 6, 1,
+                      2, 0, 1, 7
+                     };
+    dspm::Mat A(data, 4, 4);
+    dspm::Mat I = A * A.inverse();
+    for (int row = 0; row < 4; row++) {
+        for (int col = 0; col < 4; col++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5f, (row == col) ? 1 : 0, I(row, col));
+        }
+    }
+}
+
+TEST_CASE("Mat class destination operations", TAG)
+{
+    test_mat_into_full();
+    test_mat_into_sub();
+    test_mat_fixed();
+    test_mat_move();
+    test_mat_inverse_4x4();
+}
@@ -0,0 +1,133 @@
+#ifndef DECIMATOR_H_
+#define DECIMATOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Decimator Decimator
+ */
+
+/** \brief Multi-rate decimation of oversampled ADC streams
+ * 
+ * A chain of up to DECIMATOR_MAX_STAGES decimating FIR stages (x2, x4 or x8 each), using the 
+ * esp-dsp dsps_fird_f32 / dsps_fird_s16 kernels: only the output samples that are kept are 
+ * calculated. Raw ADC blocks (uint16) are converted and filtered to float or Q15 blocks, and 
+ * the state of every stage is kept between calls.
+ * 
+ * Each stage uses a windowed sinc (Blackman) anti-alias filter of 
+ * DECIMATOR_TAPS_PER_FACTOR * factor - 1 taps, designed with DecimatorDesign, so every stage 
+ * costs about DECIMATOR_TAPS_PER_FACTOR multiplications per input sample.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Initialization fails when a stage is not initialized by esp-dsp		|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define DECIMATOR_MAX_STAGES        3       /*!< Up to x512 decimation */
+#define DECIMATOR_TAPS_PER_FACTOR   16      /*!< Filter lenght of each stage: 31, 63 or 127 taps */
+#define DECIMATOR_CUTOFF            0.9f    /*!< Cut-off frequency (-6 dB) relative to the output Nyquist frequency */
+
+/*==================[typedef]================================================*/
+typedef enum decimator_format {
+    DECIMATOR_FLOAT,        /*!< Float output, in ADC units */
+    DECIMATOR_Q15           /*!< Q15 output, ADC samples shifted to the Q15 range */
+} decimator_format_t;
+
+/**
+ * @brief Decimator chain
+ */
+typedef struct {
+    decimator_format_t format;                      /*!< Output format */
+    uint8_t stages;                                 /*!< Number of stages */
+    uint16_t factor;                                /*!< Total decimation factor */
+    uint16_t block;                                 /*!< Maximun input samples per call */
+    uint16_t offset;                                /*!< Subtracted from the ADC samples */
+    uint8_t shift;                                  /*!< Left shift of the ADC samples (Q15) */
+    fir_f32_t fir[DECIMATOR_MAX_STAGES];            /*!< Float stages */
+    fir_s16_t fir_q15[DECIMATOR_MAX_STAGES];        /*!< Q15 stages */
+    void * coeffs[DECIMATOR_MAX_STAGES];            /*!< Coefficients of each stage (float or Q15) */
+    void * delay[DECIMATOR_MAX_STAGES];             /*!< Delay line of each stage (float or Q15) */
+    void * buffer;                                  /*!< Work buffer (block values, float or Q15) */
+} decimator_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design an anti-alias low pass filter for decimation (windowed sinc, unity DC gain)
+ * 
+ * @param coeffs        Array to store the filter coefficients (of lenght = taps)
+ * @param taps          Number of coefficients (odd, for a symmetric filter)
+ * @param factor        Decimation factor (cut-off at DECIMATOR_CUTOFF / factor times the input Nyquist frequency)
+ * @return true         Filter designed
+ * @return false        Invalid parameters
+ */
+bool DecimatorDesign(float * coeffs, uint16_t taps, uint8_t factor);
+
+/**
+ * @brief Initialize a decimator chain
+ * 
+ * @param dec           Decimator
+ * @param format        Output format (DECIMATOR_FLOAT or DECIMATOR_Q15)
+ * @param factors       Decimation factor of each stage (2, 4 or 8)
+ * @param stages        Number of stages (1 to DECIMATOR_MAX_STAGES)
+ * @param block_lenght  Maximun number of ADC samples per call
+ * @param offset        Value subtracted from the ADC samples (e.g. mid scale)
+ * @param shift         Left shift applied to the ADC samples after the offset (Q15 only)
+ * @return true         Decimator initialized
+ * @return false        Invalid parameters, out of memory or stage not supported by the esp-dsp kernels
+ */
+bool DecimatorInit(decimator_t * dec, decimator_format_t format, const uint8_t * factors, uint8_t stages, 
+    uint16_t block_lenght, uint16_t offset, uint8_t shift);
+
+/**
+ * @brief Free the memory used by a decimator chain
+ * 
+ * @param dec           Decimator
+ */
+void DecimatorDeinit(decimator_t * dec);
+
+/**
+ * @brief Return the total decimation factor of a chain
+ * 
+ * @param dec           Decimator
+ * @return uint16_t     Product of the factors of every stage
+ */
+uint16_t DecimatorFactor(const decimator_t * dec);
+
+/**
+ * @brief Decimate a block of ADC samples (float output)
+ * 
+ * @param dec           Decimator initialized with DECIMATOR_FLOAT
+ * @param adc           ADC samples (of lenght = adc_lenght)
+ * @param adc_lenght    Multiple of the total decimation factor, up to block_lenght
+ * @param output        Decimated signal (of lenght = adc_lenght / DecimatorFactor)
+ * @return uint16_t     Number of output samples (0 on invalid lenght or format)
+ */
+uint16_t DecimatorProcess(decimator_t * dec, const uint16_t * adc, uint16_t adc_lenght, float * output);
+
+/**
+ * @brief Decimate a block of ADC samples (Q15 output)
+ * 
+ * @param dec           Decimator initialized with DECIMATOR_Q15
+ * @param adc           ADC samples (of lenght = adc_lenght)
+ * @param adc_lenght    Multiple of the total decimation factor, up to block_lenght
+ * @param output        Decimated signal (of lenght = adc_lenght / DecimatorFactor)
+ * @return uint16_t     Number of output samples (0 on invalid lenght or format)
+ */
+uint16_t DecimatorProcessQ15(decimator_t * dec, const uint16_t * adc, uint16_t adc_lenght, int16_t * output);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DECIMATOR_H_ */
+
+/*==================[end of file]============================================*/
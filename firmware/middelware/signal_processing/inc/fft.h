@@ -16,6 +16,11 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 17/10/2026 | Add fixed point (Q15) FFT magnitude for raw ADC samples				|
+ * | 17/10/2026 | Add real input FFT plans (N/2 points complex FFT)						|
+ * | 17/10/2026 | Q15 FFT magnitude with N/2 points complex FFT							|
+ * | 17/10/2026 | Q15 FFT plans allocated at init, lenght of FFTMagnitudeQ15 validated	|
+ * | 17/10/2026 | FFTMagnitude documented as not reentrant								|
  * 
  **/
 
@@ -24,7 +29,33 @@
 #include <stdbool.h>
 /*==================[macros]=================================================*/
 #define MAX_SIGNAL_LENGHT   2048
+#define FFT_Q15_INPUT_SHIFT 2       /*!< 12 bit samples are scaled to Q15 keeping 1 bit of headroom for the butterflies */
 /*==================[typedef]================================================*/
+/**
+ * @brief Real input FFT plan
+ * 
+ * Window and twiddles for one signal lenght, calculated once by FFTPlanInit. 
+ * Several plans (of different lenghts) can be used at the same time.
+ */
+typedef struct {
+    uint16_t signal_lenght;     /*!< Number of real samples */
+    float * wind;               /*!< Hann window (signal_lenght values) */
+    float * twiddle;            /*!< Real split twiddles, cos and sin of 2*pi*k/signal_lenght (k = 0 .. signal_lenght/4) */
+} fft_plan_t;
+
+/**
+ * @brief Fixed point (Q15) real input FFT plan
+ * 
+ * Window, twiddles and work buffer for one signal lenght, allocated by FFTPlanInitQ15 
+ * and freed by FFTPlanDeinitQ15. Several plans (of different lenghts) can be used at 
+ * the same time, but each one by a single task (the buffer is shared by its calls).
+ */
+typedef struct {
+    uint16_t signal_lenght;     /*!< Number of real samples */
+    int16_t * wind;             /*!< Q15 Hann window (signal_lenght values) */
+    int16_t * twiddle;          /*!< Q15 real split twiddles, cos and sin of 2*pi*k/signal_lenght (k = 0 .. signal_lenght/4) */
+    int16_t * buffer;           /*!< Windowed signal and its FFT, signal_lenght/2 complex points */
+} fft_q15_plan_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -40,7 +71,12 @@ bool FFTInit(void);
 /**
  * @brief Calculates the Fast Fourier Transform of a given signal
  * 
+ * Uses an internal plan (only recalculated when the lenght changes) and a copy of the
+ * signal, so the signal array is not modified.
+ * 
  * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * @note  Not reentrant: the internal plan is freed when the lenght changes. Tasks calculating 
+ *        the FFT at the same time must use their own plans (FFTPlanInit and FFTPlanMagnitude)
  * 
  * @param signal            Array with signal values (of lenght = signal_lenght)
  * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
@@ -48,6 +84,102 @@ bool FFTInit(void);
  */
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
 
+/**
+ * @brief Initialize a real input FFT plan
+ * 
+ * @note  Also initializes the FFT calculation module (as FFTInit)
+ * 
+ * @param plan              Plan to initialize
+ * @param signal_lenght     Lenght of signal arrays, power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * @return true     Plan initialized
+ * @return false    Not possible to initialize plan (invalid lenght or out of memory)
+ */
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght);
+
+/**
+ * @brief Free the window and twiddles of a real input FFT plan
+ * 
+ * @param plan              Plan to deinitialize
+ */
+void FFTPlanDeinit(fft_plan_t * plan);
+
+/**
+ * @brief Calculates the Fast Fourier Transform magnitude of a signal with a real input FFT plan
+ * 
+ * The signal is packed as signal_lenght/2 complex points, so the complex FFT is half the size 
+ * of the one used by FFTMagnitude. Works in place: the signal array is overwritten.
+ * 
+ * @param plan              Plan for the signal lenght
+ * @param signal            Array with signal values (of lenght = plan->signal_lenght), overwritten
+ * @param fft               Array to store FFT magnitude values (of lenght = plan->signal_lenght / 2), can be the signal array
+ */
+void FFTPlanMagnitude(const fft_plan_t * plan, float * signal, float * fft);
+
+/**
+ * @brief Initialize the fixed point (Q15) FFT calculation module
+ * 
+ * @note  The Q15 twiddles of the complex FFT are allocated on the first call and kept
+ * 
+ * @return true     FFT initialized
+ * @return false    Not possible to initialize FFT
+ */
+bool FFTInitQ15(void);
+
+/**
+ * @brief Initialize a fixed point (Q15) real input FFT plan
+ * 
+ * @note  Also initializes the Q15 FFT calculation module (as FFTInitQ15)
+ * 
+ * @param plan              Plan to initialize
+ * @param signal_lenght     Lenght of signal arrays, power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * @return true     Plan initialized
+ * @return false    Not possible to initialize plan (invalid lenght or out of memory)
+ */
+bool FFTPlanInitQ15(fft_q15_plan_t * plan, uint16_t signal_lenght);
+
+/**
+ * @brief Free the window, twiddles and buffer of a Q15 real input FFT plan
+ * 
+ * @param plan              Plan to deinitialize
+ */
+void FFTPlanDeinitQ15(fft_q15_plan_t * plan);
+
+/**
+ * @brief Calculates the Fast Fourier Transform magnitude of a signal of raw ADC samples with a Q15 plan
+ * 
+ * Fixed point version of FFTPlanMagnitude: the signal is windowed with the Q15 Hann window
+ * of the plan and transformed with a Q15 FFT of signal_lenght / 2 complex points, and the 
+ * magnitude is calculated with integer arithmetic. The signal array is not modified.
+ * 
+ * @note  The FFT is scaled on every stage, the magnitude resolution is 1 ADC count
+ * @note  On a host with a floating point unit (as the benchmark) FFTPlanMagnitude is faster
+ * 
+ * @param plan              Plan for the signal lenght
+ * @param signal            Array with 12 bit signal values, signed or unsigned (of lenght = plan->signal_lenght)
+ * @param fft               Array to store FFT magnitude values, same scale as FFTMagnitude (of lenght = plan->signal_lenght / 2)
+ * @return true     Magnitude calculated
+ * @return false    FFT error (Q15 FFT calculation module not initialized)
+ */
+bool FFTPlanMagnitudeQ15(const fft_q15_plan_t * plan, const int16_t * signal, uint16_t * fft);
+
+/**
+ * @brief Calculates the Fast Fourier Transform magnitude of a signal of raw ADC samples
+ * 
+ * Fixed point version of FFTMagnitude, with an internal Q15 plan (only recalculated when 
+ * the lenght changes): see FFTPlanMagnitudeQ15. It takes half the RAM of the float version
+ * and avoids the software floating point of the ESP32-C6.
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * @note  Not reentrant: tasks calculating the FFT at the same time must use their own plans
+ * 
+ * @param signal            Array with 12 bit signal values, signed or unsigned (of lenght = signal_lenght)
+ * @param fft               Array to store FFT magnitude values, same scale as FFTMagnitude (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal arrays
+ * @return true     Magnitude calculated
+ * @return false    Invalid lenght, out of memory or FFT error
+ */
+bool FFTMagnitudeQ15(const int16_t * signal, uint16_t * fft, uint16_t signal_lenght);
+
 /**
  * @brief Return the FFT frequency axis vector
  * 
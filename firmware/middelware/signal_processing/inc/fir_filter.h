@@ -0,0 +1,119 @@
+#ifndef FIR_FILTER_H_
+#define FIR_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup FIR_Filter FIR Filter
+ */
+
+/** \brief Block streaming FIR filters
+ * 
+ * Short filters are calculated in direct form (dsps_fir_f32). Filters with FIR_FFT_MIN_TAPS 
+ * taps or more are calculated with overlap-save FFT convolution: two consecutive blocks are 
+ * filtered with one complex FFT (one as real part and the other as imaginary part), at the cost
+ * of a latency of FIRFilterLatency() samples. FIRFilterInitEngine forces one of them (the
+ * benchmark sweeps both over the tap count to find the crossover).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Engine selectable with FIRFilterInitEngine							|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define FIR_FFT_MIN_TAPS    64      /*!< Minimum number of taps to use FFT convolution */
+#define FIR_MAX_TAPS        1024    /*!< Maximum number of taps (FFT size of 2048) */
+/*==================[typedef]================================================*/
+typedef enum fir_engine {
+    FIR_ENGINE_AUTO = 0,        /*!< Direct form below FIR_FFT_MIN_TAPS taps, FFT convolution from them */
+    FIR_ENGINE_DIRECT,          /*!< Direct form (dsps_fir_f32) */
+    FIR_ENGINE_FFT              /*!< Overlap-save FFT convolution */
+} fir_engine_t;
+
+/**
+ * @brief FIR filter handle
+ * 
+ * Each handle owns its coefficients and state. Declare one per filter and initialize it with FIRFilterInit.
+ */
+typedef struct {
+    uint16_t taps;              /*!< Number of coefficients */
+    uint16_t fft_size;          /*!< FFT size, 0 for direct form */
+    uint16_t block;             /*!< New samples per FFT (two overlap-save blocks) */
+    uint16_t count;             /*!< Samples of the current block */
+    fir_f32_t fir;              /*!< Direct form filter */
+    float * coeffs;             /*!< Direct form: reversed coefficients. FFT: spectrum of the coefficients (fft_size complex values) */
+    float * input;              /*!< Direct form: delay line. FFT: last taps - 1 samples followed by the current block */
+    float * output;             /*!< FFT: outputs of the previous block */
+    float * buffer;             /*!< FFT: work buffer (fft_size complex values) */
+} fir_filter_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a FIR filter
+ * 
+ * @note  FFT convolution also initializes the FFT tables (as FFTInit)
+ * 
+ * @param filter        Filter handle
+ * @param coeffs        Filter coefficients, h[0] applies to the newest sample (copied)
+ * @param taps          Number of coefficients (1 to FIR_MAX_TAPS)
+ * @return true         Filter initialized
+ * @return false        Invalid parameters or out of memory
+ */
+bool FIRFilterInit(fir_filter_t * filter, const float * coeffs, uint16_t taps);
+
+/**
+ * @brief Initialize a FIR filter with a given engine
+ * 
+ * @note  FFT convolution also initializes the FFT tables (as FFTInit)
+ * 
+ * @param filter        Filter handle
+ * @param coeffs        Filter coefficients, h[0] applies to the newest sample (copied)
+ * @param taps          Number of coefficients (1 to FIR_MAX_TAPS)
+ * @param engine        Direct form, FFT convolution or chosen by the number of taps (as FIRFilterInit)
+ * @return true         Filter initialized
+ * @return false        Invalid parameters or out of memory
+ */
+bool FIRFilterInitEngine(fir_filter_t * filter, const float * coeffs, uint16_t taps, fir_engine_t engine);
+
+/**
+ * @brief Free the memory used by a FIR filter
+ * 
+ * @param filter        Filter handle
+ */
+void FIRFilterDeinit(fir_filter_t * filter);
+
+/**
+ * @brief Apply a FIR filter to a signal array
+ * 
+ * The state is kept between calls, so a signal can be filtered in blocks of any size.
+ * 
+ * @param filter            Filter handle
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (delayed FIRFilterLatency() samples), can be the input array
+ * @param signal_lenght     Number of samples of both signals
+ */
+void FIRFilterApply(fir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Return the delay introduced by the block processing (not including the filter's own group delay)
+ * 
+ * @param filter        Filter handle
+ * @return uint16_t     Latency in samples (0 for direct form)
+ */
+uint16_t FIRFilterLatency(const fir_filter_t * filter);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FIR_FILTER_H_ */
+
+/*==================[end of file]============================================*/
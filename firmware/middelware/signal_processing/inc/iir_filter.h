@@ -16,12 +16,17 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 17/10/2026 | Add handle based multi-channel filters (fused biquad cascade)			|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 /*==================[macros]=================================================*/
+#define IIR_MAX_SECTIONS    4       /*!< 2nd order sections of an 8th order filter */
+#define IIR_MAX_CHANNELS    9       /*!< e.g. 3 ADC inputs plus 6 IMU axes */
+#define IIR_SOS_COEFFS      5       /*!< b0, b1, b2, a1, a2 */
 
 /*==================[typedef]================================================*/
 typedef enum filter_order {
@@ -30,9 +35,61 @@ typedef enum filter_order {
     ORDER_6 = 6,        /*!< 6th order filter */
     ORDER_8 = 8         /*!< 8th order filter */
 } filter_order_t;
+
+typedef enum filter_type {
+    IIR_LOW_PASS,       /*!< Butterworth low pass filter */
+    IIR_HI_PASS         /*!< Butterworth hi pass filter */
+} filter_type_t;
+
+/**
+ * @brief IIR filter handle
+ * 
+ * Each handle owns its coefficients and the state of every channel, so any number of 
+ * filters can be used at the same time. Declare one per filter and initialize it with IIRFilterInit.
+ */
+typedef struct {
+    uint8_t sections;                                           /*!< Number of 2nd order sections (order / 2) */
+    uint8_t channels;                                           /*!< Number of interleaved channels */
+    float coeff[IIR_MAX_SECTIONS][IIR_SOS_COEFFS];              /*!< Coefficients of each section */
+    float delay[IIR_MAX_CHANNELS][IIR_MAX_SECTIONS][2];         /*!< State of each section, for each channel */
+} iir_filter_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a Butterworth filter handle
+ * 
+ * @param filter        Filter handle
+ * @param type          Filter's type (IIR_LOW_PASS or IIR_HI_PASS)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @param channels      Number of interleaved channels to filter (1 to IIR_MAX_CHANNELS)
+ * @return true         Filter initialized
+ * @return false        Invalid parameters
+ */
+bool IIRFilterInit(iir_filter_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order, uint8_t channels);
+
+/**
+ * @brief Clear the state of every channel of a filter
+ * 
+ * @param filter        Filter handle
+ */
+void IIRFilterReset(iir_filter_t * filter);
+
+/**
+ * @brief Apply a filter to a (multi-channel) signal array
+ * 
+ * All the sections are calculated for each sample in one pass. Channels are interleaved:
+ * sample n of channel c is at [n * channels + c].
+ * 
+ * @param filter            Filter handle
+ * @param input_signal      Input signal array (of lenght = signal_lenght * channels)
+ * @param output_signal     Filtered signal array (of lenght = signal_lenght * channels), can be the input array
+ * @param signal_lenght     Number of samples of each channel
+ */
+void IIRFilterApply(iir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght);
+
 /**
  * @brief Initialize a 2nd order Butterwotrh Low Pass Filter
  * 
@@ -0,0 +1,118 @@
+#ifndef QRS_DETECTOR_H_
+#define QRS_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup QRS_Detector QRS Detector
+ */
+
+/** \brief Streaming QRS detection (Pan-Tompkins)
+ * 
+ * Each ECG sample goes through a 5-15 Hz band-pass (IIR filter handles), a five point 
+ * derivative, squaring and a 150 ms moving window integration. Peaks of the integrated signal 
+ * are classified with adaptive signal/noise thresholds, a 200 ms refractory period, T wave 
+ * discrimination (360 ms) and searchback after 1.66 times the average RR interval.
+ * 
+ * Memory is constant (no allocation) and the first 2 seconds are used to learn the thresholds.
+ * Beats are reported at the R peak of the band-pass filtered signal, so timestamps include 
+ * the band-pass group delay (about 15 ms).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Non finite samples skipped, parameters validated						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "iir_filter.h"
+/*==================[macros]=================================================*/
+#define QRS_MAX_WINDOW      160     /*!< Integration window of 150 ms up to 1066 Hz */
+#define QRS_RR_AVERAGE      8       /*!< RR intervals in the average */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Detected beat
+ */
+typedef struct {
+    uint32_t sample;                /*!< Sample number of the R peak (since initialization) */
+    uint32_t rr;                    /*!< Samples since the previous beat (0 for the first one) */
+    float heart_rate;               /*!< Instantaneous heart rate in bpm (0 for the first beat) */
+} qrs_beat_t;
+
+/**
+ * @brief QRS detector
+ */
+typedef struct {
+    iir_filter_t hi_pass;           /*!< Band-pass, 5 Hz hi pass */
+    iir_filter_t low_pass;          /*!< Band-pass, 15 Hz low pass */
+    float sample_frec;              /*!< Sample frequency */
+    float offset;                   /*!< First sample (removed to avoid the filter's step response) */
+    uint32_t n;                     /*!< Samples processed */
+    uint16_t window;                /*!< Integration window */
+    uint16_t pos;                   /*!< Position in the window ring buffers */
+    uint16_t refractory;            /*!< Refractory period (200 ms) */
+    uint16_t t_wave;                /*!< T wave discrimination period (360 ms) */
+    uint32_t learning;              /*!< Learning period (2 s) */
+    float derivative[4];            /*!< Last band-pass values */
+    float band_pass[QRS_MAX_WINDOW];/*!< Band-pass values of the last window */
+    float squared[QRS_MAX_WINDOW];  /*!< Squared derivative values of the last window */
+    float sum;                      /*!< Sum of the squared window */
+    float mwi[2];                   /*!< Last two integrated values */
+    float spki;                     /*!< Signal peak level */
+    float npki;                     /*!< Noise peak level */
+    float threshold;                /*!< Detection threshold */
+    uint32_t last_qrs;              /*!< Sample number of the last QRS integrated peak */
+    uint32_t last_r;                /*!< Sample number of the last R peak */
+    float last_slope;               /*!< Slope of the last QRS */
+    bool beat;                      /*!< At least one beat detected */
+    float search_peak;              /*!< Highest noise peak since the last QRS (for searchback) */
+    uint32_t search_qrs;            /*!< Sample number of the searchback integrated peak */
+    uint32_t search_r;              /*!< Sample number of the searchback R peak */
+    float search_slope;             /*!< Slope of the searchback peak */
+    uint32_t rr[QRS_RR_AVERAGE];    /*!< Last RR intervals */
+    uint8_t rr_count;               /*!< RR intervals stored */
+    uint8_t rr_pos;                 /*!< Next RR interval to write */
+    uint32_t rr_average;            /*!< Average RR interval */
+} qrs_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a QRS detector
+ * 
+ * @param qrs           QRS detector
+ * @param sample_frec   ECG sample frequency (100 Hz to 1066 Hz)
+ * @return true         QRS detector initialized
+ * @return false        Invalid parameters or sample frequency
+ */
+bool QRSDetectorInit(qrs_detector_t * qrs, float sample_frec);
+
+/**
+ * @brief Process one ECG sample
+ * 
+ * Beats are reported with a latency of about 100 ms after the R peak (integration window),
+ * and beats found by searchback up to 1.66 RR intervals later.
+ * 
+ * @note  Non finite samples (a NaN would stay in the band-pass filter forever) are skipped:
+ *        they are not counted in the sample numbers
+ * 
+ * @param qrs           QRS detector
+ * @param sample        ECG sample
+ * @param beat          Detected beat (only written when true is returned)
+ * @return true         A beat was detected
+ * @return false        No beat detected, non finite sample or invalid parameters
+ */
+bool QRSDetectorUpdate(qrs_detector_t * qrs, float sample, qrs_beat_t * beat);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* QRS_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,153 @@
+#ifndef TONE_TRACKING_H_
+#define TONE_TRACKING_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Tone_Tracking Tone Tracking
+ */
+
+/** \brief Magnitude of a few frequency bins, updated sample by sample
+ * 
+ * Two alternatives to FFTMagnitude when only some frequencies are needed:
+ * - Goertzel bank: magnitudes of any frequencies, updated once per block of samples.
+ * - Sliding DFT: magnitudes of DFT bins, updated on every sample.
+ * 
+ * Both process one sample per call in O(bins), so they can be called from the acquisition 
+ * task, and their magnitudes use the same Hann window and scale as FFTMagnitude.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Parameters validated before the bank is modified						|
+ * | 17/10/2026 | Sliding DFT parameters validated, history freed on initialization		|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define TONE_MAX_BINS       32          /*!< Maximum number of frequencies of a Goertzel bank or sliding DFT */
+#define SDFT_DAMPING        0.99999f    /*!< Sliding DFT pole radius, keeps rounding errors from accumulating */
+/*==================[typedef]================================================*/
+/**
+ * @brief Goertzel bank
+ */
+typedef struct {
+    uint8_t bins;                       /*!< Number of frequencies */
+    uint16_t block_lenght;              /*!< Samples per block */
+    uint16_t count;                     /*!< Samples of the current block */
+    float coeff[TONE_MAX_BINS];         /*!< 2 cos(w) of each frequency */
+    float scale[TONE_MAX_BINS];         /*!< Magnitude scale of each frequency */
+    float s1[TONE_MAX_BINS];            /*!< Filter state s[n-1] */
+    float s2[TONE_MAX_BINS];            /*!< Filter state s[n-2] */
+    float magnitude[TONE_MAX_BINS];     /*!< Magnitudes of the last complete block */
+    float wind_cos;                     /*!< Hann window oscillator (cosine) */
+    float wind_sin;                     /*!< Hann window oscillator (sine) */
+    float wind_step_cos;                /*!< Hann window oscillator step (cosine) */
+    float wind_step_sin;                /*!< Hann window oscillator step (sine) */
+} goertzel_t;
+
+/**
+ * @brief Sliding DFT
+ * 
+ * Each frequency is tracked with 3 bins (k - 1, k and k + 1) to apply the Hann window in the frequency domain.
+ */
+typedef struct {
+    uint8_t bins;                       /*!< Number of frequencies */
+    uint16_t window_lenght;             /*!< DFT lenght */
+    uint16_t pos;                       /*!< Position of the oldest sample in history */
+    float * history;                    /*!< Last window_lenght samples */
+    float damping_n;                    /*!< SDFT_DAMPING ^ window_lenght */
+    float rot_re[3 * TONE_MAX_BINS];    /*!< SDFT_DAMPING * exp(j 2 pi k / window_lenght) of each bin (real part) */
+    float rot_im[3 * TONE_MAX_BINS];    /*!< SDFT_DAMPING * exp(j 2 pi k / window_lenght) of each bin (imaginary part) */
+    float dft_re[3 * TONE_MAX_BINS];    /*!< DFT of each bin (real part) */
+    float dft_im[3 * TONE_MAX_BINS];    /*!< DFT of each bin (imaginary part) */
+    float scale[TONE_MAX_BINS];         /*!< Magnitude scale of each frequency */
+} sdft_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a Goertzel bank
+ * 
+ * @param bank          Goertzel bank
+ * @param sample_frec   Signal's sample frequency
+ * @note  The Goertzel filter of a frequency close to 0 is a double integrator and loses precision 
+ *        with long blocks, use a sliding DFT (or the mean) to measure DC
+ * 
+ * @param freqs         Frequencies to measure, greater than 0 (of lenght = bins)
+ * @param bins          Number of frequencies (1 to TONE_MAX_BINS)
+ * @param block_lenght  Samples per block (frequency resolution = sample_frec / block_lenght)
+ * @return true         Bank initialized
+ * @return false        Invalid parameters, the bank is not modified
+ */
+bool GoertzelInit(goertzel_t * bank, float sample_frec, const float * freqs, uint8_t bins, uint16_t block_lenght);
+
+/**
+ * @brief Process one sample with a Goertzel bank
+ * 
+ * @param bank          Goertzel bank
+ * @param sample        New sample
+ * @return true         A block was completed and the magnitudes updated
+ * @return false        Block not completed
+ */
+bool GoertzelUpdate(goertzel_t * bank, float sample);
+
+/**
+ * @brief Return the magnitudes of the last complete block of a Goertzel bank
+ * 
+ * @param bank          Goertzel bank
+ * @param magnitude     Array to store magnitude values, same scale as FFTMagnitude (of lenght = bins)
+ */
+void GoertzelMagnitude(const goertzel_t * bank, float * magnitude);
+
+/**
+ * @brief Initialize a sliding DFT
+ * 
+ * @note  Frequencies are rounded to the nearest DFT bin (k = freq * window_lenght / sample_frec)
+ * @note  The sliding DFT must be zeroed (static, or after SlidingDFTDeinit) before the first 
+ *        initialization: initializing it again frees the previous history
+ * 
+ * @param sdft          Sliding DFT
+ * @param sample_frec   Signal's sample frequency, greater than 0
+ * @param freqs         Frequencies to track, from 0 to sample_frec / 2 (of lenght = bins)
+ * @param bins          Number of frequencies (1 to TONE_MAX_BINS)
+ * @param window_lenght DFT lenght (4 or more)
+ * @return true         Sliding DFT initialized
+ * @return false        Invalid parameters or out of memory, the sliding DFT is not modified
+ */
+bool SlidingDFTInit(sdft_t * sdft, float sample_frec, const float * freqs, uint8_t bins, uint16_t window_lenght);
+
+/**
+ * @brief Free the memory used by a sliding DFT
+ * 
+ * @param sdft          Sliding DFT
+ */
+void SlidingDFTDeinit(sdft_t * sdft);
+
+/**
+ * @brief Process one sample with a sliding DFT
+ * 
+ * @param sdft          Sliding DFT
+ * @param sample        New sample
+ */
+void SlidingDFTUpdate(sdft_t * sdft, float sample);
+
+/**
+ * @brief Return the magnitudes of the last window_lenght samples
+ * 
+ * @param sdft          Sliding DFT
+ * @param magnitude     Array to store magnitude values, same scale as FFTMagnitude (of lenght = bins)
+ */
+void SlidingDFTMagnitude(const sdft_t * sdft, float * magnitude);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TONE_TRACKING_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,151 @@
+#ifndef WELCH_H_
+#define WELCH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Welch Welch PSD and spectrogram
+ */
+
+/** \brief Streaming spectral estimation
+ * 
+ * Samples are taken incrementally, and a Hann windowed FFT (same scale as FFTMagnitude) is 
+ * calculated as soon as each hop (50% or 75% overlap) is completed. Each spectrum is stored
+ * in a spectrogram ring and added to a running Welch average of the squared magnitudes.
+ * 
+ * The average is returned as a pointer to the internal buffer (no copy), updated by each
+ * WelchUpdate. Spectrogram rows can be copied out with WelchSpectrogramRow, or read in place
+ * (no copy, as the display and UART layers do) with WelchSpectrogramRing. The ring overwrites
+ * the oldest row with each new spectrum: readers in place take WelchFrames before and after
+ * reading, as a sequence lock, to detect the rows overwritten meanwhile.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Spectrogram rows copied out of the ring								|
+ * | 17/10/2026 | Read only access to the spectrogram ring (no copy)					|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+typedef enum welch_overlap {
+    WELCH_OVERLAP_50 = 2,       /*!< Hop of fft_lenght / 2 samples */
+    WELCH_OVERLAP_75 = 4        /*!< Hop of fft_lenght / 4 samples */
+} welch_overlap_t;
+
+/**
+ * @brief Streaming spectral estimator
+ */
+typedef struct {
+    fft_plan_t plan;            /*!< Real input FFT plan */
+    uint16_t hop;               /*!< Samples between spectra */
+    uint16_t fill;              /*!< Samples in history */
+    uint16_t rows;              /*!< Spectrogram rows */
+    uint16_t head;              /*!< Next spectrogram row to write */
+    uint32_t frames;            /*!< Spectra calculated since initialization */
+    uint32_t averaged;          /*!< Spectra in the Welch average */
+    float * history;            /*!< Last fft_lenght samples */
+    float * frame;              /*!< FFT work buffer (fft_lenght values) */
+    float * average;            /*!< Welch average of the squared magnitudes (fft_lenght / 2 values) */
+    float * spectrogram;        /*!< Spectrogram ring (rows * fft_lenght / 2 magnitudes) */
+} welch_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a streaming spectral estimator
+ * 
+ * @param welch             Spectral estimator
+ * @param fft_lenght        FFT lenght, power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * @param overlap           Overlap between consecutive FFTs (WELCH_OVERLAP_50 or WELCH_OVERLAP_75)
+ * @param spectrogram_rows  Number of spectra kept in the spectrogram ring (0 for none)
+ * @return true             Spectral estimator initialized
+ * @return false            Invalid parameters or out of memory
+ */
+bool WelchInit(welch_t * welch, uint16_t fft_lenght, welch_overlap_t overlap, uint16_t spectrogram_rows);
+
+/**
+ * @brief Free the memory used by a streaming spectral estimator
+ * 
+ * @param welch             Spectral estimator
+ */
+void WelchDeinit(welch_t * welch);
+
+/**
+ * @brief Restart the Welch average (the spectrogram is kept)
+ * 
+ * @param welch             Spectral estimator
+ */
+void WelchReset(welch_t * welch);
+
+/**
+ * @brief Add samples to a streaming spectral estimator
+ * 
+ * @param welch             Spectral estimator
+ * @param signal            Array with new signal values (of lenght = signal_lenght)
+ * @param signal_lenght     Number of new samples (can be 1)
+ * @return uint16_t         Number of spectra calculated
+ */
+uint16_t WelchUpdate(welch_t * welch, const float * signal, uint16_t signal_lenght);
+
+/**
+ * @brief Return the Welch average of the squared FFT magnitudes
+ * 
+ * @note  sqrt() of each value is an averaged FFTMagnitude 
+ * 
+ * @param welch             Spectral estimator
+ * @return const float*     Welch average (of lenght = fft_lenght / 2), all zeros until the first spectrum
+ */
+const float * WelchAverage(const welch_t * welch);
+
+/**
+ * @brief Copy a spectrogram row
+ * 
+ * @param welch             Spectral estimator
+ * @param age               0 for the newest spectrum, 1 for the previous one, ...
+ * @param magnitude         Array to store the FFT magnitudes (of lenght = fft_lenght / 2)
+ * @return true             Row copied
+ * @return false            Row not available (older than the ring or not calculated yet)
+ */
+bool WelchSpectrogramRow(const welch_t * welch, uint16_t age, float * magnitude);
+
+/**
+ * @brief Return the spectrogram ring, to read the rows in place
+ * 
+ * Row r of the ring starts at r * fft_lenght / 2. The newest spectrum is on row 
+ * (head + rows - 1) % rows, and the one of a given age on row (head + rows - 1 - age) % rows, 
+ * available if age < frames.
+ * 
+ * @note  Each new spectrum overwrites row head. After reading the row of a given age, it was
+ *        not overwritten if WelchFrames() - frames < rows - 1 - age (the row of the next
+ *        spectrum can be in progress); otherwise read it again with the new head and frames
+ * 
+ * @param welch             Spectral estimator
+ * @param head              Row of the next spectrum, the oldest one when the ring is full (output)
+ * @param frames            Spectra calculated since initialization (output, as WelchFrames)
+ * @return const float*     Spectrogram ring (rows * fft_lenght / 2 magnitudes), NULL without spectrogram
+ */
+const float * WelchSpectrogramRing(const welch_t * welch, uint16_t * head, uint32_t * frames);
+
+/**
+ * @brief Return the number of spectra calculated since initialization
+ * 
+ * @param welch             Spectral estimator
+ * @return uint32_t         Number of spectra
+ */
+uint32_t WelchFrames(const welch_t * welch);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* WELCH_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,162 @@
+/**
+ * @file decimator.c
+ * @brief Multi-rate decimation of oversampled ADC streams
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "decimator.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool DecimatorDesign(float * coeffs, uint16_t taps, uint8_t factor){
+    if (taps < 3 || (taps % 2) == 0 || factor < 2){
+        return false;
+    }
+    // Cut-off relative to the input sample frequency
+    float fc = DECIMATOR_CUTOFF / (2.0f * factor);
+    int16_t m = (taps - 1) / 2;
+    float sum = 0;
+    for (int16_t i = 0; i < taps; i++){
+        int16_t k = i - m;
+        float sinc = (k == 0) ? 2 * fc : sinf(2 * M_PI * fc * k) / (M_PI * k);
+        float w = 0.42f - 0.5f * cosf(2 * M_PI * i / (taps - 1)) + 0.08f * cosf(4 * M_PI * i / (taps - 1));
+        coeffs[i] = sinc * w;
+        sum += coeffs[i];
+    }
+    for (int16_t i = 0; i < taps; i++){
+        coeffs[i] /= sum;
+    }
+    return true;
+}
+
+bool DecimatorInit(decimator_t * dec, decimator_format_t format, const uint8_t * factors, uint8_t stages, 
+    uint16_t block_lenght, uint16_t offset, uint8_t shift){
+    memset(dec, 0, sizeof(decimator_t));
+    if (stages == 0 || stages > DECIMATOR_MAX_STAGES || (format != DECIMATOR_FLOAT && format != DECIMATOR_Q15)){
+        return false;
+    }
+    dec->format = format;
+    dec->block = block_lenght;
+    dec->offset = offset;
+    dec->shift = shift;
+    dec->factor = 1;
+    size_t size = (format == DECIMATOR_FLOAT) ? sizeof(float) : sizeof(int16_t);
+    for (uint8_t s = 0; s < stages; s++){
+        uint8_t factor = factors[s];
+        if (factor != 2 && factor != 4 && factor != 8){
+            DecimatorDeinit(dec);
+            return false;
+        }
+        uint16_t taps = DECIMATOR_TAPS_PER_FACTOR * factor - 1;
+        dec->stages = s + 1;
+        dec->factor *= factor;
+        dec->coeffs[s] = malloc(taps * size);
+        dec->delay[s] = malloc(taps * size);
+        float * design = (format == DECIMATOR_FLOAT) ? dec->coeffs[s] : malloc(taps * sizeof(float));
+        if (dec->coeffs[s] == NULL || dec->delay[s] == NULL || design == NULL){
+            if (format == DECIMATOR_Q15){
+                free(design);
+            }
+            DecimatorDeinit(dec);
+            return false;
+        }
+        DecimatorDesign(design, taps, factor);
+        esp_err_t err;
+        if (format == DECIMATOR_FLOAT){
+            err = dsps_fird_init_f32(&dec->fir[s], design, dec->delay[s], taps, factor);
+        } else {
+            int16_t * q15 = dec->coeffs[s];
+            for (uint16_t i = 0; i < taps; i++){
+                q15[i] = (int16_t)lroundf(design[i] * 32768.0f);
+            }
+            free(design);
+            err = dsps_fird_init_s16(&dec->fir_q15[s], q15, dec->delay[s], taps, factor, 0, 0);
+        }
+        if (err != ESP_OK){
+            // Filter lenght or alignment not supported by the kernel of the target
+            DecimatorDeinit(dec);
+            return false;
+        }
+    }
+    dec->buffer = malloc(block_lenght * size);
+    if (dec->buffer == NULL){
+        DecimatorDeinit(dec);
+        return false;
+    }
+    return true;
+}
+
+void DecimatorDeinit(decimator_t * dec){
+    for (uint8_t s = 0; s < dec->stages; s++){
+        if (dec->format == DECIMATOR_Q15){
+            dsps_fird_s16_aexx_free(&dec->fir_q15[s]);
+        }
+        free(dec->coeffs[s]);
+        free(dec->delay[s]);
+    }
+    free(dec->buffer);
+    memset(dec, 0, sizeof(decimator_t));
+}
+
+uint16_t DecimatorFactor(const decimator_t * dec){
+    return dec->factor;
+}
+
+uint16_t DecimatorProcess(decimator_t * dec, const uint16_t * adc, uint16_t adc_lenght, float * output){
+    if (dec->format != DECIMATOR_FLOAT || adc_lenght > dec->block || (adc_lenght % dec->factor) != 0){
+        return 0;
+    }
+    float * buffer = dec->buffer;
+    for (uint16_t i = 0; i < adc_lenght; i++){
+        buffer[i] = (float)((int32_t)adc[i] - dec->offset);
+    }
+    // Each stage works in place (outputs are written behind the inputs being read)
+    int lenght = adc_lenght;
+    for (uint8_t s = 0; s < dec->stages; s++){
+        float * out = (s == dec->stages - 1) ? output : buffer;
+        lenght = dsps_fird_f32(&dec->fir[s], buffer, out, lenght / dec->fir[s].decim);
+    }
+    return lenght;
+}
+
+uint16_t DecimatorProcessQ15(decimator_t * dec, const uint16_t * adc, uint16_t adc_lenght, int16_t * output){
+    if (dec->format != DECIMATOR_Q15 || adc_lenght > dec->block || (adc_lenght % dec->factor) != 0){
+        return 0;
+    }
+    int16_t * buffer = dec->buffer;
+    for (uint16_t i = 0; i < adc_lenght; i++){
+        int32_t x = ((int32_t)adc[i] - dec->offset) * (1 << dec->shift);
+        if (x > INT16_MAX){
+            x = INT16_MAX;
+        } else if (x < INT16_MIN){
+            x = INT16_MIN;
+        }
+        buffer[i] = (int16_t)x;
+    }
+    int32_t lenght = adc_lenght;
+    for (uint8_t s = 0; s < dec->stages; s++){
+        int16_t * out = (s == dec->stages - 1) ? output : buffer;
+        lenght = dsps_fird_s16(&dec->fir_q15[s], buffer, out, lenght / dec->fir_q15[s].decim);
+    }
+    return lenght;
+}
+
+/*==================[end of file]============================================*/
@@ -11,6 +11,7 @@
 
 /*==================[inclusions]=============================================*/
 #include <string.h>
+#include <stdlib.h>
 #include <math.h>
 #include "fft.h"
 #include "esp_dsp.h"
@@ -18,15 +19,42 @@
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
 /*==================[internal data declaration]==============================*/
-static float fft_complex[2 * MAX_SIGNAL_LENGHT];
-static float wind[MAX_SIGNAL_LENGHT];
+static fft_plan_t fft_plan = {0};          /*!< Plan used by FFTMagnitude (single task, see FFTPlanMagnitude) */
+static float * fft_buffer = NULL;           /*!< FFTMagnitude copy of the signal (of lenght = fft_plan.signal_lenght) */
+static fft_q15_plan_t fft_plan_q15 = {0}; /*!< Plan used by FFTMagnitudeQ15 */
+static int16_t * fft_table_q15 = NULL;      /*!< Q15 twiddles of the complex FFT (up to MAX_SIGNAL_LENGHT / 2 points), kept by esp-dsp */
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Approximates sqrt(re^2 + im^2) with integer arithmetic
+ * 
+ * Alpha max plus beta min estimation (max(a, 29/32 a + 61/128 b), error < 2.4%) 
+ * refined with one Newton iteration (error < 0.03%).
+ */
+static uint16_t FFTMagQ15(int32_t re, int32_t im);
 
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static uint16_t FFTMagQ15(int32_t re, int32_t im){
+    uint32_t a = (re < 0) ? -re : re;
+    uint32_t b = (im < 0) ? -im : im;
+    if (a < b){
+        uint32_t tmp = a;
+        a = b;
+        b = tmp;
+    }
+    if (a == 0){
+        return 0;
+    }
+    uint32_t mag = (116 * a + 61 * b) >> 7;
+    if (mag < a){
+        mag = a;
+    }
+    mag = (mag + (a * a + b * b) / mag) >> 1;
+    return (uint16_t)mag;
+}
 
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
@@ -37,26 +65,204 @@ bool FFTInit(void){
     return true;
 }
 
-void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
+bool FFTInitQ15(void){
+    if (dsps_fft2r_sc16_initialized){
+        return true;
+    }
+    // A complex FFT of N points uses N Q15 values of the table
+    if (fft_table_q15 == NULL){
+        fft_table_q15 = malloc(MAX_SIGNAL_LENGHT / 2 * sizeof(int16_t));
+        if (fft_table_q15 == NULL){
+            return false;
+        }
+    }
+    esp_err_t ret = dsps_fft2r_init_sc16(fft_table_q15, MAX_SIGNAL_LENGHT / 2);
+    if (ret != ESP_OK){
+        return false;
+    }
+    return true;
+}
+
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght){
+    if (signal_lenght < 4 || signal_lenght > MAX_SIGNAL_LENGHT || !dsp_is_power_of_two(signal_lenght)){
+        return false;
+    }
+    if (!FFTInit()){
+        return false;
+    }
+    plan->signal_lenght = signal_lenght;
+    plan->wind = malloc(signal_lenght * sizeof(float));
+    plan->twiddle = malloc((signal_lenght / 4 + 1) * 2 * sizeof(float));
+    if (plan->wind == NULL || plan->twiddle == NULL){
+        FFTPlanDeinit(plan);
+        return false;
+    }
     // Generate Hann window
-    dsps_wind_hann_f32(wind, signal_lenght);
-    // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
-    // Multiply input array with window and store as real part
-    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
-    // Calculate FFT  
-    dsps_fft2r_fc32(fft_complex, signal_lenght);
+    dsps_wind_hann_f32(plan->wind, signal_lenght);
+    // Generate real split twiddles
+    for (int k = 0; k <= signal_lenght / 4; k++){
+        plan->twiddle[2 * k] = cosf(2 * M_PI * k / signal_lenght);
+        plan->twiddle[2 * k + 1] = sinf(2 * M_PI * k / signal_lenght);
+    }
+    return true;
+}
+
+void FFTPlanDeinit(fft_plan_t * plan){
+    free(plan->wind);
+    free(plan->twiddle);
+    plan->wind = NULL;
+    plan->twiddle = NULL;
+    plan->signal_lenght = 0;
+}
+
+void FFTPlanMagnitude(const fft_plan_t * plan, float * signal, float * fft){
+    uint16_t n2 = plan->signal_lenght / 2;
+    // Multiply input array with window, even samples are the real part and odd samples the imaginary part
+    dsps_mul_f32(signal, plan->wind, signal, plan->signal_lenght, 1, 1, 1);
+    // Calculate FFT of signal_lenght/2 complex points
+    dsps_fft2r_fc32(signal, n2);
+    // Bit reverse
+    dsps_bit_rev_fc32(signal, n2);
+    // Split in the spectrum of the real signal: 
+    // X[k] = E[k] + W^k O[k] and X[n2 - k] = conj(E[k] - W^k O[k]), with W = exp(-j 2 pi / signal_lenght)
+    // E[k] = (Z[k] + conj(Z[n2 - k])) / 2 and O[k] = -j (Z[k] - conj(Z[n2 - k])) / 2
+    float dc = signal[0] + signal[1];
+    signal[0] = dc;
+    signal[1] = 0;
+    for (int k = 1; k <= n2 / 2; k++){
+        float * zk = &signal[2 * k];
+        float * zm = &signal[2 * (n2 - k)];
+        float e_re = (zk[0] + zm[0]) / 2;
+        float e_im = (zk[1] - zm[1]) / 2;
+        float o_re = (zk[1] + zm[1]) / 2;
+        float o_im = (zm[0] - zk[0]) / 2;
+        float c = plan->twiddle[2 * k];
+        float s = plan->twiddle[2 * k + 1];
+        float t_re = c * o_re + s * o_im;
+        float t_im = c * o_im - s * o_re;
+        zk[0] = e_re + t_re;
+        zk[1] = e_im + t_im;
+        zm[0] = e_re - t_re;
+        zm[1] = t_im - e_im;
+    }
+    // Calculate FFT magnitude (one sided, scaled as FFTMagnitude)
+    float scale = 8.0f / plan->signal_lenght;
+    fft[0] = fabsf(dc) * scale / 4;
+    for (int k = 1; k < n2; k++){
+        fft[k] = scale * sqrtf(signal[2 * k] * signal[2 * k] + signal[2 * k + 1] * signal[2 * k + 1]);
+    }
+}
+
+void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
+    // Plan only when lenght changes
+    if (signal_lenght != fft_plan.signal_lenght){
+        FFTPlanDeinit(&fft_plan);
+        free(fft_buffer);
+        fft_buffer = NULL;
+        if (!FFTPlanInit(&fft_plan, signal_lenght)){
+            ESP_LOGE(TAG, "Not possible to plan FFT of lenght %d", signal_lenght);
+            return;
+        }
+        fft_buffer = malloc(signal_lenght * sizeof(float));
+        if (fft_buffer == NULL){
+            ESP_LOGE(TAG, "Not enough memory for FFT of lenght %d", signal_lenght);
+            FFTPlanDeinit(&fft_plan);
+            return;
+        }
+    }
+    memcpy(fft_buffer, signal, signal_lenght * sizeof(float));
+    FFTPlanMagnitude(&fft_plan, fft_buffer, fft);
+}
+
+bool FFTPlanInitQ15(fft_q15_plan_t * plan, uint16_t signal_lenght){
+    if (signal_lenght < 4 || signal_lenght > MAX_SIGNAL_LENGHT || !dsp_is_power_of_two(signal_lenght)){
+        return false;
+    }
+    if (!FFTInitQ15()){
+        return false;
+    }
+    plan->signal_lenght = signal_lenght;
+    plan->wind = malloc(signal_lenght * sizeof(int16_t));
+    plan->twiddle = malloc((signal_lenght / 4 + 1) * 2 * sizeof(int16_t));
+    plan->buffer = malloc(signal_lenght * sizeof(int16_t));
+    if (plan->wind == NULL || plan->twiddle == NULL || plan->buffer == NULL){
+        FFTPlanDeinitQ15(plan);
+        return false;
+    }
+    // Generate Q15 Hann window
+    float len_mult = 1 / (float)(signal_lenght - 1);
+    for (int i = 0; i < signal_lenght; i++){
+        plan->wind[i] = (int16_t)(INT16_MAX * 0.5 * (1 - cosf(i * 2 * M_PI * len_mult)) + 0.5);
+    }
+    // Generate Q15 real split twiddles
+    for (int k = 0; k <= signal_lenght / 4; k++){
+        plan->twiddle[2 * k] = (int16_t)lroundf(INT16_MAX * cosf(2 * M_PI * k / signal_lenght));
+        plan->twiddle[2 * k + 1] = (int16_t)lroundf(INT16_MAX * sinf(2 * M_PI * k / signal_lenght));
+    }
+    return true;
+}
+
+void FFTPlanDeinitQ15(fft_q15_plan_t * plan){
+    free(plan->wind);
+    free(plan->twiddle);
+    free(plan->buffer);
+    plan->wind = NULL;
+    plan->twiddle = NULL;
+    plan->buffer = NULL;
+    plan->signal_lenght = 0;
+}
+
+bool FFTPlanMagnitudeQ15(const fft_q15_plan_t * plan, const int16_t * signal, uint16_t * fft){
+    uint16_t n2 = plan->signal_lenght / 2;
+    int16_t * buffer = plan->buffer;
+    // Multiply input array with window, even samples are the real part and odd samples the imaginary part
+    for (int i = 0; i < plan->signal_lenght; i++){
+        buffer[i] = ((int32_t)signal[i] * (1 << FFT_Q15_INPUT_SHIFT) * plan->wind[i]) >> 15;
+    }
+    // Calculate FFT of signal_lenght/2 complex points (scaled by 2/signal_lenght)
+    esp_err_t ret = dsps_fft2r_sc16_ansi(buffer, n2);
+    if (ret != ESP_OK){
+        return false;
+    }
     // Bit reverse
-    dsps_bit_rev_fc32(fft_complex, signal_lenght);
-    // Convert one complex vector to two complex vectors
-    dsps_cplx2reC_fc32(fft_complex, signal_lenght);
-    // Calculate FFT magnitude 
-    for (int j = 0; j < signal_lenght; j++){
-            fft_complex[j] = 2*(sqrt(fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1])) / (signal_lenght/2);
-    }
-    fft_complex[0] = fft_complex[0] / 2;
-    // Copy result in fft array
-    memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    ret = dsps_bit_rev_sc16_ansi(buffer, n2);
+    if (ret != ESP_OK){
+        return false;
+    }
+    // Split in the spectrum of the real signal, as FFTPlanMagnitude, with 2 E[k] and 2 O[k]
+    // in 32 bits (4 X[k] / signal_lenght). FFTMagnitude scale: 8 / 2^FFT_Q15_INPUT_SHIFT = 2 X[k] / signal_lenght
+    // (DC is not doubled)
+    int32_t dc = (int32_t)buffer[0] + buffer[1];
+    fft[0] = FFTMagQ15(dc, 0) / 4;
+    for (int k = 1; k <= n2 / 2; k++){
+        const int16_t * zk = &buffer[2 * k];
+        const int16_t * zm = &buffer[2 * (n2 - k)];
+        int32_t e_re = (int32_t)zk[0] + zm[0];
+        int32_t e_im = (int32_t)zk[1] - zm[1];
+        int32_t o_re = (int32_t)zk[1] + zm[1];
+        int32_t o_im = (int32_t)zm[0] - zk[0];
+        int32_t c = plan->twiddle[2 * k];
+        int32_t s = plan->twiddle[2 * k + 1];
+        int32_t t_re = (c * o_re + s * o_im + (1 << 14)) >> 15;
+        int32_t t_im = (c * o_im - s * o_re + (1 << 14)) >> 15;
+        fft[k] = FFTMagQ15((e_re + t_re) / 2, (e_im + t_im) / 2);
+        if (k < n2 / 2){
+            fft[n2 - k] = FFTMagQ15((e_re - t_re) / 2, (t_im - e_im) / 2);
+        }
+    }
+    return true;
+}
+
+bool FFTMagnitudeQ15(const int16_t * signal, uint16_t * fft, uint16_t signal_lenght){
+    // Plan only when lenght changes
+    if (signal_lenght != fft_plan_q15.signal_lenght){
+        FFTPlanDeinitQ15(&fft_plan_q15);
+        if (!FFTPlanInitQ15(&fft_plan_q15, signal_lenght)){
+            ESP_LOGE(TAG, "Not possible to plan Q15 FFT of lenght %d", signal_lenght);
+            return false;
+        }
+    }
+    return FFTPlanMagnitudeQ15(&fft_plan_q15, signal, fft);
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
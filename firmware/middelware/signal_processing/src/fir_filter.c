@@ -0,0 +1,155 @@
+/**
+ * @file fir_filter.c
+ * @brief Block streaming FIR filters (direct form or overlap-save FFT convolution)
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include "fir_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Filter the two blocks of filter->input with FFT convolution and store them in filter->output
+ */
+static void FIRFilterBlock(fir_filter_t * filter);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void FIRFilterBlock(fir_filter_t * filter){
+    const uint16_t n = filter->fft_size;
+    const uint16_t l = filter->block / 2;
+    const uint16_t m = filter->taps - 1;
+    float * buf = filter->buffer;
+    // First block as real part and second block as imaginary part (both with the last taps - 1 samples before them)
+    for (int i = 0; i < n; i++){
+        buf[2 * i] = filter->input[i];
+        buf[2 * i + 1] = filter->input[l + i];
+    }
+    dsps_fft2r_fc32(buf, n);
+    dsps_bit_rev_fc32(buf, n);
+    // Multiply by the spectrum of the coefficients (both blocks at once, the coefficients are real)
+    // and conjugate, to calculate the inverse FFT with the forward one
+    const float * h = filter->coeffs;
+    for (int k = 0; k < n; k++){
+        float re = buf[2 * k] * h[2 * k] - buf[2 * k + 1] * h[2 * k + 1];
+        float im = buf[2 * k] * h[2 * k + 1] + buf[2 * k + 1] * h[2 * k];
+        buf[2 * k] = re;
+        buf[2 * k + 1] = -im;
+    }
+    dsps_fft2r_fc32(buf, n);
+    dsps_bit_rev_fc32(buf, n);
+    // The first taps - 1 outputs are circular convolution aliasing, the rest are valid
+    for (int i = 0; i < l; i++){
+        filter->output[i] = buf[2 * (m + i)];
+        filter->output[l + i] = -buf[2 * (m + i) + 1];
+    }
+    // Keep the last taps - 1 samples for the next blocks
+    memmove(filter->input, &filter->input[filter->block], m * sizeof(float));
+}
+
+/*==================[external functions definition]==========================*/
+bool FIRFilterInit(fir_filter_t * filter, const float * coeffs, uint16_t taps){
+    return FIRFilterInitEngine(filter, coeffs, taps, FIR_ENGINE_AUTO);
+}
+
+bool FIRFilterInitEngine(fir_filter_t * filter, const float * coeffs, uint16_t taps, fir_engine_t engine){
+    memset(filter, 0, sizeof(fir_filter_t));
+    if (taps == 0 || taps > FIR_MAX_TAPS || engine > FIR_ENGINE_FFT){
+        return false;
+    }
+    filter->taps = taps;
+    if (engine == FIR_ENGINE_AUTO){
+        engine = (taps < FIR_FFT_MIN_TAPS) ? FIR_ENGINE_DIRECT : FIR_ENGINE_FFT;
+    }
+    if (engine == FIR_ENGINE_DIRECT){
+        // Direct form, esp-dsp applies coeffs[0] to the oldest sample
+        filter->coeffs = malloc(taps * sizeof(float));
+        filter->input = malloc((taps + 4) * sizeof(float));
+        if (filter->coeffs == NULL || filter->input == NULL){
+            FIRFilterDeinit(filter);
+            return false;
+        }
+        for (int i = 0; i < taps; i++){
+            filter->coeffs[i] = coeffs[taps - 1 - i];
+        }
+        dsps_fir_init_f32(&filter->fir, filter->coeffs, filter->input, taps);
+        return true;
+    }
+    // FFT convolution: smallest FFT with at least as many new samples as taps per block
+    uint16_t n = 2;
+    while (n < 2 * taps){
+        n <<= 1;
+    }
+    if (dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE) != ESP_OK){
+        return false;
+    }
+    filter->fft_size = n;
+    filter->block = 2 * (n - taps + 1);
+    filter->coeffs = malloc(2 * n * sizeof(float));
+    filter->buffer = malloc(2 * n * sizeof(float));
+    filter->input = calloc(taps - 1 + filter->block, sizeof(float));
+    filter->output = calloc(filter->block, sizeof(float));
+    if (filter->coeffs == NULL || filter->buffer == NULL || filter->input == NULL || filter->output == NULL){
+        FIRFilterDeinit(filter);
+        return false;
+    }
+    // Spectrum of the zero padded coefficients, including the 1/n scale of the inverse FFT
+    float * h = filter->coeffs;
+    memset(h, 0, 2 * n * sizeof(float));
+    for (int i = 0; i < taps; i++){
+        h[2 * i] = coeffs[i] / n;
+    }
+    dsps_fft2r_fc32(h, n);
+    dsps_bit_rev_fc32(h, n);
+    return true;
+}
+
+void FIRFilterDeinit(fir_filter_t * filter){
+    free(filter->coeffs);
+    free(filter->input);
+    free(filter->output);
+    free(filter->buffer);
+    memset(filter, 0, sizeof(fir_filter_t));
+}
+
+void FIRFilterApply(fir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    if (filter->fft_size == 0){
+        dsps_fir_f32(&filter->fir, input_signal, output_signal, signal_lenght);
+        return;
+    }
+    float * block_input = &filter->input[filter->taps - 1];
+    int16_t i = 0;
+    while (i < signal_lenght){
+        // Take as many samples as fit in the current block, returning the outputs of the previous one
+        int16_t n = filter->block - filter->count;
+        if (n > signal_lenght - i){
+            n = signal_lenght - i;
+        }
+        memcpy(&block_input[filter->count], &input_signal[i], n * sizeof(float));
+        memcpy(&output_signal[i], &filter->output[filter->count], n * sizeof(float));
+        filter->count += n;
+        i += n;
+        if (filter->count == filter->block){
+            FIRFilterBlock(filter);
+            filter->count = 0;
+        }
+    }
+}
+
+uint16_t FIRFilterLatency(const fir_filter_t * filter){
+    return filter->block;
+}
+
+/*==================[end of file]============================================*/
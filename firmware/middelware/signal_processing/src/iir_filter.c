@@ -10,11 +10,10 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
 #include "iir_filter.h"
 #include "esp_dsp.h"
 /*==================[macros and definitions]=================================*/
-#define N_SOS       5
-#define N_DELAY     2
 // 2nd order Butterworth 
 #define ORDER2_Q    (1 / 1.414)
 // 4th order Butterworth 
@@ -30,23 +29,12 @@
 #define ORDER8_Q3   (1 / 1.663)
 #define ORDER8_Q4   (1 / 1.962)
 /*==================[internal data declaration]==============================*/
-static uint8_t lp_order, hp_order;
-float hp2_delay[N_DELAY] = {0, 0};  // delay
-float hp4_delay[N_DELAY] = {0, 0};  // delay
-float hp6_delay[N_DELAY] = {0, 0};  // delay
-float hp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_delay[N_DELAY] = {0, 0};  // delay
-float lp4_delay[N_DELAY] = {0, 0};  // delay
-float lp6_delay[N_DELAY] = {0, 0};  // delay
-float lp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_sos_coeff[N_SOS]; 
-float lp4_sos_coeff[N_SOS]; 
-float lp6_sos_coeff[N_SOS]; 
-float lp8_sos_coeff[N_SOS]; 
-float hp2_sos_coeff[N_SOS]; 
-float hp4_sos_coeff[N_SOS]; 
-float hp6_sos_coeff[N_SOS]; 
-float hp8_sos_coeff[N_SOS]; 
+static iir_filter_t lp_filter = {0};
+static iir_filter_t hp_filter = {0};
+static const float order2_q[] = {ORDER2_Q};
+static const float order4_q[] = {ORDER4_Q1, ORDER4_Q2};
+static const float order6_q[] = {ORDER6_Q1, ORDER6_Q2, ORDER6_Q3};
+static const float order8_q[] = {ORDER8_Q1, ORDER8_Q2, ORDER8_Q3, ORDER8_Q4};
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -56,101 +44,81 @@ float hp8_sos_coeff[N_SOS];
 /*==================[internal functions definition]==========================*/
 
 /*==================[external functions definition]==========================*/
-
-void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    lp_order = order;
-    switch(lp_order){
+bool IIRFilterInit(iir_filter_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order, uint8_t channels){
+    const float * q;
+    switch(order){
         case ORDER_2:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER2_Q);
+            q = order2_q;
         break;
         case ORDER_4:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER4_Q2);
+            q = order4_q;
         break;
         case ORDER_6:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER6_Q3);
+            q = order6_q;
         break;
         case ORDER_8:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_lpf_f32(lp8_sos_coeff, f, ORDER8_Q4);
+            q = order8_q;
         break;
+        default:
+            return false;
+    }
+    if (channels == 0 || channels > IIR_MAX_CHANNELS){
+        return false;
+    }
+    float f = cut_frec / sample_frec;
+    filter->sections = order / 2;
+    filter->channels = channels;
+    for (uint8_t s = 0; s < filter->sections; s++){
+        if (type == IIR_LOW_PASS){
+            dsps_biquad_gen_lpf_f32(filter->coeff[s], f, q[s]);
+        } else {
+            dsps_biquad_gen_hpf_f32(filter->coeff[s], f, q[s]);
+        }
     }
+    IIRFilterReset(filter);
+    return true;
 }
 
-void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    hp_order = order;
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER2_Q);
-        break;
-        case ORDER_4:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER4_Q2);
-        break;
-        case ORDER_6:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER6_Q3);
-        break;
-        case ORDER_8:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_hpf_f32(hp8_sos_coeff, f, ORDER8_Q4);
-        break;
+void IIRFilterReset(iir_filter_t * filter){
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+void IIRFilterApply(iir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    const uint8_t channels = filter->channels;
+    const uint8_t sections = filter->sections;
+    // Samples in order, every channel of a sample before the next one: interleaved input and output
+    // are read and written once, sequentially
+    for (int16_t n = 0; n < signal_lenght; n++){
+        for (uint8_t c = 0; c < channels; c++){
+            // Same operations (and order) as dsps_biquad_f32, for every section while the sample stays in a register
+            float x = *input_signal++;
+            for (uint8_t s = 0; s < sections; s++){
+                const float * coeff = filter->coeff[s];
+                float * w = filter->delay[c][s];
+                float d0 = x - coeff[3] * w[0] - coeff[4] * w[1];
+                x = coeff[0] * d0 + coeff[1] * w[0] + coeff[2] * w[1];
+                w[1] = w[0];
+                w[0] = d0;
+            }
+            *output_signal++ = x;
+        }
     }
 }
 
+void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IIRFilterInit(&lp_filter, IIR_LOW_PASS, sample_frec, cut_frec, order, 1);
+}
+
+void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IIRFilterInit(&hp_filter, IIR_HI_PASS, sample_frec, cut_frec, order, 1);
+}
+
 void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp8_sos_coeff, lp8_delay);
-        break;
-    }
+    IIRFilterApply(&lp_filter, input_signal, output_signal, signal_lenght);
 }
 
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp8_sos_coeff, hp8_delay);
-        break;
-    }
+    IIRFilterApply(&hp_filter, input_signal, output_signal, signal_lenght);
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
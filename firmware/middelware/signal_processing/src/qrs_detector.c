@@ -0,0 +1,208 @@
+/**
+ * @file qrs_detector.c
+ * @brief Streaming QRS detection (Pan-Tompkins)
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "qrs_detector.h"
+/*==================[macros and definitions]=================================*/
+#define QRS_BAND_PASS_LOW   5.0f    /*!< Band-pass lower cut-off frequency (Hz) */
+#define QRS_BAND_PASS_HIGH  15.0f   /*!< Band-pass upper cut-off frequency (Hz) */
+#define QRS_WINDOW_TIME     0.150f  /*!< Integration window (s) */
+#define QRS_REFRACTORY_TIME 0.200f  /*!< Refractory period (s) */
+#define QRS_T_WAVE_TIME     0.360f  /*!< T wave discrimination period (s) */
+#define QRS_LEARNING_TIME   2.0f    /*!< Threshold learning period (s) */
+#define QRS_MIN_FREC        100.0f  /*!< Minimun sample frequency (Hz) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Find the R peak (maximun absolute band-pass value) and the slope (maximun squared 
+ * derivative) in the last integration window
+ */
+static void QRSLocate(const qrs_detector_t * qrs, uint32_t n, uint32_t * r, float * slope);
+
+/**
+ * @brief Register a beat and fill the beat struct
+ */
+static void QRSAccept(qrs_detector_t * qrs, uint32_t peak_n, uint32_t r, float slope, qrs_beat_t * beat);
+
+/**
+ * @brief Classify a peak of the integrated signal (at sample peak_n, found at sample n)
+ */
+static bool QRSPeak(qrs_detector_t * qrs, float peak, uint32_t peak_n, uint32_t n, qrs_beat_t * beat);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void QRSLocate(const qrs_detector_t * qrs, uint32_t n, uint32_t * r, float * slope){
+    // The newest value (sample n) is at pos - 1
+    uint16_t newest = (qrs->pos == 0) ? qrs->window - 1 : qrs->pos - 1;
+    float max = -1;
+    uint16_t age = 0;
+    *slope = 0;
+    for (uint16_t i = 0; i < qrs->window; i++){
+        float v = fabsf(qrs->band_pass[i]);
+        if (v > max){
+            max = v;
+            age = (newest >= i) ? newest - i : newest + qrs->window - i;
+        }
+        if (qrs->squared[i] > *slope){
+            *slope = qrs->squared[i];
+        }
+    }
+    *r = n - age;
+}
+
+static void QRSAccept(qrs_detector_t * qrs, uint32_t peak_n, uint32_t r, float slope, qrs_beat_t * beat){
+    beat->sample = r;
+    beat->rr = 0;
+    beat->heart_rate = 0;
+    if (qrs->beat){
+        uint32_t rr = r - qrs->last_r;
+        beat->rr = rr;
+        beat->heart_rate = 60.0f * qrs->sample_frec / rr;
+        // Average of the last QRS_RR_AVERAGE intervals
+        qrs->rr[qrs->rr_pos] = rr;
+        qrs->rr_pos = (qrs->rr_pos + 1) % QRS_RR_AVERAGE;
+        if (qrs->rr_count < QRS_RR_AVERAGE){
+            qrs->rr_count++;
+        }
+        uint32_t sum = 0;
+        for (uint8_t i = 0; i < qrs->rr_count; i++){
+            sum += qrs->rr[i];
+        }
+        qrs->rr_average = sum / qrs->rr_count;
+    }
+    qrs->beat = true;
+    qrs->last_qrs = peak_n;
+    qrs->last_r = r;
+    qrs->last_slope = slope;
+    qrs->search_peak = 0;
+}
+
+static bool QRSPeak(qrs_detector_t * qrs, float peak, uint32_t peak_n, uint32_t n, qrs_beat_t * beat){
+    uint32_t since = peak_n - qrs->last_qrs;
+    if (qrs->beat && since < qrs->refractory){
+        return false;
+    }
+    bool detected = false;
+    uint32_t r;
+    float slope;
+    if (peak > qrs->threshold){
+        QRSLocate(qrs, n, &r, &slope);
+        if (qrs->beat && since < qrs->t_wave && slope < qrs->last_slope / 2){
+            // T wave
+            qrs->npki = 0.125f * peak + 0.875f * qrs->npki;
+        } else {
+            qrs->spki = 0.125f * peak + 0.875f * qrs->spki;
+            QRSAccept(qrs, peak_n, r, slope, beat);
+            detected = true;
+        }
+    } else {
+        qrs->npki = 0.125f * peak + 0.875f * qrs->npki;
+        if (peak > qrs->search_peak && (!qrs->beat || since >= qrs->t_wave)){
+            // Candidate for searchback
+            QRSLocate(qrs, n, &r, &slope);
+            qrs->search_peak = peak;
+            qrs->search_qrs = peak_n;
+            qrs->search_r = r;
+            qrs->search_slope = slope;
+        }
+    }
+    qrs->threshold = qrs->npki + 0.25f * (qrs->spki - qrs->npki);
+    return detected;
+}
+
+/*==================[external functions definition]==========================*/
+bool QRSDetectorInit(qrs_detector_t * qrs, float sample_frec){
+    // Also false for NaN
+    if (qrs == NULL || !(sample_frec >= QRS_MIN_FREC && QRS_WINDOW_TIME * sample_frec + 0.5f < QRS_MAX_WINDOW + 1)){
+        return false;
+    }
+    memset(qrs, 0, sizeof(qrs_detector_t));
+    uint16_t window = (uint16_t)(QRS_WINDOW_TIME * sample_frec + 0.5f);
+    IIRFilterInit(&qrs->hi_pass, IIR_HI_PASS, sample_frec, QRS_BAND_PASS_LOW, ORDER_2, 1);
+    IIRFilterInit(&qrs->low_pass, IIR_LOW_PASS, sample_frec, QRS_BAND_PASS_HIGH, ORDER_2, 1);
+    qrs->sample_frec = sample_frec;
+    qrs->window = window;
+    qrs->refractory = (uint16_t)(QRS_REFRACTORY_TIME * sample_frec);
+    qrs->t_wave = (uint16_t)(QRS_T_WAVE_TIME * sample_frec);
+    qrs->learning = (uint32_t)(QRS_LEARNING_TIME * sample_frec);
+    return true;
+}
+
+bool QRSDetectorUpdate(qrs_detector_t * qrs, float sample, qrs_beat_t * beat){
+    if (qrs == NULL || beat == NULL || !isfinite(sample)){
+        return false;
+    }
+    const uint32_t n = qrs->n++;
+    if (n == 0){
+        qrs->offset = sample;
+    }
+    // Band-pass
+    float x = sample - qrs->offset;
+    IIRFilterApply(&qrs->hi_pass, &x, &x, 1);
+    IIRFilterApply(&qrs->low_pass, &x, &x, 1);
+    // Five point derivative: (2 x[n] + x[n-1] - x[n-3] - 2 x[n-4]) / 8, and squaring
+    float * d = qrs->derivative;
+    float dx = (2 * x + d[0] - d[2] - 2 * d[3]) / 8;
+    d[3] = d[2];
+    d[2] = d[1];
+    d[1] = d[0];
+    d[0] = x;
+    float squared = dx * dx;
+    // Moving window integration
+    qrs->sum += squared - qrs->squared[qrs->pos];
+    qrs->squared[qrs->pos] = squared;
+    qrs->band_pass[qrs->pos] = x;
+    if (++qrs->pos == qrs->window){
+        // Recalculate the sum once per window to avoid accumulating rounding errors
+        qrs->pos = 0;
+        qrs->sum = 0;
+        for (uint16_t i = 0; i < qrs->window; i++){
+            qrs->sum += qrs->squared[i];
+        }
+    }
+    float mwi = qrs->sum / qrs->window;
+
+    bool detected = false;
+    if (n < qrs->learning){
+        // Learning: spki holds the maximun and npki the sum of the integrated signal
+        if (mwi > qrs->spki){
+            qrs->spki = mwi;
+        }
+        qrs->npki += mwi;
+        if (n == qrs->learning - 1){
+            qrs->spki /= 3;
+            qrs->npki /= 2 * qrs->learning;
+            qrs->threshold = qrs->npki + 0.25f * (qrs->spki - qrs->npki);
+        }
+    } else {
+        if (qrs->mwi[0] > qrs->mwi[1] && qrs->mwi[0] >= mwi){
+            // Peak at sample n - 1
+            detected = QRSPeak(qrs, qrs->mwi[0], n - 1, n, beat);
+        }
+        if (!detected && qrs->rr_count > 0 && qrs->search_peak > qrs->threshold / 2 &&
+            (n - qrs->last_qrs) * 100 > qrs->rr_average * 166){
+            // Searchback
+            qrs->spki = 0.25f * qrs->search_peak + 0.75f * qrs->spki;
+            qrs->threshold = qrs->npki + 0.25f * (qrs->spki - qrs->npki);
+            QRSAccept(qrs, qrs->search_qrs, qrs->search_r, qrs->search_slope, beat);
+            detected = true;
+        }
+    }
+    qrs->mwi[1] = qrs->mwi[0];
+    qrs->mwi[0] = mwi;
+    return detected;
+}
+
+/*==================[end of file]============================================*/
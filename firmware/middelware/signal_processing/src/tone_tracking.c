@@ -0,0 +1,158 @@
+/**
+ * @file tone_tracking.c
+ * @brief Goertzel bank and sliding DFT
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <math.h>
+#include "tone_tracking.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool GoertzelInit(goertzel_t * bank, float sample_frec, const float * freqs, uint8_t bins, uint16_t block_lenght){
+    if (freqs == NULL || bins == 0 || bins > TONE_MAX_BINS || block_lenght < 2 || !(sample_frec > 0)){
+        return false;
+    }
+    // The bank is left as it was when a frequency is invalid
+    for (uint8_t i = 0; i < bins; i++){
+        if (!(freqs[i] > 0)){
+            return false;
+        }
+    }
+    bank->bins = bins;
+    bank->block_lenght = block_lenght;
+    bank->count = 0;
+    for (uint8_t i = 0; i < bins; i++){
+        bank->coeff[i] = 2 * cosf(2 * M_PI * freqs[i] / sample_frec);
+        // Same scale as FFTMagnitude
+        bank->scale[i] = 8.0f / block_lenght;
+        bank->s1[i] = 0;
+        bank->s2[i] = 0;
+        bank->magnitude[i] = 0;
+    }
+    // Hann window (as dsps_wind_hann_f32) generated with a rotating phasor
+    bank->wind_cos = 1;
+    bank->wind_sin = 0;
+    bank->wind_step_cos = cosf(2 * M_PI / (block_lenght - 1));
+    bank->wind_step_sin = sinf(2 * M_PI / (block_lenght - 1));
+    return true;
+}
+
+bool GoertzelUpdate(goertzel_t * bank, float sample){
+    float x = sample * (0.5f - 0.5f * bank->wind_cos);
+    for (uint8_t i = 0; i < bank->bins; i++){
+        float s = x + bank->coeff[i] * bank->s1[i] - bank->s2[i];
+        bank->s2[i] = bank->s1[i];
+        bank->s1[i] = s;
+    }
+    float c = bank->wind_cos;
+    bank->wind_cos = c * bank->wind_step_cos - bank->wind_sin * bank->wind_step_sin;
+    bank->wind_sin = c * bank->wind_step_sin + bank->wind_sin * bank->wind_step_cos;
+    if (++bank->count < bank->block_lenght){
+        return false;
+    }
+    // |X|^2 = s1^2 + s2^2 - 2 cos(w) s1 s2
+    for (uint8_t i = 0; i < bank->bins; i++){
+        float power = bank->s1[i] * bank->s1[i] + bank->s2[i] * bank->s2[i] - bank->coeff[i] * bank->s1[i] * bank->s2[i];
+        bank->magnitude[i] = bank->scale[i] * sqrtf((power > 0) ? power : 0);
+        bank->s1[i] = 0;
+        bank->s2[i] = 0;
+    }
+    bank->count = 0;
+    bank->wind_cos = 1;
+    bank->wind_sin = 0;
+    return true;
+}
+
+void GoertzelMagnitude(const goertzel_t * bank, float * magnitude){
+    for (uint8_t i = 0; i < bank->bins; i++){
+        magnitude[i] = bank->magnitude[i];
+    }
+}
+
+bool SlidingDFTInit(sdft_t * sdft, float sample_frec, const float * freqs, uint8_t bins, uint16_t window_lenght){
+    if (freqs == NULL || bins == 0 || bins > TONE_MAX_BINS || window_lenght < 4 || !(sample_frec > 0)){
+        return false;
+    }
+    // The sliding DFT is left as it was when a frequency is invalid
+    for (uint8_t i = 0; i < bins; i++){
+        if (!(freqs[i] >= 0 && freqs[i] <= sample_frec / 2)){
+            return false;
+        }
+    }
+    float * history = calloc(window_lenght, sizeof(float));
+    if (history == NULL){
+        return false;
+    }
+    // Initialized again: free the history of the previous window
+    free(sdft->history);
+    sdft->history = history;
+    sdft->bins = bins;
+    sdft->window_lenght = window_lenght;
+    sdft->pos = 0;
+    sdft->damping_n = powf(SDFT_DAMPING, window_lenght);
+    for (uint8_t i = 0; i < bins; i++){
+        int32_t k = lroundf(freqs[i] * window_lenght / sample_frec);
+        for (uint8_t j = 0; j < 3; j++){
+            // Bins k - 1, k and k + 1
+            float w = 2 * M_PI * (k - 1 + j) / window_lenght;
+            sdft->rot_re[3 * i + j] = SDFT_DAMPING * cosf(w);
+            sdft->rot_im[3 * i + j] = SDFT_DAMPING * sinf(w);
+            sdft->dft_re[3 * i + j] = 0;
+            sdft->dft_im[3 * i + j] = 0;
+        }
+        // Same scale as FFTMagnitude (DC bin is not doubled), compensating the mean gain of the damping
+        sdft->scale[i] = ((k == 0) ? 2.0f : 8.0f) * (1 - SDFT_DAMPING) / (1 - sdft->damping_n);
+    }
+    return true;
+}
+
+void SlidingDFTDeinit(sdft_t * sdft){
+    free(sdft->history);
+    sdft->history = NULL;
+    sdft->bins = 0;
+}
+
+void SlidingDFTUpdate(sdft_t * sdft, float sample){
+    // S[n] = r exp(j w) (S[n-1] + x[n] - r^N x[n-N])
+    float delta = sample - sdft->damping_n * sdft->history[sdft->pos];
+    sdft->history[sdft->pos] = sample;
+    if (++sdft->pos == sdft->window_lenght){
+        sdft->pos = 0;
+    }
+    for (uint8_t i = 0; i < 3 * sdft->bins; i++){
+        float re = sdft->dft_re[i] + delta;
+        float im = sdft->dft_im[i];
+        sdft->dft_re[i] = re * sdft->rot_re[i] - im * sdft->rot_im[i];
+        sdft->dft_im[i] = re * sdft->rot_im[i] + im * sdft->rot_re[i];
+    }
+}
+
+void SlidingDFTMagnitude(const sdft_t * sdft, float * magnitude){
+    for (uint8_t i = 0; i < sdft->bins; i++){
+        // Hann window: X[k] / 2 - (X[k - 1] + X[k + 1]) / 4
+        const float * re = &sdft->dft_re[3 * i];
+        const float * im = &sdft->dft_im[3 * i];
+        float hann_re = 0.5f * re[1] - 0.25f * (re[0] + re[2]);
+        float hann_im = 0.5f * im[1] - 0.25f * (im[0] + im[2]);
+        magnitude[i] = sdft->scale[i] * sqrtf(hann_re * hann_re + hann_im * hann_im);
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,137 @@
+/**
+ * @file welch.c
+ * @brief Streaming Welch PSD and spectrogram
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include "welch.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Calculate the spectrum of the samples in history and advance one hop
+ */
+static void WelchFrame(welch_t * welch);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void WelchFrame(welch_t * welch){
+    const uint16_t n = welch->plan.signal_lenght;
+    float * magnitude = welch->frame;
+    if (welch->rows > 0){
+        // Calculate straight into the spectrogram ring
+        magnitude = &welch->spectrogram[welch->head * (n / 2)];
+        if (++welch->head == welch->rows){
+            welch->head = 0;
+        }
+    }
+    memcpy(welch->frame, welch->history, n * sizeof(float));
+    FFTPlanMagnitude(&welch->plan, welch->frame, magnitude);
+    // Running average
+    welch->averaged++;
+    float k = 1.0f / welch->averaged;
+    for (int i = 0; i < n / 2; i++){
+        welch->average[i] += (magnitude[i] * magnitude[i] - welch->average[i]) * k;
+    }
+    welch->frames++;
+    // Advance one hop
+    memmove(welch->history, &welch->history[welch->hop], (n - welch->hop) * sizeof(float));
+    welch->fill = n - welch->hop;
+}
+
+/*==================[external functions definition]==========================*/
+bool WelchInit(welch_t * welch, uint16_t fft_lenght, welch_overlap_t overlap, uint16_t spectrogram_rows){
+    memset(welch, 0, sizeof(welch_t));
+    if (overlap != WELCH_OVERLAP_50 && overlap != WELCH_OVERLAP_75){
+        return false;
+    }
+    if (!FFTPlanInit(&welch->plan, fft_lenght)){
+        return false;
+    }
+    welch->hop = fft_lenght / overlap;
+    welch->rows = spectrogram_rows;
+    welch->history = malloc(fft_lenght * sizeof(float));
+    welch->frame = malloc(fft_lenght * sizeof(float));
+    welch->average = calloc(fft_lenght / 2, sizeof(float));
+    if (spectrogram_rows > 0){
+        welch->spectrogram = calloc(spectrogram_rows * (fft_lenght / 2), sizeof(float));
+    }
+    if (welch->history == NULL || welch->frame == NULL || welch->average == NULL || 
+        (spectrogram_rows > 0 && welch->spectrogram == NULL)){
+        WelchDeinit(welch);
+        return false;
+    }
+    return true;
+}
+
+void WelchDeinit(welch_t * welch){
+    FFTPlanDeinit(&welch->plan);
+    free(welch->history);
+    free(welch->frame);
+    free(welch->average);
+    free(welch->spectrogram);
+    memset(welch, 0, sizeof(welch_t));
+}
+
+void WelchReset(welch_t * welch){
+    memset(welch->average, 0, (welch->plan.signal_lenght / 2) * sizeof(float));
+    welch->averaged = 0;
+}
+
+uint16_t WelchUpdate(welch_t * welch, const float * signal, uint16_t signal_lenght){
+    const uint16_t n = welch->plan.signal_lenght;
+    uint16_t spectra = 0;
+    while (signal_lenght > 0){
+        uint16_t copy = n - welch->fill;
+        if (copy > signal_lenght){
+            copy = signal_lenght;
+        }
+        memcpy(&welch->history[welch->fill], signal, copy * sizeof(float));
+        welch->fill += copy;
+        signal += copy;
+        signal_lenght -= copy;
+        if (welch->fill == n){
+            WelchFrame(welch);
+            spectra++;
+        }
+    }
+    return spectra;
+}
+
+const float * WelchAverage(const welch_t * welch){
+    return welch->average;
+}
+
+bool WelchSpectrogramRow(const welch_t * welch, uint16_t age, float * magnitude){
+    if (age >= welch->rows || age >= welch->frames){
+        return false;
+    }
+    const uint16_t n = welch->plan.signal_lenght;
+    uint16_t row = (welch->head + welch->rows - 1 - age) % welch->rows;
+    memcpy(magnitude, &welch->spectrogram[row * (n / 2)], (n / 2) * sizeof(float));
+    return true;
+}
+
+const float * WelchSpectrogramRing(const welch_t * welch, uint16_t * head, uint32_t * frames){
+    // The head from the frames: while a spectrum is in progress head already points past its row
+    *frames = welch->frames;
+    *head = (welch->rows > 0) ? *frames % welch->rows : 0;
+    return welch->spectrogram;
+}
+
+uint32_t WelchFrames(const welch_t * welch){
+    return welch->frames;
+}
+
+/*==================[end of file]============================================*/